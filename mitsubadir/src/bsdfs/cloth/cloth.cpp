@@ -61,6 +61,9 @@
                     //noise
                     m_weave_params.intensity_fineness =
                         props.getFloat("intensity_fineness", 0.0f);
+                    m_weave_params.intensity_hash =
+                        props.getString("intensity_hash", "tea") == "mix" ?
+                        WC_INTENSITY_MIX : WC_INTENSITY_TEA;
                     //yarnvar
                     m_weave_params.yarnvar_amplitude =
                         props.getFloat("yarnvar_amplitude", 0.0f);
@@ -72,16 +75,52 @@
                         props.getFloat("yarnvar_persistance", 1.0f);
                     m_weave_params.yarnvar_octaves =
                         props.getFloat("yarnvar_octaves", 1.0f); //Should be integer
+                    //samples per element, 0 evaluates the noise per sample
+                    m_weave_params.yarnvar_bake_resolution =
+                        props.getInteger("yarnvar_bake_resolution", 0);
+                    m_weave_params.yarnvar_bake_repeats =
+                        props.getInteger("yarnvar_bake_repeats", 1);
 
                     m_specular_strength = props.getFloat("specular_strength", 0.5f);
 
+                    //pattern lookup
+                    m_weave_params.segment_lookup =
+                        props.getBoolean("segment_table", true) ?
+                        WC_SEGMENT_TABLE : WC_SEGMENT_BITBOARD;
+                    //0 uses one thread per CPU
+                    m_weave_params.normalization_threads =
+                        props.getInteger("normalization_threads", 0);
+                    //if not set, the WC_NORMALIZATION_CACHE environment
+                    //variable is used. Only needs to live during the load.
+                    std::string normalization_cache =
+                        props.getString("normalization_cache", "");
+                    m_weave_params.normalization_cache_dir =
+                        props.hasProperty("normalization_cache") ?
+                        normalization_cache.c_str() : 0;
+                    //interpolate the normalization from a precomputed table
+                    m_weave_params.normalization_table =
+                        props.getBoolean("normalization_table", false);
+                    //relative error of the adaptive normalization
+                    //estimate, 0 uses the fixed number of samples
+                    m_weave_params.normalization_tolerance =
+                        props.getFloat("normalization_tolerance", 0.f);
+                    //WIF patterns larger than this many MB are stored
+                    //as their draft, 0 never does
+                    m_weave_params.implicit_pattern_threshold =
+                        props.getInteger("implicit_pattern_threshold", 0);
+                    //tabulate the specular albedo, used to choose between
+                    //sampling the diffuse and specular terms
+                    m_weave_params.albedo_table =
+                        props.getBoolean("albedo_table", true);
+
 #ifdef USE_WIFFILE
                         // LOAD WIF FILE
                         std::string wiffilename =
                             Thread::getThread()->getFileResolver()->
                         resolve(props.getString("wiffile")).string();
 
-                        wcWeavePatternFromWIF(&m_weave_params,
+                        // .wif, .weave or .cweave
+                        wcWeavePatternFromFile(&m_weave_params,
                                 wiffilename.c_str());
 #else
                     // Static pattern
@@ -106,7 +145,7 @@
                 configure();
             }
         ~Cloth() {
-            wif_free_pattern(m_weave_params.pattern_entry);
+            wcFreeWeavePattern(&m_weave_params);
         }
 
         void configure() {
@@ -116,6 +155,8 @@
             m_components.clear();
             m_components.push_back(EDiffuseReflection | EFrontSide
                     | ESpatiallyVarying);
+            m_components.push_back(EGlossyReflection | EFrontSide
+                    | ESpatiallyVarying);
             m_usesRayDifferentials = true;
 
             BSDF::configure();
@@ -148,6 +189,22 @@
             return result;
         }
 
+        // Diffuse and specular terms of the weave at a prepared shading point
+        void evalWeave(const wcShadingPoint &point, const Vector &wi,
+                const Vector &wo, Spectrum *diffuse, Float *specular) const
+        {
+            float wi_x = wi.x, wi_y = wi.y, wi_z = wi.z;
+            float wo_x = wo.x, wo_y = wo.y, wo_z = wo.z;
+            float r, g, b, s;
+            wcIntersectionBatch directions = {0, 0, &wi_x, &wi_y, &wi_z,
+                &wo_x, &wo_y, &wo_z};
+            wcColorBatch color = {&r, &g, &b};
+            wcEvalShadingPoint(&point, &directions, 1, &color, &s,
+                    &m_weave_params);
+            diffuse->fromLinearRGB(r, g, b);
+            *specular = s;
+        }
+
         Spectrum getDiffuseReflectance(const Intersection &its) const {
             wcIntersectionData intersection_data;
             intersection_data.uv_x = its.uv.x;
@@ -160,29 +217,12 @@
             return col * m_reflectance->eval(its);
         }
 
-        Spectrum eval(const BSDFSamplingRecord &bRec, EMeasure measure) const {
-            if (!(bRec.typeMask & EDiffuseReflection) || measure != ESolidAngle
-                    || Frame::cosTheta(bRec.wi) <= 0
-                    || Frame::cosTheta(bRec.wo) <= 0)
-                return Spectrum(0.0f);
-
-            wcIntersectionData intersection_data;
-            intersection_data.uv_x = bRec.its.uv.x;
-            intersection_data.uv_y = bRec.its.uv.y;
-
-            intersection_data.wi_x = bRec.wi.x;
-            intersection_data.wi_y = bRec.wi.y;
-            intersection_data.wi_z = bRec.wi.z;
-
-            intersection_data.wo_x = bRec.wo.x;
-            intersection_data.wo_y = bRec.wo.y;
-            intersection_data.wo_z = bRec.wo.z;
-
-            wcPatternData pattern_data = wcGetPatternData(intersection_data,
-                    &m_weave_params);
-            Intersection perturbed(bRec.its);
-            perturbed.shFrame = getPerturbedFrame(pattern_data, bRec.its);
-
+        // The terms of the components in bRec.typeMask at a prepared
+        // shading point, with the frame perturbed by its normal
+        Spectrum evalPoint(const wcShadingPoint &point,
+                const Intersection &perturbed,
+                const BSDFSamplingRecord &bRec) const
+        {
             Vector perturbed_wo = perturbed.toLocal(bRec.its.toWorld(bRec.wo));
             float diffuse_mask = 1.f;
             //Diffuse will be black if the perturbed direction
@@ -191,146 +231,163 @@
                 diffuse_mask = 0.f;
             }
 
-            Spectrum specular(m_specular_strength
-                * wcEvalSpecular(intersection_data,
-                    pattern_data, &m_weave_params));
-            Spectrum diffuse((1.f - m_specular_strength)
-                * wcEvalDiffuse(intersection_data,
-                    pattern_data, &m_weave_params));
-            Spectrum col;
-            col.fromSRGB(pattern_data.color_r, pattern_data.color_g,
-                pattern_data.color_b);
-            return m_reflectance->eval(bRec.its) * diffuse_mask * 
-                col*diffuse*(INV_PI * Frame::cosTheta(perturbed_wo)) +
-                m_specular_strength*specular*Frame::cosTheta(bRec.wo);
+            Spectrum diffuse;
+            Float weave_specular;
+            evalWeave(point, bRec.wi, bRec.wo, &diffuse, &weave_specular);
+            Spectrum result(0.0f);
+            if (bRec.typeMask & EDiffuseReflection) {
+                diffuse *= (1.f - m_specular_strength);
+                Spectrum col;
+                col.fromSRGB(point.data.color_r, point.data.color_g,
+                    point.data.color_b);
+                result += m_reflectance->eval(bRec.its) * diffuse_mask *
+                    col*diffuse*(INV_PI * Frame::cosTheta(perturbed_wo));
+            }
+            if (bRec.typeMask & EGlossyReflection) {
+                Spectrum specular(m_specular_strength * weave_specular);
+                result += m_specular_strength*specular*Frame::cosTheta(bRec.wo);
+            }
+            return result;
+        }
+
+        // Probability of sampling the specular term, in proportion to the
+        // albedos of the two terms of evalPoint for bRec.wi. They are
+        // weighted differently from wcShade, so wcSpecularProbability is
+        // not used.
+        Float specularProbability(const wcShadingPoint &point,
+                const BSDFSamplingRecord &bRec) const
+        {
+            if (!(bRec.typeMask & EGlossyReflection))
+                return 0.0f;
+            if (!(bRec.typeMask & EDiffuseReflection))
+                return 1.0f;
+            Float wi_z = Frame::cosTheta(bRec.wi);
+            Float specular_albedo = wcSpecularAlbedo(wi_z, &m_weave_params);
+            if (specular_albedo < 0)
+                specular_albedo = 1.0f;
+            //The specular term is weighted by specular_strength twice, and
+            //is not divided by pi
+            Float specular = M_PI * m_specular_strength * m_specular_strength
+                * specular_albedo * point.intensity_variation;
+            wcColor albedo = wcDiffuseAlbedo(&point, wi_z);
+            Spectrum diffuse, col;
+            diffuse.fromLinearRGB(albedo.r, albedo.g, albedo.b);
+            col.fromSRGB(point.data.color_r, point.data.color_g,
+                point.data.color_b);
+            Float diffuse_albedo = (1.f - m_specular_strength) *
+                (m_reflectance->eval(bRec.its) * col * diffuse).getLuminance();
+            if (specular + diffuse_albedo <= 0)
+                return 0.0f;
+            return specular / (specular + diffuse_albedo);
+        }
+
+        // Density of the mixture of cosine weighted samples in the perturbed
+        // frame and samples of the specular highlight
+        Float pdfPoint(const wcShadingPoint &point,
+                const Intersection &perturbed,
+                const BSDFSamplingRecord &bRec) const
+        {
+            Float specular_probability = specularProbability(point, bRec);
+            Float result = 0.0f;
+            if (specular_probability < 1) {
+                result += (1 - specular_probability) *
+                    warp::squareToCosineHemispherePdf(perturbed.toLocal(
+                        bRec.its.toWorld(bRec.wo)));
+            }
+            if (specular_probability > 0) {
+                wcIntersectionData intersection_data;
+                memset(&intersection_data, 0, sizeof(intersection_data));
+                intersection_data.wi_x = bRec.wi.x;
+                intersection_data.wi_y = bRec.wi.y;
+                intersection_data.wi_z = bRec.wi.z;
+                intersection_data.wo_x = bRec.wo.x;
+                intersection_data.wo_y = bRec.wo.y;
+                intersection_data.wo_z = bRec.wo.z;
+                result += specular_probability * wcPdfSpecular(
+                    intersection_data, point.data, &m_weave_params);
+            }
+            return result;
+        }
+
+        Spectrum eval(const BSDFSamplingRecord &bRec, EMeasure measure) const {
+            if (!(bRec.typeMask & (EDiffuseReflection | EGlossyReflection))
+                    || measure != ESolidAngle
+                    || Frame::cosTheta(bRec.wi) <= 0
+                    || Frame::cosTheta(bRec.wo) <= 0)
+                return Spectrum(0.0f);
+
+            wcShadingPoint point;
+            wcPrepareShadingPoint(bRec.its.uv.x, bRec.its.uv.y,
+                    &m_weave_params, &point);
+            Intersection perturbed(bRec.its);
+            perturbed.shFrame = getPerturbedFrame(point.data, bRec.its);
+            return evalPoint(point, perturbed, bRec);
         }
 
         Float pdf(const BSDFSamplingRecord &bRec, EMeasure measure) const {
-            if (!(bRec.typeMask & EDiffuseReflection) || measure != ESolidAngle
+            if (!(bRec.typeMask & (EDiffuseReflection | EGlossyReflection))
+                    || measure != ESolidAngle
                     || Frame::cosTheta(bRec.wi) <= 0
                     || Frame::cosTheta(bRec.wo) <= 0)
                 return 0.0f;
 
             const Intersection& its = bRec.its;
-            wcIntersectionData intersection_data;
-            intersection_data.uv_x = its.uv.x;
-            intersection_data.uv_y = its.uv.y;
-
-            intersection_data.wi_x = bRec.wi.x;
-            intersection_data.wi_y = bRec.wi.y;
-            intersection_data.wi_z = bRec.wi.z;
-
-            intersection_data.wo_x = bRec.wo.x;
-            intersection_data.wo_y = bRec.wo.y;
-            intersection_data.wo_z = bRec.wo.z;
-
-            wcPatternData pattern_data = wcGetPatternData(intersection_data,
-                    &m_weave_params);
+            wcShadingPoint point;
+            wcPrepareShadingPoint(its.uv.x, its.uv.y, &m_weave_params, &point);
             Intersection perturbed(its);
-            perturbed.shFrame = getPerturbedFrame(pattern_data, its);
-
-            return warp::squareToCosineHemispherePdf(perturbed.toLocal(
-                        its.toWorld(bRec.wo)));
-
+            perturbed.shFrame = getPerturbedFrame(point.data, its);
+            return pdfPoint(point, perturbed, bRec);
         }
 
         Spectrum sample(BSDFSamplingRecord &bRec, const Point2 &sample) const {
-            if (!(bRec.typeMask & EDiffuseReflection)
-                    || Frame::cosTheta(bRec.wi) <= 0) return Spectrum(0.0f);
-            const Intersection& its = bRec.its;
-            wcIntersectionData intersection_data;
-            intersection_data.uv_x = its.uv.x;
-            intersection_data.uv_y = its.uv.y;
-
-            intersection_data.wi_x = bRec.wi.x;
-            intersection_data.wi_y = bRec.wi.y;
-            intersection_data.wi_z = bRec.wi.z;
-
-            intersection_data.wo_x = bRec.wo.x;
-            intersection_data.wo_y = bRec.wo.y;
-            intersection_data.wo_z = bRec.wo.z;
-
-            wcPatternData pattern_data = wcGetPatternData(intersection_data,
-                    &m_weave_params);
-            Intersection perturbed(its);
-            perturbed.shFrame = getPerturbedFrame(pattern_data, its);
-
-            bRec.wi = perturbed.toLocal(its.toWorld(bRec.wi));
-
-            bRec.wo = warp::squareToCosineHemisphere(sample);
-            Vector perturbed_wo = perturbed.toLocal(its.toWorld(bRec.wo));
-
-            bRec.sampledComponent = 0;
-            bRec.sampledType = EDiffuseReflection;
-            bRec.eta = 1.f;
-            float diffuse_mask = 0.f;
-            if (Frame::cosTheta(perturbed_wo)
-                    * Frame::cosTheta(bRec.wo) > 0){
-                //We sample based on bRec.wo, take account of this
-                diffuse_mask = Frame::cosTheta(perturbed_wo)/
-                    Frame::cosTheta(bRec.wo);
-            }
-            Spectrum specular(m_specular_strength
-                * wcEvalSpecular(intersection_data,
-                    pattern_data, &m_weave_params));
-            Spectrum diffuse((1.f - m_specular_strength)
-                * wcEvalDiffuse(intersection_data,
-                    pattern_data, &m_weave_params));
-            Spectrum col;
-            col.fromSRGB(pattern_data.color_r, pattern_data.color_g,
-                pattern_data.color_b);
-            return m_reflectance->eval(bRec.its) * diffuse_mask *
-                col*diffuse + m_specular_strength*specular;
+            Float pdf;
+            return this->sample(bRec, pdf, sample);
         }
 
         Spectrum sample(BSDFSamplingRecord &bRec, Float &pdf, const Point2 &sample) const {
-            if (!(bRec.typeMask & EDiffuseReflection) || Frame::cosTheta(bRec.wi) <= 0)
+            if (!(bRec.typeMask & (EDiffuseReflection | EGlossyReflection))
+                    || Frame::cosTheta(bRec.wi) <= 0)
                 return Spectrum(0.0f);
 
             const Intersection& its = bRec.its;
-            wcIntersectionData intersection_data;
-            intersection_data.uv_x = its.uv.x;
-            intersection_data.uv_y = its.uv.y;
-
-            intersection_data.wi_x = bRec.wi.x;
-            intersection_data.wi_y = bRec.wi.y;
-            intersection_data.wi_z = bRec.wi.z;
-
-            intersection_data.wo_x = bRec.wo.x;
-            intersection_data.wo_y = bRec.wo.y;
-            intersection_data.wo_z = bRec.wo.z;
-
-            wcPatternData pattern_data = wcGetPatternData(intersection_data,
-                    &m_weave_params);
+            wcShadingPoint point;
+            wcPrepareShadingPoint(its.uv.x, its.uv.y, &m_weave_params, &point);
             Intersection perturbed(its);
-            perturbed.shFrame = getPerturbedFrame(pattern_data, its);
-            bRec.wi = perturbed.toLocal(its.toWorld(bRec.wi));
-
-            bRec.wo = warp::squareToCosineHemisphere(sample);
-            Vector perturbed_wo = perturbed.toLocal(its.toWorld(bRec.wo));
-            pdf = warp::squareToCosineHemispherePdf(bRec.wo);
-
-            bRec.sampledComponent = 0;
-            bRec.sampledType = EDiffuseReflection;
-            bRec.eta = 1.f;
-            float diffuse_mask = 0.f;
-            if (Frame::cosTheta(perturbed_wo)
-                    * Frame::cosTheta(bRec.wo) > 0){
-                //We sample based on bRec.wo, take account of this
-                diffuse_mask = Frame::cosTheta(perturbed_wo)/
-                    Frame::cosTheta(bRec.wo);
+            perturbed.shFrame = getPerturbedFrame(point.data, its);
+
+            //Choose the term to sample in proportion to its albedo
+            Float specular_probability = specularProbability(point, bRec);
+            Point2 lobe_sample(sample);
+            if (lobe_sample.x < specular_probability) {
+                lobe_sample.x /= specular_probability;
+                wcIntersectionData intersection_data;
+                memset(&intersection_data, 0, sizeof(intersection_data));
+                intersection_data.wi_x = bRec.wi.x;
+                intersection_data.wi_y = bRec.wi.y;
+                intersection_data.wi_z = bRec.wi.z;
+                if (wcSampleSpecular(&intersection_data, point.data,
+                        lobe_sample.x, lobe_sample.y, &m_weave_params) <= 0)
+                    return Spectrum(0.0f);
+                bRec.wo = Vector(intersection_data.wo_x,
+                    intersection_data.wo_y, intersection_data.wo_z);
+                bRec.sampledComponent = 1;
+                bRec.sampledType = EGlossyReflection;
+            } else {
+                lobe_sample.x = (lobe_sample.x - specular_probability) /
+                    (1 - specular_probability);
+                bRec.wo = its.toLocal(perturbed.toWorld(
+                    warp::squareToCosineHemisphere(lobe_sample)));
+                bRec.sampledComponent = 0;
+                bRec.sampledType = EDiffuseReflection;
             }
-            Spectrum specular(m_specular_strength
-                * wcEvalSpecular(intersection_data,
-                    pattern_data, &m_weave_params));
-            Spectrum diffuse((1.f - m_specular_strength)
-                * wcEvalDiffuse(intersection_data,
-                    pattern_data, &m_weave_params));
-            Spectrum col;
-            col.fromSRGB(pattern_data.color_r, pattern_data.color_g,
-                pattern_data.color_b);
-            return m_reflectance->eval(bRec.its) * diffuse_mask *
-                col*diffuse + m_specular_strength*specular;
+            bRec.eta = 1.f;
+            if (Frame::cosTheta(bRec.wo) <= 0)
+                return Spectrum(0.0f);
+
+            pdf = pdfPoint(point, perturbed, bRec);
+            if (pdf <= 0)
+                return Spectrum(0.0f);
+            return evalPoint(point, perturbed, bRec) / pdf;
         }
 
         void addChild(const std::string &name, ConfigurableObject *child) {
@@ -23,3 +23,25 @@ static void halton_4(int n, float val[]){
         }
     }
 }
+
+//Sets val[0] and val[1] to the first two dimensions of the n-th point,
+//the same as halton_4 but faster, since the bases are constants
+WC_PREFIX
+static void halton_2(int n, float val[]){
+    float f = 1.f;
+    int i = n;
+    val[0] = 0.f;
+    while(i>0){
+        f = f * (1.f/2.f);
+        val[0] = val[0] + f * (i % 2);
+        i = i / 2;
+    }
+    f = 1.f;
+    i = n;
+    val[1] = 0.f;
+    while(i>0){
+        f = f * (1.f/3.f);
+        val[1] = val[1] + f * (i % 3);
+        i = i / 3;
+    }
+}
@@ -0,0 +1,9675 @@
+#pragma once
+// Generated by tools/gen_normalization_table, don't edit.
+// 1/specular_normalization as computed when a pattern is loaded (without
+// SIMD), on a grid over the yarn parameters. Relative error of the
+// interpolated normalization at 2000 random points in the table:
+//   filament: median 1.91%, 90%: 9.83%, 99%: 23.8%, max 72.8%
+//   staple:   median 1.70%, 90%: 5.09%, 99%: 25.1%, max 59.6%
+
+#define WC_NORMALIZATION_TABLE_UMAX_SIZE 8
+#define WC_NORMALIZATION_TABLE_PSI_SIZE 10
+#define WC_NORMALIZATION_TABLE_ALPHA_SIZE 6
+#define WC_NORMALIZATION_TABLE_BETA_SIZE 7
+#define WC_NORMALIZATION_TABLE_DELTA_X_SIZE 13
+
+WC_PREFIX
+static const float wc_normalization_table_umax[
+    WC_NORMALIZATION_TABLE_UMAX_SIZE] = {
+    0.0500000007f, 0.150000006f, 0.300000012f, 0.5f, 0.699999988f,
+    0.949999988f, 1.25f, 1.57079637f,
+};
+
+WC_PREFIX
+static const float wc_normalization_table_psi[
+    WC_NORMALIZATION_TABLE_PSI_SIZE] = {
+    0.00999999978f, 0.0199999996f, 0.0500000007f, 0.100000001f, 0.200000003f,
+    0.349999994f, 0.550000012f, 0.800000012f, 1.14999998f, 1.57079637f,
+};
+
+WC_PREFIX
+static const float wc_normalization_table_alpha[
+    WC_NORMALIZATION_TABLE_ALPHA_SIZE] = {
+    0.f, 0.0500000007f, 0.100000001f, 0.150000006f, 0.25f,
+    1.f,
+};
+
+WC_PREFIX
+static const float wc_normalization_table_beta[
+    WC_NORMALIZATION_TABLE_BETA_SIZE] = {
+    0.f, 0.5f, 1.f, 2.f, 3.5f,
+    5.f, 10.f,
+};
+
+WC_PREFIX
+static const float wc_normalization_table_delta_x[
+    WC_NORMALIZATION_TABLE_DELTA_X_SIZE] = {
+    0.0199999996f, 0.0500000007f, 0.100000001f, 0.150000006f, 0.200000003f,
+    0.25f, 0.300000012f, 0.349999994f, 0.400000006f, 0.5f,
+    0.600000024f, 0.800000012f, 1.f,
+};
+
+// [umax][alpha][beta][delta_x]
+WC_PREFIX
+static const float wc_normalization_table_filament_values[
+    WC_NORMALIZATION_TABLE_UMAX_SIZE*WC_NORMALIZATION_TABLE_ALPHA_SIZE
+    *WC_NORMALIZATION_TABLE_BETA_SIZE*WC_NORMALIZATION_TABLE_DELTA_X_SIZE] = {
+    0.00328182f, 0.00240179f, 0.00168608f, 0.00165955f, 0.00182308f,
+    0.00204137f, 0.00196398f, 0.00175909f, 0.00163021f, 0.00211612f,
+    0.00242151f, 0.00181613f, 0.00145291f, 0.00251518f, 0.00183541f,
+    0.00139047f, 0.00107798f, 0.001134f, 0.0012888f, 0.00129789f,
+    0.00126628f, 0.00125943f, 0.00135101f, 0.00153474f, 0.00115105f,
+    0.000920844f, 0.00186419f, 0.00149479f, 0.00116901f, 0.000779338f,
+    0.000681393f, 0.000734643f, 0.000814846f, 0.000854077f, 0.000905194f,
+    0.000789789f, 0.00087782f, 0.000764087f, 0.000730358f, 0.00103119f,
+    0.000796969f, 0.000677286f, 0.000523653f, 0.000595729f, 0.000543573f,
+    0.00053542f, 0.000688999f, 0.000602874f, 0.000482299f, 0.000692697f,
+    0.000587684f, 0.000470147f, 0.000637403f, 0.000288935f, 0.000435351f,
+    0.000368595f, 0.000513969f, 0.000459057f, 0.000382547f, 0.000462057f,
+    0.0004043f, 0.000360082f, 0.000531154f, 0.000432747f, 0.000346198f,
+    0.000345405f, 0.000138162f, 0.000282426f, 0.000233953f, 0.00041535f,
+    0.000362283f, 0.000301902f, 0.000289897f, 0.00025366f, 0.000259617f,
+    0.000376491f, 0.000291869f, 0.000233495f, 3.37163e-05f, 1.34865e-05f,
+    6.32993e-05f, 4.76307e-05f, 0.000222431f, 0.000182698f, 0.000152248f,
+    0.000133938f, 0.000117196f, 0.000104175f, 0.000131308f, 9.84809e-05f,
+    7.87847e-05f, 0.00431283f, 0.00315634f, 0.00221578f, 0.00218091f,
+    0.00239582f, 0.00268269f, 0.00258099f, 0.00231172f, 0.00214236f,
+    0.00278092f, 0.00318225f, 0.00238669f, 0.00190935f, 0.00350498f,
+    0.00248527f, 0.00186082f, 0.00155459f, 0.00170674f, 0.00193011f,
+    0.0019149f, 0.00179981f, 0.00176754f, 0.00201581f, 0.00229548f,
+    0.00172161f, 0.00137729f, 0.002854f, 0.00213154f, 0.00163935f,
+    0.00117391f, 0.00120696f, 0.00137596f, 0.00139278f, 0.00138761f,
+    0.00141331f, 0.00144377f, 0.00163856f, 0.0012353f, 0.00101919f,
+    0.00188081f, 0.00143372f, 0.00114763f, 0.000765089f, 0.000732294f,
+    0.000836067f, 0.000846099f, 0.000870032f, 0.000921473f, 0.000876436f,
+    0.000994868f, 0.000775995f, 0.000732682f, 0.00125132f, 0.000881098f,
+    0.000715976f, 0.00053605f, 0.000634347f, 0.000663274f, 0.000649684f,
+    0.000643091f, 0.000638102f, 0.00068976f, 0.000787454f, 0.00059059f,
+    0.00047334f, 0.00106495f, 0.000768601f, 0.000563038f, 0.000522768f,
+    0.000574263f, 0.000643786f, 0.000622409f, 0.000557351f, 0.000556652f,
+    0.000667784f, 0.000763821f, 0.000572866f, 0.000458293f, 0.00103126f,
+    0.000754651f, 0.000529759f, 0.000521364f, 0.000572739f, 0.000641318f,
+    0.000617053f, 0.000552676f, 0.000512233f, 0.000664803f, 0.000760745f,
+    0.000570559f, 0.000456447f, 0.00534385f, 0.00391089f, 0.00274548f,
+    0.00270228f, 0.00296856f, 0.003324f, 0.00319799f, 0.00286435f,
+    0.00265451f, 0.00344572f, 0.00394299f, 0.00295725f, 0.0023658f,
+    0.00449479f, 0.00323982f, 0.00233116f, 0.00207595f, 0.00227948f,
+    0.00257143f, 0.0025319f, 0.00233334f, 0.00227565f, 0.00268061f,
+    0.00305622f, 0.00229217f, 0.00183373f, 0.0038438f, 0.00276829f,
+    0.0021097f, 0.00164318f, 0.00177969f, 0.00201727f, 0.00200978f,
+    0.00192114f, 0.00192142f, 0.00210857f, 0.0023993f, 0.00179947f,
+    0.00143958f, 0.00287062f, 0.00207047f, 0.00161798f, 0.00118866f,
+    0.00130503f, 0.00147738f, 0.0014631f, 0.00138658f, 0.00142958f,
+    0.00154123f, 0.00175561f, 0.00131671f, 0.00105337f, 0.00224113f,
+    0.00158137f, 0.00118632f, 0.00105741f, 0.00116146f, 0.00130459f,
+    0.00126669f, 0.00113416f, 0.00114621f, 0.00135456f, 0.00154819f,
+    0.00116115f, 0.000928917f, 0.00208867f, 0.00152315f, 0.00107007f,
+    0.00104413f, 0.001147f, 0.0012851f, 0.00123941f, 0.00110998f,
+    0.00106476f, 0.00133258f, 0.00152456f, 0.00114342f, 0.000914737f,
+    0.00206228f, 0.0015092f, 0.00105946f, 0.00104273f, 0.00114548f,
+    0.00128263f, 0.00123406f, 0.00110531f, 0.00102438f, 0.0013296f,
+    0.00152148f, 0.00114111f, 0.000912891f, 0.00637486f, 0.00466543f,
+    0.00327518f, 0.00322364f, 0.0035413f, 0.00396532f, 0.00381499f,
+    0.00341699f, 0.00316665f, 0.00411052f, 0.00470373f, 0.0035278f,
+    0.00282224f, 0.00548459f, 0.00399436f, 0.00280151f, 0.00259732f,
+    0.00285222f, 0.00321274f, 0.00314891f, 0.00286687f, 0.00278376f,
+    0.00334541f, 0.00381696f, 0.00286272f, 0.00229018f, 0.00483361f,
+    0.00340504f, 0.00258005f, 0.00214258f, 0.00235243f, 0.00265859f,
+    0.00262679f, 0.00245467f, 0.00242953f, 0.00277337f, 0.00316004f,
+    0.00237003f, 0.00189603f, 0.00386042f, 0.00270723f, 0.00208833f,
+    0.00171002f, 0.00187777f, 0.0021187f, 0.00208011f, 0.00192011f,
+    0.0019377f, 0.00220603f, 0.00251635f, 0.00188726f, 0.00150981f,
+    0.00323093f, 0.00233592f, 0.00165667f, 0.00157878f, 0.0017342f,
+    0.00194591f, 0.00188369f, 0.00168679f, 0.00165432f, 0.00201936f,
+    0.00230893f, 0.0017317f, 0.00138536f, 0.00311969f, 0.00227769f,
+    0.00159742f, 0.00156549f, 0.00171974f, 0.00192642f, 0.00185642f,
+    0.00166262f, 0.00157287f, 0.00199738f, 0.0022853f, 0.00171398f,
+    0.00137118f, 0.00309329f, 0.00226374f, 0.00158916f, 0.00156409f,
+    0.00171822f, 0.00192395f, 0.00185106f, 0.00165794f, 0.00153653f,
+    0.0019944f, 0.00228223f, 0.00171167f, 0.00136934f, 0.00843689f,
+    0.00617452f, 0.00433457f, 0.00426637f, 0.00468677f, 0.00524795f,
+    0.005049f, 0.00452225f, 0.00419095f, 0.00544011f, 0.00622521f,
+    0.00466891f, 0.00373513f, 0.00754612f, 0.00550345f, 0.00384923f,
+    0.00364004f, 0.00399769f, 0.00449538f, 0.00438291f, 0.00393393f,
+    0.00379999f, 0.00467501f, 0.00533844f, 0.00400383f, 0.00320306f,
+    0.00681322f, 0.00490183f, 0.00352074f, 0.0031853f, 0.00349791f,
+    0.00394122f, 0.00386079f, 0.00352173f, 0.00344575f, 0.00410297f,
+    0.00468152f, 0.00351114f, 0.00280891f, 0.00584003f, 0.00417022f,
+    0.00302902f, 0.00275274f, 0.00302325f, 0.00340133f, 0.00331411f,
+    0.00298717f, 0.00295392f, 0.00353563f, 0.00403783f, 0.00302837f,
+    0.0024227f, 0.0052752f, 0.00384501f, 0.00269381f, 0.0026215f,
+    0.00287967f, 0.00322854f, 0.0031177f, 0.00279206f, 0.00267055f,
+    0.00334895f, 0.00383042f, 0.00287281f, 0.00229825f, 0.00518172f,
+    0.00378678f, 0.00265682f, 0.00260822f, 0.00286522f, 0.00320905f,
+    0.00309042f, 0.00276788f, 0.0025891f, 0.00332698f, 0.00380678f,
+    0.00285509f, 0.00228407f, 0.00515532f, 0.00377284f, 0.00264855f,
+    0.00260682f, 0.00286369f, 0.00320658f, 0.00308507f, 0.00276321f,
+    0.00256082f, 0.003324f, 0.00380371f, 0.00285278f, 0.00228222f,
+    0.0239021f, 0.0174927f, 0.01228f, 0.0120868f, 0.0132778f,
+    0.0148677f, 0.0143041f, 0.0128118f, 0.0118731f, 0.0154121f,
+    0.0176363f, 0.0132272f, 0.0105818f, 0.0230113f, 0.0168216f,
+    0.0117947f, 0.0114605f, 0.0125888f, 0.0141151f, 0.013638f,
+    0.012215f, 0.0114216f, 0.014647f, 0.0167495f, 0.0125622f,
+    0.0100497f, 0.0222056f, 0.01622f, 0.0113672f, 0.0110057f,
+    0.012089f, 0.013561f, 0.0131159f, 0.011747f, 0.0110674f,
+    0.0140749f, 0.0160926f, 0.0120695f, 0.00965558f, 0.0212074f,
+    0.0154884f, 0.0108579f, 0.0105732f, 0.0116143f, 0.0130211f,
+    0.0125692f, 0.0112571f, 0.0105756f, 0.0135076f, 0.0154489f,
+    0.0115867f, 0.00926936f, 0.0207404f, 0.0151632f, 0.0106393f,
+    0.0104419f, 0.0114707f, 0.0128483f, 0.0123728f, 0.0110816f,
+    0.0102922f, 0.0133209f, 0.0152415f, 0.0114311f, 0.00914491f,
+    0.0206469f, 0.015105f, 0.0106023f, 0.0104287f, 0.0114563f,
+    0.0128288f, 0.0123455f, 0.0110574f, 0.0102513f, 0.013299f,
+    0.0152179f, 0.0114134f, 0.00913073f, 0.0206205f, 0.015091f,
+    0.010594f, 0.0104273f, 0.0114548f, 0.0128263f, 0.0123401f,
+    0.0110527f, 0.010243f, 0.013296f, 0.0152148f, 0.0114111f,
+    0.00912889f, 0.00597814f, 0.00541862f, 0.00501219f, 0.00468177f,
+    0.0062263f, 0.00629316f, 0.00595259f, 0.00602712f, 0.00553487f,
+    0.00664979f, 0.0076892f, 0.00587972f, 0.00470378f, 0.00417809f,
+    0.0039847f, 0.00357071f, 0.00338348f, 0.00388056f, 0.0039791f,
+    0.00408946f, 0.00415745f, 0.00383587f, 0.00423587f, 0.00487596f,
+    0.00370193f, 0.00296154f, 0.00419699f, 0.00375115f, 0.00256296f,
+    0.00281409f, 0.00235174f, 0.00252298f, 0.00261591f, 0.00263798f,
+    0.0028169f, 0.00247849f, 0.00278906f, 0.00242951f, 0.00206773f,
+    0.00448745f, 0.00286214f, 0.00179661f, 0.00173078f, 0.00167936f,
+    0.00162946f, 0.00189321f, 0.00223324f, 0.00211132f, 0.00182389f,
+    0.0023631f, 0.00180938f, 0.0014475f, 0.00373067f, 0.00216234f,
+    0.00129016f, 0.00106179f, 0.00106328f, 0.00113486f, 0.0011402f,
+    0.00144471f, 0.00137562f, 0.00131123f, 0.0018212f, 0.0013659f,
+    0.00109272f, 0.00274277f, 0.00146861f, 0.000839055f, 0.000657265f,
+    0.000736688f, 0.000819712f, 0.00084602f, 0.000853201f, 0.000816192f,
+    0.00100546f, 0.00131615f, 0.000987115f, 0.000789692f, 0.000784993f,
+    0.000355168f, 0.000185469f, 0.000136008f, 0.000293219f, 0.000304262f,
+    0.000349351f, 0.000300147f, 0.000290751f, 0.000434543f, 0.000504835f,
+    0.000378626f, 0.000302901f, 0.00785622f, 0.00712093f, 0.00658682f,
+    0.00615259f, 0.00818235f, 0.00827021f, 0.00782266f, 0.0079206f,
+    0.00727369f, 0.00873888f, 0.0101048f, 0.00772689f, 0.00618151f,
+    0.00581795f, 0.00519072f, 0.00503951f, 0.00474977f, 0.00583661f,
+    0.00595616f, 0.00595952f, 0.00605093f, 0.00555513f, 0.00632496f,
+    0.00729159f, 0.00554909f, 0.00443927f, 0.00506753f, 0.00495717f,
+    0.00403176f, 0.00395943f, 0.00413606f, 0.00424681f, 0.00441122f,
+    0.00448946f, 0.00432701f, 0.00452213f, 0.0052047f, 0.00397229f,
+    0.00317784f, 0.00535799f, 0.00394462f, 0.00269454f, 0.00269409f,
+    0.00251468f, 0.00269589f, 0.0027464f, 0.00286461f, 0.00283455f,
+    0.00274176f, 0.0031585f, 0.00249361f, 0.00207694f, 0.00460121f,
+    0.00281074f, 0.00190948f, 0.00163226f, 0.00201539f, 0.00204486f,
+    0.00199521f, 0.00207607f, 0.00196553f, 0.00216371f, 0.00249995f,
+    0.0019082f, 0.00152656f, 0.00361331f, 0.00211701f, 0.00165586f,
+    0.00147615f, 0.00196233f, 0.00198477f, 0.00189112f, 0.0019157f,
+    0.00175873f, 0.00209768f, 0.0024253f, 0.00185393f, 0.00148314f,
+    0.00187809f, 0.00170231f, 0.00157463f, 0.00147083f, 0.00195606f,
+    0.00197707f, 0.00187021f, 0.00189363f, 0.00173897f, 0.00208911f,
+    0.00241565f, 0.00184718f, 0.00147774f, 0.00973431f, 0.00882324f,
+    0.00816144f, 0.00762341f, 0.0101384f, 0.0102473f, 0.00969272f,
+    0.00981408f, 0.00901253f, 0.010828f, 0.0125205f, 0.00957405f,
+    0.00765925f, 0.00769604f, 0.006796f, 0.0065083f, 0.00616076f,
+    0.00779266f, 0.00793321f, 0.00782958f, 0.0079444f, 0.00729396f,
+    0.00841406f, 0.00970722f, 0.00739627f, 0.00591701f, 0.00636974f,
+    0.00616319f, 0.00550055f, 0.00510477f, 0.00609211f, 0.00622386f,
+    0.00628128f, 0.00638293f, 0.00585847f, 0.00661122f, 0.00762033f,
+    0.00579664f, 0.00463732f, 0.00622853f, 0.00515064f, 0.00416334f,
+    0.00383943f, 0.00447073f, 0.00455558f, 0.00454827f, 0.00462207f,
+    0.00434467f, 0.00483085f, 0.00557414f, 0.004246f, 0.0033968f,
+    0.00547175f, 0.00383503f, 0.00337828f, 0.00298928f, 0.00397144f,
+    0.00402192f, 0.00386527f, 0.0039184f, 0.00359673f, 0.00425281f,
+    0.00491558f, 0.00375536f, 0.00300429f, 0.00448385f, 0.00341047f,
+    0.0031544f, 0.00294697f, 0.00391838f, 0.00396183f, 0.00376119f,
+    0.00380917f, 0.00349756f, 0.00418678f, 0.00484094f, 0.0037011f,
+    0.00296088f, 0.00375618f, 0.00340462f, 0.00314926f, 0.00294165f,
+    0.00391211f, 0.00395412f, 0.00374028f, 0.00378711f, 0.0034778f,
+    0.0041782f, 0.00483128f, 0.00369434f, 0.00295548f, 0.0116124f,
+    0.0105255f, 0.00973607f, 0.00909423f, 0.0120945f, 0.0122243f,
+    0.0115628f, 0.0117075f, 0.0107514f, 0.0129171f, 0.0149361f,
+    0.0114212f, 0.00913699f, 0.00957413f, 0.00849831f, 0.0079771f,
+    0.00757175f, 0.00974871f, 0.00991026f, 0.00969965f, 0.00983788f,
+    0.00903279f, 0.0105031f, 0.0121229f, 0.00924343f, 0.00739475f,
+    0.00795775f, 0.00736921f, 0.00696935f, 0.00647126f, 0.00804816f,
+    0.00820092f, 0.00815134f, 0.00827641f, 0.0075973f, 0.00870031f,
+    0.010036f, 0.00764381f, 0.00611505f, 0.00709907f, 0.00635666f,
+    0.00563213f, 0.00505159f, 0.00642678f, 0.00653264f, 0.00641833f,
+    0.00651554f, 0.00597977f, 0.00691994f, 0.00798977f, 0.00609317f,
+    0.00487454f, 0.00634229f, 0.00516105f, 0.00484707f, 0.00446011f,
+    0.00592749f, 0.00599897f, 0.00573533f, 0.00581188f, 0.00533556f,
+    0.0063419f, 0.00733122f, 0.00560253f, 0.00448202f, 0.00564106f,
+    0.00511278f, 0.00472903f, 0.00441779f, 0.00587443f, 0.00593888f,
+    0.00563125f, 0.00570265f, 0.00523639f, 0.00627587f, 0.00725657f,
+    0.00554827f, 0.00443862f, 0.00563426f, 0.00510693f, 0.00472388f,
+    0.00441247f, 0.00586816f, 0.00593117f, 0.00561034f, 0.00568058f,
+    0.00521663f, 0.00626729f, 0.00724691f, 0.00554151f, 0.00443321f,
+    0.0153686f, 0.0139302f, 0.0128853f, 0.0120359f, 0.0160066f,
+    0.0161784f, 0.0153029f, 0.0154945f, 0.014229f, 0.0170953f,
+    0.0197674f, 0.0151156f, 0.0120925f, 0.0133303f, 0.0119029f,
+    0.0110033f, 0.0103937f, 0.0136608f, 0.0138644f, 0.0134398f,
+    0.0136248f, 0.0125104f, 0.0146813f, 0.0169541f, 0.0129378f,
+    0.0103502f, 0.0117139f, 0.0104266f, 0.00990694f, 0.00929324f,
+    0.0119603f, 0.012155f, 0.0118915f, 0.0120634f, 0.011075f,
+    0.0128785f, 0.0148672f, 0.0113382f, 0.00907052f, 0.0100299f,
+    0.0090088f, 0.00856972f, 0.00787358f, 0.0103389f, 0.0104867f,
+    0.0101585f, 0.0103025f, 0.00945743f, 0.0110981f, 0.012821f,
+    0.00978751f, 0.00783001f, 0.00946028f, 0.00856567f, 0.00792187f,
+    0.00740175f, 0.0098396f, 0.00995308f, 0.00947546f, 0.00959883f,
+    0.00881321f, 0.0105201f, 0.0121625f, 0.00929687f, 0.0074375f,
+    0.00939724f, 0.00851739f, 0.00787828f, 0.00735943f, 0.00978654f,
+    0.00989299f, 0.00937138f, 0.0094896f, 0.00871405f, 0.0104541f,
+    0.0120878f, 0.00924261f, 0.00739409f, 0.00939044f, 0.00851155f,
+    0.00787313f, 0.00735411f, 0.00978026f, 0.00988528f, 0.00935046f,
+    0.00946753f, 0.00869429f, 0.0104455f, 0.0120782f, 0.00923585f,
+    0.00738868f, 0.0435399f, 0.0394648f, 0.0365047f, 0.0340982f,
+    0.0453473f, 0.0458342f, 0.0433538f, 0.0438966f, 0.0403115f,
+    0.0484317f, 0.0560019f, 0.0428231f, 0.0342585f, 0.0415016f,
+    0.0374376f, 0.0346227f, 0.0323493f, 0.0430016f, 0.0435202f,
+    0.0414907f, 0.042027f, 0.0385929f, 0.0460178f, 0.0531886f,
+    0.0406453f, 0.0325162f, 0.0398852f, 0.0359613f, 0.0332556f,
+    0.0310742f, 0.041301f, 0.0418108f, 0.0399424f, 0.0404655f,
+    0.0371574f, 0.0442149f, 0.0511017f, 0.0390457f, 0.0312365f,
+    0.0382012f, 0.0345434f, 0.0319472f, 0.0298482f, 0.0396796f,
+    0.0401426f, 0.0382094f, 0.0387046f, 0.0355399f, 0.0424345f,
+    0.0490555f, 0.0374951f, 0.029996f, 0.0376316f, 0.0341003f,
+    0.0315413f, 0.0294641f, 0.0391804f, 0.0396089f, 0.0375264f,
+    0.038001f, 0.0348957f, 0.0418565f, 0.048397f, 0.0370044f,
+    0.0296035f, 0.0375685f, 0.034052f, 0.0314977f, 0.0294217f,
+    0.0391273f, 0.0395488f, 0.0374223f, 0.0378917f, 0.0347965f,
+    0.0417905f, 0.0483223f, 0.0369501f, 0.0295601f, 0.0375617f,
+    0.0340462f, 0.0314925f, 0.0294164f, 0.039121f, 0.0395411f,
+    0.0374014f, 0.0378697f, 0.0347767f, 0.0417819f, 0.0483127f,
+    0.0369434f, 0.0295547f, 0.0122454f, 0.0114082f, 0.0116034f,
+    0.0121241f, 0.014291f, 0.0126257f, 0.0113775f, 0.0145701f,
+    0.0133414f, 0.0144927f, 0.0164805f, 0.0125622f, 0.0100498f,
+    0.00797315f, 0.00733002f, 0.0089446f, 0.00843898f, 0.0089017f,
+    0.00811781f, 0.00807599f, 0.00975952f, 0.00895046f, 0.00939795f,
+    0.0106111f, 0.00802785f, 0.00642228f, 0.00757993f, 0.00592245f,
+    0.00656244f, 0.00588248f, 0.00538863f, 0.00518822f, 0.00523434f,
+    0.00708232f, 0.00644341f, 0.00557722f, 0.00616526f, 0.00525577f,
+    0.00447602f, 0.00630467f, 0.00499098f, 0.00427792f, 0.00432545f,
+    0.0046865f, 0.00428745f, 0.0044017f, 0.00582323f, 0.00532825f,
+    0.00469112f, 0.00522009f, 0.00397729f, 0.00318183f, 0.00469978f,
+    0.0032896f, 0.00250417f, 0.00266473f, 0.00295247f, 0.00270134f,
+    0.0027639f, 0.00341543f, 0.00314915f, 0.00285657f, 0.00377268f,
+    0.00282951f, 0.00226361f, 0.00338056f, 0.00252727f, 0.00183209f,
+    0.0020386f, 0.00216692f, 0.00189508f, 0.00164071f, 0.00187124f,
+    0.00173508f, 0.00185981f, 0.00261457f, 0.00196093f, 0.00156874f,
+    0.00103514f, 0.00108169f, 0.00070864f, 0.000908332f, 0.00105201f,
+    0.000867449f, 0.000729662f, 0.000752904f, 0.000670385f, 0.000793476f,
+    0.000932391f, 0.000699293f, 0.000559434f, 0.0160925f, 0.0149922f,
+    0.0152487f, 0.015933f, 0.0187807f, 0.0165921f, 0.0149518f,
+    0.0191475f, 0.0175327f, 0.0190458f, 0.021658f, 0.0165087f,
+    0.013207f, 0.0117992f, 0.010914f, 0.0125899f, 0.0122479f,
+    0.0133914f, 0.0120843f, 0.0116139f, 0.0143369f, 0.0131418f,
+    0.013951f, 0.0157887f, 0.0119744f, 0.00957951f, 0.00961989f,
+    0.00813581f, 0.0102078f, 0.00911555f, 0.00948156f, 0.00875243f,
+    0.00877229f, 0.0105041f, 0.0096326f, 0.0100543f, 0.0113428f,
+    0.00857387f, 0.0068591f, 0.00834463f, 0.00656729f, 0.00703062f,
+    0.00564111f, 0.00608247f, 0.00556444f, 0.00571457f, 0.00777829f,
+    0.00709666f, 0.00619931f, 0.00687299f, 0.00538925f, 0.00452241f,
+    0.00597297f, 0.00456309f, 0.00504267f, 0.00407455f, 0.00462106f,
+    0.00414504f, 0.00407678f, 0.0053705f, 0.00491756f, 0.00474073f,
+    0.00537924f, 0.00409168f, 0.00327335f, 0.00465374f, 0.00360196f,
+    0.00431412f, 0.00385111f, 0.00450299f, 0.0039929f, 0.00359705f,
+    0.00462099f, 0.00423074f, 0.00457609f, 0.00520162f, 0.00396351f,
+    0.00317081f, 0.00384703f, 0.00358402f, 0.00373418f, 0.00380907f,
+    0.00448967f, 0.00396658f, 0.00357436f, 0.00457761f, 0.00419157f,
+    0.00455307f, 0.00517754f, 0.00394656f, 0.00315725f, 0.0199395f,
+    0.0185762f, 0.018894f, 0.0197419f, 0.0232704f, 0.0205586f,
+    0.0185262f, 0.0237248f, 0.0217241f, 0.0235988f, 0.0268355f,
+    0.0204553f, 0.0163642f, 0.0156252f, 0.014498f, 0.0162352f,
+    0.0160568f, 0.017881f, 0.0160507f, 0.0151519f, 0.0189142f,
+    0.0173331f, 0.018504f, 0.0209662f, 0.0159209f, 0.0127367f,
+    0.0124137f, 0.0114269f, 0.0138531f, 0.0129244f, 0.0139712f,
+    0.0126663f, 0.0123102f, 0.0150815f, 0.0138239f, 0.0146073f,
+    0.0165203f, 0.0125204f, 0.0100163f, 0.0103846f, 0.00839233f,
+    0.0106759f, 0.00933572f, 0.0102484f, 0.00927143f, 0.00887748f,
+    0.010968f, 0.0100477f, 0.0106431f, 0.0120505f, 0.00914433f,
+    0.00731546f, 0.00787947f, 0.00731234f, 0.00868799f, 0.00788345f,
+    0.00911073f, 0.00811151f, 0.00738206f, 0.00942369f, 0.0086283f,
+    0.00929377f, 0.0105567f, 0.00803821f, 0.00643057f, 0.00770366f,
+    0.00718595f, 0.00795944f, 0.00766001f, 0.00899265f, 0.00795936f,
+    0.00716912f, 0.00919833f, 0.00842207f, 0.00912912f, 0.0103791f,
+    0.00791005f, 0.00632804f, 0.00769405f, 0.00716802f, 0.0073795f,
+    0.00761797f, 0.00897934f, 0.00793305f, 0.0071487f, 0.00915495f,
+    0.0083829f, 0.0091061f, 0.010355f, 0.00789309f, 0.00631447f,
+    0.0237865f, 0.0221602f, 0.0225393f, 0.0235508f, 0.02776f,
+    0.0245251f, 0.0221005f, 0.0283021f, 0.0259154f, 0.0281518f,
+    0.032013f, 0.0244018f, 0.0195214f, 0.0194513f, 0.018082f,
+    0.0198805f, 0.0198657f, 0.0223707f, 0.0200172f, 0.0186898f,
+    0.0234915f, 0.0215244f, 0.023057f, 0.0261437f, 0.0198674f,
+    0.015894f, 0.0162397f, 0.0150109f, 0.0174984f, 0.0167333f,
+    0.0184609f, 0.0166327f, 0.0158482f, 0.0196588f, 0.0180153f,
+    0.0191603f, 0.0216978f, 0.0164669f, 0.0131736f, 0.0129226f,
+    0.0119316f, 0.0143213f, 0.0131446f, 0.0147381f, 0.0132379f,
+    0.0124154f, 0.0155453f, 0.0142391f, 0.0151962f, 0.017228f,
+    0.0130909f, 0.0104727f, 0.0117055f, 0.0108963f, 0.0123333f,
+    0.0116923f, 0.0136004f, 0.012078f, 0.01092f, 0.014001f,
+    0.0128196f, 0.0138468f, 0.0157343f, 0.0119848f, 0.00958779f,
+    0.0115507f, 0.0107699f, 0.0116048f, 0.0114689f, 0.0134823f,
+    0.0119258f, 0.0107412f, 0.0137757f, 0.0126134f, 0.0136821f,
+    0.0155566f, 0.0118566f, 0.00948525f, 0.0115411f, 0.010752f,
+    0.0110248f, 0.0114269f, 0.013469f, 0.0118995f, 0.010723f,
+    0.0137323f, 0.0125742f, 0.0136591f, 0.0155326f, 0.0118396f,
+    0.00947168f, 0.0314806f, 0.0293282f, 0.02983f, 0.0311686f,
+    0.0367394f, 0.032458f, 0.0292492f, 0.0374568f, 0.0342981f,
+    0.0372579f, 0.0423681f, 0.0322948f, 0.0258359f, 0.0271034f,
+    0.02525f, 0.0271712f, 0.0274835f, 0.03135f, 0.0279501f,
+    0.0257657f, 0.0326462f, 0.0299071f, 0.0321631f, 0.0364987f,
+    0.0277605f, 0.0222084f, 0.0238918f, 0.0221789f, 0.024789f,
+    0.0243511f, 0.0274402f, 0.0245657f, 0.0229241f, 0.0288135f,
+    0.0263979f, 0.0282664f, 0.0320528f, 0.02436f, 0.019488f,
+    0.0205747f, 0.0190996f, 0.0216119f, 0.0207624f, 0.0237174f,
+    0.0211708f, 0.0194913f, 0.0247f, 0.0226217f, 0.0243022f,
+    0.027583f, 0.0209839f, 0.0167871f, 0.0193576f, 0.0180643f,
+    0.0196239f, 0.0193101f, 0.0225797f, 0.0200109f, 0.0180242f,
+    0.0231557f, 0.0212023f, 0.0229528f, 0.0260893f, 0.0198778f,
+    0.0159022f, 0.0192447f, 0.0179379f, 0.0188954f, 0.0190867f,
+    0.0224616f, 0.0198588f, 0.0178853f, 0.0229303f, 0.0209961f,
+    0.0227882f, 0.0259116f, 0.0197496f, 0.0157997f, 0.0192351f,
+    0.01792f, 0.0183154f, 0.0190447f, 0.0224483f, 0.0198324f,
+    0.0178717f, 0.022887f, 0.0209569f, 0.0227652f, 0.0258876f,
+    0.0197327f, 0.0157861f, 0.0891859f, 0.0830881f, 0.0845097f,
+    0.088302f, 0.104084f, 0.091955f, 0.0828643f, 0.106117f,
+    0.097168f, 0.105553f, 0.120031f, 0.0914928f, 0.0731943f,
+    0.0845622f, 0.0790099f, 0.0818509f, 0.0846169f, 0.098695f,
+    0.0874471f, 0.0788349f, 0.101306f, 0.0927771f, 0.100458f,
+    0.114161f, 0.0869584f, 0.0695667f, 0.0812825f, 0.0759388f,
+    0.0794688f, 0.0814846f, 0.0947852f, 0.0840627f, 0.0759933f,
+    0.0974736f, 0.0892678f, 0.0965619f, 0.109715f, 0.0835579f,
+    0.0668464f, 0.0780087f, 0.0728595f, 0.0762916f, 0.0778959f,
+    0.0910624f, 0.0806678f, 0.0726512f, 0.0933601f, 0.0854917f,
+    0.0925976f, 0.105246f, 0.0801819f, 0.0641455f, 0.0770455f,
+    0.0718242f, 0.0743037f, 0.0764436f, 0.0899247f, 0.0795079f,
+    0.0716083f, 0.0918158f, 0.0840723f, 0.0912483f, 0.103752f,
+    0.0790758f, 0.0632606f, 0.0769501f, 0.0716979f, 0.0735751f,
+    0.0762202f, 0.0898066f, 0.0793558f, 0.0714999f, 0.0915905f,
+    0.083866f, 0.0910836f, 0.103574f, 0.0789476f, 0.063158f,
+    0.0769404f, 0.0716799f, 0.0729952f, 0.0761781f, 0.0897934f,
+    0.0793295f, 0.0714869f, 0.0915471f, 0.0838269f, 0.0910606f,
+    0.10355f, 0.0789307f, 0.0631445f, 0.0225316f, 0.0210204f,
+    0.0210159f, 0.0243865f, 0.0223451f, 0.0216272f, 0.0203305f,
+    0.0278122f, 0.0254284f, 0.0247644f, 0.027532f, 0.0210818f,
+    0.0168654f, 0.014459f, 0.014058f, 0.0156198f, 0.0164883f,
+    0.0144006f, 0.0140406f, 0.0134816f, 0.0182235f, 0.0167335f,
+    0.0164119f, 0.0182157f, 0.0139073f, 0.0111259f, 0.0148695f,
+    0.0140329f, 0.0118819f, 0.0112422f, 0.0109655f, 0.0110276f,
+    0.011245f, 0.0154339f, 0.0140245f, 0.0118671f, 0.0109686f,
+    0.00917346f, 0.00797936f, 0.0125465f, 0.0112328f, 0.00956583f,
+    0.00803013f, 0.00866198f, 0.00861158f, 0.00872451f, 0.0109603f,
+    0.0100839f, 0.00873306f, 0.00897495f, 0.00673121f, 0.00538497f,
+    0.00749803f, 0.0063424f, 0.00542941f, 0.00441091f, 0.00477966f,
+    0.00469771f, 0.00476588f, 0.00543555f, 0.00510218f, 0.00461825f,
+    0.00568923f, 0.00426692f, 0.00341354f, 0.00520963f, 0.00413512f,
+    0.00357747f, 0.00305592f, 0.003006f, 0.00290873f, 0.00286211f,
+    0.00285397f, 0.00280343f, 0.00263844f, 0.0036331f, 0.00272483f,
+    0.00217986f, 0.00352193f, 0.00225782f, 0.00177139f, 0.00137257f,
+    0.00137219f, 0.00130634f, 0.00122186f, 0.00124283f, 0.00118116f,
+    0.00107373f, 0.0011581f, 0.000868577f, 0.000694861f, 0.0296102f,
+    0.0276242f, 0.0276183f, 0.0320477f, 0.029365f, 0.0284216f,
+    0.0267175f, 0.0365496f, 0.033417f, 0.0325444f, 0.0361814f,
+    0.0277049f, 0.0221638f, 0.0214131f, 0.0204659f, 0.0222221f,
+    0.0235191f, 0.0214205f, 0.0202615f, 0.019861f, 0.026961f,
+    0.0247221f, 0.0241919f, 0.0268651f, 0.0205304f, 0.0164243f,
+    0.0188334f, 0.0180104f, 0.0175494f, 0.0180763f, 0.015374f,
+    0.0154661f, 0.0145618f, 0.0205187f, 0.0185956f, 0.0176244f,
+    0.019545f, 0.0149089f, 0.0119271f, 0.0165103f, 0.0152102f,
+    0.0129075f, 0.0110407f, 0.0118071f, 0.0118238f, 0.0120413f,
+    0.0160451f, 0.0146549f, 0.0125313f, 0.0121797f, 0.00941284f,
+    0.00817674f, 0.0114619f, 0.0103198f, 0.00877113f, 0.00800399f,
+    0.00792481f, 0.00790989f, 0.0080827f, 0.0105204f, 0.00967325f,
+    0.00841646f, 0.00906986f, 0.00693103f, 0.00572937f, 0.0080354f,
+    0.00733841f, 0.00730172f, 0.00770784f, 0.00704832f, 0.00681172f,
+    0.00643526f, 0.00880601f, 0.00805511f, 0.00783285f, 0.00870504f,
+    0.00666235f, 0.00532988f, 0.00707859f, 0.00660398f, 0.00666883f,
+    0.00766138f, 0.00701995f, 0.00679439f, 0.00638706f, 0.00873784f,
+    0.00798897f, 0.00778009f, 0.00864954f, 0.00662311f, 0.00529849f,
+    0.0366887f, 0.0342279f, 0.0342206f, 0.039709f, 0.036385f,
+    0.035216f, 0.0331046f, 0.045287f, 0.0414056f, 0.0403244f,
+    0.0448308f, 0.0343279f, 0.0274623f, 0.0284916f, 0.0270697f,
+    0.0288245f, 0.0311804f, 0.0284404f, 0.0269915f, 0.0262403f,
+    0.0356984f, 0.0327107f, 0.0319718f, 0.0355146f, 0.0271535f,
+    0.0217228f, 0.0227972f, 0.0219878f, 0.0241518f, 0.0249104f,
+    0.0223939f, 0.021687f, 0.020875f, 0.0283036f, 0.0259664f,
+    0.0254044f, 0.0281945f, 0.0215319f, 0.0172256f, 0.0204741f,
+    0.0191876f, 0.0182365f, 0.0179746f, 0.0163099f, 0.0160429f,
+    0.0153582f, 0.0211299f, 0.019226f, 0.018469f, 0.0204899f,
+    0.0156455f, 0.0125164f, 0.0154257f, 0.0142972f, 0.0149223f,
+    0.0156652f, 0.014298f, 0.0137728f, 0.0131124f, 0.0179192f,
+    0.0163989f, 0.0159509f, 0.0177193f, 0.0135541f, 0.0108433f,
+    0.0141895f, 0.0132566f, 0.0139041f, 0.0153691f, 0.0140682f,
+    0.0136061f, 0.0128146f, 0.0175435f, 0.0160437f, 0.0156128f,
+    0.0173545f, 0.0132854f, 0.0106283f, 0.0141571f, 0.0132077f,
+    0.0132712f, 0.0153226f, 0.0140399f, 0.0135888f, 0.0127741f,
+    0.0174753f, 0.0159775f, 0.0155601f, 0.017299f, 0.0132462f,
+    0.0105969f, 0.0437672f, 0.0408317f, 0.0408229f, 0.0473702f,
+    0.0434049f, 0.0420104f, 0.0394916f, 0.0540245f, 0.0493942f,
+    0.0481043f, 0.0534802f, 0.0409509f, 0.0327607f, 0.0355701f,
+    0.0336734f, 0.0354268f, 0.0388416f, 0.0354603f, 0.0337859f,
+    0.0326197f, 0.0444359f, 0.0406993f, 0.0397518f, 0.044164f,
+    0.0337765f, 0.0270212f, 0.0294696f, 0.0280836f, 0.0307541f,
+    0.0323098f, 0.0294138f, 0.0279079f, 0.0272543f, 0.037041f,
+    0.033955f, 0.0331843f, 0.0368439f, 0.028155f, 0.022524f,
+    0.024438f, 0.023165f, 0.0248388f, 0.0256358f, 0.0233298f,
+    0.0222638f, 0.02158f, 0.0293882f, 0.0269255f, 0.026249f,
+    0.0291393f, 0.0222685f, 0.0178148f, 0.021498f, 0.0201441f,
+    0.0215246f, 0.0233265f, 0.0213179f, 0.0205672f, 0.0194917f,
+    0.0266567f, 0.0243875f, 0.0237308f, 0.0263687f, 0.0201771f,
+    0.0161417f, 0.021268f, 0.0198603f, 0.0205064f, 0.0230303f,
+    0.0210882f, 0.0204005f, 0.0191939f, 0.0262809f, 0.0240323f,
+    0.0233928f, 0.0260039f, 0.0199084f, 0.0159267f, 0.0212356f,
+    0.0198115f, 0.0198735f, 0.0229839f, 0.0210598f, 0.0203832f,
+    0.0191611f, 0.0262127f, 0.0239661f, 0.02334f, 0.0259484f,
+    0.0198692f, 0.0158954f, 0.0579243f, 0.0540392f, 0.0540276f,
+    0.0626927f, 0.0574447f, 0.0555991f, 0.0522656f, 0.0714994f,
+    0.0653713f, 0.0636643f, 0.0707791f, 0.054197f, 0.0433576f,
+    0.0497271f, 0.0468809f, 0.0486315f, 0.0541641f, 0.0495002f,
+    0.0473747f, 0.0453784f, 0.0619108f, 0.0566764f, 0.0553118f,
+    0.0614629f, 0.0470226f, 0.037618f, 0.0436266f, 0.0412911f,
+    0.0439588f, 0.0476323f, 0.0434537f, 0.0414382f, 0.040013f,
+    0.0545159f, 0.0499322f, 0.0487443f, 0.0541427f, 0.0414011f,
+    0.0331209f, 0.0376147f, 0.0354472f, 0.0380435f, 0.0409583f,
+    0.0373697f, 0.0358344f, 0.0343387f, 0.0468631f, 0.0429026f,
+    0.041809f, 0.0464381f, 0.0355146f, 0.0284117f, 0.0356551f,
+    0.0333517f, 0.0347293f, 0.038649f, 0.0353578f, 0.034156f,
+    0.0322504f, 0.0441316f, 0.0403646f, 0.0392908f, 0.0436676f,
+    0.0334232f, 0.0267385f, 0.035425f, 0.0330679f, 0.0337111f,
+    0.0383528f, 0.035128f, 0.0339893f, 0.0319607f, 0.0437558f,
+    0.0400094f, 0.0389527f, 0.0433028f, 0.0331545f, 0.0265236f,
+    0.0353927f, 0.033019f, 0.0330782f, 0.0383063f, 0.0350996f,
+    0.0339719f, 0.0319351f, 0.0436876f, 0.0399433f, 0.0389f,
+    0.0432473f, 0.0331153f, 0.0264922f, 0.164102f, 0.153096f,
+    0.153063f, 0.177611f, 0.162744f, 0.157515f, 0.148071f,
+    0.202561f, 0.1852f, 0.180364f, 0.20052f, 0.153543f,
+    0.122834f, 0.155905f, 0.145937f, 0.147667f, 0.169083f,
+    0.154799f, 0.14929f, 0.141069f, 0.192972f, 0.176505f,
+    0.172011f, 0.191204f, 0.146368f, 0.117095f, 0.149804f,
+    0.140347f, 0.142994f, 0.162551f, 0.148753f, 0.143354f,
+    0.135703f, 0.185578f, 0.169761f, 0.165444f, 0.183884f,
+    0.140747f, 0.112597f, 0.143793f, 0.134504f, 0.137079f,
+    0.155877f, 0.142669f, 0.13775f, 0.130029f, 0.177925f,
+    0.162731f, 0.158509f, 0.17618f, 0.13486f, 0.107888f,
+    0.141833f, 0.132408f, 0.133764f, 0.153568f, 0.140657f,
+    0.136072f, 0.127964f, 0.175193f, 0.160193f, 0.15599f,
+    0.173409f, 0.132769f, 0.106215f, 0.141603f, 0.132124f,
+    0.132746f, 0.153271f, 0.140427f, 0.135905f, 0.127766f,
+    0.174818f, 0.159838f, 0.155652f, 0.173044f, 0.1325f,
+    0.106f, 0.141571f, 0.132075f, 0.132113f, 0.153225f,
+    0.140398f, 0.135888f, 0.12774f, 0.174749f, 0.159772f,
+    0.1556f, 0.172989f, 0.132461f, 0.105969f, 0.0354878f,
+    0.0351206f, 0.0335427f, 0.0357154f, 0.0333534f, 0.0330388f,
+    0.0323934f, 0.0409584f, 0.0376083f, 0.0348116f, 0.0359076f,
+    0.0272503f, 0.0218002f, 0.0241645f, 0.022757f, 0.021691f,
+    0.0245381f, 0.0216912f, 0.0214385f, 0.0210174f, 0.0291829f,
+    0.0261573f, 0.022997f, 0.024236f, 0.0184157f, 0.0155759f,
+    0.0216616f, 0.0189116f, 0.0201192f, 0.0200436f, 0.0194945f,
+    0.0197002f, 0.0188549f, 0.0252386f, 0.0227644f, 0.0192501f,
+    0.0174067f, 0.0133369f, 0.0119165f, 0.0155497f, 0.013338f,
+    0.0138735f, 0.0142167f, 0.013787f, 0.0137996f, 0.0131687f,
+    0.0159741f, 0.0146217f, 0.0127675f, 0.0128265f, 0.0096199f,
+    0.00769593f, 0.00738163f, 0.00623422f, 0.00623788f, 0.00678106f,
+    0.00662586f, 0.00660444f, 0.00631605f, 0.00708971f, 0.00665258f,
+    0.00618064f, 0.00740009f, 0.00555007f, 0.00444006f, 0.00326196f,
+    0.00356955f, 0.00436862f, 0.00428977f, 0.00452326f, 0.00382191f,
+    0.00382235f, 0.00377964f, 0.00360246f, 0.0036407f, 0.00450381f,
+    0.00337786f, 0.00270228f, 0.000915756f, 0.00128115f, 0.00235319f,
+    0.00198683f, 0.00221523f, 0.00179434f, 0.00167686f, 0.00156857f,
+    0.00148958f, 0.00137432f, 0.00136282f, 0.00102212f, 0.000817693f,
+    0.0466366f, 0.0461541f, 0.0440804f, 0.0469358f, 0.0438317f,
+    0.0434182f, 0.04257f, 0.0538259f, 0.0494234f, 0.045748f,
+    0.0471883f, 0.0358112f, 0.028649f, 0.0350659f, 0.0337904f,
+    0.0321041f, 0.0357585f, 0.0321695f, 0.0317992f, 0.0311423f,
+    0.039665f, 0.0365363f, 0.0337981f, 0.0355167f, 0.0269185f,
+    0.0215567f, 0.0284681f, 0.0249939f, 0.0267187f, 0.0264935f,
+    0.0258323f, 0.0262083f, 0.0251352f, 0.0349433f, 0.031416f,
+    0.0263969f, 0.0261074f, 0.0199988f, 0.0178974f, 0.0223562f,
+    0.0194203f, 0.020473f, 0.0206666f, 0.0201248f, 0.0203077f,
+    0.0194491f, 0.0256789f, 0.0232733f, 0.0199144f, 0.0187218f,
+    0.0140414f, 0.0122612f, 0.0141881f, 0.0123165f, 0.0128374f,
+    0.013231f, 0.0129637f, 0.0131126f, 0.0125964f, 0.0167945f,
+    0.0153042f, 0.0133275f, 0.0132954f, 0.00997152f, 0.00836498f,
+    0.0112131f, 0.0111199f, 0.0105814f, 0.011307f, 0.0105563f,
+    0.0104342f, 0.0102228f, 0.0129646f, 0.01191f, 0.0109914f,
+    0.011379f, 0.00862852f, 0.00698609f, 0.011149f, 0.011034f,
+    0.0105378f, 0.0112205f, 0.0104787f, 0.0103795f, 0.0101768f,
+    0.012868f, 0.0118155f, 0.0109365f, 0.011281f, 0.00856107f,
+    0.00684886f, 0.0577855f, 0.0571875f, 0.0546182f, 0.0581561f,
+    0.05431f, 0.0537977f, 0.0527467f, 0.0666934f, 0.0612384f,
+    0.0566844f, 0.058469f, 0.0443722f, 0.0354977f, 0.0459673f,
+    0.0448239f, 0.0425792f, 0.0469788f, 0.0426478f, 0.0421599f,
+    0.0412672f, 0.0525325f, 0.0483513f, 0.0445993f, 0.0467974f,
+    0.0354794f, 0.0283835f, 0.0369229f, 0.0354586f, 0.0336806f,
+    0.0376227f, 0.0337519f, 0.0333548f, 0.0326766f, 0.0446481f,
+    0.0400675f, 0.0355644f, 0.037388f, 0.0283719f, 0.0238782f,
+    0.0291627f, 0.0259442f, 0.0270725f, 0.0271372f, 0.0264627f,
+    0.0268159f, 0.0257295f, 0.0353837f, 0.0319249f, 0.0270613f,
+    0.0271394f, 0.0206544f, 0.018242f, 0.0227773f, 0.0226112f,
+    0.0214608f, 0.0230897f, 0.0214675f, 0.0212155f, 0.0207429f,
+    0.0264992f, 0.0242427f, 0.0223315f, 0.0232261f, 0.0176041f,
+    0.0143458f, 0.0223619f, 0.0221533f, 0.0211192f, 0.0225273f,
+    0.0210346f, 0.0207961f, 0.0203995f, 0.025832f, 0.023725f,
+    0.0219278f, 0.0226597f, 0.0171895f, 0.0137516f, 0.0222978f,
+    0.0220674f, 0.0210756f, 0.0224408f, 0.020957f, 0.0207589f,
+    0.0203534f, 0.0257354f, 0.0236305f, 0.0218729f, 0.0225617f,
+    0.017122f, 0.0136976f, 0.0689343f, 0.0682209f, 0.0651559f,
+    0.0693764f, 0.0647883f, 0.0641771f, 0.0629234f, 0.0795608f,
+    0.0730533f, 0.0676208f, 0.0697498f, 0.0529331f, 0.0423464f,
+    0.0568687f, 0.0558574f, 0.0530544f, 0.0581992f, 0.053126f,
+    0.0525206f, 0.0513921f, 0.0654f, 0.0601663f, 0.0555237f,
+    0.0580781f, 0.0440404f, 0.0352323f, 0.0478242f, 0.0464921f,
+    0.0441557f, 0.0488431f, 0.0442302f, 0.0437155f, 0.0428015f,
+    0.0544955f, 0.0501808f, 0.0463656f, 0.0486688f, 0.0368805f,
+    0.0298591f, 0.0374544f, 0.0369777f, 0.0351013f, 0.0383576f,
+    0.0351383f, 0.0347217f, 0.0339791f, 0.0450885f, 0.0405764f,
+    0.0366737f, 0.0384201f, 0.0291057f, 0.0242229f, 0.0339261f,
+    0.0336447f, 0.0319878f, 0.03431f, 0.0319458f, 0.0315762f,
+    0.0309163f, 0.0392431f, 0.0360577f, 0.0332679f, 0.0345068f,
+    0.026165f, 0.020932f, 0.0335108f, 0.0331868f, 0.0316569f,
+    0.0337476f, 0.0315129f, 0.0311756f, 0.0305762f, 0.0386995f,
+    0.03554f, 0.0328642f, 0.0339404f, 0.0257504f, 0.0206003f,
+    0.0334466f, 0.0331009f, 0.0316133f, 0.0336612f, 0.0314352f,
+    0.0311384f, 0.0305301f, 0.0386029f, 0.0354455f, 0.0328093f,
+    0.0338424f, 0.025683f, 0.0205464f, 0.0912319f, 0.0902878f,
+    0.0862314f, 0.0918171f, 0.0857449f, 0.084936f, 0.0832767f,
+    0.105296f, 0.0966833f, 0.0894937f, 0.0923111f, 0.070055f,
+    0.056044f, 0.0786714f, 0.0779243f, 0.0740047f, 0.0806398f,
+    0.0740826f, 0.0732419f, 0.0716419f, 0.0911349f, 0.0837964f,
+    0.0773965f, 0.0806396f, 0.0611622f, 0.0489298f, 0.0696269f,
+    0.068559f, 0.065106f, 0.0712837f, 0.0651868f, 0.0644368f,
+    0.0630513f, 0.0802305f, 0.0738107f, 0.0680517f, 0.0712302f,
+    0.0540023f, 0.0432019f, 0.0595109f, 0.0590446f, 0.0560516f,
+    0.0607982f, 0.0560949f, 0.0554431f, 0.0542289f, 0.0689738f,
+    0.0634222f, 0.0584463f, 0.0609815f, 0.0462276f, 0.0369821f,
+    0.0562238f, 0.0557116f, 0.0530633f, 0.0567507f, 0.0529023f,
+    0.0522976f, 0.0512697f, 0.064978f, 0.0596877f, 0.0551407f,
+    0.0570682f, 0.0432869f, 0.0346295f, 0.0558084f, 0.0552537f,
+    0.0527324f, 0.0561883f, 0.0524695f, 0.0519345f, 0.0509296f,
+    0.0644344f, 0.05917f, 0.0547369f, 0.0565019f, 0.0428723f,
+    0.0342978f, 0.0557443f, 0.0551678f, 0.0526888f, 0.0561018f,
+    0.0523918f, 0.0518973f, 0.0508835f, 0.0643378f, 0.0590756f,
+    0.0546821f, 0.0564038f, 0.0428048f, 0.0342438f, 0.258464f,
+    0.25579f, 0.244298f, 0.260122f, 0.242919f, 0.240628f,
+    0.235927f, 0.298308f, 0.273908f, 0.25354f, 0.261522f,
+    0.198469f, 0.158775f, 0.245898f, 0.243426f, 0.23205f,
+    0.248945f, 0.231257f, 0.228652f, 0.224288f, 0.284147f,
+    0.261021f, 0.241442f, 0.24985f, 0.189576f, 0.151661f,
+    0.236373f, 0.234061f, 0.222954f, 0.239589f, 0.222361f,
+    0.219847f, 0.215535f, 0.273243f, 0.251036f, 0.232098f,
+    0.240441f, 0.182416f, 0.145933f, 0.226743f, 0.224546f,
+    0.214019f, 0.229103f, 0.213269f, 0.210853f, 0.206807f,
+    0.261986f, 0.240647f, 0.222492f, 0.230192f, 0.174642f,
+    0.139713f, 0.223456f, 0.221213f, 0.211129f, 0.225056f,
+    0.210077f, 0.20793f, 0.20392f, 0.25799f, 0.236913f,
+    0.219187f, 0.226279f, 0.171701f, 0.137361f, 0.223041f,
+    0.220756f, 0.210799f, 0.224493f, 0.209644f, 0.207626f,
+    0.20358f, 0.257446f, 0.236395f, 0.218783f, 0.225713f,
+    0.171286f, 0.137029f, 0.222977f, 0.22067f, 0.210755f,
+    0.224407f, 0.209566f, 0.207589f, 0.203534f, 0.25735f,
+    0.236301f, 0.218728f, 0.225614f, 0.171219f, 0.136975f,
+    0.0553432f, 0.055616f, 0.054138f, 0.0526647f, 0.0522919f,
+    0.0520138f, 0.0504821f, 0.0540892f, 0.0498452f, 0.0454708f,
+    0.0430918f, 0.0327643f, 0.027354f, 0.0353921f, 0.0376073f,
+    0.0388564f, 0.0370685f, 0.0368849f, 0.0359238f, 0.0360234f,
+    0.0469303f, 0.0422709f, 0.0352005f, 0.0305366f, 0.023277f,
+    0.0223669f, 0.0306588f, 0.0327945f, 0.0339295f, 0.0321748f,
+    0.0320576f, 0.0311616f, 0.0310808f, 0.0377308f, 0.0343158f,
+    0.0290392f, 0.0263636f, 0.0197727f, 0.0171268f, 0.0186626f,
+    0.0201435f, 0.0209505f, 0.019718f, 0.0198656f, 0.0194416f,
+    0.0193746f, 0.0213727f, 0.019899f, 0.0175765f, 0.017603f,
+    0.0132023f, 0.0105618f, 0.0102626f, 0.00778178f, 0.00820473f,
+    0.00770033f, 0.00802962f, 0.00813378f, 0.00823692f, 0.00861473f,
+    0.00834119f, 0.00802643f, 0.00939381f, 0.00704535f, 0.00563628f,
+    0.00763869f, 0.00481219f, 0.00585984f, 0.00560458f, 0.00536128f,
+    0.00518555f, 0.00512918f, 0.00505631f, 0.00520943f, 0.00490304f,
+    0.00552392f, 0.00414294f, 0.00331435f, 0.00327224f, 0.00191682f,
+    0.0031839f, 0.00282161f, 0.00262565f, 0.00232878f, 0.00216106f,
+    0.00208975f, 0.00201393f, 0.00176213f, 0.00162224f, 0.00121668f,
+    0.000973346f, 0.0727298f, 0.0730882f, 0.0711459f, 0.0692098f,
+    0.0687199f, 0.0683544f, 0.0663415f, 0.0710819f, 0.0655047f,
+    0.0597559f, 0.0566295f, 0.0430574f, 0.0359475f, 0.052217f,
+    0.0528101f, 0.0514541f, 0.050042f, 0.0498888f, 0.0497874f,
+    0.0484127f, 0.0639229f, 0.0574542f, 0.0476869f, 0.0427023f,
+    0.0335702f, 0.0309604f, 0.0422233f, 0.0449928f, 0.0465273f,
+    0.0442854f, 0.0441285f, 0.0429837f, 0.0430438f, 0.0547235f,
+    0.049499f, 0.0415255f, 0.0367481f, 0.0275611f, 0.0257203f,
+    0.0302271f, 0.0323418f, 0.0335483f, 0.0318285f, 0.0319365f,
+    0.0312637f, 0.0313377f, 0.0383654f, 0.0350823f, 0.0300628f,
+    0.0279876f, 0.0209907f, 0.017672f, 0.0188113f, 0.0199801f,
+    0.0208025f, 0.0198109f, 0.0201006f, 0.0199559f, 0.0201999f,
+    0.0256073f, 0.0235245f, 0.0205128f, 0.0197784f, 0.0148338f,
+    0.0120968f, 0.0174688f, 0.0175429f, 0.0170635f, 0.0166121f,
+    0.0165015f, 0.0164173f, 0.0159343f, 0.0207704f, 0.0189727f,
+    0.016517f, 0.0159085f, 0.0119314f, 0.0101045f, 0.0173868f,
+    0.0174724f, 0.017008f, 0.0165452f, 0.0164281f, 0.0163407f,
+    0.0158595f, 0.0174282f, 0.01566f, 0.0142855f, 0.013538f,
+    0.0102998f, 0.00875558f, 0.0901164f, 0.0905605f, 0.0881539f,
+    0.0857549f, 0.0851478f, 0.0846951f, 0.082201f, 0.0880745f,
+    0.081164f, 0.074041f, 0.0701671f, 0.0533507f, 0.0445411f,
+    0.0696036f, 0.0702824f, 0.0678395f, 0.0665871f, 0.0663168f,
+    0.066128f, 0.0642722f, 0.0809156f, 0.0726375f, 0.0601732f,
+    0.05624f, 0.0438634f, 0.0395539f, 0.0546024f, 0.0571911f,
+    0.059125f, 0.0563959f, 0.0561995f, 0.0548058f, 0.0550068f,
+    0.0717161f, 0.0646823f, 0.0540119f, 0.0471327f, 0.0357858f,
+    0.0343138f, 0.0417917f, 0.0445401f, 0.0461461f, 0.0439391f,
+    0.0440075f, 0.0430858f, 0.0433008f, 0.055358f, 0.0502656f,
+    0.0425492f, 0.0383721f, 0.0287791f, 0.0262655f, 0.035406f,
+    0.0355612f, 0.0345399f, 0.0336745f, 0.0334732f, 0.0333173f,
+    0.0323434f, 0.0426f, 0.0387078f, 0.0329992f, 0.0301629f,
+    0.0226222f, 0.0206903f, 0.0348554f, 0.0350152f, 0.0340714f,
+    0.0331572f, 0.0329295f, 0.0327579f, 0.0317938f, 0.0377631f,
+    0.034156f, 0.0290033f, 0.0271974f, 0.0208877f, 0.018698f,
+    0.0347734f, 0.0349447f, 0.034016f, 0.0330903f, 0.0328561f,
+    0.0326814f, 0.031719f, 0.0344208f, 0.0313194f, 0.0285706f,
+    0.0270757f, 0.020593f, 0.0173491f, 0.107503f, 0.108033f,
+    0.105162f, 0.1023f, 0.101576f, 0.101036f, 0.0980604f,
+    0.105067f, 0.0968233f, 0.0883261f, 0.0837048f, 0.0636438f,
+    0.0531345f, 0.0869902f, 0.0877547f, 0.0848474f, 0.0831322f,
+    0.0827448f, 0.0824686f, 0.0801316f, 0.0979082f, 0.0878208f,
+    0.0732684f, 0.0697775f, 0.0541566f, 0.0481475f, 0.071989f,
+    0.0726692f, 0.0717228f, 0.0688452f, 0.0686067f, 0.068435f,
+    0.0669699f, 0.0887088f, 0.0798656f, 0.0664983f, 0.05851f,
+    0.046079f, 0.0429073f, 0.0574565f, 0.0578304f, 0.0587438f,
+    0.0560496f, 0.0560785f, 0.0549079f, 0.0552638f, 0.0723506f,
+    0.0654489f, 0.0550356f, 0.0487567f, 0.0365675f, 0.034859f,
+    0.0527926f, 0.0530335f, 0.0515479f, 0.0502196f, 0.0499012f,
+    0.049658f, 0.0482028f, 0.0595926f, 0.0538911f, 0.0454856f,
+    0.0414302f, 0.0320914f, 0.0292838f, 0.0522419f, 0.0524874f,
+    0.0510794f, 0.0497023f, 0.0493575f, 0.0490986f, 0.0476532f,
+    0.0547557f, 0.0493393f, 0.0429757f, 0.040735f, 0.0311809f,
+    0.0272916f, 0.05216f, 0.0524169f, 0.0510239f, 0.0496354f,
+    0.0492841f, 0.049022f, 0.0475784f, 0.0514135f, 0.0469787f,
+    0.0428557f, 0.0406134f, 0.0308862f, 0.0259426f, 0.142276f,
+    0.142977f, 0.139178f, 0.13539f, 0.134432f, 0.133717f,
+    0.129779f, 0.139052f, 0.128142f, 0.116896f, 0.11078f,
+    0.0842302f, 0.0703216f, 0.121763f, 0.122699f, 0.118863f,
+    0.116222f, 0.115601f, 0.11515f, 0.11185f, 0.131893f,
+    0.118187f, 0.101839f, 0.096853f, 0.074743f, 0.0653345f,
+    0.106762f, 0.107614f, 0.104089f, 0.101935f, 0.101463f,
+    0.101116f, 0.0982411f, 0.122694f, 0.110232f, 0.091471f,
+    0.0855854f, 0.0666653f, 0.0600944f, 0.0922297f, 0.0927749f,
+    0.0899451f, 0.0878614f, 0.0873933f, 0.0870365f, 0.0845235f,
+    0.106336f, 0.0958154f, 0.0800083f, 0.0732534f, 0.0570793f,
+    0.0520461f, 0.0875657f, 0.087978f, 0.0855638f, 0.0833098f,
+    0.0827572f, 0.0823392f, 0.0799216f, 0.0935779f, 0.0842576f,
+    0.0722336f, 0.0685056f, 0.0526778f, 0.0464708f, 0.0870151f,
+    0.087432f, 0.0850954f, 0.0827925f, 0.0822135f, 0.0817799f,
+    0.0793721f, 0.088741f, 0.0797059f, 0.0715458f, 0.0678105f,
+    0.0517674f, 0.0444786f, 0.0869332f, 0.0873615f, 0.0850399f,
+    0.0827256f, 0.08214f, 0.0817033f, 0.0792972f, 0.0853987f,
+    0.0782975f, 0.0714259f, 0.0676887f, 0.0514726f, 0.0431296f,
+    0.403075f, 0.405061f, 0.394297f, 0.383567f, 0.380852f,
+    0.378826f, 0.367671f, 0.393942f, 0.363033f, 0.331173f,
+    0.313845f, 0.238628f, 0.199224f, 0.382562f, 0.384783f,
+    0.373983f, 0.364399f, 0.362021f, 0.360259f, 0.349742f,
+    0.386783f, 0.34619f, 0.316115f, 0.299918f, 0.229141f,
+    0.194237f, 0.367561f, 0.369698f, 0.359208f, 0.350112f,
+    0.347882f, 0.346226f, 0.336133f, 0.377584f, 0.337981f,
+    0.30415f, 0.28865f, 0.221063f, 0.188997f, 0.353028f,
+    0.354859f, 0.345065f, 0.336038f, 0.333813f, 0.332146f,
+    0.322415f, 0.361225f, 0.323564f, 0.291319f, 0.276319f,
+    0.211477f, 0.180949f, 0.348365f, 0.350062f, 0.340683f,
+    0.331486f, 0.329177f, 0.327449f, 0.317813f, 0.348467f,
+    0.314026f, 0.28651f, 0.271571f, 0.207076f, 0.175374f,
+    0.347814f, 0.349516f, 0.340215f, 0.330969f, 0.328633f,
+    0.326889f, 0.317263f, 0.34363f, 0.313316f, 0.285822f,
+    0.270875f, 0.206166f, 0.173381f, 0.347732f, 0.349446f,
+    0.340159f, 0.330902f, 0.32856f, 0.326813f, 0.317189f,
+    0.340288f, 0.313188f, 0.285702f, 0.270754f, 0.205871f,
+    0.172033f, 0.0858813f, 0.0886714f, 0.0838215f, 0.0830685f,
+    0.0810261f, 0.0785606f, 0.0750699f, 0.0817463f, 0.0728229f,
+    0.0602896f, 0.0522275f, 0.0398582f, 0.0364062f, 0.062091f,
+    0.0623123f, 0.0628409f, 0.0631004f, 0.0617757f, 0.0596928f,
+    0.0575768f, 0.0673348f, 0.0604821f, 0.0503409f, 0.0437918f,
+    0.0328439f, 0.0298335f, 0.0492129f, 0.0498761f, 0.0502874f,
+    0.0504149f, 0.049441f, 0.0478765f, 0.0461376f, 0.0518215f,
+    0.0470345f, 0.0398801f, 0.0362064f, 0.0271548f, 0.0229005f,
+    0.024972f, 0.0259516f, 0.0263005f, 0.0265171f, 0.0264107f,
+    0.0260859f, 0.0254855f, 0.0275615f, 0.0256804f, 0.0229181f,
+    0.0227918f, 0.0170938f, 0.0136751f, 0.00946037f, 0.00823913f,
+    0.0082155f, 0.00849724f, 0.00887239f, 0.00929557f, 0.00957029f,
+    0.0105845f, 0.0103175f, 0.0102143f, 0.0116784f, 0.00875879f,
+    0.00700704f, 0.0065193f, 0.00632271f, 0.00496402f, 0.0067163f,
+    0.00657635f, 0.00658922f, 0.00671178f, 0.0071686f, 0.00698078f,
+    0.00672541f, 0.0067672f, 0.0050754f, 0.00406032f, 0.00209685f,
+    0.00365107f, 0.00242805f, 0.00341354f, 0.00319278f, 0.00289069f,
+    0.00280042f, 0.00278328f, 0.00256997f, 0.00226622f, 0.00196783f,
+    0.00147587f, 0.0011807f, 0.112862f, 0.116528f, 0.110155f,
+    0.109165f, 0.106481f, 0.103241f, 0.0986538f, 0.107428f,
+    0.0957011f, 0.0792302f, 0.0686353f, 0.0523801f, 0.0478435f,
+    0.0842443f, 0.0844299f, 0.0851307f, 0.085592f, 0.0838527f,
+    0.0811001f, 0.0783543f, 0.0930162f, 0.0833601f, 0.069121f,
+    0.0594962f, 0.0446222f, 0.0412708f, 0.0713662f, 0.0719277f,
+    0.0725772f, 0.0729064f, 0.0715179f, 0.0692837f, 0.0669152f,
+    0.0775028f, 0.0699125f, 0.0586601f, 0.0519108f, 0.0389331f,
+    0.0343378f, 0.0471253f, 0.0480032f, 0.0485903f, 0.0490086f,
+    0.0484877f, 0.0474932f, 0.0462631f, 0.0532428f, 0.0485584f,
+    0.0416981f, 0.0384962f, 0.0288721f, 0.0236421f, 0.0294193f,
+    0.0300115f, 0.0305053f, 0.0309888f, 0.0309494f, 0.0307028f,
+    0.0303479f, 0.0362659f, 0.0331955f, 0.0289944f, 0.0273828f,
+    0.0205371f, 0.0164297f, 0.0271004f, 0.0279764f, 0.0264423f,
+    0.0262166f, 0.0255749f, 0.0248677f, 0.0246242f, 0.0302315f,
+    0.0274988f, 0.0239351f, 0.0224716f, 0.0168537f, 0.0135034f,
+    0.0269806f, 0.0278571f, 0.0263335f, 0.026097f, 0.0254553f,
+    0.0246808f, 0.0235841f, 0.0261982f, 0.0234425f, 0.0197269f,
+    0.0176722f, 0.0132542f, 0.0116654f, 0.139842f, 0.144385f,
+    0.136488f, 0.135262f, 0.131936f, 0.127922f, 0.122238f,
+    0.133109f, 0.118579f, 0.0981709f, 0.0850431f, 0.0649018f,
+    0.0592809f, 0.108679f, 0.112287f, 0.107421f, 0.108084f,
+    0.10593f, 0.102507f, 0.099132f, 0.118698f, 0.106238f,
+    0.087901f, 0.0752006f, 0.0564004f, 0.0527082f, 0.0935194f,
+    0.0939793f, 0.094867f, 0.095398f, 0.093595f, 0.0906909f,
+    0.087693f, 0.103184f, 0.0927905f, 0.0774402f, 0.0676152f,
+    0.0507114f, 0.0457751f, 0.0692785f, 0.0700549f, 0.0708801f,
+    0.0715002f, 0.0705647f, 0.0689005f, 0.0670407f, 0.0789242f,
+    0.0714364f, 0.0604782f, 0.0542005f, 0.0406503f, 0.0350794f,
+    0.0549604f, 0.056733f, 0.0536128f, 0.0534804f, 0.0530264f,
+    0.05211f, 0.0511256f, 0.0619472f, 0.0560735f, 0.0477745f,
+    0.0430871f, 0.0323154f, 0.0276239f, 0.0540808f, 0.0558334f,
+    0.0527756f, 0.0523133f, 0.05103f, 0.0494859f, 0.0472971f,
+    0.0559129f, 0.0503768f, 0.0427152f, 0.038176f, 0.028632f,
+    0.0249407f, 0.053961f, 0.0557141f, 0.0526668f, 0.0521937f,
+    0.0509104f, 0.0493613f, 0.047168f, 0.0518796f, 0.0463206f,
+    0.038507f, 0.0333766f, 0.0250517f, 0.0231027f, 0.166822f,
+    0.172242f, 0.162821f, 0.161359f, 0.157391f, 0.152602f,
+    0.145822f, 0.15879f, 0.141457f, 0.117111f, 0.101451f,
+    0.0774237f, 0.0707182f, 0.13566f, 0.140144f, 0.13243f,
+    0.131543f, 0.128538f, 0.124942f, 0.11991f, 0.144379f,
+    0.129116f, 0.106681f, 0.090905f, 0.0681788f, 0.0641455f,
+    0.115673f, 0.116136f, 0.117157f, 0.11789f, 0.115672f,
+    0.112098f, 0.108471f, 0.128866f, 0.115669f, 0.0962203f,
+    0.0833196f, 0.0624897f, 0.0572125f, 0.0914318f, 0.0923604f,
+    0.0931699f, 0.0939918f, 0.0926417f, 0.0903077f, 0.0878184f,
+    0.104606f, 0.0943145f, 0.0792583f, 0.0699049f, 0.0524287f,
+    0.0465167f, 0.0819408f, 0.08459f, 0.0799462f, 0.0792871f,
+    0.0773613f, 0.075057f, 0.0719032f, 0.0876285f, 0.0789515f,
+    0.0665546f, 0.0587915f, 0.0440936f, 0.0390613f, 0.0810612f,
+    0.0836903f, 0.0791089f, 0.0784101f, 0.0764851f, 0.0741665f,
+    0.070881f, 0.0815942f, 0.0732548f, 0.0614953f, 0.0538804f,
+    0.0404103f, 0.036378f, 0.0809414f, 0.083571f, 0.0790001f,
+    0.0782905f, 0.0763655f, 0.0740418f, 0.0707519f, 0.0775608f,
+    0.0691985f, 0.0572871f, 0.0492237f, 0.0375735f, 0.03454f,
+    0.220783f, 0.227956f, 0.215488f, 0.213552f, 0.208302f,
+    0.201963f, 0.192989f, 0.210153f, 0.187213f, 0.154993f,
+    0.134266f, 0.102467f, 0.0935928f, 0.189621f, 0.195858f,
+    0.185097f, 0.183737f, 0.179448f, 0.174303f, 0.166904f,
+    0.195742f, 0.174872f, 0.144241f, 0.122314f, 0.0917352f,
+    0.0870201f, 0.166381f, 0.17185f, 0.16238f, 0.162873f,
+    0.159826f, 0.154913f, 0.150026f, 0.180228f, 0.161425f,
+    0.13378f, 0.114728f, 0.0860463f, 0.0800872f, 0.143415f,
+    0.148074f, 0.13992f, 0.138975f, 0.136796f, 0.133122f,
+    0.129374f, 0.155968f, 0.140071f, 0.116818f, 0.101314f,
+    0.0759852f, 0.0693914f, 0.135902f, 0.140304f, 0.132613f,
+    0.131481f, 0.128272f, 0.124418f, 0.118947f, 0.138991f,
+    0.124707f, 0.104115f, 0.0902003f, 0.0676502f, 0.0619359f,
+    0.135022f, 0.139404f, 0.131776f, 0.130604f, 0.127395f,
+    0.123528f, 0.118049f, 0.132957f, 0.119011f, 0.0990555f,
+    0.0852891f, 0.0639668f, 0.0592527f, 0.134902f, 0.139285f,
+    0.131667f, 0.130484f, 0.127276f, 0.123403f, 0.11792f,
+    0.128924f, 0.114955f, 0.0948472f, 0.0820393f, 0.0626172f,
+    0.0574147f, 0.625489f, 0.645811f, 0.610487f, 0.605004f,
+    0.590128f, 0.572171f, 0.546748f, 0.595373f, 0.530383f,
+    0.439101f, 0.380383f, 0.290294f, 0.265153f, 0.594326f,
+    0.613712f, 0.580096f, 0.575188f, 0.561275f, 0.544512f,
+    0.520663f, 0.580961f, 0.518042f, 0.425942f, 0.363503f,
+    0.278758f, 0.25858f, 0.571087f, 0.589704f, 0.557379f,
+    0.552749f, 0.539422f, 0.523388f, 0.500553f, 0.565449f,
+    0.504594f, 0.415482f, 0.350439f, 0.268931f, 0.251647f,
+    0.54812f, 0.565929f, 0.53492f, 0.53035f, 0.517447f,
+    0.501926f, 0.479873f, 0.541188f, 0.483241f, 0.39852f,
+    0.33688f, 0.257265f, 0.240951f, 0.540608f, 0.558158f,
+    0.527612f, 0.522932f, 0.510098f, 0.494626f, 0.472705f,
+    0.524212f, 0.467878f, 0.385816f, 0.329146f, 0.251909f,
+    0.233496f, 0.539728f, 0.557258f, 0.526775f, 0.522055f,
+    0.509222f, 0.493736f, 0.471807f, 0.518177f, 0.462181f,
+    0.380757f, 0.328303f, 0.250802f, 0.230813f, 0.539608f,
+    0.557139f, 0.526666f, 0.521935f, 0.509102f, 0.493611f,
+    0.471678f, 0.514144f, 0.458125f, 0.378812f, 0.328156f,
+    0.250444f, 0.228974f, 0.136278f, 0.128018f, 0.127102f,
+    0.12422f, 0.11972f, 0.113975f, 0.106874f, 0.101319f,
+    0.0919229f, 0.0763763f, 0.0639109f, 0.0487667f, 0.0450297f,
+    0.0951781f, 0.100609f, 0.0948427f, 0.0947705f, 0.0923017f,
+    0.0875139f, 0.0845516f, 0.0827965f, 0.0750988f, 0.0627158f,
+    0.054833f, 0.0411247f, 0.0368957f, 0.0694357f, 0.0732961f,
+    0.0694753f, 0.0699902f, 0.0687561f, 0.0657703f, 0.0644996f,
+    0.0631803f, 0.0581768f, 0.0495901f, 0.0450348f, 0.0337761f,
+    0.0283165f, 0.0301911f, 0.0318638f, 0.0307092f, 0.0318196f,
+    0.032306f, 0.0319667f, 0.0329621f, 0.0329759f, 0.0315884f,
+    0.0285102f, 0.0281016f, 0.0210761f, 0.0168609f, 0.0114643f,
+    0.00863381f, 0.00836336f, 0.00842983f, 0.00997187f, 0.0109379f,
+    0.0124686f, 0.0136512f, 0.0139682f, 0.0137049f, 0.0143212f,
+    0.0107409f, 0.00859274f, 0.00631658f, 0.00434641f, 0.00504737f,
+    0.0070137f, 0.00804749f, 0.00833128f, 0.00916936f, 0.00967242f,
+    0.00956104f, 0.00879365f, 0.00828594f, 0.00621445f, 0.00497157f,
+    0.0017036f, 0.0024784f, 0.00266065f, 0.00382992f, 0.003907f,
+    0.00355544f, 0.00367922f, 0.00358892f, 0.00335677f, 0.0028185f,
+    0.00240806f, 0.00180604f, 0.00144483f, 0.179091f, 0.168236f,
+    0.167032f, 0.163245f, 0.157332f, 0.149781f, 0.140449f,
+    0.133149f, 0.120801f, 0.100371f, 0.0839891f, 0.0640873f,
+    0.0591762f, 0.132181f, 0.139816f, 0.131688f, 0.131451f,
+    0.127926f, 0.121188f, 0.116831f, 0.114627f, 0.103634f,
+    0.0861858f, 0.0746589f, 0.0559942f, 0.0510422f, 0.106439f,
+    0.112504f, 0.10632f, 0.106671f, 0.10438f, 0.0994441f,
+    0.0967792f, 0.0950105f, 0.086712f, 0.0730602f, 0.0648607f,
+    0.0486455f, 0.042463f, 0.0671938f, 0.0710716f, 0.0675541f,
+    0.0685f, 0.06793f, 0.0656405f, 0.0652416f, 0.0648061f,
+    0.0601236f, 0.0519803f, 0.0479274f, 0.0359456f, 0.0292307f,
+    0.0442391f, 0.0468725f, 0.0444764f, 0.0451102f, 0.0448843f,
+    0.0436f, 0.0437582f, 0.0440886f, 0.0411767f, 0.036298f,
+    0.0341471f, 0.0256104f, 0.0204883f, 0.0429426f, 0.0411015f,
+    0.0401065f, 0.0392122f, 0.0384329f, 0.0369853f, 0.0366892f,
+    0.0369104f, 0.0341898f, 0.0300491f, 0.0281118f, 0.0210839f,
+    0.0168671f, 0.042813f, 0.0402182f, 0.0399305f, 0.0390252f,
+    0.0376116f, 0.0358067f, 0.0335759f, 0.032339f, 0.0292256f,
+    0.0247744f, 0.022234f, 0.0166755f, 0.0144267f, 0.221904f,
+    0.208453f, 0.206962f, 0.20227f, 0.194943f, 0.185587f,
+    0.174025f, 0.164979f, 0.14968f, 0.124365f, 0.104067f,
+    0.0794079f, 0.0733226f, 0.170668f, 0.179024f, 0.168533f,
+    0.168131f, 0.16355f, 0.154861f, 0.14911f, 0.146457f,
+    0.132169f, 0.109656f, 0.0944848f, 0.0708636f, 0.0651887f,
+    0.143441f, 0.151712f, 0.143165f, 0.143351f, 0.140004f,
+    0.133118f, 0.129059f, 0.126841f, 0.115247f, 0.0965301f,
+    0.0846866f, 0.063515f, 0.0566095f, 0.104197f, 0.110279f,
+    0.104399f, 0.10518f, 0.103554f, 0.0993143f, 0.0975211f,
+    0.0966362f, 0.0886586f, 0.0754503f, 0.0677533f, 0.050815f,
+    0.0433772f, 0.0868947f, 0.0860802f, 0.0813487f, 0.0817906f,
+    0.0805083f, 0.0772737f, 0.0760377f, 0.0759188f, 0.0697118f,
+    0.059768f, 0.053973f, 0.0404798f, 0.0341581f, 0.0857556f,
+    0.0805987f, 0.0800367f, 0.0782372f, 0.075418f, 0.0718212f,
+    0.0689687f, 0.0687406f, 0.0627249f, 0.0535191f, 0.0479377f,
+    0.0359533f, 0.0308422f, 0.085626f, 0.0804361f, 0.0798607f,
+    0.0780502f, 0.0752229f, 0.0716129f, 0.0671513f, 0.0641691f,
+    0.0577607f, 0.0482445f, 0.0420599f, 0.0315449f, 0.0285732f,
+    0.264717f, 0.248671f, 0.246892f, 0.241295f, 0.232554f,
+    0.221394f, 0.2076f, 0.196809f, 0.178558f, 0.148359f,
+    0.124146f, 0.0947283f, 0.0874692f, 0.213481f, 0.218232f,
+    0.205378f, 0.204812f, 0.199174f, 0.188535f, 0.18139f,
+    0.178287f, 0.160704f, 0.133126f, 0.114311f, 0.085733f,
+    0.0793352f, 0.180444f, 0.190919f, 0.18001f, 0.180031f,
+    0.175628f, 0.166792f, 0.161338f, 0.158671f, 0.143782f,
+    0.12f, 0.104513f, 0.0783844f, 0.070756f, 0.141199f,
+    0.149487f, 0.141244f, 0.141861f, 0.139178f, 0.132988f,
+    0.129801f, 0.128466f, 0.117194f, 0.0989202f, 0.0875792f,
+    0.0656844f, 0.0575237f, 0.129708f, 0.125288f, 0.121279f,
+    0.11862f, 0.116132f, 0.110948f, 0.108317f, 0.107749f,
+    0.0982468f, 0.0832382f, 0.0737989f, 0.0553492f, 0.0483046f,
+    0.128569f, 0.120817f, 0.119967f, 0.117262f, 0.113029f,
+    0.107627f, 0.101248f, 0.100571f, 0.09126f, 0.0769891f,
+    0.0677636f, 0.0508227f, 0.0449887f, 0.128439f, 0.120654f,
+    0.119791f, 0.117075f, 0.112834f, 0.107419f, 0.100727f,
+    0.0959993f, 0.086636f, 0.0719835f, 0.0618857f, 0.0464143f,
+    0.0427198f, 0.350343f, 0.329107f, 0.326753f, 0.319345f,
+    0.307777f, 0.293006f, 0.274751f, 0.260469f, 0.236315f,
+    0.196348f, 0.164302f, 0.125369f, 0.115762f, 0.299107f,
+    0.296647f, 0.280982f, 0.278172f, 0.270422f, 0.255883f,
+    0.245949f, 0.241947f, 0.217774f, 0.180066f, 0.153962f,
+    0.115472f, 0.107628f, 0.261839f, 0.269335f, 0.2537f,
+    0.253392f, 0.246876f, 0.234139f, 0.225897f, 0.222331f,
+    0.200852f, 0.16694f, 0.144164f, 0.108123f, 0.099049f,
+    0.226252f, 0.227903f, 0.214934f, 0.215221f, 0.210426f,
+    0.200336f, 0.194359f, 0.192127f, 0.174264f, 0.14586f,
+    0.127231f, 0.0954232f, 0.0858167f, 0.215334f, 0.203704f,
+    0.201139f, 0.19667f, 0.189635f, 0.180651f, 0.172876f,
+    0.171409f, 0.155317f, 0.130178f, 0.113451f, 0.085088f,
+    0.0765975f, 0.214194f, 0.201252f, 0.199827f, 0.195312f,
+    0.188252f, 0.17924f, 0.168097f, 0.164231f, 0.14833f,
+    0.123929f, 0.107415f, 0.0805617f, 0.0732817f, 0.214065f,
+    0.20109f, 0.199651f, 0.195125f, 0.188057f, 0.179032f,
+    0.167878f, 0.15966f, 0.144393f, 0.119972f, 0.101538f,
+    0.0766125f, 0.0710126f, 0.992537f, 0.932376f, 0.925706f,
+    0.904719f, 0.871946f, 0.8301f, 0.778382f, 0.737922f,
+    0.669492f, 0.556262f, 0.465475f, 0.355177f, 0.32796f,
+    0.9413f, 0.885902f, 0.879935f, 0.860579f, 0.829992f,
+    0.790789f, 0.742199f, 0.7194f, 0.645801f, 0.532116f,
+    0.451351f, 0.341063f, 0.319826f, 0.904034f, 0.857452f,
+    0.845551f, 0.827096f, 0.797844f, 0.76033f, 0.713804f,
+    0.699784f, 0.628879f, 0.518991f, 0.441553f, 0.331164f,
+    0.311246f, 0.868446f, 0.816902f, 0.811341f, 0.793364f,
+    0.765039f, 0.728802f, 0.683924f, 0.669579f, 0.602291f,
+    0.497911f, 0.42462f, 0.318464f, 0.298014f, 0.857528f,
+    0.805785f, 0.800092f, 0.782043f, 0.753805f, 0.717744f,
+    0.673156f, 0.648862f, 0.583343f, 0.482228f, 0.410839f,
+    0.308213f, 0.288795f, 0.856388f, 0.804521f, 0.798781f,
+    0.780686f, 0.752422f, 0.716333f, 0.671729f, 0.641684f,
+    0.577807f, 0.480099f, 0.404804f, 0.306858f, 0.28548f,
+    0.856259f, 0.804359f, 0.798604f, 0.780499f, 0.752227f,
+    0.716125f, 0.671509f, 0.637112f, 0.577569f, 0.479887f,
+    0.401565f, 0.30642f, 0.28321f,
+};
+
+// [umax][psi][alpha][beta][delta_x]
+WC_PREFIX
+static const float wc_normalization_table_staple_values[
+    WC_NORMALIZATION_TABLE_UMAX_SIZE*WC_NORMALIZATION_TABLE_PSI_SIZE
+    *WC_NORMALIZATION_TABLE_ALPHA_SIZE*WC_NORMALIZATION_TABLE_BETA_SIZE
+    *WC_NORMALIZATION_TABLE_DELTA_X_SIZE] = {
+    0.12509f, 0.0957988f, 0.0628743f, 0.0594921f, 0.056058f,
+    0.0577374f, 0.0525386f, 0.0548378f, 0.0512421f, 0.0514781f,
+    0.0464722f, 0.0376775f, 0.0308435f, 0.0863306f, 0.0759046f,
+    0.050455f, 0.0397733f, 0.037998f, 0.0409827f, 0.0383747f,
+    0.0397215f, 0.0388201f, 0.0353371f, 0.030942f, 0.0250607f,
+    0.0200486f, 0.0638007f, 0.0657339f, 0.0436467f, 0.0290978f,
+    0.0285755f, 0.0327136f, 0.0272613f, 0.0260687f, 0.0280925f,
+    0.0250011f, 0.0208343f, 0.0187553f, 0.0150042f, 0.0444499f,
+    0.0391785f, 0.0281767f, 0.0241496f, 0.0225547f, 0.0197273f,
+    0.0164394f, 0.0161386f, 0.0141212f, 0.0139395f, 0.0116163f,
+    0.0162139f, 0.0129711f, 0.0221888f, 0.0167863f, 0.019546f,
+    0.018715f, 0.0140362f, 0.011229f, 0.0093575f, 0.00857128f,
+    0.00925025f, 0.00919721f, 0.00822461f, 0.00981508f, 0.00785207f,
+    0.00971044f, 0.00769107f, 0.0151659f, 0.0131156f, 0.00983669f,
+    0.00786935f, 0.00655779f, 0.00562097f, 0.00542635f, 0.00595031f,
+    0.00526592f, 0.00532171f, 0.00547119f, 0.00047783f, 0.000436123f,
+    0.00489816f, 0.00353554f, 0.00265166f, 0.00212133f, 0.00176777f,
+    0.00151523f, 0.00132583f, 0.00128574f, 0.0011027f, 0.00177329f,
+    0.00159899f, 0.164388f, 0.125895f, 0.0826269f, 0.0781821f,
+    0.0736691f, 0.0758761f, 0.0690441f, 0.0720655f, 0.0673403f,
+    0.0676505f, 0.0610719f, 0.0495143f, 0.0405332f, 0.125629f,
+    0.100579f, 0.0668618f, 0.0584633f, 0.0544384f, 0.0591215f,
+    0.0548802f, 0.0569493f, 0.0540538f, 0.0514813f, 0.0448987f,
+    0.0366895f, 0.0293516f, 0.0926702f, 0.0904081f, 0.0600534f,
+    0.0427019f, 0.0415157f, 0.0452869f, 0.0418568f, 0.0432965f,
+    0.0433262f, 0.038841f, 0.0333189f, 0.0273425f, 0.021874f,
+    0.0641685f, 0.0638526f, 0.0423035f, 0.0295091f, 0.0306416f,
+    0.0323006f, 0.0269171f, 0.0265125f, 0.0272954f, 0.0243429f,
+    0.0203355f, 0.0210282f, 0.0168225f, 0.0413578f, 0.0384671f,
+    0.025643f, 0.0240745f, 0.0201633f, 0.0200523f, 0.0181781f,
+    0.0189298f, 0.018082f, 0.0173965f, 0.015191f, 0.0146294f,
+    0.0117035f, 0.0395331f, 0.0301662f, 0.0198804f, 0.0188165f,
+    0.0176477f, 0.0182978f, 0.0168265f, 0.0175567f, 0.0163892f,
+    0.0164032f, 0.0146749f, 0.0119574f, 0.00973344f, 0.0392984f,
+    0.0300961f, 0.0197526f, 0.0186902f, 0.0176112f, 0.0181389f,
+    0.0165078f, 0.0172303f, 0.0161004f, 0.0161743f, 0.0145999f,
+    0.0118373f, 0.00968982f, 0.203687f, 0.155991f, 0.102379f,
+    0.0968722f, 0.0912803f, 0.0940149f, 0.0855496f, 0.0892933f,
+    0.0834385f, 0.0838228f, 0.0756716f, 0.061351f, 0.050223f,
+    0.164927f, 0.125253f, 0.0836327f, 0.0771533f, 0.0708787f,
+    0.0772602f, 0.0713857f, 0.0741771f, 0.0692876f, 0.0676536f,
+    0.0590556f, 0.0485262f, 0.0389617f, 0.131968f, 0.115082f,
+    0.0764601f, 0.0613919f, 0.0579561f, 0.062379f, 0.0583623f,
+    0.0605243f, 0.05856f, 0.0543801f, 0.0473933f, 0.038622f,
+    0.0308976f, 0.094786f, 0.0885268f, 0.0587103f, 0.0445209f,
+    0.0420391f, 0.0448739f, 0.0421151f, 0.0437403f, 0.0425291f,
+    0.0395587f, 0.0344924f, 0.0282526f, 0.0226021f, 0.080656f,
+    0.0631412f, 0.0418173f, 0.0383348f, 0.035637f, 0.037486f,
+    0.0346836f, 0.0361576f, 0.0337205f, 0.0335688f, 0.0297424f,
+    0.0243841f, 0.0197401f, 0.0788313f, 0.0602623f, 0.0396329f,
+    0.0375065f, 0.0352588f, 0.0364365f, 0.033332f, 0.0347845f,
+    0.0324874f, 0.0325755f, 0.0292746f, 0.0237941f, 0.0194232f,
+    0.0785966f, 0.0601922f, 0.0395052f, 0.0373802f, 0.0352223f,
+    0.0362777f, 0.0330133f, 0.0344581f, 0.0321986f, 0.0323466f,
+    0.0291996f, 0.023674f, 0.0193796f, 0.242985f, 0.186087f,
+    0.122132f, 0.115562f, 0.108891f, 0.112154f, 0.102055f,
+    0.106521f, 0.0995367f, 0.0999951f, 0.0902712f, 0.0731877f,
+    0.0599127f, 0.204225f, 0.150066f, 0.103385f, 0.0958433f,
+    0.0873477f, 0.0953989f, 0.0878912f, 0.0914049f, 0.0851831f,
+    0.0838259f, 0.0732126f, 0.0603629f, 0.0486514f, 0.171267f,
+    0.139756f, 0.0928669f, 0.0800819f, 0.0743965f, 0.0805177f,
+    0.0748678f, 0.0777521f, 0.0737937f, 0.0705525f, 0.0615502f,
+    0.0504588f, 0.040367f, 0.134084f, 0.113201f, 0.075117f,
+    0.0632109f, 0.0584795f, 0.0628693f, 0.0586206f, 0.0609681f,
+    0.0577629f, 0.0557311f, 0.0486493f, 0.0400893f, 0.0321096f,
+    0.119954f, 0.0910922f, 0.0603732f, 0.0570248f, 0.0532481f,
+    0.0556247f, 0.0511891f, 0.0533854f, 0.0498187f, 0.0497411f,
+    0.0443421f, 0.0362209f, 0.0294298f, 0.118129f, 0.0903583f,
+    0.0593855f, 0.0561965f, 0.05287f, 0.0545753f, 0.0498375f,
+    0.0520123f, 0.0485856f, 0.0487479f, 0.0438743f, 0.0356309f,
+    0.029113f, 0.117895f, 0.0902882f, 0.0592577f, 0.0560702f,
+    0.0528335f, 0.0544164f, 0.0495188f, 0.0516859f, 0.0482968f,
+    0.048519f, 0.0437993f, 0.0355108f, 0.0290693f, 0.321581f,
+    0.246279f, 0.161637f, 0.152942f, 0.144114f, 0.148431f,
+    0.135066f, 0.140977f, 0.131733f, 0.13234f, 0.119471f,
+    0.0968612f, 0.0792923f, 0.282822f, 0.210258f, 0.14289f,
+    0.133223f, 0.122237f, 0.131676f, 0.120902f, 0.12586f,
+    0.11738f, 0.116171f, 0.102137f, 0.0840364f, 0.0680309f,
+    0.249863f, 0.189105f, 0.126447f, 0.117462f, 0.107277f,
+    0.116795f, 0.107879f, 0.112208f, 0.104547f, 0.102897f,
+    0.0898641f, 0.0741323f, 0.0596894f, 0.212681f, 0.162549f,
+    0.10793f, 0.100591f, 0.0925406f, 0.0991467f, 0.0916316f,
+    0.0954236f, 0.0889501f, 0.0880757f, 0.0774191f, 0.0637628f,
+    0.0514891f, 0.198551f, 0.151284f, 0.0998783f, 0.0944049f,
+    0.0884704f, 0.0919022f, 0.0842001f, 0.087841f, 0.0820151f,
+    0.0820858f, 0.0735414f, 0.0598944f, 0.0488093f, 0.196726f,
+    0.15055f, 0.0988906f, 0.0935765f, 0.0880923f, 0.0908528f,
+    0.0828485f, 0.0864679f, 0.0807819f, 0.0810925f, 0.0730736f,
+    0.0593043f, 0.0484925f, 0.196491f, 0.15048f, 0.0987629f,
+    0.0934502f, 0.0880557f, 0.0906939f, 0.0825298f, 0.0861415f,
+    0.0804931f, 0.0808636f, 0.0729986f, 0.0591842f, 0.0484489f,
+    0.911054f, 0.69772f, 0.457926f, 0.433292f, 0.408281f,
+    0.420512f, 0.382649f, 0.399394f, 0.373206f, 0.374925f,
+    0.338466f, 0.274412f, 0.224639f, 0.872295f, 0.6617f,
+    0.439179f, 0.413573f, 0.386404f, 0.403757f, 0.368485f,
+    0.384277f, 0.358852f, 0.358756f, 0.321132f, 0.261588f,
+    0.213377f, 0.839336f, 0.635386f, 0.422735f, 0.397812f,
+    0.370929f, 0.388876f, 0.355461f, 0.370625f, 0.34602f,
+    0.345482f, 0.308536f, 0.251683f, 0.205036f, 0.802154f,
+    0.610283f, 0.403645f, 0.380941f, 0.356708f, 0.371228f,
+    0.339214f, 0.353841f, 0.330423f, 0.330661f, 0.296414f,
+    0.241314f, 0.196835f, 0.788024f, 0.602725f, 0.396167f,
+    0.374755f, 0.352638f, 0.363983f, 0.331783f, 0.346258f,
+    0.323488f, 0.324671f, 0.292537f, 0.237445f, 0.194156f,
+    0.786199f, 0.601992f, 0.395179f, 0.373927f, 0.352259f,
+    0.362934f, 0.330431f, 0.344885f, 0.322255f, 0.323678f,
+    0.292069f, 0.236855f, 0.193839f, 0.785964f, 0.601921f,
+    0.395051f, 0.3738f, 0.352223f, 0.362775f, 0.330112f,
+    0.344558f, 0.321966f, 0.323449f, 0.291994f, 0.236735f,
+    0.193795f, 0.13099f, 0.0752101f, 0.0589024f, 0.05487f,
+    0.0543849f, 0.0471525f, 0.044915f, 0.0419244f, 0.0451601f,
+    0.0476031f, 0.0462402f, 0.0352071f, 0.0295387f, 0.0927007f,
+    0.0525197f, 0.0427526f, 0.0412663f, 0.0399925f, 0.0329392f,
+    0.0296641f, 0.0284483f, 0.029489f, 0.0318317f, 0.0301978f,
+    0.0230953f, 0.0184762f, 0.0929508f, 0.0455105f, 0.029677f,
+    0.0280054f, 0.0265274f, 0.0233934f, 0.0208887f, 0.0229646f,
+    0.0227739f, 0.0200907f, 0.0184388f, 0.0165405f, 0.0132324f,
+    0.0944436f, 0.0377774f, 0.0262858f, 0.0175239f, 0.0169204f,
+    0.0163577f, 0.0144193f, 0.015678f, 0.0157233f, 0.0166047f,
+    0.0138372f, 0.0134359f, 0.0129313f, 0.0740104f, 0.0296042f,
+    0.0194305f, 0.0129536f, 0.0121728f, 0.0114395f, 0.00953294f,
+    0.00965878f, 0.0110556f, 0.0112804f, 0.00940035f, 0.00798449f,
+    0.0110636f, 0.052224f, 0.0208896f, 0.0129837f, 0.00865577f,
+    0.0078935f, 0.00721418f, 0.00601182f, 0.00602002f, 0.00694967f,
+    0.00685343f, 0.00571119f, 0.0042834f, 0.00834947f, 0.0141416f,
+    0.00565662f, 0.00308641f, 0.00205761f, 0.00170548f, 0.00161155f,
+    0.00134296f, 0.0011511f, 0.00134549f, 0.00130758f, 0.00108965f,
+    0.00187726f, 0.00258058f, 0.172142f, 0.0988381f, 0.0774071f,
+    0.0721079f, 0.0714704f, 0.0619659f, 0.0590255f, 0.0550953f,
+    0.0593475f, 0.062558f, 0.060767f, 0.0462678f, 0.0388186f,
+    0.133853f, 0.0761477f, 0.0609709f, 0.0585042f, 0.0570781f,
+    0.0470171f, 0.0426122f, 0.0412167f, 0.0431516f, 0.0467867f,
+    0.0443264f, 0.0337205f, 0.0277215f, 0.113443f, 0.0619782f,
+    0.0465937f, 0.0452433f, 0.043613f, 0.036501f, 0.0324369f,
+    0.0306592f, 0.032749f, 0.0343313f, 0.0325673f, 0.0252208f,
+    0.0201766f, 0.114935f, 0.0459741f, 0.0324517f, 0.0277259f,
+    0.0265762f, 0.0226387f, 0.0206708f, 0.0233647f, 0.0222466f,
+    0.0210583f, 0.0199393f, 0.017547f, 0.0153342f, 0.0945021f,
+    0.0378008f, 0.0255963f, 0.0191944f, 0.0187472f, 0.0161278f,
+    0.0145229f, 0.0148286f, 0.0149216f, 0.0160072f, 0.0151096f,
+    0.0120956f, 0.0134665f, 0.0727158f, 0.0290863f, 0.0191495f,
+    0.0175931f, 0.0173724f, 0.0151344f, 0.0141505f, 0.0132208f,
+    0.0142313f, 0.0151817f, 0.0145849f, 0.011116f, 0.0107523f,
+    0.0411979f, 0.0236282f, 0.0185047f, 0.0172395f, 0.0170867f,
+    0.0148198f, 0.0141105f, 0.013171f, 0.0141875f, 0.0149585f,
+    0.0145269f, 0.0110607f, 0.0092799f, 0.213294f, 0.122466f,
+    0.0959118f, 0.0893458f, 0.0885559f, 0.0767793f, 0.0731359f,
+    0.0682663f, 0.0735349f, 0.0775129f, 0.0752938f, 0.0573285f,
+    0.0480985f, 0.175004f, 0.0997756f, 0.0791892f, 0.0757421f,
+    0.0741636f, 0.0618305f, 0.0563323f, 0.0540724f, 0.0572587f,
+    0.0617416f, 0.058455f, 0.0447812f, 0.0370014f, 0.14449f,
+    0.0801718f, 0.064812f, 0.0624812f, 0.0606985f, 0.0499792f,
+    0.0452112f, 0.0435852f, 0.0450904f, 0.0492862f, 0.0466959f,
+    0.0352957f, 0.02895f, 0.135427f, 0.0618356f, 0.0465273f,
+    0.0449638f, 0.0436617f, 0.0363668f, 0.032636f, 0.0319251f,
+    0.0327859f, 0.0360133f, 0.0340679f, 0.0257667f, 0.0212503f,
+    0.114994f, 0.0486831f, 0.038148f, 0.0364323f, 0.0358327f,
+    0.0309412f, 0.0286334f, 0.0270699f, 0.0288072f, 0.0309621f,
+    0.0295449f, 0.022566f, 0.0188545f, 0.0932075f, 0.0474408f,
+    0.0371218f, 0.034831f, 0.0344579f, 0.0299478f, 0.0282609f,
+    0.0263778f, 0.0284187f, 0.0301367f, 0.0291117f, 0.0221766f,
+    0.0185926f, 0.0823497f, 0.0472562f, 0.0370095f, 0.0344774f,
+    0.0341723f, 0.0296332f, 0.0282209f, 0.0263419f, 0.0283749f,
+    0.0299135f, 0.0290537f, 0.0221214f, 0.0185598f, 0.254446f,
+    0.146094f, 0.114417f, 0.106584f, 0.105641f, 0.0915928f,
+    0.0872464f, 0.0814372f, 0.0877224f, 0.0924679f, 0.0898206f,
+    0.0683891f, 0.0573783f, 0.216156f, 0.123404f, 0.0974075f,
+    0.09298f, 0.0912491f, 0.0766439f, 0.0704428f, 0.0669984f,
+    0.0713658f, 0.0766965f, 0.0725835f, 0.0558418f, 0.0462813f,
+    0.185642f, 0.1038f, 0.0830303f, 0.0797191f, 0.077784f,
+    0.0645354f, 0.0581593f, 0.0565112f, 0.0591975f, 0.0642411f,
+    0.0608245f, 0.0463564f, 0.0382299f, 0.155919f, 0.0812267f,
+    0.0647456f, 0.0622017f, 0.0607472f, 0.0511802f, 0.0463659f,
+    0.0448511f, 0.046893f, 0.0509682f, 0.0481964f, 0.0368273f,
+    0.0305302f, 0.135486f, 0.072311f, 0.0564964f, 0.0536702f,
+    0.0529182f, 0.0457547f, 0.0427438f, 0.0399959f, 0.0429946f,
+    0.045917f, 0.0440717f, 0.0336267f, 0.0281344f, 0.125912f,
+    0.0710687f, 0.0555934f, 0.0520689f, 0.0515434f, 0.0447612f,
+    0.0423714f, 0.0395487f, 0.0426062f, 0.0450916f, 0.0436385f,
+    0.0332373f, 0.0278724f, 0.123502f, 0.0708841f, 0.0555142f,
+    0.0517153f, 0.0512578f, 0.0444466f, 0.0423314f, 0.0395128f,
+    0.0425624f, 0.0448684f, 0.0435804f, 0.033182f, 0.0278396f,
+    0.336749f, 0.19335f, 0.151426f, 0.141059f, 0.139812f,
+    0.12122f, 0.115467f, 0.107779f, 0.116097f, 0.122378f,
+    0.118874f, 0.0905104f, 0.075938f, 0.29846f, 0.17066f,
+    0.133844f, 0.127456f, 0.12542f, 0.106271f, 0.0986637f,
+    0.0928504f, 0.09958f, 0.106606f, 0.101554f, 0.0779631f,
+    0.064841f, 0.267945f, 0.151056f, 0.119467f, 0.114195f,
+    0.111955f, 0.0941622f, 0.0863755f, 0.0823632f, 0.0874117f,
+    0.094151f, 0.0890816f, 0.0684777f, 0.0567896f, 0.232343f,
+    0.128483f, 0.101182f, 0.0966775f, 0.0949183f, 0.080807f,
+    0.0745868f, 0.0707031f, 0.0751072f, 0.0808781f, 0.0769323f,
+    0.0589486f, 0.0490899f, 0.213638f, 0.119567f, 0.0934396f,
+    0.088146f, 0.0870892f, 0.0753815f, 0.0709647f, 0.0662246f,
+    0.0713695f, 0.0758269f, 0.0731253f, 0.055748f, 0.0466941f,
+    0.208216f, 0.118325f, 0.0925656f, 0.0865447f, 0.0857145f,
+    0.074388f, 0.0705923f, 0.0658906f, 0.0709811f, 0.0750015f,
+    0.072692f, 0.0553586f, 0.0464322f, 0.205805f, 0.11814f,
+    0.0925237f, 0.0861911f, 0.0854288f, 0.0740734f, 0.0705523f,
+    0.0658547f, 0.0709373f, 0.0747783f, 0.072634f, 0.0553033f,
+    0.0463994f, 0.954027f, 0.547769f, 0.428997f, 0.399628f,
+    0.396095f, 0.343421f, 0.327124f, 0.305343f, 0.328909f,
+    0.346702f, 0.336776f, 0.25642f, 0.215136f, 0.915737f,
+    0.525079f, 0.408269f, 0.386024f, 0.381703f, 0.328472f,
+    0.310321f, 0.289446f, 0.312099f, 0.330931f, 0.319456f,
+    0.243873f, 0.204039f, 0.885223f, 0.505475f, 0.392789f,
+    0.372764f, 0.368238f, 0.316363f, 0.298032f, 0.277959f,
+    0.299764f, 0.318475f, 0.306891f, 0.234387f, 0.195988f,
+    0.84962f, 0.482902f, 0.376547f, 0.355246f, 0.351201f,
+    0.303008f, 0.286244f, 0.267079f, 0.287873f, 0.305202f,
+    0.294834f, 0.224858f, 0.188288f, 0.830915f, 0.473986f,
+    0.370553f, 0.346715f, 0.343372f, 0.297583f, 0.282622f,
+    0.263789f, 0.284181f, 0.300151f, 0.291027f, 0.221658f,
+    0.185892f, 0.825493f, 0.472744f, 0.370137f, 0.345113f,
+    0.341997f, 0.296589f, 0.282249f, 0.263455f, 0.283793f,
+    0.299326f, 0.290594f, 0.221268f, 0.18563f, 0.823083f,
+    0.472559f, 0.370095f, 0.34476f, 0.341712f, 0.296274f,
+    0.282209f, 0.263419f, 0.283749f, 0.299102f, 0.290536f,
+    0.221213f, 0.185597f, 0.0794528f, 0.0697789f, 0.0512086f,
+    0.0493223f, 0.046232f, 0.0453201f, 0.0433275f, 0.0443669f,
+    0.0476825f, 0.0467149f, 0.0454842f, 0.0347915f, 0.0279429f,
+    0.0570937f, 0.0483998f, 0.0354862f, 0.0312333f, 0.0300489f,
+    0.0286385f, 0.0296961f, 0.0278038f, 0.0300871f, 0.0298329f,
+    0.0286326f, 0.021987f, 0.0175896f, 0.0552153f, 0.0378129f,
+    0.0248256f, 0.0229561f, 0.0235419f, 0.0227159f, 0.021544f,
+    0.0211522f, 0.0206403f, 0.0190352f, 0.0182754f, 0.0161285f,
+    0.0129028f, 0.0407309f, 0.0279207f, 0.0185525f, 0.0192235f,
+    0.0156424f, 0.0157369f, 0.0151898f, 0.014154f, 0.014631f,
+    0.0139459f, 0.0127555f, 0.0119688f, 0.00957501f, 0.0362113f,
+    0.0211669f, 0.012919f, 0.0150419f, 0.0122395f, 0.0108019f,
+    0.010048f, 0.00957022f, 0.00936145f, 0.00979961f, 0.00830554f,
+    0.00703916f, 0.00793703f, 0.0377613f, 0.0200316f, 0.0114542f,
+    0.0108431f, 0.00979639f, 0.00847021f, 0.00768222f, 0.00691996f,
+    0.00630226f, 0.00661753f, 0.0055146f, 0.00534602f, 0.00599929f,
+    0.0326727f, 0.0144116f, 0.00742093f, 0.00535192f, 0.00480589f,
+    0.00394501f, 0.00338042f, 0.0029368f, 0.00259419f, 0.00223307f,
+    0.00186089f, 0.00317504f, 0.00254003f, 0.104414f, 0.0917005f,
+    0.0672963f, 0.0648174f, 0.0607562f, 0.0595578f, 0.0569392f,
+    0.0583052f, 0.0626624f, 0.0613908f, 0.0597735f, 0.0457216f,
+    0.0367214f, 0.0741901f, 0.0703215f, 0.0515739f, 0.0467283f,
+    0.0445206f, 0.0426992f, 0.0422215f, 0.0417421f, 0.045067f,
+    0.0439581f, 0.0428466f, 0.0327008f, 0.0262681f, 0.0717941f,
+    0.0522815f, 0.0383221f, 0.0342098f, 0.032087f, 0.0309581f,
+    0.0325511f, 0.0298654f, 0.0320999f, 0.0323412f, 0.0308954f,
+    0.0236487f, 0.018919f, 0.0573096f, 0.0398797f, 0.0260256f,
+    0.0235377f, 0.0240074f, 0.0229934f, 0.0220391f, 0.021313f,
+    0.021151f, 0.0197487f, 0.0189002f, 0.0156811f, 0.0125449f,
+    0.0398244f, 0.0265925f, 0.0173689f, 0.019301f, 0.0155294f,
+    0.0147551f, 0.0146254f, 0.0143898f, 0.0154804f, 0.0151544f,
+    0.0147702f, 0.0112877f, 0.00965813f, 0.0413744f, 0.0229739f,
+    0.0163012f, 0.0155617f, 0.0145825f, 0.0142831f, 0.013682f,
+    0.0139882f, 0.0150354f, 0.0147295f, 0.0143445f, 0.0109708f,
+    0.00881204f, 0.0362858f, 0.0219234f, 0.0160902f, 0.0154952f,
+    0.0145243f, 0.0142378f, 0.0136119f, 0.0139383f, 0.01498f,
+    0.014676f, 0.0142894f, 0.0109301f, 0.00877857f, 0.129374f,
+    0.113622f, 0.083384f, 0.0803125f, 0.0752804f, 0.0737955f,
+    0.0705509f, 0.0722435f, 0.0776423f, 0.0760667f, 0.0740628f,
+    0.0566517f, 0.0454999f, 0.099151f, 0.0922432f, 0.0676616f,
+    0.0622234f, 0.0589923f, 0.05676f, 0.0554454f, 0.0556804f,
+    0.0600468f, 0.058634f, 0.0571358f, 0.0436309f, 0.0350467f,
+    0.0883728f, 0.0742032f, 0.0544098f, 0.0488728f, 0.0465587f,
+    0.0447006f, 0.0450765f, 0.0436011f, 0.0470798f, 0.0459175f,
+    0.0447743f, 0.0341614f, 0.0274424f, 0.0738884f, 0.0536678f,
+    0.0393697f, 0.0357984f, 0.0338073f, 0.032694f, 0.0325787f,
+    0.0319767f, 0.0344676f, 0.0336762f, 0.0328402f, 0.0250703f,
+    0.02014f, 0.0525217f, 0.0453928f, 0.0333369f, 0.0315524f,
+    0.0295556f, 0.0289006f, 0.0277831f, 0.028328f, 0.0304603f,
+    0.0298303f, 0.0290595f, 0.0222178f, 0.0178466f, 0.0500157f,
+    0.0441051f, 0.0323889f, 0.0310567f, 0.0291067f, 0.0285208f,
+    0.0272938f, 0.0279265f, 0.0300153f, 0.0294054f, 0.0286338f,
+    0.0219008f, 0.0175906f, 0.0499218f, 0.0438451f, 0.0321779f,
+    0.0309902f, 0.0290485f, 0.0284755f, 0.0272237f, 0.0278766f,
+    0.0299598f, 0.0293519f, 0.0285787f, 0.0218602f, 0.0175571f,
+    0.154335f, 0.135544f, 0.0994716f, 0.0958076f, 0.0898046f,
+    0.0880332f, 0.0841627f, 0.0861818f, 0.0926221f, 0.0907426f,
+    0.0883522f, 0.0675818f, 0.0542785f, 0.124112f, 0.114165f,
+    0.0837492f, 0.0777185f, 0.073464f, 0.070866f, 0.0690571f,
+    0.0696186f, 0.0750268f, 0.0733099f, 0.0714252f, 0.054561f,
+    0.0438252f, 0.104952f, 0.0961249f, 0.0704974f, 0.0643679f,
+    0.0610304f, 0.0587614f, 0.0576019f, 0.0575394f, 0.0620597f,
+    0.0605934f, 0.0590636f, 0.0450915f, 0.0362209f, 0.0904671f,
+    0.0755895f, 0.0554573f, 0.0512935f, 0.048279f, 0.0467547f,
+    0.0454509f, 0.045915f, 0.0494475f, 0.0483521f, 0.0471295f,
+    0.0360004f, 0.0289186f, 0.0756928f, 0.0673145f, 0.0494245f,
+    0.0470475f, 0.0440798f, 0.0431384f, 0.0413949f, 0.0422663f,
+    0.0454402f, 0.0445062f, 0.0433488f, 0.0331478f, 0.0266252f,
+    0.0749765f, 0.0660267f, 0.0484766f, 0.0465518f, 0.0436309f,
+    0.0427586f, 0.0409055f, 0.0418648f, 0.0449952f, 0.0440813f,
+    0.0429231f, 0.0328309f, 0.0263691f, 0.0748826f, 0.0657667f,
+    0.0482655f, 0.0464853f, 0.0435727f, 0.0427132f, 0.0408354f,
+    0.0418149f, 0.0449397f, 0.0440278f, 0.042868f, 0.0327903f,
+    0.0263356f, 0.204257f, 0.179387f, 0.131647f, 0.126798f,
+    0.118853f, 0.116509f, 0.111386f, 0.114058f, 0.122582f,
+    0.120094f, 0.116931f, 0.089442f, 0.0718355f, 0.174033f,
+    0.158008f, 0.115925f, 0.108709f, 0.102407f, 0.0993414f,
+    0.0962806f, 0.0974952f, 0.104987f, 0.102662f, 0.100004f,
+    0.0764212f, 0.0613822f, 0.152421f, 0.139968f, 0.102673f,
+    0.095358f, 0.0899738f, 0.086954f, 0.0846123f, 0.085416f,
+    0.0920195f, 0.0899452f, 0.0876422f, 0.0669516f, 0.0537779f,
+    0.131976f, 0.119433f, 0.0876327f, 0.0822836f, 0.0772224f,
+    0.075206f, 0.0726744f, 0.0737915f, 0.0794072f, 0.0777039f,
+    0.0757081f, 0.0578605f, 0.0464756f, 0.125615f, 0.111158f,
+    0.0815998f, 0.0780376f, 0.0731282f, 0.0716138f, 0.0686183f,
+    0.0701429f, 0.0754f, 0.0738581f, 0.0719274f, 0.055008f,
+    0.0441822f, 0.124898f, 0.10987f, 0.0806519f, 0.077542f,
+    0.0726794f, 0.071234f, 0.068129f, 0.0697414f, 0.0749549f,
+    0.0734331f, 0.0715017f, 0.0546911f, 0.0439261f, 0.124804f,
+    0.10961f, 0.0804409f, 0.0774754f, 0.0726211f, 0.0711887f,
+    0.0680589f, 0.0696914f, 0.0748995f, 0.0733797f, 0.0714466f,
+    0.0546505f, 0.0438926f, 0.57867f, 0.508213f, 0.372962f,
+    0.359224f, 0.336716f, 0.330075f, 0.315562f, 0.323132f,
+    0.34728f, 0.340233f, 0.33127f, 0.253393f, 0.203513f,
+    0.548446f, 0.486833f, 0.35724f, 0.341135f, 0.319695f,
+    0.312907f, 0.300456f, 0.306569f, 0.329685f, 0.322801f,
+    0.314343f, 0.240372f, 0.19306f, 0.526834f, 0.468793f,
+    0.343988f, 0.327784f, 0.307154f, 0.30052f, 0.288788f,
+    0.29449f, 0.316718f, 0.310084f, 0.301982f, 0.230903f,
+    0.185456f, 0.506388f, 0.448258f, 0.328948f, 0.31471f,
+    0.294922f, 0.288772f, 0.27685f, 0.282866f, 0.304106f,
+    0.297843f, 0.290048f, 0.221812f, 0.178153f, 0.500027f,
+    0.439983f, 0.322915f, 0.310464f, 0.290991f, 0.28518f,
+    0.272794f, 0.279217f, 0.300098f, 0.293997f, 0.286267f,
+    0.218959f, 0.17586f, 0.499311f, 0.438695f, 0.321967f,
+    0.309968f, 0.290542f, 0.2848f, 0.272305f, 0.278816f,
+    0.299653f, 0.293572f, 0.285841f, 0.218642f, 0.175604f,
+    0.499217f, 0.438435f, 0.321756f, 0.309901f, 0.290484f,
+    0.284754f, 0.272235f, 0.278766f, 0.299598f, 0.293518f,
+    0.285786f, 0.218602f, 0.17557f, 0.0804407f, 0.0541902f,
+    0.0517327f, 0.0470532f, 0.0443557f, 0.0431597f, 0.0426591f,
+    0.0433464f, 0.0445723f, 0.0469281f, 0.0455504f, 0.0341628f,
+    0.0273303f, 0.051181f, 0.0349876f, 0.0347095f, 0.0295316f,
+    0.0299086f, 0.0278381f, 0.0277394f, 0.027188f, 0.0291659f,
+    0.0299009f, 0.028924f, 0.021693f, 0.0173771f, 0.0373584f,
+    0.0262344f, 0.0251506f, 0.0226494f, 0.0209939f, 0.0192148f,
+    0.0204125f, 0.0195021f, 0.021303f, 0.0192148f, 0.0176633f,
+    0.0159037f, 0.012723f, 0.0290465f, 0.0198347f, 0.018059f,
+    0.0159307f, 0.0143286f, 0.0148525f, 0.015107f, 0.0137938f,
+    0.0137627f, 0.0154331f, 0.0135245f, 0.0120001f, 0.00960011f,
+    0.0154492f, 0.016325f, 0.0127845f, 0.0117257f, 0.011169f,
+    0.0115729f, 0.0115419f, 0.010515f, 0.010543f, 0.0109434f,
+    0.00975463f, 0.00741034f, 0.00668325f, 0.00753486f, 0.0139095f,
+    0.0101699f, 0.00911386f, 0.00860187f, 0.00814204f, 0.00795875f,
+    0.00722467f, 0.00727587f, 0.00707645f, 0.00643667f, 0.00668528f,
+    0.00534822f, 0.00115635f, 0.0084453f, 0.00495715f, 0.00398409f,
+    0.00356176f, 0.0028942f, 0.00245386f, 0.00237656f, 0.00221217f,
+    0.00203868f, 0.0016989f, 0.00399813f, 0.0031985f, 0.105712f,
+    0.0712145f, 0.067985f, 0.0618354f, 0.0582904f, 0.0567187f,
+    0.0560609f, 0.0569641f, 0.0585751f, 0.061671f, 0.0598605f,
+    0.0448954f, 0.0359163f, 0.0764522f, 0.0511296f, 0.0509618f,
+    0.0443138f, 0.0431817f, 0.0408739f, 0.0401097f, 0.0408057f,
+    0.0423831f, 0.044215f, 0.0432341f, 0.0324256f, 0.0259405f,
+    0.0547602f, 0.037787f, 0.03732f, 0.0315192f, 0.0323572f,
+    0.030146f, 0.0314554f, 0.0297549f, 0.0323564f, 0.0321797f,
+    0.030901f, 0.0231758f, 0.0187295f, 0.0398811f, 0.0280436f,
+    0.0262739f, 0.0235808f, 0.0216342f, 0.0196786f, 0.0210173f,
+    0.0201846f, 0.0214345f, 0.0195578f, 0.0187779f, 0.0158389f,
+    0.0126711f, 0.0262838f, 0.0195641f, 0.0174097f, 0.0157138f,
+    0.0143584f, 0.0147927f, 0.0149031f, 0.0140599f, 0.0145206f,
+    0.0152338f, 0.0148341f, 0.0111255f, 0.00890044f, 0.0253904f,
+    0.0171485f, 0.0163941f, 0.0148359f, 0.0139803f, 0.013609f,
+    0.0134515f, 0.0136667f, 0.0140671f, 0.0147989f, 0.0143733f,
+    0.0107799f, 0.00862396f, 0.0252713f, 0.0170244f, 0.0162529f,
+    0.0147823f, 0.0139348f, 0.0135591f, 0.0134018f, 0.0136177f,
+    0.014003f, 0.014743f, 0.0143102f, 0.0107326f, 0.00858612f,
+    0.130983f, 0.0882389f, 0.0842373f, 0.0766176f, 0.0722252f,
+    0.0702777f, 0.0694626f, 0.0705818f, 0.0725779f, 0.0764138f,
+    0.0741706f, 0.055628f, 0.0445024f, 0.101723f, 0.0678076f,
+    0.0672141f, 0.059096f, 0.0564549f, 0.0544325f, 0.0535115f,
+    0.0544234f, 0.0563859f, 0.0589579f, 0.0575442f, 0.0431582f,
+    0.0345265f, 0.0800314f, 0.053929f, 0.0535723f, 0.0462837f,
+    0.0456303f, 0.0427026f, 0.0424984f, 0.0426217f, 0.0443151f,
+    0.0463003f, 0.0452111f, 0.0339083f, 0.0271267f, 0.0586086f,
+    0.0392087f, 0.0389003f, 0.0339277f, 0.0328543f, 0.0312375f,
+    0.0320602f, 0.03125f, 0.0324045f, 0.0338702f, 0.033088f,
+    0.024816f, 0.0198528f, 0.0515176f, 0.0345508f, 0.0334258f,
+    0.0300452f, 0.0282932f, 0.027575f, 0.0272423f, 0.0276776f,
+    0.0285234f, 0.0299767f, 0.0291442f, 0.0218581f, 0.0174865f,
+    0.0506616f, 0.0341006f, 0.0326464f, 0.0296181f, 0.0279151f,
+    0.0271676f, 0.0268533f, 0.0272844f, 0.0280699f, 0.0295417f,
+    0.0286834f, 0.0215125f, 0.01721f, 0.0505425f, 0.0340487f,
+    0.0325052f, 0.0295645f, 0.0278695f, 0.0271181f, 0.0268036f,
+    0.0272354f, 0.0280058f, 0.0294859f, 0.0286203f, 0.0214652f,
+    0.0171722f, 0.156254f, 0.105263f, 0.10049f, 0.0913998f,
+    0.0861599f, 0.0838367f, 0.0828644f, 0.0841995f, 0.0865807f,
+    0.0911567f, 0.0884807f, 0.0663605f, 0.0530884f, 0.126995f,
+    0.0848319f, 0.0834664f, 0.0738782f, 0.069728f, 0.0679912f,
+    0.0669133f, 0.0680411f, 0.0703887f, 0.0737008f, 0.0718543f,
+    0.0538908f, 0.0431126f, 0.105303f, 0.070071f, 0.0698246f,
+    0.0610659f, 0.0589035f, 0.0562612f, 0.0553033f, 0.0562394f,
+    0.0583178f, 0.0609371f, 0.0595212f, 0.0446409f, 0.0357127f,
+    0.0838798f, 0.0558908f, 0.0551526f, 0.0487099f, 0.0461274f,
+    0.0447962f, 0.0441474f, 0.0448677f, 0.0464073f, 0.0486131f,
+    0.0473981f, 0.0355486f, 0.0284389f, 0.0767888f, 0.0515752f,
+    0.0496781f, 0.0448274f, 0.0422279f, 0.0411337f, 0.040644f,
+    0.0412952f, 0.0425262f, 0.0447195f, 0.0434542f, 0.0325907f,
+    0.0260726f, 0.0759328f, 0.0511249f, 0.0488987f, 0.0444003f,
+    0.0418498f, 0.0407263f, 0.040255f, 0.0409021f, 0.0420727f,
+    0.0442846f, 0.0429935f, 0.0322451f, 0.0257961f, 0.0758137f,
+    0.0510731f, 0.0487576f, 0.0443467f, 0.0418043f, 0.0406771f,
+    0.0402053f, 0.0408531f, 0.0420086f, 0.0442288f, 0.0429304f,
+    0.0321978f, 0.0257582f, 0.206797f, 0.139312f, 0.132994f,
+    0.120964f, 0.114029f, 0.110955f, 0.109668f, 0.111435f,
+    0.114586f, 0.120642f, 0.117101f, 0.0878257f, 0.0702605f,
+    0.177537f, 0.118881f, 0.115971f, 0.103443f, 0.0973024f,
+    0.0951085f, 0.0937168f, 0.0952764f, 0.0983943f, 0.103187f,
+    0.100474f, 0.0753559f, 0.0602847f, 0.155845f, 0.104055f,
+    0.102329f, 0.0906303f, 0.0854498f, 0.0833785f, 0.0821068f,
+    0.0834748f, 0.0863235f, 0.0904229f, 0.0881414f, 0.0661061f,
+    0.0528848f, 0.134422f, 0.0899395f, 0.0876573f, 0.0782743f,
+    0.0736478f, 0.0719135f, 0.0709509f, 0.072103f, 0.074413f,
+    0.0780988f, 0.0760183f, 0.0570137f, 0.045611f, 0.127331f,
+    0.0856239f, 0.0821827f, 0.0743918f, 0.0700974f, 0.068251f,
+    0.0674476f, 0.0685306f, 0.0705318f, 0.0742053f, 0.0720744f,
+    0.0540558f, 0.0432446f, 0.126475f, 0.0851736f, 0.0814033f,
+    0.0739647f, 0.0697193f, 0.067844f, 0.0670585f, 0.0681375f,
+    0.0700783f, 0.0737704f, 0.0716136f, 0.0537102f, 0.0429682f,
+    0.126356f, 0.0851218f, 0.0812622f, 0.0739111f, 0.0696738f,
+    0.0677952f, 0.0670088f, 0.0680885f, 0.0700142f, 0.0737145f,
+    0.0715506f, 0.0536629f, 0.0429303f, 0.585865f, 0.394677f,
+    0.376779f, 0.342697f, 0.323051f, 0.31434f, 0.310694f,
+    0.3157f, 0.324628f, 0.341786f, 0.331752f, 0.248814f,
+    0.199051f, 0.556605f, 0.374246f, 0.359756f, 0.325176f,
+    0.306324f, 0.298488f, 0.294743f, 0.299542f, 0.308436f,
+    0.32433f, 0.315126f, 0.236344f, 0.189076f, 0.534913f,
+    0.359421f, 0.346114f, 0.312363f, 0.294209f, 0.286758f,
+    0.283133f, 0.28774f, 0.296365f, 0.311566f, 0.302793f,
+    0.227095f, 0.181676f, 0.51349f, 0.345305f, 0.331442f,
+    0.300007f, 0.282669f, 0.275293f, 0.271977f, 0.276368f,
+    0.284455f, 0.299242f, 0.29067f, 0.218002f, 0.174402f,
+    0.506399f, 0.340989f, 0.325967f, 0.296125f, 0.279119f,
+    0.271631f, 0.268474f, 0.272796f, 0.280574f, 0.295349f,
+    0.286726f, 0.215044f, 0.172035f, 0.505543f, 0.340539f,
+    0.325188f, 0.295698f, 0.27874f, 0.271229f, 0.268085f,
+    0.272403f, 0.28012f, 0.294914f, 0.286265f, 0.214699f,
+    0.171759f, 0.505424f, 0.340487f, 0.325047f, 0.295644f,
+    0.278695f, 0.27118f, 0.268035f, 0.272354f, 0.280056f,
+    0.294858f, 0.286202f, 0.214651f, 0.171721f, 0.0652185f,
+    0.0439356f, 0.0460722f, 0.0444978f, 0.043653f, 0.0434151f,
+    0.042262f, 0.0419762f, 0.0452086f, 0.0465293f, 0.0447674f,
+    0.0335755f, 0.0268604f, 0.0468496f, 0.0310007f, 0.0305784f,
+    0.0285282f, 0.027364f, 0.0279987f, 0.0281898f, 0.0289963f,
+    0.0289953f, 0.0298425f, 0.0282743f, 0.0212383f, 0.0169907f,
+    0.0310464f, 0.0230267f, 0.0204899f, 0.0221824f, 0.0214728f,
+    0.0198066f, 0.0208632f, 0.0195139f, 0.0212583f, 0.0186986f,
+    0.0175199f, 0.0148763f, 0.011901f, 0.0291257f, 0.0177203f,
+    0.0159057f, 0.0161695f, 0.0148658f, 0.014821f, 0.014531f,
+    0.014125f, 0.0136257f, 0.0156682f, 0.0132019f, 0.011296f,
+    0.0090368f, 0.0251424f, 0.0152576f, 0.0131658f, 0.0129399f,
+    0.0117485f, 0.0117319f, 0.011535f, 0.0112499f, 0.0108184f,
+    0.0112859f, 0.00954917f, 0.00716188f, 0.00590337f, 0.0193841f,
+    0.011682f, 0.00967909f, 0.00919654f, 0.00896107f, 0.00827372f,
+    0.00822994f, 0.00809253f, 0.00776902f, 0.00760884f, 0.00646642f,
+    0.00599386f, 0.00479509f, 0.00701055f, 0.00401f, 0.00394323f,
+    0.00357125f, 0.00401513f, 0.00363662f, 0.0035123f, 0.0031647f,
+    0.00289233f, 0.00245478f, 0.00204565f, 0.00336795f, 0.00269436f,
+    0.0857075f, 0.0577383f, 0.0605463f, 0.0584771f, 0.0573671f,
+    0.0570544f, 0.055539f, 0.0551634f, 0.0594112f, 0.0611469f,
+    0.0588315f, 0.0441236f, 0.0352989f, 0.0673386f, 0.0444072f,
+    0.044725f, 0.0417586f, 0.041078f, 0.040717f, 0.0396852f,
+    0.0421835f, 0.0431394f, 0.0439883f, 0.0423383f, 0.0317538f,
+    0.025403f, 0.0507655f, 0.0337217f, 0.0329226f, 0.0307084f,
+    0.0296484f, 0.0303871f, 0.0320663f, 0.0312422f, 0.0322785f,
+    0.0320394f, 0.0301786f, 0.0227935f, 0.0182348f, 0.0345729f,
+    0.0237686f, 0.0208168f, 0.022657f, 0.0220603f, 0.0203722f,
+    0.0216277f, 0.0203254f, 0.021545f, 0.0197062f, 0.0183331f,
+    0.0152804f, 0.0122243f, 0.0305896f, 0.0185622f, 0.0162852f,
+    0.0162557f, 0.0148511f, 0.0148345f, 0.0150497f, 0.0142428f,
+    0.0147246f, 0.015324f, 0.0145481f, 0.0109111f, 0.00872886f,
+    0.0248313f, 0.0149866f, 0.0145697f, 0.0140258f, 0.0137608f,
+    0.013682f, 0.0133214f, 0.0133039f, 0.0142633f, 0.0146722f,
+    0.0141201f, 0.0105901f, 0.00847204f, 0.0204895f, 0.0138029f,
+    0.0144744f, 0.0139794f, 0.0137141f, 0.0136393f, 0.0132771f,
+    0.0131875f, 0.0142028f, 0.0146177f, 0.0140642f, 0.0105481f,
+    0.00843851f, 0.106196f, 0.0715411f, 0.0750203f, 0.0724565f,
+    0.0710811f, 0.0706936f, 0.068816f, 0.0683506f, 0.0736139f,
+    0.0757645f, 0.0728956f, 0.0546717f, 0.0437373f, 0.0878276f,
+    0.0578138f, 0.0588715f, 0.055738f, 0.054792f, 0.0543563f,
+    0.0529622f, 0.0553707f, 0.0573421f, 0.0585472f, 0.0564025f,
+    0.0423018f, 0.0338415f, 0.0712545f, 0.0471282f, 0.0470691f,
+    0.0438966f, 0.0428913f, 0.04266f, 0.0432693f, 0.0444294f,
+    0.0451029f, 0.0461852f, 0.0442427f, 0.033182f, 0.0265456f,
+    0.0511659f, 0.033911f, 0.0341143f, 0.0319752f, 0.0314377f,
+    0.0311681f, 0.0328307f, 0.0320538f, 0.0329225f, 0.0336078f,
+    0.0323972f, 0.0242979f, 0.0194383f, 0.042563f, 0.0283061f,
+    0.0295885f, 0.0283882f, 0.0278614f, 0.0276877f, 0.0269649f,
+    0.0271915f, 0.0289273f, 0.0297209f, 0.0286122f, 0.0214591f,
+    0.0171673f, 0.0412137f, 0.0276946f, 0.0290437f, 0.0280051f,
+    0.0274748f, 0.0273213f, 0.0265984f, 0.0264911f, 0.0284659f,
+    0.0292899f, 0.0281842f, 0.0211381f, 0.0169105f, 0.0409785f,
+    0.0276057f, 0.0289485f, 0.0279588f, 0.0274281f, 0.0272785f,
+    0.0265541f, 0.0263748f, 0.0284054f, 0.0292353f, 0.0281283f,
+    0.0210962f, 0.016877f, 0.126685f, 0.0853439f, 0.0894944f,
+    0.0864359f, 0.0847951f, 0.0843329f, 0.082093f, 0.0815378f,
+    0.0878166f, 0.0903821f, 0.0869597f, 0.0652197f, 0.0521758f,
+    0.108317f, 0.0712203f, 0.073018f, 0.0697173f, 0.068506f,
+    0.0679955f, 0.0662392f, 0.0685579f, 0.0715448f, 0.0731648f,
+    0.0704666f, 0.0528499f, 0.0422799f, 0.0917435f, 0.0605347f,
+    0.0612157f, 0.0575676f, 0.0566053f, 0.0561305f, 0.0547045f,
+    0.0576165f, 0.0593056f, 0.060505f, 0.0583068f, 0.0437301f,
+    0.034984f, 0.0716548f, 0.0473175f, 0.0482608f, 0.0459546f,
+    0.0451517f, 0.0448074f, 0.0440338f, 0.045241f, 0.0471252f,
+    0.0482254f, 0.0464613f, 0.034846f, 0.0278768f, 0.063052f,
+    0.0421089f, 0.0440625f, 0.0423676f, 0.0415754f, 0.0413269f,
+    0.0402419f, 0.0403787f, 0.04313f, 0.0443385f, 0.0426763f,
+    0.0320072f, 0.0256058f, 0.0617027f, 0.0414974f, 0.0435177f,
+    0.0419845f, 0.0411888f, 0.0409605f, 0.0398754f, 0.0396783f,
+    0.0426686f, 0.0439075f, 0.0422483f, 0.0316862f, 0.025349f,
+    0.0614675f, 0.0414084f, 0.0434225f, 0.0419382f, 0.0411421f,
+    0.0409178f, 0.039831f, 0.039562f, 0.0426082f, 0.0438529f,
+    0.0421924f, 0.0316443f, 0.0253154f, 0.167663f, 0.112949f,
+    0.118442f, 0.114395f, 0.112223f, 0.111611f, 0.108647f,
+    0.107912f, 0.116222f, 0.119617f, 0.115088f, 0.0863159f,
+    0.0690527f, 0.149295f, 0.0986426f, 0.101805f, 0.0976761f,
+    0.0959341f, 0.095274f, 0.0927932f, 0.0949323f, 0.0999502f,
+    0.1024f, 0.0985948f, 0.0739461f, 0.0591568f, 0.132721f,
+    0.0873478f, 0.0895088f, 0.0855264f, 0.0840333f, 0.083409f,
+    0.0812585f, 0.083991f, 0.087711f, 0.0897402f, 0.086435f,
+    0.0648262f, 0.051861f, 0.112633f, 0.0743698f, 0.0771672f,
+    0.0739134f, 0.0725797f, 0.0720859f, 0.070216f, 0.0716154f,
+    0.0755305f, 0.0774606f, 0.0745895f, 0.0559421f, 0.0447537f,
+    0.10403f, 0.0697144f, 0.0730105f, 0.0703264f, 0.0690034f,
+    0.0686055f, 0.0667959f, 0.0667531f, 0.0715353f, 0.0735738f,
+    0.0708045f, 0.0531034f, 0.0424827f, 0.102681f, 0.0691029f,
+    0.0724658f, 0.0699433f, 0.0686168f, 0.068239f, 0.0664293f,
+    0.0660527f, 0.071074f, 0.0731427f, 0.0703765f, 0.0527823f,
+    0.0422259f, 0.102446f, 0.069014f, 0.0723706f, 0.069897f,
+    0.0685701f, 0.0681963f, 0.066385f, 0.0659363f, 0.0710135f,
+    0.0730881f, 0.0703205f, 0.0527404f, 0.0421923f, 0.474998f,
+    0.319991f, 0.335553f, 0.324085f, 0.317933f, 0.3162f,
+    0.307802f, 0.30572f, 0.329262f, 0.338881f, 0.326049f,
+    0.244537f, 0.19563f, 0.456629f, 0.305684f, 0.318915f,
+    0.307367f, 0.301644f, 0.299863f, 0.291948f, 0.29274f,
+    0.31299f, 0.321664f, 0.309556f, 0.232167f, 0.185734f,
+    0.440056f, 0.294043f, 0.306554f, 0.295217f, 0.289743f,
+    0.287998f, 0.280413f, 0.281799f, 0.300751f, 0.309004f,
+    0.297396f, 0.223047f, 0.178438f, 0.419968f, 0.281411f,
+    0.294278f, 0.283604f, 0.27829f, 0.276675f, 0.269371f,
+    0.269423f, 0.288571f, 0.296725f, 0.285551f, 0.214163f,
+    0.171331f, 0.411365f, 0.276756f, 0.290121f, 0.280017f,
+    0.274714f, 0.273194f, 0.265951f, 0.264561f, 0.284576f,
+    0.292838f, 0.281766f, 0.211324f, 0.16906f, 0.410016f,
+    0.276144f, 0.289576f, 0.279634f, 0.274327f, 0.272828f,
+    0.265584f, 0.263861f, 0.284114f, 0.292407f, 0.281338f,
+    0.211003f, 0.168803f, 0.40978f, 0.276055f, 0.289481f,
+    0.279588f, 0.27428f, 0.272785f, 0.26554f, 0.263744f,
+    0.284054f, 0.292352f, 0.281282f, 0.210961f, 0.168769f,
+    0.0494019f, 0.0457619f, 0.04489f, 0.0441847f, 0.0434791f,
+    0.0440013f, 0.0423145f, 0.0424452f, 0.0435437f, 0.0438275f,
+    0.0417987f, 0.0313491f, 0.025143f, 0.033442f, 0.0293601f,
+    0.0292825f, 0.0278118f, 0.0285359f, 0.0276546f, 0.0280663f,
+    0.0287998f, 0.0279597f, 0.0292854f, 0.0268524f, 0.0201555f,
+    0.0161764f, 0.029975f, 0.0243424f, 0.0207988f, 0.0211503f,
+    0.020462f, 0.0200342f, 0.02085f, 0.0193639f, 0.022043f,
+    0.0184916f, 0.0167665f, 0.0135429f, 0.0108344f, 0.0269561f,
+    0.0173167f, 0.0165161f, 0.0177611f, 0.0169984f, 0.0161109f,
+    0.0153644f, 0.0152397f, 0.0143352f, 0.0157432f, 0.0131193f,
+    0.0098395f, 0.0078716f, 0.0221984f, 0.014223f, 0.0137639f,
+    0.0144456f, 0.0139028f, 0.0129475f, 0.0123138f, 0.0120093f,
+    0.0110273f, 0.010892f, 0.00907669f, 0.00680751f, 0.00544601f,
+    0.0160907f, 0.0105135f, 0.0102863f, 0.0104455f, 0.0101791f,
+    0.00936708f, 0.00895113f, 0.00869262f, 0.00784513f, 0.00757939f,
+    0.00631616f, 0.00538165f, 0.00430532f, 0.00559501f, 0.00562367f,
+    0.0059616f, 0.00510778f, 0.00487028f, 0.00436381f, 0.00436517f,
+    0.00393815f, 0.00349565f, 0.00292995f, 0.00244162f, 0.00264985f,
+    0.00211988f, 0.064922f, 0.0601384f, 0.0589926f, 0.0580657f,
+    0.0571385f, 0.0578247f, 0.055608f, 0.0557798f, 0.0572233f,
+    0.0575964f, 0.0549302f, 0.0411977f, 0.0330419f, 0.0488062f,
+    0.0432801f, 0.0427174f, 0.0416345f, 0.0408965f, 0.041478f,
+    0.0399279f, 0.0421344f, 0.0416394f, 0.0430543f, 0.0399839f,
+    0.0299879f, 0.0240752f, 0.0393211f, 0.0322877f, 0.0315258f,
+    0.0302189f, 0.0310449f, 0.0295088f, 0.0319849f, 0.0309954f,
+    0.0306225f, 0.031518f, 0.0286995f, 0.021669f, 0.0173352f,
+    0.0322101f, 0.025126f, 0.0213168f, 0.0215435f, 0.0209576f,
+    0.0206619f, 0.0217105f, 0.0202256f, 0.0226019f, 0.0204342f,
+    0.0173988f, 0.0135467f, 0.0108374f, 0.0274525f, 0.0175845f,
+    0.0169525f, 0.0180226f, 0.01734f, 0.0163131f, 0.0155747f,
+    0.0153859f, 0.0150704f, 0.0155831f, 0.01364f, 0.01023f,
+    0.00820857f, 0.0213448f, 0.0144338f, 0.0141625f, 0.0140226f,
+    0.013708f, 0.0138775f, 0.013344f, 0.0134449f, 0.0137486f,
+    0.0138948f, 0.0131932f, 0.00989485f, 0.00793666f, 0.0155201f,
+    0.0143766f, 0.0141027f, 0.0138811f, 0.0136594f, 0.0138235f,
+    0.0132936f, 0.0133349f, 0.0136798f, 0.0137696f, 0.0131316f,
+    0.00984868f, 0.00789897f, 0.0804421f, 0.0745149f, 0.0730952f,
+    0.0719467f, 0.0707979f, 0.0716481f, 0.0689015f, 0.0691143f,
+    0.0709029f, 0.0713652f, 0.0680616f, 0.0510462f, 0.0409408f,
+    0.0642605f, 0.0576566f, 0.0566041f, 0.0554994f, 0.0545068f,
+    0.0553014f, 0.053203f, 0.055469f, 0.055319f, 0.0568231f,
+    0.0531153f, 0.0398365f, 0.0319741f, 0.0512443f, 0.0452317f,
+    0.0449608f, 0.0435058f, 0.0434054f, 0.0433322f, 0.0431199f,
+    0.0443299f, 0.043573f, 0.0452868f, 0.0418309f, 0.0313732f,
+    0.0251914f, 0.0403683f, 0.0331241f, 0.0325425f, 0.0318932f,
+    0.0313164f, 0.0317656f, 0.0328455f, 0.0321004f, 0.0318197f,
+    0.0329446f, 0.0305302f, 0.0228977f, 0.0183818f, 0.0327066f,
+    0.0292494f, 0.0287079f, 0.0282254f, 0.0277535f, 0.0281103f,
+    0.0270273f, 0.0274388f, 0.0279011f, 0.0283297f, 0.0267714f,
+    0.0200786f, 0.0161075f, 0.0311019f, 0.0288104f, 0.0282651f,
+    0.0278162f, 0.0273674f, 0.0277009f, 0.0266374f, 0.0267794f,
+    0.0274282f, 0.0276636f, 0.0263246f, 0.0197435f, 0.0158356f,
+    0.0310402f, 0.0287531f, 0.0282053f, 0.0277622f, 0.0273188f,
+    0.0276469f, 0.0265871f, 0.0266695f, 0.0273595f, 0.0275384f,
+    0.026263f, 0.0196973f, 0.0157979f, 0.0959622f, 0.0888915f,
+    0.0871977f, 0.0858278f, 0.0844572f, 0.0854715f, 0.082195f,
+    0.0824489f, 0.0845826f, 0.0851341f, 0.0811931f, 0.0608948f,
+    0.0488397f, 0.0797149f, 0.0720331f, 0.0707067f, 0.0693641f,
+    0.0681662f, 0.0691248f, 0.0664781f, 0.0688035f, 0.0689986f,
+    0.0705919f, 0.0662468f, 0.049685f, 0.039873f, 0.0666987f,
+    0.0596083f, 0.0585368f, 0.0573706f, 0.0563357f, 0.0571556f,
+    0.0549976f, 0.0576645f, 0.0572526f, 0.0590556f, 0.0549624f,
+    0.0412218f, 0.0330903f, 0.0524528f, 0.0475006f, 0.0466451f,
+    0.045758f, 0.0449507f, 0.045589f, 0.0439805f, 0.0454349f,
+    0.0454993f, 0.0467134f, 0.0436617f, 0.0327463f, 0.0262807f,
+    0.047161f, 0.043626f, 0.0428105f, 0.0421064f, 0.0414129f,
+    0.0419337f, 0.0403208f, 0.0407734f, 0.0415807f, 0.0420986f,
+    0.0399029f, 0.0299272f, 0.0240064f, 0.0466219f, 0.0431869f,
+    0.0423677f, 0.0416972f, 0.0410268f, 0.0415243f, 0.0399309f,
+    0.040114f, 0.0411079f, 0.0414324f, 0.0394561f, 0.0295921f,
+    0.0237345f, 0.0465603f, 0.0431297f, 0.0423079f, 0.0416432f,
+    0.0409782f, 0.0414703f, 0.0398806f, 0.040004f, 0.0410391f,
+    0.0413073f, 0.0393945f, 0.0295459f, 0.0236968f, 0.127002f,
+    0.117644f, 0.115403f, 0.11359f, 0.111776f, 0.113118f,
+    0.108782f, 0.109118f, 0.111942f, 0.112672f, 0.107456f,
+    0.080592f, 0.0646375f, 0.110624f, 0.100786f, 0.0989118f,
+    0.097111f, 0.0954849f, 0.0967716f, 0.0930633f, 0.0954726f,
+    0.0963579f, 0.0981296f, 0.0925098f, 0.0693823f, 0.0556709f,
+    0.0976074f, 0.0883613f, 0.086742f, 0.0851002f, 0.0836309f,
+    0.0848024f, 0.0815478f, 0.0843336f, 0.0846119f, 0.0865933f,
+    0.0812253f, 0.060919f, 0.0488881f, 0.0833616f, 0.0762537f,
+    0.0748503f, 0.0735169f, 0.0722695f, 0.0732358f, 0.0704172f,
+    0.0721041f, 0.0728586f, 0.0742511f, 0.0699246f, 0.0524435f,
+    0.0420785f, 0.078152f, 0.072379f, 0.0710157f, 0.0698685f,
+    0.0687316f, 0.0695806f, 0.0669078f, 0.0674425f, 0.06894f,
+    0.0696362f, 0.0661658f, 0.0496244f, 0.0398042f, 0.0776621f,
+    0.0719399f, 0.0705729f, 0.0694592f, 0.0683455f, 0.0691711f,
+    0.0665179f, 0.0667831f, 0.0684672f, 0.0689701f, 0.065719f,
+    0.0492893f, 0.0395323f, 0.0776004f, 0.0718827f, 0.0705131f,
+    0.0694052f, 0.0682969f, 0.0691171f, 0.0664675f, 0.0666731f,
+    0.0683984f, 0.068845f, 0.0656574f, 0.049243f, 0.0394946f,
+    0.359803f, 0.333292f, 0.326942f, 0.321805f, 0.316667f,
+    0.320469f, 0.308184f, 0.309136f, 0.317136f, 0.319204f,
+    0.304428f, 0.228321f, 0.183121f, 0.342439f, 0.316434f,
+    0.310451f, 0.305326f, 0.300375f, 0.304123f, 0.292466f,
+    0.295491f, 0.301552f, 0.304662f, 0.289482f, 0.217111f,
+    0.174154f, 0.329423f, 0.304009f, 0.298281f, 0.293307f,
+    0.288522f, 0.292154f, 0.280949f, 0.284352f, 0.289806f,
+    0.293126f, 0.278197f, 0.208648f, 0.167372f, 0.315259f,
+    0.291902f, 0.286389f, 0.281732f, 0.27716f, 0.280587f,
+    0.269819f, 0.272123f, 0.278053f, 0.280783f, 0.266896f,
+    0.200172f, 0.160562f, 0.310953f, 0.288027f, 0.282555f,
+    0.278084f, 0.273622f, 0.276932f, 0.26631f, 0.267461f,
+    0.274135f, 0.276169f, 0.263138f, 0.197353f, 0.158288f,
+    0.310463f, 0.287588f, 0.282112f, 0.277675f, 0.273236f,
+    0.276522f, 0.26592f, 0.266802f, 0.273662f, 0.275503f,
+    0.262691f, 0.197018f, 0.158016f, 0.310402f, 0.28753f,
+    0.282052f, 0.277621f, 0.273188f, 0.276468f, 0.26587f,
+    0.266691f, 0.273593f, 0.275377f, 0.262629f, 0.196972f,
+    0.157978f, 0.0508039f, 0.0464069f, 0.0445322f, 0.0441353f,
+    0.0433634f, 0.04306f, 0.041834f, 0.0420922f, 0.0405144f,
+    0.0396498f, 0.0365086f, 0.0274004f, 0.0219257f, 0.031373f,
+    0.0304865f, 0.0284056f, 0.0282248f, 0.0277762f, 0.0272394f,
+    0.0282956f, 0.0281113f, 0.026283f, 0.0268091f, 0.0241162f,
+    0.0181058f, 0.0145551f, 0.0232078f, 0.0227316f, 0.0228787f,
+    0.0229453f, 0.0212118f, 0.0211475f, 0.0211808f, 0.0197004f,
+    0.0221762f, 0.0187105f, 0.0159573f, 0.0121935f, 0.00975483f,
+    0.0189276f, 0.0189625f, 0.0197469f, 0.0191567f, 0.0179807f,
+    0.0168847f, 0.0164854f, 0.0152142f, 0.0143039f, 0.0148414f,
+    0.0123679f, 0.0092759f, 0.00742071f, 0.0142332f, 0.0145441f,
+    0.01548f, 0.0148012f, 0.0137961f, 0.0127929f, 0.0121505f,
+    0.0110371f, 0.010093f, 0.00955214f, 0.00796012f, 0.00700562f,
+    0.00560449f, 0.00942044f, 0.0102946f, 0.010843f, 0.0103017f,
+    0.00964624f, 0.00894543f, 0.00840707f, 0.00759594f, 0.00685317f,
+    0.0064126f, 0.00534382f, 0.00522853f, 0.00418282f, 0.00417861f,
+    0.00665983f, 0.005977f, 0.00581018f, 0.0047544f, 0.00407132f,
+    0.00353571f, 0.00312561f, 0.00279135f, 0.0023049f, 0.00192075f,
+    0.00233202f, 0.00186562f, 0.0667644f, 0.0609861f, 0.0585224f,
+    0.0580008f, 0.0569864f, 0.0565876f, 0.0549765f, 0.0553159f,
+    0.0532425f, 0.0521062f, 0.0479782f, 0.0360085f, 0.0288138f,
+    0.0473335f, 0.0443961f, 0.0417643f, 0.0416478f, 0.0409625f,
+    0.0407671f, 0.039628f, 0.0413349f, 0.0389456f, 0.0392633f,
+    0.0355857f, 0.0267139f, 0.0213896f, 0.0343193f, 0.0328105f,
+    0.0310941f, 0.0306732f, 0.0302196f, 0.0298523f, 0.0323334f,
+    0.030226f, 0.0310988f, 0.0292206f, 0.025861f, 0.0194214f,
+    0.0156607f, 0.02386f, 0.0233352f, 0.0239535f, 0.0237929f,
+    0.0220614f, 0.0220242f, 0.0221015f, 0.0207651f, 0.0232265f,
+    0.0205976f, 0.0171647f, 0.0128735f, 0.0102988f, 0.0183981f,
+    0.0186492f, 0.0196866f, 0.0190221f, 0.0178769f, 0.0167807f,
+    0.0163057f, 0.0150309f, 0.0160489f, 0.0149757f, 0.0124798f,
+    0.00935981f, 0.00748785f, 0.0160038f, 0.0146378f, 0.0150496f,
+    0.0145226f, 0.013727f, 0.0135845f, 0.013281f, 0.0133253f,
+    0.0127943f, 0.0125915f, 0.0115395f, 0.00866086f, 0.00693112f,
+    0.0159605f, 0.0145792f, 0.0139903f, 0.0138656f, 0.0136231f,
+    0.0135278f, 0.0131426f, 0.013224f, 0.0127282f, 0.0124572f,
+    0.0114697f, 0.00860819f, 0.00688823f, 0.0827249f, 0.0755652f,
+    0.0725127f, 0.0718663f, 0.0706095f, 0.0701154f, 0.068119f,
+    0.0685395f, 0.0659704f, 0.0645626f, 0.0594476f, 0.0446166f,
+    0.035702f, 0.0632941f, 0.0585871f, 0.0557545f, 0.0555092f,
+    0.0545855f, 0.0542948f, 0.0527704f, 0.0545586f, 0.0516736f,
+    0.0517197f, 0.0470553f, 0.035322f, 0.0282747f, 0.0493604f,
+    0.0467201f, 0.0435984f, 0.0435295f, 0.0428056f, 0.0426092f,
+    0.0434861f, 0.0434497f, 0.040771f, 0.041393f, 0.0373306f,
+    0.0280253f, 0.0224953f, 0.0362762f, 0.0336935f, 0.0319959f,
+    0.0319115f, 0.0313627f, 0.0311973f, 0.0332542f, 0.0315668f,
+    0.0321492f, 0.0301142f, 0.027124f, 0.0203625f, 0.0163491f,
+    0.0323601f, 0.0296687f, 0.028412f, 0.0282047f, 0.0277148f,
+    0.0275319f, 0.0267353f, 0.0271608f, 0.0259787f, 0.025723f,
+    0.0234809f, 0.0176243f, 0.0141061f, 0.0319643f, 0.0292169f,
+    0.0280274f, 0.0277818f, 0.0273012f, 0.0271122f, 0.0263362f,
+    0.0265489f, 0.0255223f, 0.0250478f, 0.023009f, 0.0172689f,
+    0.0138193f, 0.0319211f, 0.0291584f, 0.0279805f, 0.0277311f,
+    0.0272462f, 0.0270555f, 0.0262851f, 0.0264476f, 0.0254562f,
+    0.0249135f, 0.0229392f, 0.0172163f, 0.0137764f, 0.0986854f,
+    0.0901444f, 0.0865029f, 0.0857319f, 0.0842325f, 0.083643f,
+    0.0812616f, 0.0817632f, 0.0786984f, 0.077019f, 0.0709172f,
+    0.0532247f, 0.0425901f, 0.0792546f, 0.0731662f, 0.0697447f,
+    0.0693706f, 0.0682085f, 0.0678225f, 0.065913f, 0.0677823f,
+    0.0644016f, 0.064176f, 0.0585248f, 0.0439301f, 0.0351628f,
+    0.0653209f, 0.0606297f, 0.0575887f, 0.0573909f, 0.0564286f,
+    0.056137f, 0.0546387f, 0.0566734f, 0.053499f, 0.0538493f,
+    0.0488f, 0.0366333f, 0.0293298f, 0.0522367f, 0.0482251f,
+    0.0459861f, 0.0457729f, 0.0449857f, 0.044725f, 0.0444068f,
+    0.0447905f, 0.0424491f, 0.0425706f, 0.0385935f, 0.0289706f,
+    0.0231924f, 0.0483206f, 0.0442479f, 0.0424022f, 0.0420661f,
+    0.0413378f, 0.0410597f, 0.0398779f, 0.0403844f, 0.0387067f,
+    0.0381794f, 0.0349505f, 0.0262324f, 0.0209942f, 0.0479248f,
+    0.0437961f, 0.0420176f, 0.0416473f, 0.0409242f, 0.0406398f,
+    0.0394787f, 0.0397726f, 0.0382503f, 0.0375042f, 0.0344785f,
+    0.025877f, 0.0207074f, 0.0478816f, 0.0437376f, 0.0419707f,
+    0.0415966f, 0.0408692f, 0.0405832f, 0.0394277f, 0.0396713f,
+    0.0381842f, 0.0373699f, 0.0344087f, 0.0258244f, 0.0206645f,
+    0.130606f, 0.119303f, 0.114483f, 0.113463f, 0.111479f,
+    0.110698f, 0.107547f, 0.108211f, 0.104154f, 0.101932f,
+    0.0938563f, 0.0704408f, 0.0563664f, 0.111176f, 0.102325f,
+    0.0977252f, 0.0970935f, 0.0954546f, 0.0948779f, 0.0921981f,
+    0.0942296f, 0.0898576f, 0.0890887f, 0.0814638f, 0.0611463f,
+    0.0489391f, 0.0972419f, 0.0897317f, 0.0855691f, 0.0851137f,
+    0.0836747f, 0.0831923f, 0.0808321f, 0.0831207f, 0.078955f,
+    0.0787621f, 0.0717391f, 0.0538496f, 0.0431039f, 0.0841578f,
+    0.0773835f, 0.0739665f, 0.0734957f, 0.0722318f, 0.0717804f,
+    0.0697191f, 0.0712377f, 0.0679051f, 0.0674833f, 0.0615325f,
+    0.0461868f, 0.0369687f, 0.0802416f, 0.0734062f, 0.0703827f,
+    0.069789f, 0.0685839f, 0.068115f, 0.0661629f, 0.0668317f,
+    0.0641627f, 0.0630921f, 0.0578895f, 0.0434486f, 0.0347705f,
+    0.0798459f, 0.0729544f, 0.069998f, 0.0693783f, 0.0681702f,
+    0.0676953f, 0.0657637f, 0.0662199f, 0.0637063f, 0.0624169f,
+    0.0574175f, 0.0430932f, 0.0344837f, 0.0798026f, 0.0728959f,
+    0.0699512f, 0.0693277f, 0.0681152f, 0.0676385f, 0.0657127f,
+    0.0661186f, 0.0636401f, 0.0622826f, 0.0573477f, 0.0430405f,
+    0.0344408f, 0.370014f, 0.33799f, 0.324337f, 0.321445f,
+    0.315824f, 0.313614f, 0.304685f, 0.306565f, 0.295074f,
+    0.288777f, 0.265899f, 0.199562f, 0.159689f, 0.350583f,
+    0.321012f, 0.307578f, 0.305015f, 0.2998f, 0.297793f,
+    0.289336f, 0.292584f, 0.280777f, 0.275934f, 0.253507f,
+    0.190268f, 0.152261f, 0.33665f, 0.308419f, 0.295422f,
+    0.293035f, 0.28802f, 0.286108f, 0.27797f, 0.281475f,
+    0.269875f, 0.265607f, 0.243782f, 0.182971f, 0.146426f,
+    0.323565f, 0.296071f, 0.28382f, 0.281417f, 0.276577f,
+    0.274696f, 0.266857f, 0.269593f, 0.258825f, 0.254329f,
+    0.233576f, 0.175308f, 0.140291f, 0.319649f, 0.292094f,
+    0.280236f, 0.27776f, 0.272929f, 0.27103f, 0.263301f,
+    0.265187f, 0.255083f, 0.249938f, 0.229932f, 0.17257f,
+    0.138093f, 0.319254f, 0.291642f, 0.279851f, 0.277361f,
+    0.272516f, 0.270611f, 0.262902f, 0.264575f, 0.254626f,
+    0.249262f, 0.229461f, 0.172215f, 0.137806f, 0.31921f,
+    0.291583f, 0.279804f, 0.27731f, 0.272461f, 0.270554f,
+    0.262851f, 0.264473f, 0.25456f, 0.249128f, 0.229391f,
+    0.172162f, 0.137763f, 0.047666f, 0.0482183f, 0.0439263f,
+    0.0433788f, 0.0424233f, 0.0417215f, 0.0402175f, 0.0386497f,
+    0.0363738f, 0.0342912f, 0.0293409f, 0.0220057f, 0.0176045f,
+    0.0328263f, 0.0303945f, 0.0286893f, 0.0283254f, 0.0273357f,
+    0.0268526f, 0.0290448f, 0.0266626f, 0.0264522f, 0.0238082f,
+    0.0203589f, 0.0152691f, 0.0122153f, 0.0275142f, 0.0264913f,
+    0.0260663f, 0.0246918f, 0.0241179f, 0.0226821f, 0.0219334f,
+    0.0204372f, 0.0219401f, 0.0193692f, 0.016141f, 0.0121058f,
+    0.0096846f, 0.0245907f, 0.0234435f, 0.0195636f, 0.0192042f,
+    0.0179814f, 0.0174941f, 0.0166806f, 0.0154753f, 0.0142304f,
+    0.0141353f, 0.0117794f, 0.0092254f, 0.00738032f, 0.016362f,
+    0.0152227f, 0.0132648f, 0.0125493f, 0.0115783f, 0.0114024f,
+    0.0109012f, 0.00991652f, 0.00892773f, 0.00860721f, 0.00717267f,
+    0.00618767f, 0.00495013f, 0.0102389f, 0.00992659f, 0.0113319f,
+    0.0097952f, 0.0086453f, 0.00795925f, 0.00713393f, 0.00658642f,
+    0.00601021f, 0.00552128f, 0.00460106f, 0.00424289f, 0.00339431f,
+    0.0037953f, 0.00464051f, 0.00577647f, 0.00460486f, 0.00376493f,
+    0.00323523f, 0.00279397f, 0.00246474f, 0.00217317f, 0.00181262f,
+    0.00151052f, 0.00165284f, 0.00132227f, 0.0626407f, 0.0633666f,
+    0.0577261f, 0.0570067f, 0.055751f, 0.0548287f, 0.0528522f,
+    0.0507919f, 0.047801f, 0.0450641f, 0.0385586f, 0.0289189f,
+    0.0231352f, 0.0465125f, 0.0454051f, 0.0412915f, 0.0409354f,
+    0.040231f, 0.0396756f, 0.0403488f, 0.0379387f, 0.0358982f,
+    0.0343904f, 0.0290778f, 0.0218695f, 0.0174956f, 0.0359438f,
+    0.033727f, 0.0342354f, 0.0326303f, 0.0319865f, 0.0301821f,
+    0.0332374f, 0.0306822f, 0.031386f, 0.0263855f, 0.0231449f,
+    0.0173587f, 0.0138869f, 0.0315619f, 0.0301938f, 0.0269399f,
+    0.0255285f, 0.0251223f, 0.0238685f, 0.0227022f, 0.021251f,
+    0.0233229f, 0.0208102f, 0.0173419f, 0.0130064f, 0.0104051f,
+    0.0233333f, 0.021973f, 0.0184565f, 0.0182181f, 0.0171795f,
+    0.0169322f, 0.0163649f, 0.015275f, 0.0165896f, 0.014984f,
+    0.0124867f, 0.00949181f, 0.00759345f, 0.0172102f, 0.0159431f,
+    0.0138488f, 0.0136804f, 0.0133861f, 0.0131615f, 0.0134247f,
+    0.0125726f, 0.013578f, 0.0118981f, 0.00991508f, 0.00754703f,
+    0.00603762f, 0.0149748f, 0.0151483f, 0.0137999f, 0.0136279f,
+    0.0133278f, 0.0131073f, 0.0126348f, 0.0121426f, 0.0114273f,
+    0.0107744f, 0.00921788f, 0.0069134f, 0.00553072f, 0.0776154f,
+    0.0785148f, 0.071526f, 0.0706346f, 0.0690787f, 0.0679359f,
+    0.065487f, 0.0629341f, 0.0592281f, 0.055837f, 0.0477763f,
+    0.0358322f, 0.0286658f, 0.0601986f, 0.0605533f, 0.0550914f,
+    0.0545632f, 0.0535586f, 0.0527828f, 0.0516529f, 0.0500808f,
+    0.0468496f, 0.0451413f, 0.0381891f, 0.0286823f, 0.0229532f,
+    0.0496299f, 0.0474399f, 0.0435415f, 0.0431476f, 0.0420602f,
+    0.0414729f, 0.0445415f, 0.0409272f, 0.040832f, 0.0366291f,
+    0.0313177f, 0.0234882f, 0.0187906f, 0.0385332f, 0.0369441f,
+    0.0351089f, 0.033467f, 0.0329909f, 0.0313686f, 0.0340061f,
+    0.031496f, 0.0327688f, 0.0278266f, 0.0238185f, 0.0178638f,
+    0.0142911f, 0.030422f, 0.0308024f, 0.0280409f, 0.0277138f,
+    0.0271367f, 0.0266838f, 0.0271019f, 0.0251096f, 0.0260355f,
+    0.0224086f, 0.0191552f, 0.0143664f, 0.0114931f, 0.0300028f,
+    0.0303553f, 0.0276487f, 0.0273083f, 0.0267137f, 0.0262687f,
+    0.0253244f, 0.0243848f, 0.0230239f, 0.0217122f, 0.0185083f,
+    0.0138819f, 0.0111055f, 0.0299495f, 0.0302966f, 0.0275997f,
+    0.0272558f, 0.0266555f, 0.0262145f, 0.0252695f, 0.0242848f,
+    0.0228545f, 0.0215473f, 0.0184356f, 0.0138267f, 0.0110614f,
+    0.0925901f, 0.093663f, 0.0853258f, 0.0842624f, 0.0824063f,
+    0.0810431f, 0.0781217f, 0.0750762f, 0.0706553f, 0.0666099f,
+    0.056994f, 0.0427455f, 0.0341964f, 0.0746892f, 0.0757015f,
+    0.0688913f, 0.0681911f, 0.0668863f, 0.0658899f, 0.0637038f,
+    0.062223f, 0.0582768f, 0.0559142f, 0.0474001f, 0.0355916f,
+    0.0284733f, 0.0633161f, 0.0625881f, 0.0569209f, 0.0563956f,
+    0.0553879f, 0.0545802f, 0.0558455f, 0.0520291f, 0.0502779f,
+    0.0472113f, 0.0399857f, 0.0300474f, 0.0240379f, 0.0493153f,
+    0.0499424f, 0.0454293f, 0.0449655f, 0.0441127f, 0.0434162f,
+    0.0453102f, 0.041741f, 0.0422148f, 0.0373952f, 0.0319912f,
+    0.0239934f, 0.0191947f, 0.0453967f, 0.0459506f, 0.0418408f,
+    0.0413417f, 0.0404644f, 0.039791f, 0.0384059f, 0.0370973f,
+    0.0354814f, 0.0331815f, 0.0281701f, 0.0211426f, 0.0169141f,
+    0.0449776f, 0.0455036f, 0.0414485f, 0.0409361f, 0.0400414f,
+    0.0393759f, 0.0379591f, 0.0365269f, 0.034352f, 0.0324851f,
+    0.027726f, 0.0207945f, 0.0166356f, 0.0449242f, 0.0454448f,
+    0.0413996f, 0.0408837f, 0.0399831f, 0.0393217f, 0.0379042f,
+    0.0364269f, 0.0342817f, 0.0323201f, 0.0276533f, 0.02074f,
+    0.016592f, 0.12254f, 0.123959f, 0.112925f, 0.111518f,
+    0.109062f, 0.107257f, 0.103391f, 0.0993606f, 0.0935097f,
+    0.0881557f, 0.0754295f, 0.0565721f, 0.0452577f, 0.104639f,
+    0.105998f, 0.0964909f, 0.0954468f, 0.0935417f, 0.0921044f,
+    0.0889732f, 0.0865074f, 0.081131f, 0.0774599f, 0.0658272f,
+    0.0494124f, 0.0395299f, 0.0916351f, 0.0928845f, 0.0845206f,
+    0.0836514f, 0.0820433f, 0.0807945f, 0.0784535f, 0.0763134f,
+    0.0714357f, 0.0686774f, 0.058131f, 0.0436535f, 0.0349302f,
+    0.0792019f, 0.0802389f, 0.0730289f, 0.0722212f, 0.070768f,
+    0.0696306f, 0.0679182f, 0.0654253f, 0.0612844f, 0.0588f,
+    0.0497689f, 0.0373705f, 0.0299011f, 0.0753461f, 0.0762471f,
+    0.0694404f, 0.0685974f, 0.0671198f, 0.0660054f, 0.0636458f,
+    0.0613816f, 0.0576734f, 0.0547273f, 0.0466056f, 0.0349633f,
+    0.0279706f, 0.074927f, 0.0758f, 0.0690482f, 0.0681919f,
+    0.0666968f, 0.0655903f, 0.0632286f, 0.0608113f, 0.0572063f,
+    0.0540309f, 0.0461614f, 0.0346211f, 0.0276969f, 0.0748736f,
+    0.0757413f, 0.0689993f, 0.0681394f, 0.0666385f, 0.065536f,
+    0.0631737f, 0.0607113f, 0.057136f, 0.053866f, 0.0460887f,
+    0.0345665f, 0.0276532f, 0.34716f, 0.351183f, 0.319923f,
+    0.315936f, 0.308977f, 0.303865f, 0.292912f, 0.281493f,
+    0.264917f, 0.249749f, 0.213695f, 0.160271f, 0.128217f,
+    0.329259f, 0.333221f, 0.303489f, 0.299865f, 0.293457f,
+    0.288712f, 0.278494f, 0.26864f, 0.252539f, 0.239053f,
+    0.204093f, 0.15307f, 0.122456f, 0.316256f, 0.320108f,
+    0.291518f, 0.288069f, 0.281958f, 0.277403f, 0.267618f,
+    0.258446f, 0.242843f, 0.230271f, 0.196379f, 0.147309f,
+    0.117847f, 0.303823f, 0.307462f, 0.280027f, 0.276639f,
+    0.270683f, 0.266239f, 0.256753f, 0.247558f, 0.232692f,
+    0.220394f, 0.188023f, 0.141026f, 0.112821f, 0.299967f,
+    0.303471f, 0.276438f, 0.273015f, 0.267035f, 0.262613f,
+    0.253166f, 0.243514f, 0.229081f, 0.216321f, 0.184871f,
+    0.138654f, 0.110923f, 0.299548f, 0.303023f, 0.276046f,
+    0.27261f, 0.266612f, 0.262198f, 0.252749f, 0.242944f,
+    0.228614f, 0.215624f, 0.184427f, 0.13832f, 0.110656f,
+    0.299494f, 0.302965f, 0.275997f, 0.272557f, 0.266554f,
+    0.262144f, 0.252694f, 0.242844f, 0.228544f, 0.215459f,
+    0.184354f, 0.138266f, 0.110613f, 0.0474572f, 0.0452244f,
+    0.0446628f, 0.0441505f, 0.0418558f, 0.0401713f, 0.0381324f,
+    0.0355425f, 0.0329424f, 0.0280002f, 0.0235226f, 0.0176507f,
+    0.0141257f, 0.0367413f, 0.0329387f, 0.0314695f, 0.0316911f,
+    0.0301556f, 0.0293074f, 0.0308098f, 0.0280296f, 0.0266697f,
+    0.021931f, 0.0182904f, 0.0137178f, 0.0109743f, 0.0301107f,
+    0.0271079f, 0.0265447f, 0.0260427f, 0.0248385f, 0.0239546f,
+    0.0241634f, 0.0224171f, 0.021574f, 0.0183777f, 0.0153147f,
+    0.011486f, 0.00918883f, 0.0191458f, 0.01717f, 0.0167491f,
+    0.0165188f, 0.0159838f, 0.0156162f, 0.0145668f, 0.0136358f,
+    0.0131451f, 0.0122574f, 0.0102145f, 0.00766084f, 0.00612868f,
+    0.00953748f, 0.00943641f, 0.0101549f, 0.0103016f, 0.00934293f,
+    0.00879965f, 0.00803886f, 0.00754531f, 0.0070025f, 0.00668814f,
+    0.00557345f, 0.00420696f, 0.00336557f, 0.00608025f, 0.00646585f,
+    0.00690678f, 0.00705154f, 0.00631564f, 0.00585803f, 0.00526504f,
+    0.00488977f, 0.0044717f, 0.00402844f, 0.00335703f, 0.0027264f,
+    0.00218112f, 0.00213861f, 0.00248747f, 0.00253041f, 0.00261506f,
+    0.00226112f, 0.00201667f, 0.00177938f, 0.00161377f, 0.00144107f,
+    0.00120795f, 0.00100662f, 0.00103045f, 0.00082436f, 0.0623663f,
+    0.059432f, 0.0586941f, 0.0580207f, 0.0550052f, 0.0527915f,
+    0.050112f, 0.0467085f, 0.0432916f, 0.0367967f, 0.0309124f,
+    0.0231959f, 0.0185634f, 0.0503347f, 0.045198f, 0.0430922f,
+    0.0433835f, 0.0412953f, 0.0400985f, 0.0423279f, 0.0383406f,
+    0.0364809f, 0.029715f, 0.0247805f, 0.0186114f, 0.0149134f,
+    0.0420927f, 0.0376677f, 0.0362643f, 0.0365063f, 0.0347997f,
+    0.0339652f, 0.0356815f, 0.032728f, 0.0313852f, 0.0260986f,
+    0.02177f, 0.0163275f, 0.013062f, 0.0299828f, 0.0269511f,
+    0.0264687f, 0.0261682f, 0.0252528f, 0.0246776f, 0.0248473f,
+    0.0232834f, 0.0229563f, 0.0197168f, 0.0164307f, 0.012323f,
+    0.00985839f, 0.0186719f, 0.0167445f, 0.0165823f, 0.0167321f,
+    0.0163728f, 0.0164146f, 0.0169813f, 0.0160965f, 0.0163289f,
+    0.0141476f, 0.0117897f, 0.00884224f, 0.00707379f, 0.0153649f,
+    0.01426f, 0.0140923f, 0.0139235f, 0.0132034f, 0.0130176f,
+    0.0140925f, 0.0132832f, 0.0134657f, 0.0114879f, 0.00957323f,
+    0.00717992f, 0.00574394f, 0.0149091f, 0.0142077f, 0.0140314f,
+    0.0138704f, 0.0131495f, 0.0126203f, 0.0119798f, 0.0111661f,
+    0.0106941f, 0.00879666f, 0.00739085f, 0.00554639f, 0.00443867f,
+    0.0772754f, 0.0736397f, 0.0727253f, 0.071891f, 0.0681546f,
+    0.0654117f, 0.0620917f, 0.0578745f, 0.0536407f, 0.0455932f,
+    0.0383022f, 0.028741f, 0.0230012f, 0.0639281f, 0.0578852f,
+    0.056331f, 0.0556615f, 0.0530338f, 0.0511201f, 0.0538461f,
+    0.0486515f, 0.0462921f, 0.0374989f, 0.0316039f, 0.0240827f,
+    0.0192661f, 0.0556861f, 0.0499269f, 0.0477808f, 0.0481987f,
+    0.0459394f, 0.0447564f, 0.0471997f, 0.0430389f, 0.0411964f,
+    0.0338825f, 0.0282599f, 0.021195f, 0.016956f, 0.0417422f,
+    0.0373757f, 0.0361883f, 0.0365209f, 0.0349432f, 0.0343274f,
+    0.0363654f, 0.0335943f, 0.0327674f, 0.0272925f, 0.0227711f,
+    0.0170783f, 0.0136627f, 0.0320416f, 0.0288785f, 0.0285668f,
+    0.0282126f, 0.026977f, 0.0266033f, 0.0284994f, 0.0264074f,
+    0.0261401f, 0.0216548f, 0.0180717f, 0.0135537f, 0.010843f,
+    0.0298625f, 0.0284677f, 0.0281235f, 0.0277938f, 0.0263528f,
+    0.0252973f, 0.0256107f, 0.0235941f, 0.0232769f, 0.0190879f,
+    0.0159291f, 0.0119468f, 0.00955745f, 0.0298183f, 0.0284154f,
+    0.0280626f, 0.0277406f, 0.0262989f, 0.0252405f, 0.0239594f,
+    0.0223321f, 0.0206984f, 0.0175932f, 0.0147807f, 0.0110915f,
+    0.00887638f, 0.0921845f, 0.0878474f, 0.0867566f, 0.0857613f,
+    0.081304f, 0.0780319f, 0.0740714f, 0.0690405f, 0.0639899f,
+    0.0543897f, 0.0456921f, 0.0342861f, 0.0274389f, 0.0775215f,
+    0.0715999f, 0.0703622f, 0.0695318f, 0.0661687f, 0.0637403f,
+    0.0653642f, 0.0589624f, 0.0561033f, 0.0461312f, 0.0386602f,
+    0.0295539f, 0.0236431f, 0.0692795f, 0.0621862f, 0.0594035f,
+    0.0598912f, 0.0570791f, 0.0555475f, 0.0587178f, 0.0533498f,
+    0.0510076f, 0.0416665f, 0.03475f, 0.0260625f, 0.02085f,
+    0.0553356f, 0.049635f, 0.0476431f, 0.0482133f, 0.0460829f,
+    0.0451186f, 0.0478836f, 0.0439052f, 0.0425786f, 0.0350764f,
+    0.0292611f, 0.0219458f, 0.0175567f, 0.045635f, 0.0430861f,
+    0.042598f, 0.042083f, 0.0399188f, 0.0383462f, 0.0400175f,
+    0.0367183f, 0.0359513f, 0.0294387f, 0.0245617f, 0.0184213f,
+    0.014737f, 0.0447716f, 0.0426753f, 0.0421548f, 0.041664f,
+    0.0395022f, 0.0379175f, 0.0371288f, 0.0339051f, 0.0330881f,
+    0.0268718f, 0.0224191f, 0.0168277f, 0.0134622f, 0.0447274f,
+    0.0426231f, 0.0420939f, 0.0416109f, 0.0394483f, 0.0378606f,
+    0.035939f, 0.0334981f, 0.0310476f, 0.0263897f, 0.0221705f,
+    0.0166366f, 0.0133141f, 0.122003f, 0.116263f, 0.114819f,
+    0.113502f, 0.107603f, 0.103272f, 0.0980307f, 0.0913726f,
+    0.0846883f, 0.0719828f, 0.0604718f, 0.0453764f, 0.0363143f,
+    0.104708f, 0.0994027f, 0.0984247f, 0.0972723f, 0.0924387f,
+    0.0889806f, 0.0884004f, 0.0795842f, 0.0757256f, 0.0636917f,
+    0.0532517f, 0.0404963f, 0.0323971f, 0.0964663f, 0.0877845f,
+    0.0863187f, 0.0852752f, 0.0811398f, 0.0781368f, 0.0817541f,
+    0.0739717f, 0.0706299f, 0.0572344f, 0.0480504f, 0.0365797f,
+    0.0292638f, 0.0825224f, 0.0752255f, 0.0744821f, 0.0735644f,
+    0.0698898f, 0.0672261f, 0.0709198f, 0.0645271f, 0.062201f,
+    0.0506443f, 0.0422411f, 0.0316808f, 0.0253447f, 0.0749814f,
+    0.0715015f, 0.0706605f, 0.0698235f, 0.0662175f, 0.0635866f,
+    0.0630539f, 0.0573401f, 0.0555737f, 0.0450066f, 0.0375654f,
+    0.0285635f, 0.0228508f, 0.0745898f, 0.0710906f, 0.0702173f,
+    0.0694046f, 0.065801f, 0.0631579f, 0.0601651f, 0.0558935f,
+    0.0527104f, 0.0441392f, 0.0370679f, 0.0278866f, 0.0223093f,
+    0.0745456f, 0.0710384f, 0.0701563f, 0.0693514f, 0.0657471f,
+    0.063101f, 0.0598984f, 0.0558302f, 0.051746f, 0.0439827f,
+    0.0369502f, 0.027727f, 0.0221895f, 0.345639f, 0.329378f,
+    0.325288f, 0.321556f, 0.304844f, 0.292575f, 0.277725f,
+    0.258863f, 0.239926f, 0.20393f, 0.171319f, 0.128553f,
+    0.10288f, 0.32771f, 0.312518f, 0.308894f, 0.305327f,
+    0.289658f, 0.278283f, 0.264443f, 0.246716f, 0.22887f,
+    0.195395f, 0.164099f, 0.123457f, 0.0987656f, 0.314729f,
+    0.300203f, 0.296787f, 0.293329f, 0.278313f, 0.26744f,
+    0.254526f, 0.237224f, 0.220122f, 0.188474f, 0.158106f,
+    0.119206f, 0.0953646f, 0.302387f, 0.28834f, 0.284951f,
+    0.281619f, 0.267102f, 0.256529f, 0.243703f, 0.22732f,
+    0.210849f, 0.180305f, 0.151279f, 0.114011f, 0.0912089f,
+    0.298618f, 0.284616f, 0.281129f, 0.277878f, 0.263459f,
+    0.252889f, 0.240096f, 0.223826f, 0.207491f, 0.176595f,
+    0.148413f, 0.111495f, 0.0891957f, 0.298226f, 0.284206f,
+    0.280686f, 0.277459f, 0.263042f, 0.252461f, 0.239654f,
+    0.223384f, 0.207049f, 0.176001f, 0.147915f, 0.111011f,
+    0.088838f, 0.298182f, 0.284153f, 0.280625f, 0.277406f,
+    0.262988f, 0.252404f, 0.239593f, 0.22332f, 0.206984f,
+    0.17593f, 0.147798f, 0.110904f, 0.0887554f, 0.0455238f,
+    0.0454714f, 0.044587f, 0.0433113f, 0.0415851f, 0.0391036f,
+    0.0369835f, 0.0341737f, 0.0313121f, 0.0258359f, 0.0216004f,
+    0.0162459f, 0.0129967f, 0.0325094f, 0.0369844f, 0.035275f,
+    0.033573f, 0.0327028f, 0.0308588f, 0.0324764f, 0.0289811f,
+    0.0258073f, 0.0210473f, 0.0175642f, 0.0131731f, 0.0105385f,
+    0.0269984f, 0.0306152f, 0.0293998f, 0.0280774f, 0.0274824f,
+    0.0260361f, 0.0268236f, 0.0243861f, 0.021901f, 0.0180453f,
+    0.0150718f, 0.0113038f, 0.00904306f, 0.0150504f, 0.0169259f,
+    0.0167049f, 0.0162966f, 0.0164675f, 0.0160943f, 0.0166307f,
+    0.015891f, 0.0146038f, 0.0123883f, 0.0103739f, 0.00778044f,
+    0.00622435f, 0.00939777f, 0.00800247f, 0.00728996f, 0.00713667f,
+    0.00672852f, 0.00718912f, 0.00804789f, 0.00846478f, 0.00813176f,
+    0.0073279f, 0.00617422f, 0.00463066f, 0.00370453f, 0.00648871f,
+    0.00533088f, 0.00449844f, 0.00460353f, 0.00425736f, 0.00401487f,
+    0.00425736f, 0.00497951f, 0.00502043f, 0.00485912f, 0.00412892f,
+    0.00309669f, 0.00247735f, 0.00292543f, 0.00211597f, 0.00171607f,
+    0.00163478f, 0.0015308f, 0.00140013f, 0.00128309f, 0.00132f,
+    0.00154703f, 0.00193644f, 0.00171712f, 0.00128784f, 0.00103027f,
+    0.0598255f, 0.0597567f, 0.0585943f, 0.056918f, 0.0546494f,
+    0.0513883f, 0.0486022f, 0.0449096f, 0.0411492f, 0.0339526f,
+    0.0283864f, 0.0213497f, 0.0170797f, 0.0441023f, 0.0496183f,
+    0.0473006f, 0.0450414f, 0.0439122f, 0.0414837f, 0.0440951f,
+    0.0392037f, 0.0348526f, 0.0283697f, 0.0237769f, 0.0178326f,
+    0.0142661f, 0.0380678f, 0.0432491f, 0.0414253f, 0.0395459f,
+    0.0386918f, 0.036661f, 0.0384423f, 0.0346087f, 0.0309463f,
+    0.0253677f, 0.0211789f, 0.0158842f, 0.0127073f, 0.0261198f,
+    0.0295598f, 0.0287304f, 0.027765f, 0.0276769f, 0.0267192f,
+    0.0282495f, 0.0261137f, 0.0236491f, 0.0197108f, 0.0164811f,
+    0.0123608f, 0.00988863f, 0.0169086f, 0.018199f, 0.0179278f,
+    0.0175666f, 0.0179379f, 0.0178141f, 0.0196666f, 0.0186874f,
+    0.017177f, 0.0146504f, 0.0122813f, 0.00921102f, 0.00736881f,
+    0.0143515f, 0.0143931f, 0.0140924f, 0.0137565f, 0.0140308f,
+    0.0140066f, 0.0158761f, 0.0152022f, 0.0140657f, 0.0121816f,
+    0.0102361f, 0.00767704f, 0.00614163f, 0.0143018f, 0.0142853f,
+    0.0140075f, 0.0136067f, 0.0130644f, 0.0122848f, 0.0124189f,
+    0.0115427f, 0.0105923f, 0.0092589f, 0.00782425f, 0.00586819f,
+    0.00469455f, 0.0741272f, 0.0740419f, 0.0726018f, 0.0705246f,
+    0.0677138f, 0.063673f, 0.0602209f, 0.0556457f, 0.0509862f,
+    0.0420692f, 0.0351724f, 0.0264535f, 0.0211628f, 0.0580914f,
+    0.0622522f, 0.0593261f, 0.0565099f, 0.0551217f, 0.0521087f,
+    0.0557139f, 0.0494264f, 0.0439882f, 0.0360641f, 0.0302378f,
+    0.0227446f, 0.0181957f, 0.0491373f, 0.0558829f, 0.0534509f,
+    0.0510143f, 0.0499012f, 0.047286f, 0.050061f, 0.0448313f,
+    0.0399916f, 0.0326902f, 0.027286f, 0.0204645f, 0.0163716f,
+    0.0371893f, 0.0421937f, 0.0407559f, 0.0392335f, 0.0388863f,
+    0.0373442f, 0.0398682f, 0.0363363f, 0.0326944f, 0.0270332f,
+    0.0225882f, 0.0169411f, 0.0135529f, 0.0290572f, 0.0308329f,
+    0.0299533f, 0.0290351f, 0.0291474f, 0.028439f, 0.0312853f,
+    0.0289101f, 0.0262223f, 0.0219728f, 0.0183885f, 0.0137914f,
+    0.0110331f, 0.0286532f, 0.0286185f, 0.0280658f, 0.0272685f,
+    0.0261844f, 0.0246315f, 0.0274948f, 0.0254248f, 0.023111f,
+    0.019504f, 0.0163432f, 0.0122574f, 0.00980591f, 0.0286035f,
+    0.0285706f, 0.0280149f, 0.0272134f, 0.0261288f, 0.0245696f,
+    0.0240376f, 0.0217653f, 0.0196741f, 0.0165814f, 0.0139314f,
+    0.0104486f, 0.00835883f, 0.0884289f, 0.0883272f, 0.0866092f,
+    0.0841313f, 0.0807781f, 0.0759578f, 0.0718396f, 0.0663816f,
+    0.0608232f, 0.0501859f, 0.0419584f, 0.0315573f, 0.0252458f,
+    0.0720805f, 0.0748861f, 0.0713516f, 0.0682987f, 0.0663311f,
+    0.0627336f, 0.0673326f, 0.0596491f, 0.0534489f, 0.0437808f,
+    0.0366987f, 0.0276804f, 0.0221443f, 0.0604757f, 0.0685169f,
+    0.0654764f, 0.0624828f, 0.0611106f, 0.0579109f, 0.0616797f,
+    0.055054f, 0.0490369f, 0.0400127f, 0.0333931f, 0.0250449f,
+    0.0200359f, 0.0482587f, 0.0548276f, 0.0527814f, 0.0507019f,
+    0.0500957f, 0.0479691f, 0.0514869f, 0.046559f, 0.0417396f,
+    0.0343557f, 0.0286953f, 0.0215215f, 0.0172172f, 0.0433589f,
+    0.0434668f, 0.0424797f, 0.0412985f, 0.0403568f, 0.0390639f,
+    0.042904f, 0.0391328f, 0.0352676f, 0.0292953f, 0.0244956f,
+    0.0183717f, 0.0146974f, 0.042955f, 0.0429038f, 0.0420733f,
+    0.0408752f, 0.0392488f, 0.0369129f, 0.0391135f, 0.0356475f,
+    0.0321563f, 0.0268265f, 0.0224503f, 0.0168377f, 0.0134702f,
+    0.0429052f, 0.0428558f, 0.0420223f, 0.04082f, 0.0391931f,
+    0.0368543f, 0.0356564f, 0.032208f, 0.0295111f, 0.0243536f,
+    0.0203589f, 0.0153163f, 0.012253f, 0.117032f, 0.116898f,
+    0.114624f, 0.111345f, 0.106907f, 0.100527f, 0.095077f,
+    0.0878536f, 0.0804973f, 0.0664191f, 0.0555304f, 0.0417648f,
+    0.0334119f, 0.100059f, 0.100154f, 0.0980451f, 0.095512f,
+    0.0919388f, 0.086752f, 0.0905699f, 0.0800945f, 0.0723704f,
+    0.0592143f, 0.0497407f, 0.0375664f, 0.0300873f, 0.0884539f,
+    0.0937846f, 0.0895274f, 0.0854196f, 0.0835294f, 0.0791608f,
+    0.0849171f, 0.0754994f, 0.0671274f, 0.054919f, 0.0460603f,
+    0.034617f, 0.0276936f, 0.0758126f, 0.0800954f, 0.0768325f,
+    0.0736388f, 0.0725145f, 0.069219f, 0.0747243f, 0.0670043f,
+    0.0598302f, 0.0490006f, 0.0409096f, 0.0306822f, 0.0245458f,
+    0.0719624f, 0.071865f, 0.0704946f, 0.0685118f, 0.0658029f,
+    0.0619161f, 0.0661414f, 0.0595781f, 0.0533582f, 0.0439402f,
+    0.0367099f, 0.0275324f, 0.0220259f, 0.0715584f, 0.0714743f,
+    0.0700881f, 0.0680884f, 0.0653775f, 0.0614824f, 0.0623509f,
+    0.0560928f, 0.0502468f, 0.0414714f, 0.0346646f, 0.0259984f,
+    0.0207988f, 0.0715086f, 0.0714264f, 0.0700371f, 0.0680333f,
+    0.0653218f, 0.0614238f, 0.0588938f, 0.05368f, 0.0491851f,
+    0.0405868f, 0.0339309f, 0.0255238f, 0.0204191f, 0.331558f,
+    0.331177f, 0.324735f, 0.315444f, 0.302872f, 0.284798f,
+    0.269358f, 0.248893f, 0.228052f, 0.188168f, 0.15732f,
+    0.118322f, 0.0946574f, 0.314512f, 0.31402f, 0.308156f,
+    0.299612f, 0.287904f, 0.271023f, 0.264851f, 0.237404f,
+    0.217717f, 0.18085f, 0.151334f, 0.113842f, 0.0910738f,
+    0.302104f, 0.301605f, 0.296017f, 0.287861f, 0.276649f,
+    0.260493f, 0.259198f, 0.228839f, 0.209451f, 0.174583f,
+    0.146285f, 0.110074f, 0.0880589f, 0.2902f, 0.289785f,
+    0.284295f, 0.27633f, 0.265447f, 0.249803f, 0.249005f,
+    0.220344f, 0.200562f, 0.166992f, 0.139917f, 0.105293f,
+    0.0842344f, 0.286488f, 0.286144f, 0.280606f, 0.272612f,
+    0.261768f, 0.246187f, 0.240422f, 0.215242f, 0.197261f,
+    0.163367f, 0.136636f, 0.10279f, 0.0822323f, 0.286084f,
+    0.285753f, 0.280199f, 0.272188f, 0.261343f, 0.245753f,
+    0.236631f, 0.214787f, 0.19681f, 0.162569f, 0.135829f,
+    0.102265f, 0.0818123f, 0.286034f, 0.285705f, 0.280148f,
+    0.272133f, 0.261287f, 0.245695f, 0.233174f, 0.21472f,
+    0.19674f, 0.162336f, 0.135721f, 0.102081f, 0.0816646f,
+    0.198271f, 0.104413f, 0.101044f, 0.0950233f, 0.0850957f,
+    0.0789828f, 0.065819f, 0.0593012f, 0.0592938f, 0.0533946f,
+    0.0525693f, 0.0403312f, 0.0330122f, 0.17864f, 0.10784f,
+    0.0783259f, 0.0721217f, 0.0631465f, 0.0617197f, 0.0514331f,
+    0.0440855f, 0.0385748f, 0.0347225f, 0.0348188f, 0.0261141f,
+    0.0216408f, 0.214412f, 0.126521f, 0.0632606f, 0.0667638f,
+    0.0500728f, 0.0439759f, 0.0366466f, 0.0314113f, 0.0292959f,
+    0.0292811f, 0.0247497f, 0.0191592f, 0.0156967f, 0.243194f,
+    0.137533f, 0.0687664f, 0.0688953f, 0.0516715f, 0.0413372f,
+    0.0344476f, 0.0295266f, 0.0258357f, 0.0288683f, 0.0240569f,
+    0.0180427f, 0.0144342f, 0.21943f, 0.117268f, 0.0586341f,
+    0.0550013f, 0.041251f, 0.0330008f, 0.0275007f, 0.023572f,
+    0.0206255f, 0.021638f, 0.0180316f, 0.0135237f, 0.010819f,
+    0.173708f, 0.0884305f, 0.0442152f, 0.0393091f, 0.0294819f,
+    0.0235855f, 0.0196546f, 0.0168468f, 0.0147409f, 0.0146353f,
+    0.0121961f, 0.00914708f, 0.00733052f, 0.06032f, 0.0273886f,
+    0.0136943f, 0.010803f, 0.00810229f, 0.00648183f, 0.00540152f,
+    0.00462988f, 0.00405114f, 0.00466534f, 0.00389684f, 0.00292263f,
+    0.00293252f, 0.260559f, 0.137215f, 0.132788f, 0.124876f,
+    0.111829f, 0.103796f, 0.0864967f, 0.0779312f, 0.0779215f,
+    0.070169f, 0.0690844f, 0.0530016f, 0.0433832f, 0.220414f,
+    0.133665f, 0.11007f, 0.101974f, 0.0898801f, 0.0865329f,
+    0.0721108f, 0.0618092f, 0.0560792f, 0.0504503f, 0.0493898f,
+    0.0384539f, 0.0320119f, 0.256186f, 0.152346f, 0.0868896f,
+    0.0812271f, 0.0697182f, 0.0687891f, 0.0573242f, 0.049135f,
+    0.0429932f, 0.0385267f, 0.0384004f, 0.0288003f, 0.0232586f,
+    0.284967f, 0.163358f, 0.0816788f, 0.0833586f, 0.062519f,
+    0.0500152f, 0.0416793f, 0.0357251f, 0.0312595f, 0.0355207f,
+    0.0296006f, 0.0222005f, 0.0177604f, 0.261203f, 0.143093f,
+    0.0715465f, 0.0694646f, 0.0520985f, 0.0416788f, 0.0347323f,
+    0.0297706f, 0.0260492f, 0.0282904f, 0.0235753f, 0.0176815f,
+    0.0141452f, 0.215481f, 0.114255f, 0.0571277f, 0.0537725f,
+    0.0403293f, 0.0322635f, 0.0268862f, 0.0230453f, 0.0201647f,
+    0.0212877f, 0.0177398f, 0.0133048f, 0.0106439f, 0.102094f,
+    0.0532135f, 0.0317557f, 0.0298697f, 0.0267465f, 0.0248307f,
+    0.0206922f, 0.0186301f, 0.0186279f, 0.0167745f, 0.0165152f,
+    0.0126704f, 0.0103713f, 0.322848f, 0.170017f, 0.164532f,
+    0.154728f, 0.138563f, 0.128609f, 0.107174f, 0.0965613f,
+    0.0965493f, 0.0869435f, 0.0855995f, 0.0656721f, 0.0537543f,
+    0.262188f, 0.15949f, 0.141814f, 0.131827f, 0.116614f,
+    0.111346f, 0.0927884f, 0.0795329f, 0.0747069f, 0.0672247f,
+    0.0659049f, 0.0510964f, 0.042383f, 0.297959f, 0.178171f,
+    0.118634f, 0.109937f, 0.0964518f, 0.0936022f, 0.0780019f,
+    0.0668588f, 0.0586581f, 0.0527428f, 0.052946f, 0.0402174f,
+    0.0336296f, 0.326741f, 0.189183f, 0.0945913f, 0.0978219f,
+    0.0733665f, 0.0683974f, 0.0569979f, 0.0488553f, 0.0430142f,
+    0.0421731f, 0.0385243f, 0.0293446f, 0.0245442f, 0.302977f,
+    0.168918f, 0.084459f, 0.083928f, 0.062946f, 0.0542368f,
+    0.0451973f, 0.0387406f, 0.0379438f, 0.0349428f, 0.0335594f,
+    0.0257529f, 0.0212688f, 0.257255f, 0.14008f, 0.0700401f,
+    0.0682358f, 0.0544602f, 0.0508019f, 0.0423349f, 0.0373416f,
+    0.0373416f, 0.0336144f, 0.0330881f, 0.0253761f, 0.0208177f,
+    0.143867f, 0.0790384f, 0.0634997f, 0.0597221f, 0.0534801f,
+    0.0496438f, 0.0413699f, 0.0372601f, 0.0372556f, 0.0335489f,
+    0.0330303f, 0.0253409f, 0.0207423f, 0.385136f, 0.202819f,
+    0.196277f, 0.184581f, 0.165296f, 0.153422f, 0.127852f,
+    0.115191f, 0.115177f, 0.103718f, 0.102115f, 0.0783425f,
+    0.0641254f, 0.308414f, 0.185315f, 0.173558f, 0.161679f,
+    0.143347f, 0.136159f, 0.113466f, 0.0972567f, 0.0933346f,
+    0.0839992f, 0.08242f, 0.0637389f, 0.0527541f, 0.339733f,
+    0.203996f, 0.150378f, 0.13979f, 0.123185f, 0.118415f,
+    0.0986795f, 0.0845824f, 0.0772858f, 0.0695172f, 0.0681043f,
+    0.0528599f, 0.0440007f, 0.368515f, 0.215007f, 0.117935f,
+    0.112285f, 0.0973086f, 0.0932106f, 0.0776755f, 0.066579f,
+    0.0616419f, 0.0554245f, 0.0543712f, 0.0419872f, 0.0349153f,
+    0.344751f, 0.194743f, 0.100366f, 0.0983913f, 0.0841809f,
+    0.07905f, 0.065875f, 0.0565887f, 0.0565715f, 0.0509032f,
+    0.0500745f, 0.0383955f, 0.0316399f, 0.299029f, 0.165905f,
+    0.0964099f, 0.0908611f, 0.0811938f, 0.0756151f, 0.0630126f,
+    0.0559717f, 0.0559693f, 0.0503888f, 0.0496033f, 0.0380466f,
+    0.0311887f, 0.186866f, 0.104863f, 0.0952438f, 0.0895746f,
+    0.0802137f, 0.074457f, 0.0620475f, 0.0558902f, 0.0558833f,
+    0.0503233f, 0.0495454f, 0.0380113f, 0.0311134f, 0.509713f,
+    0.268423f, 0.259765f, 0.244285f, 0.218764f, 0.203049f,
+    0.169207f, 0.152451f, 0.152432f, 0.137267f, 0.135145f,
+    0.103683f, 0.0848675f, 0.432991f, 0.244539f, 0.237046f,
+    0.221384f, 0.196814f, 0.185786f, 0.154821f, 0.132704f,
+    0.13059f, 0.117548f, 0.11545f, 0.0890239f, 0.0734962f,
+    0.42328f, 0.255646f, 0.213866f, 0.199495f, 0.176653f,
+    0.168042f, 0.140035f, 0.12003f, 0.114541f, 0.103066f,
+    0.101135f, 0.078145f, 0.0647428f, 0.452062f, 0.266657f,
+    0.181423f, 0.170142f, 0.150776f, 0.142837f, 0.119031f,
+    0.102026f, 0.0988974f, 0.0889733f, 0.0874015f, 0.0672722f,
+    0.0556574f, 0.428298f, 0.246393f, 0.163855f, 0.15436f,
+    0.137648f, 0.128676f, 0.10723f, 0.0938487f, 0.0938269f,
+    0.084452f, 0.0831048f, 0.0637241f, 0.052382f, 0.382576f,
+    0.217555f, 0.159898f, 0.150566f, 0.134661f, 0.125241f,
+    0.104368f, 0.0932317f, 0.0932247f, 0.0839376f, 0.0826335f,
+    0.0633874f, 0.0519309f, 0.311443f, 0.164011f, 0.158732f,
+    0.149279f, 0.133681f, 0.124083f, 0.103403f, 0.0931502f,
+    0.0931387f, 0.0838722f, 0.0825757f, 0.0633521f, 0.0518556f,
+    1.44404f, 0.760456f, 0.735925f, 0.692072f, 0.619768f,
+    0.575247f, 0.479372f, 0.431902f, 0.431848f, 0.388883f,
+    0.382872f, 0.29374f, 0.240434f, 1.36732f, 0.734629f,
+    0.713207f, 0.669171f, 0.597818f, 0.557984f, 0.464986f,
+    0.41036f, 0.410006f, 0.369164f, 0.363177f, 0.278779f,
+    0.229062f, 1.31265f, 0.710533f, 0.690026f, 0.647281f,
+    0.577657f, 0.54024f, 0.4502f, 0.394352f, 0.393957f,
+    0.354682f, 0.348861f, 0.267783f, 0.220309f, 1.26194f,
+    0.676232f, 0.657583f, 0.617928f, 0.55178f, 0.515035f,
+    0.429196f, 0.37852f, 0.378313f, 0.34059f, 0.335128f,
+    0.257075f, 0.211224f, 1.24726f, 0.658001f, 0.640015f,
+    0.602147f, 0.538652f, 0.500874f, 0.417395f, 0.373299f,
+    0.373243f, 0.336068f, 0.330832f, 0.25378f, 0.207948f,
+    1.2459f, 0.656252f, 0.636059f, 0.598353f, 0.535665f,
+    0.497439f, 0.414533f, 0.372682f, 0.37264f, 0.335554f,
+    0.33036f, 0.253444f, 0.207497f, 1.24577f, 0.656043f,
+    0.634892f, 0.597066f, 0.534685f, 0.496281f, 0.413568f,
+    0.372601f, 0.372554f, 0.335488f, 0.330303f, 0.253408f,
+    0.207422f, 0.134423f, 0.114061f, 0.0932469f, 0.0813467f,
+    0.06101f, 0.0572304f, 0.0528743f, 0.0505718f, 0.0526567f,
+    0.0547622f, 0.0513167f, 0.0397854f, 0.0318283f, 0.0882098f,
+    0.0838633f, 0.068867f, 0.058971f, 0.0442283f, 0.0409726f,
+    0.0375549f, 0.0335576f, 0.0376334f, 0.0345148f, 0.0323876f,
+    0.0252803f, 0.0202242f, 0.0521307f, 0.0562815f, 0.0524373f,
+    0.0393655f, 0.0337547f, 0.0342441f, 0.0285367f, 0.0269174f,
+    0.0276984f, 0.0233768f, 0.0203208f, 0.0193146f, 0.0154517f,
+    0.0504239f, 0.0415965f, 0.0542827f, 0.0400749f, 0.0335857f,
+    0.0333678f, 0.0278065f, 0.0259879f, 0.0244559f, 0.0208523f,
+    0.017377f, 0.0133917f, 0.0120863f, 0.0369472f, 0.0313418f,
+    0.0435124f, 0.0314105f, 0.0255656f, 0.024609f, 0.0205075f,
+    0.018897f, 0.0175064f, 0.0148848f, 0.012404f, 0.00930297f,
+    0.0105857f, 0.0237337f, 0.0207177f, 0.0312057f, 0.0221055f,
+    0.0175803f, 0.016415f, 0.0136792f, 0.0124333f, 0.0113612f,
+    0.00961577f, 0.00801314f, 0.00600986f, 0.00832366f, 0.00408425f,
+    0.0039423f, 0.00865221f, 0.00589521f, 0.00449549f, 0.00387645f,
+    0.00323038f, 0.00283594f, 0.00367802f, 0.00294257f, 0.00245219f,
+    0.00183914f, 0.00290632f, 0.176653f, 0.149895f, 0.122541f,
+    0.106902f, 0.0801768f, 0.0752099f, 0.0694852f, 0.0664594f,
+    0.0691993f, 0.0719662f, 0.0674383f, 0.0522843f, 0.0418274f,
+    0.13044f, 0.119697f, 0.0981614f, 0.0845268f, 0.0633951f,
+    0.058952f, 0.0538855f, 0.0481797f, 0.0532357f, 0.0517188f,
+    0.0485092f, 0.0377792f, 0.0302234f, 0.0943609f, 0.092115f,
+    0.0758706f, 0.0647146f, 0.048536f, 0.0448065f, 0.0411365f,
+    0.036725f, 0.0414472f, 0.036874f, 0.0345998f, 0.027253f,
+    0.0218024f, 0.061842f, 0.0574298f, 0.0656017f, 0.0487249f,
+    0.0411934f, 0.0412429f, 0.0343691f, 0.0322323f, 0.0307046f,
+    0.0259823f, 0.0216519f, 0.0191584f, 0.0158394f, 0.0483652f,
+    0.04065f, 0.0548314f, 0.0400606f, 0.0331733f, 0.0324842f,
+    0.0270701f, 0.0251414f, 0.0235187f, 0.0200147f, 0.0167016f,
+    0.0129832f, 0.0126624f, 0.04243f, 0.0370372f, 0.0425246f,
+    0.0307556f, 0.0251881f, 0.0242901f, 0.0202418f, 0.0186777f,
+    0.0183733f, 0.017281f, 0.0161928f, 0.0125622f, 0.0104004f,
+    0.0422303f, 0.0358515f, 0.0293075f, 0.0255648f, 0.0191736f,
+    0.0179849f, 0.0166112f, 0.0158876f, 0.0165427f, 0.0172042f,
+    0.0161217f, 0.0124991f, 0.00999927f, 0.218883f, 0.185728f,
+    0.151836f, 0.132458f, 0.0993437f, 0.0931893f, 0.0860961f,
+    0.082347f, 0.0857419f, 0.0891703f, 0.0835599f, 0.0647832f,
+    0.0518266f, 0.17267f, 0.15553f, 0.127456f, 0.110083f,
+    0.082562f, 0.0769315f, 0.0702161f, 0.0632449f, 0.068838f,
+    0.0689229f, 0.0646308f, 0.0502781f, 0.0402225f, 0.136591f,
+    0.127948f, 0.105165f, 0.0902704f, 0.0677028f, 0.0627859f,
+    0.0574671f, 0.0513471f, 0.0570494f, 0.0540781f, 0.0507215f,
+    0.0395298f, 0.0316239f, 0.0991683f, 0.0932632f, 0.0769206f,
+    0.0659053f, 0.049429f, 0.049118f, 0.0418746f, 0.0384768f,
+    0.0413338f, 0.0396618f, 0.0371828f, 0.0289548f, 0.0231638f,
+    0.0862207f, 0.0764834f, 0.0661503f, 0.0543062f, 0.0407811f,
+    0.0403593f, 0.034575f, 0.0322395f, 0.0337459f, 0.0350277f,
+    0.0328232f, 0.0254821f, 0.0203857f, 0.0846602f, 0.0728707f,
+    0.0596046f, 0.0518637f, 0.0388978f, 0.0364223f, 0.0333196f,
+    0.031822f, 0.0331651f, 0.0344851f, 0.0323144f, 0.0250612f,
+    0.0200489f, 0.0844605f, 0.0716849f, 0.0586018f, 0.0511206f,
+    0.0383404f, 0.0359643f, 0.0332221f, 0.0317752f, 0.0330853f,
+    0.0344082f, 0.0322434f, 0.024998f, 0.0199984f, 0.261113f,
+    0.221562f, 0.18113f, 0.158014f, 0.118511f, 0.111169f,
+    0.102707f, 0.0982346f, 0.102284f, 0.106374f, 0.0996815f,
+    0.0772822f, 0.0618257f, 0.2149f, 0.191364f, 0.15675f,
+    0.135638f, 0.101729f, 0.0949109f, 0.0865467f, 0.0791325f,
+    0.0844402f, 0.0861269f, 0.0807524f, 0.0627771f, 0.0502217f,
+    0.178821f, 0.163782f, 0.134459f, 0.115826f, 0.0868697f,
+    0.0807654f, 0.0737977f, 0.0659692f, 0.0726517f, 0.0712821f,
+    0.0668431f, 0.0520288f, 0.041623f, 0.141398f, 0.129097f,
+    0.106118f, 0.0914612f, 0.0685959f, 0.0637618f, 0.0582052f,
+    0.0521472f, 0.0569361f, 0.0568658f, 0.0533045f, 0.0414537f,
+    0.033163f, 0.128451f, 0.112317f, 0.0920209f, 0.079862f,
+    0.0598965f, 0.055967f, 0.0509056f, 0.0481271f, 0.0502885f,
+    0.0522318f, 0.0489448f, 0.0379811f, 0.0303848f, 0.12689f,
+    0.108704f, 0.088899f, 0.0774195f, 0.0580646f, 0.0544018f,
+    0.0499306f, 0.0477096f, 0.0497077f, 0.0516891f, 0.048436f,
+    0.0375601f, 0.0300481f, 0.126691f, 0.107518f, 0.0878962f,
+    0.0766764f, 0.0575073f, 0.0539438f, 0.0498331f, 0.0476628f,
+    0.0496279f, 0.0516123f, 0.048365f, 0.037497f, 0.0299976f,
+    0.345574f, 0.293229f, 0.239719f, 0.209126f, 0.156844f,
+    0.147128f, 0.135929f, 0.13001f, 0.13537f, 0.140782f,
+    0.131925f, 0.10228f, 0.081824f, 0.299361f, 0.263031f,
+    0.215339f, 0.18675f, 0.140063f, 0.13087f, 0.119208f,
+    0.110908f, 0.116832f, 0.120535f, 0.112996f, 0.0877749f,
+    0.0702199f, 0.263282f, 0.235449f, 0.193048f, 0.166938f,
+    0.125203f, 0.116724f, 0.106459f, 0.0970768f, 0.103856f,
+    0.10569f, 0.0990863f, 0.0770267f, 0.0616213f, 0.225859f,
+    0.200764f, 0.164706f, 0.142573f, 0.10693f, 0.0997207f,
+    0.0908664f, 0.0839224f, 0.0882277f, 0.0912739f, 0.0855477f,
+    0.0664516f, 0.0531613f, 0.212911f, 0.183984f, 0.15061f,
+    0.130974f, 0.0982302f, 0.0919259f, 0.0837652f, 0.0799024f,
+    0.0833737f, 0.0866399f, 0.0811881f, 0.0629789f, 0.0503831f,
+    0.211351f, 0.180371f, 0.147488f, 0.128531f, 0.0963983f,
+    0.0903607f, 0.0831524f, 0.0794848f, 0.0827929f, 0.0860972f,
+    0.0806792f, 0.062558f, 0.0500464f, 0.211151f, 0.179185f,
+    0.146485f, 0.127788f, 0.095841f, 0.0899027f, 0.0830549f,
+    0.0794381f, 0.0827131f, 0.0860204f, 0.0806082f, 0.0624948f,
+    0.0499959f, 0.979026f, 0.830731f, 0.679134f, 0.592463f,
+    0.444347f, 0.41682f, 0.385093f, 0.368324f, 0.383508f,
+    0.398843f, 0.373749f, 0.289764f, 0.231811f, 0.932813f,
+    0.800533f, 0.654755f, 0.570087f, 0.427565f, 0.400562f,
+    0.366097f, 0.349222f, 0.364971f, 0.378596f, 0.35482f,
+    0.275259f, 0.220207f, 0.896734f, 0.772951f, 0.632464f,
+    0.550275f, 0.412706f, 0.386416f, 0.351897f, 0.335391f,
+    0.350774f, 0.363751f, 0.340911f, 0.264511f, 0.211609f,
+    0.859311f, 0.738266f, 0.604122f, 0.52591f, 0.394432f,
+    0.369413f, 0.337725f, 0.322236f, 0.336367f, 0.349335f,
+    0.327372f, 0.253936f, 0.203149f, 0.846364f, 0.721486f,
+    0.590025f, 0.514311f, 0.385733f, 0.361618f, 0.332929f,
+    0.318216f, 0.331513f, 0.344701f, 0.323012f, 0.250463f,
+    0.20037f, 0.844803f, 0.717873f, 0.586903f, 0.511868f,
+    0.383901f, 0.360053f, 0.332317f, 0.317799f, 0.330932f,
+    0.344158f, 0.322503f, 0.250042f, 0.200034f, 0.844603f,
+    0.716687f, 0.585901f, 0.511125f, 0.383344f, 0.359595f,
+    0.332219f, 0.317752f, 0.330852f, 0.344081f, 0.322432f,
+    0.249979f, 0.199983f, 0.083342f, 0.0624859f, 0.0570536f,
+    0.0528398f, 0.0474501f, 0.0479133f, 0.0469963f, 0.0465646f,
+    0.0500043f, 0.0496817f, 0.049451f, 0.0370883f, 0.0296706f,
+    0.0581923f, 0.0421776f, 0.0386562f, 0.0363385f, 0.031852f,
+    0.0312696f, 0.032194f, 0.0310778f, 0.036134f, 0.0324036f,
+    0.0314795f, 0.0243015f, 0.0194412f, 0.0377055f, 0.0295832f,
+    0.0304918f, 0.0286963f, 0.0281457f, 0.0248659f, 0.0288564f,
+    0.0266981f, 0.0246615f, 0.0215906f, 0.0193057f, 0.0190684f,
+    0.0152547f, 0.0354364f, 0.022845f, 0.0219961f, 0.0277012f,
+    0.0218743f, 0.020758f, 0.0216119f, 0.0200678f, 0.0190363f,
+    0.018778f, 0.0159006f, 0.0140941f, 0.0112752f, 0.024239f,
+    0.0163978f, 0.0127749f, 0.0200591f, 0.0150443f, 0.0150265f,
+    0.0137924f, 0.013971f, 0.0126093f, 0.0124374f, 0.0106345f,
+    0.00797588f, 0.0080435f, 0.0146328f, 0.010395f, 0.00785289f,
+    0.0130912f, 0.00981843f, 0.00977015f, 0.00883666f, 0.00873855f,
+    0.00785946f, 0.00743736f, 0.00645378f, 0.00484033f, 0.00616198f,
+    0.00215592f, 0.00179013f, 0.00122751f, 0.00286986f, 0.00237092f,
+    0.00206863f, 0.00202817f, 0.00176433f, 0.00245151f, 0.00201224f,
+    0.00167727f, 0.00152686f, 0.00198075f, 0.109525f, 0.0821164f,
+    0.0749776f, 0.0694399f, 0.062357f, 0.0629657f, 0.0617606f,
+    0.0611933f, 0.0657136f, 0.0652896f, 0.0649865f, 0.0487399f,
+    0.0389919f, 0.084375f, 0.0618081f, 0.0563472f, 0.0524234f,
+    0.0464372f, 0.0463179f, 0.0457124f, 0.0450024f, 0.0512092f,
+    0.0472129f, 0.0470149f, 0.0352612f, 0.028209f, 0.0628937f,
+    0.0452784f, 0.0424408f, 0.0396356f, 0.0369995f, 0.0334332f,
+    0.0382417f, 0.0354052f, 0.0397113f, 0.0349207f, 0.033654f,
+    0.0266903f, 0.0213522f, 0.0443268f, 0.0303506f, 0.0317887f,
+    0.0343443f, 0.0307281f, 0.0269302f, 0.0309973f, 0.0285952f,
+    0.0268837f, 0.0238512f, 0.0204648f, 0.0198617f, 0.0158894f,
+    0.0331293f, 0.0217821f, 0.0206595f, 0.0267022f, 0.0222007f,
+    0.0199833f, 0.0219166f, 0.0201033f, 0.0195372f, 0.0175105f,
+    0.0161283f, 0.0126178f, 0.0100942f, 0.026434f, 0.0197589f,
+    0.0180336f, 0.0197343f, 0.0172607f, 0.0151302f, 0.0169919f,
+    0.0155332f, 0.0157634f, 0.0156786f, 0.0156095f, 0.0117071f,
+    0.00936572f, 0.0261831f, 0.0196307f, 0.0179241f, 0.0166002f,
+    0.0149069f, 0.0150524f, 0.0147646f, 0.0146287f, 0.0157094f,
+    0.0156081f, 0.0155356f, 0.0116517f, 0.00932138f, 0.135707f,
+    0.101747f, 0.0929015f, 0.08604f, 0.0772639f, 0.078018f,
+    0.0765249f, 0.075822f, 0.0814229f, 0.0808975f, 0.080522f,
+    0.0603915f, 0.0483132f, 0.110558f, 0.0814386f, 0.0742711f,
+    0.0685083f, 0.0610224f, 0.0613662f, 0.0602131f, 0.058927f,
+    0.0662844f, 0.0627407f, 0.0625504f, 0.0469128f, 0.0375303f,
+    0.0890764f, 0.0649089f, 0.059387f, 0.0557206f, 0.0489045f,
+    0.0484814f, 0.0488022f, 0.0474504f, 0.0547865f, 0.04973f,
+    0.0491894f, 0.0369723f, 0.0295779f, 0.0642633f, 0.0469367f,
+    0.0435162f, 0.0409874f, 0.039582f, 0.0352526f, 0.0403825f,
+    0.0373023f, 0.0396529f, 0.0360956f, 0.0360003f, 0.0270002f,
+    0.0216002f, 0.0541399f, 0.040273f, 0.0367399f, 0.033826f,
+    0.0310545f, 0.030731f, 0.0313019f, 0.0297136f, 0.0321959f,
+    0.0317905f, 0.0316638f, 0.0237478f, 0.0189983f, 0.0526166f,
+    0.0393894f, 0.0359575f, 0.0332676f, 0.0298599f, 0.0301785f,
+    0.0296068f, 0.0293065f, 0.0314727f, 0.0312866f, 0.031145f,
+    0.0233588f, 0.018687f, 0.0523657f, 0.0392612f, 0.035848f,
+    0.0332003f, 0.0298138f, 0.0301048f, 0.0295289f, 0.0292574f,
+    0.0314187f, 0.031216f, 0.0310711f, 0.0233033f, 0.0186427f,
+    0.16189f, 0.121377f, 0.110825f, 0.10264f, 0.0921708f,
+    0.0930704f, 0.0912892f, 0.0904507f, 0.0971322f, 0.0965055f,
+    0.0960575f, 0.0720431f, 0.0576345f, 0.13674f, 0.101069f,
+    0.0921951f, 0.0845932f, 0.0756076f, 0.0764144f, 0.0749774f,
+    0.0730241f, 0.0813595f, 0.0783358f, 0.0780859f, 0.0585644f,
+    0.0468515f, 0.115259f, 0.0845395f, 0.0770664f, 0.0718054f,
+    0.0634897f, 0.0635297f, 0.0623349f, 0.061375f, 0.0698616f,
+    0.0649103f, 0.0647249f, 0.0485437f, 0.038835f, 0.090446f,
+    0.0665672f, 0.0606826f, 0.0566622f, 0.0500544f, 0.0503009f,
+    0.0497679f, 0.0481278f, 0.0547281f, 0.0516908f, 0.0515358f,
+    0.0386518f, 0.0309215f, 0.0803226f, 0.0599035f, 0.0546638f,
+    0.0503807f, 0.0452001f, 0.0457792f, 0.0449106f, 0.0443422f,
+    0.0476243f, 0.0473985f, 0.0471993f, 0.0353995f, 0.0283196f,
+    0.0787993f, 0.0590199f, 0.0538815f, 0.0498677f, 0.0447668f,
+    0.0452267f, 0.0443711f, 0.0439352f, 0.047182f, 0.0468945f,
+    0.0466805f, 0.0350104f, 0.0280083f, 0.0785484f, 0.0588917f,
+    0.0537719f, 0.0498004f, 0.0447207f, 0.0451572f, 0.0442932f,
+    0.0438861f, 0.047128f, 0.046824f, 0.0466066f, 0.0349549f,
+    0.027964f, 0.214255f, 0.160638f, 0.146673f, 0.13584f,
+    0.121985f, 0.123175f, 0.120818f, 0.119708f, 0.128551f,
+    0.127721f, 0.127128f, 0.0953463f, 0.0762771f, 0.189106f,
+    0.14033f, 0.128043f, 0.116763f, 0.104867f, 0.106511f,
+    0.104506f, 0.102281f, 0.11151f, 0.109531f, 0.109157f,
+    0.0818677f, 0.0654941f, 0.167624f, 0.1238f, 0.112914f,
+    0.103975f, 0.0926601f, 0.0936262f, 0.0918635f, 0.089575f,
+    0.100012f, 0.0961006f, 0.0957959f, 0.0718469f, 0.0574775f,
+    0.142811f, 0.105828f, 0.0965305f, 0.088832f, 0.0795829f,
+    0.0803974f, 0.0788775f, 0.0773852f, 0.0848784f, 0.0828979f,
+    0.0826068f, 0.0619551f, 0.0495641f, 0.132688f, 0.0991645f,
+    0.0905117f, 0.0835809f, 0.0749871f, 0.0758758f, 0.0744392f,
+    0.0735996f, 0.0790429f, 0.0786144f, 0.0782703f, 0.0587027f,
+    0.0469622f, 0.131165f, 0.0982809f, 0.0897293f, 0.0830679f,
+    0.0745805f, 0.0753232f, 0.0738997f, 0.0731926f, 0.0786006f,
+    0.0781105f, 0.0777515f, 0.0583136f, 0.0466509f, 0.130914f,
+    0.0981527f, 0.0896198f, 0.0830006f, 0.0745345f, 0.075262f,
+    0.0738218f, 0.0731435f, 0.0785466f, 0.0780399f, 0.0776776f,
+    0.0582582f, 0.0466066f, 0.606995f, 0.455096f, 0.415532f,
+    0.384842f, 0.345588f, 0.348961f, 0.342283f, 0.339139f,
+    0.36419f, 0.361841f, 0.360161f, 0.270121f, 0.216096f,
+    0.581846f, 0.434788f, 0.396902f, 0.365436f, 0.327865f,
+    0.332235f, 0.325971f, 0.321712f, 0.345457f, 0.34365f,
+    0.342189f, 0.256642f, 0.205314f, 0.560364f, 0.418258f,
+    0.381773f, 0.351095f, 0.314907f, 0.31935f, 0.313328f,
+    0.309005f, 0.331825f, 0.3302f, 0.328828f, 0.246621f,
+    0.197297f, 0.535551f, 0.400286f, 0.365389f, 0.337083f,
+    0.30245f, 0.306121f, 0.300342f, 0.296816f, 0.318754f,
+    0.317017f, 0.315639f, 0.236729f, 0.189383f, 0.525428f,
+    0.393622f, 0.359371f, 0.332583f, 0.29859f, 0.3016f,
+    0.295904f, 0.29303f, 0.314682f, 0.312734f, 0.311303f,
+    0.233477f, 0.186782f, 0.523905f, 0.392739f, 0.358588f,
+    0.33207f, 0.298184f, 0.301099f, 0.295365f, 0.292623f,
+    0.31424f, 0.31223f, 0.310784f, 0.233088f, 0.18647f,
+    0.523654f, 0.39261f, 0.358479f, 0.332002f, 0.298138f,
+    0.301048f, 0.295287f, 0.292574f, 0.314186f, 0.312159f,
+    0.31071f, 0.233032f, 0.186426f, 0.0745952f, 0.0622431f,
+    0.0498135f, 0.0502198f, 0.0481417f, 0.0465042f, 0.0465609f,
+    0.0451871f, 0.0505946f, 0.0491369f, 0.0495191f, 0.0371393f,
+    0.0297115f, 0.0460175f, 0.0386999f, 0.0336944f, 0.0349414f,
+    0.0312129f, 0.03063f, 0.0313736f, 0.0305326f, 0.0338805f,
+    0.0331486f, 0.0310599f, 0.0238491f, 0.0190793f, 0.044084f,
+    0.0262908f, 0.0254995f, 0.0219132f, 0.0209686f, 0.0203248f,
+    0.0237153f, 0.0213076f, 0.0228276f, 0.020796f, 0.0192216f,
+    0.0194162f, 0.0155329f, 0.0324623f, 0.0260338f, 0.0220442f,
+    0.0185192f, 0.0169044f, 0.016909f, 0.0178775f, 0.0165346f,
+    0.0154817f, 0.0183248f, 0.0156889f, 0.0143219f, 0.0114575f,
+    0.0156198f, 0.0194545f, 0.0158695f, 0.013387f, 0.0123541f,
+    0.0122423f, 0.0126548f, 0.0118145f, 0.0109188f, 0.0124311f,
+    0.0106665f, 0.00799985f, 0.00695749f, 0.00756927f, 0.0130156f,
+    0.0101883f, 0.00865547f, 0.00813459f, 0.00815458f, 0.00802586f,
+    0.00756694f, 0.0069141f, 0.00774908f, 0.00665611f, 0.00499208f,
+    0.00514635f, 0.0012211f, 0.00305901f, 0.00494247f, 0.00336942f,
+    0.00332971f, 0.00348835f, 0.00318915f, 0.00284666f, 0.00252472f,
+    0.00222598f, 0.00185498f, 0.00171541f, 0.00153456f, 0.09803f,
+    0.0817973f, 0.0654629f, 0.0659968f, 0.0632658f, 0.0611139f,
+    0.0611884f, 0.059383f, 0.0664894f, 0.0645737f, 0.0650759f,
+    0.048807f, 0.0390456f, 0.0694523f, 0.0582541f, 0.0472727f,
+    0.0507184f, 0.0452556f, 0.0443509f, 0.0454389f, 0.0442596f,
+    0.0481384f, 0.0482543f, 0.0466168f, 0.0349626f, 0.0280104f,
+    0.0574428f, 0.0412024f, 0.0384038f, 0.0376902f, 0.0340871f,
+    0.0331659f, 0.0357512f, 0.032943f, 0.0370855f, 0.0357697f,
+    0.0331491f, 0.0258897f, 0.0207117f, 0.0458211f, 0.0319442f,
+    0.0272712f, 0.0229088f, 0.021979f, 0.0216736f, 0.0243228f,
+    0.0228011f, 0.0227293f, 0.0232328f, 0.0201706f, 0.0202541f,
+    0.0162033f, 0.0289786f, 0.0253648f, 0.0210965f, 0.0177766f,
+    0.0163261f, 0.0162533f, 0.0170246f, 0.0161332f, 0.0164092f,
+    0.017339f, 0.0160749f, 0.012968f, 0.0103744f, 0.0234932f,
+    0.0196109f, 0.0157165f, 0.0159259f, 0.0151744f, 0.0146615f,
+    0.0146814f, 0.0142547f, 0.0159511f, 0.0155012f, 0.0156163f,
+    0.0117123f, 0.0093698f, 0.0234348f, 0.0195543f, 0.0156495f,
+    0.0157774f, 0.0151242f, 0.0146098f, 0.0146276f, 0.014196f,
+    0.0158948f, 0.0154369f, 0.015557f, 0.0116677f, 0.00933418f,
+    0.121465f, 0.101352f, 0.0811123f, 0.0817738f, 0.07839f,
+    0.0757237f, 0.0758159f, 0.073579f, 0.0823842f, 0.0800105f,
+    0.0806329f, 0.0604746f, 0.0483797f, 0.0928871f, 0.0778084f,
+    0.0629221f, 0.0664954f, 0.0603798f, 0.0584972f, 0.0595041f,
+    0.0579867f, 0.0635533f, 0.0633601f, 0.0621736f, 0.0466302f,
+    0.0373088f, 0.0723839f, 0.0607567f, 0.0513081f, 0.0534672f,
+    0.0472963f, 0.0468569f, 0.0480109f, 0.0466701f, 0.0513434f,
+    0.0508754f, 0.048706f, 0.0365295f, 0.0293883f, 0.0591799f,
+    0.0445764f, 0.0386367f, 0.0385478f, 0.0346267f, 0.0338521f,
+    0.0363304f, 0.0336193f, 0.0369872f, 0.0368226f, 0.0357275f,
+    0.0267956f, 0.0214551f, 0.0474873f, 0.039669f, 0.0318629f,
+    0.0325818f, 0.0307166f, 0.0296854f, 0.0297359f, 0.0288876f,
+    0.032304f, 0.031419f, 0.0316318f, 0.0237239f, 0.0189791f,
+    0.046928f, 0.0391652f, 0.0313659f, 0.0317029f, 0.0302986f,
+    0.0292712f, 0.0293089f, 0.0284507f, 0.0318459f, 0.030938f,
+    0.0311732f, 0.0233799f, 0.0187039f, 0.0468696f, 0.0391085f,
+    0.0312989f, 0.0315544f, 0.0302484f, 0.0292195f, 0.0292551f,
+    0.028392f, 0.0317896f, 0.0308737f, 0.0311138f, 0.0233354f,
+    0.0186683f, 0.1449f, 0.120906f, 0.0967617f, 0.0975508f,
+    0.0935142f, 0.0903334f, 0.0904434f, 0.0877749f, 0.0982789f,
+    0.0954474f, 0.0961897f, 0.0721423f, 0.0577139f, 0.116322f,
+    0.0973626f, 0.0785714f, 0.0822724f, 0.0755039f, 0.0730896f,
+    0.0735693f, 0.0717137f, 0.079448f, 0.0784658f, 0.0777305f,
+    0.0582979f, 0.0466383f, 0.0958187f, 0.0803109f, 0.0650725f,
+    0.0692442f, 0.0623617f, 0.0605778f, 0.0620762f, 0.0603971f,
+    0.0656704f, 0.0659811f, 0.0642629f, 0.0481972f, 0.0385827f,
+    0.076611f, 0.0641307f, 0.0518109f, 0.0543248f, 0.0497508f,
+    0.0481756f, 0.0487648f, 0.0473464f, 0.0523766f, 0.0519283f,
+    0.0512844f, 0.0384633f, 0.0307706f, 0.0709221f, 0.0592233f,
+    0.0475123f, 0.0483588f, 0.0458407f, 0.0442951f, 0.0443634f,
+    0.0430835f, 0.0481988f, 0.0468559f, 0.0471887f, 0.0353915f,
+    0.0283132f, 0.0703628f, 0.0587194f, 0.0470153f, 0.0474799f,
+    0.0454228f, 0.0438809f, 0.0439365f, 0.0426466f, 0.0477407f,
+    0.0463749f, 0.0467301f, 0.0350476f, 0.0280381f, 0.0703044f,
+    0.0586628f, 0.0469483f, 0.0473314f, 0.0453725f, 0.0438292f,
+    0.0438826f, 0.0425879f, 0.0476844f, 0.0463106f, 0.0466707f,
+    0.035003f, 0.0280024f, 0.191769f, 0.160014f, 0.12806f,
+    0.129105f, 0.123762f, 0.119553f, 0.119698f, 0.116167f,
+    0.130068f, 0.126321f, 0.127303f, 0.0954776f, 0.0763821f,
+    0.163191f, 0.136471f, 0.10987f, 0.113826f, 0.105752f,
+    0.102275f, 0.102348f, 0.0995052f, 0.111238f, 0.108677f,
+    0.108844f, 0.0816332f, 0.0653066f, 0.142688f, 0.119419f,
+    0.0963713f, 0.100798f, 0.09261f, 0.0896467f, 0.0902066f,
+    0.0878512f, 0.0974599f, 0.0961925f, 0.0953767f, 0.0715325f,
+    0.057226f, 0.123481f, 0.103239f, 0.0831097f, 0.0858788f,
+    0.0799991f, 0.0773605f, 0.0774664f, 0.0752981f, 0.0841662f,
+    0.0821397f, 0.0823981f, 0.0617986f, 0.0494389f, 0.117792f,
+    0.0983317f, 0.0788111f, 0.0799128f, 0.0760891f, 0.0735146f,
+    0.0736184f, 0.0714754f, 0.0799883f, 0.0777295f, 0.0783025f,
+    0.0587268f, 0.0469815f, 0.117232f, 0.0978279f, 0.0783141f,
+    0.0790339f, 0.075671f, 0.0731004f, 0.0731915f, 0.0710385f,
+    0.0795302f, 0.0772485f, 0.0778439f, 0.0583829f, 0.0467063f,
+    0.117174f, 0.0977713f, 0.078247f, 0.0788855f, 0.0756209f,
+    0.0730487f, 0.0731377f, 0.0709798f, 0.0794739f, 0.0771842f,
+    0.0777845f, 0.0583384f, 0.0466707f, 0.543291f, 0.453328f,
+    0.362801f, 0.36576f, 0.350625f, 0.338699f, 0.339111f,
+    0.329106f, 0.36849f, 0.357873f, 0.360657f, 0.270493f,
+    0.216394f, 0.514713f, 0.429785f, 0.344611f, 0.350482f,
+    0.332615f, 0.321327f, 0.32176f, 0.312444f, 0.349659f,
+    0.339855f, 0.342197f, 0.256648f, 0.205319f, 0.49421f,
+    0.412733f, 0.331112f, 0.337454f, 0.319472f, 0.308649f,
+    0.309092f, 0.300178f, 0.335881f, 0.326524f, 0.32873f,
+    0.246547f, 0.197238f, 0.475002f, 0.396553f, 0.31785f,
+    0.322534f, 0.306862f, 0.296463f, 0.296879f, 0.288237f,
+    0.322588f, 0.31348f, 0.315751f, 0.236814f, 0.189451f,
+    0.469313f, 0.391645f, 0.313552f, 0.316568f, 0.302951f,
+    0.292661f, 0.293031f, 0.284414f, 0.31841f, 0.309282f,
+    0.311656f, 0.233742f, 0.186994f, 0.468754f, 0.391142f,
+    0.313055f, 0.315689f, 0.302533f, 0.292246f, 0.292604f,
+    0.283978f, 0.317952f, 0.308801f, 0.311197f, 0.233398f,
+    0.186718f, 0.468695f, 0.391085f, 0.312988f, 0.315541f,
+    0.302483f, 0.292195f, 0.292551f, 0.283919f, 0.317896f,
+    0.308736f, 0.311138f, 0.233353f, 0.186683f, 0.0543495f,
+    0.0507195f, 0.0490074f, 0.0476557f, 0.0485225f, 0.047303f,
+    0.0457582f, 0.0464643f, 0.0491952f, 0.048175f, 0.0480816f,
+    0.0361806f, 0.0289675f, 0.0379979f, 0.0350197f, 0.0316946f,
+    0.0324601f, 0.0312397f, 0.0307021f, 0.0299369f, 0.0315916f,
+    0.0329483f, 0.0315393f, 0.0303536f, 0.023514f, 0.0188112f,
+    0.0264017f, 0.0290161f, 0.0220181f, 0.0222875f, 0.0205842f,
+    0.0204726f, 0.0219116f, 0.0201165f, 0.0223905f, 0.0208551f,
+    0.0187421f, 0.0183078f, 0.0146462f, 0.0295659f, 0.0288403f,
+    0.0188219f, 0.0213692f, 0.0203538f, 0.019074f, 0.0181633f,
+    0.0171169f, 0.0178759f, 0.0190744f, 0.0163429f, 0.013136f,
+    0.0105088f, 0.0298367f, 0.0214874f, 0.0141252f, 0.0164487f,
+    0.0155556f, 0.0145203f, 0.0134991f, 0.0125932f, 0.0132266f,
+    0.0132073f, 0.0114569f, 0.00859266f, 0.00687413f, 0.0268044f,
+    0.0141691f, 0.0115153f, 0.0113535f, 0.0106568f, 0.00991368f,
+    0.00903512f, 0.00835474f, 0.00891903f, 0.0085678f, 0.00754272f,
+    0.00565704f, 0.00452563f, 0.0158042f, 0.00752059f, 0.00628191f,
+    0.00475818f, 0.00392961f, 0.00428862f, 0.00396244f, 0.00344911f,
+    0.00316567f, 0.00275431f, 0.00229526f, 0.00287884f, 0.00230307f,
+    0.0714238f, 0.0666535f, 0.0644035f, 0.0626272f, 0.0637662f,
+    0.0621637f, 0.0601336f, 0.0610615f, 0.0646504f, 0.0633097f,
+    0.0631868f, 0.047547f, 0.038068f, 0.05466f, 0.0498215f,
+    0.0461733f, 0.0469842f, 0.0457532f, 0.0446368f, 0.0433411f,
+    0.0460249f, 0.0467273f, 0.0460483f, 0.0454559f, 0.0343009f,
+    0.0276291f, 0.041671f, 0.0383406f, 0.0342743f, 0.035107f,
+    0.033808f, 0.0332555f, 0.033072f, 0.0340151f, 0.0361695f,
+    0.0340452f, 0.0324605f, 0.0257945f, 0.0206356f, 0.0340337f,
+    0.035312f, 0.0230185f, 0.0260458f, 0.0248507f, 0.0233191f,
+    0.0227651f, 0.0211413f, 0.0222778f, 0.0242747f, 0.0207439f,
+    0.0190134f, 0.0152108f, 0.0343045f, 0.0279591f, 0.0183218f,
+    0.0211253f, 0.0200526f, 0.0187654f, 0.0177027f, 0.0166176f,
+    0.0174654f, 0.0184076f, 0.0158579f, 0.012294f, 0.00983517f,
+    0.0312721f, 0.0206408f, 0.0154566f, 0.0160301f, 0.0152993f,
+    0.0149171f, 0.0144302f, 0.0146538f, 0.015517f, 0.0151999f,
+    0.0151652f, 0.0114153f, 0.00914017f, 0.0202719f, 0.015934f,
+    0.0153962f, 0.0149716f, 0.0152439f, 0.0148608f, 0.0143754f,
+    0.0145973f, 0.0154553f, 0.0151347f, 0.0151054f, 0.0113666f,
+    0.00910049f, 0.0884982f, 0.0825875f, 0.0797996f, 0.0775986f,
+    0.0790101f, 0.0770244f, 0.0745089f, 0.0756587f, 0.0801056f,
+    0.0784443f, 0.0782921f, 0.0589135f, 0.0471684f, 0.0715739f,
+    0.0646234f, 0.0615695f, 0.0615083f, 0.060997f, 0.0594974f,
+    0.0575631f, 0.0604583f, 0.0620092f, 0.0609296f, 0.0605611f,
+    0.045642f, 0.0365508f, 0.0576797f, 0.0531424f, 0.04844f,
+    0.0496311f, 0.0477838f, 0.0469028f, 0.0457596f, 0.0484484f,
+    0.0499484f, 0.0484588f, 0.0474998f, 0.0359474f, 0.0290131f,
+    0.0416479f, 0.0417837f, 0.0353622f, 0.0358214f, 0.0350077f,
+    0.0341587f, 0.0339255f, 0.0349753f, 0.0360567f, 0.0351742f,
+    0.0347868f, 0.0262324f, 0.0210737f, 0.0387723f, 0.0344308f,
+    0.0313063f, 0.030414f, 0.0309855f, 0.030216f, 0.0292313f,
+    0.0297408f, 0.0314407f, 0.0308195f, 0.0307288f, 0.0231384f,
+    0.0185288f, 0.0357399f, 0.0319205f, 0.0308527f, 0.0299944f,
+    0.0305431f, 0.0297778f, 0.0288056f, 0.029251f, 0.0309722f,
+    0.0303345f, 0.0302704f, 0.0227817f, 0.0182406f, 0.0341489f,
+    0.031868f, 0.0307924f, 0.029943f, 0.0304876f, 0.0297214f,
+    0.0287508f, 0.0291945f, 0.0309104f, 0.0302694f, 0.0302106f,
+    0.022733f, 0.0182009f, 0.105573f, 0.0985215f, 0.0951958f,
+    0.0925701f, 0.0942538f, 0.091885f, 0.0888843f, 0.0902559f,
+    0.0955607f, 0.0935789f, 0.0933974f, 0.0702799f, 0.0562688f,
+    0.0884878f, 0.0801842f, 0.0769656f, 0.0760324f, 0.0762407f,
+    0.0743581f, 0.0719385f, 0.0748915f, 0.0774644f, 0.0760643f,
+    0.0756664f, 0.0570084f, 0.0456512f, 0.0745936f, 0.0679443f,
+    0.063628f, 0.0641552f, 0.0630276f, 0.0614878f, 0.0594918f,
+    0.0628817f, 0.0640958f, 0.0630821f, 0.0626051f, 0.0471967f,
+    0.0378743f, 0.0584603f, 0.0531493f, 0.0507583f, 0.0503455f,
+    0.0502515f, 0.0490194f, 0.0474273f, 0.0494087f, 0.0510578f,
+    0.0501428f, 0.049892f, 0.0375989f, 0.0301133f, 0.0521041f,
+    0.0483254f, 0.0467024f, 0.0453855f, 0.0462293f, 0.0450767f,
+    0.0436067f, 0.0442821f, 0.0468959f, 0.0459542f, 0.0458341f,
+    0.0345049f, 0.0276293f, 0.0513271f, 0.0478545f, 0.0462488f,
+    0.0449659f, 0.0457869f, 0.0446385f, 0.0431809f, 0.0438481f,
+    0.0464273f, 0.0454692f, 0.0453757f, 0.0341482f, 0.027341f,
+    0.0512233f, 0.047802f, 0.0461885f, 0.0449145f, 0.0457314f,
+    0.0445821f, 0.0431262f, 0.0437917f, 0.0463656f, 0.045404f,
+    0.0453159f, 0.0340995f, 0.0273013f, 0.139721f, 0.13039f,
+    0.125988f, 0.122513f, 0.124741f, 0.121606f, 0.117635f,
+    0.11945f, 0.126471f, 0.123848f, 0.123608f, 0.0930129f,
+    0.0744697f, 0.122601f, 0.112052f, 0.107758f, 0.105081f,
+    0.106728f, 0.104079f, 0.100689f, 0.103758f, 0.108375f,
+    0.106334f, 0.105877f, 0.0797414f, 0.0638521f, 0.108422f,
+    0.0982462f, 0.0944203f, 0.0932033f, 0.0935152f, 0.0912091f,
+    0.0882426f, 0.0917484f, 0.0950061f, 0.0932833f, 0.0928156f,
+    0.0699296f, 0.0560004f, 0.0922882f, 0.0845739f, 0.0815506f,
+    0.0793936f, 0.080739f, 0.0787408f, 0.076178f, 0.0782753f,
+    0.0819681f, 0.080412f, 0.0801026f, 0.0603318f, 0.0483141f,
+    0.0862529f, 0.0801935f, 0.0774947f, 0.0753284f, 0.0767168f,
+    0.074798f, 0.0723574f, 0.0734765f, 0.0778061f, 0.0762235f,
+    0.0760446f, 0.0572378f, 0.0458301f, 0.0854759f, 0.0797225f,
+    0.0770411f, 0.0749088f, 0.0762745f, 0.0743598f, 0.0719317f,
+    0.0730425f, 0.0773376f, 0.0757384f, 0.0755862f, 0.0568811f,
+    0.0455419f, 0.085372f, 0.0796701f, 0.0769807f, 0.0748575f,
+    0.076219f, 0.0743035f, 0.0718769f, 0.072986f, 0.0772758f,
+    0.0756733f, 0.0755264f, 0.0568324f, 0.0455022f, 0.395837f,
+    0.3694f, 0.35693f, 0.347085f, 0.353398f, 0.344516f,
+    0.333265f, 0.338408f, 0.358298f, 0.350868f, 0.350187f,
+    0.26351f, 0.210976f, 0.378717f, 0.351062f, 0.3387f,
+    0.329287f, 0.335385f, 0.32699f, 0.31632f, 0.321196f,
+    0.340202f, 0.333353f, 0.332456f, 0.250238f, 0.200358f,
+    0.36436f, 0.337256f, 0.325362f, 0.316287f, 0.322172f,
+    0.314119f, 0.303873f, 0.308559f, 0.326833f, 0.320303f,
+    0.319395f, 0.240426f, 0.192507f, 0.348373f, 0.323584f,
+    0.312493f, 0.303791f, 0.309396f, 0.301651f, 0.291808f,
+    0.296314f, 0.313795f, 0.307432f, 0.306682f, 0.230829f,
+    0.18482f, 0.342369f, 0.319204f, 0.308437f, 0.299901f,
+    0.305374f, 0.297708f, 0.287988f, 0.292434f, 0.309633f,
+    0.303243f, 0.302624f, 0.227735f, 0.182336f, 0.341592f,
+    0.318733f, 0.307983f, 0.299481f, 0.304931f, 0.29727f,
+    0.287562f, 0.292f, 0.309165f, 0.302758f, 0.302165f,
+    0.227378f, 0.182048f, 0.341488f, 0.31868f, 0.307923f,
+    0.29943f, 0.304876f, 0.297214f, 0.287507f, 0.291944f,
+    0.309103f, 0.302693f, 0.302105f, 0.227329f, 0.182008f,
+    0.0548791f, 0.0523078f, 0.0499854f, 0.0490966f, 0.0482856f,
+    0.0468115f, 0.046245f, 0.0458802f, 0.0473719f, 0.0464345f,
+    0.0451187f, 0.033839f, 0.0270712f, 0.0342012f, 0.0368183f,
+    0.0316319f, 0.0313774f, 0.0306863f, 0.0304948f, 0.0301975f,
+    0.0310058f, 0.03069f, 0.0316553f, 0.0290223f, 0.0224122f,
+    0.0179298f, 0.0229406f, 0.0251968f, 0.0226606f, 0.0219789f,
+    0.0210965f, 0.0207179f, 0.0216608f, 0.0199308f, 0.0209619f,
+    0.0209789f, 0.0183627f, 0.0164839f, 0.0131871f, 0.023796f,
+    0.0217817f, 0.0223863f, 0.0212903f, 0.0198045f, 0.020274f,
+    0.0194873f, 0.0183666f, 0.0171167f, 0.0181039f, 0.0153784f,
+    0.0115338f, 0.00922703f, 0.0189277f, 0.0168198f, 0.0173578f,
+    0.0164241f, 0.0150893f, 0.0153478f, 0.0147331f, 0.0137997f,
+    0.0125811f, 0.0120778f, 0.0104098f, 0.00780736f, 0.00624589f,
+    0.0132597f, 0.0114995f, 0.011918f, 0.0113085f, 0.010297f,
+    0.0105323f, 0.0101715f, 0.00956757f, 0.00859014f, 0.00799283f,
+    0.00692824f, 0.00519618f, 0.00415695f, 0.0031629f, 0.00649367f,
+    0.00616258f, 0.00593534f, 0.0050296f, 0.0051607f, 0.00469655f,
+    0.0041672f, 0.00375263f, 0.00317077f, 0.00264231f, 0.00244106f,
+    0.00195285f, 0.0721199f, 0.0687407f, 0.0656888f, 0.0645207f,
+    0.063455f, 0.0615177f, 0.0607732f, 0.0602939f, 0.0622541f,
+    0.0610223f, 0.0592931f, 0.0444699f, 0.0355759f, 0.051442f,
+    0.0532513f, 0.0473352f, 0.0462565f, 0.0456014f, 0.0442316f,
+    0.0437285f, 0.0454195f, 0.0452636f, 0.0459969f, 0.0431396f,
+    0.03247f, 0.0260727f, 0.0364505f, 0.0397681f, 0.0337997f,
+    0.0339577f, 0.0332526f, 0.0330871f, 0.0330528f, 0.0333538f,
+    0.033816f, 0.0343151f, 0.0310861f, 0.0244972f, 0.0195977f,
+    0.0286577f, 0.026445f, 0.0271583f, 0.0259191f, 0.0242078f,
+    0.0249133f, 0.024014f, 0.022745f, 0.0213689f, 0.0238237f,
+    0.0201798f, 0.016983f, 0.0135864f, 0.0237894f, 0.0214831f,
+    0.0221298f, 0.0210528f, 0.0194926f, 0.0199871f, 0.0192598f,
+    0.0181781f, 0.0168333f, 0.0177977f, 0.0152113f, 0.0114085f,
+    0.00912677f, 0.0181214f, 0.0166066f, 0.01669f, 0.0159372f,
+    0.0152269f, 0.0151716f, 0.0146982f, 0.0145301f, 0.0149482f,
+    0.0146543f, 0.0142404f, 0.0106803f, 0.00854426f, 0.0172409f,
+    0.0164336f, 0.0157035f, 0.0154242f, 0.0151695f, 0.0147064f,
+    0.0145284f, 0.0144141f, 0.0148824f, 0.0145879f, 0.0141746f,
+    0.0106309f, 0.00850474f, 0.0893607f, 0.0851737f, 0.0813921f,
+    0.0799448f, 0.0786244f, 0.076224f, 0.0753015f, 0.0747075f,
+    0.0771364f, 0.0756101f, 0.0734676f, 0.0551007f, 0.0440806f,
+    0.0686827f, 0.0696843f, 0.0630386f, 0.0616806f, 0.0607707f,
+    0.0589379f, 0.0582266f, 0.0598331f, 0.0601459f, 0.0603386f,
+    0.057314f, 0.0430319f, 0.0344255f, 0.0536912f, 0.0562011f,
+    0.0494918f, 0.0483117f, 0.0476383f, 0.0465506f, 0.0461148f,
+    0.0477675f, 0.0473407f, 0.0486567f, 0.0451292f, 0.0342767f,
+    0.02743f, 0.0394094f, 0.0404547f, 0.0362475f, 0.0354114f,
+    0.0348901f, 0.0338601f, 0.0339763f, 0.0346116f, 0.0345513f,
+    0.0353411f, 0.0329408f, 0.0248928f, 0.0199285f, 0.0350131f,
+    0.0340134f, 0.0319696f, 0.0313546f, 0.0308468f, 0.029919f,
+    0.0295575f, 0.0296412f, 0.0303249f, 0.0298232f, 0.0288945f,
+    0.0216757f, 0.0173406f, 0.0345406f, 0.0330396f, 0.0314739f,
+    0.0309059f, 0.0303963f, 0.0294723f, 0.0291159f, 0.0289438f,
+    0.0298305f, 0.0292421f, 0.0284149f, 0.0213112f, 0.0170489f,
+    0.0344817f, 0.0328666f, 0.0314068f, 0.0308484f, 0.0303388f,
+    0.0294126f, 0.0290567f, 0.0288277f, 0.0297647f, 0.0291758f,
+    0.028349f, 0.0212618f, 0.0170094f, 0.106601f, 0.101607f,
+    0.0970955f, 0.095369f, 0.0937938f, 0.0909303f, 0.0898298f,
+    0.0891212f, 0.0920187f, 0.0901979f, 0.087642f, 0.0657316f,
+    0.0525852f, 0.0859235f, 0.0861172f, 0.078742f, 0.0771048f,
+    0.0759401f, 0.0736441f, 0.0727501f, 0.0742469f, 0.0750281f,
+    0.0746802f, 0.0714885f, 0.0536581f, 0.0429265f, 0.070932f,
+    0.072634f, 0.0651952f, 0.0637359f, 0.0628077f, 0.060927f,
+    0.0602013f, 0.0621812f, 0.062223f, 0.0629984f, 0.0593037f,
+    0.0445542f, 0.0357444f, 0.0566501f, 0.0568877f, 0.0519509f,
+    0.0508355f, 0.0500595f, 0.0485663f, 0.0479771f, 0.0490253f,
+    0.0494336f, 0.0496827f, 0.0471153f, 0.0353736f, 0.0282989f,
+    0.0522539f, 0.0504464f, 0.047673f, 0.0467787f, 0.0460162f,
+    0.0446252f, 0.0440858f, 0.0440548f, 0.0452072f, 0.0443127f,
+    0.043069f, 0.0323019f, 0.0258415f, 0.0517814f, 0.0494726f,
+    0.0471773f, 0.0463301f, 0.0455657f, 0.0441785f, 0.0436442f,
+    0.0433575f, 0.0447129f, 0.04383f, 0.0425894f, 0.031942f,
+    0.0255536f, 0.0517224f, 0.0492996f, 0.0471102f, 0.0462725f,
+    0.0455082f, 0.0441189f, 0.043585f, 0.0432414f, 0.044647f,
+    0.0437636f, 0.0425235f, 0.0318926f, 0.0255141f, 0.141083f,
+    0.134473f, 0.128502f, 0.126217f, 0.124132f, 0.120343f,
+    0.118886f, 0.117949f, 0.121783f, 0.119374f, 0.115991f,
+    0.0869933f, 0.0695946f, 0.120405f, 0.118983f, 0.110149f,
+    0.107953f, 0.106279f, 0.103057f, 0.101807f, 0.103074f,
+    0.104793f, 0.103364f, 0.0998373f, 0.0749106f, 0.0599284f,
+    0.105414f, 0.1055f, 0.096602f, 0.0945841f, 0.0931465f,
+    0.0903395f, 0.0892424f, 0.0910085f, 0.0919876f, 0.0916817f,
+    0.0876526f, 0.0657923f, 0.0526338f, 0.0911317f, 0.0897537f,
+    0.0833576f, 0.0816838f, 0.0803983f, 0.0779788f, 0.0770336f,
+    0.0778527f, 0.0791982f, 0.078366f, 0.0754642f, 0.056626f,
+    0.0453008f, 0.0867354f, 0.0833124f, 0.0790797f, 0.077627f,
+    0.0763549f, 0.0740378f, 0.0731423f, 0.0728822f, 0.0749718f,
+    0.0734883f, 0.0714179f, 0.0535634f, 0.0428507f, 0.086263f,
+    0.0823385f, 0.0785841f, 0.0771784f, 0.0759044f, 0.073591f,
+    0.0727008f, 0.0721848f, 0.0744774f, 0.0730056f, 0.0709383f,
+    0.0532037f, 0.042563f, 0.086204f, 0.0821655f, 0.0785169f,
+    0.0771208f, 0.075847f, 0.0735315f, 0.0726416f, 0.0720688f,
+    0.0744116f, 0.0729392f, 0.0708724f, 0.0531543f, 0.0425234f,
+    0.399695f, 0.380967f, 0.364053f, 0.357579f, 0.351673f,
+    0.340937f, 0.336811f, 0.334154f, 0.345018f, 0.338191f,
+    0.328608f, 0.246456f, 0.197165f, 0.379017f, 0.365478f,
+    0.345699f, 0.339315f, 0.33382f, 0.323651f, 0.319731f,
+    0.319279f, 0.328027f, 0.321421f, 0.312454f, 0.234341f,
+    0.187473f, 0.364025f, 0.351995f, 0.332152f, 0.325946f,
+    0.320687f, 0.310934f, 0.307167f, 0.307214f, 0.315222f,
+    0.308865f, 0.30027f, 0.225202f, 0.180162f, 0.349743f,
+    0.336248f, 0.318908f, 0.313046f, 0.307939f, 0.298573f,
+    0.294958f, 0.294058f, 0.302433f, 0.296404f, 0.288081f,
+    0.216061f, 0.172849f, 0.345347f, 0.329807f, 0.31463f,
+    0.308989f, 0.303896f, 0.294632f, 0.291067f, 0.289087f,
+    0.298206f, 0.292306f, 0.284035f, 0.213026f, 0.170421f,
+    0.344875f, 0.328833f, 0.314135f, 0.30854f, 0.303445f,
+    0.294185f, 0.290625f, 0.28839f, 0.297712f, 0.291823f,
+    0.283555f, 0.212666f, 0.170133f, 0.344816f, 0.32866f,
+    0.314067f, 0.308483f, 0.303388f, 0.294125f, 0.290566f,
+    0.288274f, 0.297646f, 0.291756f, 0.283489f, 0.212617f,
+    0.170094f, 0.050656f, 0.0490491f, 0.0486571f, 0.048046f,
+    0.0479398f, 0.0466295f, 0.0446999f, 0.0455459f, 0.0442049f,
+    0.0426029f, 0.0396098f, 0.0297073f, 0.0237658f, 0.0335431f,
+    0.0308314f, 0.0316059f, 0.0311817f, 0.0310153f, 0.0304627f,
+    0.0293267f, 0.0303759f, 0.0286733f, 0.0293625f, 0.0261475f,
+    0.0200568f, 0.0160454f, 0.0272394f, 0.0248676f, 0.0235013f,
+    0.0231056f, 0.0220427f, 0.0218494f, 0.0219128f, 0.0203012f,
+    0.0210082f, 0.0214101f, 0.0178417f, 0.0146765f, 0.0117412f,
+    0.0265705f, 0.0242196f, 0.0218457f, 0.0223764f, 0.0209263f,
+    0.0205528f, 0.0189836f, 0.0181383f, 0.0169045f, 0.0167156f,
+    0.0139297f, 0.0104472f, 0.0083578f, 0.01931f, 0.0175081f,
+    0.0157082f, 0.0163765f, 0.0150633f, 0.0147655f, 0.013415f,
+    0.0127349f, 0.0115699f, 0.0102398f, 0.00853317f, 0.00676092f,
+    0.00540873f, 0.0124719f, 0.0112015f, 0.0105109f, 0.0108592f,
+    0.00993309f, 0.00986568f, 0.00892229f, 0.00857221f, 0.00767909f,
+    0.0069021f, 0.00575175f, 0.00522171f, 0.00417737f, 0.00267343f,
+    0.00578416f, 0.00722803f, 0.00580995f, 0.00506012f, 0.00435367f,
+    0.00381687f, 0.00340619f, 0.00302656f, 0.00252208f, 0.00210173f,
+    0.00245676f, 0.00196541f, 0.06657f, 0.0644584f, 0.0639432f,
+    0.0631401f, 0.0630006f, 0.0612785f, 0.0587428f, 0.0598547f,
+    0.0580923f, 0.0559871f, 0.0520536f, 0.0390401f, 0.0312321f,
+    0.0484133f, 0.0462407f, 0.0458104f, 0.0453303f, 0.045291f,
+    0.0441632f, 0.0424254f, 0.0446846f, 0.0425607f, 0.042606f,
+    0.0385913f, 0.0289434f, 0.0232839f, 0.0362438f, 0.0342972f,
+    0.0342355f, 0.0337543f, 0.0336103f, 0.0330703f, 0.0334189f,
+    0.0326539f, 0.0307087f, 0.0319294f, 0.0283946f, 0.0220146f,
+    0.0176117f, 0.0327715f, 0.0298816f, 0.0270753f, 0.0277281f,
+    0.026148f, 0.0258377f, 0.0240858f, 0.0232248f, 0.0222235f,
+    0.023462f, 0.0195517f, 0.0149991f, 0.0119993f, 0.025511f,
+    0.02317f, 0.0209377f, 0.0217283f, 0.0202849f, 0.0200504f,
+    0.0185172f, 0.0178214f, 0.0166058f, 0.0169862f, 0.0141552f,
+    0.0106164f, 0.00849312f, 0.0186729f, 0.0168635f, 0.0153453f,
+    0.016211f, 0.0151547f, 0.0151506f, 0.0141028f, 0.0144177f,
+    0.013961f, 0.0134712f, 0.0125193f, 0.00938947f, 0.00751159f,
+    0.0159141f, 0.0154093f, 0.0152862f, 0.0150942f, 0.0150609f,
+    0.0146492f, 0.014043f, 0.014309f, 0.0138876f, 0.0133842f,
+    0.0124439f, 0.00933293f, 0.00746635f, 0.0824841f, 0.0798676f,
+    0.0792293f, 0.0782342f, 0.0780614f, 0.0759277f, 0.0727857f,
+    0.0741633f, 0.0719797f, 0.0693711f, 0.0644973f, 0.048373f,
+    0.0386984f, 0.0632836f, 0.0616499f, 0.0610965f, 0.0604244f,
+    0.0603517f, 0.0588123f, 0.0564683f, 0.0589933f, 0.0564481f,
+    0.0558493f, 0.051035f, 0.0382763f, 0.0306241f, 0.051114f,
+    0.0483003f, 0.0481566f, 0.0475391f, 0.04733f, 0.0464929f,
+    0.0449249f, 0.0469626f, 0.0445662f, 0.0451728f, 0.0404812f,
+    0.0307861f, 0.0246289f, 0.0389724f, 0.0355436f, 0.0350965f,
+    0.0347287f, 0.0346768f, 0.0337959f, 0.0343907f, 0.0341251f,
+    0.0324752f, 0.0328946f, 0.0294166f, 0.022524f, 0.0180192f,
+    0.032258f, 0.031327f, 0.0310796f, 0.030707f, 0.0306407f,
+    0.0298172f, 0.0285898f, 0.0293825f, 0.0283545f, 0.0276477f,
+    0.0254732f, 0.0191049f, 0.0152839f, 0.03187f, 0.0308763f,
+    0.0306314f, 0.0302499f, 0.0301826f, 0.0293603f, 0.0281457f,
+    0.0287264f, 0.0278484f, 0.02684f, 0.0249631f, 0.0187223f,
+    0.0149778f, 0.0318281f, 0.0308186f, 0.0305723f, 0.0301883f,
+    0.0301216f, 0.0292983f, 0.0280859f, 0.0286177f, 0.027775f,
+    0.0267683f, 0.0248877f, 0.0186658f, 0.0149326f, 0.0983981f,
+    0.0952768f, 0.0945154f, 0.0933283f, 0.0931221f, 0.0905767f,
+    0.0868286f, 0.0884719f, 0.085867f, 0.0827553f, 0.0769411f,
+    0.0577058f, 0.0461646f, 0.0789644f, 0.0770591f, 0.0763826f,
+    0.0755185f, 0.0754125f, 0.0734614f, 0.0705112f, 0.073302f,
+    0.0703354f, 0.0690928f, 0.0634788f, 0.0476091f, 0.0380873f,
+    0.0659843f, 0.0637096f, 0.0631414f, 0.062466f, 0.0623907f,
+    0.0608109f, 0.0583932f, 0.0612713f, 0.0584536f, 0.0584163f,
+    0.0529249f, 0.0396937f, 0.0319219f, 0.0520461f, 0.0508054f,
+    0.0503826f, 0.0498228f, 0.0497375f, 0.048445f, 0.046487f,
+    0.0484338f, 0.0463625f, 0.0461381f, 0.0418604f, 0.0313953f,
+    0.0252141f, 0.048172f, 0.0467363f, 0.0463657f, 0.0458011f,
+    0.0457015f, 0.0444662f, 0.0426327f, 0.0436912f, 0.0422419f,
+    0.0408912f, 0.037917f, 0.0284377f, 0.0227501f, 0.0477841f,
+    0.0462856f, 0.0459174f, 0.045344f, 0.0452434f, 0.0440093f,
+    0.0421886f, 0.0430351f, 0.0417358f, 0.0402241f, 0.0374068f,
+    0.0280551f, 0.0224441f, 0.0477422f, 0.0462278f, 0.0458584f,
+    0.0452824f, 0.0451823f, 0.0439474f, 0.0421288f, 0.0429264f,
+    0.0416624f, 0.0401524f, 0.0373315f, 0.0279986f, 0.0223989f,
+    0.130226f, 0.126095f, 0.125088f, 0.123516f, 0.123243f,
+    0.119875f, 0.114914f, 0.117089f, 0.113642f, 0.109523f,
+    0.101829f, 0.0763716f, 0.0610972f, 0.110793f, 0.107878f,
+    0.106955f, 0.105707f, 0.105534f, 0.10276f, 0.098597f,
+    0.101919f, 0.0981103f, 0.0955797f, 0.0883664f, 0.0662748f,
+    0.0530198f, 0.0968895f, 0.094528f, 0.0937136f, 0.0926541f,
+    0.0925122f, 0.0901091f, 0.0864791f, 0.0898886f, 0.0862284f,
+    0.0849031f, 0.0778125f, 0.0583594f, 0.0466875f, 0.0838742f,
+    0.0816239f, 0.0809547f, 0.0800109f, 0.079859f, 0.0777432f,
+    0.0745727f, 0.0770512f, 0.0741373f, 0.0726249f, 0.0667479f,
+    0.0500609f, 0.0400487f, 0.0800001f, 0.0775548f, 0.0769379f,
+    0.0759893f, 0.075823f, 0.0737644f, 0.0707184f, 0.0723085f,
+    0.0700166f, 0.0674936f, 0.0628045f, 0.0471034f, 0.0376827f,
+    0.0796122f, 0.077104f, 0.0764896f, 0.0755322f, 0.0753649f,
+    0.0733075f, 0.0702743f, 0.0716524f, 0.0695106f, 0.0669923f,
+    0.0622944f, 0.0467208f, 0.0373766f, 0.0795703f, 0.0770463f,
+    0.0764306f, 0.0754706f, 0.0753038f, 0.0732455f, 0.0702146f,
+    0.0715437f, 0.0694371f, 0.0669207f, 0.062219f, 0.0466643f,
+    0.0373314f, 0.368937f, 0.357234f, 0.354379f, 0.349928f,
+    0.349155f, 0.339611f, 0.325558f, 0.33172f, 0.321953f,
+    0.310285f, 0.288485f, 0.216364f, 0.173091f, 0.349503f,
+    0.339016f, 0.336246f, 0.332118f, 0.331445f, 0.322496f,
+    0.30924f, 0.31655f, 0.306421f, 0.295449f, 0.275023f,
+    0.206267f, 0.165014f, 0.3356f, 0.325667f, 0.323005f,
+    0.319065f, 0.318424f, 0.309845f, 0.297122f, 0.304519f,
+    0.294539f, 0.28402f, 0.264469f, 0.198352f, 0.158682f,
+    0.322585f, 0.312762f, 0.310246f, 0.306422f, 0.30577f,
+    0.297479f, 0.285216f, 0.291681f, 0.282448f, 0.272296f,
+    0.253405f, 0.190053f, 0.152043f, 0.318711f, 0.308693f,
+    0.306229f, 0.302401f, 0.301734f, 0.293501f, 0.281362f,
+    0.286939f, 0.278327f, 0.268255f, 0.249461f, 0.187096f,
+    0.149677f, 0.318323f, 0.308243f, 0.305781f, 0.301943f,
+    0.301276f, 0.293044f, 0.280918f, 0.286283f, 0.277821f,
+    0.267754f, 0.248951f, 0.186713f, 0.149371f, 0.318281f,
+    0.308185f, 0.305722f, 0.301882f, 0.301215f, 0.292982f,
+    0.280858f, 0.286174f, 0.277748f, 0.267682f, 0.248876f,
+    0.186657f, 0.149325f, 0.0541107f, 0.0525384f, 0.0483684f,
+    0.0481569f, 0.0467254f, 0.0454266f, 0.043487f, 0.0419221f,
+    0.0398647f, 0.0368449f, 0.03196f, 0.02397f, 0.019176f,
+    0.0354797f, 0.032969f, 0.031564f, 0.0314681f, 0.0309665f,
+    0.0299417f, 0.0304023f, 0.0278468f, 0.0262459f, 0.0259781f,
+    0.0225436f, 0.0169077f, 0.0135261f, 0.0275426f, 0.02693f,
+    0.0258612f, 0.0249418f, 0.0246969f, 0.0234075f, 0.0229803f,
+    0.0216505f, 0.0213353f, 0.0216332f, 0.0180277f, 0.0135208f,
+    0.0108166f, 0.0233476f, 0.0226858f, 0.0219415f, 0.0210805f,
+    0.0204671f, 0.0193679f, 0.0183825f, 0.0175243f, 0.0160937f,
+    0.015209f, 0.0126742f, 0.00950565f, 0.00760452f, 0.0142402f,
+    0.0138307f, 0.0135611f, 0.0130814f, 0.0125316f, 0.012025f,
+    0.0113493f, 0.0109532f, 0.00983185f, 0.0092871f, 0.00773925f,
+    0.00620275f, 0.00496221f, 0.00857428f, 0.00951053f, 0.0116579f,
+    0.0101896f, 0.00920168f, 0.00861901f, 0.00773666f, 0.00715474f,
+    0.00650734f, 0.00601157f, 0.00500964f, 0.00427925f, 0.0034234f,
+    0.00433149f, 0.00439219f, 0.00609536f, 0.00493839f, 0.00412807f,
+    0.00358177f, 0.00309522f, 0.00272716f, 0.00240687f, 0.0020075f,
+    0.00167292f, 0.00165103f, 0.00132082f, 0.0711101f, 0.0690438f,
+    0.0635638f, 0.0632859f, 0.0614045f, 0.0596979f, 0.0571489f,
+    0.0550923f, 0.0523885f, 0.0484201f, 0.0420005f, 0.0315004f,
+    0.0252003f, 0.0511925f, 0.0494744f, 0.0455568f, 0.0454481f,
+    0.0446843f, 0.0432704f, 0.0422302f, 0.0407591f, 0.0385569f,
+    0.0375533f, 0.0318929f, 0.024139f, 0.0193112f, 0.0401133f,
+    0.0367509f, 0.0349526f, 0.0341033f, 0.0335941f, 0.0325505f,
+    0.0348082f, 0.0320337f, 0.030106f, 0.0296227f, 0.0255843f,
+    0.0193183f, 0.0154546f, 0.0306774f, 0.0299271f, 0.0288728f,
+    0.0278408f, 0.0273619f, 0.0259836f, 0.0249544f, 0.0239446f,
+    0.0226827f, 0.0231985f, 0.0193321f, 0.014499f, 0.0115992f,
+    0.0215699f, 0.021072f, 0.0204924f, 0.0198417f, 0.0194264f,
+    0.0186407f, 0.0179212f, 0.0173734f, 0.0161195f, 0.0165069f,
+    0.0137558f, 0.0103168f, 0.00825347f, 0.0170643f, 0.0165701f,
+    0.0152528f, 0.0151848f, 0.0147435f, 0.0143322f, 0.0140949f,
+    0.0132913f, 0.0130554f, 0.0130878f, 0.0109065f, 0.0081799f,
+    0.00654392f, 0.0169995f, 0.0165056f, 0.0151955f, 0.015129f,
+    0.0146793f, 0.0142713f, 0.013662f, 0.0131704f, 0.012524f,
+    0.0115795f, 0.0100407f, 0.00753053f, 0.00602442f, 0.0881095f,
+    0.0855492f, 0.0787592f, 0.0784149f, 0.0760837f, 0.073969f,
+    0.0708108f, 0.0682625f, 0.0649124f, 0.0599952f, 0.0520411f,
+    0.0390308f, 0.0312246f, 0.0677533f, 0.0659798f, 0.0607426f,
+    0.060577f, 0.0589878f, 0.0575416f, 0.0552506f, 0.0538138f,
+    0.0510807f, 0.0491285f, 0.0416204f, 0.0315228f, 0.0252183f,
+    0.0540697f, 0.0516938f, 0.0481611f, 0.0480432f, 0.0473119f,
+    0.0457777f, 0.0466361f, 0.0428431f, 0.0403962f, 0.0399588f,
+    0.0346443f, 0.0259833f, 0.0207866f, 0.0408451f, 0.0379161f,
+    0.0358041f, 0.0347712f, 0.0342567f, 0.0331065f, 0.0356394f,
+    0.0328929f, 0.0314533f, 0.0311879f, 0.0262573f, 0.0197253f,
+    0.0157802f, 0.034556f, 0.0335639f, 0.0308925f, 0.0307575f,
+    0.0298883f, 0.029064f, 0.0284159f, 0.0268848f, 0.0255915f,
+    0.0244964f, 0.021084f, 0.015813f, 0.0126504f, 0.0340637f,
+    0.0330755f, 0.0304482f, 0.0303138f, 0.0294227f, 0.0286034f,
+    0.0273874f, 0.0264085f, 0.0251163f, 0.0234353f, 0.0201597f,
+    0.0151198f, 0.0120958f, 0.0339989f, 0.033011f, 0.0303909f,
+    0.030258f, 0.0293585f, 0.0285425f, 0.0273238f, 0.0263406f,
+    0.0250478f, 0.0231547f, 0.0200812f, 0.0150609f, 0.0120487f,
+    0.105109f, 0.102055f, 0.0939546f, 0.0935438f, 0.0907629f,
+    0.0882402f, 0.0844726f, 0.0814328f, 0.0774363f, 0.0715704f,
+    0.0620816f, 0.0465612f, 0.037249f, 0.0847527f, 0.0824852f,
+    0.075938f, 0.075706f, 0.073667f, 0.0718128f, 0.0689125f,
+    0.0668684f, 0.0636046f, 0.0607036f, 0.0516432f, 0.0389067f,
+    0.0311395f, 0.0700274f, 0.0681992f, 0.0627754f, 0.0626004f,
+    0.0610298f, 0.0595124f, 0.058464f, 0.0558977f, 0.0529201f,
+    0.051534f, 0.0438448f, 0.0331317f, 0.0265054f, 0.0559575f,
+    0.0544215f, 0.0500845f, 0.0499001f, 0.0485845f, 0.0473207f,
+    0.0474673f, 0.0442017f, 0.0419235f, 0.0407844f, 0.0353174f,
+    0.026488f, 0.0211904f, 0.0515553f, 0.0500693f, 0.0460879f,
+    0.0458865f, 0.0445675f, 0.0433351f, 0.0415116f, 0.0400551f,
+    0.0381153f, 0.035964f, 0.030681f, 0.0230444f, 0.018455f,
+    0.051063f, 0.0495809f, 0.0456436f, 0.0454427f, 0.0441019f,
+    0.0428746f, 0.0410493f, 0.0395787f, 0.0376401f, 0.0350105f,
+    0.0302002f, 0.0226502f, 0.0181201f, 0.0509983f, 0.0495164f,
+    0.0455862f, 0.0453869f, 0.0440377f, 0.0428137f, 0.0409857f,
+    0.0395108f, 0.0375717f, 0.0347298f, 0.0301217f, 0.0225913f,
+    0.0180731f, 0.139108f, 0.135066f, 0.124345f, 0.123802f,
+    0.120121f, 0.116783f, 0.111796f, 0.107773f, 0.102484f,
+    0.0947207f, 0.0821626f, 0.0616219f, 0.0492976f, 0.118751f,
+    0.115496f, 0.106329f, 0.105964f, 0.103025f, 0.100355f,
+    0.0962362f, 0.0930196f, 0.0886523f, 0.083854f, 0.0716886f,
+    0.0538575f, 0.0431321f, 0.104026f, 0.10121f, 0.0931661f,
+    0.0928583f, 0.0903604f, 0.0880548f, 0.0844919f, 0.0820071f,
+    0.0779678f, 0.0746843f, 0.0633488f, 0.0478995f, 0.0383195f,
+    0.0899562f, 0.0874323f, 0.0804753f, 0.0801581f, 0.0779429f,
+    0.0758631f, 0.0727381f, 0.070311f, 0.0669712f, 0.0639348f,
+    0.0542348f, 0.0410003f, 0.0328002f, 0.0855541f, 0.0830802f,
+    0.0764787f, 0.0761444f, 0.073926f, 0.0718776f, 0.0688353f,
+    0.0663956f, 0.063163f, 0.0591143f, 0.050762f, 0.0380715f,
+    0.0304572f, 0.0850618f, 0.0825918f, 0.0760344f, 0.0757006f,
+    0.0734603f, 0.071417f, 0.068373f, 0.0659191f, 0.0626878f,
+    0.0581608f, 0.0502813f, 0.037711f, 0.0301688f, 0.084997f,
+    0.0825273f, 0.075977f, 0.0756449f, 0.0733961f, 0.0713561f,
+    0.0683094f, 0.0658512f, 0.0626195f, 0.0578801f, 0.0502028f,
+    0.0376521f, 0.0301217f, 0.394098f, 0.382647f, 0.352276f,
+    0.350736f, 0.340309f, 0.330851f, 0.316724f, 0.305326f,
+    0.290342f, 0.268348f, 0.232771f, 0.174578f, 0.139662f,
+    0.373742f, 0.363077f, 0.33426f, 0.332898f, 0.323213f,
+    0.314423f, 0.301164f, 0.290573f, 0.27651f, 0.257481f,
+    0.222293f, 0.16672f, 0.133376f, 0.359017f, 0.348792f,
+    0.321097f, 0.319793f, 0.310548f, 0.302123f, 0.28942f,
+    0.279299f, 0.265826f, 0.248312f, 0.213886f, 0.160415f,
+    0.128332f, 0.344947f, 0.335014f, 0.308406f, 0.307092f,
+    0.298131f, 0.289931f, 0.277666f, 0.267843f, 0.254829f,
+    0.237562f, 0.204792f, 0.153594f, 0.122875f, 0.340545f,
+    0.330662f, 0.304409f, 0.303079f, 0.294114f, 0.285946f,
+    0.273763f, 0.263949f, 0.251021f, 0.232742f, 0.20137f,
+    0.151027f, 0.120822f, 0.340053f, 0.330173f, 0.303965f,
+    0.302635f, 0.293648f, 0.285485f, 0.273301f, 0.263472f,
+    0.250546f, 0.231788f, 0.200889f, 0.150667f, 0.120533f,
+    0.339988f, 0.330109f, 0.303908f, 0.302579f, 0.293584f,
+    0.285424f, 0.273237f, 0.263405f, 0.250477f, 0.231507f,
+    0.200811f, 0.150608f, 0.120486f, 0.0504519f, 0.0499093f,
+    0.0491914f, 0.047233f, 0.0459504f, 0.043682f, 0.0412805f,
+    0.0389545f, 0.0359384f, 0.0305069f, 0.0256612f, 0.0192528f,
+    0.0154022f, 0.035034f, 0.0335655f, 0.0343255f, 0.0341514f,
+    0.0331846f, 0.0321266f, 0.0330289f, 0.0299154f, 0.0273976f,
+    0.0242956f, 0.0202664f, 0.0151998f, 0.0121598f, 0.0279514f,
+    0.0292895f, 0.0281421f, 0.026886f, 0.0262689f, 0.0255469f,
+    0.026033f, 0.0239562f, 0.0224713f, 0.0202427f, 0.0168933f,
+    0.0126699f, 0.010136f, 0.0194728f, 0.0201482f, 0.0191883f,
+    0.0183373f, 0.0180237f, 0.0170733f, 0.0157818f, 0.0151142f,
+    0.0140243f, 0.0131066f, 0.0109222f, 0.00819162f, 0.00655329f,
+    0.0102322f, 0.0103414f, 0.0108061f, 0.0104825f, 0.010047f,
+    0.00930946f, 0.00854229f, 0.0081075f, 0.00753458f, 0.00719702f,
+    0.00599751f, 0.00449814f, 0.00359851f, 0.0057313f, 0.00715965f,
+    0.00739006f, 0.00713832f, 0.00684712f, 0.00623822f, 0.00561191f,
+    0.00527771f, 0.00483208f, 0.00435138f, 0.00362615f, 0.00271961f,
+    0.00217569f, 0.00127855f, 0.00277004f, 0.00274914f, 0.00261673f,
+    0.00249477f, 0.00219602f, 0.00191364f, 0.00176595f, 0.00157725f,
+    0.00132153f, 0.00110127f, 0.000972725f, 0.00077818f, 0.0663018f,
+    0.0655888f, 0.0646453f, 0.0620717f, 0.0603861f, 0.057405f,
+    0.0542492f, 0.0511924f, 0.0472287f, 0.0400909f, 0.0337229f,
+    0.0253013f, 0.020241f, 0.0504534f, 0.0470162f, 0.0469484f,
+    0.0467071f, 0.045347f, 0.0438937f, 0.0453254f, 0.0409006f,
+    0.0373323f, 0.032943f, 0.0274772f, 0.0208306f, 0.0166645f,
+    0.0382146f, 0.0389972f, 0.0395068f, 0.0393773f, 0.0384312f,
+    0.037314f, 0.0383296f, 0.0349415f, 0.0324061f, 0.0288901f,
+    0.0241041f, 0.0180781f, 0.0144624f, 0.029248f, 0.0298558f,
+    0.0286605f, 0.027522f, 0.0270959f, 0.0260072f, 0.0268456f,
+    0.0248622f, 0.0239591f, 0.0215584f, 0.0179983f, 0.0134987f,
+    0.010799f, 0.0200074f, 0.0188899f, 0.0182636f, 0.0185653f,
+    0.0178793f, 0.0175443f, 0.0184335f, 0.0171684f, 0.0170638f,
+    0.0153138f, 0.0127926f, 0.00959444f, 0.00767555f, 0.0159962f,
+    0.0157395f, 0.0155206f, 0.0149053f, 0.0146311f, 0.014443f,
+    0.0153037f, 0.0141644f, 0.0139922f, 0.0124764f, 0.0104232f,
+    0.00781745f, 0.00625395f, 0.0158505f, 0.0156796f, 0.0154541f,
+    0.0148388f, 0.0144358f, 0.0137232f, 0.0129688f, 0.012238f,
+    0.0112905f, 0.00963668f, 0.00806288f, 0.00605259f, 0.00484207f,
+    0.0821517f, 0.0812682f, 0.0800992f, 0.0769103f, 0.0748219f,
+    0.0711282f, 0.0672178f, 0.0634304f, 0.0585191f, 0.049675f,
+    0.0417846f, 0.0313497f, 0.0250798f, 0.0663033f, 0.0626956f,
+    0.0620125f, 0.0596947f, 0.0582569f, 0.0556607f, 0.0576219f,
+    0.0518859f, 0.0472671f, 0.0415904f, 0.034688f, 0.0266661f,
+    0.0213329f, 0.0532625f, 0.0508604f, 0.0521296f, 0.0519329f,
+    0.0505936f, 0.049081f, 0.0506261f, 0.0459267f, 0.0423408f,
+    0.0375374f, 0.0313148f, 0.0234861f, 0.0187889f, 0.0390232f,
+    0.0395634f, 0.0393933f, 0.0393872f, 0.0386993f, 0.0377742f,
+    0.0391421f, 0.0358475f, 0.0338938f, 0.0302058f, 0.0252091f,
+    0.0189068f, 0.0151254f, 0.0326761f, 0.0318806f, 0.0314594f,
+    0.0303385f, 0.0299188f, 0.0293113f, 0.03073f, 0.0281537f,
+    0.0269986f, 0.0239612f, 0.0200034f, 0.0150025f, 0.012002f,
+    0.0318461f, 0.031419f, 0.0309745f, 0.029744f, 0.0289317f,
+    0.0275086f, 0.0276002f, 0.0251496f, 0.023927f, 0.0211238f,
+    0.0176341f, 0.0132256f, 0.0105804f, 0.0317004f, 0.031359f,
+    0.030908f, 0.0296775f, 0.0288716f, 0.0274463f, 0.0259374f,
+    0.024476f, 0.0225809f, 0.0191727f, 0.0161246f, 0.0120999f,
+    0.00967993f, 0.0980017f, 0.0969477f, 0.0955532f, 0.091749f,
+    0.0892576f, 0.0848512f, 0.0801864f, 0.0756683f, 0.0698095f,
+    0.059259f, 0.0498463f, 0.0373981f, 0.0299185f, 0.0821532f,
+    0.0783751f, 0.0774664f, 0.0745334f, 0.0726829f, 0.0692996f,
+    0.0699185f, 0.0628712f, 0.0577327f, 0.0503446f, 0.0420798f,
+    0.0325016f, 0.0260013f, 0.0689672f, 0.0647973f, 0.0647525f,
+    0.0644886f, 0.0627559f, 0.060848f, 0.0629226f, 0.056912f,
+    0.0522756f, 0.0461848f, 0.0385257f, 0.0288943f, 0.0231154f,
+    0.0542446f, 0.0516944f, 0.0520161f, 0.0519428f, 0.0508616f,
+    0.0495412f, 0.0514386f, 0.0468328f, 0.0438286f, 0.0388532f,
+    0.0324199f, 0.0243149f, 0.0194519f, 0.048526f, 0.0475601f,
+    0.0469134f, 0.0450612f, 0.0438296f, 0.0416981f, 0.0430265f,
+    0.0391389f, 0.0369333f, 0.0326086f, 0.0272142f, 0.0204106f,
+    0.0163285f, 0.0476961f, 0.0470985f, 0.0464284f, 0.0445827f,
+    0.0433674f, 0.0412317f, 0.0398967f, 0.036784f, 0.0339423f,
+    0.0297712f, 0.0248449f, 0.0186336f, 0.0149069f, 0.0475503f,
+    0.0470385f, 0.0463619f, 0.0445162f, 0.0433073f, 0.0411694f,
+    0.0389061f, 0.0367139f, 0.0338712f, 0.0287568f, 0.0241863f,
+    0.0181473f, 0.0145178f, 0.129702f, 0.128307f, 0.126461f,
+    0.121426f, 0.118129f, 0.112298f, 0.106124f, 0.100144f,
+    0.0923902f, 0.078427f, 0.0659698f, 0.0494951f, 0.0395961f,
+    0.113853f, 0.109734f, 0.108374f, 0.104211f, 0.101535f,
+    0.0967458f, 0.0945115f, 0.0868453f, 0.0803134f, 0.0695127f,
+    0.0581657f, 0.0444448f, 0.0355558f, 0.100667f, 0.0961562f,
+    0.0950354f, 0.09142f, 0.0891285f, 0.0849539f, 0.0875157f,
+    0.0788825f, 0.0721451f, 0.0634796f, 0.0529473f, 0.0405565f,
+    0.0324452f, 0.0859445f, 0.0830534f, 0.0820145f, 0.0788337f,
+    0.0767685f, 0.0730973f, 0.0760316f, 0.0688033f, 0.0636981f,
+    0.056148f, 0.0468415f, 0.0351823f, 0.0281458f, 0.0802259f,
+    0.078919f, 0.0778212f, 0.0747386f, 0.0726988f, 0.0691443f,
+    0.0676196f, 0.061748f, 0.0570023f, 0.0499035f, 0.0416358f,
+    0.0315461f, 0.0252369f, 0.0793959f, 0.0784574f, 0.0773363f,
+    0.07426f, 0.072239f, 0.0686779f, 0.0649084f, 0.0612599f,
+    0.056523f, 0.0481762f, 0.0404408f, 0.030476f, 0.0243808f,
+    0.0792502f, 0.0783975f, 0.0772698f, 0.0741935f, 0.0721788f,
+    0.0686156f, 0.0648434f, 0.0611897f, 0.056452f, 0.0479248f,
+    0.0403097f, 0.0302427f, 0.0241942f, 0.36745f, 0.363499f,
+    0.35827f, 0.344007f, 0.334665f, 0.318144f, 0.300654f,
+    0.283713f, 0.261746f, 0.222187f, 0.186896f, 0.140222f,
+    0.112178f, 0.351602f, 0.344926f, 0.340183f, 0.326791f,
+    0.318008f, 0.302592f, 0.286236f, 0.270414f, 0.249669f,
+    0.213273f, 0.179028f, 0.134838f, 0.10787f, 0.338416f,
+    0.331348f, 0.326844f, 0.314f, 0.305557f, 0.290801f,
+    0.275143f, 0.260014f, 0.240122f, 0.205712f, 0.172496f,
+    0.130301f, 0.104241f, 0.323693f, 0.318245f, 0.313823f,
+    0.301414f, 0.293243f, 0.278944f, 0.263793f, 0.249154f,
+    0.230012f, 0.196793f, 0.165048f, 0.124621f, 0.099697f,
+    0.317975f, 0.314111f, 0.30963f, 0.297319f, 0.289235f,
+    0.274991f, 0.259911f, 0.245317f, 0.226358f, 0.192752f,
+    0.161914f, 0.121775f, 0.0974196f, 0.317145f, 0.313649f,
+    0.309145f, 0.29684f, 0.288775f, 0.274524f, 0.259438f,
+    0.244829f, 0.225879f, 0.191937f, 0.161366f, 0.121165f,
+    0.0969325f, 0.316999f, 0.31359f, 0.309079f, 0.296774f,
+    0.288715f, 0.274462f, 0.259373f, 0.244758f, 0.225808f,
+    0.191685f, 0.161235f, 0.120969f, 0.0967756f, 0.0493954f,
+    0.0496019f, 0.048502f, 0.0473076f, 0.0458051f, 0.0423886f,
+    0.0402979f, 0.037365f, 0.034151f, 0.0281799f, 0.0236247f,
+    0.0177562f, 0.0142049f, 0.0365322f, 0.0396732f, 0.038101f,
+    0.0358856f, 0.0349737f, 0.0330879f, 0.0346104f, 0.0309296f,
+    0.0274609f, 0.0223591f, 0.0186735f, 0.0140051f, 0.0112041f,
+    0.0306565f, 0.0332968f, 0.0321242f, 0.0303871f, 0.0296835f,
+    0.0282941f, 0.0287767f, 0.026217f, 0.0234421f, 0.0192635f,
+    0.0161077f, 0.0120808f, 0.00966463f, 0.0173368f, 0.0189547f,
+    0.0186421f, 0.0180675f, 0.018154f, 0.017962f, 0.0180939f,
+    0.0173552f, 0.0158181f, 0.013339f, 0.0111935f, 0.00839513f,
+    0.00671611f, 0.0102063f, 0.00861656f, 0.00773154f, 0.00747448f,
+    0.00766598f, 0.00833656f, 0.00892459f, 0.00945289f, 0.00894163f,
+    0.00795018f, 0.00672314f, 0.00504236f, 0.00403389f, 0.00712654f,
+    0.00580185f, 0.00487114f, 0.00484505f, 0.00453265f, 0.00429057f,
+    0.00478811f, 0.00566317f, 0.00558307f, 0.00528162f, 0.00451013f,
+    0.0033826f, 0.00270608f, 0.00330517f, 0.00235986f, 0.00189088f,
+    0.00175662f, 0.0016536f, 0.00152002f, 0.00138245f, 0.00155973f,
+    0.00176931f, 0.00208865f, 0.00185931f, 0.00139448f, 0.00111558f,
+    0.0649134f, 0.0651848f, 0.0637393f, 0.0621698f, 0.0601952f,
+    0.0557054f, 0.0529579f, 0.0491036f, 0.0448798f, 0.0370329f,
+    0.0310466f, 0.0233344f, 0.0186675f, 0.0488228f, 0.0530456f,
+    0.0509338f, 0.0479897f, 0.0468452f, 0.0443287f, 0.0469184f,
+    0.0417685f, 0.0370333f, 0.030101f, 0.0251336f, 0.0193065f,
+    0.0154452f, 0.042947f, 0.0466693f, 0.0449571f, 0.0424912f,
+    0.041555f, 0.0395348f, 0.0410848f, 0.0370559f, 0.0330145f,
+    0.0270053f, 0.0225678f, 0.0169259f, 0.0135407f, 0.0296274f,
+    0.0323272f, 0.0314749f, 0.0301716f, 0.0300255f, 0.0292028f,
+    0.0304019f, 0.0281941f, 0.0253905f, 0.0210809f, 0.0176536f,
+    0.0132402f, 0.0105922f, 0.019245f, 0.0199222f, 0.0195854f,
+    0.0191004f, 0.0195375f, 0.0195773f, 0.0212327f, 0.0202918f,
+    0.018514f, 0.015692f, 0.0131833f, 0.00988744f, 0.00790995f,
+    0.0156679f, 0.0156375f, 0.0152924f, 0.0149219f, 0.0152054f,
+    0.0153007f, 0.0170962f, 0.0165021f, 0.0151555f, 0.0130235f,
+    0.0109702f, 0.00822768f, 0.00658214f, 0.0155191f, 0.015583f,
+    0.0152374f, 0.0148622f, 0.0143902f, 0.0133169f, 0.0132217f,
+    0.0123986f, 0.0113417f, 0.0098305f, 0.00831942f, 0.00623956f,
+    0.00499165f, 0.0804314f, 0.0807677f, 0.0789767f, 0.0770319f,
+    0.0745854f, 0.0690221f, 0.0656179f, 0.0608421f, 0.0556087f,
+    0.0458859f, 0.0384686f, 0.0289127f, 0.0231301f, 0.0637922f,
+    0.066418f, 0.0637667f, 0.0600938f, 0.0587167f, 0.0555695f,
+    0.0592264f, 0.0526074f, 0.0467201f, 0.0382098f, 0.0319944f,
+    0.0247701f, 0.0198161f, 0.0552376f, 0.0600417f, 0.0577899f,
+    0.0545953f, 0.0534265f, 0.0507756f, 0.0533928f, 0.0478948f,
+    0.0425869f, 0.0347472f, 0.0290279f, 0.0217709f, 0.0174168f,
+    0.0419179f, 0.0456996f, 0.0443077f, 0.0422757f, 0.041897f,
+    0.0404435f, 0.04271f, 0.039033f, 0.0349629f, 0.0288227f,
+    0.0241137f, 0.0180853f, 0.0144682f, 0.0319249f, 0.0332947f,
+    0.0324182f, 0.0312045f, 0.031409f, 0.0308181f, 0.0335407f,
+    0.0311307f, 0.0280864f, 0.0234339f, 0.0196433f, 0.0147325f,
+    0.011786f, 0.031186f, 0.0312204f, 0.0305297f, 0.029784f,
+    0.0288424f, 0.026695f, 0.0294043f, 0.0273409f, 0.0247279f,
+    0.0207653f, 0.0174303f, 0.0130728f, 0.0104582f, 0.0310371f,
+    0.0311659f, 0.0304748f, 0.0297243f, 0.0287803f, 0.0266336f,
+    0.0255298f, 0.0234772f, 0.0214578f, 0.0177092f, 0.0148449f,
+    0.0111616f, 0.00892925f, 0.0959494f, 0.0963506f, 0.094214f,
+    0.091894f, 0.0889754f, 0.0823389f, 0.0782778f, 0.0725807f,
+    0.0663375f, 0.0547389f, 0.0458905f, 0.0344909f, 0.0275928f,
+    0.0793102f, 0.0797905f, 0.0765995f, 0.0745863f, 0.0725022f,
+    0.0683511f, 0.0715345f, 0.0634462f, 0.056748f, 0.0467923f,
+    0.0392975f, 0.0302386f, 0.0241909f, 0.0675281f, 0.0734142f,
+    0.0706227f, 0.0666994f, 0.065298f, 0.0620163f, 0.0657008f,
+    0.0587337f, 0.0521593f, 0.042489f, 0.035488f, 0.0267681f,
+    0.0214144f, 0.0542085f, 0.0590721f, 0.0571406f, 0.0543797f,
+    0.0537685f, 0.0516843f, 0.055018f, 0.0498719f, 0.0445352f,
+    0.0365646f, 0.0305738f, 0.0229304f, 0.0183443f, 0.0474429f,
+    0.0472391f, 0.0462062f, 0.0451063f, 0.0437038f, 0.0420588f,
+    0.0458488f, 0.0419696f, 0.0376588f, 0.0311757f, 0.0261035f,
+    0.0195776f, 0.0156621f, 0.046704f, 0.0468033f, 0.0457671f,
+    0.0446462f, 0.0432324f, 0.0400117f, 0.0417123f, 0.0381798f,
+    0.0343002f, 0.0285072f, 0.0238905f, 0.0179178f, 0.0143343f,
+    0.0465551f, 0.0467488f, 0.0457121f, 0.0445865f, 0.0431704f,
+    0.0399504f, 0.03798f, 0.0352158f, 0.0321867f, 0.0265619f,
+    0.0222669f, 0.0167398f, 0.0133919f, 0.126985f, 0.127516f,
+    0.124689f, 0.121618f, 0.117756f, 0.108972f, 0.103598f,
+    0.0960578f, 0.0877952f, 0.0724449f, 0.0607343f, 0.0456475f,
+    0.036518f, 0.110346f, 0.108863f, 0.106629f, 0.104311f,
+    0.101282f, 0.0947261f, 0.0961507f, 0.085124f, 0.0768745f,
+    0.0644832f, 0.0540243f, 0.0411757f, 0.0329405f, 0.0973032f,
+    0.100159f, 0.0962885f, 0.091472f, 0.0890411f, 0.0844979f,
+    0.0903171f, 0.0804115f, 0.0713041f, 0.0581922f, 0.0486063f,
+    0.0376558f, 0.0301246f, 0.0835471f, 0.085817f, 0.0828062f,
+    0.0788834f, 0.0775116f, 0.0741658f, 0.0796342f, 0.0715497f,
+    0.06368f, 0.0520482f, 0.043494f, 0.0326211f, 0.0260969f,
+    0.0784789f, 0.0784049f, 0.0766809f, 0.0748305f, 0.0724839f,
+    0.0671062f, 0.0704649f, 0.0636473f, 0.0568036f, 0.0466594f,
+    0.0390237f, 0.0293135f, 0.0234508f, 0.07774f, 0.0779691f,
+    0.0762417f, 0.0743704f, 0.0720126f, 0.0666453f, 0.0663284f,
+    0.0598576f, 0.0537203f, 0.0445447f, 0.0372319f, 0.0282005f,
+    0.0225604f, 0.0775911f, 0.0779146f, 0.0761868f, 0.0743107f,
+    0.0719506f, 0.066584f, 0.0632999f, 0.0586929f, 0.0536444f,
+    0.0442671f, 0.0371107f, 0.0278964f, 0.0223171f, 0.359756f,
+    0.36126f, 0.353249f, 0.34455f, 0.333607f, 0.308724f,
+    0.293497f, 0.272136f, 0.248728f, 0.20524f, 0.172063f,
+    0.129321f, 0.103457f, 0.343116f, 0.342606f, 0.335189f,
+    0.327242f, 0.317134f, 0.293736f, 0.280772f, 0.259565f,
+    0.237436f, 0.197164f, 0.164826f, 0.124376f, 0.0995007f,
+    0.330073f, 0.329078f, 0.321979f, 0.314404f, 0.304742f,
+    0.282306f, 0.274938f, 0.249634f, 0.228416f, 0.190337f,
+    0.158957f, 0.120308f, 0.0962463f, 0.316317f, 0.316156f,
+    0.30924f, 0.301815f, 0.292396f, 0.270743f, 0.264255f,
+    0.239131f, 0.21873f, 0.182058f, 0.152031f, 0.115065f,
+    0.0920518f, 0.311249f, 0.312148f, 0.305241f, 0.297762f,
+    0.288335f, 0.266858f, 0.255086f, 0.235341f, 0.215142f,
+    0.178099f, 0.149066f, 0.112329f, 0.0898632f, 0.31051f,
+    0.311713f, 0.304802f, 0.297303f, 0.287864f, 0.266397f,
+    0.253268f, 0.234845f, 0.214653f, 0.17728f, 0.148561f,
+    0.111768f, 0.0894144f, 0.310361f, 0.311658f, 0.304747f,
+    0.297243f, 0.287802f, 0.266336f, 0.253199f, 0.234771f,
+    0.214577f, 0.177061f, 0.14844f, 0.11157f, 0.0892563f,
+    0.160231f, 0.127666f, 0.110209f, 0.0734728f, 0.0896f,
+    0.0778337f, 0.06828f, 0.0693647f, 0.0792769f, 0.0634216f,
+    0.0549649f, 0.0488181f, 0.039691f, 0.113516f, 0.0772948f,
+    0.0762162f, 0.0508108f, 0.0607929f, 0.0526581f, 0.0474288f,
+    0.0465466f, 0.0487991f, 0.0390393f, 0.0349318f, 0.0302039f,
+    0.0302801f, 0.0994642f, 0.0533848f, 0.0517035f, 0.0485946f,
+    0.0373483f, 0.0330225f, 0.0346161f, 0.0311494f, 0.0285445f,
+    0.0323082f, 0.028257f, 0.0255794f, 0.0214188f, 0.0869513f,
+    0.0430749f, 0.0592533f, 0.0528469f, 0.0396352f, 0.0317082f,
+    0.0264235f, 0.0251121f, 0.0256477f, 0.0270576f, 0.0233614f,
+    0.017521f, 0.0140168f, 0.0530511f, 0.0322881f, 0.0545872f,
+    0.0455382f, 0.0341537f, 0.0273229f, 0.0227691f, 0.0195164f,
+    0.0215733f, 0.0212731f, 0.0177276f, 0.0132957f, 0.0116262f,
+    0.0283761f, 0.0212178f, 0.0443939f, 0.0350922f, 0.0263191f,
+    0.0210553f, 0.0175461f, 0.0150395f, 0.0161998f, 0.0151209f,
+    0.0126007f, 0.00945056f, 0.00930883f, 0.00265224f, 0.00393875f,
+    0.0175556f, 0.0124609f, 0.00934569f, 0.00747655f, 0.00623046f,
+    0.00612884f, 0.00536273f, 0.00549051f, 0.00457543f, 0.00343157f,
+    0.00340008f, 0.210569f, 0.167774f, 0.144833f, 0.096555f,
+    0.117749f, 0.102286f, 0.0897307f, 0.0911563f, 0.104183f,
+    0.083346f, 0.0722327f, 0.0641548f, 0.0521603f, 0.163854f,
+    0.117368f, 0.11084f, 0.073893f, 0.0889416f, 0.0771102f,
+    0.0658319f, 0.0683382f, 0.0737047f, 0.0589638f, 0.0520984f,
+    0.0455405f, 0.0427494f, 0.124598f, 0.0821148f, 0.0829907f,
+    0.0585633f, 0.0654969f, 0.0566811f, 0.0530192f, 0.0500102f,
+    0.0519173f, 0.0415339f, 0.0374518f, 0.0352549f, 0.0338881f,
+    0.112085f, 0.0576099f, 0.0692518f, 0.0628156f, 0.0471117f,
+    0.0376894f, 0.0333457f, 0.0336732f, 0.0315689f, 0.0354596f,
+    0.0309913f, 0.0249154f, 0.0222712f, 0.0781853f, 0.0417508f,
+    0.0645857f, 0.0555069f, 0.0416302f, 0.0333041f, 0.0277535f,
+    0.0237887f, 0.0265446f, 0.0271257f, 0.0226048f, 0.0169536f,
+    0.0160301f, 0.0535103f, 0.0401716f, 0.0543924f, 0.0450608f,
+    0.0337956f, 0.0270365f, 0.0225304f, 0.0219656f, 0.0249669f,
+    0.0209735f, 0.017478f, 0.0153948f, 0.014217f, 0.0503387f,
+    0.0401075f, 0.0346278f, 0.0230852f, 0.0281496f, 0.0244529f,
+    0.0214508f, 0.0217921f, 0.0249056f, 0.0199245f, 0.0172678f,
+    0.0153368f, 0.0127832f, 0.260907f, 0.207881f, 0.179456f,
+    0.119637f, 0.145897f, 0.126738f, 0.111182f, 0.112948f,
+    0.129088f, 0.103271f, 0.0895004f, 0.0794915f, 0.0646296f,
+    0.214192f, 0.157475f, 0.145463f, 0.0969752f, 0.11709f,
+    0.101562f, 0.0852854f, 0.0901298f, 0.0986103f, 0.0788882f,
+    0.0692649f, 0.0608772f, 0.0552187f, 0.173107f, 0.122079f,
+    0.117614f, 0.0784093f, 0.0936456f, 0.0811333f, 0.0714222f,
+    0.0718018f, 0.0768229f, 0.0614583f, 0.0546183f, 0.0475539f,
+    0.0463574f, 0.13722f, 0.089961f, 0.0860146f, 0.0727843f,
+    0.0679341f, 0.058845f, 0.0517487f, 0.0520854f, 0.0564745f,
+    0.0451796f, 0.0400807f, 0.0350023f, 0.0347405f, 0.104197f,
+    0.0810484f, 0.0745842f, 0.0654756f, 0.0580348f, 0.0503599f,
+    0.0434619f, 0.0447739f, 0.0504627f, 0.0403701f, 0.0351381f,
+    0.0311562f, 0.0284994f, 0.101158f, 0.0802791f, 0.0699033f,
+    0.0550295f, 0.0565685f, 0.0491272f, 0.042951f, 0.0437572f,
+    0.0498725f, 0.039898f, 0.0345784f, 0.0307315f, 0.0266863f,
+    0.100677f, 0.080215f, 0.0692511f, 0.0461674f, 0.0562983f,
+    0.0489051f, 0.0429016f, 0.0435837f, 0.0498112f, 0.039849f,
+    0.0345355f, 0.0306735f, 0.0252525f, 0.311245f, 0.247989f,
+    0.214079f, 0.142719f, 0.174046f, 0.15119f, 0.132632f,
+    0.134739f, 0.153994f, 0.123195f, 0.106768f, 0.0948282f,
+    0.0770989f, 0.26453f, 0.197583f, 0.180086f, 0.120057f,
+    0.145239f, 0.126015f, 0.106736f, 0.111921f, 0.123516f,
+    0.0988127f, 0.0864315f, 0.0762139f, 0.067688f, 0.223446f,
+    0.162186f, 0.152237f, 0.101491f, 0.121794f, 0.105585f,
+    0.0898253f, 0.0935934f, 0.101729f, 0.0813828f, 0.0717849f,
+    0.0628906f, 0.0588267f, 0.174786f, 0.130069f, 0.120638f,
+    0.0827529f, 0.0960828f, 0.0832971f, 0.0702033f, 0.073877f,
+    0.0813801f, 0.0651041f, 0.0572473f, 0.050339f, 0.0472098f,
+    0.154535f, 0.121156f, 0.107064f, 0.0754442f, 0.0861835f,
+    0.074812f, 0.0649127f, 0.0665655f, 0.0753683f, 0.0602946f,
+    0.0523047f, 0.0464929f, 0.0409687f, 0.151496f, 0.120387f,
+    0.104527f, 0.0696844f, 0.0847171f, 0.0735794f, 0.0644018f,
+    0.0655487f, 0.0747781f, 0.0598225f, 0.0518461f, 0.0460682f,
+    0.0391556f, 0.151015f, 0.120323f, 0.103874f, 0.0692496f,
+    0.0844469f, 0.0733573f, 0.0643524f, 0.0653753f, 0.0747168f,
+    0.0597735f, 0.0518032f, 0.0460101f, 0.0377218f, 0.411922f,
+    0.328204f, 0.283326f, 0.188884f, 0.230343f, 0.200095f,
+    0.175534f, 0.178323f, 0.203805f, 0.163044f, 0.141304f,
+    0.125502f, 0.102037f, 0.365206f, 0.277798f, 0.249333f,
+    0.166222f, 0.201536f, 0.174919f, 0.149638f, 0.155504f,
+    0.173327f, 0.138662f, 0.120834f, 0.106887f, 0.0926266f,
+    0.324122f, 0.242401f, 0.221484f, 0.147656f, 0.178092f,
+    0.15449f, 0.130863f, 0.137177f, 0.15154f, 0.121232f,
+    0.106118f, 0.0935639f, 0.0837653f, 0.275462f, 0.210284f,
+    0.189884f, 0.12659f, 0.15238f, 0.132201f, 0.113105f,
+    0.11746f, 0.131191f, 0.104953f, 0.0915804f, 0.0810123f,
+    0.0721484f, 0.255211f, 0.201371f, 0.176311f, 0.11754f,
+    0.142481f, 0.123716f, 0.107814f, 0.110149f, 0.125179f,
+    0.100144f, 0.0868181f, 0.0771663f, 0.0659073f, 0.252172f,
+    0.200602f, 0.173773f, 0.115849f, 0.141014f, 0.122484f,
+    0.107303f, 0.109132f, 0.124589f, 0.0996714f, 0.0863816f,
+    0.0767415f, 0.0640941f, 0.251691f, 0.200538f, 0.173121f,
+    0.115414f, 0.140744f, 0.122262f, 0.107254f, 0.108958f,
+    0.124528f, 0.0996224f, 0.0863387f, 0.0766835f, 0.0626604f,
+    1.16699f, 0.929817f, 0.802674f, 0.535116f, 0.652573f,
+    0.566877f, 0.497296f, 0.505196f, 0.577389f, 0.461911f,
+    0.40032f, 0.355552f, 0.289077f, 1.12028f, 0.879411f,
+    0.768681f, 0.512454f, 0.623766f, 0.541701f, 0.471399f,
+    0.482378f, 0.546911f, 0.437529f, 0.37985f, 0.336937f,
+    0.279666f, 1.07919f, 0.844014f, 0.740833f, 0.493888f,
+    0.600322f, 0.521272f, 0.452625f, 0.46405f, 0.525124f,
+    0.420099f, 0.364769f, 0.323614f, 0.270805f, 1.03053f,
+    0.811896f, 0.709233f, 0.472822f, 0.57461f, 0.498984f,
+    0.434867f, 0.444334f, 0.504775f, 0.40382f, 0.350255f,
+    0.311062f, 0.259188f, 1.01028f, 0.802984f, 0.69566f,
+    0.463773f, 0.564711f, 0.490499f, 0.429576f, 0.437022f,
+    0.498763f, 0.399011f, 0.345834f, 0.307216f, 0.252947f,
+    1.00724f, 0.802214f, 0.693122f, 0.462081f, 0.563244f,
+    0.489266f, 0.429065f, 0.436006f, 0.498173f, 0.398539f,
+    0.345398f, 0.306792f, 0.251134f, 1.00676f, 0.80215f,
+    0.69247f, 0.461647f, 0.562974f, 0.489044f, 0.429016f,
+    0.435832f, 0.498112f, 0.39849f, 0.345355f, 0.306734f,
+    0.2497f, 0.207182f, 0.13265f, 0.0906487f, 0.0726917f,
+    0.0709482f, 0.0663358f, 0.0605755f, 0.0563152f, 0.0618466f,
+    0.0557558f, 0.0550222f, 0.0417444f, 0.0351329f, 0.136573f,
+    0.0857317f, 0.0586044f, 0.0482701f, 0.0481046f, 0.0432521f,
+    0.0395461f, 0.0374446f, 0.038237f, 0.035336f, 0.0353725f,
+    0.0307279f, 0.0245823f, 0.0895795f, 0.049676f, 0.033948f,
+    0.0311916f, 0.0295437f, 0.0256744f, 0.0286781f, 0.026739f,
+    0.0248971f, 0.0286157f, 0.0270864f, 0.0233786f, 0.0187028f,
+    0.0573103f, 0.0229241f, 0.0215406f, 0.0205504f, 0.0157973f,
+    0.0165078f, 0.0217789f, 0.0201356f, 0.0193881f, 0.0233481f,
+    0.0228174f, 0.0171131f, 0.0136905f, 0.0429586f, 0.0171834f,
+    0.0168506f, 0.0112337f, 0.0139793f, 0.0111834f, 0.0166423f,
+    0.0142648f, 0.0135797f, 0.0130774f, 0.0136372f, 0.0102279f,
+    0.00956804f, 0.0282298f, 0.0112919f, 0.0145951f, 0.00973006f,
+    0.011352f, 0.00908157f, 0.0130455f, 0.0111819f, 0.0102149f,
+    0.00853601f, 0.00753396f, 0.00565047f, 0.00773154f, 0.00524042f,
+    0.00209617f, 0.00680206f, 0.00453471f, 0.00446964f, 0.00357571f,
+    0.00584273f, 0.00500805f, 0.00439973f, 0.00351978f, 0.00293315f,
+    0.00219987f, 0.00291517f, 0.27227f, 0.174323f, 0.119127f,
+    0.0955284f, 0.0932373f, 0.0871759f, 0.0796058f, 0.0740071f,
+    0.0812762f, 0.073272f, 0.072308f, 0.0548588f, 0.0461702f,
+    0.201661f, 0.127405f, 0.0870825f, 0.0711068f, 0.0703937f,
+    0.0640922f, 0.0582884f, 0.0539693f, 0.0576666f, 0.0526782f,
+    0.0526583f, 0.0430482f, 0.0344385f, 0.145869f, 0.0913492f,
+    0.0624262f, 0.0517184f, 0.0518327f, 0.0464055f, 0.0439825f,
+    0.0415612f, 0.0407161f, 0.0378432f, 0.0378588f, 0.0340012f,
+    0.0272009f, 0.0893553f, 0.0549574f, 0.0375327f, 0.0312317f,
+    0.0314982f, 0.0282377f, 0.0306648f, 0.026636f, 0.0256804f,
+    0.031156f, 0.0300257f, 0.0228283f, 0.0182626f, 0.0676624f,
+    0.0430904f, 0.0294345f, 0.0239192f, 0.0236666f, 0.0218342f,
+    0.0221779f, 0.0190096f, 0.0199719f, 0.0208853f, 0.0208455f,
+    0.0156341f, 0.0125073f, 0.065357f, 0.0418117f, 0.0285699f,
+    0.0229777f, 0.0225038f, 0.0209798f, 0.0191495f, 0.0177959f,
+    0.0194839f, 0.0175632f, 0.0173772f, 0.0131607f, 0.0110898f,
+    0.0650883f, 0.0416733f, 0.0284782f, 0.022837f, 0.0222897f,
+    0.0208404f, 0.0190306f, 0.0176922f, 0.0194297f, 0.0175162f,
+    0.0172859f, 0.0131145f, 0.0110374f, 0.337358f, 0.215997f,
+    0.147605f, 0.118365f, 0.115526f, 0.108016f, 0.0986361f,
+    0.091699f, 0.100706f, 0.0907881f, 0.0895937f, 0.0679732f,
+    0.0572076f, 0.266749f, 0.169078f, 0.115561f, 0.0939436f,
+    0.0926827f, 0.0849322f, 0.0773188f, 0.0716612f, 0.0770963f,
+    0.0701944f, 0.069944f, 0.0553685f, 0.0442948f, 0.210957f,
+    0.133023f, 0.0909043f, 0.0745552f, 0.0741218f, 0.0672456f,
+    0.0611123f, 0.0565466f, 0.0601458f, 0.0550914f, 0.0551446f,
+    0.0463215f, 0.0370572f, 0.152731f, 0.0966306f, 0.0660108f,
+    0.0540685f, 0.0537872f, 0.0490777f, 0.0446341f, 0.0413342f,
+    0.0441957f, 0.0402707f, 0.0402949f, 0.033386f, 0.0267088f,
+    0.132751f, 0.0847636f, 0.0579126f, 0.0467559f, 0.0459557f,
+    0.0426742f, 0.0389242f, 0.0361493f, 0.0394016f, 0.0355416f,
+    0.0352835f, 0.0266504f, 0.0224868f, 0.130445f, 0.083485f,
+    0.057048f, 0.0458144f, 0.0447928f, 0.0418199f, 0.0381799f,
+    0.0354878f, 0.0389135f, 0.0350793f, 0.0346629f, 0.0262751f,
+    0.0221271f, 0.130176f, 0.0833466f, 0.0569563f, 0.0456738f,
+    0.0445788f, 0.0416804f, 0.038061f, 0.0353841f, 0.0388594f,
+    0.0350324f, 0.0345717f, 0.0262289f, 0.0220748f, 0.402446f,
+    0.25767f, 0.176083f, 0.141202f, 0.137815f, 0.128856f,
+    0.117666f, 0.109391f, 0.120136f, 0.108304f, 0.106879f,
+    0.0810876f, 0.0682449f, 0.331837f, 0.210751f, 0.144039f,
+    0.11678f, 0.114972f, 0.105772f, 0.0963491f, 0.0893532f,
+    0.096526f, 0.0877106f, 0.0872298f, 0.0676888f, 0.0553197f,
+    0.276045f, 0.174696f, 0.119382f, 0.0973919f, 0.0964108f,
+    0.0880856f, 0.0801426f, 0.0742385f, 0.0795755f, 0.0724435f,
+    0.0724303f, 0.0586418f, 0.0469135f, 0.21782f, 0.138304f,
+    0.094489f, 0.0769053f, 0.0760763f, 0.0699178f, 0.0636645f,
+    0.0590261f, 0.0636254f, 0.0576324f, 0.0575806f, 0.0457063f,
+    0.0365651f, 0.197839f, 0.126437f, 0.0863908f, 0.0695927f,
+    0.0682447f, 0.0635142f, 0.0579546f, 0.0538412f, 0.0588313f,
+    0.0530578f, 0.0525693f, 0.0397473f, 0.0335241f, 0.195533f,
+    0.125158f, 0.0855261f, 0.0686512f, 0.0670818f, 0.0626599f,
+    0.0572102f, 0.0531797f, 0.0583432f, 0.0525955f, 0.0519487f,
+    0.0393895f, 0.0331645f, 0.195265f, 0.12502f, 0.0854344f,
+    0.0685106f, 0.0668678f, 0.0625204f, 0.0570913f, 0.053076f,
+    0.0582891f, 0.0525486f, 0.0518574f, 0.0393433f, 0.0331121f,
+    0.532623f, 0.341016f, 0.233039f, 0.186875f, 0.182393f,
+    0.170536f, 0.155727f, 0.144775f, 0.158995f, 0.143337f,
+    0.141451f, 0.107316f, 0.0903196f, 0.462013f, 0.294098f,
+    0.200995f, 0.162454f, 0.15955f, 0.147452f, 0.13441f,
+    0.124737f, 0.135385f, 0.122743f, 0.121801f, 0.0923295f,
+    0.0773943f, 0.406221f, 0.258042f, 0.176339f, 0.143065f,
+    0.140989f, 0.129766f, 0.118203f, 0.109622f, 0.118435f,
+    0.107476f, 0.107002f, 0.0832825f, 0.0678908f, 0.347996f,
+    0.22165f, 0.151445f, 0.122579f, 0.120654f, 0.111598f,
+    0.101725f, 0.09441f, 0.102485f, 0.0926648f, 0.0921521f,
+    0.070347f, 0.0586136f, 0.328015f, 0.209783f, 0.143347f,
+    0.115266f, 0.112823f, 0.105194f, 0.0960153f, 0.089225f,
+    0.0976906f, 0.0880902f, 0.0871408f, 0.0659761f, 0.0555987f,
+    0.325709f, 0.208505f, 0.142482f, 0.114325f, 0.11166f,
+    0.10434f, 0.0952709f, 0.0885636f, 0.0972025f, 0.0876279f,
+    0.0865202f, 0.0656183f, 0.0552391f, 0.325441f, 0.208366f,
+    0.142391f, 0.114184f, 0.111446f, 0.1042f, 0.095152f,
+    0.0884599f, 0.0971484f, 0.0875809f, 0.0864289f, 0.0655721f,
+    0.0551868f, 1.50894f, 0.966115f, 0.660211f, 0.529427f,
+    0.516729f, 0.483136f, 0.441182f, 0.410154f, 0.45044f,
+    0.406079f, 0.400737f, 0.304032f, 0.25588f, 1.43834f,
+    0.919197f, 0.628167f, 0.505005f, 0.493886f, 0.460053f,
+    0.419865f, 0.390116f, 0.426831f, 0.385486f, 0.381088f,
+    0.288179f, 0.242954f, 1.38254f, 0.883141f, 0.60351f,
+    0.485617f, 0.475325f, 0.442366f, 0.403658f, 0.375001f,
+    0.40988f, 0.370219f, 0.366288f, 0.276779f, 0.233451f,
+    1.32432f, 0.846749f, 0.578617f, 0.46513f, 0.45499f,
+    0.424198f, 0.38718f, 0.359789f, 0.39393f, 0.355408f,
+    0.351438f, 0.265996f, 0.224174f, 1.30434f, 0.834882f,
+    0.570519f, 0.457818f, 0.447158f, 0.417795f, 0.38147f,
+    0.354604f, 0.389136f, 0.350833f, 0.346427f, 0.262692f,
+    0.221159f, 1.30203f, 0.833604f, 0.569654f, 0.456876f,
+    0.445996f, 0.41694f, 0.380726f, 0.353943f, 0.388648f,
+    0.350371f, 0.345806f, 0.262334f, 0.220799f, 1.30176f,
+    0.833465f, 0.569562f, 0.456735f, 0.445782f, 0.416801f,
+    0.380607f, 0.353839f, 0.388594f, 0.350324f, 0.345715f,
+    0.262288f, 0.220747f, 0.112611f, 0.0810042f, 0.0647679f,
+    0.0576732f, 0.0574854f, 0.0570211f, 0.055267f, 0.0536337f,
+    0.0577004f, 0.0564534f, 0.0550294f, 0.0421962f, 0.033757f,
+    0.0727243f, 0.0528024f, 0.0415082f, 0.0369231f, 0.0373717f,
+    0.0362524f, 0.0347517f, 0.0357548f, 0.037493f, 0.0360843f,
+    0.0350616f, 0.0288119f, 0.0230495f, 0.0454938f, 0.0386873f,
+    0.0270656f, 0.0255111f, 0.02529f, 0.0265742f, 0.0267274f,
+    0.0255976f, 0.0244251f, 0.0258995f, 0.0223441f, 0.0248762f,
+    0.0199009f, 0.0333241f, 0.0319501f, 0.0218117f, 0.017613f,
+    0.0193102f, 0.0237916f, 0.0233535f, 0.0216201f, 0.0189176f,
+    0.0223078f, 0.0193447f, 0.0148476f, 0.0118781f, 0.0206398f,
+    0.0180412f, 0.0172185f, 0.0159807f, 0.0140939f, 0.0157144f,
+    0.0148748f, 0.0136103f, 0.011909f, 0.0139692f, 0.0122008f,
+    0.00915063f, 0.00907419f, 0.0145113f, 0.0132743f, 0.0139355f,
+    0.0131894f, 0.0116581f, 0.0112777f, 0.00939805f, 0.00876454f,
+    0.00808313f, 0.00903464f, 0.00752886f, 0.00564665f, 0.00699674f,
+    0.00337418f, 0.00363465f, 0.00678206f, 0.00633855f, 0.00549007f,
+    0.0048214f, 0.00401783f, 0.0035886f, 0.00319708f, 0.00294203f,
+    0.00245169f, 0.00183877f, 0.00229594f, 0.147989f, 0.106452f,
+    0.0851154f, 0.0757917f, 0.075545f, 0.0749348f, 0.0726297f,
+    0.0704832f, 0.0758275f, 0.0741888f, 0.0723174f, 0.0554526f,
+    0.0443621f, 0.107002f, 0.0782506f, 0.0618557f, 0.0550417f,
+    0.054533f, 0.0541661f, 0.0518163f, 0.0519075f, 0.0544781f,
+    0.0536282f, 0.0523496f, 0.0403576f, 0.0322861f, 0.0783248f,
+    0.0564485f, 0.0444822f, 0.0396389f, 0.0403357f, 0.0388297f,
+    0.03716f, 0.0385051f, 0.0404235f, 0.0387725f, 0.0374877f,
+    0.0342909f, 0.0274327f, 0.0471126f, 0.0423112f, 0.0290633f,
+    0.0266979f, 0.0264735f, 0.0304743f, 0.030238f, 0.0280729f,
+    0.0245637f, 0.0290872f, 0.0251644f, 0.0242623f, 0.0194098f,
+    0.0365895f, 0.0283031f, 0.0212247f, 0.0191081f, 0.0190742f,
+    0.022397f, 0.0217593f, 0.020063f, 0.0186635f, 0.0207486f,
+    0.0180205f, 0.0147696f, 0.0118157f, 0.035511f, 0.0255736f,
+    0.0204661f, 0.0181971f, 0.0181201f, 0.0180284f, 0.0174197f,
+    0.0169327f, 0.0181824f, 0.0178151f, 0.017374f, 0.0133181f,
+    0.0106545f, 0.0353779f, 0.0254484f, 0.0203477f, 0.0181187f,
+    0.0180596f, 0.0179142f, 0.0173627f, 0.0168497f, 0.0181272f,
+    0.0177355f, 0.0172882f, 0.0132564f, 0.0106052f, 0.183366f,
+    0.131901f, 0.105463f, 0.0939103f, 0.0936046f, 0.0928486f,
+    0.0899924f, 0.0873327f, 0.0939546f, 0.0919241f, 0.0896054f,
+    0.0687089f, 0.0549671f, 0.14238f, 0.103699f, 0.0822031f,
+    0.0731603f, 0.0720276f, 0.0720798f, 0.069179f, 0.0680602f,
+    0.0721316f, 0.0713636f, 0.0696376f, 0.0533246f, 0.0426597f,
+    0.111772f, 0.0818967f, 0.0648297f, 0.0575461f, 0.057497f,
+    0.0567434f, 0.0540984f, 0.0546577f, 0.0574086f, 0.0560894f,
+    0.0547756f, 0.0437056f, 0.0349645f, 0.0816446f, 0.0595548f,
+    0.0474743f, 0.0420062f, 0.0417175f, 0.0416423f, 0.0397091f,
+    0.0393338f, 0.041419f, 0.041043f, 0.0400875f, 0.033677f,
+    0.0269416f, 0.0719673f, 0.0519398f, 0.0415722f, 0.0369071f,
+    0.0366822f, 0.0365962f, 0.0352598f, 0.0343596f, 0.0367906f,
+    0.0361284f, 0.0352462f, 0.0270104f, 0.0216083f, 0.0708887f,
+    0.0510218f, 0.0408135f, 0.0363157f, 0.0361796f, 0.0359421f,
+    0.0347824f, 0.0337822f, 0.0363095f, 0.0355505f, 0.034662f,
+    0.0265744f, 0.0212596f, 0.0707557f, 0.0508966f, 0.0406951f,
+    0.0362372f, 0.0361192f, 0.0358279f, 0.0347253f, 0.0336992f,
+    0.0362543f, 0.0354709f, 0.0345762f, 0.0265128f, 0.0212102f,
+    0.218744f, 0.157349f, 0.12581f, 0.112029f, 0.111664f,
+    0.110762f, 0.107355f, 0.104182f, 0.112082f, 0.10966f,
+    0.106893f, 0.0819652f, 0.0655722f, 0.177757f, 0.129147f,
+    0.102551f, 0.0912789f, 0.0900872f, 0.0899935f, 0.0865416f,
+    0.0848174f, 0.0902587f, 0.089099f, 0.0869255f, 0.0665809f,
+    0.0532647f, 0.14715f, 0.107345f, 0.0851771f, 0.0756646f,
+    0.0746584f, 0.0746571f, 0.0714611f, 0.0708104f, 0.0744865f,
+    0.0738248f, 0.0720636f, 0.0553102f, 0.0442482f, 0.117022f,
+    0.0850031f, 0.0678217f, 0.0601247f, 0.059402f, 0.059556f,
+    0.0570718f, 0.0559795f, 0.059503f, 0.0587784f, 0.0573755f,
+    0.0439392f, 0.0351513f, 0.107345f, 0.077388f, 0.0619196f,
+    0.0550256f, 0.0547418f, 0.0545099f, 0.0526224f, 0.0512092f,
+    0.0549177f, 0.0538638f, 0.0525342f, 0.0402667f, 0.0322134f,
+    0.106267f, 0.07647f, 0.061161f, 0.0544343f, 0.0542392f,
+    0.0538559f, 0.052145f, 0.0506317f, 0.0544366f, 0.0532859f,
+    0.05195f, 0.0398308f, 0.0318646f, 0.106133f, 0.0763448f,
+    0.0610425f, 0.0543558f, 0.0541788f, 0.0537416f, 0.052088f,
+    0.0505487f, 0.0543814f, 0.0532062f, 0.0518642f, 0.0397691f,
+    0.0318153f, 0.2895f, 0.208245f, 0.166505f, 0.148266f,
+    0.147783f, 0.14659f, 0.14208f, 0.137881f, 0.148336f,
+    0.14513f, 0.141469f, 0.108478f, 0.0867824f, 0.248513f,
+    0.180043f, 0.143245f, 0.127516f, 0.126206f, 0.125821f,
+    0.121267f, 0.118516f, 0.126513f, 0.12457f, 0.121502f,
+    0.0930936f, 0.0744749f, 0.217905f, 0.158241f, 0.125872f,
+    0.111902f, 0.110528f, 0.110485f, 0.106186f, 0.104049f,
+    0.110741f, 0.109295f, 0.10664f, 0.0816819f, 0.0653455f,
+    0.187778f, 0.135899f, 0.108517f, 0.0963619f, 0.0955212f,
+    0.0953834f, 0.0917971f, 0.0896785f, 0.0957572f, 0.0942491f,
+    0.0919515f, 0.0704518f, 0.0563615f, 0.178101f, 0.128284f,
+    0.102614f, 0.0912628f, 0.090861f, 0.0903373f, 0.0873477f,
+    0.0849082f, 0.0911719f, 0.0893345f, 0.0871102f, 0.0667794f,
+    0.0534235f, 0.177022f, 0.127366f, 0.101856f, 0.0906714f,
+    0.0903584f, 0.0896833f, 0.0868703f, 0.0843307f, 0.0906909f,
+    0.0887566f, 0.0865259f, 0.0663435f, 0.0530748f, 0.176889f,
+    0.127241f, 0.101737f, 0.090593f, 0.090298f, 0.089569f,
+    0.0868133f, 0.0842477f, 0.0906356f, 0.0886769f, 0.0864401f,
+    0.0662818f, 0.0530254f, 0.820166f, 0.589968f, 0.471717f,
+    0.420044f, 0.418677f, 0.415296f, 0.40252f, 0.390624f,
+    0.420243f, 0.411161f, 0.400789f, 0.307323f, 0.245858f,
+    0.77918f, 0.561767f, 0.448457f, 0.399294f, 0.3971f,
+    0.394527f, 0.381707f, 0.371259f, 0.39842f, 0.3906f,
+    0.380821f, 0.291939f, 0.233551f, 0.748572f, 0.539965f,
+    0.431084f, 0.38368f, 0.381422f, 0.37919f, 0.366626f,
+    0.356791f, 0.382647f, 0.375326f, 0.365959f, 0.280527f,
+    0.224422f, 0.718445f, 0.517623f, 0.413728f, 0.36814f,
+    0.366415f, 0.364089f, 0.352237f, 0.342421f, 0.367664f,
+    0.36028f, 0.351271f, 0.269297f, 0.215437f, 0.708767f,
+    0.510008f, 0.407826f, 0.363041f, 0.361755f, 0.359043f,
+    0.347788f, 0.337651f, 0.363079f, 0.355365f, 0.34643f,
+    0.265624f, 0.2125f, 0.707689f, 0.50909f, 0.407067f,
+    0.36245f, 0.361252f, 0.358389f, 0.34731f, 0.337073f,
+    0.362598f, 0.354787f, 0.345846f, 0.265189f, 0.212151f,
+    0.707556f, 0.508964f, 0.406949f, 0.362371f, 0.361192f,
+    0.358275f, 0.347253f, 0.33699f, 0.362542f, 0.354707f,
+    0.34576f, 0.265127f, 0.212101f, 0.0802612f, 0.0630895f,
+    0.0677668f, 0.0568455f, 0.0567491f, 0.0534207f, 0.0518753f,
+    0.0507355f, 0.0571721f, 0.0551831f, 0.0543787f, 0.040784f,
+    0.0331423f, 0.0529551f, 0.043897f, 0.0446624f, 0.0387187f,
+    0.0357442f, 0.0356922f, 0.0353154f, 0.0337564f, 0.0399048f,
+    0.0372243f, 0.0346751f, 0.0285062f, 0.0228049f, 0.0410721f,
+    0.0312791f, 0.0291561f, 0.0243195f, 0.027447f, 0.0255622f,
+    0.0251994f, 0.0267853f, 0.0253941f, 0.0271757f, 0.0237357f,
+    0.0243987f, 0.019519f, 0.0214158f, 0.0239213f, 0.0235064f,
+    0.0220759f, 0.0247398f, 0.0228468f, 0.0225976f, 0.0242617f,
+    0.0223708f, 0.0236208f, 0.0207902f, 0.0155926f, 0.0124741f,
+    0.015982f, 0.0225834f, 0.0154089f, 0.01462f, 0.0161844f,
+    0.014752f, 0.014849f, 0.0162401f, 0.0148119f, 0.0149568f,
+    0.0133287f, 0.00999652f, 0.00799722f, 0.0106959f, 0.0191174f,
+    0.00955868f, 0.0111772f, 0.0101047f, 0.0103578f, 0.00899681f,
+    0.0100519f, 0.00907764f, 0.00881466f, 0.00795419f, 0.00596565f,
+    0.00577415f, 0.00240146f, 0.00952964f, 0.00476482f, 0.0053818f,
+    0.00436291f, 0.00491447f, 0.0041369f, 0.00361851f, 0.00330108f,
+    0.0030003f, 0.00250025f, 0.00187519f, 0.00182568f, 0.105476f,
+    0.0829096f, 0.0890564f, 0.074704f, 0.0745774f, 0.0702033f,
+    0.0681724f, 0.0666745f, 0.0751332f, 0.0725194f, 0.0714622f,
+    0.0535967f, 0.0435543f, 0.0749962f, 0.061319f, 0.0659519f,
+    0.0565773f, 0.0535724f, 0.0521475f, 0.0516125f, 0.0492133f,
+    0.0578659f, 0.0545606f, 0.0517586f, 0.0396413f, 0.031713f,
+    0.0603014f, 0.0487011f, 0.0478856f, 0.0416962f, 0.038134f,
+    0.0384533f, 0.0380452f, 0.0374914f, 0.0431227f, 0.0400778f,
+    0.0370632f, 0.0338042f, 0.0270433f, 0.0389167f, 0.0302468f,
+    0.0300526f, 0.0280664f, 0.0315434f, 0.0292361f, 0.0289075f,
+    0.0309154f, 0.0286019f, 0.0306827f, 0.026915f, 0.0237511f,
+    0.0190009f, 0.0259252f, 0.0265876f, 0.0222958f, 0.0206105f,
+    0.022988f, 0.0211413f, 0.0211589f, 0.0228938f, 0.021043f,
+    0.0220187f, 0.0194535f, 0.0145901f, 0.0116721f, 0.0252844f,
+    0.0231216f, 0.0214227f, 0.0180249f, 0.0178945f, 0.0168453f,
+    0.0164608f, 0.0167056f, 0.0181915f, 0.0175258f, 0.0171647f,
+    0.0128735f, 0.0104619f, 0.0252148f, 0.0198203f, 0.0212899f,
+    0.0178592f, 0.0178283f, 0.0167827f, 0.0162979f, 0.0159391f,
+    0.0179637f, 0.0173386f, 0.0170837f, 0.0128128f, 0.0104121f,
+    0.130691f, 0.10273f, 0.110346f, 0.0925626f, 0.0924057f,
+    0.0869859f, 0.0844696f, 0.0826135f, 0.0930944f, 0.0898557f,
+    0.0885458f, 0.0664094f, 0.0539662f, 0.100211f, 0.0811001f,
+    0.0872415f, 0.0744358f, 0.0714007f, 0.0686028f, 0.0679096f,
+    0.0647463f, 0.075827f, 0.0718969f, 0.0688422f, 0.051911f,
+    0.0419094f, 0.0795308f, 0.0661232f, 0.0691752f, 0.0595547f,
+    0.0559622f, 0.0549086f, 0.0543423f, 0.051818f, 0.0610838f,
+    0.0574141f, 0.0541468f, 0.0432096f, 0.0345677f, 0.0581461f,
+    0.0476689f, 0.0502957f, 0.0431313f, 0.0409894f, 0.0397928f,
+    0.0393883f, 0.0375691f, 0.0441302f, 0.0417074f, 0.0396042f,
+    0.0331566f, 0.0265252f, 0.05114f, 0.0405457f, 0.0435854f,
+    0.0368059f, 0.0362486f, 0.0341276f, 0.0336149f, 0.0324721f,
+    0.0372347f, 0.0357482f, 0.0348187f, 0.026114f, 0.021221f,
+    0.0504992f, 0.0397543f, 0.0427123f, 0.0358835f, 0.0357228f,
+    0.0336279f, 0.0327579f, 0.0319501f, 0.0361526f, 0.0348621f,
+    0.0342483f, 0.0256862f, 0.0208739f, 0.0504296f, 0.0396404f,
+    0.0425794f, 0.0357177f, 0.0356566f, 0.0335653f, 0.032595f,
+    0.0318782f, 0.0359249f, 0.0346749f, 0.0341673f, 0.0256255f,
+    0.020824f, 0.155906f, 0.12255f, 0.131636f, 0.110421f,
+    0.110234f, 0.103769f, 0.100767f, 0.0985525f, 0.111056f,
+    0.107192f, 0.105629f, 0.079222f, 0.0643782f, 0.125426f,
+    0.10092f, 0.108531f, 0.0922943f, 0.089229f, 0.0850581f,
+    0.0842068f, 0.0802793f, 0.0937882f, 0.0892332f, 0.0859258f,
+    0.0644628f, 0.0523213f, 0.103438f, 0.0840808f, 0.0904647f,
+    0.0774133f, 0.0737905f, 0.0713639f, 0.0706394f, 0.067351f,
+    0.079045f, 0.0747504f, 0.0712304f, 0.0540489f, 0.0433654f,
+    0.0826417f, 0.0665553f, 0.0715853f, 0.0609898f, 0.0588176f,
+    0.0562481f, 0.0556855f, 0.0530833f, 0.0620914f, 0.0590437f,
+    0.0566878f, 0.0426125f, 0.0345334f, 0.0763548f, 0.0603658f,
+    0.064875f, 0.0546645f, 0.0540768f, 0.0509103f, 0.049912f,
+    0.0484111f, 0.0551959f, 0.0530845f, 0.0519023f, 0.0389267f,
+    0.031633f, 0.075714f, 0.0595744f, 0.0640018f, 0.053742f,
+    0.0535511f, 0.0504105f, 0.049055f, 0.0478891f, 0.0541138f,
+    0.0521983f, 0.0513318f, 0.0384989f, 0.0312859f, 0.0756444f,
+    0.0594606f, 0.063869f, 0.0535762f, 0.0534849f, 0.0503479f,
+    0.0488922f, 0.0478172f, 0.053886f, 0.0520112f, 0.0512509f,
+    0.0384381f, 0.031236f, 0.206335f, 0.16219f, 0.174215f,
+    0.146138f, 0.14589f, 0.137334f, 0.133361f, 0.130431f,
+    0.146978f, 0.141865f, 0.139796f, 0.104847f, 0.0852021f,
+    0.175855f, 0.14056f, 0.15111f, 0.128011f, 0.124885f,
+    0.117969f, 0.116801f, 0.111992f, 0.12971f, 0.123906f,
+    0.120093f, 0.0900697f, 0.0731452f, 0.153867f, 0.123721f,
+    0.133044f, 0.11313f, 0.109447f, 0.104274f, 0.103234f,
+    0.098417f, 0.114967f, 0.109423f, 0.105397f, 0.0790481f,
+    0.0641893f, 0.133071f, 0.106196f, 0.114164f, 0.0967069f,
+    0.0944741f, 0.0891587f, 0.0882797f, 0.0847229f, 0.0980137f,
+    0.0937162f, 0.0908549f, 0.0681411f, 0.0553574f, 0.126784f,
+    0.100006f, 0.107454f, 0.0903815f, 0.0897334f, 0.0844755f,
+    0.0825062f, 0.0802891f, 0.0911182f, 0.0877571f, 0.0860694f,
+    0.064552f, 0.0524569f, 0.126144f, 0.0992147f, 0.106581f,
+    0.0894591f, 0.0892076f, 0.0839757f, 0.0816492f, 0.0797671f,
+    0.0900361f, 0.0868709f, 0.085499f, 0.0641242f, 0.0521097f,
+    0.126074f, 0.0991009f, 0.106448f, 0.0892933f, 0.0891414f,
+    0.0839131f, 0.0814864f, 0.0796952f, 0.0898083f, 0.0866837f,
+    0.085418f, 0.0640635f, 0.0520599f, 0.584557f, 0.459492f,
+    0.493558f, 0.414016f, 0.413314f, 0.389073f, 0.377818f,
+    0.369516f, 0.416395f, 0.401909f, 0.39605f, 0.297037f,
+    0.241381f, 0.554077f, 0.437863f, 0.470454f, 0.395889f,
+    0.392309f, 0.369377f, 0.361258f, 0.351077f, 0.399128f,
+    0.38395f, 0.376346f, 0.28226f, 0.229325f, 0.532089f,
+    0.421023f, 0.452387f, 0.381008f, 0.376871f, 0.35485f,
+    0.34769f, 0.337353f, 0.384384f, 0.369467f, 0.361651f,
+    0.271238f, 0.220369f, 0.511293f, 0.403498f, 0.433508f,
+    0.364585f, 0.361898f, 0.340711f, 0.332736f, 0.323808f,
+    0.367431f, 0.35376f, 0.347108f, 0.260331f, 0.211537f,
+    0.505006f, 0.397308f, 0.426798f, 0.35826f, 0.357157f,
+    0.336215f, 0.326963f, 0.319374f, 0.360535f, 0.347801f,
+    0.342323f, 0.256742f, 0.208636f, 0.504366f, 0.396517f,
+    0.425925f, 0.357337f, 0.356632f, 0.335715f, 0.326106f,
+    0.318852f, 0.359453f, 0.346915f, 0.341752f, 0.256314f,
+    0.208289f, 0.504296f, 0.396403f, 0.425792f, 0.357171f,
+    0.356565f, 0.335652f, 0.325943f, 0.31878f, 0.359225f,
+    0.346728f, 0.341671f, 0.256254f, 0.208239f, 0.0731479f,
+    0.057064f, 0.0561887f, 0.0556428f, 0.0549161f, 0.0524954f,
+    0.0514811f, 0.0527404f, 0.0554828f, 0.0538289f, 0.0539325f,
+    0.0404494f, 0.0323595f, 0.0512806f, 0.0390094f, 0.0363486f,
+    0.0373033f, 0.0358726f, 0.0349908f, 0.0350155f, 0.0345845f,
+    0.0392342f, 0.0363167f, 0.0343663f, 0.027796f, 0.0222368f,
+    0.0352099f, 0.0280319f, 0.0291415f, 0.028526f, 0.0287104f,
+    0.0279436f, 0.0250338f, 0.0248575f, 0.0251392f, 0.0266226f,
+    0.0227359f, 0.0227404f, 0.0181923f, 0.0302682f, 0.0256281f,
+    0.0272599f, 0.0266506f, 0.0267062f, 0.0256586f, 0.0227762f,
+    0.0229169f, 0.0222856f, 0.0228682f, 0.0197028f, 0.0147771f,
+    0.0118217f, 0.0205983f, 0.0179278f, 0.0186539f, 0.0182831f,
+    0.0182709f, 0.0172668f, 0.0151349f, 0.0156636f, 0.015126f,
+    0.0145031f, 0.0127087f, 0.00953155f, 0.00762524f, 0.0167076f,
+    0.0125582f, 0.0113847f, 0.0122432f, 0.0112594f, 0.0104948f,
+    0.00952389f, 0.00979143f, 0.00943097f, 0.00904063f, 0.00775646f,
+    0.00581734f, 0.00487751f, 0.00991414f, 0.00680389f, 0.00610641f,
+    0.00717749f, 0.00547478f, 0.00506294f, 0.00482028f, 0.00437486f,
+    0.00391314f, 0.00346846f, 0.00289038f, 0.00216779f, 0.00173423f,
+    0.096128f, 0.0749911f, 0.0738409f, 0.0731235f, 0.0721685f,
+    0.0689873f, 0.0676544f, 0.0693093f, 0.0729132f, 0.0707397f,
+    0.0708759f, 0.0531569f, 0.0425255f, 0.0742607f, 0.0569365f,
+    0.053102f, 0.0543573f, 0.0522881f, 0.0510126f, 0.0510942f,
+    0.050513f, 0.0566646f, 0.0532275f, 0.0512502f, 0.0391503f,
+    0.0313203f, 0.0564505f, 0.0424692f, 0.0396128f, 0.0402285f,
+    0.0386858f, 0.0378943f, 0.0377544f, 0.0371973f, 0.0425696f,
+    0.0391173f, 0.0367279f, 0.0316897f, 0.0253517f, 0.038185f,
+    0.031948f, 0.0341866f, 0.0334544f, 0.0335982f, 0.0324663f,
+    0.0289347f, 0.0289759f, 0.0282853f, 0.029967f, 0.0257229f,
+    0.0223771f, 0.0179017f, 0.0282686f, 0.0242477f, 0.0255806f,
+    0.0250869f, 0.0251629f, 0.0240745f, 0.0212934f, 0.0217227f,
+    0.0211257f, 0.0216019f, 0.0187289f, 0.0140466f, 0.0112373f,
+    0.0239254f, 0.0183718f, 0.0183114f, 0.018054f, 0.0181515f,
+    0.0173025f, 0.01626f, 0.0166337f, 0.017717f, 0.0170965f,
+    0.0170095f, 0.0127571f, 0.0102057f, 0.0230038f, 0.0179368f,
+    0.0176523f, 0.0174808f, 0.0172525f, 0.016492f, 0.0161734f,
+    0.016569f, 0.0174341f, 0.016913f, 0.0169435f, 0.0127076f,
+    0.0101661f, 0.119108f, 0.0929183f, 0.0914931f, 0.0906042f,
+    0.0894209f, 0.0854793f, 0.0838277f, 0.0858782f, 0.0903436f,
+    0.0876506f, 0.0878193f, 0.0658645f, 0.0526916f, 0.0972408f,
+    0.0748637f, 0.0707543f, 0.0714114f, 0.0691699f, 0.0670424f,
+    0.0671729f, 0.0664414f, 0.074095f, 0.0701384f, 0.0681341f,
+    0.0515963f, 0.0412771f, 0.0794306f, 0.0603964f, 0.0558182f,
+    0.0572825f, 0.0551012f, 0.053759f, 0.0538331f, 0.0531258f,
+    0.0600001f, 0.0560282f, 0.0536119f, 0.0420133f, 0.0336107f,
+    0.058882f, 0.0443736f, 0.0411133f, 0.0414583f, 0.0404902f,
+    0.0392741f, 0.0390089f, 0.0383966f, 0.0434077f, 0.0407119f,
+    0.0391758f, 0.0313264f, 0.0250611f, 0.0492058f, 0.0376212f,
+    0.0359112f, 0.0355235f, 0.0350951f, 0.033524f, 0.0332167f,
+    0.0337023f, 0.0363458f, 0.0348792f, 0.0344639f, 0.0258479f,
+    0.0206783f, 0.0469055f, 0.036299f, 0.0353756f, 0.0350245f,
+    0.0345729f, 0.0330451f, 0.0324095f, 0.0332026f, 0.0351474f,
+    0.0340073f, 0.0339529f, 0.0254647f, 0.0203718f, 0.0459839f,
+    0.035864f, 0.0353045f, 0.0349615f, 0.0345049f, 0.032984f,
+    0.0323467f, 0.0331379f, 0.0348646f, 0.0338238f, 0.0338869f,
+    0.0254152f, 0.0203321f, 0.142088f, 0.110845f, 0.109145f,
+    0.108085f, 0.106673f, 0.101971f, 0.100001f, 0.102447f,
+    0.107774f, 0.104561f, 0.104763f, 0.078572f, 0.0628576f,
+    0.120221f, 0.0927909f, 0.0884065f, 0.0884654f, 0.0864222f,
+    0.0830722f, 0.0832516f, 0.0829964f, 0.0915255f, 0.0870493f,
+    0.085018f, 0.0640423f, 0.0512338f, 0.102411f, 0.0783235f,
+    0.0731422f, 0.0743366f, 0.0715167f, 0.0697888f, 0.0699118f,
+    0.0690543f, 0.0774305f, 0.072939f, 0.0704959f, 0.0536468f,
+    0.0429174f, 0.0818621f, 0.0623008f, 0.0582979f, 0.0585123f,
+    0.0569805f, 0.0549793f, 0.0550876f, 0.0547162f, 0.0608381f,
+    0.0576228f, 0.0560598f, 0.0423695f, 0.0338957f, 0.0721859f,
+    0.0555484f, 0.0535634f, 0.0530042f, 0.0523475f, 0.0500159f,
+    0.0492954f, 0.0502712f, 0.0537762f, 0.05179f, 0.0514073f,
+    0.0385555f, 0.0308444f, 0.0698856f, 0.0542262f, 0.0530278f,
+    0.0525052f, 0.0518253f, 0.049537f, 0.0485827f, 0.0497715f,
+    0.0525778f, 0.0509182f, 0.0508963f, 0.0381722f, 0.0305378f,
+    0.068964f, 0.0537911f, 0.0529567f, 0.0524422f, 0.0517573f,
+    0.0494759f, 0.0485199f, 0.0497068f, 0.052295f, 0.0507347f,
+    0.0508303f, 0.0381227f, 0.0304982f, 0.188048f, 0.1467f,
+    0.14445f, 0.143046f, 0.141178f, 0.134955f, 0.132348f,
+    0.135585f, 0.142635f, 0.138383f, 0.138649f, 0.103987f,
+    0.0831897f, 0.166181f, 0.128645f, 0.123711f, 0.122573f,
+    0.120927f, 0.115463f, 0.115409f, 0.116134f, 0.126386f,
+    0.120871f, 0.118786f, 0.0890894f, 0.0712715f, 0.148371f,
+    0.114178f, 0.108447f, 0.108445f, 0.106007f, 0.101848f,
+    0.102069f, 0.101802f, 0.112291f, 0.106761f, 0.104264f,
+    0.0785387f, 0.062831f, 0.127822f, 0.0981551f, 0.0936023f,
+    0.0926203f, 0.0914853f, 0.0873478f, 0.087245f, 0.087854f,
+    0.095699f, 0.0914445f, 0.0898381f, 0.0673786f, 0.0539029f,
+    0.118146f, 0.0914028f, 0.0888678f, 0.0879656f, 0.0868523f,
+    0.0829998f, 0.0814528f, 0.083409f, 0.0886371f, 0.0856117f,
+    0.0852941f, 0.0639705f, 0.0511765f, 0.115846f, 0.0900805f,
+    0.0883322f, 0.0874666f, 0.0863301f, 0.0825208f, 0.0809293f,
+    0.0829092f, 0.0874387f, 0.0847399f, 0.0847831f, 0.0635873f,
+    0.0508699f, 0.114924f, 0.0896455f, 0.0882611f, 0.0874037f,
+    0.0862621f, 0.0824597f, 0.0808665f, 0.0828445f, 0.0871559f,
+    0.0845564f, 0.0847171f, 0.0635378f, 0.0508302f, 0.53275f,
+    0.415607f, 0.409233f, 0.405257f, 0.399964f, 0.382334f,
+    0.374947f, 0.384118f, 0.404091f, 0.392046f, 0.3928f,
+    0.2946f, 0.23568f, 0.510882f, 0.397553f, 0.388494f,
+    0.384504f, 0.379713f, 0.362842f, 0.356589f, 0.364668f,
+    0.387843f, 0.374533f, 0.372903f, 0.279677f, 0.223742f,
+    0.493072f, 0.383085f, 0.37323f, 0.369339f, 0.364793f,
+    0.348546f, 0.34325f, 0.350335f, 0.373748f, 0.360424f,
+    0.358247f, 0.268686f, 0.214948f, 0.472524f, 0.367063f,
+    0.358385f, 0.354741f, 0.350271f, 0.334727f, 0.328425f,
+    0.336387f, 0.357156f, 0.345107f, 0.343989f, 0.257992f,
+    0.206394f, 0.462848f, 0.36031f, 0.353651f, 0.350176f,
+    0.345638f, 0.330379f, 0.324011f, 0.331942f, 0.350094f,
+    0.339274f, 0.339445f, 0.254584f, 0.203667f, 0.460547f,
+    0.358988f, 0.353115f, 0.349677f, 0.345116f, 0.3299f,
+    0.323528f, 0.331443f, 0.348895f, 0.338403f, 0.338934f,
+    0.2542f, 0.20336f, 0.459626f, 0.358553f, 0.353044f,
+    0.349614f, 0.345048f, 0.329838f, 0.323466f, 0.331378f,
+    0.348612f, 0.338219f, 0.338868f, 0.254151f, 0.203321f,
+    0.0614604f, 0.0572269f, 0.0547632f, 0.055799f, 0.055092f,
+    0.0540079f, 0.0523505f, 0.0515119f, 0.0539406f, 0.0528923f,
+    0.0501416f, 0.0377948f, 0.0302638f, 0.0391396f, 0.0379782f,
+    0.0366912f, 0.0378465f, 0.0350259f, 0.0344553f, 0.0347524f,
+    0.0346799f, 0.0371124f, 0.0359528f, 0.0327274f, 0.0263236f,
+    0.0210589f, 0.028259f, 0.0289244f, 0.0265984f, 0.0280099f,
+    0.0290954f, 0.0270945f, 0.0256403f, 0.024865f, 0.024313f,
+    0.0269447f, 0.022707f, 0.0212958f, 0.0170367f, 0.0225056f,
+    0.0272154f, 0.0248241f, 0.0262137f, 0.0271912f, 0.0252354f,
+    0.0235089f, 0.0227311f, 0.0219591f, 0.0223195f, 0.0189341f,
+    0.0142006f, 0.0113605f, 0.0153574f, 0.0187165f, 0.0171974f,
+    0.0180057f, 0.0188026f, 0.0175061f, 0.0160407f, 0.0156215f,
+    0.0149621f, 0.0141736f, 0.0121909f, 0.0091432f, 0.00731456f,
+    0.0143466f, 0.0114218f, 0.0105891f, 0.0110549f, 0.0117378f,
+    0.0110621f, 0.0100425f, 0.00997166f, 0.00955964f, 0.00887936f,
+    0.00777753f, 0.00583315f, 0.00466652f, 0.0113995f, 0.00644643f,
+    0.00662687f, 0.00666659f, 0.00644387f, 0.00544163f, 0.00486091f,
+    0.00450813f, 0.00406404f, 0.00348627f, 0.00290522f, 0.00217892f,
+    0.00174313f, 0.0807687f, 0.0752053f, 0.0719675f, 0.0733288f,
+    0.0723997f, 0.070975f, 0.0687969f, 0.0676948f, 0.0708865f,
+    0.0695088f, 0.0658941f, 0.0496684f, 0.0397715f, 0.0569573f,
+    0.0553396f, 0.0533383f, 0.0550969f, 0.0519951f, 0.0510553f,
+    0.0505073f, 0.0508628f, 0.0535117f, 0.0525694f, 0.0482797f,
+    0.0374504f, 0.0299603f, 0.0422757f, 0.0408644f, 0.0403553f,
+    0.0407803f, 0.0377747f, 0.0371718f, 0.0375637f, 0.0372859f,
+    0.0404067f, 0.0388213f, 0.0354997f, 0.0301268f, 0.0241014f,
+    0.0287296f, 0.034038f, 0.0310059f, 0.0328826f, 0.0341618f,
+    0.0317788f, 0.0298244f, 0.0289134f, 0.0281115f, 0.0300405f,
+    0.0254106f, 0.0213624f, 0.0170899f, 0.0210592f, 0.0255391f,
+    0.0233793f, 0.0246745f, 0.0257733f, 0.0240494f, 0.0223562f,
+    0.0218038f, 0.0211144f, 0.0218945f, 0.0186674f, 0.0140005f,
+    0.0112004f, 0.0193482f, 0.0182444f, 0.0172796f, 0.0177237f,
+    0.0187084f, 0.0176055f, 0.0165144f, 0.0163107f, 0.0170132f,
+    0.0168172f, 0.0158369f, 0.0119392f, 0.00955363f, 0.0193084f,
+    0.0179785f, 0.0172045f, 0.0175299f, 0.0173078f, 0.0169672f,
+    0.0164465f, 0.0161834f, 0.0169461f, 0.0166186f, 0.0157526f,
+    0.0118737f, 0.00950775f, 0.100077f, 0.0931837f, 0.0891719f,
+    0.0908586f, 0.0897074f, 0.0879421f, 0.0852432f, 0.0838777f,
+    0.0878325f, 0.0861254f, 0.0816466f, 0.061542f, 0.0492791f,
+    0.0762657f, 0.072701f, 0.0699854f, 0.0723473f, 0.0693028f,
+    0.0680224f, 0.0662621f, 0.0670458f, 0.0699111f, 0.069186f,
+    0.0640322f, 0.0492448f, 0.0393958f, 0.0599507f, 0.0582258f,
+    0.0562277f, 0.0580307f, 0.0543416f, 0.0533581f, 0.0533185f,
+    0.0534688f, 0.0568061f, 0.0554379f, 0.0505676f, 0.0399903f,
+    0.0319922f, 0.0436107f, 0.0420059f, 0.0411452f, 0.0419055f,
+    0.0411325f, 0.039088f, 0.0386027f, 0.0387626f, 0.0412076f,
+    0.0403005f, 0.0368597f, 0.0301934f, 0.0241547f, 0.0390783f,
+    0.036561f, 0.0350223f, 0.0356289f, 0.0352182f, 0.0345249f,
+    0.0334652f, 0.0332584f, 0.0344753f, 0.0343605f, 0.0321704f,
+    0.0244038f, 0.019523f, 0.0386565f, 0.0360265f, 0.034484f,
+    0.0351237f, 0.0346885f, 0.0340044f, 0.0329608f, 0.0324936f,
+    0.0339591f, 0.0334338f, 0.0315893f, 0.0238128f, 0.0190613f,
+    0.0386167f, 0.0359568f, 0.0344089f, 0.0350597f, 0.0346155f,
+    0.0339343f, 0.0328929f, 0.0323663f, 0.033892f, 0.0332352f,
+    0.0315051f, 0.0237473f, 0.0190154f, 0.119385f, 0.111162f,
+    0.106376f, 0.108388f, 0.107015f, 0.104909f, 0.10169f,
+    0.100061f, 0.104778f, 0.102742f, 0.097399f, 0.0734156f,
+    0.0587868f, 0.095574f, 0.0900624f, 0.0866326f, 0.0895977f,
+    0.0866105f, 0.0849895f, 0.0824025f, 0.0832287f, 0.0863104f,
+    0.0858025f, 0.0797847f, 0.0610392f, 0.0488314f, 0.0786182f,
+    0.0755872f, 0.0728749f, 0.0752811f, 0.0716492f, 0.0703252f,
+    0.0690733f, 0.0696517f, 0.0732054f, 0.0720545f, 0.0663201f,
+    0.0513154f, 0.0410522f, 0.0629191f, 0.0593673f, 0.0572561f,
+    0.0591559f, 0.057148f, 0.0560551f, 0.0543575f, 0.0549455f,
+    0.0576069f, 0.0569171f, 0.0526122f, 0.0405011f, 0.0324009f,
+    0.0583866f, 0.0545394f, 0.0522266f, 0.0531587f, 0.0525258f,
+    0.051492f, 0.0499116f, 0.0494414f, 0.0514213f, 0.050977f,
+    0.0479229f, 0.0361982f, 0.0289585f, 0.0579649f, 0.0540049f,
+    0.0516883f, 0.0526535f, 0.0519962f, 0.0509715f, 0.0494072f,
+    0.0486765f, 0.050905f, 0.0500504f, 0.0473418f, 0.0356863f,
+    0.028569f, 0.0579251f, 0.0539352f, 0.0516132f, 0.0525894f,
+    0.0519232f, 0.0509014f, 0.0493393f, 0.0485493f, 0.0508379f,
+    0.0498518f, 0.0472576f, 0.0356209f, 0.0285231f, 0.158002f,
+    0.147119f, 0.140785f, 0.143448f, 0.14163f, 0.138843f,
+    0.134582f, 0.132427f, 0.13867f, 0.135975f, 0.128904f,
+    0.0971628f, 0.0778021f, 0.134191f, 0.125798f, 0.120663f,
+    0.124099f, 0.121226f, 0.118924f, 0.115295f, 0.115595f,
+    0.119109f, 0.119036f, 0.11129f, 0.0846281f, 0.0677025f,
+    0.117235f, 0.11031f, 0.106169f, 0.109782f, 0.106265f,
+    0.104259f, 0.101079f, 0.102018f, 0.106004f, 0.105288f,
+    0.0978251f, 0.0749042f, 0.0599234f, 0.101536f, 0.0952416f,
+    0.0912987f, 0.0936567f, 0.0917634f, 0.0899893f, 0.0872327f,
+    0.0873113f, 0.0904055f, 0.0901502f, 0.084117f, 0.06409f,
+    0.051272f, 0.0970033f, 0.0904961f, 0.0866353f, 0.0882182f,
+    0.0871411f, 0.0854262f, 0.0828044f, 0.0818072f, 0.0853131f,
+    0.0842102f, 0.0794278f, 0.0598777f, 0.0479118f, 0.0965816f,
+    0.0899616f, 0.0860971f, 0.0877131f, 0.0866116f, 0.0849057f,
+    0.0823f, 0.0810424f, 0.0847969f, 0.0832836f, 0.0788467f,
+    0.0594336f, 0.0475843f, 0.0965418f, 0.089892f, 0.086022f,
+    0.087649f, 0.0865385f, 0.0848356f, 0.0822321f, 0.0809151f,
+    0.0847298f, 0.0830849f, 0.0787625f, 0.0593681f, 0.0475384f,
+    0.447628f, 0.416794f, 0.39885f, 0.406395f, 0.401246f,
+    0.39335f, 0.381278f, 0.37517f, 0.392859f, 0.385224f,
+    0.365191f, 0.275267f, 0.220417f, 0.423816f, 0.395474f,
+    0.378729f, 0.385582f, 0.380841f, 0.37343f, 0.361991f,
+    0.358339f, 0.373062f, 0.368285f, 0.347576f, 0.262021f,
+    0.209617f, 0.40686f, 0.379918f, 0.36387f, 0.370384f,
+    0.36588f, 0.358766f, 0.347775f, 0.344761f, 0.358409f,
+    0.354536f, 0.334112f, 0.251881f, 0.201505f, 0.391161f,
+    0.364917f, 0.349364f, 0.355753f, 0.351378f, 0.344496f,
+    0.333928f, 0.330055f, 0.344086f, 0.339399f, 0.320404f,
+    0.241535f, 0.193259f, 0.386629f, 0.360172f, 0.344701f,
+    0.351165f, 0.346756f, 0.339933f, 0.3295f, 0.324551f,
+    0.339502f, 0.333459f, 0.315715f, 0.237982f, 0.190527f,
+    0.386207f, 0.359637f, 0.344162f, 0.35066f, 0.346226f,
+    0.339412f, 0.328996f, 0.323787f, 0.338986f, 0.332532f,
+    0.315134f, 0.237537f, 0.190199f, 0.386167f, 0.359568f,
+    0.344087f, 0.350596f, 0.346153f, 0.339342f, 0.328928f,
+    0.323659f, 0.338919f, 0.332334f, 0.315049f, 0.237472f,
+    0.190153f, 0.0560996f, 0.056345f, 0.05572f, 0.0552829f,
+    0.0538794f, 0.0527526f, 0.050762f, 0.0503527f, 0.0499453f,
+    0.0482567f, 0.0443626f, 0.0332875f, 0.02663f, 0.0384922f,
+    0.0357323f, 0.0356338f, 0.0362153f, 0.0352696f, 0.0347106f,
+    0.033879f, 0.0334357f, 0.0338802f, 0.0332821f, 0.0296076f,
+    0.0232554f, 0.0186044f, 0.0353756f, 0.0288465f, 0.0295327f,
+    0.0287448f, 0.0286797f, 0.0279298f, 0.0264089f, 0.0254495f,
+    0.0241453f, 0.0258964f, 0.0215803f, 0.0182061f, 0.0145649f,
+    0.0317864f, 0.0259367f, 0.0265622f, 0.0255668f, 0.0255135f,
+    0.0247239f, 0.0230145f, 0.0218868f, 0.0204891f, 0.0196699f,
+    0.0163916f, 0.0122937f, 0.00983496f, 0.0204572f, 0.0167794f,
+    0.0172749f, 0.0165193f, 0.0167728f, 0.0163637f, 0.0150872f,
+    0.0143344f, 0.0133416f, 0.0117329f, 0.00977746f, 0.00733309f,
+    0.00586647f, 0.0117257f, 0.00972782f, 0.0101043f, 0.00970269f,
+    0.0102115f, 0.010159f, 0.00939952f, 0.00907976f, 0.00852143f,
+    0.00757983f, 0.00631652f, 0.0048575f, 0.003886f, 0.00829152f,
+    0.00634503f, 0.00688992f, 0.00553144f, 0.00542571f, 0.00470611f,
+    0.00417222f, 0.00373006f, 0.00339697f, 0.00283626f, 0.00236355f,
+    0.00246591f, 0.00197272f, 0.0737238f, 0.0740463f, 0.0732249f,
+    0.0726506f, 0.0708061f, 0.0693253f, 0.0667094f, 0.0661714f,
+    0.0656361f, 0.063417f, 0.0582995f, 0.0437451f, 0.0349961f,
+    0.0548987f, 0.0529327f, 0.0524471f, 0.0526056f, 0.051255f,
+    0.0504064f, 0.0491735f, 0.0492545f, 0.0487602f, 0.0484424f,
+    0.0433439f, 0.0334511f, 0.0267609f, 0.044125f, 0.0395635f,
+    0.0390058f, 0.0390734f, 0.0380482f, 0.0374954f, 0.036649f,
+    0.0359116f, 0.0370991f, 0.0360949f, 0.0323045f, 0.0266155f,
+    0.0212924f, 0.0405358f, 0.0330803f, 0.0338972f, 0.0328288f,
+    0.0328258f, 0.0319428f, 0.0300054f, 0.0287909f, 0.0271826f,
+    0.0281513f, 0.0234594f, 0.0185129f, 0.0148104f, 0.0292067f,
+    0.0239229f, 0.0246098f, 0.0237813f, 0.0240851f, 0.0235825f,
+    0.0220782f, 0.0212385f, 0.0200351f, 0.0202144f, 0.0168453f,
+    0.012634f, 0.0101072f, 0.0204751f, 0.0177745f, 0.0175726f,
+    0.0174393f, 0.0175239f, 0.0173779f, 0.0163905f, 0.0159839f,
+    0.0157645f, 0.0157405f, 0.014021f, 0.0105591f, 0.00844731f,
+    0.0176242f, 0.0177015f, 0.0175051f, 0.0173678f, 0.0169268f,
+    0.0165728f, 0.0159475f, 0.0158191f, 0.0156909f, 0.0151625f,
+    0.0139371f, 0.0104578f, 0.00836623f, 0.091348f, 0.0917477f,
+    0.0907298f, 0.0900182f, 0.0877329f, 0.085898f, 0.0826567f,
+    0.0819902f, 0.0813269f, 0.0785773f, 0.0722364f, 0.0542027f,
+    0.0433621f, 0.0713136f, 0.070634f, 0.0699521f, 0.0695507f,
+    0.0678346f, 0.066513f, 0.0644679f, 0.0650732f, 0.0636401f,
+    0.0636027f, 0.0572519f, 0.04382f, 0.035056f, 0.0583402f,
+    0.0553015f, 0.0547869f, 0.0554638f, 0.0540336f, 0.0531912f,
+    0.0519435f, 0.0517303f, 0.0519791f, 0.0512552f, 0.0455512f,
+    0.0355569f, 0.0284455f, 0.0492853f, 0.0406075f, 0.0412322f,
+    0.0400908f, 0.0401381f, 0.0391617f, 0.0375724f, 0.0375993f,
+    0.0379407f, 0.0373018f, 0.0332657f, 0.0269223f, 0.0215378f,
+    0.0379562f, 0.035997f, 0.0355898f, 0.0353358f, 0.0344389f,
+    0.0337226f, 0.0324685f, 0.0324483f, 0.0319999f, 0.0315282f,
+    0.0285366f, 0.0216843f, 0.0173474f, 0.0352968f, 0.0354758f,
+    0.0350776f, 0.0348069f, 0.0339226f, 0.0332129f, 0.0319631f,
+    0.0317504f, 0.0314553f, 0.0305491f, 0.0279579f, 0.0209935f,
+    0.0167948f, 0.0352485f, 0.0354028f, 0.03501f, 0.0347354f,
+    0.0338536f, 0.0331455f, 0.0318948f, 0.0316378f, 0.0313817f,
+    0.0303228f, 0.027874f, 0.0209153f, 0.0167323f, 0.108972f,
+    0.109449f, 0.108235f, 0.107386f, 0.10466f, 0.102471f,
+    0.0986041f, 0.0978089f, 0.0970177f, 0.0937376f, 0.0861734f,
+    0.0646602f, 0.0517282f, 0.0883055f, 0.0883354f, 0.0874571f,
+    0.0869183f, 0.0847613f, 0.0830857f, 0.0800811f, 0.0808919f,
+    0.0793125f, 0.0787631f, 0.0711599f, 0.054189f, 0.0433512f,
+    0.0747467f, 0.0730028f, 0.0722919f, 0.0719044f, 0.0701282f,
+    0.068887f, 0.0672379f, 0.0675491f, 0.066859f, 0.0664155f,
+    0.0594404f, 0.0458623f, 0.0366898f, 0.0582712f, 0.0583089f,
+    0.0576882f, 0.057344f, 0.0559055f, 0.0547793f, 0.0528669f,
+    0.053418f, 0.0528207f, 0.0524621f, 0.0469995f, 0.0362219f,
+    0.0289775f, 0.053358f, 0.0536984f, 0.0530947f, 0.0527034f,
+    0.0513656f, 0.0502953f, 0.0484159f, 0.048267f, 0.0476907f,
+    0.0466885f, 0.0424631f, 0.0320532f, 0.0256426f, 0.052921f,
+    0.0531771f, 0.0525825f, 0.0521745f, 0.0508493f, 0.0497857f,
+    0.0479104f, 0.0475692f, 0.047146f, 0.0457094f, 0.0418948f,
+    0.0314511f, 0.0251609f, 0.0528727f, 0.0531042f, 0.052515f,
+    0.0521031f, 0.0507803f, 0.0497182f, 0.0478422f, 0.0474566f,
+    0.0470725f, 0.045483f, 0.0418109f, 0.0313729f, 0.0250984f,
+    0.144221f, 0.144852f, 0.143245f, 0.142121f, 0.138513f,
+    0.135616f, 0.130499f, 0.129446f, 0.128399f, 0.124058f,
+    0.114047f, 0.0855755f, 0.0684603f, 0.122688f, 0.123738f,
+    0.122467f, 0.121654f, 0.118615f, 0.116231f, 0.111976f,
+    0.112529f, 0.110694f, 0.109084f, 0.0989759f, 0.0749269f,
+    0.0599416f, 0.108137f, 0.108405f, 0.107302f, 0.10664f,
+    0.103982f, 0.101909f, 0.0982162f, 0.0991866f, 0.097231f,
+    0.0967361f, 0.0872563f, 0.0666003f, 0.0532802f, 0.0929106f,
+    0.0937115f, 0.0926981f, 0.0920793f, 0.0897589f, 0.0879247f,
+    0.0846919f, 0.0850555f, 0.0836381f, 0.0827827f, 0.0748155f,
+    0.0569597f, 0.0455678f, 0.0886065f, 0.089101f, 0.0881046f,
+    0.0874387f, 0.085219f, 0.0834408f, 0.0803106f, 0.0799046f,
+    0.0790723f, 0.0770091f, 0.0703369f, 0.0528447f, 0.0422758f,
+    0.0881694f, 0.0885798f, 0.0875924f, 0.0869098f, 0.0847028f,
+    0.0829311f, 0.0798051f, 0.0792066f, 0.0785276f, 0.07603f,
+    0.0697687f, 0.0523663f, 0.041893f, 0.0881211f, 0.0885068f,
+    0.0875249f, 0.0868384f, 0.0846337f, 0.0828637f, 0.0797369f,
+    0.0790941f, 0.078454f, 0.0758036f, 0.0696848f, 0.0522881f,
+    0.0418305f, 0.408584f, 0.410371f, 0.405819f, 0.402636f,
+    0.392414f, 0.384207f, 0.369709f, 0.366728f, 0.363761f,
+    0.351463f, 0.323101f, 0.242439f, 0.193951f, 0.387051f,
+    0.389258f, 0.385041f, 0.382168f, 0.372515f, 0.364822f,
+    0.351186f, 0.349811f, 0.346056f, 0.336488f, 0.307995f,
+    0.231352f, 0.185082f, 0.371671f, 0.373925f, 0.369876f,
+    0.367154f, 0.357882f, 0.3505f, 0.337427f, 0.336468f,
+    0.332593f, 0.32414f, 0.29617f, 0.222558f, 0.178047f,
+    0.357274f, 0.359231f, 0.355272f, 0.352594f, 0.34366f,
+    0.336515f, 0.323902f, 0.322337f, 0.319f, 0.310187f,
+    0.283793f, 0.213174f, 0.170539f, 0.35297f, 0.354621f,
+    0.350679f, 0.347953f, 0.33912f, 0.332032f, 0.319521f,
+    0.317186f, 0.314434f, 0.304414f, 0.279391f, 0.209708f,
+    0.167767f, 0.352533f, 0.3541f, 0.350166f, 0.347424f,
+    0.338604f, 0.331522f, 0.319015f, 0.316488f, 0.31389f,
+    0.303434f, 0.278823f, 0.20923f, 0.167384f, 0.352484f,
+    0.354026f, 0.350099f, 0.347353f, 0.338535f, 0.331454f,
+    0.318947f, 0.316375f, 0.313816f, 0.303208f, 0.278739f,
+    0.209152f, 0.167321f, 0.0594301f, 0.05804f, 0.0552814f,
+    0.0534036f, 0.0532831f, 0.0513509f, 0.0494928f, 0.0475747f,
+    0.0451624f, 0.0417733f, 0.03605f, 0.0270375f, 0.02163f,
+    0.0376066f, 0.0364393f, 0.0364096f, 0.0361505f, 0.0355172f,
+    0.0343139f, 0.033054f, 0.0318117f, 0.0303216f, 0.0293365f,
+    0.0257034f, 0.0201595f, 0.0161276f, 0.0287159f, 0.0301306f,
+    0.0330313f, 0.0309567f, 0.0303897f, 0.0289843f, 0.0276411f,
+    0.0263884f, 0.0248295f, 0.0252822f, 0.0210685f, 0.0158014f,
+    0.0126411f, 0.0225059f, 0.0238565f, 0.0263948f, 0.024423f,
+    0.024049f, 0.0226642f, 0.0216696f, 0.0204126f, 0.0189613f,
+    0.0174369f, 0.0145307f, 0.010898f, 0.00871844f, 0.0142006f,
+    0.0144512f, 0.0150942f, 0.0138399f, 0.0139003f, 0.013087f,
+    0.0127987f, 0.0121067f, 0.0112197f, 0.0103065f, 0.00858875f,
+    0.00644156f, 0.00515325f, 0.0120244f, 0.0127045f, 0.0119489f,
+    0.0109512f, 0.00975508f, 0.00897974f, 0.00845325f, 0.00792512f,
+    0.00721195f, 0.00675146f, 0.00562621f, 0.00421966f, 0.00337573f,
+    0.00591332f, 0.00675445f, 0.0065109f, 0.00552507f, 0.00451763f,
+    0.00395345f, 0.00350977f, 0.00312697f, 0.00275889f, 0.00230543f,
+    0.0019212f, 0.00149624f, 0.00119699f, 0.0781006f, 0.0762739f,
+    0.0726486f, 0.0701807f, 0.0700225f, 0.0674832f, 0.0650414f,
+    0.0625207f, 0.0593506f, 0.0548968f, 0.0473755f, 0.0355316f,
+    0.0284253f, 0.0562771f, 0.0546731f, 0.052959f, 0.052538f,
+    0.0515442f, 0.0497431f, 0.0478954f, 0.0460418f, 0.0438597f,
+    0.04246f, 0.0360728f, 0.0279426f, 0.0223541f, 0.0401958f,
+    0.0388891f, 0.0424888f, 0.0399971f, 0.0393315f, 0.0377265f,
+    0.0378587f, 0.0346644f, 0.0330202f, 0.0348789f, 0.0290799f,
+    0.0231263f, 0.018501f, 0.0308162f, 0.0325003f, 0.0358524f,
+    0.0334634f, 0.0329909f, 0.0314065f, 0.0300919f, 0.0286887f,
+    0.0269471f, 0.0270336f, 0.022528f, 0.016896f, 0.0135168f,
+    0.0206871f, 0.0219698f, 0.0245518f, 0.0228804f, 0.0228422f,
+    0.0218292f, 0.021221f, 0.0203827f, 0.0192056f, 0.0191739f,
+    0.0159782f, 0.0119837f, 0.00958693f, 0.0187553f, 0.0183053f,
+    0.0177051f, 0.0168469f, 0.0168128f, 0.0162053f, 0.0159496f,
+    0.015567f, 0.0148039f, 0.0152472f, 0.012706f, 0.00952952f,
+    0.00762362f, 0.0186707f, 0.018234f, 0.0173673f, 0.0167774f,
+    0.0167396f, 0.0161325f, 0.0155488f, 0.0149462f, 0.0141883f,
+    0.0131267f, 0.0113256f, 0.00849423f, 0.00679539f, 0.0967711f,
+    0.0945076f, 0.0900158f, 0.086958f, 0.086762f, 0.0836155f,
+    0.0805901f, 0.0774667f, 0.0735389f, 0.0680202f, 0.0587009f,
+    0.0440257f, 0.0352206f, 0.0749477f, 0.0729069f, 0.0695084f,
+    0.0689256f, 0.0675712f, 0.0651724f, 0.0628994f, 0.0607217f,
+    0.0578613f, 0.0555835f, 0.0469959f, 0.0360698f, 0.0288558f,
+    0.0588663f, 0.057123f, 0.0557961f, 0.0554141f, 0.0544251f,
+    0.0526005f, 0.0507042f, 0.048822f, 0.0465583f, 0.0451171f,
+    0.0394494f, 0.0309094f, 0.0247275f, 0.0431389f, 0.0418905f,
+    0.0453099f, 0.0425038f, 0.0419328f, 0.0401487f, 0.0389985f,
+    0.0369648f, 0.034933f, 0.0366303f, 0.0305252f, 0.0235784f,
+    0.0188627f, 0.038029f, 0.0370786f, 0.0353144f, 0.0341347f,
+    0.0340828f, 0.0328655f, 0.0317001f, 0.0305101f, 0.0289918f,
+    0.0287706f, 0.0239755f, 0.0185808f, 0.0148646f, 0.0374258f,
+    0.0365391f, 0.0348021f, 0.0336241f, 0.0335521f, 0.0323377f,
+    0.0311706f, 0.0299694f, 0.028454f, 0.026527f, 0.0227509f,
+    0.0170632f, 0.0136506f, 0.0373412f, 0.0364678f, 0.0347345f,
+    0.0335546f, 0.0334789f, 0.0322648f, 0.0310974f, 0.0298922f,
+    0.0283765f, 0.0262502f, 0.0226511f, 0.0169883f, 0.0135907f,
+    0.115442f, 0.112741f, 0.107383f, 0.103735f, 0.103501f,
+    0.0997478f, 0.0961387f, 0.0924126f, 0.0877269f, 0.0811436f,
+    0.0700264f, 0.0525198f, 0.0420159f, 0.0936182f, 0.0911408f,
+    0.0867941f, 0.0853131f, 0.0839992f, 0.0811556f, 0.0784481f,
+    0.0756676f, 0.0720496f, 0.0687069f, 0.0583178f, 0.0443121f,
+    0.0354497f, 0.0775368f, 0.0753568f, 0.0723455f, 0.0718017f,
+    0.0704521f, 0.0680298f, 0.0655456f, 0.063052f, 0.0600965f,
+    0.0582406f, 0.0498189f, 0.0386924f, 0.0309539f, 0.0618094f,
+    0.0601243f, 0.0572559f, 0.0564195f, 0.0554f, 0.053503f,
+    0.0517418f, 0.0498753f, 0.0474905f, 0.046227f, 0.0401103f,
+    0.0313614f, 0.0250891f, 0.0566995f, 0.0553124f, 0.0526816f,
+    0.0509119f, 0.0508222f, 0.0489978f, 0.0472488f, 0.0454561f,
+    0.04318f, 0.0406711f, 0.034653f, 0.0263638f, 0.021091f,
+    0.0560964f, 0.0547729f, 0.0521692f, 0.0504013f, 0.0502915f,
+    0.04847f, 0.0467193f, 0.0449154f, 0.0426422f, 0.0396505f,
+    0.0340751f, 0.0255563f, 0.020445f, 0.0560117f, 0.0547016f,
+    0.0521016f, 0.0503318f, 0.0502183f, 0.0483971f, 0.046646f,
+    0.0448383f, 0.0425647f, 0.0393736f, 0.0339765f, 0.0254824f,
+    0.0203859f, 0.152783f, 0.149209f, 0.142117f, 0.13729f,
+    0.13698f, 0.132012f, 0.127236f, 0.122305f, 0.116103f,
+    0.107391f, 0.0926773f, 0.069508f, 0.0556064f, 0.130959f,
+    0.127608f, 0.121528f, 0.118088f, 0.117478f, 0.11342f,
+    0.109545f, 0.10556f, 0.100426f, 0.0949538f, 0.080966f,
+    0.0610608f, 0.0488487f, 0.114878f, 0.111824f, 0.106491f,
+    0.104577f, 0.103035f, 0.0995245f, 0.0961844f, 0.0927656f,
+    0.0883204f, 0.0844875f, 0.071533f, 0.054754f, 0.0438032f,
+    0.0991504f, 0.096592f, 0.0919902f, 0.0891946f, 0.0888787f,
+    0.0857675f, 0.0827994f, 0.0797673f, 0.0758668f, 0.0722923f,
+    0.0612467f, 0.0469276f, 0.037542f, 0.0940406f, 0.09178f,
+    0.0874159f, 0.0844664f, 0.084301f, 0.0812624f, 0.078346f,
+    0.0753482f, 0.0715564f, 0.0669181f, 0.0573012f, 0.0430271f,
+    0.0344217f, 0.0934374f, 0.0912406f, 0.0869035f, 0.0839558f,
+    0.0837704f, 0.0807347f, 0.0778166f, 0.0748074f, 0.0710186f,
+    0.0658974f, 0.0567232f, 0.0425424f, 0.034034f, 0.0933527f,
+    0.0911692f, 0.0868359f, 0.0838863f, 0.0836972f, 0.0806618f,
+    0.0777432f, 0.0747303f, 0.070941f, 0.0656206f, 0.0566275f,
+    0.0424706f, 0.0339765f, 0.432841f, 0.422716f, 0.402625f,
+    0.388948f, 0.388071f, 0.373997f, 0.360465f, 0.346495f,
+    0.328926f, 0.304242f, 0.262559f, 0.196919f, 0.157535f,
+    0.411017f, 0.401116f, 0.382036f, 0.369194f, 0.368569f,
+    0.355405f, 0.342775f, 0.32975f, 0.313249f, 0.291806f,
+    0.250827f, 0.188121f, 0.150497f, 0.394936f, 0.385332f,
+    0.366998f, 0.354687f, 0.354126f, 0.341509f, 0.329414f,
+    0.316956f, 0.301143f, 0.281339f, 0.241394f, 0.181046f,
+    0.144837f, 0.379208f, 0.370099f, 0.352498f, 0.34061f,
+    0.33997f, 0.327753f, 0.316029f, 0.303958f, 0.28869f,
+    0.269144f, 0.231108f, 0.173331f, 0.138665f, 0.374098f,
+    0.365287f, 0.347923f, 0.336125f, 0.335392f, 0.323247f,
+    0.311575f, 0.299539f, 0.284379f, 0.26377f, 0.227163f,
+    0.170372f, 0.136298f, 0.373495f, 0.364748f, 0.347411f,
+    0.335614f, 0.334861f, 0.322719f, 0.311046f, 0.298998f,
+    0.283841f, 0.262749f, 0.226597f, 0.169948f, 0.135958f,
+    0.373411f, 0.364676f, 0.347343f, 0.335545f, 0.334788f,
+    0.322647f, 0.310972f, 0.298921f, 0.283764f, 0.262473f,
+    0.226509f, 0.169882f, 0.135906f, 0.0566315f, 0.0568649f,
+    0.0558638f, 0.0536562f, 0.052161f, 0.0494244f, 0.0467528f,
+    0.0438898f, 0.040699f, 0.0345475f, 0.0290432f, 0.0218136f,
+    0.0174509f, 0.0373787f, 0.038467f, 0.0388605f, 0.0379203f,
+    0.0367568f, 0.0357155f, 0.0362095f, 0.0328308f, 0.030164f,
+    0.0278869f, 0.0232671f, 0.0174504f, 0.0139603f, 0.031833f,
+    0.0308862f, 0.0304553f, 0.0302311f, 0.0291584f, 0.0285645f,
+    0.0287092f, 0.026468f, 0.0246952f, 0.0231528f, 0.0193281f,
+    0.0144961f, 0.0115968f, 0.0245149f, 0.0226643f, 0.0218f,
+    0.0206466f, 0.0197126f, 0.0183914f, 0.0177809f, 0.0171925f,
+    0.0161261f, 0.0146641f, 0.0122597f, 0.00919474f, 0.0073558f,
+    0.0129058f, 0.0118601f, 0.0115758f, 0.0114129f, 0.0110693f,
+    0.0102691f, 0.00934764f, 0.00889297f, 0.00844647f, 0.00796532f,
+    0.00663777f, 0.00497832f, 0.00398266f, 0.00632033f, 0.00748121f,
+    0.00801625f, 0.00788712f, 0.00760983f, 0.00690404f, 0.00619775f,
+    0.00582335f, 0.00534392f, 0.00484345f, 0.00403621f, 0.00302715f,
+    0.00242172f, 0.00136108f, 0.00307212f, 0.00306463f, 0.00298347f,
+    0.00283426f, 0.00248155f, 0.00217859f, 0.00200046f, 0.00179158f,
+    0.00150282f, 0.00125235f, 0.000939262f, 0.000751409f, 0.0744228f,
+    0.0747295f, 0.073414f, 0.0705128f, 0.0685479f, 0.0649516f,
+    0.0614407f, 0.0576781f, 0.0534849f, 0.045401f, 0.0381675f,
+    0.0286666f, 0.0229333f, 0.053248f, 0.0542259f, 0.0531267f,
+    0.0518016f, 0.0504951f, 0.0487328f, 0.0496213f, 0.0448194f,
+    0.0410362f, 0.0378499f, 0.0315761f, 0.0237998f, 0.0190398f,
+    0.0430293f, 0.04423f, 0.0447215f, 0.0438319f, 0.0425892f,
+    0.0415817f, 0.0421211f, 0.0384566f, 0.0355673f, 0.0331157f,
+    0.027637f, 0.0207278f, 0.0165822f, 0.0338225f, 0.0317341f,
+    0.0303557f, 0.0312875f, 0.0301957f, 0.0291815f, 0.0296885f,
+    0.0275887f, 0.0259569f, 0.0246271f, 0.0205686f, 0.0154265f,
+    0.0123412f, 0.0223384f, 0.0212551f, 0.0202796f, 0.0211636f,
+    0.0204782f, 0.019798f, 0.0204668f, 0.019195f, 0.0182391f,
+    0.0174455f, 0.0145814f, 0.010936f, 0.00874882f, 0.0178586f,
+    0.017933f, 0.0176253f, 0.0169325f, 0.0164637f, 0.0162959f,
+    0.0169783f, 0.0158664f, 0.0150241f, 0.014202f, 0.0118717f,
+    0.00890378f, 0.00712304f, 0.0177914f, 0.0178647f, 0.0175503f,
+    0.0168568f, 0.016387f, 0.0155273f, 0.014688f, 0.0137886f,
+    0.0127861f, 0.0110044f, 0.00918851f, 0.00689139f, 0.00551311f,
+    0.0922141f, 0.0925941f, 0.0909641f, 0.0873694f, 0.0849348f,
+    0.0804787f, 0.0761285f, 0.0714665f, 0.0662708f, 0.0562544f,
+    0.0472917f, 0.0355195f, 0.0284156f, 0.0710393f, 0.0714271f,
+    0.0703905f, 0.068076f, 0.0662921f, 0.0634887f, 0.0630331f,
+    0.0568998f, 0.0529961f, 0.0478128f, 0.0398851f, 0.0305149f,
+    0.0244119f, 0.0567325f, 0.0583512f, 0.0589877f, 0.057669f,
+    0.0560199f, 0.054599f, 0.0555329f, 0.0504452f, 0.0464395f,
+    0.0430787f, 0.035946f, 0.0269595f, 0.0215676f, 0.0439911f,
+    0.0440071f, 0.0445334f, 0.0438479f, 0.0428564f, 0.0421988f,
+    0.0431003f, 0.0395772f, 0.0368291f, 0.03459f, 0.0288776f,
+    0.0216582f, 0.0173266f, 0.0361689f, 0.0363232f, 0.0357224f,
+    0.0343334f, 0.0334009f, 0.0328153f, 0.0338787f, 0.0311836f,
+    0.0291113f, 0.0274085f, 0.0228903f, 0.0171678f, 0.0137342f,
+    0.0356499f, 0.0357977f, 0.0351754f, 0.0337891f, 0.0328505f,
+    0.0311322f, 0.0303901f, 0.027855f, 0.0258962f, 0.024165f,
+    0.0201807f, 0.0151355f, 0.0121084f, 0.0355827f, 0.0357294f,
+    0.0351004f, 0.0337133f, 0.0327739f, 0.0310544f, 0.0293758f,
+    0.0275769f, 0.0255721f, 0.0217071f, 0.0182486f, 0.0137065f,
+    0.0109652f, 0.110005f, 0.110459f, 0.108514f, 0.104226f,
+    0.101322f, 0.0960058f, 0.0908163f, 0.0852549f, 0.0790568f,
+    0.0671078f, 0.0564159f, 0.0423725f, 0.033898f, 0.0888306f,
+    0.0892918f, 0.0879406f, 0.0846723f, 0.0825593f, 0.0785678f,
+    0.0764449f, 0.0703463f, 0.0654857f, 0.0577758f, 0.048194f,
+    0.03723f, 0.029784f, 0.0734195f, 0.0741679f, 0.073254f,
+    0.071506f, 0.0694507f, 0.0676163f, 0.0689447f, 0.0624338f,
+    0.0573118f, 0.0530417f, 0.044255f, 0.0331912f, 0.026553f,
+    0.0586128f, 0.0588958f, 0.0587996f, 0.057685f, 0.0562872f,
+    0.0552161f, 0.0565122f, 0.0515658f, 0.0477013f, 0.044553f,
+    0.0371866f, 0.0278899f, 0.0223119f, 0.0539602f, 0.0541879f,
+    0.0532726f, 0.05119f, 0.0497878f, 0.0472088f, 0.0472905f,
+    0.0431723f, 0.0399835f, 0.0373715f, 0.0311993f, 0.0233995f,
+    0.0187196f, 0.0534412f, 0.0536623f, 0.0527255f, 0.0506457f,
+    0.0492374f, 0.0466593f, 0.0441464f, 0.041452f, 0.0384458f,
+    0.0341279f, 0.0284897f, 0.0213672f, 0.0170938f, 0.053374f,
+    0.053594f, 0.0526505f, 0.05057f, 0.0491608f, 0.0465816f,
+    0.0440637f, 0.0413653f, 0.0383581f, 0.0325605f, 0.0273728f,
+    0.0205594f, 0.0164475f, 0.145588f, 0.146188f, 0.143614f,
+    0.137939f, 0.134095f, 0.12706f, 0.120192f, 0.112832f,
+    0.104629f, 0.0888147f, 0.0746643f, 0.0560784f, 0.0448627f,
+    0.124413f, 0.125021f, 0.123041f, 0.118385f, 0.115333f,
+    0.109561f, 0.103973f, 0.0979008f, 0.0910095f, 0.0786185f,
+    0.0655155f, 0.0506601f, 0.0405281f, 0.109002f, 0.10955f,
+    0.107887f, 0.103856f, 0.101241f, 0.0964568f, 0.0957684f,
+    0.0864677f, 0.0805477f, 0.0729677f, 0.0608729f, 0.0463733f,
+    0.0370987f, 0.0941954f, 0.0946251f, 0.0931173f, 0.0895572f,
+    0.0872029f, 0.0827998f, 0.0833358f, 0.075543f, 0.0694457f,
+    0.064479f, 0.0538046f, 0.0403534f, 0.0322827f, 0.0895428f,
+    0.0899171f, 0.0883728f, 0.0849032f, 0.0825615f, 0.0782631f,
+    0.0741141f, 0.0695982f, 0.0645795f, 0.0572974f, 0.0478172f,
+    0.0359918f, 0.0287935f, 0.0890238f, 0.0893915f, 0.0878258f,
+    0.0843589f, 0.0820111f, 0.0777136f, 0.073522f, 0.0690288f,
+    0.0640177f, 0.0544989f, 0.0457001f, 0.0345878f, 0.0276702f,
+    0.0889566f, 0.0893233f, 0.0877508f, 0.0842831f, 0.0819345f,
+    0.0776359f, 0.0734393f, 0.068942f, 0.0639299f, 0.0542674f,
+    0.0456212f, 0.0342653f, 0.0274123f, 0.412457f, 0.414157f,
+    0.406867f, 0.390788f, 0.379898f, 0.359968f, 0.34051f,
+    0.319657f, 0.296418f, 0.251616f, 0.211528f, 0.158873f,
+    0.127098f, 0.391283f, 0.39299f, 0.386293f, 0.371234f,
+    0.361136f, 0.342468f, 0.324291f, 0.304726f, 0.282798f,
+    0.241268f, 0.202102f, 0.152671f, 0.122137f, 0.375872f,
+    0.37752f, 0.371139f, 0.356705f, 0.347044f, 0.329158f,
+    0.311768f, 0.293036f, 0.272013f, 0.232699f, 0.194495f,
+    0.147416f, 0.117933f, 0.361065f, 0.362595f, 0.356369f,
+    0.342406f, 0.333006f, 0.315707f, 0.298878f, 0.280791f,
+    0.260551f, 0.22261f, 0.186198f, 0.140984f, 0.112787f,
+    0.356412f, 0.357887f, 0.351625f, 0.337752f, 0.328364f,
+    0.31117f, 0.294403f, 0.276424f, 0.256369f, 0.218059f,
+    0.183023f, 0.137885f, 0.110308f, 0.355893f, 0.357361f,
+    0.351078f, 0.337208f, 0.327814f, 0.310621f, 0.29384f,
+    0.275854f, 0.255807f, 0.217158f, 0.182563f, 0.137206f,
+    0.109765f, 0.355826f, 0.357293f, 0.351003f, 0.337132f,
+    0.327738f, 0.310543f, 0.293757f, 0.275768f, 0.255719f,
+    0.217069f, 0.182484f, 0.13706f, 0.109648f, 0.0571049f,
+    0.0556677f, 0.0549158f, 0.052794f, 0.0515338f, 0.0481042f,
+    0.0451444f, 0.0418553f, 0.038495f, 0.0318664f, 0.0267467f,
+    0.0201106f, 0.0160885f, 0.043412f, 0.0406212f, 0.040754f,
+    0.0391402f, 0.0375833f, 0.0359769f, 0.037528f, 0.0333333f,
+    0.0296262f, 0.0245422f, 0.0207627f, 0.0157379f, 0.0126251f,
+    0.0373632f, 0.0347987f, 0.0350687f, 0.0336968f, 0.0325625f,
+    0.0313317f, 0.0315222f, 0.0284625f, 0.025486f, 0.0208905f,
+    0.0174087f, 0.0130566f, 0.0104452f, 0.0222416f, 0.0205623f,
+    0.0211343f, 0.02072f, 0.0207361f, 0.0206106f, 0.0202867f,
+    0.0191334f, 0.0174759f, 0.0146559f, 0.0122132f, 0.00915992f,
+    0.00732793f, 0.0108436f, 0.00951213f, 0.00846598f, 0.0084497f,
+    0.00929752f, 0.0100583f, 0.010382f, 0.0106418f, 0.0100943f,
+    0.00886391f, 0.00738659f, 0.00553994f, 0.00443196f, 0.00780551f,
+    0.00647395f, 0.00537157f, 0.00513747f, 0.00514387f, 0.00512841f,
+    0.00576791f, 0.00648357f, 0.00641066f, 0.00593777f, 0.00494814f,
+    0.00371111f, 0.00296889f, 0.00383884f, 0.00270889f, 0.00213287f,
+    0.00187201f, 0.00200493f, 0.00172971f, 0.00154948f, 0.00185718f,
+    0.00211288f, 0.00236594f, 0.00197162f, 0.00147871f, 0.00118297f,
+    0.075045f, 0.0731562f, 0.0721681f, 0.0693797f, 0.0677236f,
+    0.0632166f, 0.059327f, 0.0550045f, 0.0505886f, 0.0418776f,
+    0.0351494f, 0.0264285f, 0.0211428f, 0.0576544f, 0.0540212f,
+    0.05419f, 0.0521271f, 0.0500755f, 0.0479747f, 0.050757f,
+    0.0449372f, 0.0398816f, 0.0335346f, 0.0283468f, 0.0219343f,
+    0.0175474f, 0.0516056f, 0.0481987f, 0.0485046f, 0.0466837f,
+    0.0450547f, 0.0433296f, 0.0447512f, 0.0400664f, 0.0357414f,
+    0.0291772f, 0.0244858f, 0.0183643f, 0.0146915f, 0.036484f,
+    0.0339622f, 0.0345703f, 0.0337069f, 0.0332283f, 0.0326085f,
+    0.0335157f, 0.0307373f, 0.0277313f, 0.0229426f, 0.0191189f,
+    0.0143391f, 0.0114713f, 0.0223489f, 0.0216346f, 0.0214793f,
+    0.0214366f, 0.0217897f, 0.0220562f, 0.023611f, 0.0222457f,
+    0.0203497f, 0.0171507f, 0.0142922f, 0.0107192f, 0.00857534f,
+    0.0181111f, 0.0179496f, 0.0173149f, 0.0166836f, 0.0167867f,
+    0.0171263f, 0.0189969f, 0.0180875f, 0.0166661f, 0.0142245f,
+    0.0118538f, 0.00889033f, 0.00711226f, 0.0179411f, 0.0174886f,
+    0.0172524f, 0.0165858f, 0.0161899f, 0.0151126f, 0.0144432f,
+    0.0134611f, 0.0123683f, 0.0106527f, 0.00887725f, 0.00665794f,
+    0.00532635f, 0.0929851f, 0.0906447f, 0.0894204f, 0.0859654f,
+    0.0839134f, 0.0783289f, 0.0735096f, 0.0681538f, 0.0626821f,
+    0.0518887f, 0.0435522f, 0.0327465f, 0.0261972f, 0.0737775f,
+    0.0712221f, 0.0704172f, 0.0682559f, 0.0653406f, 0.0623556f,
+    0.063986f, 0.0565411f, 0.0508427f, 0.0428703f, 0.0360682f,
+    0.0281307f, 0.0225045f, 0.065848f, 0.0615986f, 0.0619405f,
+    0.0596706f, 0.0575469f, 0.0553275f, 0.0579802f, 0.0516704f,
+    0.0459968f, 0.0379004f, 0.03207f, 0.0241629f, 0.0194371f,
+    0.0507264f, 0.0473622f, 0.0480062f, 0.0466937f, 0.0457205f,
+    0.0446064f, 0.0467447f, 0.0423412f, 0.0379867f, 0.0312294f,
+    0.0260245f, 0.0195184f, 0.0156147f, 0.0369078f, 0.0356087f,
+    0.0352103f, 0.0344234f, 0.0342819f, 0.0340541f, 0.03684f,
+    0.0338496f, 0.0306051f, 0.0254374f, 0.0211978f, 0.0158984f,
+    0.0127187f, 0.0360511f, 0.0350388f, 0.0345672f, 0.0332371f,
+    0.0324485f, 0.0303091f, 0.0322259f, 0.0296914f, 0.0269215f,
+    0.0225113f, 0.0187594f, 0.0140696f, 0.0112556f, 0.0358812f,
+    0.0349771f, 0.0345047f, 0.0331715f, 0.0323797f, 0.0302249f,
+    0.0283652f, 0.0262986f, 0.0241873f, 0.0200236f, 0.0168068f,
+    0.012641f, 0.0101128f, 0.110925f, 0.108133f, 0.106673f,
+    0.102551f, 0.100103f, 0.0934413f, 0.0876921f, 0.081303f,
+    0.0747757f, 0.0618998f, 0.0519549f, 0.0390645f, 0.0312516f,
+    0.0917176f, 0.0885018f, 0.0874948f, 0.0847406f, 0.0815305f,
+    0.0772876f, 0.0772151f, 0.0685489f, 0.0628425f, 0.052856f,
+    0.044283f, 0.034327f, 0.0274616f, 0.0800904f, 0.0749986f,
+    0.0753765f, 0.0726574f, 0.0700391f, 0.0673254f, 0.0712092f,
+    0.0632742f, 0.0562523f, 0.0468928f, 0.0396541f, 0.0303592f,
+    0.0242874f, 0.0649688f, 0.0607622f, 0.0614421f, 0.0596806f,
+    0.0582126f, 0.0566043f, 0.0599737f, 0.0539451f, 0.0482421f,
+    0.0395161f, 0.0331537f, 0.0248653f, 0.0199126f, 0.0548479f,
+    0.0530149f, 0.0523173f, 0.0505464f, 0.0491635f, 0.0460519f,
+    0.050069f, 0.0454535f, 0.0408605f, 0.0337242f, 0.0281035f,
+    0.0210776f, 0.0168621f, 0.0539912f, 0.0525273f, 0.0518195f,
+    0.0498228f, 0.0486383f, 0.0454214f, 0.0454549f, 0.0412953f,
+    0.0371769f, 0.030798f, 0.0256849f, 0.0195154f, 0.0156123f,
+    0.0538213f, 0.0524657f, 0.051757f, 0.0497572f, 0.0485695f,
+    0.0453373f, 0.0425478f, 0.0394479f, 0.0362809f, 0.0300348f,
+    0.0252095f, 0.018959f, 0.0151672f, 0.146805f, 0.14311f,
+    0.141177f, 0.135723f, 0.132483f, 0.123666f, 0.116057f,
+    0.107602f, 0.0989628f, 0.0819222f, 0.0687603f, 0.0517003f,
+    0.0413603f, 0.127598f, 0.123061f, 0.12165f, 0.11771f,
+    0.11391f, 0.107152f, 0.103673f, 0.0948192f, 0.0868668f,
+    0.0728273f, 0.0607571f, 0.0467198f, 0.0373758f, 0.112525f,
+    0.108607f, 0.107378f, 0.104018f, 0.0999593f, 0.0949245f,
+    0.0976672f, 0.086482f, 0.0772741f, 0.0651355f, 0.0548225f,
+    0.042752f, 0.0342016f, 0.0966056f, 0.0932235f, 0.0921698f,
+    0.0892221f, 0.0860896f, 0.0813306f, 0.0864317f, 0.0771529f,
+    0.0687529f, 0.0571495f, 0.0483221f, 0.0369693f, 0.0295754f,
+    0.0907279f, 0.087992f, 0.0868219f, 0.0835158f, 0.0815431f,
+    0.0762228f, 0.0765269f, 0.0686614f, 0.0613713f, 0.0512943f,
+    0.0431261f, 0.0331942f, 0.0265553f, 0.0898712f, 0.0875043f,
+    0.0863241f, 0.0829943f, 0.081018f, 0.0756462f, 0.0719129f,
+    0.0659333f, 0.0605521f, 0.0502954f, 0.0421553f, 0.0319082f,
+    0.0255266f, 0.0897013f, 0.0874427f, 0.0862616f, 0.0829286f,
+    0.0809492f, 0.075562f, 0.0709128f, 0.0657463f, 0.060468f,
+    0.050057f, 0.0420149f, 0.0315949f, 0.0252759f, 0.415906f,
+    0.405438f, 0.399962f, 0.384508f, 0.37533f, 0.350352f,
+    0.328796f, 0.30484f, 0.280366f, 0.232089f, 0.194801f,
+    0.146469f, 0.117176f, 0.396698f, 0.384472f, 0.379517f,
+    0.365139f, 0.356757f, 0.333629f, 0.313189f, 0.291846f,
+    0.267602f, 0.222612f, 0.186618f, 0.140843f, 0.112674f,
+    0.381626f, 0.369286f, 0.36456f, 0.351289f, 0.342806f,
+    0.320742f, 0.30109f, 0.28129f, 0.257455f, 0.21492f,
+    0.179818f, 0.13597f, 0.108776f, 0.365706f, 0.354804f,
+    0.350136f, 0.33678f, 0.328937f, 0.307499f, 0.288596f,
+    0.269149f, 0.246523f, 0.205572f, 0.172053f, 0.130046f,
+    0.104037f, 0.359829f, 0.35032f, 0.345606f, 0.332287f,
+    0.32439f, 0.302909f, 0.284262f, 0.263921f, 0.2425f,
+    0.201079f, 0.168774f, 0.127206f, 0.101764f, 0.358972f,
+    0.349832f, 0.345109f, 0.33178f, 0.323865f, 0.302332f,
+    0.283726f, 0.263065f, 0.241956f, 0.200381f, 0.168196f,
+    0.12658f, 0.101264f, 0.358802f, 0.34977f, 0.345046f,
+    0.331714f, 0.323797f, 0.302248f, 0.283651f, 0.262985f,
+    0.241871f, 0.200224f, 0.168056f, 0.126364f, 0.101091f,
+    0.279244f, 0.11642f, 0.109708f, 0.0860486f, 0.0758848f,
+    0.089309f, 0.0744241f, 0.0841672f, 0.0858383f, 0.0715063f,
+    0.0632662f, 0.0542074f, 0.0456433f, 0.185837f, 0.097255f,
+    0.075527f, 0.0624235f, 0.0537369f, 0.0602424f, 0.050202f,
+    0.0566177f, 0.0574514f, 0.0477229f, 0.0411708f, 0.0387355f,
+    0.0309884f, 0.111759f, 0.0756184f, 0.0545127f, 0.0514943f,
+    0.040473f, 0.0477186f, 0.0484951f, 0.047738f, 0.0417708f,
+    0.040175f, 0.0368824f, 0.0276618f, 0.0221295f, 0.0652064f,
+    0.0392402f, 0.0394577f, 0.0334472f, 0.0318546f, 0.0367568f,
+    0.0390018f, 0.038633f, 0.0338039f, 0.0326804f, 0.0307498f,
+    0.0230623f, 0.0184499f, 0.027677f, 0.0143233f, 0.0200765f,
+    0.015384f, 0.0169946f, 0.018907f, 0.0219276f, 0.0215414f,
+    0.0191939f, 0.0183632f, 0.0180589f, 0.0135441f, 0.0108353f,
+    0.0102988f, 0.00567216f, 0.0129733f, 0.00864889f, 0.0088797f,
+    0.00872326f, 0.0138519f, 0.0147917f, 0.0129451f, 0.0103561f,
+    0.00965536f, 0.00724152f, 0.00579321f, 0.000287174f, 0.000195802f,
+    0.00456976f, 0.00304651f, 0.00228488f, 0.00182791f, 0.00243947f,
+    0.00880394f, 0.00770345f, 0.00616276f, 0.00513563f, 0.00385172f,
+    0.00308138f, 0.366971f, 0.152995f, 0.144173f, 0.113082f,
+    0.0997248f, 0.117366f, 0.0978052f, 0.110609f, 0.112805f,
+    0.0939706f, 0.0831418f, 0.0712372f, 0.0599826f, 0.273564f,
+    0.133388f, 0.106661f, 0.0878882f, 0.0747591f, 0.0882997f,
+    0.0735831f, 0.0830596f, 0.0844183f, 0.0701873f, 0.0606164f,
+    0.0551214f, 0.0440971f, 0.199486f, 0.111752f, 0.0847367f,
+    0.0715538f, 0.0607142f, 0.0649235f, 0.062025f, 0.0609819f,
+    0.0617847f, 0.0512965f, 0.0468301f, 0.0422596f, 0.0338077f,
+    0.120662f, 0.0753734f, 0.0571687f, 0.0535067f, 0.0432815f,
+    0.0505795f, 0.0525317f, 0.0518468f, 0.045366f, 0.0437445f,
+    0.0406975f, 0.0305231f, 0.0244185f, 0.091994f, 0.0492586f,
+    0.0377876f, 0.0354435f, 0.0284215f, 0.0327296f, 0.0351535f,
+    0.0347552f, 0.0304108f, 0.0294273f, 0.0280066f, 0.0210049f,
+    0.0168039f, 0.0882531f, 0.0405377f, 0.0346222f, 0.0272017f,
+    0.0239036f, 0.0283183f, 0.0244051f, 0.0266714f, 0.0271797f,
+    0.0226363f, 0.0199816f, 0.0172246f, 0.0144053f, 0.0877276f,
+    0.0365745f, 0.0344658f, 0.0270331f, 0.0238399f, 0.028058f,
+    0.0233817f, 0.0264425f, 0.0269674f, 0.0224648f, 0.0198759f,
+    0.0170309f, 0.0143394f, 0.454698f, 0.189569f, 0.178639f,
+    0.140115f, 0.123565f, 0.145423f, 0.121186f, 0.137051f,
+    0.139772f, 0.116435f, 0.103017f, 0.0882669f, 0.0743219f,
+    0.361291f, 0.169521f, 0.141127f, 0.114364f, 0.0957814f,
+    0.116357f, 0.0969641f, 0.109501f, 0.111385f, 0.0926516f,
+    0.0800621f, 0.0715072f, 0.0577652f, 0.287213f, 0.147885f,
+    0.114961f, 0.0949819f, 0.0817364f, 0.0929808f, 0.077484f,
+    0.0874238f, 0.0887516f, 0.0737608f, 0.0636782f, 0.0586455f,
+    0.0469164f, 0.208389f, 0.111507f, 0.0851379f, 0.0735663f,
+    0.0607545f, 0.0675596f, 0.0660615f, 0.0650606f, 0.0644655f,
+    0.0548085f, 0.0506452f, 0.0420826f, 0.0336661f, 0.179721f,
+    0.0853919f, 0.0703586f, 0.055503f, 0.0483631f, 0.0578159f,
+    0.0486834f, 0.0544304f, 0.0554157f, 0.0461354f, 0.0405376f,
+    0.0352013f, 0.0292247f, 0.17598f, 0.0766709f, 0.0690879f,
+    0.0542347f, 0.0477435f, 0.0563755f, 0.0469796f, 0.0531133f,
+    0.0541466f, 0.0451006f, 0.0398573f, 0.0342544f, 0.0287446f,
+    0.175455f, 0.0731489f, 0.0689315f, 0.0540661f, 0.0476799f,
+    0.0561153f, 0.0467627f, 0.0528844f, 0.0539343f, 0.0449291f,
+    0.0397516f, 0.0340607f, 0.0286787f, 0.542425f, 0.226143f,
+    0.213105f, 0.167148f, 0.147405f, 0.173481f, 0.144567f,
+    0.163493f, 0.166739f, 0.138899f, 0.122893f, 0.105297f,
+    0.0886612f, 0.449018f, 0.205655f, 0.175593f, 0.140839f,
+    0.119087f, 0.144414f, 0.120345f, 0.135943f, 0.138352f,
+    0.115116f, 0.0998401f, 0.0880911f, 0.0721045f, 0.37494f,
+    0.184018f, 0.146158f, 0.11945f, 0.102759f, 0.121038f,
+    0.100865f, 0.113866f, 0.115718f, 0.0962252f, 0.0831239f,
+    0.0750314f, 0.0600251f, 0.296116f, 0.14764f, 0.115473f,
+    0.0949824f, 0.0817767f, 0.0956169f, 0.0796807f, 0.0899582f,
+    0.0914323f, 0.0760555f, 0.0659497f, 0.0584684f, 0.0475909f,
+    0.267448f, 0.121525f, 0.104824f, 0.082483f, 0.072203f,
+    0.0858731f, 0.071561f, 0.0808723f, 0.0823826f, 0.0685998f,
+    0.0604133f, 0.052231f, 0.043564f, 0.263707f, 0.112804f,
+    0.103554f, 0.0812677f, 0.0715834f, 0.0844328f, 0.0703607f,
+    0.0795552f, 0.0811135f, 0.067565f, 0.059733f, 0.0512841f,
+    0.0430839f, 0.263182f, 0.109723f, 0.103397f, 0.0810991f,
+    0.0715198f, 0.0841725f, 0.0701438f, 0.0793263f, 0.0809012f,
+    0.0673935f, 0.0596273f, 0.0510904f, 0.0430179f, 0.71788f,
+    0.299292f, 0.282036f, 0.221213f, 0.195084f, 0.229595f,
+    0.191329f, 0.216377f, 0.220673f, 0.183828f, 0.162644f,
+    0.139356f, 0.11734f, 0.624472f, 0.277921f, 0.244524f,
+    0.19379f, 0.166767f, 0.200529f, 0.167107f, 0.188827f,
+    0.192286f, 0.160045f, 0.139591f, 0.122151f, 0.100783f,
+    0.550394f, 0.256285f, 0.215089f, 0.172401f, 0.145987f,
+    0.177152f, 0.147627f, 0.16675f, 0.169652f, 0.141154f,
+    0.122511f, 0.10804f, 0.0884634f, 0.47157f, 0.219906f,
+    0.184404f, 0.145804f, 0.126009f, 0.151731f, 0.126443f,
+    0.142842f, 0.145366f, 0.120984f, 0.105701f, 0.0924175f,
+    0.0762694f, 0.442902f, 0.193792f, 0.173756f, 0.136549f,
+    0.119883f, 0.141988f, 0.118323f, 0.133756f, 0.136316f,
+    0.113528f, 0.100165f, 0.0862906f, 0.0722425f, 0.439161f,
+    0.185071f, 0.172485f, 0.135334f, 0.119263f, 0.140547f,
+    0.117123f, 0.132439f, 0.135047f, 0.112494f, 0.0994843f,
+    0.0853437f, 0.0717624f, 0.438636f, 0.182872f, 0.172329f,
+    0.135165f, 0.1192f, 0.140287f, 0.116906f, 0.13221f,
+    0.134835f, 0.112322f, 0.0993786f, 0.08515f, 0.0716965f,
+    2.03379f, 0.847909f, 0.799022f, 0.626708f, 0.552683f,
+    0.650454f, 0.542045f, 0.613005f, 0.625176f, 0.520793f,
+    0.460779f, 0.394803f, 0.332429f, 1.94038f, 0.81992f,
+    0.76151f, 0.598732f, 0.524366f, 0.621387f, 0.517823f,
+    0.585456f, 0.596789f, 0.49701f, 0.437726f, 0.377597f,
+    0.315872f, 1.8663f, 0.798283f, 0.732075f, 0.576007f,
+    0.503586f, 0.598011f, 0.498343f, 0.563378f, 0.574155f,
+    0.478119f, 0.420646f, 0.363487f, 0.303553f, 1.78748f,
+    0.761905f, 0.70139f, 0.551258f, 0.483607f, 0.57259f,
+    0.477158f, 0.53947f, 0.549869f, 0.45795f, 0.403836f,
+    0.347864f, 0.291359f, 1.75881f, 0.73579f, 0.690741f,
+    0.542044f, 0.477482f, 0.562846f, 0.469038f, 0.530384f,
+    0.54082f, 0.450494f, 0.398299f, 0.341737f, 0.287332f,
+    1.75507f, 0.731545f, 0.689471f, 0.540828f, 0.476862f,
+    0.561406f, 0.467838f, 0.529067f, 0.53955f, 0.449459f,
+    0.397619f, 0.34079f, 0.286852f, 1.75454f, 0.731489f,
+    0.689314f, 0.54066f, 0.476799f, 0.561146f, 0.467621f,
+    0.528839f, 0.539338f, 0.449287f, 0.397513f, 0.340596f,
+    0.286786f, 0.133122f, 0.112115f, 0.0820136f, 0.0792151f,
+    0.0773794f, 0.0693312f, 0.0825346f, 0.070744f, 0.0761491f,
+    0.0663416f, 0.0645628f, 0.0488347f, 0.0422026f, 0.102585f,
+    0.0779903f, 0.0559848f, 0.0518592f, 0.0517967f, 0.0463433f,
+    0.0553448f, 0.0474384f, 0.0506194f, 0.0436612f, 0.0407116f,
+    0.0375326f, 0.030026f, 0.0740191f, 0.0662937f, 0.0426711f,
+    0.0358474f, 0.0424108f, 0.0428581f, 0.0416746f, 0.0444139f,
+    0.0422095f, 0.042194f, 0.0351617f, 0.0272727f, 0.0218181f,
+    0.0495868f, 0.046886f, 0.0303895f, 0.0301237f, 0.0353113f,
+    0.0358784f, 0.0340773f, 0.0362535f, 0.0351801f, 0.033976f,
+    0.0283133f, 0.021235f, 0.016988f, 0.0293028f, 0.0252801f,
+    0.0192541f, 0.0218829f, 0.0211062f, 0.0210455f, 0.0193738f,
+    0.0205408f, 0.0206841f, 0.0190702f, 0.0158918f, 0.0119189f,
+    0.00953509f, 0.0151808f, 0.0130782f, 0.0114092f, 0.0210167f,
+    0.0199171f, 0.0159337f, 0.013278f, 0.0154324f, 0.0135033f,
+    0.0130618f, 0.0108848f, 0.0081636f, 0.00653088f, 0.00127557f,
+    0.00131148f, 0.0022958f, 0.0171372f, 0.0149339f, 0.0119471f,
+    0.00995591f, 0.00935863f, 0.0081888f, 0.00727159f, 0.00605965f,
+    0.00454474f, 0.00363579f, 0.174944f, 0.147337f, 0.107779f,
+    0.104101f, 0.101689f, 0.0911123f, 0.108464f, 0.0929689f,
+    0.100072f, 0.0871834f, 0.0848459f, 0.0641766f, 0.055461f,
+    0.144406f, 0.113212f, 0.0810674f, 0.0767453f, 0.0761062f,
+    0.0681244f, 0.0812738f, 0.0696632f, 0.0745423f, 0.064503f,
+    0.0609946f, 0.0522953f, 0.0418363f, 0.115841f, 0.0920306f,
+    0.0603938f, 0.0555005f, 0.0557836f, 0.0543306f, 0.0596384f,
+    0.0566228f, 0.0545012f, 0.0540111f, 0.0450092f, 0.0420354f,
+    0.0336283f, 0.0764949f, 0.072623f, 0.0461427f, 0.0396554f,
+    0.0466974f, 0.0473509f, 0.0455178f, 0.0484624f, 0.0465786f,
+    0.045793f, 0.0381609f, 0.0286207f, 0.0228965f, 0.0523788f,
+    0.0510171f, 0.031623f, 0.0272231f, 0.0318419f, 0.032518f,
+    0.0308143f, 0.0327497f, 0.0320826f, 0.0308872f, 0.0257394f,
+    0.0193045f, 0.0154436f, 0.0450574f, 0.0388152f, 0.0261393f,
+    0.0250054f, 0.0245802f, 0.0226052f, 0.0262071f, 0.0227517f,
+    0.0241788f, 0.0216522f, 0.020371f, 0.0157928f, 0.013312f,
+    0.041879f, 0.0352224f, 0.0257698f, 0.0248862f, 0.0243118f,
+    0.021783f, 0.0259309f, 0.0222265f, 0.0239255f, 0.020843f,
+    0.0202832f, 0.015342f, 0.0132584f, 0.216765f, 0.18256f,
+    0.133544f, 0.128987f, 0.125998f, 0.112893f, 0.134393f,
+    0.115194f, 0.123995f, 0.108025f, 0.105129f, 0.0795185f,
+    0.0687193f, 0.186228f, 0.148434f, 0.10615f, 0.101631f,
+    0.100416f, 0.0899054f, 0.107203f, 0.0918881f, 0.0984653f,
+    0.0853448f, 0.0812776f, 0.0670581f, 0.0536465f, 0.157662f,
+    0.119216f, 0.0854764f, 0.0803866f, 0.080093f, 0.0716394f,
+    0.0855674f, 0.0733435f, 0.0784241f, 0.0677292f, 0.0637758f,
+    0.0567982f, 0.0454385f, 0.118316f, 0.0983599f, 0.0618958f,
+    0.058418f, 0.0583301f, 0.0588235f, 0.062308f, 0.0606713f,
+    0.0579771f, 0.0576101f, 0.0480084f, 0.0416614f, 0.0333291f,
+    0.0942003f, 0.076754f, 0.0532936f, 0.0508138f, 0.0501284f,
+    0.0448567f, 0.0534732f, 0.0458342f, 0.0492836f, 0.0427862f,
+    0.0412904f, 0.0328446f, 0.0269778f, 0.0868789f, 0.0707124f,
+    0.0519046f, 0.0498915f, 0.0488897f, 0.0437871f, 0.0521362f,
+    0.0446881f, 0.0481018f, 0.0418617f, 0.040654f, 0.0307565f,
+    0.0265703f, 0.0837006f, 0.0704445f, 0.0515352f, 0.0497724f,
+    0.0486213f, 0.043564f, 0.05186f, 0.0444514f, 0.0478484f,
+    0.0416848f, 0.0405662f, 0.0306838f, 0.0265168f, 0.258587f,
+    0.217782f, 0.15931f, 0.153873f, 0.150308f, 0.134674f,
+    0.160322f, 0.137419f, 0.147918f, 0.128867f, 0.125412f,
+    0.0948604f, 0.0819777f, 0.228049f, 0.183657f, 0.131692f,
+    0.126518f, 0.124725f, 0.111686f, 0.133132f, 0.114113f,
+    0.122388f, 0.106187f, 0.101561f, 0.0818208f, 0.0663719f,
+    0.199484f, 0.154438f, 0.110559f, 0.105273f, 0.104402f,
+    0.0934205f, 0.111496f, 0.0955684f, 0.102347f, 0.088571f,
+    0.0840588f, 0.0715609f, 0.0572487f, 0.160138f, 0.124097f,
+    0.0875702f, 0.0833041f, 0.0826395f, 0.0739109f, 0.088237f,
+    0.0756317f, 0.0811181f, 0.0702274f, 0.0670441f, 0.0564241f,
+    0.0451393f, 0.136022f, 0.107774f, 0.0790589f, 0.0756999f,
+    0.0744378f, 0.0666378f, 0.0794023f, 0.0680591f, 0.0732066f,
+    0.0636281f, 0.0615734f, 0.0476073f, 0.0402361f, 0.1287f,
+    0.105935f, 0.0776699f, 0.0747777f, 0.0731991f, 0.0655682f,
+    0.0780652f, 0.066913f, 0.0720247f, 0.0627036f, 0.0609371f,
+    0.0460984f, 0.0398287f, 0.125522f, 0.105667f, 0.0773005f,
+    0.0746585f, 0.0729308f, 0.0653451f, 0.077789f, 0.0666763f,
+    0.0717714f, 0.0625266f, 0.0608492f, 0.0460257f, 0.0397751f,
+    0.34223f, 0.288226f, 0.21084f, 0.203646f, 0.198927f,
+    0.178237f, 0.21218f, 0.181868f, 0.195764f, 0.170551f,
+    0.165978f, 0.125544f, 0.108494f, 0.311692f, 0.254101f,
+    0.183222f, 0.17629f, 0.173344f, 0.155249f, 0.18499f,
+    0.158563f, 0.170234f, 0.14787f, 0.142127f, 0.111346f,
+    0.0928886f, 0.283127f, 0.224882f, 0.161719f, 0.155045f,
+    0.153021f, 0.136983f, 0.163354f, 0.140018f, 0.150193f,
+    0.130255f, 0.124625f, 0.101086f, 0.0814408f, 0.243781f,
+    0.191417f, 0.139101f, 0.133076f, 0.131258f, 0.117473f,
+    0.140095f, 0.120081f, 0.128964f, 0.111911f, 0.10761f,
+    0.0859496f, 0.0703168f, 0.219665f, 0.178218f, 0.13059f,
+    0.125472f, 0.123057f, 0.1102f, 0.13126f, 0.112509f,
+    0.121052f, 0.105312f, 0.102139f, 0.0773274f, 0.0667528f,
+    0.212343f, 0.176379f, 0.129201f, 0.12455f, 0.121818f,
+    0.10913f, 0.129923f, 0.111363f, 0.119871f, 0.104387f,
+    0.101503f, 0.0767822f, 0.0663454f, 0.209165f, 0.176111f,
+    0.128831f, 0.124431f, 0.12155f, 0.108907f, 0.129647f,
+    0.111126f, 0.119617f, 0.10421f, 0.101415f, 0.0767095f,
+    0.0662918f, 0.969553f, 0.816557f, 0.59732f, 0.576938f,
+    0.563569f, 0.504952f, 0.601115f, 0.515242f, 0.554608f,
+    0.483178f, 0.470223f, 0.355672f, 0.307369f, 0.939015f,
+    0.782432f, 0.569702f, 0.549582f, 0.537986f, 0.481964f,
+    0.573925f, 0.491936f, 0.529078f, 0.460498f, 0.446372f,
+    0.338616f, 0.291764f, 0.91045f, 0.753214f, 0.548199f,
+    0.528337f, 0.517663f, 0.463698f, 0.55229f, 0.473391f,
+    0.509037f, 0.442882f, 0.42887f, 0.325463f, 0.280316f,
+    0.871104f, 0.719748f, 0.525581f, 0.506369f, 0.4959f,
+    0.444189f, 0.52903f, 0.453455f, 0.487808f, 0.424538f,
+    0.411855f, 0.312019f, 0.269192f, 0.846988f, 0.706549f,
+    0.51707f, 0.498764f, 0.487699f, 0.436916f, 0.520196f,
+    0.445882f, 0.479897f, 0.417939f, 0.406385f, 0.307456f,
+    0.265628f, 0.839666f, 0.70471f, 0.515681f, 0.497842f,
+    0.48646f, 0.435846f, 0.518859f, 0.444736f, 0.478715f,
+    0.417015f, 0.405748f, 0.30691f, 0.265221f, 0.836488f,
+    0.704442f, 0.515311f, 0.497723f, 0.486192f, 0.435623f,
+    0.518582f, 0.444499f, 0.478462f, 0.416838f, 0.405661f,
+    0.306838f, 0.265167f, 0.126347f, 0.0957242f, 0.0770853f,
+    0.0665232f, 0.0673307f, 0.0679574f, 0.065544f, 0.0624695f,
+    0.0691869f, 0.0682361f, 0.0624492f, 0.0480678f, 0.0384543f,
+    0.100816f, 0.0667696f, 0.0492945f, 0.0444462f, 0.0424208f,
+    0.0435184f, 0.0437513f, 0.0441075f, 0.0452067f, 0.0445787f,
+    0.0405391f, 0.0374308f, 0.0299446f, 0.0802841f, 0.0458563f,
+    0.0468357f, 0.044953f, 0.0383122f, 0.0326809f, 0.0330157f,
+    0.0321605f, 0.0324284f, 0.0350944f, 0.0319661f, 0.0281776f,
+    0.0225421f, 0.042135f, 0.0493848f, 0.0392393f, 0.0366539f,
+    0.0314491f, 0.0270253f, 0.0273574f, 0.0264098f, 0.0260927f,
+    0.0279524f, 0.0258453f, 0.019384f, 0.0155072f, 0.0308634f,
+    0.0532106f, 0.0300014f, 0.0231992f, 0.0180638f, 0.0156777f,
+    0.015978f, 0.015208f, 0.0146075f, 0.0155279f, 0.0147749f,
+    0.0110811f, 0.00908986f, 0.0254805f, 0.0508807f, 0.0275473f,
+    0.0206538f, 0.0154903f, 0.0127605f, 0.0106338f, 0.0121429f,
+    0.0112744f, 0.0107648f, 0.00897069f, 0.00672802f, 0.00718718f,
+    0.010121f, 0.0358688f, 0.0182573f, 0.0127362f, 0.00955215f,
+    0.0077141f, 0.00642842f, 0.0064442f, 0.00576051f, 0.00490019f,
+    0.00408349f, 0.00306262f, 0.00253799f, 0.16604f, 0.125797f,
+    0.101302f, 0.0874222f, 0.0884832f, 0.0893068f, 0.0861352f,
+    0.0820949f, 0.0909227f, 0.0896731f, 0.0820681f, 0.0631688f,
+    0.050535f, 0.137961f, 0.0941739f, 0.0735115f, 0.064755f,
+    0.0635734f, 0.0648679f, 0.0643425f, 0.061939f, 0.0669424f,
+    0.0660157f, 0.0598978f, 0.0515402f, 0.0412322f, 0.116437f,
+    0.0732606f, 0.0594275f, 0.057335f, 0.0488006f, 0.0465373f,
+    0.0471263f, 0.0486645f, 0.0484714f, 0.04781f, 0.0435427f,
+    0.0422871f, 0.0338297f, 0.0782876f, 0.0561995f, 0.0518311f,
+    0.0490359f, 0.0419374f, 0.0359044f, 0.0363255f, 0.0352203f,
+    0.035167f, 0.0379031f, 0.0347985f, 0.0271879f, 0.0217503f,
+    0.0494802f, 0.0600253f, 0.0359145f, 0.0332147f, 0.0285521f,
+    0.0245567f, 0.0249461f, 0.0240185f, 0.0236818f, 0.0254785f,
+    0.0237281f, 0.017796f, 0.0142368f, 0.0406353f, 0.0576954f,
+    0.0320929f, 0.0244523f, 0.0212359f, 0.0214521f, 0.0208346f,
+    0.0198398f, 0.0219102f, 0.0216141f, 0.0196988f, 0.0153107f,
+    0.0122485f, 0.039697f, 0.0426835f, 0.0242171f, 0.020899f,
+    0.0211527f, 0.0213496f, 0.0205941f, 0.0196278f, 0.0217374f,
+    0.0214387f, 0.0196191f, 0.0151026f, 0.0120821f, 0.205733f,
+    0.15587f, 0.125519f, 0.108321f, 0.109636f, 0.110656f,
+    0.106727f, 0.10172f, 0.112658f, 0.11111f, 0.101687f,
+    0.0782697f, 0.0626158f, 0.177654f, 0.123442f, 0.0977286f,
+    0.085642f, 0.0847259f, 0.0862173f, 0.0849338f, 0.0807725f,
+    0.0886781f, 0.0874526f, 0.0792566f, 0.0656496f, 0.0525197f,
+    0.152589f, 0.100665f, 0.0768354f, 0.069717f, 0.0664233f,
+    0.0678868f, 0.0677176f, 0.066496f, 0.0702071f, 0.069247f,
+    0.0629015f, 0.0563965f, 0.0451172f, 0.11444f, 0.0720927f,
+    0.0644229f, 0.0614179f, 0.0524258f, 0.049612f, 0.0493766f,
+    0.0478132f, 0.0512111f, 0.0505314f, 0.0458865f, 0.0412973f,
+    0.0330379f, 0.0856328f, 0.0668401f, 0.0492886f, 0.0455967f,
+    0.0430233f, 0.0435325f, 0.0424809f, 0.040426f, 0.0445452f,
+    0.0439487f, 0.0399155f, 0.0317158f, 0.0253726f, 0.0803283f,
+    0.0645101f, 0.0485265f, 0.0419863f, 0.0423885f, 0.0428016f,
+    0.0414258f, 0.0394651f, 0.0436459f, 0.0430511f, 0.0393178f,
+    0.0304116f, 0.0243293f, 0.07939f, 0.0601456f, 0.0484342f,
+    0.0417979f, 0.0423052f, 0.0426991f, 0.0411854f, 0.0392532f,
+    0.0434731f, 0.0428757f, 0.0392381f, 0.0302036f, 0.0241629f,
+    0.245426f, 0.185942f, 0.149737f, 0.12922f, 0.130788f,
+    0.132006f, 0.127318f, 0.121346f, 0.134394f, 0.132547f,
+    0.121306f, 0.0933707f, 0.0746965f, 0.217347f, 0.153515f,
+    0.121946f, 0.106529f, 0.105879f, 0.107567f, 0.105525f,
+    0.100398f, 0.110414f, 0.10889f, 0.0986154f, 0.0797591f,
+    0.0638072f, 0.188742f, 0.128091f, 0.101052f, 0.0889089f,
+    0.0875759f, 0.0892362f, 0.0883089f, 0.0843276f, 0.0919428f,
+    0.090684f, 0.0822603f, 0.070506f, 0.0564048f, 0.150593f,
+    0.101354f, 0.0802799f, 0.0737999f, 0.069818f, 0.0709614f,
+    0.0699679f, 0.0665033f, 0.0729468f, 0.0719684f, 0.0652453f,
+    0.0554068f, 0.0443254f, 0.124256f, 0.0917023f, 0.0735057f,
+    0.0638316f, 0.0641759f, 0.0648819f, 0.0630722f, 0.0600514f,
+    0.0662809f, 0.0653857f, 0.0595345f, 0.0464997f, 0.0371998f,
+    0.120021f, 0.090415f, 0.0727436f, 0.0628733f, 0.063541f,
+    0.064151f, 0.0620171f, 0.0590905f, 0.0653817f, 0.064488f,
+    0.0589368f, 0.0455126f, 0.0364101f, 0.119083f, 0.0902183f,
+    0.0726513f, 0.0626968f, 0.0634578f, 0.0640485f, 0.0617766f,
+    0.0588786f, 0.0652088f, 0.0643127f, 0.0588571f, 0.0453045f,
+    0.0362436f, 0.324812f, 0.246088f, 0.198171f, 0.171018f,
+    0.173093f, 0.174705f, 0.1685f, 0.160596f, 0.177866f,
+    0.175421f, 0.160544f, 0.123573f, 0.0988581f, 0.296733f,
+    0.21366f, 0.17038f, 0.148303f, 0.148184f, 0.150266f,
+    0.146708f, 0.139649f, 0.153885f, 0.151764f, 0.137409f,
+    0.109489f, 0.0875914f, 0.26711f, 0.188236f, 0.149487f,
+    0.130683f, 0.129881f, 0.131935f, 0.129491f, 0.123176f,
+    0.135414f, 0.133558f, 0.120978f, 0.0987248f, 0.0789798f,
+    0.22532f, 0.161499f, 0.128714f, 0.112273f, 0.112123f,
+    0.11366f, 0.11115f, 0.105754f, 0.116418f, 0.114842f,
+    0.104015f, 0.0836257f, 0.0669005f, 0.203642f, 0.151848f,
+    0.12194f, 0.105606f, 0.106481f, 0.107581f, 0.104255f,
+    0.0993021f, 0.109752f, 0.10826f, 0.0987724f, 0.0767016f,
+    0.0613613f, 0.199407f, 0.15056f, 0.121178f, 0.104647f,
+    0.105846f, 0.10685f, 0.1032f, 0.0983413f, 0.108853f,
+    0.107362f, 0.0981747f, 0.0757145f, 0.0605716f, 0.198469f,
+    0.150364f, 0.121085f, 0.104495f, 0.105763f, 0.106747f,
+    0.102959f, 0.0981293f, 0.10868f, 0.107187f, 0.0980951f,
+    0.0755064f, 0.0604052f, 0.920207f, 0.697177f, 0.561427f,
+    0.484501f, 0.490382f, 0.494946f, 0.477369f, 0.454977f,
+    0.503901f, 0.496976f, 0.454829f, 0.350087f, 0.28007f,
+    0.892128f, 0.66475f, 0.533636f, 0.461608f, 0.465472f,
+    0.470507f, 0.455576f, 0.434029f, 0.479921f, 0.473319f,
+    0.431694f, 0.336004f, 0.268803f, 0.862505f, 0.639326f,
+    0.512743f, 0.443988f, 0.447169f, 0.452177f, 0.43836f,
+    0.417557f, 0.46145f, 0.455113f, 0.414738f, 0.32373f,
+    0.258984f, 0.820716f, 0.612589f, 0.49197f, 0.425578f,
+    0.429411f, 0.433902f, 0.420019f, 0.400135f, 0.442454f,
+    0.436397f, 0.398299f, 0.309287f, 0.247429f, 0.799037f,
+    0.602938f, 0.485196f, 0.41891f, 0.423769f, 0.427822f,
+    0.413124f, 0.393683f, 0.435788f, 0.429815f, 0.393057f,
+    0.303216f, 0.242573f, 0.794802f, 0.60165f, 0.484434f,
+    0.418064f, 0.423134f, 0.427092f, 0.412068f, 0.392722f,
+    0.434889f, 0.428917f, 0.392459f, 0.302229f, 0.241783f,
+    0.793864f, 0.601453f, 0.484341f, 0.417978f, 0.423051f,
+    0.426989f, 0.411828f, 0.39251f, 0.434716f, 0.428742f,
+    0.39238f, 0.302021f, 0.241617f, 0.0808997f, 0.068314f,
+    0.0701443f, 0.067155f, 0.0657023f, 0.0672385f, 0.0625615f,
+    0.0614291f, 0.0678726f, 0.0647864f, 0.0628226f, 0.0471169f,
+    0.0376935f, 0.0526798f, 0.0456031f, 0.0463602f, 0.0443945f,
+    0.0430085f, 0.0424087f, 0.0392594f, 0.0416732f, 0.0443492f,
+    0.0424181f, 0.0397728f, 0.0357294f, 0.0285835f, 0.0508119f,
+    0.0312753f, 0.0291838f, 0.0367197f, 0.0356656f, 0.0369495f,
+    0.0366729f, 0.0344231f, 0.0333479f, 0.0358127f, 0.0308871f,
+    0.0266942f, 0.0213553f, 0.0419522f, 0.0208536f, 0.0195439f,
+    0.0297366f, 0.0295607f, 0.030054f, 0.0297549f, 0.0279709f,
+    0.0273491f, 0.0286039f, 0.0249432f, 0.0187074f, 0.0149659f,
+    0.0321629f, 0.0184032f, 0.0122689f, 0.0165566f, 0.017261f,
+    0.0170025f, 0.0168093f, 0.0158408f, 0.0158025f, 0.0160621f,
+    0.014308f, 0.010731f, 0.00858482f, 0.0342654f, 0.017964f,
+    0.0116338f, 0.0120906f, 0.0110724f, 0.0112644f, 0.0103739f,
+    0.00919916f, 0.00943515f, 0.0100483f, 0.00837357f, 0.00628018f,
+    0.00612345f, 0.0318412f, 0.0140703f, 0.00826344f, 0.00748286f,
+    0.00607993f, 0.006247f, 0.0056172f, 0.00486183f, 0.00471589f,
+    0.00419165f, 0.00349304f, 0.00261978f, 0.00209582f, 0.106315f,
+    0.0897755f, 0.0921808f, 0.0882524f, 0.0863433f, 0.0883622f,
+    0.0822157f, 0.0807276f, 0.0891955f, 0.0851396f, 0.0825589f,
+    0.0619192f, 0.0495353f, 0.0780952f, 0.066781f, 0.0683967f,
+    0.064189f, 0.0634405f, 0.0635323f, 0.0589137f, 0.0600614f,
+    0.065672f, 0.0627713f, 0.0595091f, 0.0492955f, 0.0394364f,
+    0.0648114f, 0.0502469f, 0.0498499f, 0.0489546f, 0.0461854f,
+    0.0471334f, 0.0468215f, 0.0461316f, 0.0475377f, 0.0459729f,
+    0.042714f, 0.0402603f, 0.0322082f, 0.0559516f, 0.0312024f,
+    0.0304119f, 0.0398648f, 0.0392267f, 0.040238f, 0.0399035f,
+    0.0374873f, 0.0365138f, 0.0387642f, 0.0336302f, 0.0257323f,
+    0.0205858f, 0.0387565f, 0.0226849f, 0.0233008f, 0.0266848f,
+    0.0269269f, 0.0271865f, 0.0269579f, 0.0253573f, 0.0249672f,
+    0.0262223f, 0.0229951f, 0.0172463f, 0.0137971f, 0.0373182f,
+    0.0216543f, 0.0222591f, 0.0211779f, 0.0207191f, 0.0212062f,
+    0.0197244f, 0.0193688f, 0.021478f, 0.0205495f, 0.0198234f,
+    0.0148675f, 0.011894f, 0.034894f, 0.0214622f, 0.0220384f,
+    0.0210975f, 0.0206411f, 0.0211237f, 0.0196544f, 0.0192986f,
+    0.0213242f, 0.0203559f, 0.0197365f, 0.0148023f, 0.0118419f,
+    0.13173f, 0.111237f, 0.114217f, 0.10935f, 0.106984f,
+    0.109486f, 0.10187f, 0.100026f, 0.110518f, 0.105493f,
+    0.102295f, 0.0767214f, 0.0613771f, 0.103511f, 0.0882425f,
+    0.0904332f, 0.0847808f, 0.0838725f, 0.0846559f, 0.078568f,
+    0.0789366f, 0.0869948f, 0.0831246f, 0.0792453f, 0.0628616f,
+    0.0502893f, 0.0820601f, 0.0702325f, 0.0718864f, 0.067497f,
+    0.0666174f, 0.0663938f, 0.0615264f, 0.0631717f, 0.0688605f,
+    0.0658957f, 0.0622256f, 0.0538264f, 0.0430611f, 0.0699511f,
+    0.0512053f, 0.0524484f, 0.049993f, 0.0488926f, 0.050422f,
+    0.050052f, 0.0470038f, 0.0502007f, 0.0489244f, 0.045576f,
+    0.0392984f, 0.0314387f, 0.0527559f, 0.0441464f, 0.0453373f,
+    0.0428961f, 0.0419793f, 0.0429693f, 0.0399434f, 0.0392285f,
+    0.0436661f, 0.0417992f, 0.0401882f, 0.0304648f, 0.0243719f,
+    0.0510157f, 0.0431158f, 0.0442956f, 0.0422753f, 0.04136f,
+    0.0423298f, 0.0393787f, 0.0386673f, 0.0428008f, 0.0409028f,
+    0.0395597f, 0.0296698f, 0.0237358f, 0.0508311f, 0.0429236f,
+    0.0440749f, 0.0421949f, 0.0412821f, 0.0422473f, 0.0393086f,
+    0.0385971f, 0.042647f, 0.0407091f, 0.0394728f, 0.0296046f,
+    0.0236837f, 0.157146f, 0.132698f, 0.136254f, 0.130447f,
+    0.127625f, 0.130609f, 0.121524f, 0.119325f, 0.131841f,
+    0.125846f, 0.122031f, 0.0915236f, 0.0732189f, 0.128926f,
+    0.109704f, 0.11247f, 0.105541f, 0.104304f, 0.10578f,
+    0.0982222f, 0.0978118f, 0.108318f, 0.103478f, 0.0989817f,
+    0.0768861f, 0.0615088f, 0.107476f, 0.091694f, 0.0939229f,
+    0.0880888f, 0.0870493f, 0.0875174f, 0.0811807f, 0.0820468f,
+    0.0901833f, 0.0862489f, 0.081962f, 0.0673924f, 0.053914f,
+    0.0854427f, 0.0726667f, 0.0744848f, 0.0697402f, 0.068942f,
+    0.0697597f, 0.064752f, 0.0644635f, 0.0715235f, 0.0684789f,
+    0.0653123f, 0.0528644f, 0.0422915f, 0.0775326f, 0.0656079f,
+    0.0673738f, 0.0639935f, 0.0626202f, 0.0640929f, 0.0595977f,
+    0.058527f, 0.064989f, 0.0621524f, 0.0599245f, 0.0451059f,
+    0.0360847f, 0.0764311f, 0.0645773f, 0.066332f, 0.0633726f,
+    0.062001f, 0.0634534f, 0.059033f, 0.0579659f, 0.0641236f,
+    0.061256f, 0.059296f, 0.044472f, 0.0355776f, 0.0762465f,
+    0.0643851f, 0.0661114f, 0.0632923f, 0.0619231f, 0.0633709f,
+    0.0589629f, 0.0578956f, 0.0639698f, 0.0610623f, 0.059209f,
+    0.0444068f, 0.0355254f, 0.207977f, 0.175621f, 0.180327f,
+    0.172642f, 0.168907f, 0.172857f, 0.160833f, 0.157922f,
+    0.174487f, 0.166553f, 0.161504f, 0.121128f, 0.0969025f,
+    0.179757f, 0.152627f, 0.156543f, 0.147735f, 0.145168f,
+    0.148027f, 0.137531f, 0.135562f, 0.150963f, 0.144184f,
+    0.138454f, 0.106168f, 0.0849346f, 0.158306f, 0.134617f,
+    0.137996f, 0.129458f, 0.127913f, 0.129765f, 0.120489f,
+    0.119797f, 0.132829f, 0.126955f, 0.121434f, 0.0945246f,
+    0.0756197f, 0.136273f, 0.11559f, 0.118558f, 0.111772f,
+    0.109806f, 0.112007f, 0.104061f, 0.102214f, 0.114169f,
+    0.109185f, 0.104785f, 0.080306f, 0.0642448f, 0.128363f,
+    0.108531f, 0.111447f, 0.106188f, 0.103902f, 0.10634f,
+    0.0989062f, 0.097124f, 0.107635f, 0.102859f, 0.0993971f,
+    0.0745478f, 0.0596383f, 0.127262f, 0.1075f, 0.110405f,
+    0.105567f, 0.103283f, 0.105701f, 0.0983415f, 0.0965629f,
+    0.106769f, 0.101962f, 0.0987686f, 0.0740764f, 0.0592611f,
+    0.127077f, 0.107308f, 0.110184f, 0.105487f, 0.103205f,
+    0.105618f, 0.0982714f, 0.0964927f, 0.106615f, 0.101769f,
+    0.0986817f, 0.0740112f, 0.059209f, 0.589207f, 0.497544f,
+    0.510874f, 0.489102f, 0.478522f, 0.489711f, 0.455647f,
+    0.447399f, 0.494329f, 0.471851f, 0.457548f, 0.343161f,
+    0.274529f, 0.560987f, 0.474549f, 0.48709f, 0.464196f,
+    0.454296f, 0.464881f, 0.432345f, 0.424563f, 0.470805f,
+    0.449483f, 0.434499f, 0.325874f, 0.260699f, 0.539537f,
+    0.456539f, 0.468543f, 0.445919f, 0.436442f, 0.446619f,
+    0.415303f, 0.407841f, 0.452671f, 0.432254f, 0.417479f,
+    0.313912f, 0.25113f, 0.517504f, 0.437512f, 0.449105f,
+    0.428233f, 0.419058f, 0.428861f, 0.398874f, 0.391689f,
+    0.434011f, 0.414484f, 0.400829f, 0.300622f, 0.240498f,
+    0.509594f, 0.430453f, 0.441994f, 0.422649f, 0.413517f,
+    0.423194f, 0.39372f, 0.386602f, 0.427477f, 0.408157f,
+    0.395442f, 0.296581f, 0.237265f, 0.508492f, 0.429422f,
+    0.440952f, 0.422028f, 0.412898f, 0.422555f, 0.393156f,
+    0.386041f, 0.426612f, 0.407261f, 0.394813f, 0.29611f,
+    0.236888f, 0.508308f, 0.42923f, 0.440731f, 0.421948f,
+    0.41282f, 0.422472f, 0.393085f, 0.38597f, 0.426458f,
+    0.407067f, 0.394726f, 0.296045f, 0.236836f, 0.0722412f,
+    0.06735f, 0.0648889f, 0.0663538f, 0.0658037f, 0.063095f,
+    0.0620069f, 0.0595935f, 0.0669669f, 0.0643962f, 0.0617317f,
+    0.0462988f, 0.037039f, 0.0452183f, 0.0487408f, 0.0410987f,
+    0.0430701f, 0.0411804f, 0.0403362f, 0.041347f, 0.0397957f,
+    0.0441379f, 0.0424056f, 0.0396285f, 0.0351072f, 0.0280857f,
+    0.036775f, 0.0388381f, 0.0369384f, 0.0374994f, 0.0364184f,
+    0.0360688f, 0.0368335f, 0.034176f, 0.0324614f, 0.0362965f,
+    0.0315921f, 0.0262969f, 0.0210375f, 0.0292866f, 0.0314855f,
+    0.0306075f, 0.0311031f, 0.030629f, 0.0300723f, 0.0306457f,
+    0.0285225f, 0.0270803f, 0.0288289f, 0.0254915f, 0.0191186f,
+    0.0152949f, 0.0259563f, 0.017336f, 0.0176076f, 0.0179581f,
+    0.0181367f, 0.0176824f, 0.0180673f, 0.0169282f, 0.0161696f,
+    0.0164672f, 0.0149995f, 0.0112496f, 0.0089997f, 0.0258792f,
+    0.0103517f, 0.0116338f, 0.0128965f, 0.0103967f, 0.0107944f,
+    0.00983194f, 0.00928502f, 0.00899049f, 0.00928951f, 0.00849068f,
+    0.00636801f, 0.00537044f, 0.020339f, 0.00813559f, 0.00710077f,
+    0.00783424f, 0.00616338f, 0.0060586f, 0.00511919f, 0.00444963f,
+    0.00410536f, 0.0037619f, 0.00313492f, 0.00235119f, 0.00188095f,
+    0.0949364f, 0.0885087f, 0.0852743f, 0.0871995f, 0.0864765f,
+    0.0829168f, 0.0814869f, 0.0783153f, 0.0880051f, 0.0846268f,
+    0.0811253f, 0.060844f, 0.0486752f, 0.0679135f, 0.068884f,
+    0.06125f, 0.0634111f, 0.0618511f, 0.0594087f, 0.060827f,
+    0.0576757f, 0.0651761f, 0.0626362f, 0.0586181f, 0.048461f,
+    0.0387688f, 0.0489381f, 0.0551069f, 0.0468833f, 0.0475959f,
+    0.0461098f, 0.0457865f, 0.0468075f, 0.0442295f, 0.0474119f,
+    0.0468361f, 0.0426882f, 0.0396507f, 0.0317206f, 0.03952f,
+    0.042123f, 0.0405525f, 0.0411996f, 0.0403204f, 0.0397899f,
+    0.0406197f, 0.0377621f, 0.0358908f, 0.0393686f, 0.0345502f,
+    0.0259126f, 0.0207301f, 0.0289279f, 0.0279735f, 0.0275525f,
+    0.0280546f, 0.0278281f, 0.0274001f, 0.0280414f, 0.0261677f,
+    0.0249801f, 0.0270068f, 0.0240582f, 0.0180436f, 0.0144349f,
+    0.0288508f, 0.0229113f, 0.0204654f, 0.0209176f, 0.0207414f,
+    0.0198927f, 0.019806f, 0.0187872f, 0.0212384f, 0.0204231f,
+    0.0194768f, 0.0146076f, 0.0116861f, 0.0233106f, 0.0211587f,
+    0.0203856f, 0.0208458f, 0.0206729f, 0.019822f, 0.0194813f,
+    0.0187219f, 0.0210409f, 0.0202327f, 0.0193937f, 0.0145453f,
+    0.0116362f, 0.117632f, 0.109667f, 0.10566f, 0.108045f,
+    0.107149f, 0.102739f, 0.100967f, 0.0970372f, 0.109043f,
+    0.104857f, 0.100519f, 0.0753891f, 0.0603113f, 0.0906087f,
+    0.0890272f, 0.0816354f, 0.083752f, 0.0825239f, 0.0792306f,
+    0.080307f, 0.0761651f, 0.0862144f, 0.0828669f, 0.0780117f,
+    0.0618148f, 0.0494519f, 0.0708941f, 0.0752501f, 0.0639824f,
+    0.0665873f, 0.0645709f, 0.0623491f, 0.0639308f, 0.0606132f,
+    0.0684501f, 0.0657927f, 0.0613482f, 0.0530046f, 0.0424037f,
+    0.0519704f, 0.0571654f, 0.0504974f, 0.051296f, 0.0500118f,
+    0.0495075f, 0.0505937f, 0.0470016f, 0.0499155f, 0.0499082f,
+    0.0448296f, 0.0388833f, 0.0311066f, 0.0460936f, 0.0465258f,
+    0.0414561f, 0.0423489f, 0.0419882f, 0.0402836f, 0.0400619f,
+    0.0380443f, 0.0432261f, 0.0415719f, 0.0394881f, 0.0299614f,
+    0.0239692f, 0.0454647f, 0.0430545f, 0.0408509f, 0.0417633f,
+    0.0414142f, 0.0397146f, 0.0391399f, 0.037509f, 0.0422766f,
+    0.0406537f, 0.0388704f, 0.0291528f, 0.0233222f, 0.0453905f,
+    0.0423173f, 0.0407711f, 0.0416914f, 0.0413458f, 0.0396438f,
+    0.0389614f, 0.0374438f, 0.0420792f, 0.0404633f, 0.0387873f,
+    0.0290905f, 0.0232724f, 0.140327f, 0.130826f, 0.126045f,
+    0.128891f, 0.127822f, 0.122561f, 0.120447f, 0.115759f,
+    0.130082f, 0.125088f, 0.119912f, 0.0899343f, 0.0719475f,
+    0.113304f, 0.10917f, 0.102021f, 0.104093f, 0.103197f,
+    0.0990525f, 0.0997871f, 0.0946545f, 0.107253f, 0.103098f,
+    0.0974053f, 0.075548f, 0.0604384f, 0.0935894f, 0.0953933f,
+    0.0843679f, 0.0869283f, 0.0852437f, 0.0818658f, 0.0834108f,
+    0.0791026f, 0.0894884f, 0.0860233f, 0.0806789f, 0.0663584f,
+    0.0530867f, 0.0746656f, 0.0773086f, 0.0672577f, 0.0687264f,
+    0.0680141f, 0.0653011f, 0.065982f, 0.0625884f, 0.0709536f,
+    0.0682312f, 0.0642231f, 0.0522371f, 0.0417897f, 0.0687888f,
+    0.0666689f, 0.0618416f, 0.0631946f, 0.062661f, 0.0601055f,
+    0.059542f, 0.0567662f, 0.0642644f, 0.0618025f, 0.0588817f,
+    0.0443309f, 0.0354648f, 0.06816f, 0.0635338f, 0.0612363f,
+    0.0626089f, 0.062087f, 0.0595364f, 0.0586199f, 0.0562308f,
+    0.0633149f, 0.0608844f, 0.058264f, 0.043698f, 0.0349584f,
+    0.0680858f, 0.063476f, 0.0611565f, 0.0625371f, 0.0620186f,
+    0.0594657f, 0.0584414f, 0.0561656f, 0.0631174f, 0.060694f,
+    0.0581809f, 0.0436357f, 0.0349085f, 0.185717f, 0.173143f,
+    0.166816f, 0.170582f, 0.169168f, 0.162204f, 0.159407f,
+    0.153203f, 0.172158f, 0.165549f, 0.1587f, 0.119025f,
+    0.0952197f, 0.158694f, 0.149457f, 0.142792f, 0.145745f,
+    0.144542f, 0.138696f, 0.138747f, 0.131633f, 0.149329f,
+    0.143559f, 0.136192f, 0.104287f, 0.0834296f, 0.13898f,
+    0.13568f, 0.125139f, 0.127652f, 0.126589f, 0.12151f,
+    0.122371f, 0.116081f, 0.131565f, 0.126485f, 0.119466f,
+    0.0930661f, 0.0744528f, 0.120056f, 0.117595f, 0.108029f,
+    0.110291f, 0.10936f, 0.104945f, 0.104942f, 0.0995672f,
+    0.11303f, 0.108692f, 0.10301f, 0.0789701f, 0.063176f,
+    0.114179f, 0.106955f, 0.102612f, 0.104886f, 0.104007f,
+    0.0997492f, 0.098502f, 0.0942099f, 0.106341f, 0.102264f,
+    0.0976688f, 0.0732516f, 0.0586013f, 0.11355f, 0.105851f,
+    0.102007f, 0.1043f, 0.103433f, 0.0991802f, 0.09758f,
+    0.0936745f, 0.105391f, 0.101346f, 0.0970511f, 0.0727884f,
+    0.0582307f, 0.113476f, 0.105793f, 0.101927f, 0.104228f,
+    0.103364f, 0.0991094f, 0.0974015f, 0.0936093f, 0.105194f,
+    0.101155f, 0.0969681f, 0.072726f, 0.0581808f, 0.526146f,
+    0.490523f, 0.472598f, 0.483267f, 0.47926f, 0.459532f,
+    0.451608f, 0.43403f, 0.487732f, 0.469009f, 0.449604f,
+    0.337203f, 0.269762f, 0.499123f, 0.465083f, 0.448574f,
+    0.45843f, 0.454635f, 0.436024f, 0.430948f, 0.411865f,
+    0.464903f, 0.447019f, 0.427096f, 0.320322f, 0.256258f,
+    0.479408f, 0.446629f, 0.430921f, 0.440337f, 0.436682f,
+    0.418838f, 0.414571f, 0.395628f, 0.447139f, 0.429944f,
+    0.41037f, 0.308244f, 0.246595f, 0.460485f, 0.429089f,
+    0.41381f, 0.422977f, 0.419452f, 0.402273f, 0.397143f,
+    0.379954f, 0.428604f, 0.412152f, 0.393914f, 0.295436f,
+    0.236348f, 0.454608f, 0.42377f, 0.408394f, 0.417571f,
+    0.414099f, 0.397077f, 0.390703f, 0.375038f, 0.421915f,
+    0.405724f, 0.388573f, 0.291429f, 0.233144f, 0.453979f,
+    0.423231f, 0.407789f, 0.416985f, 0.413525f, 0.396508f,
+    0.389781f, 0.374502f, 0.420965f, 0.404806f, 0.387955f,
+    0.290966f, 0.232773f, 0.453905f, 0.423173f, 0.407709f,
+    0.416914f, 0.413457f, 0.396438f, 0.389602f, 0.374437f,
+    0.420768f, 0.404615f, 0.387872f, 0.290904f, 0.232723f,
+    0.0783492f, 0.0693892f, 0.0649518f, 0.0641497f, 0.0651771f,
+    0.0625195f, 0.0613392f, 0.059649f, 0.0642143f, 0.0618627f,
+    0.0580778f, 0.0435583f, 0.0348467f, 0.0502672f, 0.0438955f,
+    0.0417881f, 0.0428503f, 0.0435479f, 0.0409332f, 0.0409719f,
+    0.0398166f, 0.0430513f, 0.0411823f, 0.0380042f, 0.0331543f,
+    0.0265234f, 0.034973f, 0.0361905f, 0.0385572f, 0.0370632f,
+    0.0373666f, 0.035454f, 0.0353677f, 0.0342219f, 0.0329666f,
+    0.0348272f, 0.0298647f, 0.0248548f, 0.0198838f, 0.0291229f,
+    0.0302074f, 0.0320745f, 0.0308734f, 0.0313423f, 0.0296969f,
+    0.0296047f, 0.0285535f, 0.0272678f, 0.027008f, 0.0235389f,
+    0.0176542f, 0.0141233f, 0.016691f, 0.017357f, 0.0184113f,
+    0.0178898f, 0.0185324f, 0.017668f, 0.0178111f, 0.0173029f,
+    0.0165119f, 0.0156986f, 0.0141318f, 0.0105988f, 0.00847907f,
+    0.0100407f, 0.00884765f, 0.0105157f, 0.00931553f, 0.00996571f,
+    0.0096399f, 0.00995371f, 0.00984587f, 0.009501f, 0.00907154f,
+    0.00849971f, 0.00637478f, 0.00509983f, 0.00933035f, 0.00595387f,
+    0.00883427f, 0.00661726f, 0.00593429f, 0.00557161f, 0.0051574f,
+    0.0045766f, 0.00422961f, 0.00374237f, 0.00311864f, 0.00233898f,
+    0.00187118f, 0.102963f, 0.0911885f, 0.085357f, 0.0843029f,
+    0.0856531f, 0.0821605f, 0.0806095f, 0.0783883f, 0.0843878f,
+    0.0812974f, 0.0763234f, 0.0572426f, 0.0457941f, 0.0748813f,
+    0.0656947f, 0.0614437f, 0.0630035f, 0.0640239f, 0.0601457f,
+    0.0601648f, 0.0585559f, 0.0632248f, 0.060617f, 0.055726f,
+    0.0458881f, 0.0367105f, 0.0536218f, 0.0468415f, 0.0488686f,
+    0.0470021f, 0.0473687f, 0.0450029f, 0.0449659f, 0.0436084f,
+    0.0463842f, 0.0455689f, 0.041052f, 0.0375886f, 0.0300709f,
+    0.0384479f, 0.0398311f, 0.042386f, 0.0408123f, 0.0413444f,
+    0.0392457f, 0.0392029f, 0.03794f, 0.0364547f, 0.0377497f,
+    0.0326423f, 0.0245907f, 0.0196726f, 0.026016f, 0.0269806f,
+    0.0287228f, 0.0278287f, 0.0285346f, 0.0272168f, 0.0274093f,
+    0.0266894f, 0.0256988f, 0.0264402f, 0.0232352f, 0.0174264f,
+    0.0139411f, 0.0247052f, 0.0218929f, 0.0204941f, 0.0202928f,
+    0.0206259f, 0.0197217f, 0.0195519f, 0.0192324f, 0.0204041f,
+    0.0198132f, 0.0183372f, 0.0137804f, 0.0110243f, 0.0246142f,
+    0.0217995f, 0.0204053f, 0.0201535f, 0.0204765f, 0.0196412f,
+    0.0192704f, 0.0187396f, 0.0201772f, 0.0194362f, 0.0182458f,
+    0.0136844f, 0.0109475f, 0.127577f, 0.112988f, 0.105762f,
+    0.104456f, 0.106129f, 0.101802f, 0.0998799f, 0.0971276f,
+    0.104561f, 0.100732f, 0.0945691f, 0.0709268f, 0.0567415f,
+    0.0994955f, 0.087494f, 0.0818489f, 0.0831567f, 0.0844999f,
+    0.0793582f, 0.0793577f, 0.0772952f, 0.0833983f, 0.0800518f,
+    0.0739718f, 0.058622f, 0.0468976f, 0.0782359f, 0.0686408f,
+    0.0644932f, 0.0661463f, 0.0672303f, 0.0631889f, 0.0632341f,
+    0.0614781f, 0.0665577f, 0.0637427f, 0.05868f, 0.0503225f,
+    0.040258f, 0.0570065f, 0.0502434f, 0.0526975f, 0.0507511f,
+    0.0513465f, 0.0487946f, 0.0488011f, 0.0473265f, 0.048461f,
+    0.0484913f, 0.0427295f, 0.0373246f, 0.0298597f, 0.0500882f,
+    0.0443622f, 0.0415428f, 0.0413354f, 0.0420172f, 0.0399629f,
+    0.0394477f, 0.0384257f, 0.0416101f, 0.039983f, 0.0372285f,
+    0.028929f, 0.0231432f, 0.0493193f, 0.0436921f, 0.0408993f,
+    0.0404461f, 0.0411019f, 0.0393628f, 0.0386217f, 0.0376052f,
+    0.0405776f, 0.039053f, 0.0365829f, 0.0274372f, 0.0219497f,
+    0.0492283f, 0.0435988f, 0.0408105f, 0.0403068f, 0.0409525f,
+    0.0392823f, 0.0385407f, 0.0374789f, 0.0403507f, 0.0388709f,
+    0.0364915f, 0.0273686f, 0.0218949f, 0.152192f, 0.134787f,
+    0.126167f, 0.124609f, 0.126605f, 0.121443f, 0.11915f,
+    0.115867f, 0.124735f, 0.120167f, 0.112815f, 0.0846111f,
+    0.0676888f, 0.12411f, 0.109293f, 0.102254f, 0.10331f,
+    0.104976f, 0.0985708f, 0.0985505f, 0.0960345f, 0.103572f,
+    0.0994865f, 0.0922174f, 0.0713558f, 0.0570847f, 0.10285f,
+    0.0904401f, 0.084649f, 0.0862995f, 0.0877062f, 0.0824014f,
+    0.082427f, 0.0802174f, 0.0867312f, 0.0831775f, 0.0765779f,
+    0.0630563f, 0.050445f, 0.0816207f, 0.0720427f, 0.0674818f,
+    0.0681282f, 0.0692525f, 0.0650682f, 0.0650873f, 0.0633297f,
+    0.0686345f, 0.0658478f, 0.0607948f, 0.0500584f, 0.0400467f,
+    0.0747024f, 0.0661614f, 0.0619481f, 0.0614886f, 0.0624932f,
+    0.059604f, 0.0586405f, 0.057165f, 0.0617836f, 0.0594177f,
+    0.0554742f, 0.0416703f, 0.0333362f, 0.0739334f, 0.0654914f,
+    0.0613045f, 0.0605993f, 0.0615779f, 0.0590038f, 0.057892f,
+    0.0563445f, 0.0607511f, 0.0584878f, 0.0548286f, 0.0411214f,
+    0.0328972f, 0.0738425f, 0.0653981f, 0.0612158f, 0.06046f,
+    0.0614285f, 0.0589234f, 0.057811f, 0.0562182f, 0.0605242f,
+    0.0583057f, 0.0547372f, 0.0410529f, 0.0328423f, 0.20142f,
+    0.178386f, 0.166978f, 0.164916f, 0.167557f, 0.160725f,
+    0.157691f, 0.153345f, 0.165082f, 0.159036f, 0.149306f,
+    0.11198f, 0.0895837f, 0.173338f, 0.152892f, 0.143065f,
+    0.143616f, 0.145928f, 0.137667f, 0.136936f, 0.133513f,
+    0.143919f, 0.138356f, 0.128709f, 0.0978768f, 0.0783015f,
+    0.152078f, 0.134039f, 0.125459f, 0.126606f, 0.128658f,
+    0.120826f, 0.120813f, 0.117696f, 0.127078f, 0.122047f,
+    0.113069f, 0.088524f, 0.0708192f, 0.130849f, 0.115641f,
+    0.108292f, 0.108435f, 0.110204f, 0.104164f, 0.103473f,
+    0.100808f, 0.108981f, 0.104717f, 0.0972861f, 0.0755261f,
+    0.0604209f, 0.123931f, 0.10976f, 0.102758f, 0.101795f,
+    0.103445f, 0.0988861f, 0.0970314f, 0.0946436f, 0.102131f,
+    0.0982872f, 0.0919656f, 0.0689741f, 0.0551793f, 0.123162f,
+    0.10909f, 0.102115f, 0.100906f, 0.10253f, 0.098286f,
+    0.0964326f, 0.093823f, 0.101098f, 0.0973572f, 0.09132f,
+    0.0684899f, 0.0547919f, 0.123071f, 0.108997f, 0.102026f,
+    0.100766f, 0.10238f, 0.0982055f, 0.0963516f, 0.0936968f,
+    0.100871f, 0.0971751f, 0.0912285f, 0.0684214f, 0.0547371f,
+    0.570632f, 0.505375f, 0.473056f, 0.467214f, 0.474697f,
+    0.455341f, 0.446745f, 0.434435f, 0.467684f, 0.450557f,
+    0.422991f, 0.317244f, 0.253795f, 0.54255f, 0.479881f,
+    0.449143f, 0.445915f, 0.453068f, 0.432284f, 0.424829f,
+    0.414602f, 0.446521f, 0.429877f, 0.402394f, 0.301795f,
+    0.241436f, 0.52129f, 0.461028f, 0.431537f, 0.428904f,
+    0.435798f, 0.415303f, 0.408706f, 0.398785f, 0.429681f,
+    0.413568f, 0.386754f, 0.290066f, 0.232053f, 0.500061f,
+    0.44263f, 0.41437f, 0.410733f, 0.417344f, 0.39878f,
+    0.391366f, 0.381898f, 0.411584f, 0.396238f, 0.370971f,
+    0.278228f, 0.222583f, 0.493143f, 0.436749f, 0.408836f,
+    0.404093f, 0.410585f, 0.393502f, 0.386086f, 0.375733f,
+    0.404733f, 0.389808f, 0.36565f, 0.274238f, 0.21939f,
+    0.492374f, 0.436079f, 0.408193f, 0.403204f, 0.40967f,
+    0.392902f, 0.385487f, 0.374912f, 0.403701f, 0.388878f,
+    0.365005f, 0.273754f, 0.219003f, 0.492283f, 0.435986f,
+    0.408104f, 0.403065f, 0.40952f, 0.392822f, 0.385406f,
+    0.374786f, 0.403474f, 0.388696f, 0.364913f, 0.273685f,
+    0.218948f, 0.0682786f, 0.0674875f, 0.0655102f, 0.064091f,
+    0.0632502f, 0.0620146f, 0.0596089f, 0.0583007f, 0.0588163f,
+    0.0563625f, 0.0512732f, 0.0384549f, 0.030764f, 0.0459592f,
+    0.0430939f, 0.0433583f, 0.0427851f, 0.0411972f, 0.0404132f,
+    0.0403136f, 0.0387298f, 0.0402985f, 0.0382752f, 0.0346413f,
+    0.029139f, 0.0233112f, 0.0391696f, 0.0374789f, 0.0392946f,
+    0.0389511f, 0.0386433f, 0.0363025f, 0.0350721f, 0.0337707f,
+    0.0315607f, 0.0325227f, 0.0273184f, 0.0217772f, 0.0174218f,
+    0.0315498f, 0.0300091f, 0.0316169f, 0.0314263f, 0.0312004f,
+    0.0291133f, 0.0282014f, 0.0272112f, 0.0250125f, 0.0236495f,
+    0.0200014f, 0.015001f, 0.0120008f, 0.0173211f, 0.0164054f,
+    0.0175055f, 0.0177003f, 0.0178418f, 0.0167579f, 0.0166502f,
+    0.0164303f, 0.0149115f, 0.0133951f, 0.0115092f, 0.00863188f,
+    0.00690551f, 0.0127186f, 0.00809425f, 0.008793f, 0.00916086f,
+    0.00948655f, 0.00911932f, 0.00947554f, 0.00972027f, 0.00879403f,
+    0.00834045f, 0.00696189f, 0.00522142f, 0.00417713f, 0.0114264f,
+    0.00696221f, 0.00620536f, 0.00567336f, 0.0053344f, 0.00500272f,
+    0.00451998f, 0.00415803f, 0.00378816f, 0.00322752f, 0.0026896f,
+    0.0020172f, 0.00161376f, 0.089729f, 0.0886894f, 0.0860908f,
+    0.0842259f, 0.0831209f, 0.081497f, 0.0783356f, 0.0766164f,
+    0.077294f, 0.0740693f, 0.0673812f, 0.0505359f, 0.0404287f,
+    0.0674095f, 0.0634517f, 0.0636405f, 0.0627696f, 0.0604215f,
+    0.059228f, 0.0590402f, 0.0569152f, 0.0587761f, 0.055982f,
+    0.0503335f, 0.0405181f, 0.0324145f, 0.0500012f, 0.0479294f,
+    0.0502337f, 0.0498495f, 0.0495467f, 0.0467146f, 0.0452364f,
+    0.0436558f, 0.043643f, 0.04378f, 0.0376507f, 0.0331563f,
+    0.0265251f, 0.0423813f, 0.0404596f, 0.042556f, 0.0423247f,
+    0.0421039f, 0.0395254f, 0.0383658f, 0.0370964f, 0.0344804f,
+    0.0349068f, 0.0294175f, 0.0221452f, 0.0177162f, 0.0281527f,
+    0.0268559f, 0.0284446f, 0.0285987f, 0.0287453f, 0.02717f,
+    0.0268146f, 0.0263154f, 0.0243794f, 0.0246523f, 0.0209254f,
+    0.015694f, 0.0125552f, 0.0215972f, 0.0212897f, 0.0206642f,
+    0.0202183f, 0.02039f, 0.0195633f, 0.0196399f, 0.0196054f,
+    0.0187462f, 0.0191808f, 0.0163781f, 0.0127475f, 0.010198f,
+    0.0214506f, 0.0212021f, 0.0205808f, 0.020135f, 0.0198708f,
+    0.0194826f, 0.0187274f, 0.018316f, 0.0184811f, 0.0177081f,
+    0.0161082f, 0.0120811f, 0.00966491f, 0.111179f, 0.109891f,
+    0.106671f, 0.104361f, 0.102992f, 0.100979f, 0.0970623f,
+    0.0949321f, 0.0957716f, 0.0917761f, 0.0834892f, 0.0626169f,
+    0.0500935f, 0.0888599f, 0.0846535f, 0.0839228f, 0.082754f,
+    0.0796652f, 0.0782205f, 0.077767f, 0.0752309f, 0.0772538f,
+    0.0736888f, 0.0661709f, 0.0518972f, 0.0415178f, 0.0707954f,
+    0.0664378f, 0.0668346f, 0.0659508f, 0.0634895f, 0.0622787f,
+    0.0621289f, 0.0597457f, 0.0621207f, 0.059036f, 0.0533429f,
+    0.0445354f, 0.0356283f, 0.0532129f, 0.0509102f, 0.0534951f,
+    0.053223f, 0.0530073f, 0.0499375f, 0.0485302f, 0.0469815f,
+    0.0452205f, 0.046164f, 0.0388869f, 0.0335243f, 0.0268194f,
+    0.0440161f, 0.0431178f, 0.0418631f, 0.0410497f, 0.0404325f,
+    0.0396505f, 0.038549f, 0.0375384f, 0.0383616f, 0.0365886f,
+    0.0330117f, 0.0263921f, 0.0211137f, 0.0430475f, 0.0424915f,
+    0.0412448f, 0.0403531f, 0.0398231f, 0.0390458f, 0.0376167f,
+    0.0367546f, 0.0372238f, 0.0356115f, 0.0323229f, 0.0242422f,
+    0.0193938f, 0.042901f, 0.0424039f, 0.0411615f, 0.0402698f,
+    0.0397415f, 0.0389651f, 0.037454f, 0.0366317f, 0.0369588f,
+    0.035415f, 0.0322161f, 0.0241621f, 0.0193297f, 0.13263f,
+    0.131093f, 0.127252f, 0.124495f, 0.122862f, 0.120462f,
+    0.115789f, 0.113248f, 0.114249f, 0.109483f, 0.0995971f,
+    0.0746978f, 0.0597583f, 0.11031f, 0.105855f, 0.104205f,
+    0.102738f, 0.099536f, 0.097703f, 0.0964936f, 0.0935467f,
+    0.0957315f, 0.0913956f, 0.0822788f, 0.0632763f, 0.0506211f,
+    0.0922458f, 0.087492f, 0.0871168f, 0.0859352f, 0.0827138f,
+    0.0810934f, 0.0808557f, 0.0780613f, 0.0805984f, 0.0767427f,
+    0.069035f, 0.0559145f, 0.0447316f, 0.0726982f, 0.0698607f,
+    0.0687027f, 0.0677785f, 0.0656487f, 0.0644229f, 0.0637785f,
+    0.0617437f, 0.0636981f, 0.0606203f, 0.0545791f, 0.0449034f,
+    0.0359227f, 0.0654665f, 0.0643197f, 0.0624438f, 0.0611016f,
+    0.0603031f, 0.059133f, 0.0572757f, 0.0558542f, 0.0568392f,
+    0.0542954f, 0.0491197f, 0.0377712f, 0.030217f, 0.0644979f,
+    0.0636934f, 0.0618254f, 0.0604879f, 0.0596938f, 0.0585283f,
+    0.0563434f, 0.0550703f, 0.0557015f, 0.0533182f, 0.0484309f,
+    0.0363232f, 0.0290585f, 0.0643514f, 0.0636057f, 0.0617421f,
+    0.0604046f, 0.0596121f, 0.0584475f, 0.0561807f, 0.0549474f,
+    0.0554365f, 0.0531218f, 0.0483241f, 0.0362431f, 0.0289945f,
+    0.17553f, 0.173497f, 0.168413f, 0.164765f, 0.162604f,
+    0.159427f, 0.153242f, 0.149879f, 0.151205f, 0.144896f,
+    0.131813f, 0.0988598f, 0.0790878f, 0.153211f, 0.148259f,
+    0.14477f, 0.142707f, 0.139277f, 0.136668f, 0.133947f,
+    0.130178f, 0.132687f, 0.126809f, 0.114495f, 0.0863777f,
+    0.0691022f, 0.135147f, 0.129896f, 0.127681f, 0.125904f,
+    0.122104f, 0.11984f, 0.118309f, 0.114693f, 0.117554f,
+    0.112156f, 0.100876f, 0.0786727f, 0.0629382f, 0.115599f,
+    0.112264f, 0.109267f, 0.107747f, 0.10539f, 0.103388f,
+    0.101232f, 0.0983752f, 0.100653f, 0.096034f, 0.0865189f,
+    0.0676616f, 0.0541293f, 0.108367f, 0.106723f, 0.103605f,
+    0.101371f, 0.100044f, 0.0980979f, 0.0947291f, 0.0924856f,
+    0.0937947f, 0.0897091f, 0.0813356f, 0.0610017f, 0.0488014f,
+    0.107399f, 0.106097f, 0.102987f, 0.100757f, 0.0994351f,
+    0.0974931f, 0.0937967f, 0.0917017f, 0.0926569f, 0.0887319f,
+    0.0806468f, 0.0604851f, 0.0483881f, 0.107252f, 0.106009f,
+    0.102903f, 0.100674f, 0.0993534f, 0.0974124f, 0.0936341f,
+    0.0915788f, 0.0923918f, 0.0885355f, 0.0805401f, 0.060405f,
+    0.048324f, 0.497286f, 0.491524f, 0.477123f, 0.466787f,
+    0.460663f, 0.451664f, 0.434143f, 0.424614f, 0.42837f,
+    0.410498f, 0.373432f, 0.280074f, 0.22406f, 0.474966f,
+    0.466287f, 0.452803f, 0.443054f, 0.437337f, 0.428905f,
+    0.414847f, 0.404914f, 0.409852f, 0.392411f, 0.356114f,
+    0.267086f, 0.213669f, 0.456902f, 0.447923f, 0.434997f,
+    0.425671f, 0.420164f, 0.412077f, 0.399209f, 0.389428f,
+    0.394719f, 0.377758f, 0.342495f, 0.256871f, 0.205497f,
+    0.437354f, 0.430292f, 0.417777f, 0.408772f, 0.40345f,
+    0.395624f, 0.382132f, 0.373111f, 0.377819f, 0.361636f,
+    0.328139f, 0.246104f, 0.196883f, 0.430123f, 0.424751f,
+    0.412315f, 0.403393f, 0.398104f, 0.390335f, 0.375629f,
+    0.367221f, 0.37096f, 0.355311f, 0.322955f, 0.242216f,
+    0.193773f, 0.429154f, 0.424125f, 0.411696f, 0.402779f,
+    0.397495f, 0.38973f, 0.374697f, 0.366437f, 0.369822f,
+    0.354334f, 0.322266f, 0.2417f, 0.19336f, 0.429008f,
+    0.424037f, 0.411613f, 0.402696f, 0.397413f, 0.389649f,
+    0.374534f, 0.366314f, 0.369557f, 0.354138f, 0.32216f,
+    0.241619f, 0.193296f, 0.0633068f, 0.0691326f, 0.0657866f,
+    0.0627743f, 0.0617762f, 0.0600731f, 0.0577566f, 0.0554163f,
+    0.0525095f, 0.0484629f, 0.0418842f, 0.0314132f, 0.0251305f,
+    0.0424927f, 0.0438631f, 0.0427661f, 0.0425483f, 0.0415635f,
+    0.0403814f, 0.0387484f, 0.0373783f, 0.0361928f, 0.0352173f,
+    0.0293477f, 0.0238996f, 0.0191197f, 0.0337349f, 0.0385167f,
+    0.0390844f, 0.0394981f, 0.0377754f, 0.0365911f, 0.034916f,
+    0.0327724f, 0.0310875f, 0.0304641f, 0.0253867f, 0.0190401f,
+    0.0152321f, 0.0226668f, 0.0277767f, 0.02819f, 0.0287559f,
+    0.0274849f, 0.0267906f, 0.0254154f, 0.0238319f, 0.0226009f,
+    0.0204373f, 0.0170311f, 0.0127733f, 0.0102186f, 0.0211843f,
+    0.0168266f, 0.0143505f, 0.0145929f, 0.0141589f, 0.0142189f,
+    0.0136244f, 0.0130289f, 0.0126308f, 0.0116495f, 0.00970793f,
+    0.00728095f, 0.00582477f, 0.019589f, 0.0156213f, 0.0129769f,
+    0.0114232f, 0.0101959f, 0.0097494f, 0.00935203f, 0.008763f,
+    0.00817399f, 0.00774802f, 0.00645668f, 0.00484251f, 0.00387401f,
+    0.0120008f, 0.00967808f, 0.00758356f, 0.00606425f, 0.00503251f,
+    0.00451117f, 0.00404683f, 0.00363313f, 0.00323835f, 0.00271375f,
+    0.00226145f, 0.00169609f, 0.00135687f, 0.0831953f, 0.0908513f,
+    0.0864541f, 0.0824954f, 0.0811838f, 0.0789456f, 0.0759013f,
+    0.0728259f, 0.0690059f, 0.0636881f, 0.0550425f, 0.0412819f,
+    0.0330256f, 0.059557f, 0.0651118f, 0.0627141f, 0.0622694f,
+    0.0607816f, 0.05897f, 0.0565395f, 0.0544087f, 0.0524609f,
+    0.0490077f, 0.0421094f, 0.0334196f, 0.0267357f, 0.0489438f,
+    0.050738f, 0.0515299f, 0.0520661f, 0.0499431f, 0.048486f,
+    0.0464949f, 0.0438081f, 0.0417233f, 0.0424397f, 0.0353664f,
+    0.0271015f, 0.0216812f, 0.0327004f, 0.0399979f, 0.0406354f,
+    0.0413239f, 0.0396526f, 0.0386855f, 0.0369943f, 0.0348676f,
+    0.0332367f, 0.0324129f, 0.0270107f, 0.020258f, 0.0162064f,
+    0.0240575f, 0.0259309f, 0.0264172f, 0.027161f, 0.0263267f,
+    0.0261138f, 0.0252032f, 0.0240646f, 0.0232666f, 0.0228416f,
+    0.0190347f, 0.014276f, 0.0114208f, 0.0224622f, 0.0218038f,
+    0.0207495f, 0.0198806f, 0.0194935f, 0.0194023f, 0.0189205f,
+    0.0183096f, 0.0179626f, 0.0182188f, 0.0151823f, 0.0113868f,
+    0.0091094f, 0.0198885f, 0.0217188f, 0.0206676f, 0.0197216f,
+    0.0194078f, 0.0188727f, 0.0181449f, 0.0174097f, 0.0164965f,
+    0.0152275f, 0.0131587f, 0.00986901f, 0.0078952f, 0.103084f,
+    0.11257f, 0.107122f, 0.102217f, 0.100591f, 0.0978182f,
+    0.094046f, 0.0902354f, 0.0855023f, 0.0789131f, 0.0682008f,
+    0.0511507f, 0.0409205f, 0.0789169f, 0.0868305f, 0.082662f,
+    0.0819905f, 0.0799996f, 0.0775586f, 0.0743305f, 0.071439f,
+    0.0687289f, 0.0642327f, 0.0550896f, 0.0429395f, 0.0343516f,
+    0.0641527f, 0.0680275f, 0.0658856f, 0.0654938f, 0.063973f,
+    0.0621404f, 0.0596316f, 0.0574924f, 0.0557176f, 0.0544152f,
+    0.0453461f, 0.0366215f, 0.0292972f, 0.0479093f, 0.0522191f,
+    0.0530809f, 0.053892f, 0.0518204f, 0.0505804f, 0.0485731f,
+    0.0459032f, 0.0438726f, 0.0443885f, 0.0369904f, 0.0277428f,
+    0.0221942f, 0.0403002f, 0.0441638f, 0.0420323f, 0.0405651f,
+    0.0395642f, 0.0384498f, 0.0369982f, 0.0355354f, 0.0341399f,
+    0.0348172f, 0.0290143f, 0.02193f, 0.017544f, 0.0398248f,
+    0.0435224f, 0.041417f, 0.0396017f, 0.038901f, 0.0378308f,
+    0.0363763f, 0.0349086f, 0.0330829f, 0.0307155f, 0.0264323f,
+    0.0201529f, 0.0161223f, 0.0397769f, 0.0434375f, 0.0413351f,
+    0.0394427f, 0.0388153f, 0.0377452f, 0.0362897f, 0.0348193f,
+    0.0329929f, 0.0304526f, 0.026317f, 0.0197378f, 0.0157902f,
+    0.122972f, 0.134289f, 0.127789f, 0.121938f, 0.119999f,
+    0.116691f, 0.112191f, 0.107645f, 0.101999f, 0.0941382f,
+    0.0813591f, 0.0610194f, 0.0488155f, 0.0988053f, 0.108549f,
+    0.103326f, 0.101712f, 0.0992177f, 0.0961473f, 0.0921216f,
+    0.0884693f, 0.0849969f, 0.0794579f, 0.0680698f, 0.0524595f,
+    0.0419676f, 0.0815183f, 0.0897462f, 0.0858336f, 0.0852149f,
+    0.0831912f, 0.080729f, 0.0774227f, 0.0745227f, 0.0719856f,
+    0.067187f, 0.0577843f, 0.0461415f, 0.0369132f, 0.0650505f,
+    0.0716079f, 0.0681639f, 0.0671429f, 0.0655486f, 0.0636146f,
+    0.061029f, 0.0587518f, 0.0569619f, 0.056364f, 0.04697f,
+    0.0370978f, 0.0296782f, 0.0601886f, 0.0658824f, 0.0626997f,
+    0.0602862f, 0.0589264f, 0.0573223f, 0.055143f, 0.0529449f,
+    0.050408f, 0.0470199f, 0.0403432f, 0.0314499f, 0.0251599f,
+    0.0597133f, 0.0652411f, 0.0620845f, 0.0593228f, 0.0583087f,
+    0.0567034f, 0.054521f, 0.0523181f, 0.0495793f, 0.0459407f,
+    0.0395907f, 0.029693f, 0.0237544f, 0.0596653f, 0.0651562f,
+    0.0620026f, 0.0591638f, 0.0582229f, 0.0566177f, 0.0544344f,
+    0.0522288f, 0.0494892f, 0.0456776f, 0.0394753f, 0.0296065f,
+    0.0236852f, 0.162749f, 0.177726f, 0.169124f, 0.16138f,
+    0.158814f, 0.154436f, 0.14848f, 0.142464f, 0.134991f,
+    0.124588f, 0.107676f, 0.0807569f, 0.0646055f, 0.138582f,
+    0.151986f, 0.144661f, 0.141154f, 0.137654f, 0.133325f,
+    0.127856f, 0.122938f, 0.117533f, 0.109908f, 0.0940327f,
+    0.0714995f, 0.0571995f, 0.121186f, 0.133183f, 0.126773f,
+    0.124657f, 0.121627f, 0.117906f, 0.113005f, 0.108583f,
+    0.104522f, 0.0976373f, 0.0837447f, 0.0651814f, 0.0521451f,
+    0.104827f, 0.115045f, 0.109499f, 0.106585f, 0.103985f,
+    0.100792f, 0.0966429f, 0.0928992f, 0.089498f, 0.0835129f,
+    0.0716971f, 0.0561378f, 0.0449102f, 0.0999655f, 0.10932f,
+    0.104035f, 0.0997284f, 0.0977415f, 0.0950674f, 0.0914325f,
+    0.087764f, 0.0831963f, 0.0774701f, 0.0665677f, 0.0504899f,
+    0.0403919f, 0.0994901f, 0.108678f, 0.103419f, 0.0987651f,
+    0.0971238f, 0.0944484f, 0.0908106f, 0.0871372f, 0.082572f,
+    0.0763908f, 0.0659073f, 0.0494304f, 0.0395444f, 0.0994422f,
+    0.108593f, 0.103337f, 0.098606f, 0.0970381f, 0.0943627f,
+    0.090724f, 0.0870479f, 0.0824819f, 0.0761278f, 0.065792f,
+    0.049344f, 0.0394752f, 0.461076f, 0.503506f, 0.479136f,
+    0.457197f, 0.449928f, 0.437523f, 0.420652f, 0.403607f,
+    0.382437f, 0.352965f, 0.305051f, 0.228788f, 0.18303f,
+    0.436909f, 0.477767f, 0.454673f, 0.436971f, 0.42732f,
+    0.415784f, 0.400028f, 0.384081f, 0.364197f, 0.338284f,
+    0.291408f, 0.218555f, 0.174844f, 0.419512f, 0.458963f,
+    0.436785f, 0.420474f, 0.410579f, 0.39953f, 0.384443f,
+    0.369173f, 0.35012f, 0.326014f, 0.28043f, 0.210323f,
+    0.168258f, 0.403154f, 0.440825f, 0.419511f, 0.402402f,
+    0.394168f, 0.383431f, 0.368814f, 0.354043f, 0.335648f,
+    0.311889f, 0.268495f, 0.201371f, 0.161097f, 0.398292f,
+    0.4351f, 0.414047f, 0.395545f, 0.388855f, 0.378155f,
+    0.363604f, 0.348907f, 0.330642f, 0.305846f, 0.263943f,
+    0.197957f, 0.158366f, 0.397817f, 0.434458f, 0.413432f,
+    0.394582f, 0.388237f, 0.377536f, 0.362982f, 0.34828f,
+    0.330017f, 0.304767f, 0.263282f, 0.197462f, 0.157969f,
+    0.397769f, 0.434373f, 0.413349f, 0.394423f, 0.388152f,
+    0.37745f, 0.362895f, 0.348191f, 0.329927f, 0.304504f,
+    0.263167f, 0.197375f, 0.1579f, 0.062434f, 0.067729f,
+    0.0653192f, 0.0625919f, 0.0610588f, 0.057563f, 0.0548846f,
+    0.0511414f, 0.0476293f, 0.0403081f, 0.0338795f, 0.0254394f,
+    0.0203515f, 0.0489041f, 0.0447215f, 0.0441978f, 0.042122f,
+    0.041416f, 0.0395187f, 0.0401902f, 0.0362176f, 0.0341711f,
+    0.0327623f, 0.0273814f, 0.020536f, 0.0164288f, 0.0391521f,
+    0.0374275f, 0.0355156f, 0.0357412f, 0.0348404f, 0.0335599f,
+    0.0320979f, 0.0307528f, 0.0289501f, 0.0270232f, 0.0226166f,
+    0.0169624f, 0.01357f, 0.0234041f, 0.0226052f, 0.0219466f,
+    0.02248f, 0.0217837f, 0.0210916f, 0.0201558f, 0.0196694f,
+    0.018622f, 0.0168441f, 0.0141514f, 0.0106136f, 0.00849087f,
+    0.0139133f, 0.0141189f, 0.0140232f, 0.0132584f, 0.0121074f,
+    0.0110574f, 0.0102047f, 0.0096627f, 0.00934894f, 0.00895608f,
+    0.0074634f, 0.00559755f, 0.00447804f, 0.00959516f, 0.00962265f,
+    0.00905194f, 0.00868254f, 0.00833793f, 0.00756495f, 0.00683536f,
+    0.00638926f, 0.00597854f, 0.00547769f, 0.00456474f, 0.00342355f,
+    0.00273885f, 0.00477739f, 0.00415948f, 0.00353127f, 0.00320849f,
+    0.00322328f, 0.0028047f, 0.00244911f, 0.00225727f, 0.00206815f,
+    0.00174073f, 0.00145061f, 0.00108796f, 0.000870367f, 0.0820482f,
+    0.0890068f, 0.0858399f, 0.0822557f, 0.0802409f, 0.0756469f,
+    0.0721271f, 0.067208f, 0.0625926f, 0.0529712f, 0.0445231f,
+    0.0334314f, 0.0267452f, 0.0664366f, 0.0642779f, 0.062202f,
+    0.0602463f, 0.0598013f, 0.057392f, 0.0549678f, 0.0512076f,
+    0.0475125f, 0.044531f, 0.0372069f, 0.0279051f, 0.0223241f,
+    0.0566846f, 0.052618f, 0.0512396f, 0.0498822f, 0.0487982f,
+    0.0470794f, 0.0468755f, 0.0432378f, 0.0408021f, 0.038792f,
+    0.0324421f, 0.0243316f, 0.0194653f, 0.0388664f, 0.0377957f,
+    0.0361139f, 0.036621f, 0.0357415f, 0.0346112f, 0.0332134f,
+    0.0321545f, 0.030474f, 0.0286128f, 0.0239769f, 0.0179827f,
+    0.0143862f, 0.0254297f, 0.0249871f, 0.02395f, 0.0245268f,
+    0.02394f, 0.0233538f, 0.0228621f, 0.0221264f, 0.021201f,
+    0.0201207f, 0.0168953f, 0.0126714f, 0.0101372f, 0.0207539f,
+    0.0213757f, 0.0206082f, 0.0197527f, 0.0192732f, 0.018467f,
+    0.018864f, 0.0176196f, 0.0169761f, 0.0163574f, 0.0137416f,
+    0.0103062f, 0.00824495f, 0.0196144f, 0.0212779f, 0.0205208f,
+    0.019664f, 0.0191824f, 0.0180841f, 0.0172427f, 0.0160668f,
+    0.0149634f, 0.0127962f, 0.0107206f, 0.00804047f, 0.00643237f,
+    0.101662f, 0.110284f, 0.10636f, 0.10192f, 0.0994232f,
+    0.0937308f, 0.0893696f, 0.0832745f, 0.0775557f, 0.0656343f,
+    0.0551666f, 0.0414235f, 0.0331388f, 0.0839691f, 0.0855556f,
+    0.0822755f, 0.0793761f, 0.0786889f, 0.075417f, 0.0710517f,
+    0.0671298f, 0.0622351f, 0.0562998f, 0.0470324f, 0.0352743f,
+    0.0282194f, 0.0742171f, 0.0678085f, 0.0671595f, 0.0640737f,
+    0.0631351f, 0.060599f, 0.061653f, 0.0557229f, 0.0526542f,
+    0.0505607f, 0.0422676f, 0.0317007f, 0.0253606f, 0.0563989f,
+    0.0529862f, 0.0511819f, 0.0507619f, 0.0496992f, 0.0481308f,
+    0.0479909f, 0.0446396f, 0.042326f, 0.0403815f, 0.0338024f,
+    0.0253518f, 0.0202815f, 0.0429622f, 0.0433437f, 0.0417662f,
+    0.0400524f, 0.0391034f, 0.0373079f, 0.0376396f, 0.0346114f,
+    0.033053f, 0.0318894f, 0.0267208f, 0.0200406f, 0.0160324f,
+    0.0393141f, 0.0426534f, 0.0411289f, 0.0394166f, 0.0384554f,
+    0.0362569f, 0.0345822f, 0.0322323f, 0.0300295f, 0.0281261f,
+    0.0235671f, 0.0176753f, 0.0141402f, 0.0392286f, 0.0425556f,
+    0.0410414f, 0.0393278f, 0.0383645f, 0.0361681f, 0.0344852f,
+    0.0321333f, 0.0299266f, 0.0253265f, 0.0212874f, 0.0159847f,
+    0.0127878f, 0.121277f, 0.131562f, 0.126881f, 0.121583f,
+    0.118605f, 0.111815f, 0.106612f, 0.0993409f, 0.0925189f,
+    0.0782974f, 0.0658101f, 0.0494155f, 0.0395324f, 0.101502f,
+    0.106833f, 0.102796f, 0.0987745f, 0.0975766f, 0.0934419f,
+    0.0879849f, 0.0830521f, 0.0769577f, 0.0680685f, 0.0568578f,
+    0.0426434f, 0.0341147f, 0.0917496f, 0.0884974f, 0.085195f,
+    0.0825159f, 0.0819089f, 0.0786214f, 0.0764306f, 0.0701937f,
+    0.0651551f, 0.0623295f, 0.0520931f, 0.0390698f, 0.0312558f,
+    0.0739314f, 0.0704836f, 0.0678207f, 0.0651474f, 0.0646043f,
+    0.0620112f, 0.0627684f, 0.0571246f, 0.0541781f, 0.0521503f,
+    0.0436279f, 0.0327209f, 0.0261768f, 0.0604947f, 0.0646215f,
+    0.0622869f, 0.0597163f, 0.0582856f, 0.0553328f, 0.0524851f,
+    0.0491216f, 0.0456508f, 0.0436582f, 0.0365462f, 0.0274097f,
+    0.0219278f, 0.0589284f, 0.0639312f, 0.0616495f, 0.0590804f,
+    0.0576376f, 0.0543392f, 0.0518247f, 0.0482989f, 0.0449927f,
+    0.0398949f, 0.0333926f, 0.0250444f, 0.0200355f, 0.0588429f,
+    0.0638333f, 0.061562f, 0.0589917f, 0.0575467f, 0.054252f,
+    0.0517277f, 0.0481999f, 0.0448899f, 0.0379897f, 0.0319309f,
+    0.0239767f, 0.0191814f, 0.160505f, 0.174118f, 0.167922f,
+    0.160911f, 0.15697f, 0.147983f, 0.141097f, 0.131474f,
+    0.122445f, 0.103624f, 0.0870973f, 0.0653995f, 0.0523196f,
+    0.137452f, 0.149389f, 0.143837f, 0.138102f, 0.135352f,
+    0.129492f, 0.122055f, 0.114896f, 0.106509f, 0.091606f,
+    0.0765088f, 0.0581537f, 0.046523f, 0.126815f, 0.131053f,
+    0.126115f, 0.121155f, 0.119684f, 0.114671f, 0.108032f,
+    0.102038f, 0.0946002f, 0.0858669f, 0.071744f, 0.053808f,
+    0.0430464f, 0.108996f, 0.113039f, 0.108862f, 0.104475f,
+    0.10238f, 0.0980611f, 0.0923946f, 0.0872564f, 0.0809245f,
+    0.0756877f, 0.0632789f, 0.0474592f, 0.0379673f, 0.0987644f,
+    0.107177f, 0.103328f, 0.0990439f, 0.0966499f, 0.0913827f,
+    0.0869701f, 0.0810892f, 0.0755773f, 0.0671956f, 0.0561972f,
+    0.0421479f, 0.0337183f, 0.0981568f, 0.106487f, 0.102691f,
+    0.098408f, 0.0960019f, 0.0905071f, 0.0863097f, 0.0804321f,
+    0.0749192f, 0.0634323f, 0.0533096f, 0.0401647f, 0.0321318f,
+    0.0980713f, 0.106389f, 0.102603f, 0.0983193f, 0.095911f,
+    0.0904199f, 0.0862127f, 0.080333f, 0.0748162f, 0.0633159f,
+    0.053218f, 0.0399608f, 0.0319686f, 0.454718f, 0.493283f,
+    0.475732f, 0.455868f, 0.444702f, 0.419242f, 0.399735f,
+    0.372472f, 0.346893f, 0.293571f, 0.246751f, 0.18528f,
+    0.148224f, 0.431665f, 0.468554f, 0.451647f, 0.433059f,
+    0.422754f, 0.399866f, 0.380693f, 0.355043f, 0.330957f,
+    0.28069f, 0.235744f, 0.17785f, 0.142281f, 0.414715f,
+    0.450218f, 0.433924f, 0.416112f, 0.406263f, 0.385045f,
+    0.365991f, 0.341411f, 0.318335f, 0.270691f, 0.226868f,
+    0.171675f, 0.13734f, 0.398245f, 0.432205f, 0.416672f,
+    0.399432f, 0.389827f, 0.368435f, 0.350859f, 0.327156f,
+    0.304921f, 0.258961f, 0.217194f, 0.164194f, 0.131356f,
+    0.392978f, 0.426342f, 0.411138f, 0.394001f, 0.384382f,
+    0.362396f, 0.345608f, 0.322087f, 0.300025f, 0.253984f,
+    0.213497f, 0.160634f, 0.128507f, 0.39237f, 0.425652f,
+    0.4105f, 0.393365f, 0.383735f, 0.361766f, 0.344947f,
+    0.32143f, 0.299367f, 0.253366f, 0.212963f, 0.159943f,
+    0.127954f, 0.392285f, 0.425554f, 0.410413f, 0.393277f,
+    0.383644f, 0.361679f, 0.34485f, 0.321331f, 0.299264f,
+    0.253263f, 0.212871f, 0.159841f, 0.127873f, 0.0647077f,
+    0.065352f, 0.0641799f, 0.0617923f, 0.058728f, 0.0563099f,
+    0.0523856f, 0.0487598f, 0.044828f, 0.0372126f, 0.0311294f,
+    0.0234193f, 0.0187354f, 0.047618f, 0.0433215f, 0.042176f,
+    0.042116f, 0.0408425f, 0.037997f, 0.0405072f, 0.0359109f,
+    0.0325214f, 0.0291252f, 0.024794f, 0.0185955f, 0.0148764f,
+    0.0393215f, 0.038125f, 0.0371859f, 0.0372104f, 0.0362683f,
+    0.0337858f, 0.0345082f, 0.0310663f, 0.0277823f, 0.0235368f,
+    0.0201399f, 0.0151049f, 0.0120839f, 0.0239205f, 0.0236882f,
+    0.0234625f, 0.0240213f, 0.0242441f, 0.0231361f, 0.022947f,
+    0.0215015f, 0.0195904f, 0.0161421f, 0.0134517f, 0.0100888f,
+    0.00807104f, 0.0118114f, 0.010292f, 0.00949822f, 0.0104343f,
+    0.0116556f, 0.0119748f, 0.0123884f, 0.0124973f, 0.0117942f,
+    0.00999131f, 0.00832608f, 0.00624456f, 0.00499565f, 0.0087158f,
+    0.00715993f, 0.00590803f, 0.00559053f, 0.00574324f, 0.0064809f,
+    0.00725736f, 0.00791882f, 0.00776724f, 0.00679181f, 0.00565984f,
+    0.00424489f, 0.00339591f, 0.00447213f, 0.0031142f, 0.00239564f,
+    0.00207316f, 0.00225494f, 0.00195944f, 0.00181495f, 0.00250827f,
+    0.00280488f, 0.00274736f, 0.00228946f, 0.0017171f, 0.00137368f,
+    0.0850362f, 0.085883f, 0.0843426f, 0.0812049f, 0.0771779f,
+    0.0740002f, 0.0688431f, 0.0640782f, 0.0589111f, 0.0489033f,
+    0.0409089f, 0.0307767f, 0.0246213f, 0.0642899f, 0.0638524f,
+    0.0616258f, 0.0600541f, 0.0578964f, 0.0552408f, 0.0546152f,
+    0.0489172f, 0.0449488f, 0.0398189f, 0.0338541f, 0.0253905f,
+    0.0204962f, 0.0559934f, 0.0520175f, 0.050745f, 0.0508152f,
+    0.0495117f, 0.0461892f, 0.0486163f, 0.0434264f, 0.0386998f,
+    0.0342305f, 0.0291999f, 0.0218999f, 0.0175199f, 0.0399776f,
+    0.0375807f, 0.0370216f, 0.0376261f, 0.0374875f, 0.0355396f,
+    0.0370551f, 0.0338616f, 0.0305079f, 0.0249324f, 0.0213292f,
+    0.0159969f, 0.0127975f, 0.0269025f, 0.0245674f, 0.0231062f,
+    0.0240391f, 0.024899f, 0.0243783f, 0.0264964f, 0.0248574f,
+    0.0227118f, 0.0187816f, 0.0156514f, 0.0117385f, 0.00939082f,
+    0.0217561f, 0.0207221f, 0.0202553f, 0.0195042f, 0.0189866f,
+    0.0188844f, 0.0213654f, 0.0202789f, 0.0186847f, 0.0155822f,
+    0.0129851f, 0.00973886f, 0.00779108f, 0.0203295f, 0.0205321f,
+    0.0201629f, 0.0194128f, 0.0184501f, 0.0176905f, 0.0164577f,
+    0.0153186f, 0.0140834f, 0.011691f, 0.00977982f, 0.00736263f,
+    0.00589011f, 0.105365f, 0.106414f, 0.104505f, 0.100618f,
+    0.0956279f, 0.0916905f, 0.0853004f, 0.0793965f, 0.0729943f,
+    0.060594f, 0.0506885f, 0.038134f, 0.0305072f, 0.0833969f,
+    0.0843834f, 0.0814207f, 0.0792547f, 0.0763165f, 0.0726842f,
+    0.0687233f, 0.0641498f, 0.0588835f, 0.0505127f, 0.0429141f,
+    0.0321856f, 0.0261634f, 0.0726654f, 0.0671281f, 0.0647971f,
+    0.06442f, 0.0627551f, 0.0585927f, 0.0627244f, 0.0557865f,
+    0.0501457f, 0.0449242f, 0.03826f, 0.028695f, 0.022956f,
+    0.0566495f, 0.0514732f, 0.0505807f, 0.0512309f, 0.0507309f,
+    0.047943f, 0.0511632f, 0.0462217f, 0.0414254f, 0.035582f,
+    0.0303892f, 0.0227919f, 0.0182335f, 0.0435744f, 0.0422254f,
+    0.0410768f, 0.0395721f, 0.0381424f, 0.0367818f, 0.0406045f,
+    0.0372176f, 0.0336292f, 0.0282269f, 0.0241012f, 0.0180759f,
+    0.0144607f, 0.0408331f, 0.041253f, 0.040418f, 0.0389168f,
+    0.037044f, 0.0354794f, 0.0354735f, 0.032639f, 0.0296022f,
+    0.0250928f, 0.0213834f, 0.0160375f, 0.01283f, 0.040658f,
+    0.041063f, 0.0403256f, 0.0388254f, 0.0369001f, 0.0353808f,
+    0.0329151f, 0.030637f, 0.0281666f, 0.0233816f, 0.0195594f,
+    0.01472f, 0.011776f, 0.125693f, 0.126945f, 0.124668f,
+    0.12003f, 0.114078f, 0.109381f, 0.101758f, 0.0947149f,
+    0.0870774f, 0.0722846f, 0.0604681f, 0.0454914f, 0.0363931f,
+    0.103725f, 0.104914f, 0.101353f, 0.0984553f, 0.0947365f,
+    0.0901274f, 0.0850683f, 0.0793823f, 0.0728181f, 0.0612064f,
+    0.0519741f, 0.0389806f, 0.0318306f, 0.0893373f, 0.087659f,
+    0.084592f, 0.0824094f, 0.0794285f, 0.075773f, 0.0768324f,
+    0.0681466f, 0.0621893f, 0.055618f, 0.04732f, 0.03549f,
+    0.0284787f, 0.0733214f, 0.0694618f, 0.0670173f, 0.0652424f,
+    0.0639742f, 0.0603465f, 0.0652712f, 0.0585818f, 0.0523429f,
+    0.0462758f, 0.0394493f, 0.029587f, 0.0236696f, 0.0620878f,
+    0.0627564f, 0.0612395f, 0.0589847f, 0.0564465f, 0.0538448f,
+    0.0547125f, 0.0495776f, 0.0445467f, 0.0389206f, 0.0331612f,
+    0.0248709f, 0.0198967f, 0.0611616f, 0.061784f, 0.0605807f,
+    0.0583294f, 0.0554641f, 0.0531696f, 0.0495815f, 0.0460639f,
+    0.0423599f, 0.0357866f, 0.0304434f, 0.0228326f, 0.0182824f,
+    0.0609866f, 0.061594f, 0.0604884f, 0.0582381f, 0.05535f,
+    0.053071f, 0.0493725f, 0.0459553f, 0.0422497f, 0.0350723f,
+    0.029339f, 0.0220774f, 0.0176619f, 0.16635f, 0.168007f,
+    0.164994f, 0.158855f, 0.150978f, 0.144761f, 0.134673f,
+    0.125351f, 0.115244f, 0.0956661f, 0.0800273f, 0.0602061f,
+    0.0481649f, 0.144382f, 0.145976f, 0.141678f, 0.136856f,
+    0.131577f, 0.125183f, 0.117834f, 0.109848f, 0.100687f,
+    0.0843109f, 0.0703546f, 0.0536149f, 0.043165f, 0.127242f,
+    0.128721f, 0.12431f, 0.120811f, 0.116269f, 0.11066f,
+    0.105049f, 0.0975538f, 0.0895226f, 0.0770054f, 0.0654401f,
+    0.0490801f, 0.039813f, 0.109279f, 0.110524f, 0.107168f,
+    0.103644f, 0.0996802f, 0.0948091f, 0.0934874f, 0.0834943f,
+    0.0766152f, 0.0676633f, 0.0575693f, 0.043177f, 0.0346565f,
+    0.102745f, 0.103818f, 0.101565f, 0.09781f, 0.0932865f,
+    0.0892254f, 0.0832478f, 0.0775132f, 0.0711911f, 0.0603081f,
+    0.0512813f, 0.0384609f, 0.0310035f, 0.101819f, 0.102846f,
+    0.100906f, 0.0971547f, 0.0923425f, 0.0885502f, 0.0823901f,
+    0.0767005f, 0.0705262f, 0.0585536f, 0.0489837f, 0.0370322f,
+    0.0296257f, 0.101644f, 0.102656f, 0.100814f, 0.0970634f,
+    0.0922499f, 0.0884516f, 0.0822874f, 0.0765919f, 0.070416f,
+    0.0584537f, 0.0488981f, 0.0367921f, 0.0294337f, 0.471278f,
+    0.475971f, 0.467434f, 0.450045f, 0.427727f, 0.410116f,
+    0.381534f, 0.355127f, 0.326491f, 0.271026f, 0.226721f,
+    0.170567f, 0.136453f, 0.44931f, 0.45394f, 0.444119f,
+    0.427844f, 0.407877f, 0.390538f, 0.363657f, 0.338808f,
+    0.311705f, 0.258932f, 0.216711f, 0.163975f, 0.13118f,
+    0.43217f, 0.436685f, 0.426751f, 0.411155f, 0.392569f,
+    0.375453f, 0.350243f, 0.326043f, 0.299895f, 0.24918f,
+    0.208824f, 0.158281f, 0.126625f, 0.414207f, 0.418488f,
+    0.409609f, 0.394513f, 0.37598f, 0.359952f, 0.335215f,
+    0.312179f, 0.287188f, 0.238555f, 0.199808f, 0.151385f,
+    0.121108f, 0.407673f, 0.411783f, 0.404005f, 0.388999f,
+    0.369747f, 0.35458f, 0.329928f, 0.307157f, 0.282438f,
+    0.234499f, 0.196173f, 0.148105f, 0.118484f, 0.406747f,
+    0.41081f, 0.403347f, 0.388344f, 0.369092f, 0.353905f,
+    0.329251f, 0.306476f, 0.281773f, 0.233914f, 0.195677f,
+    0.147393f, 0.117914f, 0.406572f, 0.41062f, 0.403254f,
+    0.388253f, 0.368999f, 0.353806f, 0.329149f, 0.306367f,
+    0.281663f, 0.233814f, 0.195592f, 0.147153f, 0.117722f,
+    0.223853f, 0.175395f, 0.150037f, 0.10924f, 0.087151f,
+    0.0866439f, 0.0804396f, 0.0800783f, 0.0735224f, 0.0771945f,
+    0.0745108f, 0.0737189f, 0.0589751f, 0.226172f, 0.112123f,
+    0.0975073f, 0.0875185f, 0.0749266f, 0.0856165f, 0.0865303f,
+    0.0741688f, 0.0648977f, 0.0583555f, 0.0548061f, 0.0483358f,
+    0.0386687f, 0.205569f, 0.0822274f, 0.0822218f, 0.0823858f,
+    0.0714182f, 0.0805172f, 0.0839507f, 0.0719577f, 0.062963f,
+    0.056159f, 0.0530062f, 0.0397547f, 0.0318037f, 0.134163f,
+    0.0536652f, 0.0580197f, 0.0580056f, 0.0516503f, 0.0566748f,
+    0.0643484f, 0.0551558f, 0.0482613f, 0.0422994f, 0.0404479f,
+    0.0303359f, 0.0242687f, 0.0532784f, 0.0213113f, 0.0263662f,
+    0.0261949f, 0.0243779f, 0.0256948f, 0.0357875f, 0.030675f,
+    0.0268406f, 0.0228805f, 0.0224026f, 0.0168019f, 0.0134415f,
+    0.0187421f, 0.00749682f, 0.0108487f, 0.0106691f, 0.0108277f,
+    0.0163833f, 0.0202044f, 0.017318f, 0.0151533f, 0.0125959f,
+    0.0125667f, 0.00942503f, 0.00754003f, 0.00046297f, 0.000185188f,
+    0.000521856f, 0.000483449f, 0.0035262f, 0.0088716f, 0.007393f,
+    0.00633686f, 0.00564372f, 0.00451515f, 0.00376263f, 0.00282418f,
+    0.00225934f, 0.294179f, 0.230496f, 0.197173f, 0.143559f,
+    0.11453f, 0.113864f, 0.10571f, 0.105236f, 0.0966201f,
+    0.101446f, 0.0979191f, 0.0968784f, 0.0775027f, 0.296093f,
+    0.166243f, 0.144643f, 0.11369f, 0.0970695f, 0.111258f,
+    0.111801f, 0.0958295f, 0.0838508f, 0.0755281f, 0.0708721f,
+    0.0714953f, 0.0571963f, 0.27549f, 0.119766f, 0.108317f,
+    0.108557f, 0.093561f, 0.106158f, 0.109222f, 0.0936184f,
+    0.0819162f, 0.0733317f, 0.0690722f, 0.0519989f, 0.0415991f,
+    0.204084f, 0.0816336f, 0.0841152f, 0.0841771f, 0.0737931f,
+    0.082316f, 0.0896193f, 0.0768166f, 0.0672145f, 0.0594721f,
+    0.0565138f, 0.0423854f, 0.0339083f, 0.123199f, 0.0564622f,
+    0.0524618f, 0.0523664f, 0.0465207f, 0.0513359f, 0.0610583f,
+    0.0523357f, 0.0457937f, 0.0400531f, 0.0384685f, 0.0288514f,
+    0.0230811f, 0.088663f, 0.0552153f, 0.0473084f, 0.0368406f,
+    0.0325541f, 0.0362012f, 0.0454752f, 0.0389788f, 0.0341064f,
+    0.0297686f, 0.0286327f, 0.0234179f, 0.0187344f, 0.0703839f,
+    0.0551019f, 0.0471357f, 0.0343189f, 0.0273803f, 0.0272202f,
+    0.0305288f, 0.0261676f, 0.0230978f, 0.0242515f, 0.0234083f,
+    0.023162f, 0.0185296f, 0.364504f, 0.285598f, 0.244308f,
+    0.177878f, 0.14191f, 0.141084f, 0.130981f, 0.130393f,
+    0.119718f, 0.125697f, 0.121327f, 0.120038f, 0.0960303f,
+    0.366014f, 0.220363f, 0.191778f, 0.139861f, 0.119212f,
+    0.136899f, 0.137072f, 0.11749f, 0.102804f, 0.0974128f,
+    0.0937324f, 0.0946548f, 0.0757239f, 0.345411f, 0.173886f,
+    0.151127f, 0.134729f, 0.115704f, 0.1318f, 0.134492f,
+    0.115279f, 0.100869f, 0.0905043f, 0.0851381f, 0.0751583f,
+    0.0601267f, 0.274005f, 0.126361f, 0.110211f, 0.110349f,
+    0.0959359f, 0.107957f, 0.11489f, 0.0984773f, 0.0861676f,
+    0.0766448f, 0.0725798f, 0.0550053f, 0.0440042f, 0.19312f,
+    0.111564f, 0.0959688f, 0.0785379f, 0.0686635f, 0.0769771f,
+    0.0863292f, 0.0739964f, 0.0647469f, 0.0572258f, 0.0545345f,
+    0.0476825f, 0.038146f, 0.158584f, 0.110317f, 0.0944439f,
+    0.0687925f, 0.0551308f, 0.0618424f, 0.0707461f, 0.0606395f,
+    0.0530596f, 0.0485938f, 0.0468978f, 0.0465774f, 0.0372619f,
+    0.140651f, 0.110204f, 0.0942713f, 0.0686377f, 0.0547596f,
+    0.0544402f, 0.0557997f, 0.0503149f, 0.0461956f, 0.0485028f,
+    0.0468166f, 0.0463215f, 0.0370572f, 0.43483f, 0.3407f,
+    0.291444f, 0.212196f, 0.169289f, 0.168304f, 0.156252f,
+    0.15555f, 0.142816f, 0.149949f, 0.144736f, 0.143197f,
+    0.114558f, 0.435935f, 0.274483f, 0.238914f, 0.172819f,
+    0.145337f, 0.16254f, 0.162343f, 0.139151f, 0.121757f,
+    0.121664f, 0.117141f, 0.117814f, 0.0942514f, 0.415332f,
+    0.228007f, 0.198263f, 0.1609f, 0.137847f, 0.157441f,
+    0.159763f, 0.13694f, 0.119822f, 0.107677f, 0.101204f,
+    0.0983178f, 0.0786542f, 0.343926f, 0.180482f, 0.156843f,
+    0.13652f, 0.118079f, 0.133598f, 0.140161f, 0.120138f,
+    0.105121f, 0.0938174f, 0.0886458f, 0.0781648f, 0.0625318f,
+    0.263041f, 0.166666f, 0.143104f, 0.104709f, 0.0908064f,
+    0.102618f, 0.1116f, 0.0956572f, 0.0837f, 0.0743985f,
+    0.070979f, 0.070842f, 0.0566736f, 0.228505f, 0.165419f,
+    0.14158f, 0.103111f, 0.0825101f, 0.0874835f, 0.096017f,
+    0.0823002f, 0.0720127f, 0.0728452f, 0.070306f, 0.0697369f,
+    0.0557895f, 0.210977f, 0.165306f, 0.141407f, 0.102956f,
+    0.0821389f, 0.0816602f, 0.0810706f, 0.0754723f, 0.0692933f,
+    0.0727542f, 0.0702249f, 0.069481f, 0.0555848f, 0.575481f,
+    0.450904f, 0.385715f, 0.280834f, 0.224048f, 0.222744f,
+    0.206794f, 0.205865f, 0.189011f, 0.198451f, 0.191552f,
+    0.189516f, 0.151613f, 0.575777f, 0.384049f, 0.333185f,
+    0.241457f, 0.200095f, 0.213822f, 0.212885f, 0.182472f,
+    0.162337f, 0.170167f, 0.163957f, 0.164133f, 0.131307f,
+    0.555173f, 0.336247f, 0.292534f, 0.213243f, 0.182132f,
+    0.208723f, 0.210305f, 0.180261f, 0.157729f, 0.14919f,
+    0.143655f, 0.144637f, 0.115709f, 0.483768f, 0.290223f,
+    0.251115f, 0.188863f, 0.162364f, 0.184881f, 0.190703f,
+    0.163459f, 0.143027f, 0.128654f, 0.123984f, 0.124484f,
+    0.099587f, 0.402883f, 0.27687f, 0.237376f, 0.172925f,
+    0.139253f, 0.153901f, 0.162142f, 0.138979f, 0.121606f,
+    0.122081f, 0.117796f, 0.117161f, 0.0937288f, 0.368347f,
+    0.275623f, 0.235851f, 0.171749f, 0.137269f, 0.138766f,
+    0.146559f, 0.125922f, 0.115586f, 0.121348f, 0.117123f,
+    0.116056f, 0.0928447f, 0.351628f, 0.275509f, 0.235678f,
+    0.171594f, 0.136897f, 0.1361f, 0.131612f, 0.125787f,
+    0.115489f, 0.121257f, 0.117041f, 0.1158f, 0.09264f,
+    1.63036f, 1.27743f, 1.09275f, 0.795615f, 0.634737f,
+    0.631044f, 0.585857f, 0.583225f, 0.535477f, 0.562222f,
+    0.542676f, 0.536909f, 0.429527f, 1.62459f, 1.21058f,
+    1.04022f, 0.756238f, 0.610785f, 0.598627f, 0.591947f,
+    0.554323f, 0.508803f, 0.533937f, 0.515081f, 0.511526f,
+    0.40922f, 1.60399f, 1.16223f, 0.999568f, 0.726829f,
+    0.588904f, 0.59334f, 0.589368f, 0.532763f, 0.488895f,
+    0.512961f, 0.494779f, 0.492029f, 0.393623f, 1.53258f,
+    1.11675f, 0.958148f, 0.697511f, 0.561904f, 0.569498f,
+    0.569766f, 0.511345f, 0.469217f, 0.492424f, 0.475108f,
+    0.471876f, 0.377501f, 1.4517f, 1.1034f, 0.944409f,
+    0.687706f, 0.549942f, 0.545355f, 0.541205f, 0.504177f,
+    0.462794f, 0.485851f, 0.46892f, 0.464553f, 0.371643f,
+    1.41716f, 1.10215f, 0.942885f, 0.68653f, 0.547958f,
+    0.544523f, 0.525622f, 0.503282f, 0.462052f, 0.485118f,
+    0.468246f, 0.463448f, 0.370759f, 1.40651f, 1.10204f,
+    0.942712f, 0.686375f, 0.547587f, 0.5444f, 0.510675f,
+    0.503147f, 0.461955f, 0.485027f, 0.468165f, 0.463192f,
+    0.370554f, 0.182478f, 0.111269f, 0.110226f, 0.0883212f,
+    0.0880471f, 0.08784f, 0.0876394f, 0.0781922f, 0.0731562f,
+    0.0756785f, 0.0756902f, 0.0585019f, 0.0488576f, 0.181273f,
+    0.119864f, 0.0726006f, 0.0700937f, 0.0630846f, 0.0642474f,
+    0.0609242f, 0.0544834f, 0.0495245f, 0.0488434f, 0.0477118f,
+    0.0410359f, 0.0328288f, 0.179133f, 0.117121f, 0.0699577f,
+    0.0668903f, 0.0594043f, 0.0607653f, 0.0571592f, 0.0489936f,
+    0.0474199f, 0.0469644f, 0.0399907f, 0.0299931f, 0.0283385f,
+    0.138361f, 0.0888858f, 0.0528375f, 0.0484374f, 0.0419389f,
+    0.0432682f, 0.0400601f, 0.0343372f, 0.0355007f, 0.0353362f,
+    0.0301692f, 0.0226269f, 0.0183635f, 0.0709492f, 0.0448631f,
+    0.0263925f, 0.0228395f, 0.0191128f, 0.0199681f, 0.0180773f,
+    0.0154948f, 0.0189038f, 0.0190308f, 0.0162787f, 0.012209f,
+    0.00976723f, 0.0323405f, 0.0203225f, 0.0117998f, 0.00971203f,
+    0.0114953f, 0.00919627f, 0.00766356f, 0.006591f, 0.0101563f,
+    0.0103124f, 0.00880746f, 0.00660559f, 0.00528448f, 0.0019399f,
+    0.00123361f, 0.0023027f, 0.00153513f, 0.0061076f, 0.00488608f,
+    0.00407173f, 0.0034901f, 0.00310342f, 0.00248274f, 0.00207056f,
+    0.00156291f, 0.00185586f, 0.239805f, 0.146225f, 0.144855f,
+    0.116068f, 0.115708f, 0.115436f, 0.115172f, 0.102757f,
+    0.0961388f, 0.0994536f, 0.099469f, 0.0768808f, 0.0642067f,
+    0.232837f, 0.154409f, 0.107229f, 0.0907771f, 0.0835906f,
+    0.0895829f, 0.0829226f, 0.0790482f, 0.0718929f, 0.0714015f,
+    0.0714906f, 0.0587153f, 0.0469722f, 0.230697f, 0.151666f,
+    0.0906485f, 0.0875736f, 0.0782758f, 0.0798987f, 0.0754505f,
+    0.0646719f, 0.0619769f, 0.0613568f, 0.0522073f, 0.0449914f,
+    0.0383404f, 0.189924f, 0.123431f, 0.0735284f, 0.0691208f,
+    0.0608105f, 0.0624017f, 0.0583515f, 0.0500155f, 0.0500577f,
+    0.0497286f, 0.0423857f, 0.0317893f, 0.0283655f, 0.122513f,
+    0.0794081f, 0.0470834f, 0.0435229f, 0.0379843f, 0.0391015f,
+    0.0363686f, 0.0311731f, 0.0334608f, 0.0334232f, 0.0284953f,
+    0.0213715f, 0.0177112f, 0.0839043f, 0.0548675f, 0.0348628f,
+    0.0303954f, 0.0277909f, 0.0278395f, 0.0276414f, 0.0247557f,
+    0.0247133f, 0.0247049f, 0.0238823f, 0.0184881f, 0.0154114f,
+    0.0573274f, 0.0357786f, 0.0346289f, 0.0277472f, 0.027661f,
+    0.0275961f, 0.0275329f, 0.0245651f, 0.0229828f, 0.0237752f,
+    0.023779f, 0.0183791f, 0.0153492f, 0.297133f, 0.181182f,
+    0.179483f, 0.143815f, 0.143369f, 0.143032f, 0.142705f,
+    0.127322f, 0.119122f, 0.123229f, 0.123248f, 0.0952598f,
+    0.0795557f, 0.2844f, 0.188954f, 0.141858f, 0.112837f,
+    0.111251f, 0.117179f, 0.110455f, 0.103613f, 0.0942613f,
+    0.0951766f, 0.0952694f, 0.0763947f, 0.0614655f, 0.282261f,
+    0.186211f, 0.112645f, 0.108257f, 0.0971473f, 0.0990322f,
+    0.0937419f, 0.0832309f, 0.0765339f, 0.0757493f, 0.0747433f,
+    0.0626707f, 0.0501366f, 0.241488f, 0.157976f, 0.0942192f,
+    0.0898041f, 0.079682f, 0.0815351f, 0.0766428f, 0.0656939f,
+    0.0646147f, 0.064121f, 0.0548052f, 0.0457203f, 0.0383674f,
+    0.174077f, 0.113953f, 0.0709949f, 0.0642063f, 0.0568558f,
+    0.0582349f, 0.0560157f, 0.050608f, 0.0480178f, 0.0483159f,
+    0.0484052f, 0.0377524f, 0.0312275f, 0.135468f, 0.0894126f,
+    0.0694913f, 0.0556565f, 0.0554517f, 0.0554353f, 0.0551742f,
+    0.0493206f, 0.0460608f, 0.0476329f, 0.047661f, 0.036867f,
+    0.0307605f, 0.114655f, 0.0703236f, 0.0692574f, 0.0554941f,
+    0.0553218f, 0.0551918f, 0.0550656f, 0.0491299f, 0.0459655f,
+    0.0475503f, 0.0475577f, 0.036758f, 0.0306982f, 0.35446f,
+    0.216138f, 0.214112f, 0.171562f, 0.17103f, 0.170627f,
+    0.170238f, 0.151887f, 0.142104f, 0.147004f, 0.147027f,
+    0.113639f, 0.0949048f, 0.335964f, 0.223499f, 0.176486f,
+    0.140584f, 0.138912f, 0.144774f, 0.137988f, 0.128178f,
+    0.11663f, 0.118952f, 0.119048f, 0.0940741f, 0.0768146f,
+    0.333825f, 0.220756f, 0.147273f, 0.12894f, 0.116019f,
+    0.122093f, 0.114188f, 0.107796f, 0.0980444f, 0.0983301f,
+    0.0985221f, 0.0803501f, 0.0642801f, 0.293052f, 0.192521f,
+    0.116703f, 0.110488f, 0.0985535f, 0.100669f, 0.0949342f,
+    0.0844019f, 0.0791717f, 0.0785134f, 0.0785839f, 0.0633997f,
+    0.0507198f, 0.225641f, 0.148498f, 0.105623f, 0.0848897f,
+    0.0840366f, 0.0846078f, 0.0835485f, 0.0751728f, 0.0698176f,
+    0.072091f, 0.0721839f, 0.0559742f, 0.0465766f, 0.187032f,
+    0.123958f, 0.10412f, 0.0834034f, 0.0831125f, 0.083031f,
+    0.0827069f, 0.0738854f, 0.0690435f, 0.071408f, 0.0714398f,
+    0.055246f, 0.0461095f, 0.171982f, 0.104869f, 0.103886f,
+    0.083241f, 0.0829827f, 0.0827876f, 0.0825984f, 0.0736947f,
+    0.0689482f, 0.0713254f, 0.0713365f, 0.0551369f, 0.0460473f,
+    0.469114f, 0.28605f, 0.283369f, 0.227056f, 0.226351f,
+    0.225819f, 0.225303f, 0.201016f, 0.18807f, 0.194554f,
+    0.194584f, 0.150397f, 0.125603f, 0.439092f, 0.292589f,
+    0.245743f, 0.196078f, 0.194234f, 0.199966f, 0.193054f,
+    0.177307f, 0.162445f, 0.166502f, 0.166606f, 0.130116f,
+    0.107513f, 0.436952f, 0.289846f, 0.21653f, 0.172478f,
+    0.170454f, 0.177285f, 0.169254f, 0.156925f, 0.142781f,
+    0.14588f, 0.14608f, 0.115709f, 0.0942457f, 0.396179f,
+    0.261611f, 0.18596f, 0.151854f, 0.147051f, 0.150653f,
+    0.146044f, 0.133532f, 0.122525f, 0.125917f, 0.126142f,
+    0.0987585f, 0.081378f, 0.328768f, 0.217588f, 0.17488f,
+    0.139983f, 0.139358f, 0.139799f, 0.138614f, 0.124302f,
+    0.115783f, 0.119641f, 0.119742f, 0.092732f, 0.0772747f,
+    0.290159f, 0.193048f, 0.173377f, 0.138897f, 0.138434f,
+    0.138223f, 0.137772f, 0.123015f, 0.115009f, 0.118958f,
+    0.118997f, 0.0920038f, 0.0768077f, 0.286636f, 0.174781f,
+    0.173143f, 0.138735f, 0.138304f, 0.137979f, 0.137664f,
+    0.122824f, 0.114914f, 0.118876f, 0.118894f, 0.0918948f,
+    0.0767454f, 1.32902f, 0.810394f, 0.802797f, 0.64326f,
+    0.641263f, 0.639755f, 0.638294f, 0.569488f, 0.53281f,
+    0.551181f, 0.551266f, 0.42608f, 0.355839f, 1.26013f,
+    0.810764f, 0.765171f, 0.612282f, 0.609146f, 0.613902f,
+    0.606045f, 0.54578f, 0.507185f, 0.523128f, 0.523287f,
+    0.4058f, 0.337749f, 1.21055f, 0.808021f, 0.735958f,
+    0.588681f, 0.585366f, 0.591221f, 0.582245f, 0.525397f,
+    0.487412f, 0.502507f, 0.502761f, 0.390169f, 0.324482f,
+    1.16964f, 0.779786f, 0.705389f, 0.564586f, 0.561964f,
+    0.56459f, 0.559035f, 0.502004f, 0.467265f, 0.482543f,
+    0.482823f, 0.374061f, 0.311614f, 1.14844f, 0.735763f,
+    0.694308f, 0.556187f, 0.554271f, 0.553736f, 0.551605f,
+    0.492775f, 0.460523f, 0.476268f, 0.476423f, 0.368416f,
+    0.307511f, 1.14676f, 0.711223f, 0.692805f, 0.555101f,
+    0.553347f, 0.552159f, 0.550764f, 0.491487f, 0.459749f,
+    0.475585f, 0.475679f, 0.367688f, 0.307044f, 1.14654f,
+    0.699125f, 0.692571f, 0.554939f, 0.553217f, 0.551915f,
+    0.550655f, 0.491296f, 0.459654f, 0.475502f, 0.475576f,
+    0.367579f, 0.306981f, 0.114977f, 0.0775207f, 0.0777688f,
+    0.081208f, 0.0860509f, 0.0824588f, 0.0827028f, 0.0781657f,
+    0.0728731f, 0.0786808f, 0.0730664f, 0.0559637f, 0.044771f,
+    0.107231f, 0.0739367f, 0.0812098f, 0.0666886f, 0.0567275f,
+    0.0545378f, 0.0541147f, 0.0508208f, 0.0474227f, 0.0508551f,
+    0.0459065f, 0.0407677f, 0.0326141f, 0.0928566f, 0.0724414f,
+    0.0781027f, 0.0643008f, 0.0547627f, 0.0494657f, 0.0436456f,
+    0.0420992f, 0.043934f, 0.0451097f, 0.0406153f, 0.0304614f,
+    0.0255366f, 0.0549731f, 0.055545f, 0.0579258f, 0.0478892f,
+    0.041445f, 0.0379817f, 0.0332853f, 0.0319005f, 0.0341437f,
+    0.0332644f, 0.0301036f, 0.0225777f, 0.0180621f, 0.0188335f,
+    0.0289196f, 0.0290011f, 0.0240429f, 0.0217436f, 0.0206453f,
+    0.0178793f, 0.0169021f, 0.0192036f, 0.0174361f, 0.0157951f,
+    0.0118464f, 0.00947709f, 0.00763771f, 0.0142081f, 0.0135122f,
+    0.0111708f, 0.0109045f, 0.0108947f, 0.00932333f, 0.00866126f,
+    0.0106905f, 0.00919587f, 0.00826321f, 0.00619741f, 0.00656764f,
+    0.000371897f, 0.006581f, 0.0032905f, 0.00324166f, 0.00255618f,
+    0.00219352f, 0.00195449f, 0.00183453f, 0.00223931f, 0.00243113f,
+    0.00202594f, 0.00177169f, 0.00251385f, 0.151098f, 0.101875f,
+    0.102201f, 0.10672f, 0.113085f, 0.108364f, 0.108685f,
+    0.102722f, 0.0957669f, 0.103399f, 0.0960209f, 0.0735452f,
+    0.0588362f, 0.142018f, 0.0952143f, 0.105046f, 0.0862092f,
+    0.0837612f, 0.080443f, 0.0800965f, 0.0753773f, 0.0703165f,
+    0.0755734f, 0.0687134f, 0.0583492f, 0.0466793f, 0.127643f,
+    0.093719f, 0.101939f, 0.0838213f, 0.0712415f, 0.0642287f,
+    0.0581953f, 0.0547867f, 0.0569763f, 0.059249f, 0.0532528f,
+    0.0444589f, 0.0355671f, 0.08976f, 0.0768226f, 0.0817621f,
+    0.0674097f, 0.0579238f, 0.0527447f, 0.0463823f, 0.0445879f,
+    0.047186f, 0.0474036f, 0.0427411f, 0.0320558f, 0.0256447f,
+    0.0536204f, 0.0501972f, 0.0528374f, 0.0435634f, 0.0382224f,
+    0.0354082f, 0.0309763f, 0.0295895f, 0.0322459f, 0.0315753f,
+    0.0284327f, 0.0213245f, 0.0170596f, 0.0404947f, 0.0351091f,
+    0.0373485f, 0.0306914f, 0.0273846f, 0.0262183f, 0.0262516f,
+    0.0247932f, 0.0237328f, 0.0249272f, 0.0230401f, 0.0179376f,
+    0.0143501f, 0.0361282f, 0.0243538f, 0.0249832f, 0.0255123f,
+    0.0270375f, 0.0259083f, 0.0259844f, 0.0245587f, 0.0228957f,
+    0.02472f, 0.0229546f, 0.0175856f, 0.0140685f, 0.187219f,
+    0.126228f, 0.126632f, 0.132233f, 0.140118f, 0.134269f,
+    0.134667f, 0.127279f, 0.118661f, 0.128117f, 0.118975f,
+    0.0911268f, 0.0729014f, 0.176805f, 0.116492f, 0.128882f,
+    0.10573f, 0.110795f, 0.106348f, 0.106078f, 0.0999338f,
+    0.0932103f, 0.100292f, 0.0916679f, 0.0759307f, 0.0607446f,
+    0.16243f, 0.114997f, 0.125775f, 0.103342f, 0.0882042f,
+    0.0846981f, 0.0841772f, 0.0791602f, 0.0738405f, 0.0792896f,
+    0.0717793f, 0.0620404f, 0.0496323f, 0.124547f, 0.0981003f,
+    0.105598f, 0.0869303f, 0.0744025f, 0.0675077f, 0.0615975f,
+    0.0579648f, 0.0602283f, 0.0615428f, 0.0553786f, 0.044799f,
+    0.0358392f, 0.0884073f, 0.0714749f, 0.0766736f, 0.063084f,
+    0.0558246f, 0.0534542f, 0.0534406f, 0.050437f, 0.0470103f,
+    0.0506714f, 0.046661f, 0.0369489f, 0.0295592f, 0.0752816f,
+    0.0563867f, 0.0611848f, 0.0510889f, 0.0544183f, 0.0521235f,
+    0.0522334f, 0.0493497f, 0.0460023f, 0.0496455f, 0.0459946f,
+    0.0355191f, 0.0284153f, 0.0722492f, 0.0487077f, 0.0488641f,
+    0.0510246f, 0.0540712f, 0.0518135f, 0.0519663f, 0.0491152f,
+    0.0457895f, 0.0494383f, 0.0459091f, 0.0351672f, 0.0281337f,
+    0.22334f, 0.150582f, 0.151064f, 0.157745f, 0.167152f,
+    0.160174f, 0.160648f, 0.151835f, 0.141554f, 0.152836f,
+    0.14193f, 0.108708f, 0.0869666f, 0.211592f, 0.13777f,
+    0.152719f, 0.128085f, 0.137829f, 0.132253f, 0.13206f,
+    0.12449f, 0.116104f, 0.12501f, 0.114622f, 0.0935122f,
+    0.0748098f, 0.197217f, 0.136274f, 0.149612f, 0.122862f,
+    0.115238f, 0.110603f, 0.110159f, 0.103717f, 0.0967343f,
+    0.104008f, 0.0947338f, 0.0796219f, 0.0636976f, 0.159334f,
+    0.119378f, 0.129435f, 0.106451f, 0.0916656f, 0.08787f,
+    0.0875794f, 0.0825213f, 0.0769368f, 0.0827811f, 0.0756174f,
+    0.0623805f, 0.0499044f, 0.123194f, 0.0927525f, 0.10051f,
+    0.0826045f, 0.0828583f, 0.0793594f, 0.0794225f, 0.0749935f,
+    0.0699041f, 0.0753897f, 0.0696154f, 0.0545305f, 0.0436244f,
+    0.110068f, 0.0776644f, 0.085021f, 0.0766011f, 0.081452f,
+    0.0780287f, 0.0782153f, 0.0739062f, 0.0688961f, 0.0743638f,
+    0.0689491f, 0.0531006f, 0.0424805f, 0.10837f, 0.0730615f,
+    0.0732959f, 0.0765368f, 0.0811049f, 0.0777187f, 0.0779482f,
+    0.0736717f, 0.0686833f, 0.0741566f, 0.0688636f, 0.0527487f,
+    0.0421989f, 0.295582f, 0.19929f, 0.199928f, 0.208769f,
+    0.221219f, 0.211985f, 0.212612f, 0.200948f, 0.187342f,
+    0.202272f, 0.187839f, 0.143871f, 0.115097f, 0.281165f,
+    0.180325f, 0.200391f, 0.178986f, 0.191896f, 0.184064f,
+    0.184024f, 0.173603f, 0.161892f, 0.174446f, 0.160531f,
+    0.128675f, 0.10294f, 0.266791f, 0.17883f, 0.197284f,
+    0.161904f, 0.169305f, 0.162414f, 0.162123f, 0.15283f,
+    0.142522f, 0.153445f, 0.140643f, 0.114785f, 0.091828f,
+    0.228907f, 0.161933f, 0.177107f, 0.145492f, 0.145733f,
+    0.13968f, 0.139543f, 0.131634f, 0.122724f, 0.132218f,
+    0.121526f, 0.0975435f, 0.0780348f, 0.192768f, 0.135308f,
+    0.148182f, 0.128298f, 0.136926f, 0.13117f, 0.131386f,
+    0.124106f, 0.115692f, 0.124826f, 0.115524f, 0.0896935f,
+    0.0717548f, 0.18207f, 0.121806f, 0.132694f, 0.127626f,
+    0.135519f, 0.129839f, 0.130179f, 0.123019f, 0.114684f,
+    0.1238f, 0.114858f, 0.0882637f, 0.0706109f, 0.180612f,
+    0.121769f, 0.122159f, 0.127561f, 0.135172f, 0.129529f,
+    0.129912f, 0.122785f, 0.114471f, 0.123593f, 0.114773f,
+    0.0879117f, 0.0703294f, 0.837398f, 0.564597f, 0.566404f,
+    0.591453f, 0.626725f, 0.600563f, 0.60234f, 0.569295f,
+    0.530749f, 0.573047f, 0.532156f, 0.407594f, 0.326075f,
+    0.817942f, 0.533854f, 0.557935f, 0.560738f, 0.597401f,
+    0.572642f, 0.573752f, 0.541951f, 0.505298f, 0.545221f,
+    0.504849f, 0.392398f, 0.313919f, 0.793583f, 0.51233f,
+    0.554828f, 0.538908f, 0.574811f, 0.550992f, 0.55185f,
+    0.521177f, 0.485928f, 0.524219f, 0.48496f, 0.378508f,
+    0.302806f, 0.753881f, 0.492899f, 0.534651f, 0.517264f,
+    0.551238f, 0.528259f, 0.529271f, 0.499981f, 0.466131f,
+    0.502992f, 0.465844f, 0.361266f, 0.289013f, 0.72954f,
+    0.487564f, 0.505726f, 0.510912f, 0.542431f, 0.519748f,
+    0.521114f, 0.492454f, 0.459098f, 0.495601f, 0.459842f,
+    0.353416f, 0.282733f, 0.723886f, 0.487113f, 0.490238f,
+    0.51031f, 0.541025f, 0.518417f, 0.519907f, 0.491367f,
+    0.45809f, 0.494575f, 0.459176f, 0.351986f, 0.281589f,
+    0.722429f, 0.487077f, 0.488636f, 0.510245f, 0.540678f,
+    0.518107f, 0.51964f, 0.491132f, 0.457877f, 0.494368f,
+    0.45909f, 0.351635f, 0.281308f, 0.109282f, 0.0967372f,
+    0.084892f, 0.0812659f, 0.0813615f, 0.0779591f, 0.0723041f,
+    0.0720265f, 0.0702795f, 0.0754001f, 0.0711545f, 0.0536908f,
+    0.0429527f, 0.0689373f, 0.0637827f, 0.0531958f, 0.0511445f,
+    0.0523871f, 0.050495f, 0.0470822f, 0.0469884f, 0.0452102f,
+    0.0486553f, 0.0454433f, 0.0388043f, 0.0310434f, 0.0408159f,
+    0.0383294f, 0.0409735f, 0.0478214f, 0.0460236f, 0.0399332f,
+    0.0412662f, 0.0429109f, 0.0425886f, 0.0439048f, 0.0386518f,
+    0.0289888f, 0.0231911f, 0.0351212f, 0.0224453f, 0.0294009f,
+    0.0347149f, 0.0335994f, 0.0290726f, 0.0304036f, 0.0319354f,
+    0.0313589f, 0.0315569f, 0.0281701f, 0.0211276f, 0.0169021f,
+    0.0300392f, 0.0120157f, 0.0136767f, 0.0165483f, 0.016256f,
+    0.0139806f, 0.0150999f, 0.0163139f, 0.0157807f, 0.0155573f,
+    0.0142193f, 0.0106645f, 0.00853157f, 0.0226106f, 0.00904425f,
+    0.00860374f, 0.00829629f, 0.00724611f, 0.00618184f, 0.00707131f,
+    0.00798274f, 0.00761069f, 0.00832791f, 0.0070494f, 0.00528705f,
+    0.00668807f, 0.00775837f, 0.00310335f, 0.00239122f, 0.00278012f,
+    0.00258065f, 0.00206452f, 0.00241813f, 0.00296029f, 0.00266639f,
+    0.00278118f, 0.00231765f, 0.00173824f, 0.00247048f, 0.143614f,
+    0.127128f, 0.111562f, 0.106796f, 0.106922f, 0.102451f,
+    0.0950191f, 0.0946543f, 0.0923584f, 0.0990878f, 0.0935084f,
+    0.0705583f, 0.0564467f, 0.103269f, 0.0941736f, 0.0798654f,
+    0.0763377f, 0.0779475f, 0.0749866f, 0.0697972f, 0.0696162f,
+    0.0668418f, 0.0723429f, 0.0673743f, 0.0555756f, 0.0444604f,
+    0.0734767f, 0.0687203f, 0.056766f, 0.0626039f, 0.0602083f,
+    0.0541204f, 0.0539217f, 0.0560174f, 0.055747f, 0.0578866f,
+    0.0508155f, 0.0422973f, 0.0338379f, 0.0445146f, 0.0421154f,
+    0.0421655f, 0.0494974f, 0.047784f, 0.0414015f, 0.0430591f,
+    0.0450419f, 0.0445173f, 0.0455387f, 0.0403339f, 0.0302504f,
+    0.0242003f, 0.0365488f, 0.0322389f, 0.0275453f, 0.0313308f,
+    0.0304407f, 0.0263095f, 0.0277554f, 0.0294204f, 0.0289391f,
+    0.029539f, 0.026383f, 0.0197873f, 0.0158298f, 0.0344406f,
+    0.0307264f, 0.0267689f, 0.0256203f, 0.0257192f, 0.0246561f,
+    0.0228854f, 0.0228325f, 0.022208f, 0.023894f, 0.0224429f,
+    0.0171063f, 0.013685f, 0.034332f, 0.0303935f, 0.0266698f,
+    0.0255305f, 0.0255612f, 0.0244923f, 0.0227158f, 0.0226295f,
+    0.0220794f, 0.0236895f, 0.022354f, 0.016868f, 0.0134944f,
+    0.177946f, 0.157519f, 0.138231f, 0.132327f, 0.132482f,
+    0.126942f, 0.117734f, 0.117282f, 0.114437f, 0.122775f,
+    0.115862f, 0.0874258f, 0.0699406f, 0.137601f, 0.124565f,
+    0.106535f, 0.101868f, 0.103508f, 0.0994781f, 0.0925122f,
+    0.092244f, 0.0886361f, 0.0960306f, 0.089513f, 0.0723469f,
+    0.0578775f, 0.107809f, 0.0991112f, 0.0834356f, 0.079775f,
+    0.0816439f, 0.0786119f, 0.0732376f, 0.0731048f, 0.0700059f,
+    0.0759022f, 0.0707962f, 0.0590686f, 0.0472549f, 0.0788466f,
+    0.0725063f, 0.0612066f, 0.0642798f, 0.0619687f, 0.0574319f,
+    0.0557146f, 0.0581484f, 0.0576757f, 0.0595205f, 0.0524976f,
+    0.0426494f, 0.0341195f, 0.0697417f, 0.0626298f, 0.0542149f,
+    0.0518745f, 0.0522282f, 0.0501095f, 0.0465463f, 0.0464559f,
+    0.0450553f, 0.0485666f, 0.0454736f, 0.0352187f, 0.028175f,
+    0.0687726f, 0.0611173f, 0.0534385f, 0.0511508f, 0.0512796f,
+    0.0491477f, 0.0456004f, 0.0454603f, 0.044287f, 0.0475816f,
+    0.0447968f, 0.0338776f, 0.0271021f, 0.068664f, 0.0607844f,
+    0.0533394f, 0.051061f, 0.0511217f, 0.0489838f, 0.0454308f,
+    0.0452572f, 0.0441584f, 0.0473771f, 0.0447078f, 0.0337355f,
+    0.0269884f, 0.212278f, 0.18791f, 0.164901f, 0.157857f,
+    0.158043f, 0.151434f, 0.140449f, 0.13991f, 0.136516f,
+    0.146463f, 0.138216f, 0.104293f, 0.0834346f, 0.171933f,
+    0.154955f, 0.133205f, 0.127399f, 0.129068f, 0.12397f,
+    0.115227f, 0.114872f, 0.110715f, 0.119718f, 0.111867f,
+    0.0891182f, 0.0712945f, 0.142141f, 0.129502f, 0.110105f,
+    0.105256f, 0.107204f, 0.103104f, 0.0959526f, 0.0957326f,
+    0.0917616f, 0.0995898f, 0.0927271f, 0.0758399f, 0.0606719f,
+    0.113179f, 0.102897f, 0.0878762f, 0.0840283f, 0.0852356f,
+    0.0819234f, 0.0762133f, 0.0760849f, 0.0732344f, 0.0793044f,
+    0.0738126f, 0.0594207f, 0.0475365f, 0.104074f, 0.0930207f,
+    0.0808845f, 0.0774049f, 0.0777887f, 0.0746011f, 0.0692613f,
+    0.0690837f, 0.0671343f, 0.0722543f, 0.0678274f, 0.05199f,
+    0.041592f, 0.103105f, 0.0915082f, 0.0801082f, 0.0766812f,
+    0.0768401f, 0.0736392f, 0.0683154f, 0.0680881f, 0.0663659f,
+    0.0712692f, 0.0671506f, 0.050717f, 0.0405736f, 0.102996f,
+    0.0911753f, 0.080009f, 0.0765914f, 0.0766822f, 0.0734754f,
+    0.0681458f, 0.067885f, 0.0662373f, 0.0710647f, 0.0670617f,
+    0.050603f, 0.0404824f, 0.280942f, 0.248692f, 0.21824f,
+    0.208918f, 0.209164f, 0.200417f, 0.185879f, 0.185165f,
+    0.180674f, 0.193838f, 0.182924f, 0.138028f, 0.110423f,
+    0.240597f, 0.215737f, 0.186544f, 0.178459f, 0.180189f,
+    0.172953f, 0.160657f, 0.160127f, 0.154873f, 0.167094f,
+    0.156575f, 0.122661f, 0.0981286f, 0.210805f, 0.190284f,
+    0.163445f, 0.156317f, 0.158325f, 0.152087f, 0.141383f,
+    0.140988f, 0.135919f, 0.146965f, 0.137248f, 0.109382f,
+    0.087506f, 0.181843f, 0.163679f, 0.141215f, 0.135089f,
+    0.136357f, 0.130907f, 0.121643f, 0.121341f, 0.117392f,
+    0.12668f, 0.118506f, 0.0929632f, 0.0743706f, 0.172738f,
+    0.153802f, 0.134224f, 0.128466f, 0.12891f, 0.123584f,
+    0.114691f, 0.114339f, 0.111292f, 0.11963f, 0.112535f,
+    0.0855326f, 0.0684261f, 0.171769f, 0.15229f, 0.133447f,
+    0.127742f, 0.127961f, 0.122622f, 0.113745f, 0.113344f,
+    0.110524f, 0.118645f, 0.111858f, 0.084452f, 0.0675616f,
+    0.17166f, 0.151957f, 0.133348f, 0.127652f, 0.127803f,
+    0.122459f, 0.113576f, 0.113141f, 0.110395f, 0.11844f,
+    0.111769f, 0.0843379f, 0.0674703f, 0.795922f, 0.704555f,
+    0.618285f, 0.591874f, 0.592571f, 0.56779f, 0.526604f,
+    0.524582f, 0.511858f, 0.549153f, 0.518232f, 0.39104f,
+    0.312832f, 0.755577f, 0.671601f, 0.586588f, 0.561416f,
+    0.563596f, 0.540326f, 0.501382f, 0.499544f, 0.486057f,
+    0.522408f, 0.491882f, 0.37423f, 0.299384f, 0.725784f,
+    0.646147f, 0.563489f, 0.539273f, 0.541732f, 0.51946f,
+    0.482108f, 0.480405f, 0.467104f, 0.50228f, 0.472556f,
+    0.360952f, 0.288762f, 0.696822f, 0.619542f, 0.54126f,
+    0.518045f, 0.519764f, 0.49828f, 0.462368f, 0.460757f,
+    0.448577f, 0.481994f, 0.453814f, 0.344533f, 0.275626f,
+    0.687718f, 0.609666f, 0.534268f, 0.511422f, 0.512317f,
+    0.490958f, 0.455416f, 0.453756f, 0.442476f, 0.474944f,
+    0.447843f, 0.338133f, 0.270506f, 0.686748f, 0.608154f,
+    0.533492f, 0.510698f, 0.511368f, 0.489996f, 0.45447f,
+    0.452761f, 0.441708f, 0.473959f, 0.447166f, 0.337464f,
+    0.269971f, 0.68664f, 0.607821f, 0.533393f, 0.510608f,
+    0.51121f, 0.489832f, 0.454301f, 0.452558f, 0.44158f,
+    0.473755f, 0.447077f, 0.33735f, 0.26988f, 0.0992704f,
+    0.077729f, 0.0807686f, 0.074976f, 0.0736511f, 0.0734509f,
+    0.0728221f, 0.0698833f, 0.0707455f, 0.0735021f, 0.0704002f,
+    0.0528001f, 0.0422401f, 0.0637424f, 0.0561769f, 0.0507525f,
+    0.0474755f, 0.0474947f, 0.0478124f, 0.0473928f, 0.0464804f,
+    0.0451052f, 0.0478809f, 0.0447217f, 0.0386112f, 0.030889f,
+    0.0483516f, 0.0542035f, 0.0437803f, 0.0437669f, 0.0437556f,
+    0.0461785f, 0.0434653f, 0.0427276f, 0.0414746f, 0.044902f,
+    0.0403341f, 0.0302506f, 0.0242005f, 0.035445f, 0.0400788f,
+    0.0322272f, 0.0320712f, 0.0323276f, 0.03446f, 0.0321831f,
+    0.0318467f, 0.0309787f, 0.0322435f, 0.0298031f, 0.0223523f,
+    0.0178819f, 0.0170808f, 0.019496f, 0.0156018f, 0.0154506f,
+    0.0158434f, 0.0173243f, 0.0160084f, 0.0161197f, 0.0158429f,
+    0.0160473f, 0.0156293f, 0.011722f, 0.0093776f, 0.0142566f,
+    0.0138023f, 0.0107148f, 0.00951468f, 0.00713601f, 0.00808909f,
+    0.00795249f, 0.00823343f, 0.00766379f, 0.0091438f, 0.00805008f,
+    0.00603757f, 0.00588689f, 0.0102603f, 0.00814733f, 0.00582061f,
+    0.00608413f, 0.0045631f, 0.00493009f, 0.00466606f, 0.00445702f,
+    0.00409469f, 0.00383851f, 0.00319876f, 0.00239907f, 0.00199064f,
+    0.130457f, 0.102148f, 0.106143f, 0.0985305f, 0.0967893f,
+    0.0965261f, 0.0956999f, 0.0918378f, 0.0929709f, 0.0965935f,
+    0.0925171f, 0.0693878f, 0.0555102f, 0.0949292f, 0.0742115f,
+    0.0757312f, 0.070629f, 0.0704394f, 0.070866f, 0.0702706f,
+    0.0681484f, 0.0673305f, 0.0705608f, 0.0666275f, 0.0551151f,
+    0.0440921f, 0.068444f, 0.0705888f, 0.0570836f, 0.0571367f,
+    0.057047f, 0.0601425f, 0.0567232f, 0.0557246f, 0.0541087f,
+    0.0594052f, 0.0530674f, 0.0422856f, 0.0338284f, 0.0502138f,
+    0.056464f, 0.0455305f, 0.0454409f, 0.045619f, 0.0484239f,
+    0.045441f, 0.0448437f, 0.0436128f, 0.0467467f, 0.0425364f,
+    0.0319023f, 0.0255218f, 0.0326489f, 0.0358813f, 0.0289051f,
+    0.0288204f, 0.0291348f, 0.0312883f, 0.0292663f, 0.0291166f,
+    0.028477f, 0.0305505f, 0.0283626f, 0.0212719f, 0.0170175f,
+    0.0313987f, 0.0249756f, 0.0254578f, 0.0236425f, 0.0232224f,
+    0.0232313f, 0.0230308f, 0.0220268f, 0.0223733f, 0.0232626f,
+    0.0222061f, 0.0169138f, 0.013531f, 0.0311872f, 0.0244194f,
+    0.0253743f, 0.0235546f, 0.0231383f, 0.0230759f, 0.0228784f,
+    0.0219546f, 0.0222262f, 0.0230925f, 0.022117f, 0.0165878f,
+    0.0132702f, 0.161644f, 0.126568f, 0.131517f, 0.122085f,
+    0.119928f, 0.119601f, 0.118578f, 0.113792f, 0.115196f,
+    0.119685f, 0.114634f, 0.0859755f, 0.0687804f, 0.126116f,
+    0.0986307f, 0.101105f, 0.0941835f, 0.0933842f, 0.0939412f,
+    0.0931483f, 0.0898164f, 0.0895559f, 0.0936522f, 0.0887444f,
+    0.0716191f, 0.0572953f, 0.0996307f, 0.086974f, 0.0790548f,
+    0.0737996f, 0.0738332f, 0.0743017f, 0.0736802f, 0.0715982f,
+    0.0705313f, 0.0739794f, 0.0696319f, 0.0587895f, 0.0470316f,
+    0.0730632f, 0.0728493f, 0.0588338f, 0.0588107f, 0.0589104f,
+    0.0623878f, 0.058699f, 0.0578406f, 0.056247f, 0.0612499f,
+    0.0552696f, 0.0425844f, 0.0340675f, 0.0638357f, 0.0522665f,
+    0.0515257f, 0.047887f, 0.0470269f, 0.0472263f, 0.0468208f,
+    0.0445843f, 0.0454172f, 0.0472693f, 0.0450018f, 0.0349119f,
+    0.0279295f, 0.0625854f, 0.0489512f, 0.050832f, 0.047197f,
+    0.0463606f, 0.0463066f, 0.0459086f, 0.0439813f, 0.0445987f,
+    0.046354f, 0.044323f, 0.0334178f, 0.0267342f, 0.0623739f,
+    0.0488387f, 0.0507485f, 0.047109f, 0.0462765f, 0.0461512f,
+    0.0457561f, 0.0439091f, 0.0444515f, 0.0461839f, 0.0442339f,
+    0.0331754f, 0.0265403f, 0.192831f, 0.150987f, 0.156891f,
+    0.145639f, 0.143066f, 0.142677f, 0.141455f, 0.135747f,
+    0.137422f, 0.142776f, 0.136751f, 0.102563f, 0.0820505f,
+    0.157303f, 0.12305f, 0.12648f, 0.117738f, 0.116329f,
+    0.117017f, 0.116026f, 0.111484f, 0.111781f, 0.116744f,
+    0.110861f, 0.0881231f, 0.0704985f, 0.130817f, 0.103359f,
+    0.104429f, 0.0973397f, 0.096778f, 0.097377f, 0.0965579f,
+    0.0932662f, 0.0927567f, 0.0970708f, 0.0917488f, 0.0752935f,
+    0.0602347f, 0.10425f, 0.0892346f, 0.0833913f, 0.0776513f,
+    0.0767959f, 0.0772948f, 0.0766403f, 0.0735207f, 0.0739457f,
+    0.0772075f, 0.0730969f, 0.0590884f, 0.0472707f, 0.0950224f,
+    0.074199f, 0.0768999f, 0.0714414f, 0.0701651f, 0.0703016f,
+    0.0696985f, 0.0665388f, 0.0676426f, 0.0703607f, 0.0671187f,
+    0.0514158f, 0.0411327f, 0.0937722f, 0.0733705f, 0.0762062f,
+    0.0707514f, 0.0694988f, 0.0693818f, 0.0687863f, 0.0659358f,
+    0.066824f, 0.0694454f, 0.0664399f, 0.0499217f, 0.0399374f,
+    0.0935607f, 0.073258f, 0.0761227f, 0.0706634f, 0.0694147f,
+    0.0692265f, 0.0686339f, 0.0658636f, 0.0666769f, 0.0692753f,
+    0.0663508f, 0.0497631f, 0.0398105f, 0.255204f, 0.199825f,
+    0.20764f, 0.192748f, 0.189342f, 0.188827f, 0.187211f,
+    0.179656f, 0.181872f, 0.188959f, 0.180985f, 0.135738f,
+    0.108591f, 0.219676f, 0.171889f, 0.177228f, 0.164847f,
+    0.162218f, 0.163167f, 0.161782f, 0.15482f, 0.156232f,
+    0.162926f, 0.155095f, 0.121131f, 0.0969047f, 0.193191f,
+    0.150913f, 0.155177f, 0.144449f, 0.142667f, 0.143527f,
+    0.142313f, 0.136602f, 0.137207f, 0.143254f, 0.135983f,
+    0.108301f, 0.0866411f, 0.166623f, 0.12999f, 0.13414f,
+    0.12476f, 0.122685f, 0.123445f, 0.122396f, 0.116857f,
+    0.118396f, 0.12339f, 0.117331f, 0.0920963f, 0.073677f,
+    0.157396f, 0.123038f, 0.127648f, 0.11855f, 0.116441f,
+    0.116452f, 0.115454f, 0.110448f, 0.112093f, 0.116543f,
+    0.111353f, 0.0844237f, 0.067539f, 0.156146f, 0.122209f,
+    0.126955f, 0.11786f, 0.115775f, 0.115532f, 0.114542f,
+    0.109845f, 0.111275f, 0.115628f, 0.110674f, 0.0830456f,
+    0.0664365f, 0.155934f, 0.122097f, 0.126871f, 0.117772f,
+    0.115691f, 0.115377f, 0.114389f, 0.109773f, 0.111128f,
+    0.115458f, 0.110585f, 0.0829384f, 0.0663508f, 0.723005f,
+    0.566114f, 0.588252f, 0.546064f, 0.536415f, 0.534956f,
+    0.530377f, 0.508973f, 0.515253f, 0.53533f, 0.512738f,
+    0.384553f, 0.307643f, 0.687477f, 0.538178f, 0.557841f,
+    0.518163f, 0.509033f, 0.509296f, 0.504948f, 0.482714f,
+    0.489612f, 0.509297f, 0.486848f, 0.36869f, 0.294952f,
+    0.660992f, 0.517202f, 0.53579f, 0.497765f, 0.488967f,
+    0.489656f, 0.48548f, 0.463638f, 0.470588f, 0.489624f,
+    0.467736f, 0.355861f, 0.284688f, 0.634424f, 0.496279f,
+    0.514753f, 0.478077f, 0.469594f, 0.469574f, 0.465562f,
+    0.445404f, 0.451777f, 0.469761f, 0.449084f, 0.339655f,
+    0.271724f, 0.625197f, 0.489327f, 0.508261f, 0.471867f,
+    0.463514f, 0.462581f, 0.45862f, 0.439765f, 0.445473f,
+    0.462914f, 0.443106f, 0.332517f, 0.266014f, 0.623946f,
+    0.488498f, 0.507567f, 0.471177f, 0.462848f, 0.461661f,
+    0.457708f, 0.439162f, 0.444655f, 0.461999f, 0.442427f,
+    0.331849f, 0.265479f, 0.623735f, 0.488386f, 0.507484f,
+    0.471089f, 0.462764f, 0.461506f, 0.457556f, 0.43909f,
+    0.444508f, 0.461829f, 0.442338f, 0.331753f, 0.265403f,
+    0.0891963f, 0.0807305f, 0.0758115f, 0.074586f, 0.0736102f,
+    0.072932f, 0.0702893f, 0.0695367f, 0.0688987f, 0.0697732f,
+    0.06642f, 0.049815f, 0.039852f, 0.0573321f, 0.0512266f,
+    0.0520565f, 0.0490776f, 0.0491235f, 0.0476426f, 0.0458509f,
+    0.0462332f, 0.0446478f, 0.0466877f, 0.0427174f, 0.0365079f,
+    0.0292063f, 0.0522783f, 0.0427879f, 0.0506159f, 0.0477518f,
+    0.0474966f, 0.0458926f, 0.0439636f, 0.0429238f, 0.0414854f,
+    0.0432902f, 0.0376453f, 0.028234f, 0.0225872f, 0.0377703f,
+    0.0319454f, 0.0379941f, 0.0360198f, 0.0355112f, 0.0341836f,
+    0.0328947f, 0.0322459f, 0.0312707f, 0.0312285f, 0.0278052f,
+    0.0208539f, 0.0166831f, 0.017457f, 0.0157397f, 0.0188746f,
+    0.018185f, 0.0178337f, 0.0172035f, 0.0168674f, 0.016845f,
+    0.0166388f, 0.0164349f, 0.0153132f, 0.0114849f, 0.00918794f,
+    0.0103066f, 0.00868133f, 0.00846953f, 0.00838014f, 0.00823201f,
+    0.00800707f, 0.00810788f, 0.00833914f, 0.00849641f, 0.00890973f,
+    0.00851476f, 0.00638607f, 0.00510886f, 0.00852004f, 0.00767697f,
+    0.00725151f, 0.00588307f, 0.00564719f, 0.00519401f, 0.00499344f,
+    0.00466615f, 0.00431421f, 0.00391808f, 0.00326507f, 0.0024488f,
+    0.00195904f, 0.117218f, 0.106093f, 0.0996283f, 0.0980179f,
+    0.0967355f, 0.0958442f, 0.0923714f, 0.0913824f, 0.0905439f,
+    0.0916931f, 0.0872864f, 0.0654648f, 0.0523719f, 0.085354f,
+    0.0765888f, 0.0725888f, 0.0703695f, 0.0706184f, 0.0689351f,
+    0.0679329f, 0.0680788f, 0.066293f, 0.0674289f, 0.0635838f,
+    0.0519217f, 0.0415374f, 0.0683286f, 0.0555874f, 0.0656825f,
+    0.0619632f, 0.0618301f, 0.059865f, 0.0573759f, 0.0560699f,
+    0.0542483f, 0.0577405f, 0.0499939f, 0.0402428f, 0.0321943f,
+    0.0538206f, 0.0447449f, 0.0530607f, 0.0502313f, 0.0498447f,
+    0.048156f, 0.0463071f, 0.045392f, 0.0440336f, 0.0456788f,
+    0.0401538f, 0.0301154f, 0.0240923f, 0.0335073f, 0.0285392f,
+    0.0339412f, 0.0323965f, 0.0321672f, 0.0311759f, 0.0302797f,
+    0.0299911f, 0.0294017f, 0.0308852f, 0.0276619f, 0.0207464f,
+    0.0165971f, 0.0281796f, 0.0254742f, 0.0239136f, 0.0235204f,
+    0.0232231f, 0.023006f, 0.0222137f, 0.0219963f, 0.0218314f,
+    0.0231106f, 0.020967f, 0.015912f, 0.0127296f, 0.0280225f,
+    0.0253624f, 0.023817f, 0.023432f, 0.0231255f, 0.0229124f,
+    0.0220824f, 0.0218461f, 0.0216471f, 0.02192f, 0.0208667f,
+    0.01565f, 0.01252f, 0.14524f, 0.131455f, 0.123445f,
+    0.12145f, 0.119861f, 0.118757f, 0.114453f, 0.113228f,
+    0.112189f, 0.113613f, 0.108153f, 0.0811147f, 0.0648918f,
+    0.113376f, 0.101951f, 0.0961935f, 0.093569f, 0.0936267f,
+    0.0918474f, 0.090015f, 0.0899245f, 0.0879381f, 0.0893375f,
+    0.0844503f, 0.0673355f, 0.0538684f, 0.0893027f, 0.0800924f,
+    0.0807491f, 0.0761746f, 0.0761635f, 0.0738373f, 0.0711978f,
+    0.0714646f, 0.0695529f, 0.0721908f, 0.0665342f, 0.0556566f,
+    0.0445253f, 0.0698708f, 0.0586289f, 0.0681273f, 0.0644427f,
+    0.0641781f, 0.0621283f, 0.0597194f, 0.0585381f, 0.0567965f,
+    0.0601291f, 0.0525024f, 0.0405352f, 0.0324282f, 0.0571854f,
+    0.0516519f, 0.0490077f, 0.0476314f, 0.0470571f, 0.0466166f,
+    0.0451534f, 0.044789f, 0.0443795f, 0.0453354f, 0.0425529f,
+    0.0329481f, 0.0263585f, 0.0562014f, 0.0508365f, 0.0477305f,
+    0.0469523f, 0.0463484f, 0.0459183f, 0.0442958f, 0.0438419f,
+    0.0434765f, 0.0439768f, 0.0418335f, 0.0313751f, 0.0251001f,
+    0.0560444f, 0.0507246f, 0.0476339f, 0.0468639f, 0.0462509f,
+    0.0458247f, 0.0441644f, 0.0436917f, 0.0432922f, 0.0438399f,
+    0.0417331f, 0.0312998f, 0.0250399f, 0.173262f, 0.156817f,
+    0.147262f, 0.144882f, 0.142986f, 0.141669f, 0.136535f,
+    0.135074f, 0.133834f, 0.135533f, 0.129019f, 0.0967646f,
+    0.0774116f, 0.141398f, 0.127313f, 0.119798f, 0.117001f,
+    0.116635f, 0.11476f, 0.112097f, 0.11177f, 0.109583f,
+    0.111246f, 0.105317f, 0.0827494f, 0.0661995f, 0.117325f,
+    0.105455f, 0.0996723f, 0.0966929f, 0.0969791f, 0.0949483f,
+    0.0932799f, 0.0933102f, 0.091198f, 0.0926354f, 0.0874006f,
+    0.0710705f, 0.0568563f, 0.0932337f, 0.0839912f, 0.0831939f,
+    0.0786541f, 0.0785116f, 0.0761007f, 0.0739519f, 0.0737343f,
+    0.0725399f, 0.0745794f, 0.0694237f, 0.0559491f, 0.0447592f,
+    0.0852073f, 0.0770142f, 0.0722739f, 0.0710633f, 0.0701825f,
+    0.0695289f, 0.0672354f, 0.0666346f, 0.0660247f, 0.066784f,
+    0.0634194f, 0.048362f, 0.0386896f, 0.0842232f, 0.0761987f,
+    0.0715474f, 0.0703842f, 0.0694737f, 0.0688305f, 0.0663778f,
+    0.0656875f, 0.0651217f, 0.0658853f, 0.0627f, 0.047025f,
+    0.03762f, 0.0840662f, 0.0760869f, 0.0714508f, 0.0702958f,
+    0.0693762f, 0.068737f, 0.0662465f, 0.0655373f, 0.0649374f,
+    0.0657598f, 0.0625995f, 0.0469496f, 0.0375597f, 0.229305f,
+    0.207542f, 0.194896f, 0.191745f, 0.189237f, 0.187493f,
+    0.180699f, 0.178765f, 0.177125f, 0.179373f, 0.170752f,
+    0.128064f, 0.102451f, 0.197441f, 0.178038f, 0.167008f,
+    0.163865f, 0.162652f, 0.160584f, 0.156261f, 0.155461f,
+    0.152874f, 0.155063f, 0.14705f, 0.113577f, 0.0908616f,
+    0.173368f, 0.156179f, 0.146882f, 0.143557f, 0.142996f,
+    0.140773f, 0.137444f, 0.137001f, 0.134488f, 0.136453f,
+    0.129134f, 0.101898f, 0.0815185f, 0.149277f, 0.134716f,
+    0.126292f, 0.124045f, 0.122925f, 0.121503f, 0.118116f,
+    0.117426f, 0.11583f, 0.117322f, 0.111157f, 0.0867767f,
+    0.0694214f, 0.141251f, 0.127739f, 0.119908f, 0.117927f,
+    0.116433f, 0.115353f, 0.111399f, 0.110326f, 0.109315f,
+    0.110601f, 0.105152f, 0.0791896f, 0.0633517f, 0.140267f,
+    0.126923f, 0.119181f, 0.117248f, 0.115724f, 0.114655f,
+    0.110542f, 0.109379f, 0.108412f, 0.109702f, 0.104433f,
+    0.0783247f, 0.0626598f, 0.14011f, 0.126811f, 0.119085f,
+    0.11716f, 0.115627f, 0.114561f, 0.11041f, 0.109229f,
+    0.108228f, 0.1096f, 0.104333f, 0.0782494f, 0.0625995f,
+    0.649633f, 0.587975f, 0.552149f, 0.543224f, 0.536117f,
+    0.531177f, 0.51193f, 0.506449f, 0.501802f, 0.508171f,
+    0.483749f, 0.362812f, 0.29025f, 0.617769f, 0.558471f,
+    0.524128f, 0.515343f, 0.508907f, 0.504268f, 0.487492f,
+    0.483146f, 0.477551f, 0.483692f, 0.460046f, 0.345035f,
+    0.276028f, 0.593696f, 0.536613f, 0.503542f, 0.495035f,
+    0.488916f, 0.484457f, 0.468674f, 0.464686f, 0.459166f,
+    0.465081f, 0.44213f, 0.333106f, 0.266484f, 0.569605f,
+    0.515149f, 0.483545f, 0.475523f, 0.469506f, 0.465187f,
+    0.449346f, 0.44511f, 0.440508f, 0.44595f, 0.424153f,
+    0.318115f, 0.254492f, 0.561578f, 0.508172f, 0.477161f,
+    0.469405f, 0.463313f, 0.459037f, 0.44263f, 0.43801f,
+    0.433993f, 0.439229f, 0.418149f, 0.313612f, 0.25089f,
+    0.560594f, 0.507357f, 0.476434f, 0.468726f, 0.462604f,
+    0.458339f, 0.441772f, 0.437063f, 0.43309f, 0.438498f,
+    0.41743f, 0.313072f, 0.250458f, 0.560437f, 0.507245f,
+    0.476338f, 0.468638f, 0.462507f, 0.458245f, 0.441641f,
+    0.436913f, 0.432905f, 0.438398f, 0.417329f, 0.312997f,
+    0.250397f, 0.0791505f, 0.0774216f, 0.0776427f, 0.0741395f,
+    0.0727178f, 0.0713201f, 0.0689362f, 0.0662568f, 0.0645621f,
+    0.0640863f, 0.0587356f, 0.0440517f, 0.0352414f, 0.0513352f,
+    0.0555771f, 0.0518915f, 0.0497763f, 0.0486766f, 0.0475616f,
+    0.0460214f, 0.0440614f, 0.0427532f, 0.0447063f, 0.0393823f,
+    0.0323241f, 0.0258593f, 0.036178f, 0.052753f, 0.0493707f,
+    0.0472014f, 0.0460666f, 0.0450569f, 0.0434067f, 0.0413669f,
+    0.040006f, 0.0398046f, 0.0338963f, 0.0254222f, 0.0203378f,
+    0.0264744f, 0.0377753f, 0.0356941f, 0.0340689f, 0.0333382f,
+    0.0329396f, 0.0317475f, 0.0302437f, 0.0293924f, 0.0275252f,
+    0.0238907f, 0.017918f, 0.0143344f, 0.0128146f, 0.0175535f,
+    0.017013f, 0.0163767f, 0.0163175f, 0.0166504f, 0.0163691f,
+    0.0158723f, 0.0158968f, 0.0145952f, 0.0132347f, 0.00992602f,
+    0.00794081f, 0.00819641f, 0.00742131f, 0.00745436f, 0.00730972f,
+    0.00750514f, 0.00802104f, 0.00816905f, 0.00818466f, 0.00861403f,
+    0.00901785f, 0.00781912f, 0.00586434f, 0.00469147f, 0.00305293f,
+    0.00527752f, 0.00492861f, 0.00478295f, 0.00525672f, 0.0051078f,
+    0.0047631f, 0.00447504f, 0.00413825f, 0.00359502f, 0.00299585f,
+    0.00224689f, 0.00179751f, 0.104016f, 0.101744f, 0.102035f,
+    0.0974311f, 0.0955629f, 0.0937259f, 0.0905932f, 0.087072f,
+    0.0848449f, 0.0842197f, 0.0771879f, 0.057891f, 0.0463128f,
+    0.0762011f, 0.0749948f, 0.0753762f, 0.0700183f, 0.0706165f,
+    0.0695369f, 0.0671014f, 0.0647695f, 0.0629642f, 0.0631412f,
+    0.0574426f, 0.0457039f, 0.0365631f, 0.0550402f, 0.0692348f,
+    0.0647494f, 0.0620281f, 0.0606291f, 0.0593125f, 0.0573069f,
+    0.0547786f, 0.0530959f, 0.0544248f, 0.046202f, 0.0360239f,
+    0.0288191f, 0.03757f, 0.0542571f, 0.0510729f, 0.0488956f,
+    0.0479007f, 0.0471952f, 0.0456477f, 0.0436554f, 0.0424822f,
+    0.0421454f, 0.0361964f, 0.0271473f, 0.0217178f, 0.0259884f,
+    0.0340353f, 0.0323918f, 0.0312034f, 0.03088f, 0.030906f,
+    0.0302692f, 0.029284f, 0.0289866f, 0.0292154f, 0.0255404f,
+    0.0191553f, 0.0153242f, 0.0250168f, 0.0244764f, 0.0245375f,
+    0.0233898f, 0.022988f, 0.0225654f, 0.0220692f, 0.0215964f,
+    0.0217038f, 0.0227323f, 0.0201248f, 0.0150936f, 0.0120749f,
+    0.0248662f, 0.0243232f, 0.0243925f, 0.0232918f, 0.0228454f,
+    0.0224066f, 0.0216571f, 0.0208155f, 0.0202831f, 0.0201348f,
+    0.0184526f, 0.0138394f, 0.0110716f, 0.128882f, 0.126067f,
+    0.126427f, 0.120723f, 0.118408f, 0.116132f, 0.11225f,
+    0.107887f, 0.105128f, 0.104353f, 0.0956403f, 0.0717302f,
+    0.0573842f, 0.101067f, 0.0993175f, 0.0997684f, 0.0933099f,
+    0.0934615f, 0.0919428f, 0.0887057f, 0.0855555f, 0.0831753f,
+    0.0832746f, 0.0756924f, 0.0590837f, 0.047267f, 0.079906f,
+    0.0857166f, 0.0801282f, 0.0768547f, 0.0751916f, 0.0735681f,
+    0.0712071f, 0.0681903f, 0.0662173f, 0.069045f, 0.0607128f,
+    0.0494037f, 0.0395229f, 0.0583459f, 0.0707389f, 0.0664516f,
+    0.0637223f, 0.0624633f, 0.0614508f, 0.0595478f, 0.0570671f,
+    0.055572f, 0.0567655f, 0.048502f, 0.0364246f, 0.0291397f,
+    0.0508542f, 0.0505171f, 0.049895f, 0.047398f, 0.0467526f,
+    0.0459267f, 0.0442964f, 0.0426957f, 0.0420764f, 0.0438356f,
+    0.037846f, 0.029296f, 0.0234368f, 0.0498827f, 0.0487991f,
+    0.0489297f, 0.0466814f, 0.045833f, 0.0449713f, 0.0434069f,
+    0.0417629f, 0.0406879f, 0.0404645f, 0.037021f, 0.0277658f,
+    0.0222126f, 0.0497321f, 0.0486459f, 0.0487847f, 0.0465834f,
+    0.0456904f, 0.0448125f, 0.0433141f, 0.0416307f, 0.0405659f,
+    0.0402681f, 0.0369049f, 0.0276787f, 0.022143f, 0.153748f,
+    0.15039f, 0.150819f, 0.144014f, 0.141253f, 0.138538f,
+    0.133907f, 0.128702f, 0.12541f, 0.124486f, 0.114093f,
+    0.0855694f, 0.0684556f, 0.125933f, 0.12364f, 0.124161f,
+    0.116602f, 0.116306f, 0.114349f, 0.11031f, 0.106342f,
+    0.103386f, 0.103408f, 0.0941447f, 0.0724635f, 0.0579708f,
+    0.104772f, 0.102927f, 0.1034f, 0.0964769f, 0.0968875f,
+    0.0953837f, 0.0920431f, 0.0888313f, 0.0864284f, 0.0865888f,
+    0.0787732f, 0.0627835f, 0.0502268f, 0.0832118f, 0.0872207f,
+    0.081849f, 0.078549f, 0.0770258f, 0.0757064f, 0.073448f,
+    0.0704788f, 0.0686617f, 0.0713857f, 0.0622693f, 0.0498044f,
+    0.0398435f, 0.0757201f, 0.0740857f, 0.0742872f, 0.0706896f,
+    0.0695976f, 0.0683326f, 0.0659007f, 0.0634598f, 0.0618148f,
+    0.0616073f, 0.0562403f, 0.0426758f, 0.0341406f, 0.0747486f,
+    0.0731218f, 0.0733219f, 0.069973f, 0.068678f, 0.0673771f,
+    0.0650639f, 0.0625781f, 0.0609708f, 0.0605978f, 0.0554734f,
+    0.0416051f, 0.033284f, 0.0745979f, 0.0729686f, 0.0731769f,
+    0.0698751f, 0.0685354f, 0.0672183f, 0.064971f, 0.0624459f,
+    0.0608487f, 0.0604014f, 0.0553572f, 0.0415179f, 0.0332143f,
+    0.20348f, 0.199035f, 0.199604f, 0.190597f, 0.186943f,
+    0.183349f, 0.177221f, 0.170333f, 0.165976f, 0.164753f,
+    0.150997f, 0.113248f, 0.0905984f, 0.175665f, 0.172286f,
+    0.172945f, 0.163185f, 0.161996f, 0.15916f, 0.153519f,
+    0.147914f, 0.143808f, 0.143675f, 0.131049f, 0.099223f,
+    0.0793785f, 0.154504f, 0.151573f, 0.152185f, 0.14306f,
+    0.142577f, 0.140195f, 0.135252f, 0.130403f, 0.12685f,
+    0.126855f, 0.115414f, 0.0895431f, 0.0716345f, 0.132944f,
+    0.130198f, 0.130633f, 0.123519f, 0.122399f, 0.120291f,
+    0.116038f, 0.111833f, 0.108892f, 0.108732f, 0.0990116f,
+    0.076564f, 0.0612511f, 0.125452f, 0.122731f, 0.123072f,
+    0.117273f, 0.115288f, 0.113144f, 0.109109f, 0.10507f,
+    0.102333f, 0.101874f, 0.093145f, 0.0698587f, 0.0558869f,
+    0.12448f, 0.121767f, 0.122106f, 0.116556f, 0.114368f,
+    0.112189f, 0.108378f, 0.104209f, 0.101536f, 0.100864f,
+    0.092378f, 0.0692836f, 0.0554268f, 0.12433f, 0.121614f,
+    0.121961f, 0.116458f, 0.114225f, 0.11203f, 0.108285f,
+    0.104076f, 0.101414f, 0.100668f, 0.0922619f, 0.0691965f,
+    0.0553572f, 0.576468f, 0.563876f, 0.565487f, 0.539972f,
+    0.529617f, 0.519437f, 0.502075f, 0.482561f, 0.470218f,
+    0.466753f, 0.427783f, 0.320837f, 0.256669f, 0.548653f,
+    0.537126f, 0.538828f, 0.512559f, 0.504671f, 0.495248f,
+    0.477583f, 0.459999f, 0.447883f, 0.445674f, 0.407834f,
+    0.305876f, 0.244701f, 0.527492f, 0.516413f, 0.518068f,
+    0.492434f, 0.485252f, 0.476284f, 0.459317f, 0.442355f,
+    0.430619f, 0.428855f, 0.392199f, 0.29415f, 0.23532f,
+    0.505932f, 0.495039f, 0.496516f, 0.472893f, 0.465074f,
+    0.456379f, 0.440103f, 0.423887f, 0.412802f, 0.410732f,
+    0.375797f, 0.281848f, 0.225478f, 0.49844f, 0.487572f,
+    0.488954f, 0.466647f, 0.457963f, 0.449232f, 0.433919f,
+    0.417298f, 0.406575f, 0.403874f, 0.36993f, 0.277447f,
+    0.221958f, 0.497468f, 0.486608f, 0.487989f, 0.46593f,
+    0.457043f, 0.448277f, 0.433232f, 0.416437f, 0.405778f,
+    0.402864f, 0.369164f, 0.276872f, 0.221498f, 0.497318f,
+    0.486455f, 0.487844f, 0.465832f, 0.4569f, 0.448118f,
+    0.433139f, 0.416304f, 0.405656f, 0.402668f, 0.369047f,
+    0.276785f, 0.221428f, 0.0807486f, 0.0794189f, 0.0755842f,
+    0.0733315f, 0.0716089f, 0.0700374f, 0.0672095f, 0.0637201f,
+    0.0608493f, 0.0555603f, 0.0480942f, 0.0360706f, 0.0288565f,
+    0.0606846f, 0.0577726f, 0.0511037f, 0.0517256f, 0.05049f,
+    0.0482376f, 0.0464883f, 0.0441968f, 0.0421045f, 0.0423934f,
+    0.0353278f, 0.0264959f, 0.0211967f, 0.0549625f, 0.0519242f,
+    0.0457859f, 0.0465723f, 0.0455205f, 0.0432349f, 0.0416883f,
+    0.0394666f, 0.0374941f, 0.0360481f, 0.03004f, 0.02253f,
+    0.018024f, 0.0367045f, 0.0339742f, 0.0298584f, 0.0309694f,
+    0.0305919f, 0.0290121f, 0.0283345f, 0.0269032f, 0.0257097f,
+    0.0234877f, 0.0195731f, 0.0146798f, 0.0117438f, 0.0205567f,
+    0.0172731f, 0.0127938f, 0.0139063f, 0.0141286f, 0.0136112f,
+    0.0138483f, 0.013474f, 0.0132858f, 0.012903f, 0.0107525f,
+    0.00806436f, 0.00645149f, 0.0204841f, 0.0162544f, 0.0116398f,
+    0.0104346f, 0.0106245f, 0.010378f, 0.00997273f, 0.00956566f,
+    0.00895118f, 0.0087008f, 0.00725067f, 0.005438f, 0.0043504f,
+    0.0156934f, 0.0104426f, 0.00700185f, 0.00595842f, 0.00552026f,
+    0.00504138f, 0.00457661f, 0.00411906f, 0.00370484f, 0.00311844f,
+    0.0025987f, 0.00194902f, 0.00155922f, 0.106116f, 0.104369f,
+    0.0993296f, 0.0963692f, 0.0941056f, 0.0920402f, 0.088324f,
+    0.0837384f, 0.0799657f, 0.0730151f, 0.0632034f, 0.0474026f,
+    0.037922f, 0.0796725f, 0.0766693f, 0.0722812f, 0.0709094f,
+    0.0700679f, 0.0682951f, 0.0651259f, 0.0629978f, 0.0598348f,
+    0.0570849f, 0.0484303f, 0.0368667f, 0.0294934f, 0.0739504f,
+    0.0701184f, 0.0619508f, 0.0629122f, 0.0614997f, 0.0586513f,
+    0.0566032f, 0.0537663f, 0.0512109f, 0.0507396f, 0.042283f,
+    0.0317122f, 0.0253698f, 0.0556923f, 0.0521684f, 0.0460234f,
+    0.0473094f, 0.046571f, 0.0444284f, 0.0432493f, 0.0412028f,
+    0.0394266f, 0.0381791f, 0.031816f, 0.023862f, 0.0190896f,
+    0.0354898f, 0.0327655f, 0.0289588f, 0.0302463f, 0.0301077f,
+    0.0290275f, 0.0287631f, 0.0277737f, 0.0270026f, 0.0267648f,
+    0.022304f, 0.016728f, 0.0133824f, 0.0263966f, 0.0250532f,
+    0.0238378f, 0.0231366f, 0.022651f, 0.022104f, 0.0217778f,
+    0.0212143f, 0.0208725f, 0.0214518f, 0.0178765f, 0.0134073f,
+    0.0107259f, 0.0253682f, 0.0249504f, 0.0237457f, 0.023038f,
+    0.022497f, 0.0220031f, 0.0211147f, 0.0200185f, 0.0191166f,
+    0.017455f, 0.0151096f, 0.0113322f, 0.00906577f, 0.131484f,
+    0.129319f, 0.123075f, 0.119407f, 0.116602f, 0.114043f,
+    0.109438f, 0.103757f, 0.0990822f, 0.0904699f, 0.0783126f,
+    0.0587345f, 0.0469876f, 0.104116f, 0.101463f, 0.0955892f,
+    0.0937312f, 0.0925645f, 0.0901313f, 0.0858599f, 0.0829553f,
+    0.0787082f, 0.0726309f, 0.0633978f, 0.0477399f, 0.0381919f,
+    0.0929383f, 0.0883125f, 0.0781158f, 0.0792522f, 0.0774788f,
+    0.0740676f, 0.071518f, 0.0680659f, 0.0649278f, 0.0654311f,
+    0.0545259f, 0.0408945f, 0.0327156f, 0.0746802f, 0.0703626f,
+    0.0621884f, 0.0636493f, 0.0625501f, 0.0598448f, 0.0581642f,
+    0.0555025f, 0.0531435f, 0.0528707f, 0.0440589f, 0.0330442f,
+    0.0264354f, 0.0544777f, 0.0509597f, 0.0482801f, 0.0468862f,
+    0.0461241f, 0.0448339f, 0.043678f, 0.0420733f, 0.0407195f,
+    0.0414564f, 0.034547f, 0.0259102f, 0.0207282f, 0.0508843f,
+    0.0500034f, 0.0475832f, 0.0461744f, 0.0451476f, 0.0441068f,
+    0.0423301f, 0.0401394f, 0.038338f, 0.0361433f, 0.0303473f,
+    0.0227605f, 0.0182084f, 0.0507361f, 0.0499006f, 0.0474911f,
+    0.0460757f, 0.0449936f, 0.044006f, 0.0422292f, 0.0400367f,
+    0.038233f, 0.0349098f, 0.0302188f, 0.0226641f, 0.0181313f,
+    0.156852f, 0.154269f, 0.146821f, 0.142445f, 0.139099f,
+    0.136046f, 0.130553f, 0.123775f, 0.118199f, 0.107925f,
+    0.0934218f, 0.0700664f, 0.0560531f, 0.129484f, 0.126257f,
+    0.118897f, 0.116553f, 0.115061f, 0.111967f, 0.106594f,
+    0.102913f, 0.0975816f, 0.0899317f, 0.0783654f, 0.0588806f,
+    0.0471045f, 0.111926f, 0.106507f, 0.0991067f, 0.0972031f,
+    0.0960571f, 0.0936054f, 0.0892447f, 0.086325f, 0.0819939f,
+    0.0801226f, 0.0667688f, 0.0507942f, 0.0406354f, 0.0936681f,
+    0.0885567f, 0.078382f, 0.0799892f, 0.0785292f, 0.0752611f,
+    0.073079f, 0.0698021f, 0.0668603f, 0.0675623f, 0.0563019f,
+    0.0422264f, 0.0337811f, 0.0772727f, 0.075707f, 0.0720255f,
+    0.069924f, 0.0686207f, 0.066836f, 0.0641691f, 0.0610997f,
+    0.0581808f, 0.0561479f, 0.0467899f, 0.0350925f, 0.028074f,
+    0.0762522f, 0.0749536f, 0.0713287f, 0.0692122f, 0.0676443f,
+    0.0661098f, 0.0634446f, 0.0601577f, 0.0574544f, 0.052484f,
+    0.0454566f, 0.0340924f, 0.0272739f, 0.076104f, 0.0748508f,
+    0.0712366f, 0.0691135f, 0.0674903f, 0.0660089f, 0.0633436f,
+    0.060055f, 0.0573494f, 0.0523646f, 0.0453281f, 0.0339961f,
+    0.0271969f, 0.207588f, 0.20417f, 0.194311f, 0.18852f,
+    0.184092f, 0.180052f, 0.172782f, 0.163811f, 0.156431f,
+    0.142834f, 0.12364f, 0.0927303f, 0.0741842f, 0.180219f,
+    0.175845f, 0.16613f, 0.162196f, 0.160054f, 0.15564f,
+    0.148793f, 0.142828f, 0.135329f, 0.124533f, 0.1083f,
+    0.0812253f, 0.0649802f, 0.158657f, 0.154737f, 0.145722f,
+    0.142847f, 0.14105f, 0.137278f, 0.130713f, 0.12624f,
+    0.119741f, 0.11043f, 0.0963819f, 0.0725163f, 0.058013f,
+    0.136026f, 0.132792f, 0.125752f, 0.122481f, 0.120919f,
+    0.117614f, 0.112466f, 0.10805f, 0.102457f, 0.0969454f,
+    0.0825095f, 0.0620557f, 0.0496445f, 0.128009f, 0.125607f,
+    0.119516f, 0.116f, 0.113614f, 0.110842f, 0.106398f,
+    0.101015f, 0.0964136f, 0.0881627f, 0.0764211f, 0.0573159f,
+    0.0458527f, 0.126988f, 0.124854f, 0.11882f, 0.115288f,
+    0.112638f, 0.110116f, 0.105674f, 0.100194f, 0.0956872f,
+    0.0873935f, 0.075675f, 0.0567563f, 0.045405f, 0.12684f,
+    0.124751f, 0.118727f, 0.115189f, 0.112483f, 0.110015f,
+    0.105573f, 0.100091f, 0.0955821f, 0.0872742f, 0.0755466f,
+    0.0566599f, 0.0453279f, 0.588107f, 0.578423f, 0.550493f,
+    0.534087f, 0.521541f, 0.510095f, 0.489499f, 0.464085f,
+    0.443177f, 0.404656f, 0.350278f, 0.262709f, 0.210167f,
+    0.560738f, 0.548904f, 0.522313f, 0.507008f, 0.497504f,
+    0.484783f, 0.465511f, 0.44219f, 0.422061f, 0.38608f,
+    0.334559f, 0.250919f, 0.200736f, 0.539175f, 0.527328f,
+    0.501744f, 0.487104f, 0.4785f, 0.46584f, 0.447375f,
+    0.425602f, 0.405753f, 0.37136f, 0.321937f, 0.241453f,
+    0.193162f, 0.516544f, 0.506479f, 0.481934f, 0.467757f,
+    0.458369f, 0.447055f, 0.429183f, 0.407412f, 0.388973f,
+    0.355706f, 0.308252f, 0.231189f, 0.184951f, 0.508527f,
+    0.49986f, 0.475698f, 0.461566f, 0.451063f, 0.440885f,
+    0.423115f, 0.401188f, 0.38316f, 0.349984f, 0.30306f,
+    0.227295f, 0.181836f, 0.507507f, 0.499107f, 0.475002f,
+    0.460854f, 0.450087f, 0.440159f, 0.422391f, 0.400468f,
+    0.382433f, 0.349216f, 0.302313f, 0.226735f, 0.181388f,
+    0.507358f, 0.499004f, 0.474909f, 0.460755f, 0.449933f,
+    0.440058f, 0.42229f, 0.400365f, 0.382328f, 0.349096f,
+    0.302185f, 0.226639f, 0.181311f, 0.0753415f, 0.07785f,
+    0.074869f, 0.0720879f, 0.0703695f, 0.0669188f, 0.0634846f,
+    0.0591896f, 0.0549747f, 0.0464905f, 0.0390708f, 0.0293331f,
+    0.0234665f, 0.0552912f, 0.0533365f, 0.0508396f, 0.049433f,
+    0.0493282f, 0.0475201f, 0.0451529f, 0.0429826f, 0.0408229f,
+    0.037909f, 0.0316894f, 0.0237671f, 0.0190137f, 0.0454289f,
+    0.0433873f, 0.0416621f, 0.040672f, 0.0407453f, 0.0393348f,
+    0.0373757f, 0.0356971f, 0.0338905f, 0.0310448f, 0.0259913f,
+    0.0194935f, 0.0155948f, 0.0261044f, 0.0244467f, 0.0240067f,
+    0.0237305f, 0.0241014f, 0.023532f, 0.0225569f, 0.0218796f,
+    0.0209758f, 0.0190311f, 0.0160016f, 0.0120012f, 0.00960098f,
+    0.0140988f, 0.0157371f, 0.0138724f, 0.0130515f, 0.0125728f,
+    0.011702f, 0.0109187f, 0.0103726f, 0.0099868f, 0.00985971f,
+    0.00821642f, 0.00616232f, 0.00492985f, 0.0100044f, 0.0112699f,
+    0.0101775f, 0.00917697f, 0.00889175f, 0.00807039f, 0.00736804f,
+    0.0069234f, 0.00653579f, 0.00604712f, 0.00503927f, 0.00377945f,
+    0.00302356f, 0.00528752f, 0.00368675f, 0.00432742f, 0.00349067f,
+    0.00354431f, 0.00306429f, 0.00269047f, 0.00251487f, 0.00231294f,
+    0.00195102f, 0.00162585f, 0.00121939f, 0.00097551f, 0.0990107f,
+    0.102307f, 0.0983897f, 0.094735f, 0.0924767f, 0.0879419f,
+    0.0834288f, 0.0777846f, 0.0722455f, 0.0610959f, 0.0513453f,
+    0.0385484f, 0.0308387f, 0.0746414f, 0.0758346f, 0.0712079f,
+    0.0699628f, 0.0681111f, 0.065665f, 0.0623749f, 0.0588549f,
+    0.0552821f, 0.0516105f, 0.0431299f, 0.0323474f, 0.0258779f,
+    0.064779f, 0.0622336f, 0.0595457f, 0.0580305f, 0.0580506f,
+    0.0560267f, 0.053294f, 0.0508567f, 0.0483496f, 0.0447462f,
+    0.0374318f, 0.0280738f, 0.0224591f, 0.0454546f, 0.0432929f,
+    0.0418903f, 0.041089f, 0.0414067f, 0.0402238f, 0.0384751f,
+    0.0370393f, 0.035435f, 0.0327326f, 0.0274421f, 0.0205816f,
+    0.0164653f, 0.0296599f, 0.0283022f, 0.0276073f, 0.0271842f,
+    0.027526f, 0.0269082f, 0.0259563f, 0.0252369f, 0.0244459f,
+    0.0228817f, 0.0192269f, 0.0144202f, 0.0115361f, 0.0238329f,
+    0.0246112f, 0.023622f, 0.0227499f, 0.0222127f, 0.021482f,
+    0.0207526f, 0.0201938f, 0.0196771f, 0.0186086f, 0.0156441f,
+    0.0117331f, 0.00938649f, 0.0236696f, 0.0244577f, 0.023521f,
+    0.0226473f, 0.0221075f, 0.0210234f, 0.0199445f, 0.0185952f,
+    0.0172711f, 0.0147138f, 0.0123323f, 0.00924924f, 0.0073994f,
+    0.12268f, 0.126765f, 0.121911f, 0.117382f, 0.114584f,
+    0.108965f, 0.103373f, 0.0963795f, 0.0895163f, 0.0757013f,
+    0.0636198f, 0.0477636f, 0.0382109f, 0.097353f, 0.100292f,
+    0.0943146f, 0.0924409f, 0.0898363f, 0.086477f, 0.082027f,
+    0.0772659f, 0.0715166f, 0.0653119f, 0.0545703f, 0.0409278f,
+    0.0327422f, 0.0841292f, 0.0810798f, 0.0774293f, 0.0753889f,
+    0.0753559f, 0.0727185f, 0.0692121f, 0.0660164f, 0.0628087f,
+    0.0584477f, 0.0488722f, 0.0366542f, 0.0293234f, 0.0648048f,
+    0.0621392f, 0.0597738f, 0.0584474f, 0.0587121f, 0.0569156f,
+    0.0543932f, 0.052199f, 0.0498941f, 0.046434f, 0.0388826f,
+    0.0291619f, 0.0233295f, 0.0490101f, 0.0500707f, 0.0478762f,
+    0.0461307f, 0.0450681f, 0.0436f, 0.0418745f, 0.0403966f,
+    0.038905f, 0.0365831f, 0.0306673f, 0.0230005f, 0.0184004f,
+    0.0475021f, 0.0490685f, 0.0471428f, 0.045397f, 0.0443199f,
+    0.0421481f, 0.0400009f, 0.0373051f, 0.0346608f, 0.03231f,
+    0.0270846f, 0.0203134f, 0.0162508f, 0.0473388f, 0.048915f,
+    0.0470417f, 0.0452944f, 0.0442147f, 0.0420466f, 0.0398888f,
+    0.0371902f, 0.0345419f, 0.0292111f, 0.0245492f, 0.0184313f,
+    0.014745f, 0.146349f, 0.151222f, 0.145431f, 0.140029f,
+    0.136691f, 0.129988f, 0.123317f, 0.114974f, 0.106787f,
+    0.0903067f, 0.0758942f, 0.0569789f, 0.0455832f, 0.121022f,
+    0.124749f, 0.117835f, 0.114919f, 0.111561f, 0.107289f,
+    0.101679f, 0.0956769f, 0.0885016f, 0.0790134f, 0.0660108f,
+    0.0495081f, 0.0396065f, 0.103479f, 0.103984f, 0.0976302f,
+    0.0959122f, 0.0933518f, 0.0899846f, 0.0854758f, 0.0811761f,
+    0.0772678f, 0.0721491f, 0.0603127f, 0.0452345f, 0.0361876f,
+    0.084155f, 0.0822486f, 0.0777485f, 0.0758139f, 0.0760173f,
+    0.0736074f, 0.0703114f, 0.0673587f, 0.0643532f, 0.0601354f,
+    0.050323f, 0.0377422f, 0.0301938f, 0.0722008f, 0.074528f,
+    0.071397f, 0.0687778f, 0.0671753f, 0.0639043f, 0.0607086f,
+    0.0566616f, 0.0533642f, 0.0502845f, 0.0421078f, 0.0315809f,
+    0.0252647f, 0.0711714f, 0.0735259f, 0.0706635f, 0.0680441f,
+    0.0664272f, 0.0631712f, 0.0599452f, 0.0559001f, 0.0519316f,
+    0.0460115f, 0.038525f, 0.0288938f, 0.023115f, 0.0710081f,
+    0.0733723f, 0.0705625f, 0.0679415f, 0.0663219f, 0.0630696f,
+    0.0598331f, 0.0557851f, 0.0518127f, 0.0438165f, 0.0368237f,
+    0.0276465f, 0.0221172f, 0.193688f, 0.200137f, 0.192473f,
+    0.185323f, 0.180906f, 0.172035f, 0.163206f, 0.152164f,
+    0.141329f, 0.119518f, 0.100443f, 0.0754094f, 0.0603275f,
+    0.168361f, 0.173664f, 0.164877f, 0.159875f, 0.155611f,
+    0.148913f, 0.141176f, 0.132499f, 0.122929f, 0.106416f,
+    0.0888916f, 0.066877f, 0.0535016f, 0.14836f, 0.152899f,
+    0.144568f, 0.140868f, 0.136802f, 0.131609f, 0.12478f,
+    0.117487f, 0.108726f, 0.099552f, 0.0831937f, 0.0623952f,
+    0.0499162f, 0.127207f, 0.131163f, 0.12479f, 0.12077f,
+    0.117666f, 0.112654f, 0.106761f, 0.100491f, 0.0932714f,
+    0.0875383f, 0.0732039f, 0.0549029f, 0.0439224f, 0.119539f,
+    0.123443f, 0.118439f, 0.114072f, 0.11139f, 0.105951f,
+    0.100597f, 0.0938516f, 0.0872326f, 0.0776874f, 0.0649886f,
+    0.0487415f, 0.0389932f, 0.11851f, 0.12244f, 0.117705f,
+    0.113338f, 0.110642f, 0.105218f, 0.0998337f, 0.0930899f,
+    0.0864731f, 0.0734143f, 0.0614778f, 0.0462117f, 0.0369694f,
+    0.118347f, 0.122287f, 0.117604f, 0.113236f, 0.110536f,
+    0.105116f, 0.0997216f, 0.092975f, 0.0863543f, 0.0730274f,
+    0.0613726f, 0.0460771f, 0.0368617f, 0.548726f, 0.566996f,
+    0.545284f, 0.52503f, 0.512514f, 0.487382f, 0.46237f,
+    0.431089f, 0.400391f, 0.338599f, 0.28456f, 0.213638f,
+    0.170911f, 0.523399f, 0.540524f, 0.517688f, 0.498764f,
+    0.48722f, 0.463642f, 0.44034f, 0.410922f, 0.381991f,
+    0.323404f, 0.271858f, 0.204641f, 0.163713f, 0.503398f,
+    0.519759f, 0.49738f, 0.479248f, 0.468216f, 0.445605f,
+    0.423333f, 0.395146f, 0.367423f, 0.311191f, 0.261619f,
+    0.197507f, 0.158005f, 0.482246f, 0.498023f, 0.477601f,
+    0.460037f, 0.449275f, 0.427409f, 0.405833f, 0.378646f,
+    0.351944f, 0.297949f, 0.250467f, 0.188901f, 0.151121f,
+    0.474578f, 0.490302f, 0.47125f, 0.453778f, 0.442999f,
+    0.421298f, 0.399761f, 0.372776f, 0.346294f, 0.292939f,
+    0.24621f, 0.184973f, 0.147978f, 0.473548f, 0.4893f,
+    0.470516f, 0.453045f, 0.44225f, 0.420565f, 0.398998f,
+    0.372014f, 0.345535f, 0.292227f, 0.245595f, 0.184422f,
+    0.147538f, 0.473385f, 0.489147f, 0.470416f, 0.452942f,
+    0.442145f, 0.420464f, 0.398886f, 0.371899f, 0.345416f,
+    0.292109f, 0.245489f, 0.184306f, 0.147445f, 0.0752893f,
+    0.0743408f, 0.0740659f, 0.0715009f, 0.0679294f, 0.0651f,
+    0.0604763f, 0.0563178f, 0.0517584f, 0.0429488f, 0.0359256f,
+    0.0269851f, 0.0215881f, 0.0492722f, 0.0486788f, 0.0471602f,
+    0.0465269f, 0.0457715f, 0.0440996f, 0.0420612f, 0.0400149f,
+    0.0379437f, 0.0339423f, 0.0288593f, 0.0216444f, 0.0173156f,
+    0.0440565f, 0.0408473f, 0.0392316f, 0.0382667f, 0.036904f,
+    0.0346878f, 0.0360739f, 0.0322402f, 0.0301052f, 0.0272687f,
+    0.0233309f, 0.0174982f, 0.0139986f, 0.0286624f, 0.0273253f,
+    0.0262738f, 0.0259904f, 0.0257102f, 0.0245894f, 0.0246805f,
+    0.0228175f, 0.0206043f, 0.0167345f, 0.014009f, 0.0105067f,
+    0.00840538f, 0.0122929f, 0.0116853f, 0.0115187f, 0.0120144f,
+    0.0129312f, 0.0132818f, 0.0139744f, 0.013739f, 0.0127451f,
+    0.0105014f, 0.00875117f, 0.00656338f, 0.0052507f, 0.00927145f,
+    0.0076269f, 0.00618195f, 0.00581803f, 0.00654242f, 0.00742431f,
+    0.00859338f, 0.00900732f, 0.00860323f, 0.0072084f, 0.006007f,
+    0.00450525f, 0.0036042f, 0.00492781f, 0.0034103f, 0.00255241f,
+    0.00217937f, 0.00245465f, 0.00216926f, 0.00250994f, 0.00315752f,
+    0.00332418f, 0.00296615f, 0.00247179f, 0.00185384f, 0.00148308f,
+    0.0989421f, 0.0976958f, 0.0973345f, 0.0939635f, 0.08927f,
+    0.0855518f, 0.0794756f, 0.0740106f, 0.0680188f, 0.0564415f,
+    0.047212f, 0.0354627f, 0.0283702f, 0.072925f, 0.0718866f,
+    0.0704287f, 0.0684838f, 0.0663435f, 0.0629162f, 0.0593477f,
+    0.0556739f, 0.0520985f, 0.0464507f, 0.039437f, 0.0295777f,
+    0.0236622f, 0.0591932f, 0.055999f, 0.0543271f, 0.0536176f,
+    0.0529332f, 0.0510769f, 0.0504902f, 0.0465362f, 0.04426f,
+    0.0397771f, 0.0339086f, 0.0254315f, 0.0203452f, 0.0437991f,
+    0.0411016f, 0.0396956f, 0.0391886f, 0.0385157f, 0.0368299f,
+    0.0390968f, 0.0354061f, 0.0317009f, 0.0286575f, 0.0245867f,
+    0.01844f, 0.014752f, 0.0267699f, 0.026859f, 0.0263958f,
+    0.0258423f, 0.0257766f, 0.0255224f, 0.0283907f, 0.0263276f,
+    0.0238417f, 0.0200025f, 0.0172056f, 0.0129042f, 0.0103233f,
+    0.0238214f, 0.0234471f, 0.0233759f, 0.0225689f, 0.0214541f,
+    0.0206043f, 0.0230097f, 0.0215959f, 0.0196998f, 0.0164052f,
+    0.0140753f, 0.0105565f, 0.00844517f, 0.0236535f, 0.023355f,
+    0.0232687f, 0.0224629f, 0.0213409f, 0.020452f, 0.0189995f,
+    0.0176931f, 0.0162607f, 0.0134931f, 0.0112866f, 0.00847801f,
+    0.0067824f, 0.122595f, 0.121051f, 0.120603f, 0.116426f,
+    0.110611f, 0.106004f, 0.0984747f, 0.0917034f, 0.0842791f,
+    0.0699343f, 0.0584983f, 0.0439403f, 0.0351522f, 0.0965779f,
+    0.0950945f, 0.0936972f, 0.0907383f, 0.0875371f, 0.083368f,
+    0.0780181f, 0.073063f, 0.0672009f, 0.0589592f, 0.0500147f,
+    0.037511f, 0.0301645f, 0.0764986f, 0.0754833f, 0.0736564f,
+    0.0719741f, 0.0703924f, 0.0678106f, 0.0649065f, 0.0615727f,
+    0.0584147f, 0.0522855f, 0.0444863f, 0.0333647f, 0.0266918f,
+    0.0589359f, 0.0574487f, 0.0559693f, 0.0551113f, 0.0545149f,
+    0.0525605f, 0.0535131f, 0.047999f, 0.0457272f, 0.0411659f,
+    0.0351643f, 0.0263733f, 0.0210986f, 0.0484558f, 0.0476222f,
+    0.047406f, 0.0457906f, 0.0436445f, 0.0417986f, 0.0428069f,
+    0.0389162f, 0.0361795f, 0.032511f, 0.0277832f, 0.0208375f,
+    0.0166699f, 0.0474742f, 0.0468019f, 0.0466444f, 0.0450316f,
+    0.0427888f, 0.0410179f, 0.038117f, 0.0355132f, 0.0326482f,
+    0.0289136f, 0.024653f, 0.0184897f, 0.0147918f, 0.0473063f,
+    0.0467099f, 0.0465373f, 0.0449256f, 0.0426815f, 0.0409038f,
+    0.0379987f, 0.0353858f, 0.0325211f, 0.0269858f, 0.022573f,
+    0.0169556f, 0.0135645f, 0.146248f, 0.144405f, 0.143871f,
+    0.138889f, 0.131951f, 0.126455f, 0.117474f, 0.109396f,
+    0.10054f, 0.083427f, 0.0697847f, 0.0524179f, 0.0419343f,
+    0.120231f, 0.118302f, 0.116966f, 0.113201f, 0.10873f,
+    0.10382f, 0.0968242f, 0.0905535f, 0.0834612f, 0.0714676f,
+    0.0605924f, 0.0454443f, 0.036716f, 0.100151f, 0.0986911f,
+    0.0969249f, 0.0939788f, 0.0910167f, 0.0863805f, 0.0813782f,
+    0.0766092f, 0.0725695f, 0.064794f, 0.055064f, 0.041298f,
+    0.0330384f, 0.0794275f, 0.078212f, 0.0771429f, 0.0746346f,
+    0.07201f, 0.0692943f, 0.0679293f, 0.0630355f, 0.0598819f,
+    0.0536744f, 0.045742f, 0.0343065f, 0.0274452f, 0.0721086f,
+    0.0708659f, 0.0706746f, 0.0682533f, 0.0648879f, 0.0622504f,
+    0.0578955f, 0.0539971f, 0.0503342f, 0.0450194f, 0.0383609f,
+    0.0287707f, 0.0230165f, 0.0711271f, 0.0701568f, 0.0699129f,
+    0.0674943f, 0.0641295f, 0.0614697f, 0.0571163f, 0.0532059f,
+    0.0489085f, 0.041422f, 0.0352306f, 0.026423f, 0.0211384f,
+    0.0709591f, 0.0700648f, 0.0698058f, 0.0673882f, 0.0640222f,
+    0.0613556f, 0.0569979f, 0.0530787f, 0.0487815f, 0.0404786f,
+    0.0338594f, 0.0254332f, 0.0203466f, 0.193553f, 0.191115f,
+    0.190409f, 0.183814f, 0.174633f, 0.167359f, 0.155472f,
+    0.144782f, 0.13306f, 0.110413f, 0.0923574f, 0.0693731f,
+    0.0554985f, 0.167536f, 0.164718f, 0.163503f, 0.158126f,
+    0.151117f, 0.144723f, 0.134823f, 0.125939f, 0.115982f,
+    0.0964845f, 0.0817477f, 0.0616218f, 0.049819f, 0.147457f,
+    0.145107f, 0.143462f, 0.138817f, 0.133404f, 0.127284f,
+    0.118719f, 0.111123f, 0.102344f, 0.0898108f, 0.0762194f,
+    0.0571645f, 0.0458765f, 0.126733f, 0.124628f, 0.12368f,
+    0.11956f, 0.114397f, 0.109365f, 0.101878f, 0.0951886f,
+    0.0881915f, 0.0786912f, 0.0668974f, 0.0501731f, 0.0401384f,
+    0.119414f, 0.117576f, 0.117212f, 0.113179f, 0.107569f,
+    0.103154f, 0.0958939f, 0.0893827f, 0.0821962f, 0.0700363f,
+    0.0595163f, 0.0446372f, 0.0357098f, 0.118433f, 0.116867f,
+    0.11645f, 0.11242f, 0.106811f, 0.102373f, 0.0951147f,
+    0.0885915f, 0.0814292f, 0.0675792f, 0.0565306f, 0.0425809f,
+    0.0340959f, 0.118265f, 0.116775f, 0.116343f, 0.112314f,
+    0.106703f, 0.102259f, 0.0949962f, 0.0884641f, 0.0813022f,
+    0.0674642f, 0.056432f, 0.0423885f, 0.0339108f, 0.548346f,
+    0.541438f, 0.539436f, 0.520754f, 0.494743f, 0.474136f,
+    0.44046f, 0.410173f, 0.376966f, 0.312804f, 0.261653f,
+    0.196537f, 0.15723f, 0.522329f, 0.514061f, 0.51253f,
+    0.495066f, 0.47068f, 0.4515f, 0.419811f, 0.391331f,
+    0.359887f, 0.298838f, 0.249998f, 0.188557f, 0.150845f,
+    0.502249f, 0.493866f, 0.49249f, 0.475757f, 0.452394f,
+    0.43406f, 0.403695f, 0.376424f, 0.34625f, 0.28758f,
+    0.240592f, 0.181985f, 0.145588f, 0.481526f, 0.474185f,
+    0.472708f, 0.4565f, 0.433919f, 0.416141f, 0.386867f,
+    0.36058f, 0.331581f, 0.275321f, 0.230328f, 0.174057f,
+    0.139246f, 0.474207f, 0.467899f, 0.466239f, 0.450119f,
+    0.427679f, 0.409931f, 0.380882f, 0.354774f, 0.326102f,
+    0.270645f, 0.226396f, 0.170316f, 0.136253f, 0.473225f,
+    0.46719f, 0.465478f, 0.44936f, 0.42692f, 0.40915f,
+    0.380102f, 0.353983f, 0.325335f, 0.26997f, 0.225826f,
+    0.169644f, 0.135715f, 0.473057f, 0.467098f, 0.46537f,
+    0.449254f, 0.426813f, 0.409036f, 0.379984f, 0.353855f,
+    0.325208f, 0.269856f, 0.225727f, 0.169553f, 0.135642f,
+    0.769007f, 0.405011f, 0.228797f, 0.186986f, 0.153238f,
+    0.143089f, 0.136345f, 0.116867f, 0.102259f, 0.0948045f,
+    0.0985944f, 0.0739458f, 0.0591566f, 0.503311f, 0.262949f,
+    0.147619f, 0.119666f, 0.0971795f, 0.0929788f, 0.0873697f,
+    0.0748883f, 0.0655273f, 0.0608039f, 0.0605653f, 0.0487629f,
+    0.0401905f, 0.299121f, 0.154726f, 0.0902979f, 0.0752518f,
+    0.0564389f, 0.0608398f, 0.0597072f, 0.0613679f, 0.0536969f,
+    0.0500951f, 0.0470458f, 0.0352843f, 0.0282275f, 0.0880522f,
+    0.0620731f, 0.05634f, 0.0479008f, 0.0359256f, 0.0372901f,
+    0.0375511f, 0.0377984f, 0.0330736f, 0.0300511f, 0.0296933f,
+    0.0222699f, 0.017816f, 0.0123342f, 0.0270009f, 0.0218427f,
+    0.0189567f, 0.0170962f, 0.022403f, 0.0198412f, 0.0179351f,
+    0.0156932f, 0.0162668f, 0.0153869f, 0.0115402f, 0.00923216f,
+    0.00181999f, 0.0109534f, 0.00789956f, 0.00690385f, 0.013852f,
+    0.0182828f, 0.0156465f, 0.0138371f, 0.0121074f, 0.0110288f,
+    0.00983159f, 0.00737369f, 0.0069874f, 4.53142e-06f, 0.000503539f,
+    0.00028234f, 0.000234084f, 0.00516847f, 0.00855014f, 0.0071345f,
+    0.00613913f, 0.00537174f, 0.00429739f, 0.00358116f, 0.00268587f,
+    0.00280549f, 1.0106f, 0.532249f, 0.300675f, 0.245729f,
+    0.20138f, 0.188042f, 0.179179f, 0.153582f, 0.134385f,
+    0.124588f, 0.129569f, 0.0971765f, 0.0777412f, 0.744902f,
+    0.390187f, 0.219497f, 0.178409f, 0.145321f, 0.137932f,
+    0.130204f, 0.111603f, 0.0976529f, 0.0905876f, 0.0915396f,
+    0.069419f, 0.0581273f, 0.540711f, 0.281964f, 0.158098f,
+    0.127982f, 0.103864f, 0.100182f, 0.0939649f, 0.0838495f,
+    0.0733683f, 0.0689656f, 0.0644549f, 0.0533661f, 0.0436185f,
+    0.329643f, 0.171597f, 0.0961559f, 0.0777964f, 0.0632097f,
+    0.0616423f, 0.0589987f, 0.0602801f, 0.0527451f, 0.0489216f,
+    0.0467582f, 0.0350687f, 0.0280549f, 0.253925f, 0.133125f,
+    0.0750025f, 0.0610914f, 0.0499564f, 0.0475886f, 0.0451077f,
+    0.0386638f, 0.0338308f, 0.0313179f, 0.0317845f, 0.0238383f,
+    0.0195582f, 0.243411f, 0.128058f, 0.072302f, 0.0590478f,
+    0.0483729f, 0.0454246f, 0.0432322f, 0.0370562f, 0.0324242f,
+    0.0300428f, 0.031051f, 0.0232882f, 0.0186306f, 0.241595f,
+    0.12724f, 0.0718795f, 0.0587439f, 0.0481417f, 0.0449552f,
+    0.0428362f, 0.0367167f, 0.0321271f, 0.0297849f, 0.0309744f,
+    0.0232308f, 0.0185846f, 1.25219f, 0.659487f, 0.372554f,
+    0.304472f, 0.249521f, 0.232995f, 0.222014f, 0.190297f,
+    0.16651f, 0.154372f, 0.160543f, 0.120407f, 0.0963258f,
+    0.986492f, 0.517424f, 0.291376f, 0.237152f, 0.193462f,
+    0.182884f, 0.173038f, 0.148318f, 0.129779f, 0.120371f,
+    0.122514f, 0.0918854f, 0.0760641f, 0.782302f, 0.409202f,
+    0.229976f, 0.186725f, 0.152006f, 0.145135f, 0.136799f,
+    0.117256f, 0.102599f, 0.0951462f, 0.0954292f, 0.0740222f,
+    0.0615552f, 0.571233f, 0.298835f, 0.168034f, 0.13654f,
+    0.111351f, 0.106595f, 0.100648f, 0.0862701f, 0.0754864f,
+    0.0699338f, 0.0702042f, 0.0533879f, 0.0446618f, 0.495515f,
+    0.260363f, 0.146881f, 0.119835f, 0.0980976f, 0.0925414f,
+    0.0879419f, 0.0753787f, 0.0659564f, 0.0611016f, 0.0627588f,
+    0.0470691f, 0.0376553f, 0.485001f, 0.255296f, 0.144181f,
+    0.117791f, 0.0965142f, 0.0903774f, 0.0860664f, 0.0737712f,
+    0.0645498f, 0.0598265f, 0.0620253f, 0.046519f, 0.0372152f,
+    0.483186f, 0.254478f, 0.143758f, 0.117487f, 0.096283f,
+    0.089908f, 0.0856703f, 0.0734317f, 0.0642528f, 0.0595687f,
+    0.0619487f, 0.0464615f, 0.0371692f, 1.49378f, 0.786725f,
+    0.444432f, 0.363216f, 0.297662f, 0.277948f, 0.264848f,
+    0.227012f, 0.198636f, 0.184156f, 0.191517f, 0.143638f,
+    0.11491f, 1.22808f, 0.644662f, 0.363254f, 0.295895f,
+    0.241603f, 0.227837f, 0.215872f, 0.185033f, 0.161904f,
+    0.150155f, 0.153488f, 0.115116f, 0.0940008f, 1.02389f,
+    0.53644f, 0.301855f, 0.245469f, 0.200147f, 0.190088f,
+    0.179633f, 0.153971f, 0.134725f, 0.12493f, 0.126404f,
+    0.0948027f, 0.079492f, 0.812824f, 0.426073f, 0.239913f,
+    0.195283f, 0.159492f, 0.151548f, 0.143483f, 0.122985f,
+    0.107612f, 0.0997175f, 0.101178f, 0.0758839f, 0.0625986f,
+    0.737106f, 0.387601f, 0.21876f, 0.178578f, 0.146239f,
+    0.137494f, 0.130776f, 0.112094f, 0.098082f, 0.0908853f,
+    0.0937331f, 0.0702999f, 0.0562399f, 0.726592f, 0.382533f,
+    0.216059f, 0.176534f, 0.144655f, 0.13533f, 0.128901f,
+    0.110486f, 0.0966754f, 0.0896102f, 0.0929996f, 0.0697497f,
+    0.0557998f, 0.724776f, 0.381716f, 0.215637f, 0.176231f,
+    0.144424f, 0.134861f, 0.128504f, 0.110147f, 0.0963784f,
+    0.0893523f, 0.092923f, 0.0696923f, 0.0557538f, 1.97696f,
+    1.0412f, 0.588189f, 0.480702f, 0.393945f, 0.367853f,
+    0.350516f, 0.300442f, 0.262887f, 0.243723f, 0.253466f,
+    0.1901f, 0.15208f, 1.71126f, 0.899138f, 0.507012f,
+    0.413382f, 0.337886f, 0.317743f, 0.30154f, 0.258463f,
+    0.226155f, 0.209722f, 0.215437f, 0.161578f, 0.129874f,
+    1.50707f, 0.790915f, 0.445612f, 0.362955f, 0.296429f,
+    0.279994f, 0.265302f, 0.227401f, 0.198976f, 0.184497f,
+    0.188352f, 0.141264f, 0.115366f, 1.29601f, 0.680549f,
+    0.38367f, 0.31277f, 0.255775f, 0.241453f, 0.229151f,
+    0.196415f, 0.171863f, 0.159285f, 0.163127f, 0.122345f,
+    0.0984721f, 1.22029f, 0.642077f, 0.362517f, 0.296065f,
+    0.242521f, 0.2274f, 0.216444f, 0.185524f, 0.162333f,
+    0.150453f, 0.155682f, 0.116761f, 0.0934091f, 1.20977f,
+    0.637009f, 0.359816f, 0.294021f, 0.240938f, 0.225236f,
+    0.214569f, 0.183916f, 0.160927f, 0.149178f, 0.154948f,
+    0.116211f, 0.092969f, 1.20796f, 0.636191f, 0.359394f,
+    0.293717f, 0.240707f, 0.224766f, 0.214173f, 0.183577f,
+    0.16063f, 0.14892f, 0.154872f, 0.116154f, 0.092923f,
+    5.60082f, 2.94977f, 1.66637f, 1.36185f, 1.11606f,
+    1.04215f, 0.993028f, 0.851167f, 0.744771f, 0.690478f,
+    0.718081f, 0.538561f, 0.430849f, 5.33512f, 2.80771f,
+    1.58519f, 1.29453f, 1.06f, 0.992035f, 0.944053f,
+    0.809188f, 0.70804f, 0.656478f, 0.680052f, 0.510039f,
+    0.408031f, 5.13093f, 2.69948f, 1.52379f, 1.2441f,
+    1.01855f, 0.954285f, 0.907814f, 0.778126f, 0.68086f,
+    0.631253f, 0.652967f, 0.489725f, 0.39178f, 4.91986f,
+    2.58912f, 1.46185f, 1.19392f, 0.977894f, 0.915745f,
+    0.871663f, 0.74714f, 0.653747f, 0.60604f, 0.627742f,
+    0.470807f, 0.376645f, 4.84415f, 2.55065f, 1.44069f,
+    1.17721f, 0.96464f, 0.901692f, 0.858957f, 0.736249f,
+    0.644217f, 0.597208f, 0.620297f, 0.465223f, 0.372178f,
+    4.83363f, 2.54558f, 1.43799f, 1.17517f, 0.963057f,
+    0.899528f, 0.857081f, 0.734641f, 0.642811f, 0.595933f,
+    0.619563f, 0.464672f, 0.371738f, 4.83182f, 2.54476f,
+    1.43757f, 1.17487f, 0.962826f, 0.899058f, 0.856685f,
+    0.734302f, 0.642514f, 0.595675f, 0.619487f, 0.464615f,
+    0.371692f, 0.210612f, 0.157996f, 0.105463f, 0.097224f,
+    0.0985017f, 0.0941992f, 0.091409f, 0.0979409f, 0.0856983f,
+    0.0861115f, 0.0814446f, 0.0648725f, 0.051898f, 0.14764f,
+    0.103467f, 0.0724761f, 0.0746785f, 0.0616393f, 0.0591047f,
+    0.056228f, 0.061955f, 0.0557841f, 0.0554869f, 0.0538381f,
+    0.0467003f, 0.0373603f, 0.115988f, 0.0671348f, 0.0642264f,
+    0.0666953f, 0.0545576f, 0.0491116f, 0.0409263f, 0.0432588f,
+    0.0423063f, 0.0480595f, 0.0476903f, 0.0357678f, 0.0286142f,
+    0.0922193f, 0.0482936f, 0.0409751f, 0.0429891f, 0.0345593f,
+    0.031577f, 0.0263141f, 0.0269208f, 0.0258776f, 0.029115f,
+    0.030623f, 0.0229672f, 0.0183738f, 0.0508499f, 0.0238124f,
+    0.0170734f, 0.0178661f, 0.017933f, 0.0143464f, 0.0131898f,
+    0.0113056f, 0.00989978f, 0.0110391f, 0.0131283f, 0.010459f,
+    0.0105934f, 0.0257365f, 0.0112214f, 0.00702131f, 0.00714811f,
+    0.0138274f, 0.0110619f, 0.00963073f, 0.00825491f, 0.00722304f,
+    0.00577844f, 0.00753917f, 0.0065008f, 0.00717605f, 0.00253362f,
+    0.00102198f, 0.000526448f, 0.000447129f, 0.00603f, 0.004824f,
+    0.00402822f, 0.00345276f, 0.00302117f, 0.00241693f, 0.00246536f,
+    0.00189636f, 0.00253733f, 0.276777f, 0.207632f, 0.138595f,
+    0.127768f, 0.129447f, 0.123793f, 0.120126f, 0.12871f,
+    0.112621f, 0.113164f, 0.107031f, 0.0852529f, 0.0682023f,
+    0.213806f, 0.152472f, 0.0966115f, 0.0983322f, 0.0916046f,
+    0.0883373f, 0.0848303f, 0.0927241f, 0.0826982f, 0.0811214f,
+    0.0776424f, 0.0670806f, 0.0536645f, 0.161797f, 0.111256f,
+    0.0873921f, 0.0903491f, 0.0742593f, 0.0665522f, 0.0603956f,
+    0.0664108f, 0.0595766f, 0.0661734f, 0.0649428f, 0.0507344f,
+    0.0405875f, 0.12516f, 0.0698004f, 0.0641408f, 0.0666429f,
+    0.054261f, 0.0490176f, 0.040848f, 0.0427646f, 0.0416314f,
+    0.047229f, 0.0478754f, 0.0359065f, 0.0287252f, 0.0837907f,
+    0.0514733f, 0.040239f, 0.0415199f, 0.033733f, 0.0304954f,
+    0.0295532f, 0.0321221f, 0.0281068f, 0.0291531f, 0.0303808f,
+    0.0227856f, 0.0182285f, 0.0676508f, 0.0497103f, 0.0331824f,
+    0.0308018f, 0.0310683f, 0.0297019f, 0.0288139f, 0.0309808f,
+    0.0271082f, 0.0272133f, 0.0257215f, 0.0206862f, 0.0165489f,
+    0.0661743f, 0.0496359f, 0.0331323f, 0.0305438f, 0.0309455f,
+    0.0295938f, 0.0287172f, 0.03077f, 0.0269237f, 0.0270534f,
+    0.0255869f, 0.0203818f, 0.0163055f, 0.342943f, 0.257268f,
+    0.171728f, 0.158312f, 0.160392f, 0.153386f, 0.148843f,
+    0.159479f, 0.139544f, 0.140217f, 0.132618f, 0.105633f,
+    0.0845065f, 0.279971f, 0.201478f, 0.129744f, 0.121986f,
+    0.12255f, 0.11757f, 0.113547f, 0.123493f, 0.109612f,
+    0.108174f, 0.103229f, 0.0874609f, 0.0699687f, 0.227962f,
+    0.160262f, 0.110558f, 0.114003f, 0.095666f, 0.0923345f,
+    0.088512f, 0.0971798f, 0.0864907f, 0.0849191f, 0.0821952f,
+    0.0711147f, 0.0568918f, 0.167268f, 0.116542f, 0.0873064f,
+    0.0902966f, 0.0739627f, 0.0675136f, 0.0652315f, 0.0714744f,
+    0.062843f, 0.0653429f, 0.0651278f, 0.0512391f, 0.0409913f,
+    0.13944f, 0.100479f, 0.0669283f, 0.0651736f, 0.0628714f,
+    0.060089f, 0.0582702f, 0.0628911f, 0.0550297f, 0.0551874f,
+    0.0522058f, 0.0425345f, 0.0340276f, 0.133816f, 0.0993462f,
+    0.0663147f, 0.0611268f, 0.0620136f, 0.0592954f, 0.0575309f,
+    0.0617499f, 0.0540311f, 0.054266f, 0.0513081f, 0.0410665f,
+    0.0328532f, 0.13234f, 0.0992718f, 0.0662645f, 0.0610876f,
+    0.0618907f, 0.0591873f, 0.0574341f, 0.061539f, 0.0538466f,
+    0.0541061f, 0.0511735f, 0.0407621f, 0.0326097f, 0.409109f,
+    0.306904f, 0.20486f, 0.188855f, 0.191337f, 0.18298f,
+    0.17756f, 0.190248f, 0.166467f, 0.16727f, 0.158204f,
+    0.126013f, 0.100811f, 0.346137f, 0.250483f, 0.162876f,
+    0.149416f, 0.153495f, 0.146802f, 0.142264f, 0.154262f,
+    0.136526f, 0.135227f, 0.128816f, 0.107841f, 0.086273f,
+    0.294128f, 0.209267f, 0.133723f, 0.137657f, 0.126611f,
+    0.121567f, 0.117229f, 0.127949f, 0.113405f, 0.111972f,
+    0.106873f, 0.091495f, 0.073196f, 0.233434f, 0.165548f,
+    0.110472f, 0.11395f, 0.101477f, 0.0969637f, 0.0939485f,
+    0.102243f, 0.0897571f, 0.0895318f, 0.0850681f, 0.0716194f,
+    0.0572955f, 0.205606f, 0.149887f, 0.100061f, 0.0921813f,
+    0.0938166f, 0.0896825f, 0.0869871f, 0.0936602f, 0.0819527f,
+    0.0822401f, 0.0777924f, 0.0629148f, 0.0503319f, 0.199982f,
+    0.148982f, 0.0994469f, 0.0916706f, 0.0929588f, 0.0888889f,
+    0.0862479f, 0.0925189f, 0.080954f, 0.0813188f, 0.0768947f,
+    0.0614468f, 0.0491574f, 0.198506f, 0.148908f, 0.0993967f,
+    0.0916314f, 0.0928359f, 0.0887808f, 0.0861511f, 0.0923081f,
+    0.0807695f, 0.0811588f, 0.07676f, 0.0611425f, 0.048914f,
+    0.54144f, 0.406175f, 0.271124f, 0.249943f, 0.253228f,
+    0.242167f, 0.234994f, 0.251786f, 0.220313f, 0.221375f,
+    0.209378f, 0.166774f, 0.133419f, 0.478468f, 0.348494f,
+    0.22914f, 0.210504f, 0.215385f, 0.205969f, 0.199698f,
+    0.2158f, 0.190355f, 0.189332f, 0.179989f, 0.148602f,
+    0.118882f, 0.426459f, 0.307278f, 0.199877f, 0.184964f,
+    0.188502f, 0.180217f, 0.174663f, 0.189487f, 0.167233f,
+    0.166077f, 0.158046f, 0.132256f, 0.105805f, 0.365765f,
+    0.263558f, 0.173546f, 0.161258f, 0.163368f, 0.156151f,
+    0.151382f, 0.163782f, 0.143585f, 0.143637f, 0.136241f,
+    0.11238f, 0.089904f, 0.337937f, 0.249158f, 0.166325f,
+    0.153269f, 0.155707f, 0.14887f, 0.144421f, 0.155198f,
+    0.135798f, 0.136346f, 0.128966f, 0.103675f, 0.0829404f,
+    0.332313f, 0.248254f, 0.165711f, 0.152758f, 0.154849f,
+    0.148076f, 0.143682f, 0.154057f, 0.1348f, 0.135424f,
+    0.128068f, 0.102207f, 0.0817659f, 0.330837f, 0.248179f,
+    0.165661f, 0.152719f, 0.154726f, 0.147968f, 0.143585f,
+    0.153846f, 0.134615f, 0.135264f, 0.127933f, 0.101903f,
+    0.0815225f, 1.53392f, 1.15071f, 0.768108f, 0.7081f,
+    0.717406f, 0.68607f, 0.665749f, 0.713322f, 0.624157f,
+    0.627166f, 0.593176f, 0.472479f, 0.377983f, 1.47095f,
+    1.08738f, 0.726124f, 0.668661f, 0.679564f, 0.649872f,
+    0.630453f, 0.677336f, 0.594066f, 0.595123f, 0.563788f,
+    0.454307f, 0.363445f, 1.41894f, 1.04354f, 0.696861f,
+    0.641604f, 0.65268f, 0.62412f, 0.605418f, 0.651023f,
+    0.570944f, 0.571868f, 0.541845f, 0.43796f, 0.350368f,
+    1.35825f, 1.00437f, 0.670529f, 0.617749f, 0.627546f,
+    0.600054f, 0.582137f, 0.625317f, 0.547297f, 0.549428f,
+    0.52004f, 0.418085f, 0.334468f, 1.33042f, 0.993697f,
+    0.663309f, 0.611426f, 0.619885f, 0.592773f, 0.575176f,
+    0.616734f, 0.539642f, 0.542136f, 0.512764f, 0.40938f,
+    0.327504f, 1.3248f, 0.992792f, 0.662695f, 0.610915f,
+    0.619028f, 0.591979f, 0.574437f, 0.615593f, 0.538644f,
+    0.541215f, 0.511867f, 0.407912f, 0.32633f, 1.32332f,
+    0.992718f, 0.662645f, 0.610876f, 0.618905f, 0.591871f,
+    0.57434f, 0.615382f, 0.538459f, 0.541055f, 0.511732f,
+    0.407608f, 0.326086f, 0.152169f, 0.123557f, 0.12007f,
+    0.104397f, 0.0982256f, 0.0961845f, 0.0885343f, 0.0881491f,
+    0.0833255f, 0.0859406f, 0.08325f, 0.063445f, 0.050756f,
+    0.100898f, 0.080131f, 0.0752121f, 0.0647706f, 0.0612837f,
+    0.0604043f, 0.0599556f, 0.0570647f, 0.0541741f, 0.0600187f,
+    0.0561843f, 0.0435714f, 0.0366767f, 0.0660306f, 0.0691944f,
+    0.0656034f, 0.0517753f, 0.0501932f, 0.0506216f, 0.0531251f,
+    0.0506825f, 0.0478327f, 0.0526612f, 0.049473f, 0.0371048f,
+    0.0298956f, 0.0442368f, 0.0432435f, 0.0410067f, 0.0321614f,
+    0.0317543f, 0.03299f, 0.0337291f, 0.0323561f, 0.0301683f,
+    0.033021f, 0.031174f, 0.0233805f, 0.0187044f, 0.0215082f,
+    0.0170077f, 0.0354618f, 0.0236412f, 0.0177309f, 0.0141847f,
+    0.0138403f, 0.0133843f, 0.0122537f, 0.0135614f, 0.0127923f,
+    0.00959421f, 0.00767537f, 0.0171284f, 0.0133338f, 0.0300061f,
+    0.0200041f, 0.015003f, 0.0120024f, 0.010002f, 0.00857317f,
+    0.00750152f, 0.0086679f, 0.00722325f, 0.00541744f, 0.00547566f,
+    0.00603337f, 0.00661652f, 0.0143729f, 0.00958191f, 0.00718643f,
+    0.00574915f, 0.00479095f, 0.00410653f, 0.00359322f, 0.00367718f,
+    0.00306432f, 0.00229824f, 0.00223366f, 0.199974f, 0.162373f,
+    0.157791f, 0.137194f, 0.129084f, 0.126402f, 0.116348f,
+    0.115842f, 0.109503f, 0.11294f, 0.109404f, 0.0833768f,
+    0.0667014f, 0.14855f, 0.118948f, 0.112933f, 0.0975678f,
+    0.0921421f, 0.0906216f, 0.0836272f, 0.0837368f, 0.0791274f,
+    0.0812947f, 0.079199f, 0.0633503f, 0.0506803f, 0.108552f,
+    0.0943904f, 0.0893439f, 0.0706526f, 0.068161f, 0.0684544f,
+    0.0722623f, 0.0688613f, 0.0651896f, 0.0720478f, 0.0675472f,
+    0.0506604f, 0.0426583f, 0.0668351f, 0.0684394f, 0.0647472f,
+    0.0510387f, 0.0497221f, 0.0508227f, 0.0528663f, 0.0505349f,
+    0.0475252f, 0.0524077f, 0.0492482f, 0.0369362f, 0.0295489f,
+    0.0501534f, 0.0422036f, 0.0415642f, 0.0337608f, 0.0318713f,
+    0.0319957f, 0.0329775f, 0.0315631f, 0.0296106f, 0.032948f,
+    0.0308665f, 0.0231499f, 0.0185199f, 0.0480698f, 0.0390225f,
+    0.0378556f, 0.0328974f, 0.0309759f, 0.0303498f, 0.0279357f,
+    0.0278483f, 0.0263186f, 0.0271298f, 0.0262756f, 0.0200153f,
+    0.0160123f, 0.0478055f, 0.0388167f, 0.0377213f, 0.0327972f,
+    0.0308586f, 0.0302175f, 0.027814f, 0.0276933f, 0.0261779f,
+    0.0269994f, 0.026154f, 0.019932f, 0.0159456f, 0.247779f,
+    0.20119f, 0.195513f, 0.169991f, 0.159942f, 0.156619f,
+    0.144162f, 0.143535f, 0.13568f, 0.139939f, 0.135558f,
+    0.103309f, 0.0826469f, 0.196202f, 0.157764f, 0.150654f,
+    0.130365f, 0.123001f, 0.120839f, 0.111441f, 0.11143f,
+    0.105305f, 0.108294f, 0.105353f, 0.0831292f, 0.0665033f,
+    0.156204f, 0.124699f, 0.117983f, 0.101815f, 0.0962693f,
+    0.0947665f, 0.0913996f, 0.0876886f, 0.0828359f, 0.0914344f,
+    0.0856215f, 0.0668156f, 0.0554211f, 0.1136f, 0.0936354f,
+    0.0884877f, 0.0747923f, 0.070725f, 0.0695788f, 0.0720035f,
+    0.0687137f, 0.0648821f, 0.0717943f, 0.0673225f, 0.0504918f,
+    0.0417774f, 0.0978052f, 0.0793068f, 0.0766674f, 0.066558f,
+    0.0627298f, 0.0615114f, 0.0566297f, 0.0565158f, 0.0534003f,
+    0.0550079f, 0.0532953f, 0.0409103f, 0.0327282f, 0.095875f,
+    0.077839f, 0.0755768f, 0.0656946f, 0.0618344f, 0.060567f,
+    0.0557495f, 0.0555412f, 0.0524961f, 0.0541288f, 0.0524293f,
+    0.0399472f, 0.0319577f, 0.0956107f, 0.0776332f, 0.0754425f,
+    0.0655944f, 0.0617171f, 0.0604347f, 0.0556279f, 0.0553862f,
+    0.0523553f, 0.0539984f, 0.0523078f, 0.0398638f, 0.031891f,
+    0.295584f, 0.240006f, 0.233234f, 0.202788f, 0.190801f,
+    0.186836f, 0.171976f, 0.171228f, 0.161858f, 0.166938f,
+    0.161711f, 0.12324f, 0.0985923f, 0.243853f, 0.19658f,
+    0.188376f, 0.163162f, 0.153859f, 0.151056f, 0.139255f,
+    0.139123f, 0.131482f, 0.135293f, 0.131507f, 0.102908f,
+    0.0823265f, 0.203855f, 0.163516f, 0.155704f, 0.134612f,
+    0.127128f, 0.124984f, 0.115273f, 0.115382f, 0.109013f,
+    0.112038f, 0.108998f, 0.0865945f, 0.0692756f, 0.161251f,
+    0.129794f, 0.124271f, 0.107589f, 0.101584f, 0.0997961f,
+    0.0919599f, 0.0919843f, 0.086892f, 0.0911809f, 0.0867513f,
+    0.0680921f, 0.0545402f, 0.145506f, 0.118123f, 0.114389f,
+    0.0993551f, 0.0935882f, 0.0917286f, 0.0844435f, 0.0842087f,
+    0.0795778f, 0.0820069f, 0.0794491f, 0.0606891f, 0.0485513f,
+    0.14368f, 0.116655f, 0.113298f, 0.0984917f, 0.0926929f,
+    0.0907842f, 0.0835634f, 0.083234f, 0.0786736f, 0.0811279f,
+    0.0785831f, 0.059879f, 0.0479032f, 0.143416f, 0.11645f,
+    0.113164f, 0.0983915f, 0.0925756f, 0.0906519f, 0.0834418f,
+    0.083079f, 0.0785328f, 0.0809974f, 0.0784615f, 0.0597956f,
+    0.0478365f, 0.391194f, 0.317639f, 0.308676f, 0.268382f,
+    0.252518f, 0.247271f, 0.227604f, 0.226613f, 0.214213f,
+    0.220936f, 0.214019f, 0.163104f, 0.130483f, 0.339157f,
+    0.274213f, 0.263818f, 0.228756f, 0.215576f, 0.211491f,
+    0.194883f, 0.194508f, 0.183837f, 0.189291f, 0.183814f,
+    0.142466f, 0.113973f, 0.299159f, 0.241149f, 0.231146f,
+    0.200207f, 0.188845f, 0.185418f, 0.170901f, 0.170767f,
+    0.161368f, 0.166036f, 0.161306f, 0.126152f, 0.100922f,
+    0.256555f, 0.207427f, 0.199714f, 0.173184f, 0.1633f,
+    0.160231f, 0.147588f, 0.14737f, 0.139247f, 0.143361f,
+    0.139059f, 0.10765f, 0.0861199f, 0.241116f, 0.195756f,
+    0.189831f, 0.164949f, 0.155305f, 0.152163f, 0.140071f,
+    0.139594f, 0.131933f, 0.136005f, 0.131757f, 0.100363f,
+    0.0802907f, 0.23929f, 0.194288f, 0.18874f, 0.164086f,
+    0.15441f, 0.151219f, 0.139191f, 0.13862f, 0.131028f,
+    0.135126f, 0.130891f, 0.0997427f, 0.0797941f, 0.239026f,
+    0.194083f, 0.188606f, 0.163986f, 0.154292f, 0.151086f,
+    0.139069f, 0.138465f, 0.130888f, 0.134995f, 0.130769f,
+    0.0996593f, 0.0797274f, 1.10827f, 0.899886f, 0.874494f,
+    0.760339f, 0.715395f, 0.700529f, 0.644812f, 0.642006f,
+    0.606875f, 0.625921f, 0.606326f, 0.462081f, 0.369665f,
+    1.05515f, 0.856461f, 0.829636f, 0.720713f, 0.678453f,
+    0.664749f, 0.612091f, 0.609901f, 0.576499f, 0.594276f,
+    0.576121f, 0.439149f, 0.351319f, 1.01439f, 0.823396f,
+    0.796964f, 0.692164f, 0.651722f, 0.638677f, 0.588109f,
+    0.58616f, 0.55403f, 0.571021f, 0.553612f, 0.422835f,
+    0.338268f, 0.972649f, 0.789675f, 0.765531f, 0.665141f,
+    0.626177f, 0.613489f, 0.564796f, 0.562763f, 0.531909f,
+    0.548347f, 0.531366f, 0.404741f, 0.323793f, 0.958194f,
+    0.778003f, 0.755649f, 0.656906f, 0.618182f, 0.605422f,
+    0.557279f, 0.554987f, 0.524594f, 0.54099f, 0.524063f,
+    0.399341f, 0.319473f, 0.956368f, 0.776535f, 0.754558f,
+    0.656043f, 0.617287f, 0.604477f, 0.556399f, 0.554012f,
+    0.52369f, 0.540111f, 0.523197f, 0.39872f, 0.318976f,
+    0.956104f, 0.77633f, 0.754424f, 0.655943f, 0.617169f,
+    0.604345f, 0.556277f, 0.553858f, 0.52355f, 0.539981f,
+    0.523076f, 0.398637f, 0.318909f, 0.14099f, 0.0970363f,
+    0.107017f, 0.0944681f, 0.0889969f, 0.0870484f, 0.0835753f,
+    0.0823354f, 0.0818803f, 0.0832646f, 0.0841042f, 0.0630782f,
+    0.0504625f, 0.0879891f, 0.0615192f, 0.0680621f, 0.0606537f,
+    0.0601023f, 0.0597558f, 0.0619152f, 0.0628986f, 0.0617848f,
+    0.0611284f, 0.056958f, 0.0427185f, 0.0346309f, 0.0496138f,
+    0.0461845f, 0.048157f, 0.0496092f, 0.0527204f, 0.0523404f,
+    0.0544705f, 0.0551408f, 0.0547814f, 0.0532788f, 0.0502308f,
+    0.0376731f, 0.0301385f, 0.0229744f, 0.026646f, 0.0291913f,
+    0.0312695f, 0.0323645f, 0.0320522f, 0.0337403f, 0.0338945f,
+    0.0348425f, 0.0328281f, 0.0318142f, 0.0238607f, 0.0190885f,
+    0.0215409f, 0.0174203f, 0.0144803f, 0.0132162f, 0.0120633f,
+    0.011909f, 0.0128673f, 0.0127513f, 0.0143615f, 0.0129759f,
+    0.0132553f, 0.0099415f, 0.00918348f, 0.0192237f, 0.0130092f,
+    0.0135229f, 0.0121597f, 0.00911979f, 0.00820834f, 0.00872127f,
+    0.00818311f, 0.00716022f, 0.00897757f, 0.00748131f, 0.00578807f,
+    0.00745488f, 0.00989805f, 0.00615002f, 0.00827648f, 0.007078f,
+    0.0053085f, 0.0044595f, 0.00429541f, 0.00386855f, 0.00338498f,
+    0.00367352f, 0.00306127f, 0.00229595f, 0.00299005f, 0.185283f,
+    0.127521f, 0.140638f, 0.124146f, 0.116956f, 0.114395f,
+    0.109831f, 0.108202f, 0.107604f, 0.109423f, 0.110526f,
+    0.0828947f, 0.0663158f, 0.132282f, 0.0920041f, 0.101683f,
+    0.0903317f, 0.0846225f, 0.0823714f, 0.0817662f, 0.0831332f,
+    0.081496f, 0.0809849f, 0.0790809f, 0.0611693f, 0.0489354f,
+    0.093907f, 0.0657087f, 0.072798f, 0.0673393f, 0.0720295f,
+    0.0715697f, 0.0743215f, 0.0753754f, 0.0744925f, 0.0731353f,
+    0.0685378f, 0.0514034f, 0.0411227f, 0.0571806f, 0.0444403f,
+    0.0469599f, 0.0489997f, 0.0516736f, 0.0512816f, 0.0535914f,
+    0.0541292f, 0.0545536f, 0.0526846f, 0.0501213f, 0.0375909f,
+    0.0300728f, 0.0456991f, 0.031551f, 0.0349147f, 0.0310039f,
+    0.0313724f, 0.0311384f, 0.0327183f, 0.0329859f, 0.0340726f,
+    0.0328324f, 0.0315623f, 0.0236718f, 0.0189374f, 0.0444438f,
+    0.0306028f, 0.0337822f, 0.0298677f, 0.0281161f, 0.0274535f,
+    0.02639f, 0.0259707f, 0.0258216f, 0.0262857f, 0.0265166f,
+    0.0198874f, 0.0159099f, 0.0442933f, 0.030485f, 0.0336207f,
+    0.0296786f, 0.0279597f, 0.0273472f, 0.0262563f, 0.0258666f,
+    0.0257236f, 0.0261587f, 0.0264222f, 0.0198167f, 0.0158533f,
+    0.229576f, 0.158006f, 0.174258f, 0.153824f, 0.144915f,
+    0.141743f, 0.136087f, 0.134068f, 0.133327f, 0.135581f,
+    0.136948f, 0.102711f, 0.0821691f, 0.176575f, 0.122489f,
+    0.135303f, 0.12001f, 0.112582f, 0.109719f, 0.105509f,
+    0.103849f, 0.104315f, 0.104872f, 0.105503f, 0.080297f,
+    0.0642376f, 0.1382f, 0.0961935f, 0.106418f, 0.0947083f,
+    0.0913385f, 0.0907992f, 0.0941726f, 0.09561f, 0.0942037f,
+    0.0929918f, 0.0868449f, 0.0651336f, 0.0523399f, 0.101474f,
+    0.0703856f, 0.0779291f, 0.069359f, 0.0709826f, 0.070511f,
+    0.0734424f, 0.0743638f, 0.0742648f, 0.072541f, 0.0684283f,
+    0.0513212f, 0.041057f, 0.0899923f, 0.0620358f, 0.0685351f,
+    0.060682f, 0.0570647f, 0.0556248f, 0.0535306f, 0.0532205f,
+    0.0537838f, 0.0532933f, 0.0536954f, 0.0402715f, 0.0322172f,
+    0.0887369f, 0.0610876f, 0.0674026f, 0.0595457f, 0.0560753f,
+    0.0548005f, 0.0526459f, 0.0518372f, 0.0515451f, 0.052444f,
+    0.0529387f, 0.039704f, 0.0317632f, 0.0885865f, 0.0609698f,
+    0.0672411f, 0.0593567f, 0.0559189f, 0.0546943f, 0.0525123f,
+    0.051733f, 0.0514471f, 0.052317f, 0.0528443f, 0.0396333f,
+    0.0317066f, 0.273869f, 0.188491f, 0.207878f, 0.183502f,
+    0.172874f, 0.16909f, 0.162343f, 0.159935f, 0.159051f,
+    0.16174f, 0.163371f, 0.122528f, 0.0980223f, 0.220869f,
+    0.152974f, 0.168923f, 0.149688f, 0.140541f, 0.137066f,
+    0.131765f, 0.129715f, 0.129817f, 0.131031f, 0.131925f,
+    0.0994247f, 0.0795398f, 0.182493f, 0.126678f, 0.140039f,
+    0.124386f, 0.116581f, 0.113404f, 0.114024f, 0.115845f,
+    0.113915f, 0.112848f, 0.109018f, 0.0836383f, 0.0669106f,
+    0.145767f, 0.10087f, 0.11155f, 0.0990371f, 0.0929121f,
+    0.0903295f, 0.0932934f, 0.0945984f, 0.093976f, 0.0923975f,
+    0.0870085f, 0.0658053f, 0.0526442f, 0.134285f, 0.0925207f,
+    0.102156f, 0.09036f, 0.0850239f, 0.0829719f, 0.0797866f,
+    0.0784998f, 0.0780372f, 0.0794517f, 0.0801175f, 0.0600881f,
+    0.0480705f, 0.13303f, 0.0915725f, 0.101023f, 0.0892237f,
+    0.0840345f, 0.0821476f, 0.0789019f, 0.0777036f, 0.0772685f,
+    0.0786024f, 0.0793608f, 0.0595206f, 0.0476165f, 0.13288f,
+    0.0914546f, 0.100862f, 0.0890347f, 0.0838781f, 0.0820414f,
+    0.0787682f, 0.0775995f, 0.0771705f, 0.0784754f, 0.0792665f,
+    0.0594498f, 0.0475599f, 0.362455f, 0.249461f, 0.275119f,
+    0.242858f, 0.228793f, 0.223784f, 0.214855f, 0.211668f,
+    0.210498f, 0.214056f, 0.216215f, 0.162161f, 0.129729f,
+    0.309455f, 0.213943f, 0.236164f, 0.209044f, 0.196459f,
+    0.19176f, 0.184277f, 0.181448f, 0.180823f, 0.183348f,
+    0.184769f, 0.138577f, 0.110862f, 0.27108f, 0.187648f,
+    0.20728f, 0.183742f, 0.172499f, 0.168098f, 0.161709f,
+    0.159096f, 0.159054f, 0.160812f, 0.161863f, 0.121894f,
+    0.097515f, 0.234353f, 0.16184f, 0.17879f, 0.158393f,
+    0.14883f, 0.145024f, 0.139567f, 0.137246f, 0.136482f,
+    0.138873f, 0.139853f, 0.10489f, 0.0839117f, 0.222872f,
+    0.15349f, 0.169396f, 0.149716f, 0.140942f, 0.137666f,
+    0.132298f, 0.130233f, 0.129484f, 0.131768f, 0.132962f,
+    0.0997213f, 0.079777f, 0.221616f, 0.152542f, 0.168264f,
+    0.14858f, 0.139953f, 0.136842f, 0.131414f, 0.129437f,
+    0.128715f, 0.130919f, 0.132205f, 0.0991538f, 0.079323f,
+    0.221466f, 0.152424f, 0.168102f, 0.148391f, 0.139796f,
+    0.136736f, 0.13128f, 0.129332f, 0.128617f, 0.130792f,
+    0.132111f, 0.099083f, 0.0792664f, 1.02685f, 0.706733f,
+    0.779426f, 0.688029f, 0.648181f, 0.63399f, 0.608695f,
+    0.599664f, 0.596349f, 0.606432f, 0.612547f, 0.45941f,
+    0.367528f, 0.973852f, 0.671216f, 0.740471f, 0.654214f,
+    0.615847f, 0.601966f, 0.578116f, 0.569445f, 0.566162f,
+    0.575723f, 0.581101f, 0.435826f, 0.348661f, 0.935477f,
+    0.644921f, 0.711586f, 0.628913f, 0.591888f, 0.578304f,
+    0.555549f, 0.547093f, 0.543896f, 0.553187f, 0.558194f,
+    0.418646f, 0.334917f, 0.898751f, 0.619113f, 0.683097f,
+    0.603564f, 0.568218f, 0.55523f, 0.533406f, 0.525242f,
+    0.522227f, 0.531248f, 0.536185f, 0.402138f, 0.321711f,
+    0.887269f, 0.610763f, 0.673703f, 0.594887f, 0.56033f,
+    0.547872f, 0.526138f, 0.518229f, 0.515336f, 0.524144f,
+    0.529293f, 0.39697f, 0.317576f, 0.886014f, 0.609815f,
+    0.672571f, 0.59375f, 0.559341f, 0.547048f, 0.525253f,
+    0.517433f, 0.514567f, 0.523294f, 0.528537f, 0.396403f,
+    0.317122f, 0.885863f, 0.609697f, 0.672409f, 0.593561f,
+    0.559184f, 0.546942f, 0.52512f, 0.517329f, 0.514469f,
+    0.523167f, 0.528443f, 0.396332f, 0.317066f, 0.121621f,
+    0.0958894f, 0.0896788f, 0.0893597f, 0.0882924f, 0.0870832f,
+    0.0846333f, 0.081401f, 0.0792513f, 0.0841754f, 0.0818956f,
+    0.0614217f, 0.0491373f, 0.0775545f, 0.0605251f, 0.0648675f,
+    0.0600807f, 0.0662442f, 0.0618901f, 0.0609151f, 0.0597375f,
+    0.0577451f, 0.0610858f, 0.0549872f, 0.0415927f, 0.0334805f,
+    0.0554141f, 0.0525715f, 0.05792f, 0.0535039f, 0.0591006f,
+    0.0552263f, 0.0543079f, 0.0531489f, 0.0513894f, 0.0534456f,
+    0.0488759f, 0.036657f, 0.0293256f, 0.0365008f, 0.032567f,
+    0.0368643f, 0.033968f, 0.0377493f, 0.0353038f, 0.0346648f,
+    0.033852f, 0.0328728f, 0.0335185f, 0.0318634f, 0.0238976f,
+    0.019118f, 0.0151818f, 0.0122394f, 0.0145549f, 0.0135073f,
+    0.0152169f, 0.0142428f, 0.0139445f, 0.0136288f, 0.0134485f,
+    0.0137841f, 0.0141498f, 0.0106124f, 0.0084899f, 0.0058777f,
+    0.00423647f, 0.00663904f, 0.00697083f, 0.00698537f, 0.00655793f,
+    0.00602198f, 0.00625758f, 0.00547538f, 0.00911193f, 0.00759327f,
+    0.00569496f, 0.00645311f, 0.000314509f, 0.000947133f, 0.0032474f,
+    0.00388882f, 0.0045539f, 0.00412427f, 0.00395452f, 0.00384445f,
+    0.00336389f, 0.0040497f, 0.00337475f, 0.00253106f, 0.00230269f,
+    0.159829f, 0.126014f, 0.117852f, 0.117433f, 0.11603f,
+    0.114441f, 0.111222f, 0.106974f, 0.104149f, 0.11062f,
+    0.107624f, 0.0807179f, 0.0645743f, 0.115763f, 0.0906497f,
+    0.0853425f, 0.0842063f, 0.0872031f, 0.0821652f, 0.0802106f,
+    0.0791733f, 0.0770812f, 0.0809348f, 0.0773449f, 0.0600832f,
+    0.0480665f, 0.0830967f, 0.0715781f, 0.078395f, 0.072531f,
+    0.0800596f, 0.0748091f, 0.0736033f, 0.0721233f, 0.0697488f,
+    0.0732946f, 0.0665016f, 0.0498762f, 0.039901f, 0.0554284f,
+    0.0515736f, 0.0573393f, 0.0529951f, 0.0587082f, 0.0548866f,
+    0.0539602f, 0.0528265f, 0.0512321f, 0.0533675f, 0.0494891f,
+    0.0371168f, 0.0296935f, 0.0398975f, 0.031246f, 0.0350299f,
+    0.0325344f, 0.0361758f, 0.0338256f, 0.0332399f, 0.0326032f,
+    0.0318078f, 0.033633f, 0.0317755f, 0.0238316f, 0.0190653f,
+    0.0384692f, 0.0302523f, 0.028297f, 0.0281936f, 0.0278426f,
+    0.0274565f, 0.0266972f, 0.0256777f, 0.0250782f, 0.0265596f,
+    0.0258306f, 0.0193729f, 0.0154983f, 0.0382097f, 0.0301249f,
+    0.0281738f, 0.0280735f, 0.0277381f, 0.0273582f, 0.0265885f,
+    0.0255731f, 0.0248988f, 0.0264447f, 0.0257284f, 0.0192963f,
+    0.015437f, 0.198038f, 0.156138f, 0.146026f, 0.145506f,
+    0.143768f, 0.141799f, 0.13781f, 0.132547f, 0.129046f,
+    0.137064f, 0.133352f, 0.100014f, 0.0800112f, 0.153971f,
+    0.120774f, 0.112809f, 0.112279f, 0.111014f, 0.109424f,
+    0.106739f, 0.104565f, 0.101979f, 0.106378f, 0.103073f,
+    0.0788558f, 0.0630846f, 0.121305f, 0.0947175f, 0.09887f,
+    0.0915581f, 0.101018f, 0.0943919f, 0.0928987f, 0.0910978f,
+    0.0881081f, 0.0931436f, 0.0841273f, 0.0634439f, 0.0507551f,
+    0.0889849f, 0.0705802f, 0.0778143f, 0.0720222f, 0.0796672f,
+    0.0744694f, 0.0732556f, 0.0718009f, 0.0695914f, 0.0732165f,
+    0.0671148f, 0.0503361f, 0.0402689f, 0.0781058f, 0.0612954f,
+    0.0573337f, 0.0571196f, 0.0571348f, 0.055587f, 0.0541043f,
+    0.0520392f, 0.0510114f, 0.0538507f, 0.0523355f, 0.0392516f,
+    0.0314013f, 0.0766775f, 0.0603768f, 0.0564704f, 0.0562668f,
+    0.0555805f, 0.0548145f, 0.0532855f, 0.0512506f, 0.0499758f,
+    0.0530041f, 0.0515588f, 0.0386691f, 0.0309353f, 0.076418f,
+    0.0602494f, 0.0563472f, 0.0561467f, 0.0554759f, 0.0547162f,
+    0.0531769f, 0.051146f, 0.0497964f, 0.0528892f, 0.0514567f,
+    0.0385925f, 0.030874f, 0.236246f, 0.186263f, 0.174199f,
+    0.173579f, 0.171506f, 0.169157f, 0.164398f, 0.15812f,
+    0.153944f, 0.163509f, 0.15908f, 0.11931f, 0.0954482f,
+    0.19218f, 0.150899f, 0.140983f, 0.140353f, 0.138752f,
+    0.136683f, 0.133327f, 0.129957f, 0.126876f, 0.132822f,
+    0.128801f, 0.0976284f, 0.0781409f, 0.159513f, 0.124842f,
+    0.119345f, 0.116074f, 0.121977f, 0.113975f, 0.112194f,
+    0.110072f, 0.106467f, 0.112993f, 0.106548f, 0.0821827f,
+    0.0657462f, 0.127193f, 0.099498f, 0.0982894f, 0.0926323f,
+    0.100626f, 0.0940521f, 0.0925511f, 0.0907754f, 0.0879508f,
+    0.0930655f, 0.0849417f, 0.064681f, 0.0517448f, 0.116314f,
+    0.09142f, 0.0855071f, 0.0851928f, 0.0841304f, 0.082945f,
+    0.0806926f, 0.0776121f, 0.075909f, 0.0802952f, 0.0780638f,
+    0.0585478f, 0.0468382f, 0.114886f, 0.0905013f, 0.0846438f,
+    0.08434f, 0.0833184f, 0.0821725f, 0.0798738f, 0.0768235f,
+    0.0748733f, 0.0794486f, 0.0772871f, 0.0579653f, 0.0463722f,
+    0.114626f, 0.0903739f, 0.0845207f, 0.0842199f, 0.0832138f,
+    0.0820741f, 0.0797652f, 0.0767189f, 0.0746939f, 0.0793336f,
+    0.0771849f, 0.0578887f, 0.046311f, 0.312663f, 0.246512f,
+    0.230546f, 0.229726f, 0.226982f, 0.223873f, 0.217575f,
+    0.209266f, 0.203739f, 0.216398f, 0.210537f, 0.157903f,
+    0.126322f, 0.268596f, 0.211148f, 0.197329f, 0.196499f,
+    0.194228f, 0.191201f, 0.186504f, 0.180741f, 0.176671f,
+    0.185711f, 0.180258f, 0.135193f, 0.108609f, 0.23593f,
+    0.185091f, 0.17297f, 0.17222f, 0.170192f, 0.167655f,
+    0.163526f, 0.159243f, 0.155539f, 0.162909f, 0.158004f,
+    0.119728f, 0.0957947f, 0.20361f, 0.159747f, 0.149368f,
+    0.148779f, 0.146939f, 0.144724f, 0.141072f, 0.136435f,
+    0.133515f, 0.140475f, 0.136398f, 0.102299f, 0.0820672f,
+    0.192731f, 0.151669f, 0.141854f, 0.141339f, 0.139606f,
+    0.137661f, 0.133869f, 0.128758f, 0.125704f, 0.133184f,
+    0.12952f, 0.0971402f, 0.0777122f, 0.191302f, 0.15075f,
+    0.140991f, 0.140486f, 0.138794f, 0.136888f, 0.133051f,
+    0.127969f, 0.124668f, 0.132337f, 0.128744f, 0.0965577f,
+    0.0772461f, 0.191043f, 0.150623f, 0.140868f, 0.140366f,
+    0.13869f, 0.13679f, 0.132942f, 0.127865f, 0.124489f,
+    0.132223f, 0.128641f, 0.0964811f, 0.0771849f, 0.885788f,
+    0.69838f, 0.653148f, 0.650823f, 0.64305f, 0.634243f,
+    0.6164f, 0.592859f, 0.577202f, 0.613065f, 0.596461f,
+    0.447345f, 0.357877f, 0.841721f, 0.663016f, 0.619931f,
+    0.617597f, 0.610296f, 0.601543f, 0.585329f, 0.56298f,
+    0.550135f, 0.582378f, 0.566182f, 0.424636f, 0.339709f,
+    0.809055f, 0.636959f, 0.595571f, 0.593318f, 0.58626f,
+    0.577803f, 0.562351f, 0.540882f, 0.529002f, 0.559577f,
+    0.543928f, 0.407946f, 0.326357f, 0.776735f, 0.611615f,
+    0.57197f, 0.569876f, 0.563006f, 0.555093f, 0.539897f,
+    0.519283f, 0.506979f, 0.537142f, 0.522322f, 0.391741f,
+    0.313393f, 0.765856f, 0.603537f, 0.564455f, 0.562437f,
+    0.555674f, 0.548031f, 0.532694f, 0.512351f, 0.499167f,
+    0.529851f, 0.515444f, 0.386583f, 0.309266f, 0.764427f,
+    0.602618f, 0.563592f, 0.561584f, 0.554862f, 0.547259f,
+    0.531875f, 0.511563f, 0.498132f, 0.529005f, 0.514667f,
+    0.386f, 0.3088f, 0.764168f, 0.602491f, 0.563469f,
+    0.561464f, 0.554758f, 0.54716f, 0.531767f, 0.511458f,
+    0.497952f, 0.528889f, 0.514565f, 0.385924f, 0.308739f,
+    0.104204f, 0.0947969f, 0.0894832f, 0.0883953f, 0.0870369f,
+    0.0854913f, 0.0827588f, 0.0807963f, 0.0784519f, 0.0815819f,
+    0.0769664f, 0.0577247f, 0.0461798f, 0.0688014f, 0.0666782f,
+    0.0637418f, 0.0619692f, 0.0617746f, 0.0616987f, 0.0609196f,
+    0.0591915f, 0.0570827f, 0.0602534f, 0.0539107f, 0.040433f,
+    0.0323464f, 0.0612621f, 0.0591695f, 0.0568915f, 0.055361f,
+    0.0551503f, 0.0551042f, 0.054579f, 0.0530945f, 0.0511721f,
+    0.0525266f, 0.0479815f, 0.0359861f, 0.0287889f, 0.0385347f,
+    0.0370806f, 0.0361012f, 0.0353026f, 0.0351904f, 0.0353691f,
+    0.0355225f, 0.0348625f, 0.0337203f, 0.033634f, 0.0323416f,
+    0.0242562f, 0.019405f, 0.0146705f, 0.0141789f, 0.0140676f,
+    0.0139549f, 0.0139705f, 0.0143381f, 0.0149702f, 0.0151362f,
+    0.0148432f, 0.0149604f, 0.0158547f, 0.011891f, 0.00951279f,
+    0.00633678f, 0.00497655f, 0.00523213f, 0.00550919f, 0.00511333f,
+    0.00542848f, 0.00670674f, 0.00705077f, 0.00661635f, 0.00911412f,
+    0.00800661f, 0.00600497f, 0.00540213f, 0.00143552f, 0.00116239f,
+    0.00456385f, 0.00463252f, 0.00422421f, 0.00445104f, 0.00483683f,
+    0.00469887f, 0.00426085f, 0.00417046f, 0.00347539f, 0.00260654f,
+    0.00208523f, 0.136941f, 0.124578f, 0.117595f, 0.116166f,
+    0.11438f, 0.112349f, 0.108758f, 0.106179f, 0.103098f,
+    0.107212f, 0.101146f, 0.0758596f, 0.0606876f, 0.0988045f,
+    0.0896319f, 0.0845028f, 0.0840608f, 0.0823352f, 0.0812286f,
+    0.0801925f, 0.0785934f, 0.0754009f, 0.0801174f, 0.0735454f,
+    0.0573263f, 0.0458611f, 0.0829995f, 0.0803263f, 0.0770095f,
+    0.0749218f, 0.0746778f, 0.074634f, 0.0738518f, 0.0718369f,
+    0.0692904f, 0.0723906f, 0.0654489f, 0.0490867f, 0.0392694f,
+    0.0602721f, 0.0582374f, 0.0562191f, 0.0548633f, 0.0547179f,
+    0.054899f, 0.0547954f, 0.0536048f, 0.0518386f, 0.053498f,
+    0.049809f, 0.0373568f, 0.0298854f, 0.0364079f, 0.0353357f,
+    0.0341856f, 0.0335157f, 0.033498f, 0.0338681f, 0.034243f,
+    0.0338785f, 0.0329615f, 0.0348244f, 0.0333221f, 0.0249916f,
+    0.0199932f, 0.0328688f, 0.0299047f, 0.0282255f, 0.0279169f,
+    0.027461f, 0.0269688f, 0.0261098f, 0.0255453f, 0.0247525f,
+    0.0266229f, 0.025474f, 0.0191055f, 0.0152844f, 0.0327368f,
+    0.0297815f, 0.0281122f, 0.0277707f, 0.0273437f, 0.0268581f,
+    0.0259997f, 0.0253835f, 0.0246466f, 0.0256299f, 0.0241799f,
+    0.0181349f, 0.0145079f, 0.169677f, 0.15436f, 0.145707f,
+    0.143936f, 0.141724f, 0.139207f, 0.134758f, 0.131562f,
+    0.127745f, 0.132841f, 0.125326f, 0.0939943f, 0.0751955f,
+    0.131541f, 0.119413f, 0.112615f, 0.111831f, 0.109679f,
+    0.107658f, 0.104408f, 0.103976f, 0.0998302f, 0.103457f,
+    0.097693f, 0.0751418f, 0.0601134f, 0.104737f, 0.101483f,
+    0.0971275f, 0.0944825f, 0.0942053f, 0.094164f, 0.0931247f,
+    0.0905791f, 0.0874087f, 0.0922546f, 0.0829163f, 0.0621873f,
+    0.0497498f, 0.0820095f, 0.0793942f, 0.0763371f, 0.0744241f,
+    0.0742454f, 0.0744289f, 0.0740682f, 0.0723472f, 0.0699569f,
+    0.0733619f, 0.0672764f, 0.0504574f, 0.0403658f, 0.0666255f,
+    0.0606051f, 0.0571909f, 0.0566348f, 0.0556543f, 0.0546475f,
+    0.0535159f, 0.0526208f, 0.0510798f, 0.0546884f, 0.0507895f,
+    0.0380921f, 0.0304737f, 0.0656055f, 0.0596861f, 0.0563375f,
+    0.0556871f, 0.0548045f, 0.0538267f, 0.0521092f, 0.0509282f,
+    0.0493989f, 0.0513768f, 0.0484712f, 0.0363534f, 0.0290827f,
+    0.0654735f, 0.0595629f, 0.0562242f, 0.0555409f, 0.0546871f,
+    0.053716f, 0.0519991f, 0.0507664f, 0.049293f, 0.0512597f,
+    0.0483596f, 0.0362697f, 0.0290157f, 0.202414f, 0.184141f,
+    0.173819f, 0.171706f, 0.169067f, 0.166065f, 0.160757f,
+    0.156945f, 0.152391f, 0.158471f, 0.149505f, 0.112129f,
+    0.0897033f, 0.164278f, 0.149195f, 0.140727f, 0.139601f,
+    0.137022f, 0.134516f, 0.130408f, 0.129359f, 0.124259f,
+    0.129086f, 0.121873f, 0.0929572f, 0.0743657f, 0.136018f,
+    0.123472f, 0.117245f, 0.115734f, 0.113733f, 0.113694f,
+    0.112398f, 0.109322f, 0.105527f, 0.112119f, 0.101078f,
+    0.0784866f, 0.0627893f, 0.108306f, 0.100551f, 0.0964551f,
+    0.0939848f, 0.0937729f, 0.0939588f, 0.0933411f, 0.0910896f,
+    0.0880752f, 0.093226f, 0.0847438f, 0.0635579f, 0.0508463f,
+    0.0993622f, 0.0903864f, 0.0853029f, 0.084405f, 0.0829978f,
+    0.0815054f, 0.078921f, 0.0773452f, 0.0748277f, 0.0778607f,
+    0.0734627f, 0.055097f, 0.0440776f, 0.0983421f, 0.0894674f,
+    0.0844495f, 0.0834573f, 0.0821479f, 0.0806846f, 0.0781087f,
+    0.0763111f, 0.0740453f, 0.0770065f, 0.0726509f, 0.0544882f,
+    0.0435905f, 0.0982101f, 0.0893442f, 0.0843362f, 0.0833111f,
+    0.0820305f, 0.0805739f, 0.0779985f, 0.0761493f, 0.0739394f,
+    0.0768893f, 0.0725393f, 0.0544045f, 0.0435236f, 0.267887f,
+    0.243704f, 0.230043f, 0.227246f, 0.223754f, 0.219781f,
+    0.212756f, 0.207711f, 0.201684f, 0.20973f, 0.197865f,
+    0.148399f, 0.118719f, 0.229751f, 0.208757f, 0.196951f,
+    0.195142f, 0.191709f, 0.188232f, 0.182406f, 0.180125f,
+    0.173118f, 0.180346f, 0.170232f, 0.128588f, 0.10287f,
+    0.201491f, 0.183035f, 0.172642f, 0.171274f, 0.168089f,
+    0.165012f, 0.159955f, 0.15857f, 0.152371f, 0.158297f,
+    0.149437f, 0.114117f, 0.0912939f, 0.173779f, 0.157982f,
+    0.149046f, 0.147713f, 0.145069f, 0.142431f, 0.137992f,
+    0.136078f, 0.130896f, 0.136359f, 0.128688f, 0.0974724f,
+    0.0779779f, 0.164835f, 0.149949f, 0.141527f, 0.139945f,
+    0.137685f, 0.135221f, 0.13092f, 0.128111f, 0.124121f,
+    0.12912f, 0.121822f, 0.0913666f, 0.0730932f, 0.163815f,
+    0.14903f, 0.140673f, 0.138998f, 0.136835f, 0.1344f,
+    0.130107f, 0.127077f, 0.123338f, 0.128266f, 0.12101f,
+    0.0907577f, 0.0726061f, 0.163683f, 0.148907f, 0.14056f,
+    0.138852f, 0.136717f, 0.13429f, 0.129997f, 0.126915f,
+    0.123232f, 0.128149f, 0.120899f, 0.090674f, 0.0725392f,
+    0.758937f, 0.690423f, 0.651723f, 0.6438f, 0.633906f,
+    0.62265f, 0.602747f, 0.588454f, 0.57138f, 0.594176f,
+    0.56056f, 0.42042f, 0.336336f, 0.720801f, 0.655477f,
+    0.618631f, 0.611695f, 0.601861f, 0.5911f, 0.572398f,
+    0.560869f, 0.542763f, 0.564791f, 0.532927f, 0.399695f,
+    0.319757f, 0.692541f, 0.629755f, 0.594322f, 0.587828f,
+    0.57824f, 0.56788f, 0.549947f, 0.539314f, 0.521499f,
+    0.542742f, 0.512132f, 0.384099f, 0.30728f, 0.664829f,
+    0.604702f, 0.570726f, 0.564267f, 0.555221f, 0.545299f,
+    0.527983f, 0.516821f, 0.500592f, 0.520804f, 0.491384f,
+    0.368538f, 0.29483f, 0.655885f, 0.596669f, 0.563207f,
+    0.556499f, 0.547836f, 0.53809f, 0.520911f, 0.508855f,
+    0.493817f, 0.513566f, 0.484518f, 0.363388f, 0.290711f,
+    0.654865f, 0.59575f, 0.562353f, 0.555551f, 0.546986f,
+    0.537269f, 0.520099f, 0.50782f, 0.493034f, 0.512712f,
+    0.483706f, 0.362779f, 0.290223f, 0.654733f, 0.595627f,
+    0.56224f, 0.555405f, 0.546869f, 0.537158f, 0.519989f,
+    0.507659f, 0.492928f, 0.512594f, 0.483594f, 0.362696f,
+    0.290156f, 0.0920362f, 0.0899113f, 0.0873785f, 0.087817f,
+    0.0866028f, 0.0846367f, 0.0821528f, 0.0778804f, 0.0760806f,
+    0.0751746f, 0.0684775f, 0.0513581f, 0.0410865f, 0.071683f,
+    0.0671756f, 0.068356f, 0.0654934f, 0.0645618f, 0.061839f,
+    0.060004f, 0.0578178f, 0.0555368f, 0.0571194f, 0.0492317f,
+    0.0369237f, 0.029539f, 0.0629782f, 0.0591627f, 0.0603397f,
+    0.0579066f, 0.0570992f, 0.054687f, 0.0531233f, 0.0512681f,
+    0.0492221f, 0.0488614f, 0.0427328f, 0.0320496f, 0.0256397f,
+    0.0388742f, 0.0367262f, 0.0377251f, 0.0364554f, 0.0362533f,
+    0.0350017f, 0.0343938f, 0.0336048f, 0.0325474f, 0.0313194f,
+    0.0285213f, 0.021391f, 0.0171128f, 0.0147496f, 0.0140738f,
+    0.01466f, 0.0143995f, 0.0147438f, 0.0146478f, 0.0149158f,
+    0.0151079f, 0.0151204f, 0.0149297f, 0.0148354f, 0.0111266f,
+    0.00890125f, 0.0054388f, 0.00506384f, 0.00533871f, 0.00534566f,
+    0.0059621f, 0.00590604f, 0.00741514f, 0.00731654f, 0.00768183f,
+    0.00956318f, 0.0083352f, 0.0062514f, 0.00500112f, 0.00107635f,
+    0.00186705f, 0.00166541f, 0.00318621f, 0.00481638f, 0.00441253f,
+    0.00485546f, 0.00453888f, 0.0043274f, 0.00395258f, 0.00329381f,
+    0.00247036f, 0.00197629f, 0.12095f, 0.118158f, 0.114829f,
+    0.115406f, 0.11381f, 0.111226f, 0.107962f, 0.102347f,
+    0.0999821f, 0.0987914f, 0.0899903f, 0.0674928f, 0.0539942f,
+    0.0946877f, 0.0886873f, 0.0902196f, 0.0864382f, 0.0852617f,
+    0.0817261f, 0.0793443f, 0.0764875f, 0.0735406f, 0.0765922f,
+    0.0665908f, 0.0514258f, 0.0411406f, 0.0859829f, 0.0806744f,
+    0.0822032f, 0.0788514f, 0.077799f, 0.074574f, 0.0724636f,
+    0.0699378f, 0.0672259f, 0.0683343f, 0.0593315f, 0.0444986f,
+    0.0355989f, 0.0618789f, 0.0582379f, 0.0595887f, 0.0574002f,
+    0.0569531f, 0.0548888f, 0.0537341f, 0.0522744f, 0.0505512f,
+    0.0507922f, 0.04512f, 0.03384f, 0.027072f, 0.0377543f,
+    0.0355855f, 0.0365235f, 0.0353442f, 0.0354436f, 0.0345349f,
+    0.0342561f, 0.0337775f, 0.0331241f, 0.0344025f, 0.0314341f,
+    0.0235756f, 0.0188604f, 0.0290684f, 0.0283528f, 0.0275576f,
+    0.0277055f, 0.0273469f, 0.0266992f, 0.025921f, 0.0253807f,
+    0.0250547f, 0.02697f, 0.0249339f, 0.0187004f, 0.0149603f,
+    0.0289142f, 0.0282467f, 0.027451f, 0.0275888f, 0.0272074f,
+    0.0265896f, 0.0258093f, 0.0244671f, 0.0239016f, 0.023617f,
+    0.0215131f, 0.0161348f, 0.0129079f, 0.149864f, 0.146404f,
+    0.14228f, 0.142994f, 0.141017f, 0.137815f, 0.133771f,
+    0.126814f, 0.123883f, 0.122408f, 0.111503f, 0.0836274f,
+    0.0669019f, 0.11795f, 0.112725f, 0.112083f, 0.111329f,
+    0.110084f, 0.106767f, 0.103874f, 0.0997262f, 0.0972053f,
+    0.0961865f, 0.0881037f, 0.0672693f, 0.0538154f, 0.108988f,
+    0.102186f, 0.104067f, 0.0997961f, 0.0984989f, 0.0944611f,
+    0.0918039f, 0.0886073f, 0.0852297f, 0.0878071f, 0.0759301f,
+    0.0569476f, 0.0455581f, 0.0848837f, 0.0797497f, 0.0814523f,
+    0.078345f, 0.077653f, 0.0747758f, 0.0730744f, 0.0709439f,
+    0.0685549f, 0.0702652f, 0.0617187f, 0.046289f, 0.0370312f,
+    0.060759f, 0.0574078f, 0.0583871f, 0.056289f, 0.0561434f,
+    0.0544219f, 0.0535965f, 0.052447f, 0.0511279f, 0.0538754f,
+    0.0480327f, 0.0360246f, 0.0288197f, 0.0579824f, 0.0565993f,
+    0.0550084f, 0.055294f, 0.0545539f, 0.0532886f, 0.0517301f,
+    0.0490446f, 0.0479171f, 0.0473596f, 0.0431546f, 0.032366f,
+    0.0258928f, 0.0578282f, 0.0564932f, 0.0549018f, 0.0551773f,
+    0.0544145f, 0.053179f, 0.0516183f, 0.0489339f, 0.0478031f,
+    0.0472338f, 0.0430259f, 0.0322695f, 0.0258156f, 0.178778f,
+    0.174651f, 0.169731f, 0.170583f, 0.168224f, 0.164405f,
+    0.15958f, 0.151281f, 0.147785f, 0.146025f, 0.133016f,
+    0.099762f, 0.0798097f, 0.146864f, 0.140972f, 0.137933f,
+    0.138892f, 0.137291f, 0.133356f, 0.129683f, 0.124109f,
+    0.120975f, 0.119803f, 0.109617f, 0.0831127f, 0.0665862f,
+    0.131992f, 0.123698f, 0.12593f, 0.120741f, 0.119199f,
+    0.114348f, 0.111144f, 0.107277f, 0.103233f, 0.10728f,
+    0.0925288f, 0.0705008f, 0.0564006f, 0.107888f, 0.101261f,
+    0.103316f, 0.0992897f, 0.0983528f, 0.0946629f, 0.0924148f,
+    0.0896135f, 0.0865587f, 0.089738f, 0.0783173f, 0.0587381f,
+    0.0469904f, 0.0880005f, 0.0856543f, 0.0832794f, 0.0837777f,
+    0.0827147f, 0.0807019f, 0.0783642f, 0.0743146f, 0.0726364f,
+    0.0733482f, 0.0655359f, 0.0491519f, 0.0394638f, 0.0868964f,
+    0.0848457f, 0.0824591f, 0.0828825f, 0.081761f, 0.079878f,
+    0.0775391f, 0.0735115f, 0.0718184f, 0.0709764f, 0.0646675f,
+    0.0485006f, 0.0388005f, 0.0867423f, 0.0847396f, 0.0823525f,
+    0.0827658f, 0.0816215f, 0.0797684f, 0.0774274f, 0.0734008f,
+    0.0717045f, 0.0708506f, 0.0645388f, 0.0484041f, 0.0387233f,
+    0.236606f, 0.231144f, 0.224632f, 0.22576f, 0.222638f,
+    0.217584f, 0.211198f, 0.200215f, 0.195588f, 0.193259f,
+    0.176042f, 0.132031f, 0.105625f, 0.204692f, 0.197465f,
+    0.192775f, 0.194018f, 0.191705f, 0.186535f, 0.181301f,
+    0.172874f, 0.168514f, 0.167037f, 0.152642f, 0.114799f,
+    0.092249f, 0.18005f, 0.172965f, 0.169658f, 0.170342f,
+    0.168366f, 0.163566f, 0.159042f, 0.152157f, 0.148318f,
+    0.146865f, 0.134374f, 0.102188f, 0.0817617f, 0.154658f,
+    0.149478f, 0.147043f, 0.146744f, 0.144966f, 0.141102f,
+    0.13711f, 0.130633f, 0.127346f, 0.128684f, 0.115312f,
+    0.0873545f, 0.0699602f, 0.145829f, 0.142147f, 0.138167f,
+    0.13891f, 0.137129f, 0.133881f, 0.129982f, 0.123248f,
+    0.120439f, 0.119091f, 0.108562f, 0.0814212f, 0.0651369f,
+    0.144725f, 0.141339f, 0.137361f, 0.13806f, 0.136175f,
+    0.133057f, 0.129157f, 0.122445f, 0.119621f, 0.11821f,
+    0.107693f, 0.0807699f, 0.0646159f, 0.14457f, 0.141233f,
+    0.137254f, 0.137943f, 0.136036f, 0.132947f, 0.129046f,
+    0.122334f, 0.119507f, 0.118084f, 0.107564f, 0.0806733f,
+    0.0645387f, 0.670317f, 0.654841f, 0.636394f, 0.639588f,
+    0.630744f, 0.616425f, 0.598334f, 0.567218f, 0.55411f,
+    0.54751f, 0.498734f, 0.374051f, 0.299241f, 0.638402f,
+    0.621162f, 0.604095f, 0.60746f, 0.599811f, 0.585377f,
+    0.568436f, 0.539056f, 0.526901f, 0.521289f, 0.475335f,
+    0.356501f, 0.285201f, 0.61376f, 0.596662f, 0.580464f,
+    0.583784f, 0.576471f, 0.562407f, 0.546178f, 0.517985f,
+    0.50637f, 0.501116f, 0.457067f, 0.3428f, 0.27424f,
+    0.588368f, 0.573175f, 0.557148f, 0.560186f, 0.553072f,
+    0.539942f, 0.524246f, 0.4971f, 0.485809f, 0.480452f,
+    0.438005f, 0.328504f, 0.262803f, 0.579539f, 0.565844f,
+    0.549928f, 0.552738f, 0.545235f, 0.532722f, 0.517118f,
+    0.490251f, 0.478961f, 0.473343f, 0.431254f, 0.323441f,
+    0.258753f, 0.578435f, 0.565036f, 0.549122f, 0.551887f,
+    0.544281f, 0.531898f, 0.516293f, 0.489448f, 0.478142f,
+    0.472462f, 0.430386f, 0.322789f, 0.258231f, 0.578281f,
+    0.564929f, 0.549015f, 0.551771f, 0.544141f, 0.531788f,
+    0.516182f, 0.489337f, 0.478029f, 0.472336f, 0.430257f,
+    0.322693f, 0.258154f, 0.0901631f, 0.0953579f, 0.0890878f,
+    0.0873818f, 0.0851248f, 0.0827297f, 0.0799417f, 0.0753298f,
+    0.0717933f, 0.0655254f, 0.0566181f, 0.0424635f, 0.0339709f,
+    0.0629214f, 0.0618524f, 0.0662711f, 0.0635048f, 0.0625614f,
+    0.060997f, 0.0580669f, 0.0560845f, 0.0532335f, 0.0517218f,
+    0.0433223f, 0.0324917f, 0.0259934f, 0.0541219f, 0.0523001f,
+    0.0562824f, 0.0538946f, 0.053298f, 0.0520966f, 0.0495204f,
+    0.047928f, 0.0455648f, 0.0429885f, 0.0361086f, 0.0270815f,
+    0.0216652f, 0.0327505f, 0.0304348f, 0.0332289f, 0.0319393f,
+    0.0321199f, 0.0318756f, 0.0305856f, 0.030133f, 0.0290657f,
+    0.0268069f, 0.0227122f, 0.0170342f, 0.0136273f, 0.0164468f,
+    0.0141741f, 0.0125192f, 0.0121714f, 0.0127298f, 0.0131196f,
+    0.0130629f, 0.0135438f, 0.0136214f, 0.0144229f, 0.0120191f,
+    0.0090143f, 0.00721144f, 0.015365f, 0.0137206f, 0.0113498f,
+    0.00996429f, 0.009834f, 0.0103838f, 0.0104573f, 0.0102586f,
+    0.00980552f, 0.00986864f, 0.00822386f, 0.0061679f, 0.00493432f,
+    0.00934165f, 0.00959317f, 0.00703884f, 0.00623748f, 0.00564596f,
+    0.00528172f, 0.0050996f, 0.00469607f, 0.00425748f, 0.00361881f,
+    0.00301567f, 0.00226175f, 0.0018094f, 0.118489f, 0.125316f,
+    0.117076f, 0.114834f, 0.111868f, 0.10872f, 0.105056f,
+    0.0989952f, 0.0943479f, 0.0861107f, 0.0744052f, 0.0558039f,
+    0.0446431f, 0.0852444f, 0.0897641f, 0.0884354f, 0.0848078f,
+    0.083544f, 0.081487f, 0.0776904f, 0.0750964f, 0.0713252f,
+    0.0700655f, 0.0586569f, 0.0439927f, 0.0351941f, 0.0748893f,
+    0.0730337f, 0.0784467f, 0.0751976f, 0.0742806f, 0.0725866f,
+    0.0691439f, 0.0669399f, 0.0636564f, 0.0613323f, 0.0514431f,
+    0.0385824f, 0.0308659f, 0.0535179f, 0.0511684f, 0.0553932f,
+    0.0532423f, 0.0531025f, 0.0523656f, 0.050209f, 0.0491449f,
+    0.0471573f, 0.0451507f, 0.0380468f, 0.0285351f, 0.0228281f,
+    0.0335604f, 0.0318291f, 0.0346835f, 0.0334744f, 0.0337124f,
+    0.0336096f, 0.0326863f, 0.0325557f, 0.0317129f, 0.031301f,
+    0.0265504f, 0.0199128f, 0.0159302f, 0.0284296f, 0.0300773f,
+    0.028119f, 0.0275704f, 0.0268614f, 0.0261114f, 0.0253116f,
+    0.0253114f, 0.0247714f, 0.0251836f, 0.0214457f, 0.0160843f,
+    0.0128674f, 0.0283257f, 0.0299579f, 0.027988f, 0.0274521f,
+    0.026743f, 0.0259906f, 0.0251147f, 0.0236658f, 0.0225548f,
+    0.0205857f, 0.0177875f, 0.0133406f, 0.0106725f, 0.146814f,
+    0.155273f, 0.145063f, 0.142286f, 0.13861f, 0.13471f,
+    0.130171f, 0.122661f, 0.116902f, 0.106696f, 0.0921923f,
+    0.0691442f, 0.0553154f, 0.11357f, 0.119722f, 0.11335f,
+    0.110206f, 0.10748f, 0.104832f, 0.101678f, 0.0961073f,
+    0.0919808f, 0.0884094f, 0.0739914f, 0.0562813f, 0.0450251f,
+    0.0956567f, 0.0937823f, 0.100611f, 0.0965007f, 0.0952632f,
+    0.0930766f, 0.0887673f, 0.0859517f, 0.0817479f, 0.0796761f,
+    0.0667777f, 0.0500833f, 0.0400666f, 0.0742853f, 0.071902f,
+    0.0775574f, 0.0745454f, 0.0740851f, 0.0728555f, 0.0698324f,
+    0.0681568f, 0.0652488f, 0.0634945f, 0.0533814f, 0.040036f,
+    0.0320288f, 0.0575897f, 0.0609201f, 0.0570681f, 0.0558731f,
+    0.054695f, 0.0540995f, 0.0523098f, 0.0515676f, 0.0498045f,
+    0.0496447f, 0.041885f, 0.0314137f, 0.0251309f, 0.0567552f,
+    0.0600349f, 0.0561068f, 0.0550223f, 0.0536041f, 0.0521017f,
+    0.0503512f, 0.0474527f, 0.0452335f, 0.0435274f, 0.0367803f,
+    0.0275852f, 0.0220682f, 0.0566513f, 0.0599155f, 0.0559757f,
+    0.0549039f, 0.0534858f, 0.0519809f, 0.0502291f, 0.0473313f,
+    0.0451093f, 0.0411711f, 0.0355746f, 0.0266809f, 0.0213447f,
+    0.17514f, 0.185231f, 0.173051f, 0.169737f, 0.165353f,
+    0.160701f, 0.155285f, 0.146326f, 0.139457f, 0.127281f,
+    0.109979f, 0.0824845f, 0.0659876f, 0.141896f, 0.149679f,
+    0.141338f, 0.137482f, 0.134222f, 0.130822f, 0.126793f,
+    0.119773f, 0.114535f, 0.106753f, 0.0913861f, 0.0694527f,
+    0.0555621f, 0.117351f, 0.12374f, 0.122775f, 0.117804f,
+    0.116246f, 0.113567f, 0.108391f, 0.104964f, 0.0998396f,
+    0.0980199f, 0.0821123f, 0.0615843f, 0.0492674f, 0.0950527f,
+    0.098754f, 0.0997217f, 0.0958484f, 0.0950678f, 0.0933455f,
+    0.0894559f, 0.0871687f, 0.0833404f, 0.0818383f, 0.0687159f,
+    0.0515369f, 0.0412296f, 0.0859153f, 0.0908777f, 0.0850558f,
+    0.0833248f, 0.081199f, 0.0789554f, 0.0763351f, 0.0719698f,
+    0.0686453f, 0.0679886f, 0.0572195f, 0.0429146f, 0.0343317f,
+    0.0850807f, 0.0899925f, 0.0840945f, 0.0824741f, 0.0803469f,
+    0.078092f, 0.0754656f, 0.0711182f, 0.0677881f, 0.0618971f,
+    0.053505f, 0.0401287f, 0.032103f, 0.0849768f, 0.089873f,
+    0.0839635f, 0.0823557f, 0.0802285f, 0.0779712f, 0.0753435f,
+    0.0709968f, 0.0676638f, 0.0617565f, 0.0533617f, 0.0400212f,
+    0.032017f, 0.231791f, 0.245146f, 0.229027f, 0.224641f,
+    0.218838f, 0.212681f, 0.205514f, 0.193657f, 0.184566f,
+    0.168452f, 0.145553f, 0.109165f, 0.0873321f, 0.198547f,
+    0.209594f, 0.197314f, 0.192386f, 0.187708f, 0.182803f,
+    0.177022f, 0.167104f, 0.159645f, 0.146534f, 0.12696f,
+    0.0957955f, 0.0766363f, 0.174002f, 0.183655f, 0.173277f,
+    0.168672f, 0.16464f, 0.160436f, 0.155463f, 0.146838f,
+    0.140404f, 0.134707f, 0.112781f, 0.0855028f, 0.0684023f,
+    0.150128f, 0.158669f, 0.149108f, 0.145613f, 0.142013f,
+    0.13824f, 0.133807f, 0.126277f, 0.12061f, 0.118526f,
+    0.099385f, 0.0745388f, 0.059631f, 0.142566f, 0.150793f,
+    0.141031f, 0.138229f, 0.134685f, 0.130936f, 0.126564f,
+    0.119301f, 0.113754f, 0.104676f, 0.0899362f, 0.0674522f,
+    0.0540665f, 0.141732f, 0.149908f, 0.14007f, 0.137378f,
+    0.133832f, 0.130073f, 0.125694f, 0.118449f, 0.112897f,
+    0.103068f, 0.0890792f, 0.0668094f, 0.0534475f, 0.141628f,
+    0.149788f, 0.139939f, 0.137259f, 0.133714f, 0.129952f,
+    0.125572f, 0.118328f, 0.112773f, 0.102927f, 0.0889358f,
+    0.0667019f, 0.0533615f, 0.656675f, 0.694509f, 0.648843f,
+    0.636418f, 0.61998f, 0.602536f, 0.58223f, 0.54864f,
+    0.522884f, 0.477233f, 0.41236f, 0.30927f, 0.247416f,
+    0.62343f, 0.658958f, 0.61713f, 0.604163f, 0.588849f,
+    0.572658f, 0.553738f, 0.522086f, 0.497962f, 0.455314f,
+    0.393767f, 0.295325f, 0.23626f, 0.598886f, 0.633019f,
+    0.593093f, 0.58045f, 0.565781f, 0.550291f, 0.532179f,
+    0.501821f, 0.478722f, 0.437953f, 0.378877f, 0.284158f,
+    0.227489f, 0.575011f, 0.608033f, 0.568924f, 0.557391f,
+    0.543154f, 0.528095f, 0.510523f, 0.48126f, 0.458928f,
+    0.419496f, 0.362797f, 0.272097f, 0.217678f, 0.56745f,
+    0.600157f, 0.560848f, 0.550006f, 0.535825f, 0.520791f,
+    0.503281f, 0.474284f, 0.452072f, 0.412755f, 0.356743f,
+    0.267557f, 0.214046f, 0.566615f, 0.599272f, 0.559887f,
+    0.549155f, 0.534974f, 0.519927f, 0.502411f, 0.473432f,
+    0.451215f, 0.411849f, 0.355886f, 0.266914f, 0.213531f,
+    0.566512f, 0.599152f, 0.559755f, 0.549037f, 0.534855f,
+    0.519807f, 0.502289f, 0.47331f, 0.451091f, 0.411708f,
+    0.355742f, 0.266807f, 0.213445f, 0.0938471f, 0.0918979f,
+    0.0889972f, 0.0851017f, 0.0830431f, 0.0791631f, 0.0750226f,
+    0.0700792f, 0.0650551f, 0.0549281f, 0.0461571f, 0.0346501f,
+    0.0277201f, 0.0608301f, 0.0608905f, 0.0606639f, 0.0605723f,
+    0.0585058f, 0.0573642f, 0.0547262f, 0.0517257f, 0.048823f,
+    0.0445294f, 0.0372291f, 0.0279218f, 0.0223374f, 0.0440545f,
+    0.0478937f, 0.0479916f, 0.0479714f, 0.0466779f, 0.0459912f,
+    0.0439824f, 0.0417188f, 0.0395309f, 0.0360556f, 0.0301947f,
+    0.022646f, 0.0181168f, 0.0264842f, 0.0254193f, 0.0258503f,
+    0.02598f, 0.0258317f, 0.0258632f, 0.0250605f, 0.0241161f,
+    0.0232044f, 0.0215296f, 0.0181164f, 0.0135873f, 0.0108698f,
+    0.0156078f, 0.0136634f, 0.0133405f, 0.0121739f, 0.0126182f,
+    0.0114991f, 0.0111977f, 0.0109343f, 0.0106894f, 0.0108739f,
+    0.00906159f, 0.0067962f, 0.00543696f, 0.0117091f, 0.0105247f,
+    0.00988658f, 0.008563f, 0.00901336f, 0.00796531f, 0.00759373f,
+    0.00734916f, 0.00709674f, 0.00666047f, 0.00555039f, 0.00416279f,
+    0.00333023f, 0.00608827f, 0.00518274f, 0.00435393f, 0.0033446f,
+    0.00370781f, 0.00309658f, 0.0028085f, 0.00273524f, 0.00255627f,
+    0.00216393f, 0.00180327f, 0.00135246f, 0.00108196f, 0.12333f,
+    0.120769f, 0.116957f, 0.111837f, 0.109132f, 0.104033f,
+    0.0985916f, 0.0920952f, 0.0854928f, 0.0721843f, 0.0606577f,
+    0.0455358f, 0.0364286f, 0.0903131f, 0.0866773f, 0.0841501f,
+    0.0826806f, 0.0797691f, 0.0781781f, 0.0746088f, 0.0705121f,
+    0.0665369f, 0.0607801f, 0.0507991f, 0.0380993f, 0.0304795f,
+    0.065022f, 0.0701926f, 0.0701157f, 0.0700796f, 0.0679412f,
+    0.0668051f, 0.0638651f, 0.0605053f, 0.0572448f, 0.0523062f,
+    0.0437647f, 0.0328235f, 0.0262588f, 0.0438475f, 0.0477182f,
+    0.0479744f, 0.0480883f, 0.0470951f, 0.0466771f, 0.0449431f,
+    0.0429025f, 0.0409184f, 0.0377803f, 0.0316864f, 0.0237648f,
+    0.0190119f, 0.0306574f, 0.0314464f, 0.0316565f, 0.0317704f,
+    0.0312605f, 0.0310975f, 0.0301407f, 0.0289474f, 0.0278434f,
+    0.0262009f, 0.0220294f, 0.016522f, 0.0132176f, 0.0296223f,
+    0.028984f, 0.0280797f, 0.0268508f, 0.0262135f, 0.0252454f,
+    0.0244355f, 0.0234152f, 0.0225271f, 0.0213526f, 0.0179622f,
+    0.0134716f, 0.0107773f, 0.0294831f, 0.0288708f, 0.0279595f,
+    0.0267357f, 0.026089f, 0.0248701f, 0.0235693f, 0.0220163f,
+    0.020438f, 0.0172565f, 0.014501f, 0.0108865f, 0.00870923f,
+    0.152813f, 0.149639f, 0.144916f, 0.138573f, 0.135221f,
+    0.128903f, 0.122161f, 0.114111f, 0.10593f, 0.0894404f,
+    0.0751584f, 0.0564215f, 0.0451372f, 0.119796f, 0.115548f,
+    0.112109f, 0.107919f, 0.105358f, 0.10083f, 0.0961002f,
+    0.0902371f, 0.0842508f, 0.0770308f, 0.0643691f, 0.0482769f,
+    0.0386215f, 0.094505f, 0.0924915f, 0.0922399f, 0.0921879f,
+    0.0892044f, 0.087619f, 0.0837476f, 0.0792916f, 0.0749587f,
+    0.0685569f, 0.0573347f, 0.0430011f, 0.0344008f, 0.0688128f,
+    0.0700172f, 0.0700986f, 0.0701965f, 0.0683583f, 0.0674909f,
+    0.0648257f, 0.0616889f, 0.0586323f, 0.054031f, 0.0452564f,
+    0.0339423f, 0.0271539f, 0.0601403f, 0.058719f, 0.0569108f,
+    0.0544364f, 0.0531853f, 0.0519114f, 0.0500232f, 0.0477338f,
+    0.0455573f, 0.0424515f, 0.0355994f, 0.0266996f, 0.0213596f,
+    0.0591052f, 0.0578546f, 0.056039f, 0.0535863f, 0.0523023f,
+    0.0498617f, 0.0472699f, 0.0441687f, 0.0410168f, 0.0376032f,
+    0.0315322f, 0.0236492f, 0.0189193f, 0.0589661f, 0.0577414f,
+    0.0559188f, 0.0534712f, 0.0521778f, 0.0497399f, 0.0471384f,
+    0.0440324f, 0.0408757f, 0.0345127f, 0.0290017f, 0.0217722f,
+    0.0174178f, 0.182296f, 0.17851f, 0.172875f, 0.165308f,
+    0.161309f, 0.153773f, 0.14573f, 0.136127f, 0.126368f,
+    0.106697f, 0.0896591f, 0.0673071f, 0.0538457f, 0.149279f,
+    0.144418f, 0.140069f, 0.134353f, 0.131447f, 0.1257f,
+    0.119669f, 0.112253f, 0.104597f, 0.0932814f, 0.0779391f,
+    0.0584544f, 0.0467635f, 0.123988f, 0.119442f, 0.115927f,
+    0.114296f, 0.110468f, 0.108433f, 0.10363f, 0.098078f,
+    0.0926726f, 0.0848075f, 0.0709048f, 0.0531786f, 0.0425428f,
+    0.0982957f, 0.0952634f, 0.0924186f, 0.0923047f, 0.0896216f,
+    0.0883048f, 0.0847083f, 0.0804752f, 0.0763461f, 0.0702816f,
+    0.0588265f, 0.0441198f, 0.0352959f, 0.0896232f, 0.0875896f,
+    0.0848701f, 0.0811718f, 0.0792741f, 0.0756032f, 0.0717369f,
+    0.0670874f, 0.0632712f, 0.0587022f, 0.0491694f, 0.0368771f,
+    0.0295017f, 0.0885882f, 0.0867252f, 0.0839983f, 0.0803218f,
+    0.078391f, 0.0747315f, 0.0708389f, 0.0661848f, 0.0614544f,
+    0.0538539f, 0.0451022f, 0.0338267f, 0.0270613f, 0.088449f,
+    0.0866119f, 0.0838781f, 0.0802066f, 0.0782665f, 0.0746097f,
+    0.0707073f, 0.0660484f, 0.0613133f, 0.0517689f, 0.0435023f,
+    0.0326578f, 0.0261263f, 0.241262f, 0.236251f, 0.228794f,
+    0.218779f, 0.213487f, 0.203512f, 0.192868f, 0.180159f,
+    0.167243f, 0.141209f, 0.11866f, 0.0890784f, 0.0712627f,
+    0.208245f, 0.20216f, 0.195987f, 0.187696f, 0.183625f,
+    0.17544f, 0.166807f, 0.156285f, 0.145473f, 0.125783f,
+    0.105079f, 0.0788094f, 0.0630475f, 0.182954f, 0.177183f,
+    0.171846f, 0.164687f, 0.161199f, 0.154108f, 0.146704f,
+    0.137609f, 0.128234f, 0.117309f, 0.0980449f, 0.0735336f,
+    0.0588269f, 0.157262f, 0.153005f, 0.148337f, 0.141984f,
+    0.138854f, 0.132582f, 0.126034f, 0.118072f, 0.111774f,
+    0.102783f, 0.0859665f, 0.0644749f, 0.0515799f, 0.148589f,
+    0.145331f, 0.140789f, 0.134643f, 0.131452f, 0.125343f,
+    0.118875f, 0.111119f, 0.10323f, 0.0912035f, 0.0763095f,
+    0.0572321f, 0.0457857f, 0.147554f, 0.144466f, 0.139917f,
+    0.133793f, 0.130569f, 0.124471f, 0.117977f, 0.110217f,
+    0.10233f, 0.0864213f, 0.0726278f, 0.0545664f, 0.0436531f,
+    0.147415f, 0.144353f, 0.139797f, 0.133678f, 0.130444f,
+    0.124349f, 0.117845f, 0.110081f, 0.102189f, 0.0862812f,
+    0.0725037f, 0.0544292f, 0.0435434f, 0.683506f, 0.66931f,
+    0.648183f, 0.619811f, 0.604818f, 0.57656f, 0.546402f,
+    0.5104f, 0.473809f, 0.400052f, 0.33617f, 0.252363f,
+    0.201891f, 0.650489f, 0.635219f, 0.615377f, 0.588728f,
+    0.574956f, 0.548487f, 0.520342f, 0.486526f, 0.452038f,
+    0.38209f, 0.321156f, 0.241434f, 0.193147f, 0.625198f,
+    0.610242f, 0.591235f, 0.565667f, 0.55253f, 0.527156f,
+    0.500239f, 0.467849f, 0.434799f, 0.367659f, 0.309059f,
+    0.232492f, 0.185994f, 0.599506f, 0.586064f, 0.567727f,
+    0.543017f, 0.530185f, 0.50563f, 0.479569f, 0.448312f,
+    0.416482f, 0.352018f, 0.295888f, 0.222517f, 0.178014f,
+    0.590833f, 0.57839f, 0.560178f, 0.535675f, 0.522783f,
+    0.49839f, 0.47241f, 0.441359f, 0.409794f, 0.346104f,
+    0.290863f, 0.2185f, 0.1748f, 0.589798f, 0.577525f,
+    0.559306f, 0.534825f, 0.5219f, 0.497519f, 0.471512f,
+    0.440457f, 0.408895f, 0.345264f, 0.290138f, 0.217851f,
+    0.174281f, 0.589659f, 0.577412f, 0.559186f, 0.53471f,
+    0.521775f, 0.497397f, 0.471381f, 0.440321f, 0.408754f,
+    0.345124f, 0.290014f, 0.217714f, 0.174171f, 0.0882701f,
+    0.0881061f, 0.0877738f, 0.0847096f, 0.0804521f, 0.0770685f,
+    0.0714824f, 0.0664803f, 0.0611453f, 0.0507727f, 0.0424679f,
+    0.0318981f, 0.0255185f, 0.0589176f, 0.0568466f, 0.0558932f,
+    0.055029f, 0.0542082f, 0.0520852f, 0.0500701f, 0.0475578f,
+    0.0447742f, 0.0399865f, 0.0339609f, 0.0254707f, 0.0203765f,
+    0.0432949f, 0.0425459f, 0.041364f, 0.0414643f, 0.0411121f,
+    0.0399132f, 0.038595f, 0.0369145f, 0.0350812f, 0.0318549f,
+    0.0272247f, 0.0204185f, 0.0163348f, 0.0285798f, 0.0291927f,
+    0.0285916f, 0.0272785f, 0.0270909f, 0.0257533f, 0.0254951f,
+    0.0230158f, 0.0205246f, 0.018443f, 0.0159908f, 0.0119931f,
+    0.00959447f, 0.0129438f, 0.0132478f, 0.0136914f, 0.0137225f,
+    0.0148325f, 0.015032f, 0.0151554f, 0.0142818f, 0.0129549f,
+    0.0104761f, 0.00873008f, 0.00654756f, 0.00523804f, 0.00946604f,
+    0.00776936f, 0.00650895f, 0.00676276f, 0.00809049f, 0.00899643f,
+    0.00975707f, 0.00962223f, 0.00889822f, 0.00724017f, 0.00603347f,
+    0.0045251f, 0.00362008f, 0.00512078f, 0.0035495f, 0.00239294f,
+    0.00211922f, 0.00250555f, 0.00221835f, 0.00320174f, 0.00362196f,
+    0.00359537f, 0.00299628f, 0.0024969f, 0.00187267f, 0.00149814f,
+    0.116001f, 0.115785f, 0.115349f, 0.111322f, 0.105727f,
+    0.10128f, 0.0939394f, 0.0873656f, 0.0803547f, 0.0667234f,
+    0.0558095f, 0.0419192f, 0.0335354f, 0.0840141f, 0.0833417f,
+    0.0834682f, 0.0808915f, 0.0772295f, 0.0744824f, 0.0695305f,
+    0.0656209f, 0.0616401f, 0.0548153f, 0.0464885f, 0.0348664f,
+    0.0278931f, 0.0667468f, 0.0648503f, 0.0630702f, 0.0629708f,
+    0.0621718f, 0.0599411f, 0.0577472f, 0.0549775f, 0.0519472f,
+    0.0466836f, 0.0397523f, 0.0298142f, 0.0238514f, 0.0443427f,
+    0.0438553f, 0.0429503f, 0.0429512f, 0.0426255f, 0.041354f,
+    0.040043f, 0.0383002f, 0.036509f, 0.0332717f, 0.0285184f,
+    0.0213888f, 0.017111f, 0.0303994f, 0.030145f, 0.0297858f,
+    0.0296564f, 0.0294482f, 0.0284717f, 0.0291904f, 0.0264633f,
+    0.0252247f, 0.023033f, 0.0197996f, 0.0148497f, 0.0118798f,
+    0.0278484f, 0.0277888f, 0.0277028f, 0.0267386f, 0.0254025f,
+    0.0243474f, 0.023792f, 0.0219152f, 0.0208766f, 0.0189114f,
+    0.0162161f, 0.0121621f, 0.00972966f, 0.0277311f, 0.0276795f,
+    0.0275752f, 0.0266126f, 0.025275f, 0.0242121f, 0.0224572f,
+    0.0208858f, 0.0192098f, 0.0159511f, 0.013342f, 0.0100216f,
+    0.00801725f, 0.143732f, 0.143465f, 0.142924f, 0.137934f,
+    0.131002f, 0.125492f, 0.116396f, 0.108251f, 0.0995641f,
+    0.0826742f, 0.0691512f, 0.0519403f, 0.0415522f, 0.111745f,
+    0.111021f, 0.111043f, 0.107504f, 0.102504f, 0.0986942f,
+    0.0919873f, 0.0859798f, 0.079377f, 0.0696439f, 0.0590161f,
+    0.044262f, 0.0354097f, 0.0901988f, 0.0871547f, 0.0872953f,
+    0.0846291f, 0.0832316f, 0.079969f, 0.0768993f, 0.0730406f,
+    0.0688131f, 0.0615122f, 0.0522799f, 0.0392099f, 0.0313679f,
+    0.0677947f, 0.0661597f, 0.0646566f, 0.0644577f, 0.0636853f,
+    0.0613818f, 0.0591951f, 0.0563633f, 0.0533749f, 0.0481003f,
+    0.0410459f, 0.0307845f, 0.0246276f, 0.0564669f, 0.0563093f,
+    0.0561819f, 0.0542513f, 0.0515763f, 0.0494838f, 0.0467523f,
+    0.0444467f, 0.0420906f, 0.0378617f, 0.0323272f, 0.0242454f,
+    0.0193963f, 0.0555793f, 0.0554682f, 0.0552778f, 0.053351f,
+    0.0506773f, 0.0485592f, 0.0450542f, 0.0419202f, 0.0385691f,
+    0.0337401f, 0.0287437f, 0.0215578f, 0.0172462f, 0.0554619f,
+    0.0553589f, 0.0551502f, 0.0532249f, 0.0505498f, 0.0484239f,
+    0.0449141f, 0.0417712f, 0.0384192f, 0.0319018f, 0.0266837f,
+    0.0200427f, 0.0160341f, 0.171463f, 0.171144f, 0.170499f,
+    0.164547f, 0.156276f, 0.149704f, 0.138853f, 0.129137f,
+    0.118773f, 0.0986248f, 0.0824928f, 0.0619614f, 0.0495691f,
+    0.139476f, 0.1387f, 0.138618f, 0.134116f, 0.127779f,
+    0.122906f, 0.114444f, 0.106865f, 0.0985864f, 0.0844725f,
+    0.0715437f, 0.0536577f, 0.0429499f, 0.115561f, 0.114767f,
+    0.11487f, 0.111241f, 0.106124f, 0.102261f, 0.0960515f,
+    0.0911036f, 0.0856791f, 0.0763409f, 0.0648075f, 0.0486056f,
+    0.0388845f, 0.0919055f, 0.0914414f, 0.091426f, 0.0884263f,
+    0.084745f, 0.0814097f, 0.0783473f, 0.0744263f, 0.0702409f,
+    0.0629289f, 0.0535735f, 0.0401802f, 0.0321441f, 0.0841978f,
+    0.0839886f, 0.0837569f, 0.0808636f, 0.0768511f, 0.0736956f,
+    0.0684326f, 0.0637343f, 0.0589566f, 0.0526903f, 0.0448548f,
+    0.0336411f, 0.0269129f, 0.0833101f, 0.0831476f, 0.0828528f,
+    0.0799633f, 0.075952f, 0.072771f, 0.0675111f, 0.0628056f,
+    0.0577784f, 0.0485687f, 0.0412713f, 0.0309535f, 0.0247628f,
+    0.0831928f, 0.0830382f, 0.0827252f, 0.0798372f, 0.0758246f,
+    0.0726357f, 0.0673709f, 0.0626566f, 0.0576285f, 0.0478525f,
+    0.0400254f, 0.0300637f, 0.024051f, 0.226924f, 0.226503f,
+    0.225649f, 0.217771f, 0.206826f, 0.198128f, 0.183767f,
+    0.170907f, 0.157192f, 0.130526f, 0.109176f, 0.0820036f,
+    0.0656029f, 0.194938f, 0.194059f, 0.193768f, 0.187341f,
+    0.178329f, 0.17133f, 0.159358f, 0.148636f, 0.137005f,
+    0.11413f, 0.0965989f, 0.0724491f, 0.0583347f, 0.171022f,
+    0.170126f, 0.17002f, 0.164466f, 0.156673f, 0.150685f,
+    0.14031f, 0.131031f, 0.120891f, 0.105998f, 0.0898626f,
+    0.067397f, 0.0539176f, 0.147367f, 0.1468f, 0.146576f,
+    0.141651f, 0.134792f, 0.129472f, 0.12042f, 0.112341f,
+    0.103973f, 0.0925863f, 0.0786287f, 0.0589715f, 0.0471772f,
+    0.13966f, 0.139347f, 0.138907f, 0.134088f, 0.127401f,
+    0.122119f, 0.113346f, 0.105505f, 0.0971017f, 0.0823476f,
+    0.0699099f, 0.0524324f, 0.041946f, 0.138772f, 0.138506f,
+    0.138003f, 0.133188f, 0.126502f, 0.121195f, 0.112425f,
+    0.104576f, 0.0961972f, 0.0798898f, 0.0668249f, 0.0502137f,
+    0.040171f, 0.138655f, 0.138397f, 0.137875f, 0.133062f,
+    0.126374f, 0.121059f, 0.112285f, 0.104427f, 0.0960473f,
+    0.079754f, 0.0667087f, 0.0501059f, 0.0400847f, 0.642888f,
+    0.641693f, 0.639273f, 0.616956f, 0.585947f, 0.561304f,
+    0.52062f, 0.484188f, 0.445333f, 0.369787f, 0.309301f,
+    0.23232f, 0.185856f, 0.610901f, 0.60925f, 0.607392f,
+    0.586525f, 0.55745f, 0.534507f, 0.496211f, 0.461917f,
+    0.425146f, 0.35327f, 0.295518f, 0.222147f, 0.177718f,
+    0.586986f, 0.585316f, 0.583644f, 0.563651f, 0.535795f,
+    0.513861f, 0.477163f, 0.444312f, 0.409032f, 0.339959f,
+    0.284397f, 0.213865f, 0.171092f, 0.56333f, 0.56199f,
+    0.5602f, 0.540836f, 0.513914f, 0.492649f, 0.457273f,
+    0.425621f, 0.39171f, 0.32547f, 0.272267f, 0.204703f,
+    0.163763f, 0.555623f, 0.554538f, 0.552531f, 0.533273f,
+    0.506522f, 0.485296f, 0.450199f, 0.418786f, 0.385242f,
+    0.319946f, 0.267624f, 0.201088f, 0.16087f, 0.554735f,
+    0.553697f, 0.551627f, 0.532373f, 0.505623f, 0.484371f,
+    0.449278f, 0.417858f, 0.384338f, 0.319151f, 0.26695f,
+    0.20053f, 0.160424f, 0.554618f, 0.553587f, 0.551499f,
+    0.532246f, 0.505496f, 0.484236f, 0.449138f, 0.417708f,
+    0.384188f, 0.319015f, 0.266834f, 0.200422f, 0.160338f,
+    0.48503f, 0.244777f, 0.178197f, 0.160307f, 0.16815f,
+    0.135936f, 0.14285f, 0.124402f, 0.111896f, 0.105678f,
+    0.0986372f, 0.0934717f, 0.0747774f, 0.295688f, 0.159408f,
+    0.124762f, 0.101071f, 0.138382f, 0.120338f, 0.126299f,
+    0.108256f, 0.0947241f, 0.0880303f, 0.0852988f, 0.0667829f,
+    0.0534263f, 0.179358f, 0.115899f, 0.101701f, 0.0678004f,
+    0.110945f, 0.095849f, 0.100444f, 0.0860953f, 0.0753334f,
+    0.0695128f, 0.0683816f, 0.0512862f, 0.0410289f, 0.0650765f,
+    0.0939284f, 0.0551764f, 0.0367843f, 0.0575494f, 0.0490678f,
+    0.0511977f, 0.0438837f, 0.0383983f, 0.0348724f, 0.0356245f,
+    0.0267184f, 0.0213747f, 0.0152687f, 0.0831677f, 0.0415839f,
+    0.0277226f, 0.0257379f, 0.0209722f, 0.0174769f, 0.0149802f,
+    0.0135306f, 0.0108245f, 0.0109185f, 0.00818886f, 0.00655109f,
+    0.00317729f, 0.0645584f, 0.0322792f, 0.0215195f, 0.0182364f,
+    0.0146499f, 0.0122082f, 0.0104642f, 0.0116052f, 0.00928414f,
+    0.00773679f, 0.00580259f, 0.00464207f, 1.37368e-05f, 0.0208806f,
+    0.0104403f, 0.00696021f, 0.00531047f, 0.00424847f, 0.0035404f,
+    0.00303462f, 0.00523478f, 0.00418783f, 0.00348986f, 0.00261739f,
+    0.00209391f, 0.637407f, 0.321676f, 0.234179f, 0.210669f,
+    0.220977f, 0.178641f, 0.187727f, 0.163484f, 0.147049f,
+    0.138877f, 0.129625f, 0.122837f, 0.0982694f, 0.448065f,
+    0.236307f, 0.174672f, 0.151433f, 0.187176f, 0.163043f,
+    0.171176f, 0.146723f, 0.128382f, 0.119515f, 0.115414f,
+    0.0961479f, 0.0769183f, 0.313764f, 0.173701f, 0.145121f,
+    0.108348f, 0.159738f, 0.138554f, 0.145322f, 0.124562f,
+    0.108992f, 0.100998f, 0.0984964f, 0.0738723f, 0.0590978f,
+    0.190394f, 0.113622f, 0.0985967f, 0.0664736f, 0.106343f,
+    0.0917732f, 0.0960752f, 0.0823502f, 0.0720564f, 0.0663575f,
+    0.0657393f, 0.0493045f, 0.0394436f, 0.155665f, 0.0996924f,
+    0.0617063f, 0.0525463f, 0.0660955f, 0.0571773f, 0.0597947f,
+    0.0512526f, 0.044846f, 0.0413737f, 0.0410333f, 0.0334731f,
+    0.0267785f, 0.15263f, 0.0810831f, 0.0563269f, 0.0506968f,
+    0.0538806f, 0.04689f, 0.0490956f, 0.042082f, 0.0368217f,
+    0.0342028f, 0.0334287f, 0.0305312f, 0.024425f, 0.152377f,
+    0.0768992f, 0.0559827f, 0.050363f, 0.0528269f, 0.0428226f,
+    0.0449828f, 0.039082f, 0.0351532f, 0.0331998f, 0.0309881f,
+    0.0293964f, 0.0235171f, 0.789784f, 0.398576f, 0.290161f,
+    0.26103f, 0.273803f, 0.221347f, 0.232605f, 0.202566f,
+    0.182202f, 0.172077f, 0.160613f, 0.152202f, 0.121761f,
+    0.600442f, 0.313206f, 0.230654f, 0.201794f, 0.23597f,
+    0.205749f, 0.216054f, 0.185189f, 0.16204f, 0.151001f,
+    0.145528f, 0.125513f, 0.10041f, 0.466089f, 0.246909f,
+    0.188541f, 0.15871f, 0.208532f, 0.18126f, 0.1902f,
+    0.163028f, 0.14265f, 0.132483f, 0.128611f, 0.1028f,
+    0.08224f, 0.34277f, 0.181101f, 0.142017f, 0.116835f,
+    0.155137f, 0.134479f, 0.140953f, 0.120817f, 0.105715f,
+    0.0978426f, 0.0958541f, 0.0757036f, 0.0605629f, 0.308042f,
+    0.156454f, 0.114671f, 0.102908f, 0.114889f, 0.0998828f,
+    0.104672f, 0.0897191f, 0.0785042f, 0.0728588f, 0.0711481f,
+    0.0628381f, 0.0502705f, 0.305006f, 0.154049f, 0.112309f,
+    0.101059f, 0.105946f, 0.0895954f, 0.0939732f, 0.0805484f,
+    0.0704799f, 0.0665484f, 0.0635435f, 0.0598962f, 0.047917f,
+    0.304754f, 0.153798f, 0.111965f, 0.100725f, 0.105653f,
+    0.0855281f, 0.0898603f, 0.0781641f, 0.0703063f, 0.0663994f,
+    0.0619759f, 0.0587614f, 0.0470091f, 0.94216f, 0.475475f,
+    0.346143f, 0.311392f, 0.326629f, 0.264052f, 0.277482f,
+    0.241648f, 0.217355f, 0.205276f, 0.191601f, 0.181567f,
+    0.145253f, 0.752818f, 0.390105f, 0.286637f, 0.252156f,
+    0.284764f, 0.248454f, 0.260931f, 0.223656f, 0.195699f,
+    0.182486f, 0.175643f, 0.154878f, 0.123902f, 0.618466f,
+    0.323648f, 0.23923f, 0.209072f, 0.257326f, 0.223965f,
+    0.235077f, 0.201495f, 0.176308f, 0.163968f, 0.158726f,
+    0.132165f, 0.105732f, 0.495147f, 0.256658f, 0.188836f,
+    0.167197f, 0.203931f, 0.177184f, 0.18583f, 0.159283f,
+    0.139373f, 0.129328f, 0.125969f, 0.105069f, 0.0840549f,
+    0.460419f, 0.233353f, 0.170653f, 0.15327f, 0.163683f,
+    0.142588f, 0.14955f, 0.128186f, 0.112162f, 0.104344f,
+    0.101263f, 0.0922031f, 0.0737625f, 0.457383f, 0.230949f,
+    0.168291f, 0.15142f, 0.158772f, 0.132301f, 0.138851f,
+    0.119015f, 0.105578f, 0.099748f, 0.0936583f, 0.0892612f,
+    0.071409f, 0.45713f, 0.230697f, 0.167947f, 0.151087f,
+    0.158479f, 0.128234f, 0.134738f, 0.117246f, 0.105459f,
+    0.099599f, 0.0929637f, 0.0881264f, 0.0705012f, 1.24691f,
+    0.629273f, 0.458108f, 0.412116f, 0.432281f, 0.349463f,
+    0.367237f, 0.319812f, 0.287661f, 0.271676f, 0.253576f,
+    0.240297f, 0.192237f, 1.05757f, 0.543903f, 0.398601f,
+    0.35288f, 0.382352f, 0.333865f, 0.350687f, 0.300588f,
+    0.263015f, 0.245456f, 0.235873f, 0.213608f, 0.170886f,
+    0.92322f, 0.477446f, 0.351195f, 0.309796f, 0.354914f,
+    0.309376f, 0.324832f, 0.278428f, 0.243624f, 0.226938f,
+    0.218956f, 0.190895f, 0.152716f, 0.799901f, 0.409538f,
+    0.300801f, 0.267921f, 0.301518f, 0.262595f, 0.275585f,
+    0.236216f, 0.206689f, 0.192298f, 0.186199f, 0.163799f,
+    0.131039f, 0.765172f, 0.387151f, 0.282617f, 0.253994f,
+    0.266209f, 0.227999f, 0.239305f, 0.205119f, 0.179479f,
+    0.167314f, 0.161493f, 0.150933f, 0.120746f, 0.762137f,
+    0.384747f, 0.280256f, 0.252144f, 0.264424f, 0.217712f,
+    0.228606f, 0.195948f, 0.175885f, 0.166147f, 0.155105f,
+    0.147991f, 0.118393f, 0.761884f, 0.384496f, 0.279911f,
+    0.25181f, 0.264131f, 0.213644f, 0.224493f, 0.19541f,
+    0.175766f, 0.165998f, 0.154939f, 0.146856f, 0.117485f,
+    3.53256f, 1.78276f, 1.29784f, 1.16754f, 1.22467f,
+    0.990045f, 1.0404f, 0.906043f, 0.814958f, 0.769669f,
+    0.718393f, 0.680772f, 0.544617f, 3.34322f, 1.69739f,
+    1.23833f, 1.10831f, 1.16216f, 0.974447f, 1.02385f,
+    0.877585f, 0.773043f, 0.731392f, 0.687595f, 0.654083f,
+    0.523266f, 3.20887f, 1.63093f, 1.19093f, 1.06522f,
+    1.11676f, 0.949958f, 0.997995f, 0.855425f, 0.748497f,
+    0.702842f, 0.670678f, 0.63137f, 0.505096f, 3.08555f,
+    1.56302f, 1.14053f, 1.02335f, 1.07288f, 0.903177f,
+    0.948749f, 0.813213f, 0.713262f, 0.674564f, 0.637921f,
+    0.604274f, 0.483419f, 3.05082f, 1.54064f, 1.12235f,
+    1.00942f, 1.0586f, 0.868581f, 0.912468f, 0.782426f,
+    0.704164f, 0.665245f, 0.621022f, 0.591408f, 0.473126f,
+    3.04779f, 1.53823f, 1.11999f, 1.00757f, 1.05681f,
+    0.858293f, 0.901769f, 0.7817f, 0.703181f, 0.664141f,
+    0.619922f, 0.588466f, 0.470773f, 3.04753f, 1.53798f,
+    1.11964f, 1.00724f, 1.05652f, 0.854226f, 0.897656f,
+    0.781641f, 0.703062f, 0.663992f, 0.619756f, 0.587332f,
+    0.469865f, 0.240753f, 0.193067f, 0.167952f, 0.155373f,
+    0.124546f, 0.106507f, 0.10178f, 0.112359f, 0.109578f,
+    0.103244f, 0.10361f, 0.0777072f, 0.0621657f, 0.165299f,
+    0.113711f, 0.109342f, 0.0996997f, 0.100061f, 0.0964211f,
+    0.0890713f, 0.0921892f, 0.0866377f, 0.0875355f, 0.0819884f,
+    0.0614913f, 0.049193f, 0.113348f, 0.0916142f, 0.0757029f,
+    0.0792576f, 0.0822839f, 0.0790456f, 0.0725858f, 0.0764729f,
+    0.0713085f, 0.0717825f, 0.0669582f, 0.0502187f, 0.0401749f,
+    0.0865363f, 0.0482459f, 0.0374037f, 0.040218f, 0.0463329f,
+    0.0439188f, 0.0397474f, 0.044255f, 0.0405965f, 0.0404015f,
+    0.0372852f, 0.0279639f, 0.0223711f, 0.0828785f, 0.0331514f,
+    0.0284776f, 0.0201038f, 0.0173003f, 0.0158f, 0.0162077f,
+    0.017996f, 0.0161358f, 0.0155455f, 0.0140242f, 0.0105181f,
+    0.00841449f, 0.0695866f, 0.0278346f, 0.020176f, 0.0179413f,
+    0.013456f, 0.0107648f, 0.0133547f, 0.0114468f, 0.010016f,
+    0.0102137f, 0.00851138f, 0.00638354f, 0.00643122f, 0.0292372f,
+    0.0116949f, 0.00587466f, 0.00923773f, 0.0069283f, 0.00554264f,
+    0.00568293f, 0.00487109f, 0.0042622f, 0.00399059f, 0.00332549f,
+    0.00249412f, 0.00300732f, 0.316387f, 0.253721f, 0.220716f,
+    0.204185f, 0.163673f, 0.139967f, 0.133755f, 0.147658f,
+    0.144002f, 0.135679f, 0.136159f, 0.10212f, 0.0816957f,
+    0.233079f, 0.174364f, 0.162106f, 0.147133f, 0.134748f,
+    0.129881f, 0.120138f, 0.123923f, 0.116683f, 0.11798f,
+    0.110602f, 0.0829518f, 0.0663614f, 0.181128f, 0.131214f,
+    0.116459f, 0.114675f, 0.116971f, 0.112506f, 0.103653f,
+    0.108207f, 0.101354f, 0.102227f, 0.0955722f, 0.0716792f,
+    0.0573433f, 0.109974f, 0.0878459f, 0.0721035f, 0.0756351f,
+    0.0810202f, 0.077379f, 0.0708145f, 0.0759891f, 0.0706415f,
+    0.0708463f, 0.0658992f, 0.0494244f, 0.0395395f, 0.09659f,
+    0.0616546f, 0.0545607f, 0.0504034f, 0.0519876f, 0.0492602f,
+    0.0449972f, 0.0497302f, 0.0461809f, 0.0459903f, 0.0426381f,
+    0.0319786f, 0.0255829f, 0.0832981f, 0.0607213f, 0.0529318f,
+    0.0489762f, 0.0417074f, 0.0395829f, 0.0363338f, 0.0401789f,
+    0.0375051f, 0.0373021f, 0.0346412f, 0.0259809f, 0.0207847f,
+    0.0756346f, 0.0606539f, 0.0527638f, 0.0488119f, 0.0391273f,
+    0.0340267f, 0.0319752f, 0.0352988f, 0.034425f, 0.0324352f,
+    0.0325502f, 0.0244127f, 0.0195301f, 0.392022f, 0.314375f,
+    0.27348f, 0.252996f, 0.202801f, 0.173427f, 0.16573f,
+    0.182957f, 0.178427f, 0.168114f, 0.168709f, 0.126532f,
+    0.101226f, 0.30086f, 0.235018f, 0.21487f, 0.195945f,
+    0.169436f, 0.163341f, 0.151206f, 0.155657f, 0.146728f,
+    0.148425f, 0.139216f, 0.104412f, 0.0835298f, 0.248909f,
+    0.181166f, 0.169223f, 0.153669f, 0.151659f, 0.145966f,
+    0.13472f, 0.139941f, 0.131399f, 0.132672f, 0.124186f,
+    0.0931397f, 0.0745117f, 0.177755f, 0.134385f, 0.122625f,
+    0.112351f, 0.115708f, 0.110839f, 0.101882f, 0.107723f,
+    0.100687f, 0.101291f, 0.0945132f, 0.0708849f, 0.0567079f,
+    0.152515f, 0.122308f, 0.107324f, 0.0992152f, 0.0866749f,
+    0.0827204f, 0.0760643f, 0.0814643f, 0.0762259f, 0.0764351f,
+    0.0712521f, 0.0534391f, 0.0427513f, 0.151353f, 0.121375f,
+    0.105696f, 0.097788f, 0.0783803f, 0.0730431f, 0.0674009f,
+    0.071913f, 0.0689964f, 0.0677469f, 0.0652673f, 0.0490265f,
+    0.0392212f, 0.151269f, 0.121308f, 0.105528f, 0.0976237f,
+    0.0782546f, 0.0674868f, 0.0639502f, 0.0705975f, 0.0688498f,
+    0.0648703f, 0.0651001f, 0.0488251f, 0.0390601f, 0.467656f,
+    0.375029f, 0.326244f, 0.301808f, 0.241928f, 0.206887f,
+    0.197705f, 0.218255f, 0.212852f, 0.200549f, 0.201259f,
+    0.150944f, 0.120756f, 0.36868f, 0.295672f, 0.267634f,
+    0.244757f, 0.204123f, 0.196802f, 0.182273f, 0.187392f,
+    0.176773f, 0.17887f, 0.16783f, 0.125964f, 0.100771f,
+    0.31669f, 0.24182f, 0.221986f, 0.202481f, 0.186346f,
+    0.179426f, 0.165787f, 0.171675f, 0.161444f, 0.163117f,
+    0.1528f, 0.1146f, 0.0916801f, 0.245535f, 0.195038f,
+    0.175389f, 0.161162f, 0.150395f, 0.144299f, 0.132949f,
+    0.139457f, 0.130732f, 0.131736f, 0.123127f, 0.0923454f,
+    0.0738763f, 0.22815f, 0.182962f, 0.160088f, 0.148027f,
+    0.121362f, 0.116181f, 0.107131f, 0.113198f, 0.106271f,
+    0.10688f, 0.0998661f, 0.0748996f, 0.0599197f, 0.226988f,
+    0.182029f, 0.158459f, 0.1466f, 0.117508f, 0.106503f,
+    0.098468f, 0.10604f, 0.103421f, 0.0981917f, 0.0978172f,
+    0.0734084f, 0.0587268f, 0.226904f, 0.181962f, 0.158291f,
+    0.146435f, 0.117382f, 0.100947f, 0.0959252f, 0.105896f,
+    0.103275f, 0.0973055f, 0.09765f, 0.0732375f, 0.05859f,
+    0.618926f, 0.496337f, 0.431771f, 0.399432f, 0.320182f,
+    0.273808f, 0.261655f, 0.288853f, 0.281702f, 0.26542f,
+    0.266359f, 0.199769f, 0.159815f, 0.519949f, 0.41698f,
+    0.373161f, 0.34238f, 0.274044f, 0.263722f, 0.244407f,
+    0.25086f, 0.24219f, 0.23976f, 0.229298f, 0.174728f,
+    0.139782f, 0.452793f, 0.363128f, 0.327514f, 0.300104f,
+    0.255721f, 0.246346f, 0.227921f, 0.235143f, 0.221534f,
+    0.224007f, 0.210028f, 0.157521f, 0.126017f, 0.394467f,
+    0.316346f, 0.280916f, 0.258786f, 0.21977f, 0.21122f,
+    0.195083f, 0.202926f, 0.190822f, 0.192626f, 0.180355f,
+    0.135266f, 0.108213f, 0.379419f, 0.30427f, 0.265616f,
+    0.245651f, 0.196868f, 0.183101f, 0.169266f, 0.177851f,
+    0.173398f, 0.16777f, 0.164069f, 0.12347f, 0.0987758f,
+    0.378257f, 0.303337f, 0.263987f, 0.244223f, 0.195762f,
+    0.173424f, 0.160602f, 0.176637f, 0.172271f, 0.162311f,
+    0.162917f, 0.122188f, 0.0977502f, 0.378173f, 0.303269f,
+    0.263819f, 0.244059f, 0.195636f, 0.167867f, 0.159875f,
+    0.176494f, 0.172124f, 0.162176f, 0.16275f, 0.122062f,
+    0.0976499f, 1.75345f, 1.40614f, 1.22323f, 1.13161f,
+    0.907091f, 0.77571f, 0.74128f, 0.818333f, 0.798073f,
+    0.751946f, 0.754607f, 0.565956f, 0.452765f, 1.65447f,
+    1.32679f, 1.16462f, 1.07456f, 0.860953f, 0.765624f,
+    0.710413f, 0.779649f, 0.758562f, 0.714679f, 0.717547f,
+    0.540457f, 0.432366f, 1.58731f, 1.27294f, 1.11897f,
+    1.03228f, 0.827006f, 0.748249f, 0.693928f, 0.749316f,
+    0.728927f, 0.686743f, 0.68965f, 0.520169f, 0.416135f,
+    1.52899f, 1.22615f, 1.07237f, 0.990963f, 0.794107f,
+    0.713122f, 0.661089f, 0.717955f, 0.699463f, 0.658996f,
+    0.661705f, 0.497831f, 0.398265f, 1.51394f, 1.21408f,
+    1.05707f, 0.977827f, 0.783777f, 0.685003f, 0.640935f,
+    0.707332f, 0.689771f, 0.64989f, 0.652317f, 0.489238f,
+    0.39139f, 1.51278f, 1.21314f, 1.05544f, 0.9764f,
+    0.782671f, 0.675326f, 0.63967f, 0.706118f, 0.688643f,
+    0.648837f, 0.651165f, 0.488374f, 0.390699f, 1.51269f,
+    1.21308f, 1.05528f, 0.976236f, 0.782545f, 0.66977f,
+    0.6395f, 0.705974f, 0.688496f, 0.648702f, 0.650998f,
+    0.488249f, 0.390599f, 0.162233f, 0.148585f, 0.134024f,
+    0.118249f, 0.119553f, 0.106044f, 0.102261f, 0.102172f,
+    0.0988342f, 0.0999284f, 0.100836f, 0.0756272f, 0.0605017f,
+    0.0963087f, 0.0937236f, 0.0863761f, 0.0945964f, 0.0921046f,
+    0.0863936f, 0.0837413f, 0.0780198f, 0.0735345f, 0.0820282f,
+    0.0719098f, 0.0539323f, 0.0431459f, 0.0706301f, 0.0533207f,
+    0.0608868f, 0.0745396f, 0.0737583f, 0.0699818f, 0.0680115f,
+    0.0640297f, 0.060361f, 0.0671065f, 0.0591573f, 0.044368f,
+    0.0354944f, 0.0378558f, 0.0232496f, 0.028287f, 0.0369688f,
+    0.0383368f, 0.0375582f, 0.036771f, 0.0357379f, 0.0337426f,
+    0.037482f, 0.0334887f, 0.0251165f, 0.0200932f, 0.0141398f,
+    0.00865898f, 0.00678509f, 0.0151945f, 0.0118366f, 0.0125411f,
+    0.0124558f, 0.0131254f, 0.0124193f, 0.01408f, 0.0128811f,
+    0.00966082f, 0.00772866f, 0.00472236f, 0.00609236f, 0.00342396f,
+    0.0110861f, 0.00831459f, 0.00681455f, 0.00812646f, 0.00696553f,
+    0.00609484f, 0.00926492f, 0.00772076f, 0.00579057f, 0.00541723f,
+    0.000200803f, 0.00142008f, 0.000763489f, 0.00359895f, 0.00269921f,
+    0.00216296f, 0.00379508f, 0.00325293f, 0.00284631f, 0.00380549f,
+    0.00317124f, 0.00237843f, 0.00265349f, 0.213199f, 0.195265f,
+    0.176128f, 0.155399f, 0.157112f, 0.139359f, 0.134387f,
+    0.134271f, 0.129884f, 0.131322f, 0.132515f, 0.0993861f,
+    0.0795089f, 0.147276f, 0.140403f, 0.128481f, 0.128441f,
+    0.124641f, 0.116634f, 0.112996f, 0.105069f, 0.0990366f,
+    0.110612f, 0.0968473f, 0.0735794f, 0.0588635f, 0.102057f,
+    0.1f, 0.092511f, 0.108384f, 0.106295f, 0.100222f,
+    0.0972661f, 0.0910793f, 0.0858631f, 0.0956905f, 0.0840948f,
+    0.0630711f, 0.0504569f, 0.0673336f, 0.0607401f, 0.0574536f,
+    0.0708132f, 0.0708732f, 0.0677984f, 0.0660255f, 0.0627875f,
+    0.0592447f, 0.066066f, 0.0584262f, 0.0438196f, 0.0350557f,
+    0.0518518f, 0.0482622f, 0.043969f, 0.0438786f, 0.044373f,
+    0.0427813f, 0.0417103f, 0.040175f, 0.0379214f, 0.0426641f,
+    0.0378186f, 0.0283639f, 0.0226911f, 0.0510276f, 0.0468615f,
+    0.0423715f, 0.0372979f, 0.0376997f, 0.0347226f, 0.0337494f,
+    0.0323525f, 0.0312204f, 0.0345494f, 0.0317881f, 0.0238411f,
+    0.0190729f, 0.0509669f, 0.0466797f, 0.0421056f, 0.0371494f,
+    0.0375589f, 0.033315f, 0.0321263f, 0.0321007f, 0.0310502f,
+    0.0313935f, 0.0316787f, 0.0237591f, 0.0190073f, 0.264166f,
+    0.241944f, 0.218233f, 0.192548f, 0.194671f, 0.172674f,
+    0.166513f, 0.166369f, 0.160934f, 0.162715f, 0.164193f,
+    0.123145f, 0.0985161f, 0.198242f, 0.187082f, 0.170586f,
+    0.162285f, 0.157177f, 0.146874f, 0.14225f, 0.132335f,
+    0.126756f, 0.139196f, 0.126482f, 0.0965757f, 0.0772606f,
+    0.153024f, 0.14668f, 0.134616f, 0.142228f, 0.138831f,
+    0.130462f, 0.126521f, 0.118129f, 0.111365f, 0.124275f,
+    0.109032f, 0.0817742f, 0.0654193f, 0.113261f, 0.10742f,
+    0.0984197f, 0.104658f, 0.10341f, 0.0980385f, 0.0952801f,
+    0.089837f, 0.0847468f, 0.0946501f, 0.0833637f, 0.0625227f,
+    0.0500182f, 0.102819f, 0.0949416f, 0.0860738f, 0.077723f,
+    0.0769094f, 0.0730214f, 0.0709649f, 0.0672245f, 0.063428f,
+    0.0712481f, 0.0643648f, 0.0482736f, 0.0386189f, 0.101994f,
+    0.093541f, 0.0844763f, 0.0744471f, 0.0752584f, 0.066748f,
+    0.0643593f, 0.0644477f, 0.0622701f, 0.0631335f, 0.0634667f,
+    0.0476f, 0.03808f, 0.101934f, 0.0933591f, 0.0842104f,
+    0.0742985f, 0.0751176f, 0.0666298f, 0.0642524f, 0.0641991f,
+    0.0620999f, 0.062787f, 0.0633574f, 0.047518f, 0.0380144f,
+    0.315133f, 0.288624f, 0.260338f, 0.229697f, 0.232229f,
+    0.205989f, 0.198639f, 0.198468f, 0.191983f, 0.194109f,
+    0.195872f, 0.146904f, 0.117523f, 0.249209f, 0.233762f,
+    0.21269f, 0.196129f, 0.189714f, 0.177114f, 0.171505f,
+    0.164433f, 0.157806f, 0.16778f, 0.15816f, 0.119572f,
+    0.0956576f, 0.203991f, 0.193359f, 0.176721f, 0.176073f,
+    0.171368f, 0.160702f, 0.155775f, 0.145178f, 0.136867f,
+    0.152859f, 0.13397f, 0.100559f, 0.0804473f, 0.164228f,
+    0.154099f, 0.140524f, 0.138502f, 0.135946f, 0.128279f,
+    0.124535f, 0.116887f, 0.110249f, 0.123234f, 0.108301f,
+    0.0812259f, 0.0649807f, 0.153785f, 0.141621f, 0.128179f,
+    0.112742f, 0.113943f, 0.103262f, 0.100219f, 0.0979574f,
+    0.0944777f, 0.0998322f, 0.0960435f, 0.0720326f, 0.0576261f,
+    0.152961f, 0.14022f, 0.126581f, 0.111596f, 0.112817f,
+    0.100063f, 0.0964855f, 0.0965461f, 0.0933198f, 0.0942916f,
+    0.0951454f, 0.071359f, 0.0570872f, 0.152901f, 0.140039f,
+    0.126315f, 0.111448f, 0.112676f, 0.0999446f, 0.0963786f,
+    0.0962976f, 0.0931496f, 0.0941804f, 0.095036f, 0.071277f,
+    0.0570216f, 0.417067f, 0.381982f, 0.344547f, 0.303995f,
+    0.307347f, 0.272619f, 0.262891f, 0.262665f, 0.254083f,
+    0.256896f, 0.259229f, 0.194422f, 0.155538f, 0.351143f,
+    0.327121f, 0.2969f, 0.263818f, 0.263259f, 0.237594f,
+    0.230014f, 0.22863f, 0.219905f, 0.224949f, 0.221518f,
+    0.166138f, 0.13291f, 0.305924f, 0.286718f, 0.26093f,
+    0.243761f, 0.23644f, 0.221183f, 0.214284f, 0.20149f,
+    0.193351f, 0.210027f, 0.194043f, 0.146552f, 0.117241f,
+    0.266162f, 0.247458f, 0.224734f, 0.206191f, 0.201019f,
+    0.188759f, 0.183044f, 0.172622f, 0.165988f, 0.180402f,
+    0.167649f, 0.125737f, 0.100589f, 0.255719f, 0.23498f,
+    0.212388f, 0.187041f, 0.189061f, 0.167656f, 0.161627f,
+    0.162154f, 0.156577f, 0.157981f, 0.159401f, 0.11955f,
+    0.0956404f, 0.254895f, 0.233579f, 0.21079f, 0.185895f,
+    0.187935f, 0.166692f, 0.160738f, 0.160743f, 0.155419f,
+    0.157078f, 0.158503f, 0.118877f, 0.0951016f, 0.254834f,
+    0.233397f, 0.210525f, 0.185746f, 0.187794f, 0.166574f,
+    0.160631f, 0.160494f, 0.155249f, 0.156967f, 0.158393f,
+    0.118795f, 0.095036f, 1.18157f, 1.08217f, 0.976118f,
+    0.861233f, 0.870728f, 0.772341f, 0.744784f, 0.744141f,
+    0.719828f, 0.727797f, 0.734409f, 0.550807f, 0.440645f,
+    1.11565f, 1.02731f, 0.928471f, 0.817773f, 0.82664f,
+    0.732941f, 0.706342f, 0.710107f, 0.68565f, 0.690514f,
+    0.696697f, 0.522523f, 0.418018f, 1.07043f, 0.986909f,
+    0.892501f, 0.785691f, 0.794157f, 0.704073f, 0.678447f,
+    0.682966f, 0.659097f, 0.663305f, 0.669223f, 0.501917f,
+    0.401534f, 1.03067f, 0.947649f, 0.856305f, 0.75435f,
+    0.762527f, 0.676167f, 0.651783f, 0.654099f, 0.631733f,
+    0.637105f, 0.642828f, 0.482121f, 0.385697f, 1.02022f,
+    0.935171f, 0.843959f, 0.744278f, 0.752442f, 0.667379f,
+    0.643519f, 0.643631f, 0.622323f, 0.628882f, 0.63458f,
+    0.475935f, 0.380748f, 1.0194f, 0.933771f, 0.842362f,
+    0.743132f, 0.751316f, 0.666415f, 0.64263f, 0.642219f,
+    0.621165f, 0.62798f, 0.633682f, 0.475262f, 0.380209f,
+    1.01934f, 0.933589f, 0.842096f, 0.742984f, 0.751175f,
+    0.666297f, 0.642523f, 0.641971f, 0.620994f, 0.627869f,
+    0.633573f, 0.47518f, 0.380144f, 0.134577f, 0.138922f,
+    0.12244f, 0.110743f, 0.106635f, 0.101526f, 0.104462f,
+    0.100495f, 0.0976595f, 0.100309f, 0.0980544f, 0.0745792f,
+    0.0598172f, 0.088987f, 0.0937841f, 0.0789275f, 0.0886174f,
+    0.082315f, 0.0719743f, 0.0729457f, 0.0735251f, 0.0701014f,
+    0.0775976f, 0.0742202f, 0.0556651f, 0.0445321f, 0.0571676f,
+    0.076128f, 0.063078f, 0.0704895f, 0.0663845f, 0.0577023f,
+    0.0581034f, 0.0598037f, 0.0569567f, 0.0626627f, 0.0608344f,
+    0.0456258f, 0.0365006f, 0.0541507f, 0.0403358f, 0.0325567f,
+    0.0358296f, 0.0348478f, 0.0299206f, 0.029687f, 0.0324001f,
+    0.030749f, 0.0338059f, 0.033939f, 0.0254542f, 0.0203634f,
+    0.0607692f, 0.0243077f, 0.0121538f, 0.0103169f, 0.0108009f,
+    0.00968262f, 0.00874235f, 0.0109094f, 0.0102515f, 0.0117225f,
+    0.0124263f, 0.00931972f, 0.0093011f, 0.060556f, 0.0242224f,
+    0.0121112f, 0.00807414f, 0.0060556f, 0.00484448f, 0.00586715f,
+    0.00671017f, 0.00650931f, 0.00979261f, 0.00816051f, 0.00612038f,
+    0.00794143f, 0.0485506f, 0.0194202f, 0.00971012f, 0.00647341f,
+    0.00485506f, 0.00388405f, 0.00411976f, 0.00439684f, 0.00399593f,
+    0.00519026f, 0.00432522f, 0.00324391f, 0.00374914f, 0.176856f,
+    0.182565f, 0.160906f, 0.145533f, 0.140135f, 0.133421f,
+    0.13728f, 0.132066f, 0.12834f, 0.131822f, 0.128859f,
+    0.0980089f, 0.0786094f, 0.131266f, 0.131658f, 0.113278f,
+    0.120067f, 0.111166f, 0.0973467f, 0.0989193f, 0.0991752f,
+    0.094835f, 0.104937f, 0.100018f, 0.0750136f, 0.0600109f,
+    0.0951799f, 0.108766f, 0.0910041f, 0.101939f, 0.0952359f,
+    0.0830748f, 0.0839728f, 0.0854538f, 0.0814316f, 0.0900019f,
+    0.0866324f, 0.0649743f, 0.0519794f, 0.0612488f, 0.0729739f,
+    0.0604829f, 0.0672792f, 0.0636992f, 0.0552931f, 0.0555563f,
+    0.0580502f, 0.0552239f, 0.0611451f, 0.059737f, 0.0448027f,
+    0.0358422f, 0.0678673f, 0.0450638f, 0.0394066f, 0.0417665f,
+    0.0395352f, 0.0343743f, 0.0345595f, 0.0365595f, 0.0347264f,
+    0.0390617f, 0.0382243f, 0.0286682f, 0.0229346f, 0.0676541f,
+    0.0437905f, 0.038555f, 0.0349612f, 0.0336393f, 0.0320224f,
+    0.0329475f, 0.0316961f, 0.0308656f, 0.0318159f, 0.0309417f,
+    0.0236687f, 0.018935f, 0.0556487f, 0.0436436f, 0.0384658f,
+    0.034791f, 0.0335006f, 0.0318954f, 0.032818f, 0.0315716f,
+    0.0306815f, 0.0315133f, 0.0308049f, 0.0234308f, 0.0187925f,
+    0.219134f, 0.226208f, 0.199372f, 0.180324f, 0.173636f,
+    0.165316f, 0.170098f, 0.163638f, 0.159021f, 0.163335f,
+    0.159664f, 0.121439f, 0.0974015f, 0.173544f, 0.175301f,
+    0.151466f, 0.151517f, 0.140018f, 0.128086f, 0.131737f,
+    0.126759f, 0.125516f, 0.132276f, 0.125816f, 0.098323f,
+    0.0786584f, 0.137459f, 0.141404f, 0.11893f, 0.133389f,
+    0.124087f, 0.108447f, 0.109842f, 0.111104f, 0.105907f,
+    0.117341f, 0.11243f, 0.0843228f, 0.0674583f, 0.0995694f,
+    0.105612f, 0.088409f, 0.0987289f, 0.0925506f, 0.0806656f,
+    0.0814256f, 0.0837003f, 0.0796988f, 0.0884843f, 0.085535f,
+    0.0641513f, 0.051321f, 0.0863391f, 0.0887073f, 0.0778723f,
+    0.0732162f, 0.0683866f, 0.0648933f, 0.0667637f, 0.0642293f,
+    0.0627322f, 0.0664008f, 0.0640223f, 0.0483923f, 0.0387138f,
+    0.0847537f, 0.087434f, 0.0770207f, 0.069752f, 0.0671397f,
+    0.0639176f, 0.0657653f, 0.0632675f, 0.0615462f, 0.0631622f,
+    0.0617464f, 0.0470985f, 0.0377017f, 0.0845573f, 0.0872871f,
+    0.0769315f, 0.0695819f, 0.067001f, 0.0637906f, 0.0656358f,
+    0.063143f, 0.0613621f, 0.0630264f, 0.0616097f, 0.0468605f,
+    0.0375847f, 0.261413f, 0.269852f, 0.237837f, 0.215115f,
+    0.207136f, 0.197211f, 0.202916f, 0.195209f, 0.189701f,
+    0.194848f, 0.190468f, 0.144868f, 0.116194f, 0.215823f,
+    0.218945f, 0.189932f, 0.182966f, 0.168869f, 0.159982f,
+    0.164555f, 0.15833f, 0.156196f, 0.159615f, 0.154889f,
+    0.121753f, 0.0974022f, 0.179737f, 0.181125f, 0.156189f,
+    0.164838f, 0.152939f, 0.13382f, 0.136173f, 0.136754f,
+    0.130381f, 0.14468f, 0.138228f, 0.103671f, 0.0829371f,
+    0.141848f, 0.144109f, 0.125241f, 0.130179f, 0.121402f,
+    0.106038f, 0.108449f, 0.10935f, 0.104174f, 0.115823f,
+    0.111333f, 0.0834998f, 0.0667998f, 0.128618f, 0.132351f,
+    0.116338f, 0.105791f, 0.101681f, 0.0967885f, 0.0995815f,
+    0.0958007f, 0.0934129f, 0.0956827f, 0.0935525f, 0.071822f,
+    0.0574576f, 0.127032f, 0.131077f, 0.115486f, 0.104543f,
+    0.10064f, 0.0958129f, 0.0985831f, 0.0948389f, 0.0922269f,
+    0.0946753f, 0.0925511f, 0.0705282f, 0.0564939f, 0.126836f,
+    0.130931f, 0.115397f, 0.104373f, 0.100501f, 0.0956859f,
+    0.0984536f, 0.0947144f, 0.0920427f, 0.0945395f, 0.0924143f,
+    0.0702903f, 0.0563768f, 0.34597f, 0.357139f, 0.314769f,
+    0.284697f, 0.274137f, 0.261002f, 0.268551f, 0.258352f,
+    0.251062f, 0.257875f, 0.252078f, 0.191728f, 0.153778f,
+    0.30038f, 0.306232f, 0.266863f, 0.245866f, 0.235099f,
+    0.223772f, 0.23019f, 0.221473f, 0.217557f, 0.2213f,
+    0.216499f, 0.168612f, 0.13489f, 0.264294f, 0.268411f,
+    0.233121f, 0.227738f, 0.210641f, 0.196197f, 0.201809f,
+    0.194171f, 0.191379f, 0.199359f, 0.189958f, 0.149223f,
+    0.119379f, 0.226405f, 0.231396f, 0.202173f, 0.193078f,
+    0.179105f, 0.169224f, 0.174084f, 0.167484f, 0.164219f,
+    0.170502f, 0.163732f, 0.127341f, 0.101872f, 0.213175f,
+    0.219638f, 0.193269f, 0.175372f, 0.168682f, 0.160579f,
+    0.165217f, 0.158943f, 0.154774f, 0.158709f, 0.155162f,
+    0.118682f, 0.0949452f, 0.211589f, 0.218364f, 0.192418f,
+    0.174124f, 0.167641f, 0.159603f, 0.164219f, 0.157982f,
+    0.153588f, 0.157701f, 0.15416f, 0.117388f, 0.0940781f,
+    0.211393f, 0.218218f, 0.192329f, 0.173954f, 0.167502f,
+    0.159476f, 0.164089f, 0.157857f, 0.153404f, 0.157566f,
+    0.154024f, 0.11715f, 0.0939611f, 0.980149f, 1.01179f,
+    0.891754f, 0.806559f, 0.776643f, 0.73943f, 0.760818f,
+    0.731923f, 0.711272f, 0.73057f, 0.714148f, 0.543174f,
+    0.43566f, 0.934559f, 0.960884f, 0.843849f, 0.767675f,
+    0.737605f, 0.7022f, 0.722457f, 0.695044f, 0.677767f,
+    0.693996f, 0.678569f, 0.520058f, 0.416047f, 0.898473f,
+    0.923064f, 0.810106f, 0.737879f, 0.708664f, 0.674626f,
+    0.694076f, 0.667741f, 0.651588f, 0.666824f, 0.652028f,
+    0.500669f, 0.400535f, 0.860584f, 0.886048f, 0.779159f,
+    0.707544f, 0.680311f, 0.647652f, 0.666351f, 0.641055f,
+    0.624428f, 0.640091f, 0.625803f, 0.478787f, 0.383029f,
+    0.847354f, 0.87429f, 0.770255f, 0.697234f, 0.671188f,
+    0.639007f, 0.657484f, 0.632514f, 0.614983f, 0.631405f,
+    0.617233f, 0.470128f, 0.376698f, 0.845768f, 0.873017f,
+    0.769404f, 0.695987f, 0.670146f, 0.638032f, 0.656485f,
+    0.631553f, 0.613797f, 0.630398f, 0.616231f, 0.468834f,
+    0.37596f, 0.845572f, 0.87287f, 0.769314f, 0.695816f,
+    0.670008f, 0.637905f, 0.656356f, 0.631428f, 0.613613f,
+    0.630262f, 0.616094f, 0.468596f, 0.375843f, 0.142353f,
+    0.118329f, 0.109044f, 0.104575f, 0.103868f, 0.103773f,
+    0.100696f, 0.0976198f, 0.094398f, 0.101468f, 0.096376f,
+    0.0733257f, 0.0590985f, 0.0896734f, 0.085673f, 0.0882766f,
+    0.0856643f, 0.079924f, 0.0789551f, 0.0768802f, 0.0751795f,
+    0.0740123f, 0.0786869f, 0.0729796f, 0.0547347f, 0.0437878f,
+    0.0581744f, 0.069946f, 0.0717578f, 0.0696722f, 0.065159f,
+    0.064219f, 0.0622806f, 0.0611963f, 0.0604566f, 0.0635764f,
+    0.0601236f, 0.0450927f, 0.0360741f, 0.0310721f, 0.0375098f,
+    0.038135f, 0.0370829f, 0.0348561f, 0.0342474f, 0.0330365f,
+    0.0328308f, 0.032856f, 0.0344174f, 0.0340458f, 0.0255344f,
+    0.0204275f, 0.0179065f, 0.011712f, 0.0117532f, 0.0114621f,
+    0.010846f, 0.0106415f, 0.0102654f, 0.0104075f, 0.0108154f,
+    0.011887f, 0.0126989f, 0.00952416f, 0.00899832f, 0.016729f,
+    0.00669162f, 0.00506906f, 0.00594601f, 0.00445951f, 0.00373933f,
+    0.00428543f, 0.00600038f, 0.00593402f, 0.00844375f, 0.00703646f,
+    0.0055068f, 0.00704986f, 0.0138292f, 0.00553168f, 0.00276584f,
+    0.00532323f, 0.00399242f, 0.00319394f, 0.0029882f, 0.0041999f,
+    0.00401417f, 0.00427558f, 0.00356298f, 0.00267224f, 0.00268658f,
+    0.187074f, 0.155503f, 0.143301f, 0.137428f, 0.136499f,
+    0.136375f, 0.132331f, 0.128288f, 0.124054f, 0.133346f,
+    0.126653f, 0.0963616f, 0.0776648f, 0.134395f, 0.115315f,
+    0.118948f, 0.115417f, 0.107622f, 0.106397f, 0.10373f,
+    0.101326f, 0.0997075f, 0.106455f, 0.0982922f, 0.0739137f,
+    0.059131f, 0.0955365f, 0.0995876f, 0.102429f, 0.0994249f,
+    0.0928572f, 0.0916614f, 0.0891307f, 0.0873431f, 0.0861519f,
+    0.0913442f, 0.0854361f, 0.0640771f, 0.0512617f, 0.0578569f,
+    0.0671514f, 0.0688063f, 0.0668356f, 0.0625543f, 0.0616899f,
+    0.0598865f, 0.0589776f, 0.0585512f, 0.0621851f, 0.0593584f,
+    0.0445188f, 0.035615f, 0.0460897f, 0.0413535f, 0.0424245f,
+    0.0412147f, 0.0385441f, 0.0380839f, 0.0371155f, 0.0365543f,
+    0.0365107f, 0.0396548f, 0.0380115f, 0.0285086f, 0.0228069f,
+    0.0448559f, 0.0373626f, 0.0343545f, 0.0331529f, 0.0327683f,
+    0.0327277f, 0.0317643f, 0.0308645f, 0.0297872f, 0.0321987f,
+    0.0304199f, 0.0233013f, 0.018689f, 0.0447215f, 0.0371746f,
+    0.0342572f, 0.0328536f, 0.0326314f, 0.0326016f, 0.0316349f,
+    0.0306691f, 0.0296562f, 0.0318775f, 0.0302777f, 0.0230372f,
+    0.0185667f, 0.231796f, 0.192677f, 0.177558f, 0.170282f,
+    0.169131f, 0.168976f, 0.163966f, 0.158956f, 0.15371f,
+    0.165223f, 0.156931f, 0.119398f, 0.0962311f, 0.179116f,
+    0.149498f, 0.149619f, 0.14517f, 0.13532f, 0.13384f,
+    0.13058f, 0.127473f, 0.125403f, 0.134222f, 0.123605f,
+    0.0969497f, 0.0775597f, 0.140258f, 0.129229f, 0.1331f,
+    0.129178f, 0.120555f, 0.119104f, 0.115981f, 0.11349f,
+    0.111847f, 0.119112f, 0.110749f, 0.0830615f, 0.0664492f,
+    0.102578f, 0.0967929f, 0.0994776f, 0.0965882f, 0.0902524f,
+    0.0891323f, 0.0867366f, 0.0851243f, 0.0842465f, 0.0899529f,
+    0.084671f, 0.0635032f, 0.0508026f, 0.0908111f, 0.075775f,
+    0.0730958f, 0.0709673f, 0.0664158f, 0.0663034f, 0.0643695f,
+    0.0627576f, 0.0622059f, 0.0674225f, 0.063324f, 0.0477013f,
+    0.038161f, 0.0895773f, 0.0745366f, 0.0686117f, 0.0658447f,
+    0.0653995f, 0.0653291f, 0.063399f, 0.0615327f, 0.0594344f,
+    0.0638946f, 0.0606973f, 0.0463373f, 0.0372553f, 0.0894429f,
+    0.0743486f, 0.0685144f, 0.0657068f, 0.0652626f, 0.065203f,
+    0.0632696f, 0.0613373f, 0.0593122f, 0.0637547f, 0.0605551f,
+    0.0460732f, 0.037133f, 0.276517f, 0.229851f, 0.211815f,
+    0.203135f, 0.201762f, 0.201578f, 0.1956f, 0.189624f,
+    0.183366f, 0.1971f, 0.187208f, 0.142434f, 0.114797f,
+    0.223838f, 0.186672f, 0.18029f, 0.174922f, 0.16366f,
+    0.163273f, 0.158588f, 0.156173f, 0.151378f, 0.16199f,
+    0.152531f, 0.119986f, 0.0959885f, 0.184979f, 0.158871f,
+    0.163772f, 0.15893f, 0.148254f, 0.146546f, 0.142831f,
+    0.139637f, 0.137542f, 0.14688f, 0.136061f, 0.102046f,
+    0.0816367f, 0.1473f, 0.126435f, 0.130149f, 0.126341f,
+    0.117951f, 0.116575f, 0.113587f, 0.111271f, 0.109942f,
+    0.117721f, 0.109984f, 0.0824876f, 0.0659901f, 0.135533f,
+    0.112949f, 0.103767f, 0.10072f, 0.099047f, 0.0989048f,
+    0.0960042f, 0.0934258f, 0.0902188f, 0.0967991f, 0.0919947f,
+    0.0707372f, 0.0565898f, 0.134299f, 0.111711f, 0.102869f,
+    0.098698f, 0.0980307f, 0.0979305f, 0.0950336f, 0.0922009f,
+    0.0890904f, 0.0957719f, 0.0909748f, 0.0693732f, 0.0558216f,
+    0.134164f, 0.111523f, 0.102772f, 0.0985601f, 0.0978937f,
+    0.0978044f, 0.0949043f, 0.0920054f, 0.0889682f, 0.0956319f,
+    0.0908325f, 0.0691091f, 0.0556994f, 0.36596f, 0.304199f,
+    0.28033f, 0.268842f, 0.267024f, 0.26678f, 0.25887f,
+    0.250961f, 0.242678f, 0.260855f, 0.247763f, 0.188505f,
+    0.15193f, 0.313281f, 0.26102f, 0.241633f, 0.234427f,
+    0.228923f, 0.228476f, 0.221857f, 0.217509f, 0.210587f,
+    0.223927f, 0.213086f, 0.166057f, 0.132846f, 0.274422f,
+    0.229024f, 0.225114f, 0.218435f, 0.20365f, 0.201431f,
+    0.196531f, 0.19193f, 0.188933f, 0.202415f, 0.187054f,
+    0.147139f, 0.117711f, 0.236743f, 0.19758f, 0.191492f,
+    0.185846f, 0.173347f, 0.172823f, 0.16782f, 0.164285f,
+    0.161332f, 0.173256f, 0.161128f, 0.125559f, 0.100447f,
+    0.224975f, 0.187297f, 0.172248f, 0.165422f, 0.164309f,
+    0.164108f, 0.159274f, 0.154762f, 0.149427f, 0.160554f,
+    0.15255f, 0.116809f, 0.0937148f, 0.223742f, 0.186059f,
+    0.171383f, 0.164404f, 0.163293f, 0.163133f, 0.158303f,
+    0.153537f, 0.148402f, 0.159526f, 0.15153f, 0.115445f,
+    0.0929542f, 0.223607f, 0.185871f, 0.171286f, 0.164267f,
+    0.163156f, 0.163007f, 0.158174f, 0.153342f, 0.14828f,
+    0.159386f, 0.151387f, 0.115181f, 0.092832f, 1.03678f,
+    0.861809f, 0.794187f, 0.761641f, 0.756491f, 0.755801f,
+    0.73339f, 0.710983f, 0.687518f, 0.739013f, 0.701924f,
+    0.534045f, 0.430425f, 0.984102f, 0.818631f, 0.752503f,
+    0.723264f, 0.71839f, 0.717497f, 0.696377f, 0.677532f,
+    0.654649f, 0.702085f, 0.667247f, 0.511597f, 0.410143f,
+    0.945244f, 0.786634f, 0.722623f, 0.694875f, 0.690208f,
+    0.689277f, 0.669031f, 0.651432f, 0.629533f, 0.674609f,
+    0.641215f, 0.492678f, 0.394379f, 0.907564f, 0.75519f,
+    0.694545f, 0.667127f, 0.662645f, 0.661844f, 0.64234f,
+    0.624308f, 0.602984f, 0.647531f, 0.615289f, 0.471099f,
+    0.378004f, 0.895797f, 0.744908f, 0.686105f, 0.658221f,
+    0.653777f, 0.653129f, 0.633794f, 0.614785f, 0.594161f,
+    0.638712f, 0.60671f, 0.462348f, 0.37221f, 0.894563f,
+    0.743669f, 0.685241f, 0.657203f, 0.65276f, 0.652154f,
+    0.632823f, 0.61356f, 0.593242f, 0.637685f, 0.605691f,
+    0.460984f, 0.371449f, 0.894429f, 0.743481f, 0.685144f,
+    0.657066f, 0.652623f, 0.652028f, 0.632694f, 0.613364f,
+    0.59312f, 0.637545f, 0.605548f, 0.46072f, 0.371327f,
+    0.137777f, 0.107489f, 0.107363f, 0.105518f, 0.105244f,
+    0.103304f, 0.0989863f, 0.0970667f, 0.0941675f, 0.097721f,
+    0.0915091f, 0.0689347f, 0.0559232f, 0.088352f, 0.084998f,
+    0.0815088f, 0.0781379f, 0.0816934f, 0.0811448f, 0.0776796f,
+    0.0760011f, 0.0731536f, 0.0773786f, 0.0704104f, 0.0528078f,
+    0.0422462f, 0.0694472f, 0.0689578f, 0.0660083f, 0.0635995f,
+    0.0668226f, 0.0668666f, 0.0639041f, 0.062633f, 0.060319f,
+    0.0628905f, 0.0586422f, 0.0439816f, 0.0351853f, 0.0372307f,
+    0.0362475f, 0.0346085f, 0.0338863f, 0.0360319f, 0.0368693f,
+    0.0352374f, 0.0348878f, 0.033757f, 0.0352073f, 0.0348305f,
+    0.0261229f, 0.0208983f, 0.0165935f, 0.0107367f, 0.0102423f,
+    0.0104325f, 0.0113474f, 0.0122622f, 0.0117825f, 0.0120347f,
+    0.0117777f, 0.0131023f, 0.014423f, 0.0108173f, 0.00907506f,
+    0.0110978f, 0.00479025f, 0.00455342f, 0.00385227f, 0.0047134f,
+    0.00414722f, 0.00386513f, 0.00415063f, 0.00524045f, 0.00866394f,
+    0.00721995f, 0.00541496f, 0.00625993f, 0.00385322f, 0.0015427f,
+    0.00119647f, 0.00205336f, 0.00273309f, 0.00218648f, 0.00319593f,
+    0.00320626f, 0.00370564f, 0.00409484f, 0.00341237f, 0.00255928f,
+    0.00204742f, 0.181061f, 0.141258f, 0.141092f, 0.138668f,
+    0.138308f, 0.135758f, 0.130084f, 0.127561f, 0.123751f,
+    0.128421f, 0.120258f, 0.090591f, 0.073492f, 0.131636f,
+    0.114532f, 0.109891f, 0.105261f, 0.109932f, 0.109052f,
+    0.104476f, 0.102231f, 0.0984261f, 0.104775f, 0.0948291f,
+    0.0711218f, 0.0568974f, 0.098534f, 0.0984917f, 0.0943902f,
+    0.0907222f, 0.0950609f, 0.0947741f, 0.0907003f, 0.0888626f,
+    0.0855913f, 0.090287f, 0.0830608f, 0.0622956f, 0.0498365f,
+    0.0663176f, 0.0657813f, 0.0629903f, 0.0610089f, 0.0642702f,
+    0.0647768f, 0.0620336f, 0.0611175f, 0.0590295f, 0.0626038f,
+    0.0592492f, 0.0444369f, 0.0355495f, 0.0451141f, 0.0402705f,
+    0.0386241f, 0.0375552f, 0.0395858f, 0.0401696f, 0.0385786f,
+    0.0382643f, 0.0370501f, 0.0404988f, 0.0388417f, 0.0291313f,
+    0.023305f, 0.0435308f, 0.0338903f, 0.0338675f, 0.0332786f,
+    0.0332048f, 0.0325923f, 0.0312259f, 0.0306263f, 0.0297079f,
+    0.0325606f, 0.030772f, 0.023079f, 0.0184632f, 0.0432845f,
+    0.033769f, 0.0337292f, 0.0331497f, 0.0330637f, 0.0324541f,
+    0.0310977f, 0.0304947f, 0.0295838f, 0.0307002f, 0.0287487f,
+    0.0216581f, 0.0175693f, 0.224345f, 0.175027f, 0.174821f,
+    0.171817f, 0.171371f, 0.168211f, 0.161181f, 0.158056f,
+    0.153335f, 0.159121f, 0.149006f, 0.112247f, 0.0910608f,
+    0.17492f, 0.144066f, 0.138273f, 0.132863f, 0.13817f,
+    0.13696f, 0.131272f, 0.12846f, 0.123699f, 0.132172f,
+    0.119248f, 0.0914463f, 0.073157f, 0.1379f, 0.128026f,
+    0.122772f, 0.117845f, 0.123299f, 0.122682f, 0.117496f,
+    0.115092f, 0.110864f, 0.117683f, 0.107479f, 0.0806096f,
+    0.0644877f, 0.100905f, 0.0953151f, 0.0913721f, 0.0881316f,
+    0.0925085f, 0.0926843f, 0.0888297f, 0.0873471f, 0.0843019f,
+    0.0900003f, 0.0836678f, 0.062751f, 0.0502007f, 0.0883981f,
+    0.0698044f, 0.0686286f, 0.0674231f, 0.0678241f, 0.0680772f,
+    0.0653748f, 0.064494f, 0.0623225f, 0.0678953f, 0.0632604f,
+    0.0474453f, 0.0379562f, 0.0868148f, 0.0676591f, 0.0675965f,
+    0.0664281f, 0.0662682f, 0.0650461f, 0.0623234f, 0.0611208f,
+    0.0592915f, 0.0615423f, 0.0576476f, 0.0436114f, 0.035274f,
+    0.0865685f, 0.0675378f, 0.0674582f, 0.0662993f, 0.0661271f,
+    0.0649079f, 0.0621952f, 0.0609891f, 0.0591674f, 0.0614001f,
+    0.0574972f, 0.0433146f, 0.035138f, 0.267629f, 0.208796f,
+    0.20855f, 0.204967f, 0.204434f, 0.200665f, 0.192279f,
+    0.18855f, 0.182918f, 0.189821f, 0.177754f, 0.133904f,
+    0.10863f, 0.218204f, 0.1736f, 0.168878f, 0.166013f,
+    0.166408f, 0.164867f, 0.158068f, 0.15469f, 0.149692f,
+    0.159568f, 0.145549f, 0.113103f, 0.0904822f, 0.181184f,
+    0.157559f, 0.151154f, 0.144968f, 0.151538f, 0.150589f,
+    0.144293f, 0.141322f, 0.136136f, 0.14508f, 0.131898f,
+    0.0989236f, 0.0791389f, 0.144189f, 0.124849f, 0.119754f,
+    0.115254f, 0.120747f, 0.120592f, 0.115626f, 0.113577f,
+    0.109574f, 0.117397f, 0.108087f, 0.0810649f, 0.0648519f,
+    0.131682f, 0.102402f, 0.102358f, 0.100573f, 0.100361f,
+    0.0985132f, 0.0943833f, 0.0926315f, 0.0898078f, 0.0952918f,
+    0.087679f, 0.0666855f, 0.0536451f, 0.130099f, 0.101428f,
+    0.101325f, 0.0995777f, 0.0993317f, 0.0974999f, 0.0934209f,
+    0.0916152f, 0.088875f, 0.0922423f, 0.0863961f, 0.0652678f,
+    0.0528428f, 0.129852f, 0.101307f, 0.101187f, 0.0994489f,
+    0.0991906f, 0.0973617f, 0.0932927f, 0.0914835f, 0.088751f,
+    0.0921001f, 0.0862456f, 0.064971f, 0.0527068f, 0.354197f,
+    0.276334f, 0.276008f, 0.271266f, 0.270561f, 0.265573f,
+    0.254474f, 0.249539f, 0.242085f, 0.251221f, 0.235251f,
+    0.177217f, 0.143767f, 0.304772f, 0.236324f, 0.236336f,
+    0.232312f, 0.231865f, 0.227635f, 0.218157f, 0.215376f,
+    0.208396f, 0.216082f, 0.203046f, 0.156416f, 0.125132f,
+    0.267752f, 0.216627f, 0.207917f, 0.203627f, 0.208014f,
+    0.206404f, 0.197885f, 0.193781f, 0.186681f, 0.199873f,
+    0.180735f, 0.138836f, 0.111068f, 0.230757f, 0.183917f,
+    0.178862f, 0.175741f, 0.177223f, 0.176407f, 0.169218f,
+    0.166036f, 0.160119f, 0.17219f, 0.156924f, 0.118527f,
+    0.0948216f, 0.21825f, 0.169939f, 0.169816f, 0.166872f,
+    0.166488f, 0.163421f, 0.156578f, 0.153576f, 0.148975f,
+    0.154674f, 0.144944f, 0.109998f, 0.0887826f, 0.216667f,
+    0.168966f, 0.168783f, 0.165877f, 0.165458f, 0.162408f,
+    0.155616f, 0.152604f, 0.148042f, 0.153642f, 0.143893f,
+    0.108581f, 0.0879804f, 0.21642f, 0.168844f, 0.168645f,
+    0.165748f, 0.165317f, 0.162269f, 0.155488f, 0.152472f,
+    0.147918f, 0.1535f, 0.143743f, 0.108284f, 0.0878444f,
+    1.00346f, 0.782865f, 0.781942f, 0.768509f, 0.766513f,
+    0.75238f, 0.720936f, 0.706955f, 0.685839f, 0.71172f,
+    0.666478f, 0.502064f, 0.407299f, 0.954031f, 0.742856f,
+    0.742271f, 0.729555f, 0.727816f, 0.714443f, 0.684619f,
+    0.671843f, 0.651512f, 0.676581f, 0.634272f, 0.481262f,
+    0.388602f, 0.917012f, 0.713584f, 0.713119f, 0.70087f,
+    0.699259f, 0.686417f, 0.657753f, 0.645888f, 0.625978f,
+    0.650184f, 0.609687f, 0.463682f, 0.37382f, 0.880016f,
+    0.685344f, 0.684796f, 0.672984f, 0.67139f, 0.659036f,
+    0.631481f, 0.619395f, 0.600859f, 0.623877f, 0.584697f,
+    0.443374f, 0.358101f, 0.867509f, 0.676472f, 0.67575f,
+    0.664115f, 0.662439f, 0.650228f, 0.62304f, 0.610992f,
+    0.592728f, 0.615173f, 0.57617f, 0.434845f, 0.352314f,
+    0.865926f, 0.675498f, 0.674718f, 0.66312f, 0.661409f,
+    0.649215f, 0.622078f, 0.61002f, 0.591796f, 0.614141f,
+    0.575119f, 0.433427f, 0.351512f, 0.865679f, 0.675376f,
+    0.67458f, 0.662991f, 0.661269f, 0.649077f, 0.62195f,
+    0.609888f, 0.591672f, 0.613999f, 0.574969f, 0.433131f,
+    0.351376f, 0.106782f, 0.110154f, 0.105403f, 0.105531f,
+    0.10329f, 0.101372f, 0.0999646f, 0.0944858f, 0.0914871f,
+    0.0903754f, 0.0816757f, 0.0612568f, 0.0496351f, 0.0737649f,
+    0.0824381f, 0.085833f, 0.0818098f, 0.0806492f, 0.0802886f,
+    0.0767164f, 0.0748362f, 0.071038f, 0.0721263f, 0.0638881f,
+    0.0479161f, 0.0383329f, 0.0598738f, 0.0667347f, 0.0692035f,
+    0.0662115f, 0.0656514f, 0.0654062f, 0.0628576f, 0.0616336f,
+    0.0585927f, 0.0586277f, 0.0532823f, 0.0399617f, 0.0319694f,
+    0.0317671f, 0.0351303f, 0.0362572f, 0.0350641f, 0.0354313f,
+    0.035671f, 0.0349679f, 0.0349476f, 0.0336376f, 0.0338574f,
+    0.0330031f, 0.0247523f, 0.0198019f, 0.012657f, 0.0106866f,
+    0.0109497f, 0.0108189f, 0.0114082f, 0.0118705f, 0.012173f,
+    0.0127168f, 0.0127103f, 0.0137602f, 0.0155318f, 0.0116489f,
+    0.00931909f, 0.0065456f, 0.00517583f, 0.00439698f, 0.00415779f,
+    0.00412808f, 0.00513725f, 0.00470555f, 0.00657322f, 0.00666772f,
+    0.0101714f, 0.00847618f, 0.00635714f, 0.00508571f, 0.00238905f,
+    0.00130742f, 0.000804737f, 0.00132891f, 0.00286018f, 0.00426346f,
+    0.0038103f, 0.00449644f, 0.00431927f, 0.00438376f, 0.00365313f,
+    0.00273985f, 0.00219188f, 0.140329f, 0.14476f, 0.138516f,
+    0.138684f, 0.135739f, 0.133219f, 0.131369f, 0.124169f,
+    0.120229f, 0.118768f, 0.107335f, 0.0805012f, 0.0652284f,
+    0.101268f, 0.111195f, 0.11593f, 0.110422f, 0.108769f,
+    0.108355f, 0.103464f, 0.10088f, 0.0958062f, 0.09798f,
+    0.0863416f, 0.0647562f, 0.0518049f, 0.0855544f, 0.0954918f,
+    0.0993005f, 0.0948241f, 0.0937708f, 0.0934722f, 0.0896047f,
+    0.0876773f, 0.0833608f, 0.0844815f, 0.0757357f, 0.0568018f,
+    0.0454415f, 0.0574476f, 0.0638874f, 0.0663542f, 0.0636767f,
+    0.0635507f, 0.063737f, 0.0617151f, 0.0609912f, 0.0584058f,
+    0.0597112f, 0.0554566f, 0.0415924f, 0.0332739f, 0.0354534f,
+    0.0393638f, 0.0410466f, 0.0394314f, 0.0395276f, 0.0399364f,
+    0.0389201f, 0.0387605f, 0.0374784f, 0.0396139f, 0.0379853f,
+    0.028489f, 0.0227912f, 0.0336755f, 0.034747f, 0.0332513f,
+    0.0332924f, 0.032583f, 0.0319816f, 0.0315416f, 0.0306456f,
+    0.0296201f, 0.0317454f, 0.0304263f, 0.0228198f, 0.0182558f,
+    0.0335469f, 0.0346062f, 0.0331135f, 0.0331537f, 0.0324497f,
+    0.0318472f, 0.031405f, 0.0296838f, 0.0287418f, 0.0283926f,
+    0.0256596f, 0.0192447f, 0.0155942f, 0.173876f, 0.179366f,
+    0.171629f, 0.171837f, 0.168189f, 0.165066f, 0.162774f,
+    0.153853f, 0.14897f, 0.14716f, 0.132994f, 0.0997457f,
+    0.0808217f, 0.134814f, 0.139952f, 0.146027f, 0.139035f,
+    0.136888f, 0.136421f, 0.130211f, 0.126924f, 0.120574f,
+    0.123834f, 0.108795f, 0.0816712f, 0.0653369f, 0.111235f,
+    0.124249f, 0.129398f, 0.123437f, 0.12189f, 0.121538f,
+    0.116352f, 0.113721f, 0.108129f, 0.110335f, 0.0981892f,
+    0.0736419f, 0.0589135f, 0.0831282f, 0.0926444f, 0.0964512f,
+    0.0922893f, 0.0916702f, 0.091803f, 0.0884622f, 0.087035f,
+    0.0831739f, 0.0855649f, 0.0779101f, 0.0584325f, 0.046746f,
+    0.0682485f, 0.0703986f, 0.0711436f, 0.068044f, 0.0676471f,
+    0.0680024f, 0.0656673f, 0.0648042f, 0.0622466f, 0.0654676f,
+    0.0604387f, 0.045329f, 0.0362632f, 0.0672222f, 0.0693529f,
+    0.0663554f, 0.0664458f, 0.0650325f, 0.0638286f, 0.0629464f,
+    0.059504f, 0.0576203f, 0.0575991f, 0.0528798f, 0.0396598f,
+    0.0317279f, 0.0670936f, 0.0692121f, 0.0662267f, 0.0663072f,
+    0.0648992f, 0.0636942f, 0.0628099f, 0.0593674f, 0.0574833f,
+    0.0567849f, 0.0513187f, 0.038489f, 0.0311875f, 0.207423f,
+    0.213972f, 0.204742f, 0.204991f, 0.200638f, 0.196913f,
+    0.194179f, 0.183536f, 0.177712f, 0.175552f, 0.158653f,
+    0.11899f, 0.096415f, 0.168361f, 0.173127f, 0.176124f,
+    0.167648f, 0.165008f, 0.164487f, 0.157829f, 0.152967f,
+    0.145343f, 0.149688f, 0.131248f, 0.100901f, 0.0807205f,
+    0.139368f, 0.153006f, 0.159494f, 0.152049f, 0.15001f,
+    0.149604f, 0.143099f, 0.139765f, 0.132897f, 0.136189f,
+    0.120643f, 0.0904821f, 0.0723856f, 0.110933f, 0.121401f,
+    0.126548f, 0.120902f, 0.11979f, 0.119869f, 0.115209f,
+    0.113079f, 0.107942f, 0.111419f, 0.100363f, 0.0752726f,
+    0.0602181f, 0.101795f, 0.105005f, 0.101241f, 0.100607f,
+    0.0984788f, 0.096677f, 0.0953578f, 0.0908479f, 0.087344f,
+    0.0913214f, 0.0828921f, 0.0621691f, 0.0497353f, 0.100769f,
+    0.103959f, 0.0994686f, 0.0995993f, 0.097482f, 0.0956756f,
+    0.0943512f, 0.0891875f, 0.0863618f, 0.0853292f, 0.0771475f,
+    0.0580823f, 0.0469575f, 0.10064f, 0.103818f, 0.09934f,
+    0.0994606f, 0.0973487f, 0.0955411f, 0.0942147f, 0.089051f,
+    0.0862249f, 0.0851772f, 0.0769779f, 0.0577334f, 0.0467808f,
+    0.274516f, 0.283183f, 0.270969f, 0.271298f, 0.265537f,
+    0.260607f, 0.256989f, 0.242904f, 0.235195f, 0.232337f,
+    0.209972f, 0.157479f, 0.127602f, 0.235454f, 0.242339f,
+    0.236318f, 0.232144f, 0.227508f, 0.22354f, 0.220639f,
+    0.20881f, 0.202471f, 0.201395f, 0.182292f, 0.13936f,
+    0.111789f, 0.206462f, 0.212416f, 0.219688f, 0.209274f,
+    0.206249f, 0.205736f, 0.196593f, 0.191852f, 0.182434f,
+    0.187896f, 0.16555f, 0.124162f, 0.0993297f, 0.178027f,
+    0.183434f, 0.186742f, 0.178127f, 0.176028f, 0.176001f,
+    0.168704f, 0.165166f, 0.157478f, 0.163126f, 0.14527f,
+    0.108953f, 0.0871622f, 0.168889f, 0.174216f, 0.166664f,
+    0.166913f, 0.163378f, 0.160371f, 0.158167f, 0.149539f,
+    0.144827f, 0.143175f, 0.129559f, 0.0980497f, 0.079031f,
+    0.167862f, 0.173171f, 0.165695f, 0.165906f, 0.162381f,
+    0.159369f, 0.157161f, 0.148555f, 0.143845f, 0.142114f,
+    0.128466f, 0.0965413f, 0.078144f, 0.167734f, 0.17303f,
+    0.165566f, 0.165768f, 0.162248f, 0.159235f, 0.157024f,
+    0.148418f, 0.143708f, 0.141962f, 0.128296f, 0.0962222f,
+    0.0779675f, 0.777717f, 0.802271f, 0.767667f, 0.768599f,
+    0.752279f, 0.738311f, 0.72806f, 0.688157f, 0.666318f,
+    0.658221f, 0.594859f, 0.446145f, 0.361501f, 0.738655f,
+    0.761427f, 0.728347f, 0.729445f, 0.71425f, 0.701244f,
+    0.691711f, 0.654063f, 0.633593f, 0.626705f, 0.56718f,
+    0.427803f, 0.345689f, 0.709662f, 0.731504f, 0.699658f,
+    0.700775f, 0.686207f, 0.673755f, 0.664629f, 0.628516f,
+    0.608902f, 0.602458f, 0.545479f, 0.412508f, 0.332827f,
+    0.681227f, 0.702522f, 0.672044f, 0.673034f, 0.658872f,
+    0.646788f, 0.637926f, 0.603144f, 0.584181f, 0.577614f,
+    0.522665f, 0.3945f, 0.318585f, 0.672089f, 0.693304f,
+    0.663362f, 0.664215f, 0.65012f, 0.638075f, 0.62924f,
+    0.594793f, 0.57595f, 0.56906f, 0.514447f, 0.386493f,
+    0.312931f, 0.671063f, 0.692259f, 0.662393f, 0.663208f,
+    0.649123f, 0.637074f, 0.628233f, 0.593808f, 0.574968f,
+    0.567998f, 0.513354f, 0.385015f, 0.312044f, 0.670934f,
+    0.692118f, 0.662265f, 0.663069f, 0.64899f, 0.63694f,
+    0.628096f, 0.593671f, 0.574831f, 0.567846f, 0.513184f,
+    0.384888f, 0.311867f, 0.11608f, 0.113057f, 0.106553f,
+    0.104669f, 0.103071f, 0.0996677f, 0.0960298f, 0.0910577f,
+    0.0866967f, 0.0791093f, 0.0682781f, 0.0512086f, 0.0409668f,
+    0.0777772f, 0.0830194f, 0.0787096f, 0.0789108f, 0.0778492f,
+    0.0753524f, 0.0722096f, 0.0702959f, 0.0664223f, 0.063039f,
+    0.0539087f, 0.0404316f, 0.0323452f, 0.0606352f, 0.0652585f,
+    0.0619435f, 0.0623675f, 0.0617582f, 0.0600246f, 0.0579618f,
+    0.0569213f, 0.0537879f, 0.0506643f, 0.0439207f, 0.0329405f,
+    0.0263525f, 0.029961f, 0.0330622f, 0.0315794f, 0.0322347f,
+    0.0323823f, 0.0320641f, 0.0317585f, 0.0321453f, 0.0306883f,
+    0.0293615f, 0.0265161f, 0.019887f, 0.0159096f, 0.0130787f,
+    0.0124495f, 0.0130207f, 0.0120727f, 0.0114414f, 0.0108836f,
+    0.0122201f, 0.0126498f, 0.0128824f, 0.0162607f, 0.0135506f,
+    0.0101629f, 0.00813035f, 0.00829073f, 0.00591128f, 0.0087663f,
+    0.00960622f, 0.00888922f, 0.00939008f, 0.0105713f, 0.0106426f,
+    0.0105016f, 0.0113241f, 0.00943673f, 0.00707755f, 0.00566204f,
+    0.00256357f, 0.00195374f, 0.00597367f, 0.00599994f, 0.00558441f,
+    0.00540966f, 0.00557737f, 0.00526205f, 0.00487006f, 0.00425299f,
+    0.00354415f, 0.00265812f, 0.00212649f, 0.152547f, 0.148575f,
+    0.140028f, 0.137552f, 0.135452f, 0.130979f, 0.126198f,
+    0.119664f, 0.113933f, 0.103962f, 0.0897282f, 0.0672962f,
+    0.053837f, 0.108702f, 0.113016f, 0.10716f, 0.107378f,
+    0.105916f, 0.102518f, 0.0981488f, 0.095453f, 0.0902801f,
+    0.0861035f, 0.0734418f, 0.0550813f, 0.0440651f, 0.0888993f,
+    0.0952554f, 0.0903937f, 0.090835f, 0.0898255f, 0.0871905f,
+    0.0839009f, 0.0820784f, 0.0776457f, 0.0737286f, 0.0634538f,
+    0.0475903f, 0.0380723f, 0.058225f, 0.0630591f, 0.0600295f,
+    0.0607022f, 0.0604495f, 0.05923f, 0.0576977f, 0.0573024f,
+    0.0545461f, 0.0524257f, 0.0460491f, 0.0345369f, 0.0276294f,
+    0.0375983f, 0.0400092f, 0.0381585f, 0.0386398f, 0.0385836f,
+    0.0380495f, 0.0373154f, 0.037446f, 0.035987f, 0.0356506f,
+    0.0320539f, 0.0240404f, 0.0192323f, 0.0365936f, 0.0356478f,
+    0.0336097f, 0.0330265f, 0.032521f, 0.031459f, 0.0303149f,
+    0.030004f, 0.0288548f, 0.0289139f, 0.026188f, 0.019641f,
+    0.0157128f, 0.0364677f, 0.0355183f, 0.033475f, 0.0328832f,
+    0.0323811f, 0.0313119f, 0.030169f, 0.0286069f, 0.0272369f,
+    0.0248533f, 0.0214506f, 0.016088f, 0.0128704f, 0.189015f,
+    0.184093f, 0.173503f, 0.170435f, 0.167833f, 0.162291f,
+    0.156367f, 0.148271f, 0.14117f, 0.128815f, 0.111178f,
+    0.0833839f, 0.0667071f, 0.145169f, 0.143013f, 0.13561f,
+    0.135846f, 0.133984f, 0.129684f, 0.124088f, 0.12061f,
+    0.114138f, 0.109168f, 0.0929748f, 0.0697311f, 0.0557848f,
+    0.117163f, 0.125252f, 0.118844f, 0.119303f, 0.117893f,
+    0.114356f, 0.10984f, 0.107235f, 0.101504f, 0.096793f,
+    0.0829868f, 0.0622401f, 0.0497921f, 0.0864891f, 0.093056f,
+    0.0884797f, 0.0891696f, 0.0885167f, 0.0863958f, 0.0836369f,
+    0.0824595f, 0.0784039f, 0.0754901f, 0.0655822f, 0.0491866f,
+    0.0393493f, 0.0740658f, 0.0721646f, 0.068088f, 0.0671073f,
+    0.0666508f, 0.0652154f, 0.0632545f, 0.062603f, 0.0598449f,
+    0.0587149f, 0.0515869f, 0.0386901f, 0.0309522f, 0.0730612f,
+    0.0711658f, 0.0670845f, 0.0659094f, 0.0649018f, 0.0627705f,
+    0.0604835f, 0.0573615f, 0.0546245f, 0.0519782f, 0.0457211f,
+    0.0342908f, 0.0274327f, 0.0729352f, 0.0710362f, 0.0669498f,
+    0.0657661f, 0.0647618f, 0.0626234f, 0.0603376f, 0.0572135f,
+    0.0544735f, 0.0497062f, 0.0429008f, 0.0321756f, 0.0257405f,
+    0.225482f, 0.219611f, 0.206978f, 0.203318f, 0.200213f,
+    0.193602f, 0.186536f, 0.176878f, 0.168406f, 0.153668f,
+    0.132629f, 0.0994715f, 0.0795772f, 0.181637f, 0.177118f,
+    0.167412f, 0.164697f, 0.162476f, 0.157625f, 0.152289f,
+    0.145767f, 0.138327f, 0.132232f, 0.112508f, 0.0843809f,
+    0.0675047f, 0.149954f, 0.155249f, 0.147294f, 0.14777f,
+    0.14596f, 0.141522f, 0.135779f, 0.132392f, 0.125361f,
+    0.119857f, 0.10252f, 0.0768899f, 0.0615119f, 0.119822f,
+    0.123053f, 0.11693f, 0.117637f, 0.116584f, 0.113562f,
+    0.109576f, 0.107616f, 0.102262f, 0.0985545f, 0.0851153f,
+    0.0638364f, 0.0510691f, 0.110533f, 0.107683f, 0.101563f,
+    0.0998158f, 0.0983027f, 0.0951271f, 0.0916934f, 0.0877601f,
+    0.0837027f, 0.0817792f, 0.07112f, 0.05334f, 0.042672f,
+    0.109529f, 0.106684f, 0.100559f, 0.0987922f, 0.0972826f,
+    0.094082f, 0.0906522f, 0.0859681f, 0.081861f, 0.0750426f,
+    0.0652542f, 0.0489406f, 0.0391525f, 0.109403f, 0.106554f,
+    0.100425f, 0.0986488f, 0.0971426f, 0.0939349f, 0.0905063f,
+    0.0858202f, 0.08171f, 0.0745591f, 0.064351f, 0.0482632f,
+    0.0386106f, 0.298417f, 0.290647f, 0.273927f, 0.269084f,
+    0.264975f, 0.256225f, 0.246873f, 0.234091f, 0.22288f,
+    0.203374f, 0.175529f, 0.131647f, 0.105317f, 0.254572f,
+    0.248154f, 0.234361f, 0.230463f, 0.227237f, 0.220248f,
+    0.212626f, 0.202015f, 0.1928f, 0.178361f, 0.15309f,
+    0.115681f, 0.0925446f, 0.222889f, 0.217322f, 0.205398f,
+    0.204705f, 0.202094f, 0.195854f, 0.187658f, 0.182706f,
+    0.173077f, 0.165986f, 0.141586f, 0.106189f, 0.0849517f,
+    0.192757f, 0.187862f, 0.177392f, 0.174572f, 0.172719f,
+    0.167894f, 0.161454f, 0.15793f, 0.149977f, 0.144683f,
+    0.124181f, 0.093136f, 0.0745088f, 0.183468f, 0.178718f,
+    0.168512f, 0.165582f, 0.163064f, 0.15775f, 0.152031f,
+    0.144215f, 0.137373f, 0.127908f, 0.110186f, 0.0826395f,
+    0.0661116f, 0.182464f, 0.17772f, 0.167509f, 0.164558f,
+    0.162044f, 0.156705f, 0.15099f, 0.143181f, 0.136334f,
+    0.124435f, 0.107424f, 0.0805679f, 0.0644544f, 0.182338f,
+    0.17759f, 0.167374f, 0.164415f, 0.161904f, 0.156558f,
+    0.150844f, 0.143033f, 0.136183f, 0.124265f, 0.107251f,
+    0.0804385f, 0.0643509f, 0.84543f, 0.823416f, 0.776048f,
+    0.762326f, 0.750687f, 0.725899f, 0.699403f, 0.66319f,
+    0.631428f, 0.576168f, 0.497282f, 0.372962f, 0.298369f,
+    0.801585f, 0.780923f, 0.736482f, 0.723705f, 0.712949f,
+    0.689921f, 0.665156f, 0.631114f, 0.601349f, 0.549695f,
+    0.474844f, 0.356133f, 0.285162f, 0.769901f, 0.750092f,
+    0.70752f, 0.695307f, 0.684999f, 0.662983f, 0.639254f,
+    0.606625f, 0.57812f, 0.528733f, 0.456884f, 0.342663f,
+    0.274726f, 0.73977f, 0.720631f, 0.679513f, 0.667682f,
+    0.657615f, 0.636236f, 0.613249f, 0.581761f, 0.554211f,
+    0.506455f, 0.4375f, 0.328125f, 0.262893f, 0.730481f,
+    0.711488f, 0.670633f, 0.658824f, 0.648776f, 0.627423f,
+    0.60456f, 0.573315f, 0.545922f, 0.498321f, 0.430208f,
+    0.322656f, 0.258125f, 0.729477f, 0.710489f, 0.66963f,
+    0.6578f, 0.647756f, 0.626378f, 0.603519f, 0.572281f,
+    0.544882f, 0.497228f, 0.429177f, 0.321883f, 0.257506f,
+    0.729351f, 0.71036f, 0.669495f, 0.657657f, 0.647615f,
+    0.626231f, 0.603373f, 0.572132f, 0.544732f, 0.497059f,
+    0.429004f, 0.321753f, 0.257403f, 0.104367f, 0.109709f,
+    0.107775f, 0.104017f, 0.10023f, 0.0954225f, 0.0909206f,
+    0.0847278f, 0.078865f, 0.0664811f, 0.0558131f, 0.0419005f,
+    0.0335204f, 0.0715045f, 0.0744385f, 0.0721999f, 0.0727357f,
+    0.070342f, 0.0687958f, 0.06625f, 0.061894f, 0.0589504f,
+    0.0525009f, 0.0441842f, 0.0331382f, 0.0265106f, 0.0520928f,
+    0.056068f, 0.0542935f, 0.0549011f, 0.0535522f, 0.0528696f,
+    0.0515078f, 0.0482683f, 0.0463971f, 0.041775f, 0.035325f,
+    0.0264937f, 0.021195f, 0.023576f, 0.0273452f, 0.0264001f,
+    0.026956f, 0.0268819f, 0.027259f, 0.0273887f, 0.0259991f,
+    0.0256451f, 0.023958f, 0.0205311f, 0.0153983f, 0.0123186f,
+    0.0121723f, 0.0127988f, 0.0126016f, 0.0125148f, 0.0110115f,
+    0.0110282f, 0.0109971f, 0.0110034f, 0.0109877f, 0.011816f,
+    0.0098467f, 0.00738502f, 0.00590802f, 0.00745092f, 0.00984637f,
+    0.00854573f, 0.00738517f, 0.00761837f, 0.00772739f, 0.00751893f,
+    0.00749316f, 0.00732934f, 0.0071928f, 0.005994f, 0.0044955f,
+    0.0035964f, 0.00277f, 0.00503926f, 0.00398935f, 0.00300474f,
+    0.00315065f, 0.00309573f, 0.00283322f, 0.0028691f, 0.00267904f,
+    0.00232122f, 0.00193435f, 0.00145076f, 0.00116061f, 0.137155f,
+    0.144175f, 0.141633f, 0.136695f, 0.131719f, 0.1254f,
+    0.119484f, 0.111346f, 0.103641f, 0.0873667f, 0.0733473f,
+    0.055064f, 0.0440512f, 0.099675f, 0.103545f, 0.101967f,
+    0.100567f, 0.097093f, 0.0948129f, 0.0911017f, 0.0851037f,
+    0.080924f, 0.0719477f, 0.060493f, 0.0453698f, 0.0362958f,
+    0.0802632f, 0.0845491f, 0.0819825f, 0.0827328f, 0.0803032f,
+    0.0788866f, 0.0763595f, 0.0714779f, 0.0683706f, 0.0612219f,
+    0.0516337f, 0.0387253f, 0.0309802f, 0.0517465f, 0.0558263f,
+    0.0540892f, 0.0547877f, 0.053633f, 0.0532761f, 0.0522403f,
+    0.0492087f, 0.0476186f, 0.0434049f, 0.0368399f, 0.0276299f,
+    0.0221039f, 0.0349073f, 0.0371972f, 0.0360366f, 0.0364731f,
+    0.0356927f, 0.0355136f, 0.0349169f, 0.0330478f, 0.0321393f,
+    0.029831f, 0.0254576f, 0.0190932f, 0.0152746f, 0.0329143f,
+    0.034605f, 0.0340062f, 0.0328176f, 0.0316397f, 0.0301259f,
+    0.0288565f, 0.0272554f, 0.0263391f, 0.0244706f, 0.0208798f,
+    0.0156598f, 0.0125279f, 0.0327881f, 0.0344663f, 0.0338588f,
+    0.0326781f, 0.0314886f, 0.0299782f, 0.0285639f, 0.0266184f,
+    0.0247766f, 0.0208861f, 0.0175346f, 0.0131645f, 0.0105316f,
+    0.169943f, 0.178641f, 0.175492f, 0.169373f, 0.163207f,
+    0.155378f, 0.148048f, 0.137964f, 0.128417f, 0.108253f,
+    0.0908815f, 0.0682274f, 0.0545819f, 0.131981f, 0.138011f,
+    0.135825f, 0.131346f, 0.12716f, 0.121539f, 0.116466f,
+    0.109075f, 0.102897f, 0.0913946f, 0.0768018f, 0.0576014f,
+    0.0460811f, 0.108434f, 0.11303f, 0.109672f, 0.110564f,
+    0.107054f, 0.104904f, 0.101211f, 0.0946875f, 0.0903442f,
+    0.0806688f, 0.0679425f, 0.0509569f, 0.0407655f, 0.079917f,
+    0.0843074f, 0.0817782f, 0.0826194f, 0.0803841f, 0.0792932f,
+    0.077092f, 0.0724183f, 0.0695922f, 0.0628518f, 0.0531486f,
+    0.0398615f, 0.0318892f, 0.0667035f, 0.0701173f, 0.0689296f,
+    0.0665287f, 0.0641953f, 0.0615307f, 0.0597686f, 0.0562574f,
+    0.0541128f, 0.0492778f, 0.0417664f, 0.0313248f, 0.0250598f,
+    0.0657022f, 0.0690712f, 0.0678647f, 0.0654954f, 0.063128f,
+    0.0601038f, 0.0572872f, 0.0534005f, 0.0497245f, 0.0439175f,
+    0.0371886f, 0.0278914f, 0.0223131f, 0.065576f, 0.0689325f,
+    0.0677172f, 0.065356f, 0.0629769f, 0.059956f, 0.0571275f,
+    0.0532365f, 0.0495527f, 0.0417718f, 0.0350688f, 0.0263279f,
+    0.0210623f, 0.202731f, 0.213107f, 0.20935f, 0.20205f,
+    0.194695f, 0.185356f, 0.176611f, 0.164582f, 0.153193f,
+    0.129138f, 0.108416f, 0.0813908f, 0.0651127f, 0.164768f,
+    0.172477f, 0.169684f, 0.164024f, 0.158648f, 0.151517f,
+    0.145029f, 0.135693f, 0.126813f, 0.110842f, 0.0931107f,
+    0.069833f, 0.0558664f, 0.136604f, 0.142684f, 0.140464f,
+    0.138396f, 0.133805f, 0.130921f, 0.126063f, 0.117897f,
+    0.112318f, 0.100116f, 0.0842514f, 0.0631885f, 0.0505508f,
+    0.108472f, 0.113792f, 0.111966f, 0.110451f, 0.107135f,
+    0.10531f, 0.101944f, 0.0956279f, 0.0915657f, 0.0822986f,
+    0.0694574f, 0.0520931f, 0.0416745f, 0.0994914f, 0.104583f,
+    0.102788f, 0.0992066f, 0.0956836f, 0.0911347f, 0.0869395f,
+    0.0811059f, 0.0760864f, 0.0687247f, 0.0580752f, 0.0435564f,
+    0.0348451f, 0.0984901f, 0.103537f, 0.101723f, 0.0981732f,
+    0.0946162f, 0.0900816f, 0.0858508f, 0.0800187f, 0.0745006f,
+    0.0633644f, 0.0534973f, 0.040123f, 0.0320984f, 0.0983639f,
+    0.103399f, 0.101576f, 0.0980338f, 0.0944652f, 0.089934f,
+    0.085691f, 0.0798545f, 0.0743289f, 0.0626574f, 0.052603f,
+    0.0394913f, 0.0315931f, 0.268306f, 0.28204f, 0.277067f,
+    0.267406f, 0.257672f, 0.245312f, 0.233738f, 0.217818f,
+    0.202746f, 0.170909f, 0.143484f, 0.107718f, 0.0861741f,
+    0.230344f, 0.241409f, 0.237401f, 0.229379f, 0.221625f,
+    0.211473f, 0.202156f, 0.188929f, 0.176365f, 0.149735f,
+    0.125728f, 0.0944955f, 0.0755964f, 0.201984f, 0.211616f,
+    0.20818f, 0.201183f, 0.19456f, 0.185763f, 0.177793f,
+    0.166342f, 0.156265f, 0.139009f, 0.116869f, 0.0876517f,
+    0.0701214f, 0.174047f, 0.182725f, 0.179683f, 0.173515f,
+    0.167595f, 0.15982f, 0.152743f, 0.142732f, 0.135513f,
+    0.121192f, 0.102075f, 0.0765563f, 0.0612451f, 0.165067f,
+    0.173516f, 0.170505f, 0.164562f, 0.15866f, 0.15109f,
+    0.144067f, 0.134342f, 0.125146f, 0.107618f, 0.0906928f,
+    0.0680196f, 0.0544157f, 0.164066f, 0.172469f, 0.16944f,
+    0.163529f, 0.157593f, 0.150037f, 0.142978f, 0.133255f,
+    0.124053f, 0.1046f, 0.0878215f, 0.0659839f, 0.0527872f,
+    0.16394f, 0.172331f, 0.169293f, 0.16339f, 0.157442f,
+    0.14989f, 0.142818f, 0.13309f, 0.123881f, 0.104429f,
+    0.0876713f, 0.0658182f, 0.0526546f, 0.760125f, 0.799031f,
+    0.784944f, 0.757574f, 0.729996f, 0.69498f, 0.662191f,
+    0.617088f, 0.574388f, 0.484194f, 0.406497f, 0.305169f,
+    0.244135f, 0.722163f, 0.758401f, 0.745278f, 0.719547f,
+    0.693948f, 0.661141f, 0.63061f, 0.5882f, 0.548007f,
+    0.462463f, 0.388336f, 0.291947f, 0.233558f, 0.693803f,
+    0.728608f, 0.716058f, 0.691351f, 0.666884f, 0.635431f,
+    0.606247f, 0.565613f, 0.527113f, 0.445001f, 0.373707f,
+    0.281133f, 0.224906f, 0.665866f, 0.699716f, 0.68756f,
+    0.663682f, 0.639919f, 0.609488f, 0.581197f, 0.542002f,
+    0.504902f, 0.42607f, 0.357784f, 0.269074f, 0.215259f,
+    0.656886f, 0.690507f, 0.678382f, 0.65473f, 0.630985f,
+    0.600758f, 0.57252f, 0.533612f, 0.496788f, 0.418905f,
+    0.351711f, 0.264219f, 0.211375f, 0.655884f, 0.689461f,
+    0.677318f, 0.653697f, 0.629917f, 0.599705f, 0.571431f,
+    0.532525f, 0.495695f, 0.417885f, 0.350834f, 0.263435f,
+    0.210748f, 0.655758f, 0.689322f, 0.67717f, 0.653558f,
+    0.629766f, 0.599558f, 0.571271f, 0.532361f, 0.495523f,
+    0.417713f, 0.350684f, 0.263269f, 0.210616f, 0.107779f,
+    0.106169f, 0.105775f, 0.101997f, 0.0976082f, 0.0932059f,
+    0.0864428f, 0.0803966f, 0.073991f, 0.0614251f, 0.051376f,
+    0.0385902f, 0.0308721f, 0.0687925f, 0.0678674f, 0.067332f,
+    0.065366f, 0.0644866f, 0.0619204f, 0.0590745f, 0.0563687f,
+    0.0530825f, 0.0472061f, 0.0400591f, 0.0300443f, 0.0240354f,
+    0.0479018f, 0.0492366f, 0.0477331f, 0.0478454f, 0.0476407f,
+    0.0462521f, 0.0444966f, 0.0429193f, 0.040871f, 0.0370651f,
+    0.0316719f, 0.0237539f, 0.0190031f, 0.0297057f, 0.0303313f,
+    0.0300577f, 0.0286977f, 0.027628f, 0.025219f, 0.0243081f,
+    0.0223977f, 0.0218801f, 0.0206847f, 0.0179853f, 0.013489f,
+    0.0107912f, 0.0158039f, 0.0150461f, 0.0157012f, 0.0148409f,
+    0.0150525f, 0.0146487f, 0.0145784f, 0.0129919f, 0.0114876f,
+    0.00919005f, 0.00773252f, 0.00604971f, 0.00563193f, 0.00890371f,
+    0.00770402f, 0.00828174f, 0.00820226f, 0.0089019f, 0.00930652f,
+    0.00983024f, 0.00893457f, 0.00795093f, 0.00636074f, 0.00530061f,
+    0.00397546f, 0.00342001f, 0.0045069f, 0.00299515f, 0.00190581f,
+    0.00212172f, 0.0023188f, 0.0026706f, 0.00378691f, 0.00366178f,
+    0.00334739f, 0.00267792f, 0.0022316f, 0.0016737f, 0.00133896f,
+    0.141639f, 0.139524f, 0.139006f, 0.13404f, 0.128273f,
+    0.122487f, 0.1136f, 0.105654f, 0.097236f, 0.0807224f,
+    0.0675163f, 0.0507136f, 0.0405709f, 0.102652f, 0.100399f,
+    0.100562f, 0.0974092f, 0.0937182f, 0.0900739f, 0.0840671f,
+    0.0787061f, 0.073355f, 0.0649139f, 0.0550028f, 0.0412521f,
+    0.0330017f, 0.0754803f, 0.0766336f, 0.0740943f, 0.074027f,
+    0.0732438f, 0.0705769f, 0.0675257f, 0.0646579f, 0.0611435f,
+    0.0547728f, 0.0466157f, 0.0349617f, 0.0279694f, 0.0489618f,
+    0.050699f, 0.0492964f, 0.0492659f, 0.0490294f, 0.0475577f,
+    0.0457833f, 0.0441363f, 0.0421526f, 0.0383924f, 0.0329291f,
+    0.0246968f, 0.0197574f, 0.0350855f, 0.0350517f, 0.0344748f,
+    0.0339447f, 0.0337299f, 0.0325994f, 0.0313566f, 0.0301579f,
+    0.0288471f, 0.0263295f, 0.0226763f, 0.0170072f, 0.0136058f,
+    0.0340008f, 0.0334862f, 0.0333852f, 0.0321965f, 0.0308204f,
+    0.0294458f, 0.0273264f, 0.0254375f, 0.0240472f, 0.0217319f,
+    0.018668f, 0.014001f, 0.0112008f, 0.0338601f, 0.0333543f,
+    0.0332307f, 0.0320436f, 0.0306648f, 0.0292818f, 0.0271572f,
+    0.0252578f, 0.0232454f, 0.0192977f, 0.0161407f, 0.012124f,
+    0.00969922f, 0.175499f, 0.172878f, 0.172236f, 0.166083f,
+    0.158937f, 0.151769f, 0.140756f, 0.130911f, 0.120481f,
+    0.10002f, 0.0836565f, 0.0628371f, 0.0502697f, 0.136512f,
+    0.133753f, 0.133793f, 0.129452f, 0.124383f, 0.119355f,
+    0.111224f, 0.103963f, 0.0960487f, 0.0826216f, 0.0699466f,
+    0.05246f, 0.041968f, 0.107317f, 0.10491f, 0.105174f,
+    0.101914f, 0.098847f, 0.0949015f, 0.0905548f, 0.0863964f,
+    0.0814161f, 0.0724807f, 0.0615595f, 0.0461696f, 0.0369357f,
+    0.078388f, 0.078096f, 0.0769379f, 0.0754476f, 0.0746325f,
+    0.0718825f, 0.0688125f, 0.0658748f, 0.0624251f, 0.0561002f,
+    0.0478729f, 0.0359046f, 0.0287237f, 0.0689453f, 0.0678525f,
+    0.0677052f, 0.0653269f, 0.062579f, 0.0598461f, 0.0555956f,
+    0.0518965f, 0.0491196f, 0.0440372f, 0.0376201f, 0.0282151f,
+    0.022572f, 0.0678606f, 0.0668403f, 0.0666155f, 0.0642397f,
+    0.0614849f, 0.0587273f, 0.0544832f, 0.0506948f, 0.0466719f,
+    0.0394396f, 0.0336118f, 0.0252088f, 0.0201671f, 0.0677199f,
+    0.0667085f, 0.066461f, 0.0640868f, 0.0613294f, 0.0585633f,
+    0.054314f, 0.0505151f, 0.0464904f, 0.038595f, 0.0322809f,
+    0.0242475f, 0.019398f, 0.209359f, 0.206232f, 0.205466f,
+    0.198126f, 0.189602f, 0.18105f, 0.167913f, 0.156169f,
+    0.143726f, 0.119317f, 0.0997967f, 0.0749605f, 0.0599685f,
+    0.170372f, 0.167107f, 0.167023f, 0.161496f, 0.155047f,
+    0.148637f, 0.138381f, 0.129221f, 0.119294f, 0.100329f,
+    0.0848904f, 0.0636679f, 0.0509342f, 0.141177f, 0.138265f,
+    0.138404f, 0.133958f, 0.128779f, 0.12367f, 0.115343f,
+    0.108135f, 0.101689f, 0.0901883f, 0.0765032f, 0.0573775f,
+    0.0459019f, 0.112248f, 0.110175f, 0.110168f, 0.106484f,
+    0.102223f, 0.0980189f, 0.0918415f, 0.0876135f, 0.0826977f,
+    0.0738079f, 0.0628166f, 0.0471125f, 0.03769f, 0.102805f,
+    0.101207f, 0.100936f, 0.0973701f, 0.0932435f, 0.0891275f,
+    0.0827524f, 0.077073f, 0.0710111f, 0.061745f, 0.0525638f,
+    0.0394229f, 0.0315383f, 0.101721f, 0.100194f, 0.0998459f,
+    0.0962829f, 0.0921494f, 0.0880088f, 0.08164f, 0.0759522f,
+    0.0699168f, 0.0580565f, 0.0485617f, 0.0365013f, 0.029201f,
+    0.10158f, 0.100063f, 0.0996913f, 0.0961301f, 0.0919939f,
+    0.0878448f, 0.0814708f, 0.0757724f, 0.0697354f, 0.0578923f,
+    0.0484212f, 0.0363709f, 0.0290968f, 0.277079f, 0.27294f,
+    0.271927f, 0.262213f, 0.250931f, 0.239613f, 0.222227f,
+    0.206683f, 0.190216f, 0.157911f, 0.132077f, 0.0992075f,
+    0.0793659f, 0.238092f, 0.233816f, 0.233483f, 0.225582f,
+    0.216376f, 0.2072f, 0.192694f, 0.179735f, 0.165784f,
+    0.137923f, 0.115398f, 0.0868974f, 0.0695179f, 0.208897f,
+    0.204973f, 0.204865f, 0.198044f, 0.190108f, 0.182232f,
+    0.169656f, 0.158441f, 0.146284f, 0.125604f, 0.106391f,
+    0.0797931f, 0.0638344f, 0.179968f, 0.176883f, 0.176629f,
+    0.17057f, 0.163552f, 0.156582f, 0.145612f, 0.135845f,
+    0.125325f, 0.109223f, 0.0927042f, 0.0695282f, 0.0556225f,
+    0.170525f, 0.167915f, 0.167396f, 0.161457f, 0.154573f,
+    0.147691f, 0.137066f, 0.127588f, 0.117501f, 0.0976133f,
+    0.0824514f, 0.0618385f, 0.0494708f, 0.16944f, 0.166903f,
+    0.166307f, 0.160369f, 0.153478f, 0.146572f, 0.135954f,
+    0.126467f, 0.116407f, 0.0966511f, 0.0808421f, 0.0607482f,
+    0.0485986f, 0.169299f, 0.166771f, 0.166152f, 0.160216f,
+    0.153323f, 0.146408f, 0.135784f, 0.126287f, 0.116225f,
+    0.0964868f, 0.0807016f, 0.0606179f, 0.0484943f, 0.784976f,
+    0.773252f, 0.770382f, 0.742862f, 0.710898f, 0.678836f,
+    0.629579f, 0.585543f, 0.53889f, 0.44737f, 0.374181f,
+    0.281059f, 0.224847f, 0.745989f, 0.734127f, 0.731939f,
+    0.706231f, 0.676344f, 0.646423f, 0.600046f, 0.558595f,
+    0.514458f, 0.427382f, 0.357502f, 0.268749f, 0.214999f,
+    0.716795f, 0.705285f, 0.70332f, 0.678692f, 0.650076f,
+    0.621455f, 0.577008f, 0.537301f, 0.494958f, 0.411279f,
+    0.344047f, 0.258729f, 0.206983f, 0.687865f, 0.677195f,
+    0.675085f, 0.651219f, 0.62352f, 0.595804f, 0.552963f,
+    0.514705f, 0.473999f, 0.393753f, 0.329375f, 0.247647f,
+    0.198117f, 0.678423f, 0.668227f, 0.665851f, 0.642105f,
+    0.61454f, 0.586913f, 0.544418f, 0.506447f, 0.466175f,
+    0.387072f, 0.323761f, 0.243275f, 0.19462f, 0.677338f,
+    0.667215f, 0.664762f, 0.641018f, 0.613446f, 0.585794f,
+    0.543306f, 0.505327f, 0.465081f, 0.38611f, 0.322946f,
+    0.2426f, 0.19408f, 0.677197f, 0.667083f, 0.664607f,
+    0.640865f, 0.61329f, 0.58563f, 0.543136f, 0.505147f,
+    0.4649f, 0.385946f, 0.322805f, 0.24247f, 0.193976f,
+    0.311275f, 0.230036f, 0.176165f, 0.14922f, 0.165773f,
+    0.148357f, 0.136692f, 0.13629f, 0.145029f, 0.139963f,
+    0.143032f, 0.107274f, 0.0858193f, 0.180004f, 0.153344f,
+    0.117163f, 0.105597f, 0.140904f, 0.124996f, 0.113986f,
+    0.116119f, 0.12362f, 0.120227f, 0.123692f, 0.0927688f,
+    0.074215f, 0.0932273f, 0.0913923f, 0.079259f, 0.082853f,
+    0.107947f, 0.0949053f, 0.0856879f, 0.0894756f, 0.0955767f,
+    0.0943845f, 0.098065f, 0.0735487f, 0.058839f, 0.039156f,
+    0.0487876f, 0.0415784f, 0.0414087f, 0.0511895f, 0.0442161f,
+    0.0391919f, 0.0434612f, 0.0471484f, 0.0493958f, 0.0528136f,
+    0.0396102f, 0.0316882f, 0.00795582f, 0.0276399f, 0.0138199f,
+    0.0116819f, 0.0132701f, 0.0111912f, 0.00969678f, 0.0121049f,
+    0.0185073f, 0.0170263f, 0.0192232f, 0.0144174f, 0.0115339f,
+    0.00141714f, 0.0137279f, 0.00686394f, 0.00457596f, 0.00343197f,
+    0.00274558f, 0.00228798f, 0.00329454f, 0.0165107f, 0.0132086f,
+    0.0110072f, 0.00825537f, 0.00660429f, 3.39079e-06f, 0.00100221f,
+    0.000501105f, 0.00033407f, 0.000250552f, 0.000200442f, 0.000167035f,
+    0.000143173f, 0.00849129f, 0.00679303f, 0.00566086f, 0.00424564f,
+    0.00339651f, 0.409064f, 0.302304f, 0.231508f, 0.196099f,
+    0.217851f, 0.194964f, 0.179635f, 0.179107f, 0.190591f,
+    0.183934f, 0.187967f, 0.140975f, 0.11278f, 0.277793f,
+    0.225612f, 0.172507f, 0.143784f, 0.192983f, 0.171603f,
+    0.156929f, 0.158935f, 0.169182f, 0.164198f, 0.168627f,
+    0.12647f, 0.101176f, 0.190777f, 0.16366f, 0.125293f,
+    0.12104f, 0.160026f, 0.141513f, 0.128631f, 0.132292f,
+    0.141139f, 0.138355f, 0.143f, 0.10725f, 0.0857999f,
+    0.117323f, 0.0978852f, 0.0767517f, 0.0795955f, 0.103269f,
+    0.0908237f, 0.0821349f, 0.086278f, 0.0927104f, 0.0933667f,
+    0.0977485f, 0.0733114f, 0.0586491f, 0.0991936f, 0.0751229f,
+    0.0576965f, 0.0498687f, 0.0653491f, 0.0577988f, 0.0526397f,
+    0.0549218f, 0.0592472f, 0.0609971f, 0.0641581f, 0.0481185f,
+    0.0384948f, 0.0978783f, 0.0725488f, 0.0555995f, 0.0470159f,
+    0.0552996f, 0.049273f, 0.0452155f, 0.0461114f, 0.0494846f,
+    0.050326f, 0.0524366f, 0.0393274f, 0.0314619f, 0.0977898f,
+    0.072268f, 0.0553439f, 0.0468789f, 0.0521096f, 0.0466323f,
+    0.0429635f, 0.0428719f, 0.0456366f, 0.0443756f, 0.0454097f,
+    0.0340573f, 0.0272458f, 0.506854f, 0.374572f, 0.286852f,
+    0.242978f, 0.26993f, 0.241572f, 0.222577f, 0.221924f,
+    0.236153f, 0.227905f, 0.232902f, 0.174676f, 0.139741f,
+    0.375583f, 0.297879f, 0.22785f, 0.19033f, 0.245062f,
+    0.218211f, 0.199872f, 0.201752f, 0.214744f, 0.208169f,
+    0.213561f, 0.160171f, 0.128137f, 0.288567f, 0.235928f,
+    0.180637f, 0.159227f, 0.212105f, 0.188121f, 0.171574f,
+    0.175109f, 0.186701f, 0.182326f, 0.187935f, 0.140951f,
+    0.112761f, 0.215113f, 0.170153f, 0.130613f, 0.117782f,
+    0.155348f, 0.137431f, 0.125078f, 0.129095f, 0.138272f,
+    0.137337f, 0.142683f, 0.107013f, 0.08561f, 0.196983f,
+    0.147391f, 0.11304f, 0.0952701f, 0.117428f, 0.104406f,
+    0.0955826f, 0.0977386f, 0.104809f, 0.104968f, 0.109093f,
+    0.0818197f, 0.0654558f, 0.195668f, 0.144817f, 0.110943f,
+    0.0938947f, 0.107379f, 0.0958806f, 0.0881584f, 0.0889282f,
+    0.0950467f, 0.0942968f, 0.0973714f, 0.0730286f, 0.0584229f,
+    0.19558f, 0.144536f, 0.110688f, 0.0937578f, 0.104189f,
+    0.0932399f, 0.0859064f, 0.0856887f, 0.0911987f, 0.0883464f,
+    0.0903446f, 0.0677585f, 0.0542068f, 0.604644f, 0.446839f,
+    0.342196f, 0.289857f, 0.322009f, 0.28818f, 0.26552f,
+    0.264741f, 0.281715f, 0.271876f, 0.277837f, 0.208378f,
+    0.166702f, 0.473373f, 0.370147f, 0.283194f, 0.237209f,
+    0.297141f, 0.264818f, 0.242815f, 0.244569f, 0.260306f,
+    0.25214f, 0.258496f, 0.193872f, 0.155098f, 0.386357f,
+    0.308196f, 0.235981f, 0.197413f, 0.264184f, 0.234728f,
+    0.214517f, 0.217926f, 0.232263f, 0.226297f, 0.23287f,
+    0.174652f, 0.139722f, 0.312903f, 0.242421f, 0.185957f,
+    0.155969f, 0.207426f, 0.184039f, 0.168021f, 0.171912f,
+    0.183835f, 0.181308f, 0.187618f, 0.140714f, 0.112571f,
+    0.294773f, 0.219659f, 0.168384f, 0.142149f, 0.169507f,
+    0.151014f, 0.138526f, 0.140555f, 0.150371f, 0.148939f,
+    0.154028f, 0.115521f, 0.0924167f, 0.293458f, 0.217085f,
+    0.166287f, 0.140774f, 0.159458f, 0.142488f, 0.131101f,
+    0.131745f, 0.140609f, 0.138268f, 0.142306f, 0.10673f,
+    0.0853838f, 0.29337f, 0.216804f, 0.166031f, 0.140637f,
+    0.156268f, 0.139848f, 0.128849f, 0.128506f, 0.136761f,
+    0.132317f, 0.13528f, 0.10146f, 0.0811677f, 0.800224f,
+    0.591375f, 0.452883f, 0.383614f, 0.426167f, 0.381395f,
+    0.351406f, 0.350374f, 0.372839f, 0.359818f, 0.367707f,
+    0.27578f, 0.220624f, 0.668953f, 0.514683f, 0.393882f,
+    0.330967f, 0.401299f, 0.358034f, 0.328701f, 0.330203f,
+    0.35143f, 0.340081f, 0.348366f, 0.261275f, 0.20902f,
+    0.581937f, 0.452732f, 0.346668f, 0.290283f, 0.368342f,
+    0.327944f, 0.300403f, 0.30356f, 0.323387f, 0.314239f,
+    0.322739f, 0.242055f, 0.193644f, 0.508482f, 0.386957f,
+    0.296644f, 0.249174f, 0.311584f, 0.277254f, 0.253907f,
+    0.257545f, 0.274959f, 0.26925f, 0.277488f, 0.208116f,
+    0.166493f, 0.490353f, 0.364194f, 0.279071f, 0.235907f,
+    0.273665f, 0.244229f, 0.224411f, 0.226189f, 0.241495f,
+    0.23688f, 0.243898f, 0.182923f, 0.146339f, 0.489038f,
+    0.36162f, 0.276974f, 0.234531f, 0.263615f, 0.235704f,
+    0.216987f, 0.217379f, 0.231733f, 0.226209f, 0.232176f,
+    0.174132f, 0.139306f, 0.488949f, 0.36134f, 0.276719f,
+    0.234394f, 0.260425f, 0.233063f, 0.214735f, 0.214139f,
+    0.227885f, 0.220259f, 0.225149f, 0.168862f, 0.13509f,
+    2.26707f, 1.67539f, 1.28304f, 1.0868f, 1.20735f,
+    1.08051f, 0.99555f, 0.992627f, 1.05627f, 1.01938f,
+    1.04173f, 0.781298f, 0.625038f, 2.1358f, 1.5987f,
+    1.22404f, 1.03415f, 1.18248f, 1.05715f, 0.972845f,
+    0.972455f, 1.03486f, 0.999644f, 1.02239f, 0.766792f,
+    0.613434f, 2.04878f, 1.53675f, 1.17682f, 0.993466f,
+    1.14953f, 1.02706f, 0.944546f, 0.945812f, 1.00682f,
+    0.973801f, 0.996763f, 0.747572f, 0.598058f, 1.97533f,
+    1.47098f, 1.1268f, 0.952357f, 1.09277f, 0.976369f,
+    0.898051f, 0.899798f, 0.958389f, 0.928812f, 0.951512f,
+    0.713634f, 0.570907f, 1.9572f, 1.44821f, 1.10923f,
+    0.93909f, 1.05485f, 0.943344f, 0.868555f, 0.868441f,
+    0.924926f, 0.896443f, 0.917921f, 0.688441f, 0.550753f,
+    1.95588f, 1.44564f, 1.10713f, 0.937714f, 1.0448f,
+    0.934819f, 0.861131f, 0.859631f, 0.915164f, 0.885772f,
+    0.9062f, 0.67965f, 0.54372f, 1.9558f, 1.44536f,
+    1.10687f, 0.937577f, 1.04161f, 0.932178f, 0.858879f,
+    0.856391f, 0.911316f, 0.879821f, 0.899173f, 0.67438f,
+    0.539504f, 0.197309f, 0.267068f, 0.185784f, 0.153317f,
+    0.160926f, 0.143071f, 0.125146f, 0.130102f, 0.128122f,
+    0.130581f, 0.121887f, 0.0954263f, 0.076341f, 0.124687f,
+    0.162507f, 0.11856f, 0.113483f, 0.132214f, 0.116709f,
+    0.101593f, 0.10534f, 0.103333f, 0.108837f, 0.0978044f,
+    0.0733533f, 0.0586827f, 0.0704031f, 0.0884829f, 0.0684141f,
+    0.0844979f, 0.0979117f, 0.0857888f, 0.0743269f, 0.0783342f,
+    0.0773524f, 0.082787f, 0.0747472f, 0.0560604f, 0.0448483f,
+    0.0368254f, 0.0276368f, 0.022114f, 0.0376152f, 0.0434804f,
+    0.0375176f, 0.0322201f, 0.0353964f, 0.0356397f, 0.0406808f,
+    0.037208f, 0.027906f, 0.0223248f, 0.0113074f, 0.00910465f,
+    0.00916263f, 0.0132971f, 0.0140915f, 0.0144927f, 0.0145676f,
+    0.0124865f, 0.0109257f, 0.0129868f, 0.01215f, 0.0091125f,
+    0.00729f, 0.00304381f, 0.00280119f, 0.00502594f, 0.00693008f,
+    0.00623457f, 0.00771754f, 0.00793218f, 0.00679901f, 0.00594914f,
+    0.00475931f, 0.00613146f, 0.00459859f, 0.00367887f, 2.88447e-05f,
+    5.85719e-05f, 0.00054055f, 0.000978922f, 0.000734414f, 0.00105249f,
+    0.00126701f, 0.00108601f, 0.00095026f, 0.000760208f, 0.00315334f,
+    0.002365f, 0.001892f, 0.259295f, 0.35097f, 0.24415f,
+    0.201482f, 0.211483f, 0.188018f, 0.164462f, 0.170975f,
+    0.168373f, 0.171604f, 0.160179f, 0.125405f, 0.100324f,
+    0.186673f, 0.246409f, 0.176926f, 0.156539f, 0.182771f,
+    0.161656f, 0.140909f, 0.145551f, 0.142591f, 0.149861f,
+    0.134541f, 0.100905f, 0.0807244f, 0.13239f, 0.172385f,
+    0.12678f, 0.127553f, 0.148468f, 0.130736f, 0.113643f,
+    0.118546f, 0.116611f, 0.12381f, 0.111483f, 0.0836125f,
+    0.06689f, 0.0796658f, 0.104658f, 0.0770946f, 0.0806704f,
+    0.0940369f, 0.0824646f, 0.0715359f, 0.075608f, 0.0748979f,
+    0.0817041f, 0.0739442f, 0.0554582f, 0.0443665f, 0.0636498f,
+    0.0856862f, 0.0606492f, 0.0518125f, 0.0608889f, 0.0536663f,
+    0.0467213f, 0.0490901f, 0.0486047f, 0.0540101f, 0.0488862f,
+    0.0366647f, 0.0293317f, 0.0621239f, 0.0840388f, 0.0586553f,
+    0.0483183f, 0.0528997f, 0.0468877f, 0.0409508f, 0.0424174f,
+    0.0417156f, 0.0456616f, 0.0411395f, 0.0308547f, 0.0246837f,
+    0.0619865f, 0.0839021f, 0.0583664f, 0.0481659f, 0.0505765f,
+    0.0449631f, 0.0393291f, 0.0408729f, 0.0402511f, 0.0412992f,
+    0.0382925f, 0.0299796f, 0.0239837f, 0.321282f, 0.434873f,
+    0.302516f, 0.249648f, 0.26204f, 0.232965f, 0.203778f,
+    0.211848f, 0.208624f, 0.212628f, 0.198472f, 0.155384f,
+    0.124308f, 0.24866f, 0.330311f, 0.235292f, 0.199594f,
+    0.233327f, 0.206603f, 0.180224f, 0.185763f, 0.18185f,
+    0.190884f, 0.171277f, 0.128458f, 0.102766f, 0.194376f,
+    0.256287f, 0.185146f, 0.170608f, 0.199025f, 0.175683f,
+    0.152958f, 0.158758f, 0.155869f, 0.164833f, 0.14822f,
+    0.111165f, 0.0889318f, 0.141652f, 0.18856f, 0.135461f,
+    0.123726f, 0.144593f, 0.127412f, 0.110852f, 0.11582f,
+    0.114156f, 0.122727f, 0.11068f, 0.0830103f, 0.0664082f,
+    0.125636f, 0.169588f, 0.119015f, 0.0978635f, 0.111445f,
+    0.0986134f, 0.0860371f, 0.0893018f, 0.0878629f, 0.0950333f,
+    0.0856224f, 0.0642168f, 0.0513735f, 0.12411f, 0.167941f,
+    0.117021f, 0.0964841f, 0.103456f, 0.0918347f, 0.0802666f,
+    0.0826291f, 0.0809738f, 0.0866848f, 0.0778758f, 0.0601152f,
+    0.0480921f, 0.123973f, 0.167804f, 0.116732f, 0.0963317f,
+    0.101133f, 0.0899101f, 0.078645f, 0.0817457f, 0.0805019f,
+    0.0823224f, 0.0765845f, 0.0599586f, 0.0479669f, 0.383268f,
+    0.518774f, 0.360882f, 0.297814f, 0.312596f, 0.277912f,
+    0.243093f, 0.25272f, 0.248875f, 0.253651f, 0.236764f,
+    0.185363f, 0.148291f, 0.310646f, 0.414213f, 0.293658f,
+    0.242649f, 0.283884f, 0.25155f, 0.21954f, 0.225975f,
+    0.221108f, 0.231907f, 0.208013f, 0.15601f, 0.124808f,
+    0.256362f, 0.340189f, 0.243512f, 0.213663f, 0.249581f,
+    0.22063f, 0.192274f, 0.198969f, 0.195127f, 0.205857f,
+    0.184956f, 0.138717f, 0.110973f, 0.203639f, 0.272462f,
+    0.193826f, 0.166781f, 0.19515f, 0.172359f, 0.150167f,
+    0.156031f, 0.153414f, 0.16375f, 0.147417f, 0.110562f,
+    0.08845f, 0.187623f, 0.25349f, 0.177381f, 0.146029f,
+    0.162002f, 0.14356f, 0.125353f, 0.129513f, 0.127121f,
+    0.136057f, 0.122359f, 0.091769f, 0.0734152f, 0.186097f,
+    0.251843f, 0.175387f, 0.14465f, 0.154013f, 0.136782f,
+    0.119582f, 0.122841f, 0.120981f, 0.127708f, 0.115067f,
+    0.0900942f, 0.0720754f, 0.185959f, 0.251706f, 0.175098f,
+    0.144497f, 0.15169f, 0.134857f, 0.117961f, 0.122618f,
+    0.120753f, 0.123346f, 0.114877f, 0.0899377f, 0.0719501f,
+    0.507241f, 0.686579f, 0.477614f, 0.394146f, 0.413709f,
+    0.367806f, 0.321725f, 0.334466f, 0.329376f, 0.335697f,
+    0.313348f, 0.245322f, 0.196257f, 0.434619f, 0.582018f,
+    0.41039f, 0.338225f, 0.384997f, 0.341444f, 0.298172f,
+    0.306398f, 0.299624f, 0.313953f, 0.281485f, 0.212754f,
+    0.170204f, 0.380335f, 0.507993f, 0.360244f, 0.299774f,
+    0.350694f, 0.310524f, 0.270906f, 0.279393f, 0.273644f,
+    0.287903f, 0.258428f, 0.193821f, 0.155057f, 0.327612f,
+    0.440266f, 0.310558f, 0.255358f, 0.296263f, 0.262253f,
+    0.228799f, 0.236455f, 0.231931f, 0.245797f, 0.220889f,
+    0.165667f, 0.132533f, 0.311596f, 0.421294f, 0.294113f,
+    0.242361f, 0.263115f, 0.233455f, 0.203985f, 0.209937f,
+    0.205638f, 0.218103f, 0.195831f, 0.151059f, 0.120847f,
+    0.31007f, 0.419647f, 0.292119f, 0.240981f, 0.255126f,
+    0.226676f, 0.198214f, 0.204554f, 0.201483f, 0.209755f,
+    0.191651f, 0.150052f, 0.120042f, 0.309932f, 0.41951f,
+    0.29183f, 0.240829f, 0.252803f, 0.224751f, 0.196592f,
+    0.204364f, 0.201254f, 0.205392f, 0.191461f, 0.149896f,
+    0.119917f, 1.43704f, 1.94511f, 1.3531f, 1.11663f,
+    1.17206f, 1.04201f, 0.911462f, 0.947557f, 0.933138f,
+    0.951046f, 0.887729f, 0.695007f, 0.556006f, 1.36442f,
+    1.84055f, 1.28588f, 1.06071f, 1.14335f, 1.01565f,
+    0.887909f, 0.909573f, 0.890003f, 0.929302f, 0.843526f,
+    0.660209f, 0.528167f, 1.31013f, 1.76652f, 1.23573f,
+    1.0189f, 1.10904f, 0.98473f, 0.860643f, 0.882567f,
+    0.862517f, 0.903252f, 0.810615f, 0.634409f, 0.507527f,
+    1.25741f, 1.6988f, 1.18605f, 0.977845f, 1.05461f,
+    0.936459f, 0.818536f, 0.83963f, 0.820805f, 0.861146f,
+    0.77807f, 0.609046f, 0.487237f, 1.24139f, 1.67982f,
+    1.1696f, 0.964848f, 1.02146f, 0.90766f, 0.793721f,
+    0.819117f, 0.806878f, 0.833452f, 0.76733f, 0.600744f,
+    0.480595f, 1.23987f, 1.67818f, 1.16761f, 0.963469f,
+    1.01347f, 0.900882f, 0.787951f, 0.817646f, 0.805245f,
+    0.825103f, 0.766032f, 0.599738f, 0.47979f, 1.23973f,
+    1.67804f, 1.16732f, 0.963316f, 1.01115f, 0.898957f,
+    0.786329f, 0.817455f, 0.805017f, 0.820741f, 0.765842f,
+    0.599582f, 0.479665f, 0.235707f, 0.13918f, 0.12754f,
+    0.145675f, 0.127608f, 0.119305f, 0.120052f, 0.121888f,
+    0.122815f, 0.125899f, 0.12239f, 0.093174f, 0.0745392f,
+    0.143864f, 0.0933097f, 0.0913793f, 0.101185f, 0.10372f,
+    0.0962846f, 0.0915871f, 0.0902373f, 0.0892912f, 0.0985245f,
+    0.0894034f, 0.0670525f, 0.0544432f, 0.0785938f, 0.0563919f,
+    0.0651591f, 0.0732947f, 0.0758249f, 0.0698633f, 0.0665601f,
+    0.0661167f, 0.0651799f, 0.0727016f, 0.0663162f, 0.0497371f,
+    0.0397897f, 0.0517824f, 0.0282386f, 0.0265108f, 0.030895f,
+    0.0325925f, 0.0295543f, 0.0283343f, 0.0289317f, 0.0282316f,
+    0.0329207f, 0.0303317f, 0.0227488f, 0.018199f, 0.0379114f,
+    0.0156839f, 0.0128122f, 0.0146259f, 0.0153299f, 0.0122639f,
+    0.0133249f, 0.0116911f, 0.010772f, 0.0119776f, 0.0105976f,
+    0.00907994f, 0.00781223f, 0.0243331f, 0.00973323f, 0.00729552f,
+    0.00802499f, 0.00772413f, 0.00617931f, 0.0066619f, 0.00578112f,
+    0.00520988f, 0.00609434f, 0.00536875f, 0.00451932f, 0.00713274f,
+    0.00644637f, 0.00257855f, 0.00306525f, 0.0020435f, 0.00153263f,
+    0.0012261f, 0.00102175f, 0.000875786f, 0.000766313f, 0.00168286f,
+    0.00140238f, 0.00203077f, 0.00404025f, 0.309757f, 0.182905f,
+    0.167608f, 0.19144f, 0.167697f, 0.156786f, 0.157768f,
+    0.16018f, 0.161398f, 0.165452f, 0.160841f, 0.122446f,
+    0.0979564f, 0.217914f, 0.137034f, 0.127525f, 0.140636f,
+    0.143809f, 0.133765f, 0.127213f, 0.125159f, 0.123944f,
+    0.136551f, 0.123735f, 0.0928014f, 0.0764578f, 0.152643f,
+    0.100117f, 0.101305f, 0.112747f, 0.115914f, 0.107344f,
+    0.102186f, 0.101038f, 0.099833f, 0.110728f, 0.100648f,
+    0.075486f, 0.0606055f, 0.0926256f, 0.0604014f, 0.0626569f,
+    0.0703468f, 0.0726818f, 0.067035f, 0.0639604f, 0.063853f,
+    0.0628847f, 0.0709468f, 0.0646635f, 0.0484976f, 0.0387981f,
+    0.0756685f, 0.045874f, 0.0415595f, 0.047378f, 0.047342f,
+    0.0438943f, 0.0418939f, 0.0418281f, 0.0412506f, 0.0469715f,
+    0.0426483f, 0.0319862f, 0.0265237f, 0.0741758f, 0.0439875f,
+    0.0402477f, 0.0459571f, 0.041603f, 0.0387873f, 0.0378614f,
+    0.03845f, 0.0387989f, 0.0407542f, 0.0386308f, 0.0294761f,
+    0.0235809f, 0.0740497f, 0.043725f, 0.0400682f, 0.0457655f,
+    0.0400984f, 0.0374883f, 0.0377158f, 0.0382924f, 0.038584f,
+    0.0395527f, 0.0384505f, 0.0292721f, 0.0234177f, 0.383807f,
+    0.22663f, 0.207676f, 0.237206f, 0.207786f, 0.194266f,
+    0.195484f, 0.198472f, 0.199981f, 0.205004f, 0.199291f,
+    0.151717f, 0.121374f, 0.291964f, 0.180759f, 0.163672f,
+    0.183414f, 0.183898f, 0.171246f, 0.162839f, 0.16008f,
+    0.158597f, 0.174577f, 0.158067f, 0.120479f, 0.0984723f,
+    0.226693f, 0.143841f, 0.137451f, 0.152198f, 0.156003f,
+    0.144825f, 0.137812f, 0.135959f, 0.134486f, 0.148754f,
+    0.13498f, 0.101235f, 0.08262f, 0.166675f, 0.104126f,
+    0.098803f, 0.109799f, 0.112771f, 0.104516f, 0.0995864f,
+    0.0987742f, 0.0975378f, 0.108973f, 0.0989952f, 0.0742464f,
+    0.0605722f, 0.149718f, 0.0895987f, 0.0816275f, 0.0931433f,
+    0.0874312f, 0.081375f, 0.07752f, 0.0780877f, 0.0788353f,
+    0.0849976f, 0.0783629f, 0.0600111f, 0.0485383f, 0.148225f,
+    0.0877123f, 0.0803157f, 0.0917223f, 0.0816922f, 0.076268f,
+    0.075577f, 0.0767255f, 0.0773823f, 0.0792716f, 0.0770809f,
+    0.0587476f, 0.0469981f, 0.148099f, 0.0874498f, 0.0801362f,
+    0.0915307f, 0.0801877f, 0.074969f, 0.0754314f, 0.0765847f,
+    0.0771674f, 0.0791051f, 0.0769006f, 0.0585436f, 0.0468349f,
+    0.457856f, 0.270355f, 0.247744f, 0.282971f, 0.247876f,
+    0.231747f, 0.233199f, 0.236765f, 0.238565f, 0.244557f,
+    0.237741f, 0.180989f, 0.144791f, 0.366013f, 0.224484f,
+    0.20296f, 0.229179f, 0.223987f, 0.208727f, 0.198465f,
+    0.195001f, 0.196191f, 0.212603f, 0.193506f, 0.149751f,
+    0.120487f, 0.300743f, 0.187566f, 0.173597f, 0.19165f,
+    0.196093f, 0.182306f, 0.173438f, 0.17088f, 0.169139f,
+    0.18678f, 0.169312f, 0.126984f, 0.104635f, 0.240725f,
+    0.147851f, 0.134949f, 0.151237f, 0.15286f, 0.141997f,
+    0.135212f, 0.133695f, 0.132191f, 0.146999f, 0.133327f,
+    0.0999953f, 0.0825867f, 0.223768f, 0.133324f, 0.121695f,
+    0.138908f, 0.12752f, 0.118856f, 0.114422f, 0.11635f,
+    0.117419f, 0.123024f, 0.116813f, 0.0892826f, 0.0714261f,
+    0.222275f, 0.131437f, 0.120384f, 0.137488f, 0.121781f,
+    0.113749f, 0.113293f, 0.115018f, 0.115966f, 0.118824f,
+    0.115531f, 0.0880191f, 0.0704153f, 0.222149f, 0.131175f,
+    0.120204f, 0.137296f, 0.120277f, 0.11245f, 0.113147f,
+    0.114877f, 0.115751f, 0.118658f, 0.115351f, 0.0878151f,
+    0.0702521f, 0.605956f, 0.357804f, 0.32788f, 0.374501f,
+    0.328054f, 0.306709f, 0.30863f, 0.313349f, 0.315732f,
+    0.323661f, 0.314641f, 0.239531f, 0.191625f, 0.514113f,
+    0.311934f, 0.282372f, 0.320709f, 0.304166f, 0.283688f,
+    0.269717f, 0.270857f, 0.273358f, 0.288655f, 0.270406f,
+    0.208294f, 0.166635f, 0.448842f, 0.275016f, 0.248434f,
+    0.281194f, 0.276271f, 0.257267f, 0.24469f, 0.240723f,
+    0.240384f, 0.262832f, 0.237975f, 0.183529f, 0.148664f,
+    0.388824f, 0.235301f, 0.212935f, 0.242767f, 0.233039f,
+    0.216958f, 0.206465f, 0.204361f, 0.206335f, 0.223051f,
+    0.204514f, 0.157302f, 0.126616f, 0.371867f, 0.220773f,
+    0.201831f, 0.230439f, 0.207699f, 0.193817f, 0.189853f,
+    0.192874f, 0.194585f, 0.199178f, 0.193713f, 0.147825f,
+    0.11826f, 0.370374f, 0.218887f, 0.20052f, 0.229018f,
+    0.20196f, 0.18871f, 0.188724f, 0.191602f, 0.193132f,
+    0.197929f, 0.192431f, 0.146562f, 0.11725f, 0.370248f,
+    0.218624f, 0.20034f, 0.228826f, 0.200455f, 0.187411f,
+    0.188578f, 0.191461f, 0.192918f, 0.197762f, 0.192251f,
+    0.146358f, 0.117086f, 1.7167f, 1.01368f, 0.9289f,
+    1.06098f, 0.929393f, 0.86892f, 0.874365f, 0.887733f,
+    0.894482f, 0.916948f, 0.891393f, 0.678604f, 0.542883f,
+    1.62486f, 0.967805f, 0.882365f, 1.00719f, 0.905504f,
+    0.8459f, 0.830139f, 0.844786f, 0.852109f, 0.870994f,
+    0.847158f, 0.647366f, 0.517893f, 1.55959f, 0.930888f,
+    0.847885f, 0.967672f, 0.87761f, 0.819478f, 0.79749f,
+    0.811993f, 0.819135f, 0.836861f, 0.814074f, 0.622602f,
+    0.498081f, 1.49957f, 0.891172f, 0.813955f, 0.929246f,
+    0.834377f, 0.779169f, 0.765698f, 0.77829f, 0.785085f,
+    0.803321f, 0.781266f, 0.596375f, 0.4771f, 1.48261f,
+    0.876645f, 0.802851f, 0.916917f, 0.809038f, 0.756029f,
+    0.755587f, 0.767102f, 0.773336f, 0.792464f, 0.770465f,
+    0.586898f, 0.469518f, 1.48112f, 0.874758f, 0.801539f,
+    0.915496f, 0.803299f, 0.750922f, 0.754458f, 0.765986f,
+    0.771883f, 0.791215f, 0.769183f, 0.585634f, 0.468508f,
+    1.48099f, 0.874496f, 0.80136f, 0.915305f, 0.801794f,
+    0.749623f, 0.754312f, 0.765845f, 0.771668f, 0.791049f,
+    0.769002f, 0.58543f, 0.468344f, 0.161918f, 0.124729f,
+    0.138976f, 0.127839f, 0.124479f, 0.124843f, 0.125216f,
+    0.123953f, 0.120153f, 0.122665f, 0.119198f, 0.0911492f,
+    0.0729193f, 0.127411f, 0.0803863f, 0.106211f, 0.0968189f,
+    0.102507f, 0.0964352f, 0.0936841f, 0.0884996f, 0.0848923f,
+    0.0953579f, 0.0897202f, 0.0672902f, 0.0545235f, 0.0950427f,
+    0.0605494f, 0.0786927f, 0.0713699f, 0.0762882f, 0.0713556f,
+    0.0690071f, 0.0655655f, 0.0624907f, 0.0701953f, 0.066882f,
+    0.0501615f, 0.0401292f, 0.0492218f, 0.0313551f, 0.0353827f,
+    0.0315759f, 0.0346769f, 0.0319794f, 0.0306288f, 0.0295372f,
+    0.0277619f, 0.0315444f, 0.0309016f, 0.0231762f, 0.0185409f,
+    0.0183203f, 0.0159775f, 0.00895847f, 0.00905971f, 0.0100868f,
+    0.00823708f, 0.0109592f, 0.0120106f, 0.0107958f, 0.0108232f,
+    0.00967329f, 0.00883772f, 0.00790493f, 0.00703923f, 0.00918443f,
+    0.00669483f, 0.00453979f, 0.00540634f, 0.00435803f, 0.00543636f,
+    0.00596007f, 0.0052839f, 0.00646855f, 0.00539046f, 0.00617458f,
+    0.00692183f, 0.000294743f, 0.0031254f, 0.00214103f, 0.00142736f,
+    0.00107052f, 0.00132463f, 0.00110386f, 0.000946165f, 0.00254474f,
+    0.00345806f, 0.00288172f, 0.00282515f, 0.00362321f, 0.212787f,
+    0.163914f, 0.182636f, 0.168001f, 0.163586f, 0.164064f,
+    0.164554f, 0.162895f, 0.1579f, 0.161202f, 0.156645f,
+    0.119785f, 0.0958276f, 0.178279f, 0.118086f, 0.146905f,
+    0.134039f, 0.141613f, 0.133412f, 0.129765f, 0.122423f,
+    0.11763f, 0.132242f, 0.124026f, 0.0930195f, 0.0768334f,
+    0.145911f, 0.0920261f, 0.119386f, 0.10859f, 0.115395f,
+    0.108332f, 0.105088f, 0.0994893f, 0.0952281f, 0.107079f,
+    0.101188f, 0.0758908f, 0.0607126f, 0.10009f, 0.062428f,
+    0.0760762f, 0.0687958f, 0.0737832f, 0.068956f, 0.0667099f,
+    0.063461f, 0.0604993f, 0.0684285f, 0.0652073f, 0.0489055f,
+    0.0391244f, 0.0691885f, 0.0422287f, 0.0496519f, 0.0448997f,
+    0.0481594f, 0.0450932f, 0.0437195f, 0.041503f, 0.0397034f,
+    0.0452376f, 0.0428423f, 0.0321317f, 0.0263486f, 0.0579074f,
+    0.0393115f, 0.0438256f, 0.0403014f, 0.0416225f, 0.0393934f,
+    0.0394979f, 0.0391463f, 0.0379772f, 0.0393204f, 0.0376168f,
+    0.0288754f, 0.0235732f, 0.0511629f, 0.0391849f, 0.0436607f,
+    0.040162f, 0.0391962f, 0.039221f, 0.0393381f, 0.0389415f,
+    0.0377482f, 0.0385368f, 0.0374473f, 0.0286364f, 0.0229091f,
+    0.263655f, 0.203099f, 0.226297f, 0.208163f, 0.202692f,
+    0.203285f, 0.203892f, 0.201836f, 0.195647f, 0.199738f,
+    0.194092f, 0.14842f, 0.118736f, 0.229147f, 0.15727f,
+    0.187598f, 0.171258f, 0.18072f, 0.170388f, 0.165846f,
+    0.158872f, 0.15446f, 0.169126f, 0.158332f, 0.118749f,
+    0.0991432f, 0.196779f, 0.123503f, 0.16008f, 0.14581f,
+    0.154501f, 0.145309f, 0.141169f, 0.133413f, 0.127966f,
+    0.143963f, 0.135493f, 0.10162f, 0.0827699f, 0.150958f,
+    0.0939047f, 0.11677f, 0.106016f, 0.11289f, 0.105933f,
+    0.102791f, 0.0973848f, 0.0932368f, 0.105313f, 0.0995131f,
+    0.0746348f, 0.0604655f, 0.120057f, 0.0796241f, 0.0903454f,
+    0.0821195f, 0.0872658f, 0.0820698f, 0.0800495f, 0.0795327f,
+    0.0771908f, 0.0821217f, 0.077148f, 0.0588628f, 0.0486585f,
+    0.108776f, 0.0784963f, 0.0874861f, 0.0804633f, 0.0807288f,
+    0.0786141f, 0.0788357f, 0.0780874f, 0.0757243f, 0.0772388f,
+    0.0750638f, 0.0575108f, 0.0460086f, 0.102031f, 0.0783697f,
+    0.0873212f, 0.0803239f, 0.0783025f, 0.0784418f, 0.0786759f,
+    0.0778826f, 0.0754952f, 0.0770732f, 0.0748944f, 0.0572717f,
+    0.0458174f, 0.314523f, 0.242284f, 0.269957f, 0.248325f,
+    0.241798f, 0.242506f, 0.24323f, 0.240777f, 0.233394f,
+    0.238275f, 0.231539f, 0.177055f, 0.141644f, 0.280015f,
+    0.196455f, 0.228292f, 0.208478f, 0.219826f, 0.207365f,
+    0.201927f, 0.197814f, 0.192207f, 0.20601f, 0.192637f,
+    0.146978f, 0.121453f, 0.247647f, 0.16249f, 0.200773f,
+    0.183029f, 0.193607f, 0.182285f, 0.17725f, 0.167337f,
+    0.160703f, 0.180848f, 0.169799f, 0.127349f, 0.10508f,
+    0.201826f, 0.129316f, 0.157463f, 0.143235f, 0.151996f,
+    0.142909f, 0.138872f, 0.131309f, 0.12658f, 0.142197f,
+    0.133819f, 0.100364f, 0.0827753f, 0.170925f, 0.118809f,
+    0.132474f, 0.121796f, 0.126372f, 0.119099f, 0.119387f,
+    0.118474f, 0.114938f, 0.119006f, 0.113743f, 0.0874982f,
+    0.0709683f, 0.159644f, 0.117681f, 0.131147f, 0.120625f,
+    0.119835f, 0.117835f, 0.118174f, 0.117029f, 0.113471f,
+    0.115775f, 0.112511f, 0.0861462f, 0.0689169f, 0.152899f,
+    0.117555f, 0.130982f, 0.120486f, 0.117409f, 0.117663f,
+    0.118014f, 0.116824f, 0.113242f, 0.11561f, 0.112341f,
+    0.085907f, 0.0687256f, 0.416259f, 0.320653f, 0.357278f,
+    0.328649f, 0.320011f, 0.320947f, 0.321905f, 0.318659f,
+    0.308888f, 0.315348f, 0.306433f, 0.234326f, 0.187461f,
+    0.381752f, 0.274825f, 0.309679f, 0.282918f, 0.298039f,
+    0.281318f, 0.276049f, 0.275696f, 0.267702f, 0.279778f,
+    0.263338f, 0.204248f, 0.166073f, 0.349384f, 0.24086f,
+    0.28216f, 0.257469f, 0.27182f, 0.256239f, 0.249413f,
+    0.242397f, 0.235504f, 0.254616f, 0.238411f, 0.180193f,
+    0.149699f, 0.303563f, 0.207685f, 0.23885f, 0.217675f,
+    0.230209f, 0.216862f, 0.211034f, 0.208135f, 0.202074f,
+    0.215965f, 0.20243f, 0.154369f, 0.127395f, 0.272661f,
+    0.197179f, 0.219795f, 0.20212f, 0.204585f, 0.197541f,
+    0.198063f, 0.196356f, 0.190432f, 0.194079f, 0.188637f,
+    0.144769f, 0.115815f, 0.26138f, 0.196051f, 0.218468f,
+    0.200949f, 0.198048f, 0.196276f, 0.196849f, 0.194911f,
+    0.188965f, 0.192848f, 0.187405f, 0.143417f, 0.114733f,
+    0.254636f, 0.195924f, 0.218303f, 0.20081f, 0.195621f,
+    0.196104f, 0.196689f, 0.194706f, 0.188736f, 0.192683f,
+    0.187235f, 0.143178f, 0.114542f, 1.17928f, 0.908426f,
+    1.01219f, 0.931077f, 0.906606f, 0.909258f, 0.911972f,
+    0.902776f, 0.875094f, 0.893395f, 0.868138f, 0.663856f,
+    0.531085f, 1.14477f, 0.862598f, 0.96136f, 0.88407f,
+    0.884633f, 0.863894f, 0.866116f, 0.859813f, 0.833907f,
+    0.848715f, 0.825043f, 0.633779f, 0.507023f, 1.11241f,
+    0.828632f, 0.923609f, 0.849261f, 0.858415f, 0.830082f,
+    0.832118f, 0.826514f, 0.80171f, 0.815481f, 0.792799f,
+    0.609723f, 0.487779f, 1.06659f, 0.795458f, 0.886583f,
+    0.815306f, 0.816803f, 0.796721f, 0.798825f, 0.792252f,
+    0.76828f, 0.782757f, 0.760834f, 0.583899f, 0.467119f,
+    1.03568f, 0.784951f, 0.874703f, 0.804549f, 0.79118f,
+    0.785852f, 0.78813f, 0.780473f, 0.756638f, 0.772126f,
+    0.750343f, 0.574299f, 0.459439f, 1.0244f, 0.783823f,
+    0.873375f, 0.803378f, 0.784643f, 0.784587f, 0.786916f,
+    0.779027f, 0.755171f, 0.770896f, 0.74911f, 0.572947f,
+    0.458358f, 1.01766f, 0.783697f, 0.873211f, 0.803238f,
+    0.782216f, 0.784415f, 0.786757f, 0.778823f, 0.754942f,
+    0.77073f, 0.748941f, 0.572708f, 0.458166f, 0.154491f,
+    0.134264f, 0.136026f, 0.126906f, 0.125315f, 0.126254f,
+    0.123259f, 0.118922f, 0.116193f, 0.122777f, 0.117222f,
+    0.0912824f, 0.0730259f, 0.0984042f, 0.0888827f, 0.0931464f,
+    0.0904939f, 0.0990617f, 0.0966342f, 0.0943388f, 0.0944312f,
+    0.0906493f, 0.094984f, 0.0887807f, 0.0665855f, 0.0532684f,
+    0.0606002f, 0.0605831f, 0.0683691f, 0.0667092f, 0.0735724f,
+    0.0715511f, 0.0701838f, 0.0708515f, 0.0679015f, 0.0706602f,
+    0.0674545f, 0.0505909f, 0.0404727f, 0.027202f, 0.0265997f,
+    0.029729f, 0.0292948f, 0.0330609f, 0.0319183f, 0.0318909f,
+    0.0330123f, 0.0315678f, 0.0328588f, 0.0329818f, 0.0247363f,
+    0.0197891f, 0.00881563f, 0.00928927f, 0.0111036f, 0.0101681f,
+    0.00876256f, 0.00813499f, 0.00846483f, 0.00921375f, 0.0100257f,
+    0.00977407f, 0.010469f, 0.0100575f, 0.00989071f, 0.00565001f,
+    0.00629154f, 0.00497026f, 0.00529467f, 0.00428344f, 0.00425289f,
+    0.00486064f, 0.00448257f, 0.00511134f, 0.00743872f, 0.00619893f,
+    0.00771988f, 0.00787992f, 0.000988869f, 0.00138808f, 0.000694041f,
+    0.000898931f, 0.00229605f, 0.00183684f, 0.00351294f, 0.00301109f,
+    0.00263471f, 0.00423408f, 0.0035284f, 0.00264927f, 0.00313345f,
+    0.203026f, 0.176444f, 0.17876f, 0.166775f, 0.164684f,
+    0.165918f, 0.161982f, 0.156283f, 0.152696f, 0.161349f,
+    0.154049f, 0.11996f, 0.0959677f, 0.146939f, 0.131063f,
+    0.129022f, 0.125215f, 0.136869f, 0.13362f, 0.130352f,
+    0.13025f, 0.125108f, 0.13149f, 0.122278f, 0.0917085f,
+    0.0733668f, 0.104734f, 0.0950931f, 0.104244f, 0.101431f,
+    0.111379f, 0.108537f, 0.106197f, 0.10667f, 0.10236f,
+    0.107166f, 0.100952f, 0.0757139f, 0.0605711f, 0.0631493f,
+    0.0580848f, 0.0656042f, 0.0640163f, 0.0708679f, 0.068904f,
+    0.0679037f, 0.0688308f, 0.0660261f, 0.0693646f, 0.0664791f,
+    0.0498593f, 0.0398875f, 0.0500399f, 0.0439968f, 0.0442661f,
+    0.0415885f, 0.0460538f, 0.0448181f, 0.0443458f, 0.0450322f,
+    0.0432413f, 0.0460407f, 0.0439664f, 0.0329748f, 0.0263798f,
+    0.048679f, 0.0423871f, 0.0429212f, 0.0400455f, 0.0399008f,
+    0.0398235f, 0.0388869f, 0.0386997f, 0.0371839f, 0.0397594f,
+    0.0373975f, 0.0289183f, 0.0231346f, 0.0485349f, 0.0421804f,
+    0.0427342f, 0.0398692f, 0.0393694f, 0.0396642f, 0.0387232f,
+    0.037361f, 0.0365033f, 0.038572f, 0.0368267f, 0.0286781f,
+    0.0229425f, 0.251561f, 0.218624f, 0.221493f, 0.206644f,
+    0.204054f, 0.205582f, 0.200704f, 0.193643f, 0.189199f,
+    0.199921f, 0.190875f, 0.148637f, 0.11891f, 0.195474f,
+    0.173243f, 0.171677f, 0.16018f, 0.174676f, 0.170606f,
+    0.166364f, 0.166068f, 0.159566f, 0.167996f, 0.155775f,
+    0.118671f, 0.0949365f, 0.153268f, 0.137273f, 0.140119f,
+    0.136152f, 0.149186f, 0.145523f, 0.14221f, 0.142488f,
+    0.136818f, 0.143672f, 0.134449f, 0.100837f, 0.0806695f,
+    0.111684f, 0.0994415f, 0.101479f, 0.0987379f, 0.108675f,
+    0.10589f, 0.103917f, 0.104649f, 0.100484f, 0.10587f,
+    0.0999765f, 0.0749824f, 0.0599859f, 0.0985748f, 0.086177f,
+    0.0869999f, 0.0811784f, 0.0838608f, 0.0818037f, 0.0803587f,
+    0.0808507f, 0.0776997f, 0.0825465f, 0.0774637f, 0.0589711f,
+    0.0471768f, 0.0972139f, 0.0845673f, 0.085655f, 0.0799143f,
+    0.0789123f, 0.0794875f, 0.0776098f, 0.0749065f, 0.0731615f,
+    0.0773154f, 0.0738297f, 0.0575955f, 0.0460764f, 0.0970698f,
+    0.0843606f, 0.0854679f, 0.079738f, 0.0787384f, 0.0793281f,
+    0.077446f, 0.0747215f, 0.0730063f, 0.0771436f, 0.0736532f,
+    0.0573554f, 0.0458843f, 0.300096f, 0.260804f, 0.264227f,
+    0.246513f, 0.243423f, 0.245246f, 0.239427f, 0.231004f,
+    0.225702f, 0.238492f, 0.227701f, 0.177314f, 0.141851f,
+    0.244009f, 0.215423f, 0.214411f, 0.200049f, 0.212483f,
+    0.207591f, 0.202377f, 0.201887f, 0.194024f, 0.204501f,
+    0.189273f, 0.147348f, 0.117878f, 0.201803f, 0.179453f,
+    0.177512f, 0.170874f, 0.186993f, 0.182508f, 0.178223f,
+    0.178307f, 0.171277f, 0.180177f, 0.167947f, 0.12596f,
+    0.100768f, 0.160219f, 0.141622f, 0.141381f, 0.133459f,
+    0.146482f, 0.142875f, 0.13993f, 0.140468f, 0.134943f,
+    0.142376f, 0.133474f, 0.100105f, 0.0800843f, 0.14711f,
+    0.128357f, 0.129734f, 0.121047f, 0.121668f, 0.120363f,
+    0.117546f, 0.116669f, 0.112158f, 0.119052f, 0.111914f,
+    0.0876483f, 0.0701186f, 0.145749f, 0.126747f, 0.128389f,
+    0.119783f, 0.118281f, 0.119151f, 0.116333f, 0.112267f,
+    0.109664f, 0.115887f, 0.110656f, 0.0862727f, 0.0690181f,
+    0.145605f, 0.126541f, 0.128202f, 0.119607f, 0.118107f,
+    0.118992f, 0.116169f, 0.112082f, 0.109509f, 0.115715f,
+    0.11048f, 0.0860326f, 0.0688261f, 0.397165f, 0.345165f,
+    0.349695f, 0.32625f, 0.322161f, 0.324574f, 0.316873f,
+    0.305725f, 0.298708f, 0.315636f, 0.301354f, 0.234669f,
+    0.187735f, 0.341079f, 0.299784f, 0.299879f, 0.279786f,
+    0.288097f, 0.281563f, 0.274403f, 0.273524f, 0.262941f,
+    0.277513f, 0.25933f, 0.204702f, 0.163762f, 0.298873f,
+    0.263814f, 0.26298f, 0.24538f, 0.262607f, 0.25648f,
+    0.250248f, 0.249944f, 0.240193f, 0.253189f, 0.234941f,
+    0.180661f, 0.144529f, 0.257289f, 0.225982f, 0.226848f,
+    0.211674f, 0.222096f, 0.216847f, 0.211955f, 0.212105f,
+    0.203859f, 0.215387f, 0.200468f, 0.154722f, 0.123777f,
+    0.244179f, 0.212718f, 0.215201f, 0.200785f, 0.198288f,
+    0.199691f, 0.194991f, 0.188315f, 0.183825f, 0.194285f,
+    0.185567f, 0.145003f, 0.116002f, 0.242818f, 0.211108f,
+    0.213856f, 0.199521f, 0.197019f, 0.198479f, 0.193778f,
+    0.186988f, 0.18267f, 0.19303f, 0.184309f, 0.143627f,
+    0.114902f, 0.242674f, 0.210901f, 0.213669f, 0.199345f,
+    0.196845f, 0.19832f, 0.193615f, 0.186803f, 0.182515f,
+    0.192858f, 0.184133f, 0.143387f, 0.11471f, 1.12519f,
+    0.977867f, 0.990701f, 0.924283f, 0.912696f, 0.919533f,
+    0.897716f, 0.866133f, 0.846253f, 0.89421f, 0.85375f,
+    0.664827f, 0.531862f, 1.0691f, 0.932487f, 0.940885f,
+    0.877818f, 0.867107f, 0.873153f, 0.852614f, 0.824349f,
+    0.803896f, 0.849636f, 0.811727f, 0.634861f, 0.507888f,
+    1.0269f, 0.896517f, 0.903986f, 0.843412f, 0.833169f,
+    0.838856f, 0.819178f, 0.792318f, 0.772393f, 0.816407f,
+    0.78009f, 0.610819f, 0.488655f, 0.985312f, 0.858685f,
+    0.867854f, 0.809707f, 0.799717f, 0.805366f, 0.786402f,
+    0.759745f, 0.741406f, 0.783585f, 0.748477f, 0.58488f,
+    0.467904f, 0.972202f, 0.84542f, 0.856207f, 0.798817f,
+    0.788824f, 0.79465f, 0.775834f, 0.748723f, 0.731371f,
+    0.77286f, 0.737963f, 0.575161f, 0.460129f, 0.970841f,
+    0.843811f, 0.854862f, 0.797553f, 0.787555f, 0.793438f,
+    0.774621f, 0.747397f, 0.730216f, 0.771605f, 0.736705f,
+    0.573785f, 0.459028f, 0.970697f, 0.843604f, 0.854675f,
+    0.797377f, 0.787381f, 0.793279f, 0.774457f, 0.747211f,
+    0.730061f, 0.771433f, 0.736529f, 0.573545f, 0.458836f,
+    0.148471f, 0.129576f, 0.132165f, 0.131331f, 0.130067f,
+    0.124834f, 0.120457f, 0.119091f, 0.115089f, 0.118875f,
+    0.111033f, 0.0848977f, 0.06804f, 0.125435f, 0.0987035f,
+    0.0977793f, 0.0999591f, 0.0986914f, 0.100464f, 0.0963052f,
+    0.0932777f, 0.0899754f, 0.0935389f, 0.0877376f, 0.0658033f,
+    0.0526426f, 0.095402f, 0.0734907f, 0.0719647f, 0.0743581f,
+    0.0734836f, 0.0750831f, 0.0723138f, 0.0703464f, 0.0680088f,
+    0.0702389f, 0.0681114f, 0.0510836f, 0.0408668f, 0.0445278f,
+    0.0328048f, 0.0314405f, 0.0332894f, 0.0330408f, 0.0342565f,
+    0.0334184f, 0.0330052f, 0.0321985f, 0.0335184f, 0.0353584f,
+    0.0265188f, 0.021215f, 0.0113259f, 0.00917926f, 0.0109911f,
+    0.00963831f, 0.0083913f, 0.00871199f, 0.00875089f, 0.00897666f,
+    0.00896012f, 0.00994545f, 0.0123276f, 0.00924568f, 0.0102856f,
+    0.00473453f, 0.00405314f, 0.0051422f, 0.00440918f, 0.00402334f,
+    0.00363189f, 0.00343684f, 0.0036513f, 0.00377693f, 0.00806634f,
+    0.00672195f, 0.00603221f, 0.00724309f, 0.000540662f, 0.000471862f,
+    0.00077701f, 0.000583032f, 0.000770865f, 0.00259553f, 0.00216294f,
+    0.00185395f, 0.00235674f, 0.00389063f, 0.00324219f, 0.00243165f,
+    0.00223219f, 0.195115f, 0.170284f, 0.173686f, 0.172589f,
+    0.170929f, 0.164052f, 0.158299f, 0.156504f, 0.151245f,
+    0.156221f, 0.145915f, 0.111569f, 0.0894154f, 0.172079f,
+    0.13616f, 0.135332f, 0.13799f, 0.136233f, 0.138629f,
+    0.132758f, 0.128506f, 0.123936f, 0.129343f, 0.120405f,
+    0.0903039f, 0.0722431f, 0.142046f, 0.110947f, 0.109517f,
+    0.112389f, 0.111025f, 0.113248f, 0.108767f, 0.105575f,
+    0.101969f, 0.106043f, 0.100779f, 0.0755842f, 0.0604674f,
+    0.0911714f, 0.0702614f, 0.0689931f, 0.0713207f, 0.0705825f,
+    0.0724213f, 0.0698718f, 0.068234f, 0.0661589f, 0.0693222f,
+    0.0680259f, 0.0510194f, 0.0408156f, 0.0579695f, 0.0452514f,
+    0.0448374f, 0.0460579f, 0.0456288f, 0.0468767f, 0.0452042f,
+    0.0442054f, 0.0429205f, 0.0456827f, 0.0449951f, 0.0337463f,
+    0.0269971f, 0.0493878f, 0.0409086f, 0.0416962f, 0.0414335f,
+    0.0410283f, 0.0403739f, 0.03878f, 0.037742f, 0.0365446f,
+    0.038953f, 0.0374857f, 0.0281143f, 0.0224914f, 0.0466749f,
+    0.0407081f, 0.0415213f, 0.041259f, 0.040862f, 0.0392181f,
+    0.0378429f, 0.0374138f, 0.0361565f, 0.037346f, 0.0348825f,
+    0.0266727f, 0.0213758f, 0.241758f, 0.210992f, 0.215207f,
+    0.213848f, 0.21179f, 0.20327f, 0.196142f, 0.193918f,
+    0.187401f, 0.193566f, 0.180798f, 0.138241f, 0.110791f,
+    0.218722f, 0.173617f, 0.172885f, 0.176022f, 0.173775f,
+    0.176794f, 0.169212f, 0.163735f, 0.157896f, 0.165147f,
+    0.153073f, 0.114805f, 0.0918437f, 0.188689f, 0.148404f,
+    0.14707f, 0.150421f, 0.148567f, 0.151413f, 0.145221f,
+    0.140804f, 0.13593f, 0.141847f, 0.133446f, 0.100085f,
+    0.0800679f, 0.137815f, 0.107718f, 0.106546f, 0.109352f,
+    0.108124f, 0.110586f, 0.106325f, 0.103463f, 0.100119f,
+    0.105126f, 0.100694f, 0.0755201f, 0.0604161f, 0.104613f,
+    0.0829865f, 0.0845213f, 0.0840893f, 0.0831704f, 0.0850415f,
+    0.0816576f, 0.0794342f, 0.0768809f, 0.0814865f, 0.0776627f,
+    0.0582471f, 0.0465976f, 0.0960313f, 0.0816162f, 0.0832172f,
+    0.0826922f, 0.08189f, 0.078607f, 0.0758461f, 0.0749909f,
+    0.0724701f, 0.0748657f, 0.0701533f, 0.0536152f, 0.0428922f,
+    0.0933184f, 0.0814157f, 0.0830423f, 0.0825177f, 0.0817237f,
+    0.078436f, 0.0756854f, 0.0748273f, 0.0723127f, 0.0746917f,
+    0.0697646f, 0.0533441f, 0.0427512f, 0.288402f, 0.251699f,
+    0.256728f, 0.255107f, 0.252652f, 0.242488f, 0.233984f,
+    0.231331f, 0.223557f, 0.230912f, 0.21568f, 0.164912f,
+    0.132166f, 0.265366f, 0.211074f, 0.210437f, 0.214053f,
+    0.211316f, 0.214959f, 0.205665f, 0.198964f, 0.191857f,
+    0.20095f, 0.18574f, 0.139305f, 0.111444f, 0.235333f,
+    0.185861f, 0.184623f, 0.188452f, 0.186109f, 0.189577f,
+    0.181674f, 0.176033f, 0.16989f, 0.17765f, 0.166114f,
+    0.124586f, 0.0996684f, 0.184459f, 0.145175f, 0.144098f,
+    0.147384f, 0.145666f, 0.148751f, 0.142778f, 0.138692f,
+    0.13408f, 0.14093f, 0.133361f, 0.100021f, 0.0800167f,
+    0.151257f, 0.123694f, 0.126042f, 0.12523f, 0.124009f,
+    0.123206f, 0.118111f, 0.114663f, 0.110841f, 0.11729f,
+    0.11033f, 0.0827477f, 0.0661982f, 0.142675f, 0.122324f,
+    0.124738f, 0.123951f, 0.122752f, 0.117825f, 0.113689f,
+    0.112404f, 0.108626f, 0.112211f, 0.104832f, 0.0802866f,
+    0.0642653f, 0.139962f, 0.122123f, 0.124563f, 0.123776f,
+    0.122585f, 0.117654f, 0.113528f, 0.112241f, 0.108469f,
+    0.112037f, 0.104647f, 0.0800155f, 0.0641266f, 0.381689f,
+    0.333115f, 0.33977f, 0.337624f, 0.334375f, 0.320923f,
+    0.309669f, 0.306159f, 0.29587f, 0.305603f, 0.285444f,
+    0.218255f, 0.174917f, 0.358653f, 0.285987f, 0.291377f,
+    0.290116f, 0.286575f, 0.291288f, 0.278572f, 0.269422f,
+    0.259777f, 0.272558f, 0.251075f, 0.191085f, 0.152868f,
+    0.32862f, 0.260774f, 0.259728f, 0.264515f, 0.261192f,
+    0.265907f, 0.25458f, 0.24649f, 0.237811f, 0.249258f,
+    0.231449f, 0.173587f, 0.13887f, 0.277746f, 0.220088f,
+    0.22042f, 0.223446f, 0.220749f, 0.22508f, 0.215685f,
+    0.209149f, 0.202f, 0.212537f, 0.198696f, 0.149022f,
+    0.119218f, 0.244544f, 0.205109f, 0.209084f, 0.207748f,
+    0.205732f, 0.199536f, 0.191018f, 0.188435f, 0.182104f,
+    0.188898f, 0.175884f, 0.135068f, 0.108054f, 0.235962f,
+    0.203739f, 0.20778f, 0.206468f, 0.204475f, 0.19626f,
+    0.189374f, 0.187231f, 0.180939f, 0.186903f, 0.174596f,
+    0.13363f, 0.107016f, 0.233249f, 0.203539f, 0.207605f,
+    0.206294f, 0.204309f, 0.196089f, 0.189213f, 0.187068f,
+    0.180781f, 0.186729f, 0.174411f, 0.133358f, 0.106877f,
+    1.08134f, 0.943729f, 0.962585f, 0.956505f, 0.947301f,
+    0.90919f, 0.877308f, 0.86736f, 0.838213f, 0.865788f,
+    0.808676f, 0.618326f, 0.495548f, 1.05831f, 0.896577f,
+    0.914192f, 0.908154f, 0.8995f, 0.863759f, 0.833305f,
+    0.82407f, 0.796451f, 0.823105f, 0.769693f, 0.591156f,
+    0.472925f, 1.02827f, 0.861579f, 0.878352f, 0.872511f,
+    0.864188f, 0.838378f, 0.801381f, 0.791814f, 0.765284f,
+    0.791001f, 0.739881f, 0.569049f, 0.455239f, 0.977399f,
+    0.827076f, 0.843235f, 0.837771f, 0.829712f, 0.797552f,
+    0.768577f, 0.759998f, 0.734491f, 0.758968f, 0.709513f,
+    0.544666f, 0.435733f, 0.944197f, 0.815724f, 0.831899f,
+    0.826628f, 0.818658f, 0.785773f, 0.758206f, 0.749637f,
+    0.724447f, 0.748348f, 0.699116f, 0.53514f, 0.42852f,
+    0.935615f, 0.814354f, 0.830595f, 0.825349f, 0.817401f,
+    0.784527f, 0.757012f, 0.748434f, 0.723282f, 0.747088f,
+    0.697828f, 0.533701f, 0.427647f, 0.932903f, 0.814153f,
+    0.83042f, 0.825174f, 0.817234f, 0.784356f, 0.756851f,
+    0.748271f, 0.723125f, 0.746914f, 0.697643f, 0.53343f,
+    0.427508f, 0.1344f, 0.128878f, 0.131496f, 0.130934f,
+    0.128101f, 0.12276f, 0.121145f, 0.116058f, 0.111347f,
+    0.109991f, 0.0993555f, 0.075365f, 0.0605188f, 0.0910299f,
+    0.100131f, 0.101781f, 0.098225f, 0.0968734f, 0.0950022f,
+    0.0925796f, 0.0912873f, 0.087756f, 0.086435f, 0.0798739f,
+    0.0599055f, 0.0479243f, 0.0554678f, 0.0739349f, 0.0749108f,
+    0.072875f, 0.072337f, 0.0711831f, 0.0698505f, 0.069528f,
+    0.0670897f, 0.0661169f, 0.0636233f, 0.0477175f, 0.038174f,
+    0.0283109f, 0.0325527f, 0.0327773f, 0.032601f, 0.0329896f,
+    0.0329329f, 0.0329815f, 0.0337719f, 0.0331044f, 0.0335415f,
+    0.0359558f, 0.0269669f, 0.0215735f, 0.0130846f, 0.0117065f,
+    0.0104829f, 0.00935434f, 0.00897675f, 0.00880088f, 0.00904489f,
+    0.00983019f, 0.0100107f, 0.0133726f, 0.0148468f, 0.0111351f,
+    0.00944317f, 0.00729756f, 0.00646097f, 0.00502805f, 0.00418546f,
+    0.00375506f, 0.00403207f, 0.00450467f, 0.00423521f, 0.00557565f,
+    0.0102293f, 0.00852439f, 0.0063933f, 0.00588312f, 0.00146406f,
+    0.000859773f, 0.000775636f, 0.00105097f, 0.000859964f, 0.00272315f,
+    0.00379309f, 0.00352854f, 0.00403791f, 0.00463973f, 0.00386644f,
+    0.00289983f, 0.00231986f, 0.176624f, 0.169366f, 0.172807f,
+    0.172068f, 0.168345f, 0.161326f, 0.159204f, 0.152519f,
+    0.146327f, 0.144545f, 0.130569f, 0.0990418f, 0.0795315f,
+    0.133253f, 0.138478f, 0.140898f, 0.135754f, 0.133736f,
+    0.13113f, 0.127631f, 0.125646f, 0.120763f, 0.119243f,
+    0.109246f, 0.0819345f, 0.0655476f, 0.097691f, 0.112282f,
+    0.114029f, 0.110404f, 0.109199f, 0.107311f, 0.104901f,
+    0.103886f, 0.100097f, 0.0989251f, 0.0929955f, 0.0697466f,
+    0.0557973f, 0.0588151f, 0.0708999f, 0.0718951f, 0.0701296f,
+    0.0698517f, 0.0690605f, 0.0680324f, 0.0681302f, 0.0661114f,
+    0.0663498f, 0.065328f, 0.048996f, 0.0391968f, 0.0443846f,
+    0.0459982f, 0.0467313f, 0.0454667f, 0.0452278f, 0.0447848f,
+    0.0440958f, 0.0441885f, 0.0430177f, 0.043933f, 0.044219f,
+    0.0331643f, 0.0265314f, 0.0424916f, 0.0406599f, 0.0414794f,
+    0.0413114f, 0.0404092f, 0.0387309f, 0.038228f, 0.0372561f,
+    0.0360948f, 0.0367151f, 0.0361451f, 0.0271088f, 0.021687f,
+    0.0422235f, 0.0404886f, 0.0413111f, 0.0411345f, 0.0402445f,
+    0.0385666f, 0.0380592f, 0.0364612f, 0.0349809f, 0.0345549f,
+    0.0312139f, 0.0236793f, 0.0190133f, 0.218847f, 0.209854f,
+    0.214117f, 0.213202f, 0.208589f, 0.199893f, 0.197263f,
+    0.18898f, 0.181308f, 0.1791f, 0.161782f, 0.122718f,
+    0.0985439f, 0.175476f, 0.176825f, 0.180016f, 0.173282f,
+    0.170598f, 0.167257f, 0.162681f, 0.160004f, 0.15377f,
+    0.152052f, 0.138618f, 0.103964f, 0.083171f, 0.139914f,
+    0.150629f, 0.153146f, 0.147932f, 0.146061f, 0.143438f,
+    0.139952f, 0.138244f, 0.133104f, 0.131733f, 0.122368f,
+    0.0917757f, 0.0734206f, 0.101038f, 0.109247f, 0.111013f,
+    0.107658f, 0.106714f, 0.105188f, 0.103083f, 0.102489f,
+    0.0991183f, 0.099158f, 0.0947002f, 0.0710251f, 0.0568201f,
+    0.0866077f, 0.0843455f, 0.0858491f, 0.0837241f, 0.08209f,
+    0.0809124f, 0.0791467f, 0.0785468f, 0.0760247f, 0.0767412f,
+    0.0735912f, 0.0551934f, 0.0441547f, 0.0847147f, 0.0811481f,
+    0.0827901f, 0.0824456f, 0.0806533f, 0.0772972f, 0.0762869f,
+    0.0730926f, 0.0701269f, 0.0695234f, 0.0655173f, 0.0491379f,
+    0.0393103f, 0.0844466f, 0.0809768f, 0.0826217f, 0.0822687f,
+    0.0804886f, 0.0771328f, 0.0761181f, 0.0729221f, 0.0699616f,
+    0.0691095f, 0.0624273f, 0.047356f, 0.0380259f, 0.26107f,
+    0.250343f, 0.255428f, 0.254336f, 0.248833f, 0.238459f,
+    0.235322f, 0.225441f, 0.216289f, 0.213654f, 0.192996f,
+    0.146395f, 0.117557f, 0.217699f, 0.215173f, 0.219134f,
+    0.210811f, 0.20746f, 0.203385f, 0.197732f, 0.194362f,
+    0.186777f, 0.18486f, 0.16799f, 0.125993f, 0.100794f,
+    0.182137f, 0.188977f, 0.192264f, 0.185461f, 0.182923f,
+    0.179566f, 0.175003f, 0.172603f, 0.166111f, 0.164542f,
+    0.15174f, 0.113805f, 0.0910439f, 0.143261f, 0.147594f,
+    0.150131f, 0.145187f, 0.143576f, 0.141316f, 0.138134f,
+    0.136847f, 0.132125f, 0.131966f, 0.124072f, 0.0930543f,
+    0.0744434f, 0.128831f, 0.122884f, 0.125338f, 0.124858f,
+    0.12213f, 0.11708f, 0.11558f, 0.112905f, 0.109032f,
+    0.109549f, 0.102963f, 0.0772225f, 0.061778f, 0.126938f,
+    0.121636f, 0.124101f, 0.12358f, 0.120897f, 0.115863f,
+    0.114346f, 0.109553f, 0.105108f, 0.10385f, 0.0948894f,
+    0.0713973f, 0.0572191f, 0.12667f, 0.121465f, 0.123932f,
+    0.123403f, 0.120733f, 0.115699f, 0.114177f, 0.109383f,
+    0.104942f, 0.103664f, 0.0936408f, 0.0710325f, 0.0570385f,
+    0.345516f, 0.331319f, 0.338049f, 0.336605f, 0.329322f,
+    0.315591f, 0.31144f, 0.298363f, 0.28625f, 0.282764f,
+    0.255423f, 0.193748f, 0.155582f, 0.302146f, 0.291867f,
+    0.29737f, 0.288327f, 0.282141f, 0.27564f, 0.267834f,
+    0.263079f, 0.252791f, 0.250476f, 0.226735f, 0.170731f,
+    0.136585f, 0.266584f, 0.265671f, 0.2705f, 0.260518f,
+    0.256648f, 0.251821f, 0.245105f, 0.241319f, 0.232125f,
+    0.230158f, 0.210484f, 0.157863f, 0.126291f, 0.227708f,
+    0.224289f, 0.228366f, 0.220244f, 0.2173f, 0.213571f,
+    0.208236f, 0.205563f, 0.198139f, 0.197583f, 0.182817f,
+    0.137113f, 0.10969f, 0.213277f, 0.20386f, 0.207959f,
+    0.207126f, 0.202618f, 0.194213f, 0.191698f, 0.183697f,
+    0.176261f, 0.175166f, 0.161708f, 0.121281f, 0.0970247f,
+    0.211384f, 0.202613f, 0.206722f, 0.205848f, 0.201386f,
+    0.192996f, 0.190463f, 0.182475f, 0.175069f, 0.172959f,
+    0.156276f, 0.118751f, 0.0952443f, 0.211116f, 0.202441f,
+    0.206554f, 0.205671f, 0.201221f, 0.192832f, 0.190295f,
+    0.182305f, 0.174903f, 0.172773f, 0.156068f, 0.118386f,
+    0.0950636f, 0.978863f, 0.938642f, 0.957709f, 0.953617f,
+    0.932983f, 0.894085f, 0.882324f, 0.845275f, 0.810959f,
+    0.801082f, 0.723623f, 0.548898f, 0.44077f, 0.935493f,
+    0.891018f, 0.908843f, 0.905339f, 0.885804f, 0.849202f,
+    0.838367f, 0.803486f, 0.771124f, 0.762742f, 0.689976f,
+    0.525881f, 0.42108f, 0.899931f, 0.856044f, 0.873092f,
+    0.869811f, 0.851017f, 0.81592f, 0.805571f, 0.772126f,
+    0.741068f, 0.73324f, 0.663587f, 0.506704f, 0.405363f,
+    0.861055f, 0.822058f, 0.838553f, 0.835228f, 0.817122f,
+    0.783265f, 0.773164f, 0.740918f, 0.71098f, 0.702999f,
+    0.635828f, 0.484755f, 0.388024f, 0.846624f, 0.811183f,
+    0.827619f, 0.824138f, 0.80628f, 0.772706f, 0.762582f,
+    0.73061f, 0.70097f, 0.692574f, 0.625813f, 0.475499f,
+    0.381412f, 0.844731f, 0.809936f, 0.826382f, 0.82286f,
+    0.805048f, 0.77149f, 0.761348f, 0.729388f, 0.699778f,
+    0.691278f, 0.624477f, 0.4739f, 0.380433f, 0.844463f,
+    0.809764f, 0.826214f, 0.822683f, 0.804883f, 0.771325f,
+    0.761179f, 0.729218f, 0.699613f, 0.691092f, 0.624269f,
+    0.473535f, 0.380252f, 0.142878f, 0.132602f, 0.129925f,
+    0.128016f, 0.126024f, 0.121947f, 0.117345f, 0.110943f,
+    0.105617f, 0.096691f, 0.0833325f, 0.0625111f, 0.0500089f,
+    0.0929924f, 0.0976224f, 0.0924856f, 0.0929285f, 0.0908457f,
+    0.0896261f, 0.0873335f, 0.0839261f, 0.0803207f, 0.074988f,
+    0.066063f, 0.0495473f, 0.0396378f, 0.0679076f, 0.0712629f,
+    0.067587f, 0.068128f, 0.0670292f, 0.0669746f, 0.0657849f,
+    0.0637581f, 0.0617148f, 0.0582514f, 0.0527901f, 0.0395926f,
+    0.031674f, 0.0396869f, 0.0337366f, 0.0304623f, 0.0303215f,
+    0.0304279f, 0.0314347f, 0.03167f, 0.0315217f, 0.0315416f,
+    0.0312068f, 0.0307569f, 0.0230677f, 0.0184542f, 0.0176407f,
+    0.0150718f, 0.0132382f, 0.0127742f, 0.0119756f, 0.0110851f,
+    0.0102556f, 0.0114753f, 0.0125058f, 0.0180061f, 0.0150051f,
+    0.0112538f, 0.00900306f, 0.00725477f, 0.00672797f, 0.0053826f,
+    0.00672229f, 0.00837577f, 0.00832339f, 0.00928811f, 0.0100783f,
+    0.0106076f, 0.0127677f, 0.0106398f, 0.00797983f, 0.00638386f,
+    0.000852117f, 0.000857919f, 0.00273236f, 0.00456601f, 0.00521001f,
+    0.00521376f, 0.00540368f, 0.00549621f, 0.00534295f, 0.00492884f,
+    0.00410737f, 0.00308053f, 0.00246442f, 0.187764f, 0.174261f,
+    0.170742f, 0.168233f, 0.165615f, 0.160258f, 0.15421f,
+    0.145797f, 0.138797f, 0.127067f, 0.109512f, 0.0821496f,
+    0.0657196f, 0.133943f, 0.135625f, 0.128485f, 0.129071f,
+    0.126057f, 0.124046f, 0.120732f, 0.115868f, 0.110666f,
+    0.103253f, 0.0904624f, 0.0678468f, 0.0542774f, 0.104103f,
+    0.109265f, 0.103586f, 0.10427f, 0.10224f, 0.101395f,
+    0.0991836f, 0.0957f, 0.0920604f, 0.0865165f, 0.0771895f,
+    0.0578921f, 0.0463137f, 0.0660059f, 0.0691996f, 0.0657124f,
+    0.0664639f, 0.0656388f, 0.0658549f, 0.0650687f, 0.0634637f,
+    0.0618872f, 0.0594719f, 0.0551563f, 0.0413672f, 0.0330938f,
+    0.0464195f, 0.0456406f, 0.0433285f, 0.0438276f, 0.0432205f,
+    0.0431941f, 0.0427101f, 0.0417372f, 0.0408277f, 0.0399649f,
+    0.0384068f, 0.0288051f, 0.0230441f, 0.0450879f, 0.0418258f,
+    0.0409824f, 0.0403951f, 0.039763f, 0.0384928f, 0.0370457f,
+    0.0350776f, 0.0339598f, 0.0329826f, 0.0317343f, 0.0238008f,
+    0.0190406f, 0.0448872f, 0.0416587f, 0.0408175f, 0.0402178f,
+    0.0395919f, 0.0383113f, 0.0368654f, 0.0348543f, 0.0331808f,
+    0.0303768f, 0.0261802f, 0.01964f, 0.015712f, 0.232651f,
+    0.215919f, 0.211559f, 0.208451f, 0.205207f, 0.198569f,
+    0.191075f, 0.180651f, 0.171977f, 0.157444f, 0.135692f,
+    0.101788f, 0.0814303f, 0.178829f, 0.173627f, 0.164484f,
+    0.165213f, 0.161268f, 0.158467f, 0.154131f, 0.14781f,
+    0.141012f, 0.131518f, 0.114862f, 0.0861463f, 0.068917f,
+    0.140298f, 0.147268f, 0.139586f, 0.140413f, 0.137451f,
+    0.135815f, 0.132582f, 0.127642f, 0.122406f, 0.114781f,
+    0.101589f, 0.0761916f, 0.0609533f, 0.102896f, 0.107202f,
+    0.101712f, 0.102606f, 0.10085f, 0.100275f, 0.0984673f,
+    0.0954056f, 0.0922329f, 0.0877369f, 0.0795556f, 0.0596668f,
+    0.0477334f, 0.0913059f, 0.0847211f, 0.0830223f, 0.0818733f,
+    0.0805996f, 0.078088f, 0.0761087f, 0.0736792f, 0.0711733f,
+    0.06823f, 0.0628062f, 0.0471047f, 0.0376838f, 0.0899743f,
+    0.0834841f, 0.0817995f, 0.0806124f, 0.0793544f, 0.0768037f,
+    0.0739107f, 0.0698904f, 0.0665482f, 0.0612477f, 0.0561337f,
+    0.0421003f, 0.0336803f, 0.0897736f, 0.083317f, 0.0816346f,
+    0.0804351f, 0.0791834f, 0.0766222f, 0.0737304f, 0.0697081f,
+    0.0663613f, 0.0607531f, 0.0523599f, 0.0392784f, 0.0314227f,
+    0.277537f, 0.257577f, 0.252376f, 0.248668f, 0.244798f,
+    0.23688f, 0.22794f, 0.215505f, 0.205158f, 0.18782f,
+    0.161872f, 0.121426f, 0.097141f, 0.223715f, 0.21163f,
+    0.20409f, 0.201512f, 0.198645f, 0.192896f, 0.18753f,
+    0.179752f, 0.171357f, 0.159783f, 0.139261f, 0.104446f,
+    0.0835567f, 0.184839f, 0.18527f, 0.175585f, 0.176555f,
+    0.172662f, 0.170235f, 0.165981f, 0.159584f, 0.152752f,
+    0.143047f, 0.125988f, 0.0944911f, 0.0755929f, 0.147783f,
+    0.145205f, 0.137711f, 0.138749f, 0.136061f, 0.134695f,
+    0.131866f, 0.127348f, 0.122578f, 0.116002f, 0.103955f,
+    0.0779663f, 0.062373f, 0.136192f, 0.126379f, 0.123839f,
+    0.122091f, 0.120191f, 0.116399f, 0.112055f, 0.106011f,
+    0.101519f, 0.096495f, 0.0872055f, 0.0654042f, 0.0523233f,
+    0.134861f, 0.125142f, 0.122617f, 0.12083f, 0.118946f,
+    0.115115f, 0.110776f, 0.104744f, 0.0997287f, 0.0913385f,
+    0.0805331f, 0.0603998f, 0.0483199f, 0.13466f, 0.124975f,
+    0.122452f, 0.120653f, 0.118775f, 0.114933f, 0.110595f,
+    0.104562f, 0.0995418f, 0.0911295f, 0.0785396f, 0.0589169f,
+    0.0471335f, 0.36731f, 0.340894f, 0.33401f, 0.329103f,
+    0.323981f, 0.313502f, 0.30167f, 0.285213f, 0.271519f,
+    0.248573f, 0.214231f, 0.160703f, 0.128563f, 0.313488f,
+    0.291504f, 0.285724f, 0.281947f, 0.277828f, 0.269518f,
+    0.259851f, 0.246164f, 0.234902f, 0.216313f, 0.18806f,
+    0.141045f, 0.112836f, 0.274612f, 0.261276f, 0.250406f,
+    0.24884f, 0.24365f, 0.239076f, 0.232778f, 0.223468f,
+    0.213443f, 0.199577f, 0.174787f, 0.13109f, 0.104872f,
+    0.237555f, 0.22121f, 0.216284f, 0.213398f, 0.210173f,
+    0.203824f, 0.198663f, 0.191231f, 0.18327f, 0.172532f,
+    0.152754f, 0.114565f, 0.0916523f, 0.225965f, 0.209696f,
+    0.205474f, 0.202525f, 0.199374f, 0.193021f, 0.185785f,
+    0.175718f, 0.167364f, 0.153431f, 0.136004f, 0.102003f,
+    0.0816026f, 0.224634f, 0.208459f, 0.204251f, 0.201265f,
+    0.198129f, 0.191736f, 0.184505f, 0.174452f, 0.166089f,
+    0.152091f, 0.13111f, 0.0984407f, 0.0787525f, 0.224433f,
+    0.208292f, 0.204086f, 0.201087f, 0.197958f, 0.191555f,
+    0.184325f, 0.17427f, 0.165902f, 0.151882f, 0.130899f,
+    0.0981936f, 0.0785549f, 1.04061f, 0.965768f, 0.946266f,
+    0.932362f, 0.917853f, 0.888165f, 0.854644f, 0.80802f,
+    0.769225f, 0.704217f, 0.606926f, 0.45528f, 0.364224f,
+    0.986784f, 0.916379f, 0.897981f, 0.885207f, 0.8717f,
+    0.844181f, 0.812827f, 0.768972f, 0.732608f, 0.671876f,
+    0.579536f, 0.435518f, 0.348414f, 0.947908f, 0.880319f,
+    0.862663f, 0.850487f, 0.837522f, 0.811229f, 0.781185f,
+    0.739145f, 0.704324f, 0.64626f, 0.557617f, 0.419379f,
+    0.335503f, 0.910851f, 0.845551f, 0.82854f, 0.816659f,
+    0.804046f, 0.778488f, 0.749397f, 0.708841f, 0.675191f,
+    0.619028f, 0.533962f, 0.401408f, 0.321126f, 0.899261f,
+    0.83457f, 0.81773f, 0.805786f, 0.793247f, 0.767684f,
+    0.73876f, 0.698526f, 0.66507f, 0.609076f, 0.525065f,
+    0.394183f, 0.315346f, 0.897929f, 0.833334f, 0.816507f,
+    0.804525f, 0.792002f, 0.7664f, 0.73748f, 0.69726f,
+    0.663796f, 0.607736f, 0.523805f, 0.393017f, 0.314414f,
+    0.897729f, 0.833166f, 0.816342f, 0.804347f, 0.79183f,
+    0.766219f, 0.7373f, 0.697078f, 0.663609f, 0.607527f,
+    0.523595f, 0.39277f, 0.314216f, 0.123804f, 0.136685f,
+    0.131409f, 0.127518f, 0.123428f, 0.116804f, 0.111223f,
+    0.103617f, 0.0962375f, 0.0813527f, 0.0682343f, 0.0512348f,
+    0.0409878f, 0.0864879f, 0.0860676f, 0.0876124f, 0.0843877f,
+    0.0827206f, 0.0795991f, 0.0770077f, 0.0733334f, 0.0692462f,
+    0.0614133f, 0.052183f, 0.0391372f, 0.0313098f, 0.0615936f,
+    0.0598664f, 0.0628109f, 0.060983f, 0.0600505f, 0.0585136f,
+    0.0573661f, 0.0553181f, 0.0528126f, 0.0477972f, 0.0410277f,
+    0.0307708f, 0.0246166f, 0.02678f, 0.0291576f, 0.0287174f,
+    0.0282125f, 0.027275f, 0.0273879f, 0.0277746f, 0.027632f,
+    0.0271507f, 0.0259871f, 0.0229963f, 0.0172473f, 0.0137978f,
+    0.0130653f, 0.0157508f, 0.0149871f, 0.014202f, 0.0128026f,
+    0.0115269f, 0.0103556f, 0.0104858f, 0.0108099f, 0.0127712f,
+    0.0106427f, 0.00798203f, 0.00638562f, 0.00765705f, 0.00816046f,
+    0.00772375f, 0.00696126f, 0.00613455f, 0.00679528f, 0.00701147f,
+    0.00719018f, 0.00727124f, 0.00767504f, 0.00639587f, 0.0047969f,
+    0.00383752f, 0.00390708f, 0.00363189f, 0.00216741f, 0.00210521f,
+    0.00193064f, 0.00279115f, 0.00267729f, 0.00276378f, 0.00268282f,
+    0.00239883f, 0.00199902f, 0.00149927f, 0.00119941f, 0.162698f,
+    0.179626f, 0.172693f, 0.167579f, 0.162204f, 0.153499f,
+    0.146164f, 0.136169f, 0.126471f, 0.10691f, 0.0896708f,
+    0.0673307f, 0.0538645f, 0.121451f, 0.129008f, 0.124307f,
+    0.120979f, 0.11783f, 0.112054f, 0.107519f, 0.101667f,
+    0.0957775f, 0.0845869f, 0.0717316f, 0.0537987f, 0.0430389f,
+    0.0965569f, 0.0942128f, 0.0980397f, 0.0946842f, 0.0929833f,
+    0.0898906f, 0.0874157f, 0.083652f, 0.0793438f, 0.0709707f,
+    0.0605763f, 0.0454323f, 0.0363458f, 0.0617433f, 0.0601014f,
+    0.0629689f, 0.0610957f, 0.0602078f, 0.0587649f, 0.0578242f,
+    0.0559658f, 0.053682f, 0.0491607f, 0.0425449f, 0.0319087f,
+    0.0255269f, 0.0421242f, 0.0444244f, 0.0428239f, 0.0415048f,
+    0.0406758f, 0.0395217f, 0.0388062f, 0.0375332f, 0.0360641f,
+    0.0334321f, 0.0292945f, 0.0219708f, 0.0175767f, 0.038998f,
+    0.0431157f, 0.0414634f, 0.0402335f, 0.0389632f, 0.036876f,
+    0.0351376f, 0.0327531f, 0.0304437f, 0.0276731f, 0.0242456f,
+    0.0181842f, 0.0145473f, 0.0388942f, 0.0429412f, 0.0412838f,
+    0.0400613f, 0.0387764f, 0.0366955f, 0.0349421f, 0.0325527f,
+    0.0302344f, 0.0255583f, 0.021437f, 0.0160972f, 0.0128777f,
+    0.201592f, 0.222567f, 0.213976f, 0.20764f, 0.20098f,
+    0.190195f, 0.181106f, 0.168722f, 0.156705f, 0.132468f,
+    0.111107f, 0.0834265f, 0.0667412f, 0.156414f, 0.171949f,
+    0.165591f, 0.16104f, 0.156606f, 0.148749f, 0.142461f,
+    0.133376f, 0.124491f, 0.107761f, 0.0912801f, 0.0684601f,
+    0.0547681f, 0.13152f, 0.13484f, 0.133268f, 0.128385f,
+    0.125916f, 0.121268f, 0.117465f, 0.111986f, 0.105875f,
+    0.0941444f, 0.080125f, 0.0600937f, 0.0480749f, 0.0967065f,
+    0.0988484f, 0.0981977f, 0.094797f, 0.0931406f, 0.0901418f,
+    0.0878738f, 0.0842997f, 0.0802133f, 0.0723342f, 0.0620935f,
+    0.0465701f, 0.0372561f, 0.0788684f, 0.0873653f, 0.084043f,
+    0.0815658f, 0.0790562f, 0.0748572f, 0.0714101f, 0.0666325f,
+    0.0625953f, 0.0566057f, 0.0488431f, 0.0366323f, 0.0293058f,
+    0.0778921f, 0.0860566f, 0.0827469f, 0.0802945f, 0.0777391f,
+    0.0735712f, 0.0700793f, 0.0653053f, 0.0606775f, 0.051327f,
+    0.0437942f, 0.0328456f, 0.0262765f, 0.0777882f, 0.0858821f,
+    0.0825672f, 0.0801223f, 0.0775523f, 0.0733907f, 0.0698838f,
+    0.065105f, 0.0604683f, 0.051116f, 0.0428734f, 0.032193f,
+    0.0257544f, 0.240486f, 0.265508f, 0.255259f, 0.247701f,
+    0.239755f, 0.22689f, 0.216048f, 0.201274f, 0.186939f,
+    0.158026f, 0.132544f, 0.0995224f, 0.0796179f, 0.193609f,
+    0.21489f, 0.206874f, 0.201101f, 0.195382f, 0.185445f,
+    0.177403f, 0.165928f, 0.154725f, 0.131448f, 0.110829f,
+    0.0833529f, 0.0666823f, 0.166483f, 0.177781f, 0.171242f,
+    0.166542f, 0.162057f, 0.153969f, 0.147597f, 0.14032f,
+    0.132406f, 0.117318f, 0.0996735f, 0.0747551f, 0.0598041f,
+    0.13167f, 0.141789f, 0.136505f, 0.132615f, 0.128844f,
+    0.122224f, 0.117923f, 0.112634f, 0.106744f, 0.0955079f,
+    0.0816421f, 0.0612316f, 0.0489853f, 0.117762f, 0.130306f,
+    0.125326f, 0.121627f, 0.117832f, 0.111552f, 0.106352f,
+    0.0991847f, 0.0922427f, 0.0797793f, 0.0683916f, 0.0512938f,
+    0.041035f, 0.116786f, 0.128997f, 0.12403f, 0.120356f,
+    0.116515f, 0.110266f, 0.105021f, 0.0978576f, 0.0909115f,
+    0.0768846f, 0.0644937f, 0.0484915f, 0.0387932f, 0.116682f,
+    0.128823f, 0.123851f, 0.120183f, 0.116328f, 0.110086f,
+    0.104825f, 0.0976573f, 0.0907022f, 0.0766736f, 0.0643099f,
+    0.0482889f, 0.0386311f, 0.318274f, 0.35139f, 0.337826f,
+    0.327823f, 0.317307f, 0.30028f, 0.285931f, 0.266378f,
+    0.247407f, 0.209141f, 0.175417f, 0.131714f, 0.105371f,
+    0.271397f, 0.300772f, 0.289441f, 0.281223f, 0.272934f,
+    0.258835f, 0.247286f, 0.231033f, 0.215193f, 0.182563f,
+    0.153213f, 0.115545f, 0.0924358f, 0.237443f, 0.263662f,
+    0.253809f, 0.246664f, 0.239609f, 0.22736f, 0.21748f,
+    0.203406f, 0.189691f, 0.163665f, 0.138771f, 0.104078f,
+    0.0832624f, 0.205258f, 0.227671f, 0.219072f, 0.212737f,
+    0.206396f, 0.195614f, 0.186843f, 0.17454f, 0.162599f,
+    0.141855f, 0.120739f, 0.0905545f, 0.0724436f, 0.195551f,
+    0.216188f, 0.207893f, 0.201749f, 0.195384f, 0.184943f,
+    0.176235f, 0.164289f, 0.15271f, 0.129252f, 0.108438f,
+    0.0816413f, 0.065313f, 0.194574f, 0.214879f, 0.206597f,
+    0.200478f, 0.194067f, 0.183657f, 0.174904f, 0.162962f,
+    0.151379f, 0.128f, 0.107367f, 0.0806833f, 0.0645466f,
+    0.19447f, 0.214705f, 0.206417f, 0.200305f, 0.19388f,
+    0.183476f, 0.174709f, 0.162762f, 0.15117f, 0.127789f,
+    0.107183f, 0.0804807f, 0.0643846f, 0.901685f, 0.995503f,
+    0.957077f, 0.928738f, 0.898947f, 0.850707f, 0.810055f,
+    0.754662f, 0.700915f, 0.592506f, 0.496963f, 0.373152f,
+    0.298522f, 0.854808f, 0.944885f, 0.908692f, 0.882138f,
+    0.854573f, 0.809262f, 0.771411f, 0.719317f, 0.668701f,
+    0.565929f, 0.47476f, 0.356983f, 0.285587f, 0.820854f,
+    0.907775f, 0.87306f, 0.847579f, 0.821248f, 0.777786f,
+    0.741605f, 0.69169f, 0.643199f, 0.544568f, 0.456875f,
+    0.34376f, 0.275008f, 0.788669f, 0.871784f, 0.838323f,
+    0.813652f, 0.788035f, 0.746042f, 0.710968f, 0.662823f,
+    0.616107f, 0.521398f, 0.43741f, 0.329015f, 0.263212f,
+    0.778962f, 0.860301f, 0.827144f, 0.802665f, 0.777023f,
+    0.73537f, 0.70036f, 0.652573f, 0.606219f, 0.512618f,
+    0.429986f, 0.32308f, 0.258464f, 0.777986f, 0.858993f,
+    0.825848f, 0.801393f, 0.775706f, 0.734084f, 0.699029f,
+    0.651246f, 0.604888f, 0.511365f, 0.428914f, 0.322122f,
+    0.257697f, 0.777882f, 0.858818f, 0.825669f, 0.801221f,
+    0.775519f, 0.733904f, 0.698834f, 0.651045f, 0.604678f,
+    0.511155f, 0.42873f, 0.321919f, 0.257535f, 0.130622f,
+    0.129145f, 0.12943f, 0.124529f, 0.119219f, 0.113859f,
+    0.105605f, 0.098432f, 0.0903948f, 0.0751134f, 0.0628241f,
+    0.0471938f, 0.0377551f, 0.0834462f, 0.0815325f, 0.0823975f,
+    0.0798213f, 0.0770187f, 0.0742651f, 0.0695295f, 0.0659884f,
+    0.0621231f, 0.0554307f, 0.04686f, 0.0351451f, 0.028116f,
+    0.0584351f, 0.0559764f, 0.0533589f, 0.0543573f, 0.0533719f,
+    0.052358f, 0.0508794f, 0.0490808f, 0.0467642f, 0.0427917f,
+    0.0364139f, 0.0273104f, 0.0218592f, 0.0421863f, 0.0331044f,
+    0.0344237f, 0.0319131f, 0.0291999f, 0.0254985f, 0.0252134f,
+    0.0241335f, 0.0236316f, 0.0229062f, 0.0198543f, 0.0156981f,
+    0.012977f, 0.0240724f, 0.0177526f, 0.0191937f, 0.017935f,
+    0.0161454f, 0.0135635f, 0.0123955f, 0.0107487f, 0.00940511f,
+    0.00888277f, 0.0080036f, 0.00738107f, 0.00649325f, 0.0136732f,
+    0.00934663f, 0.0106557f, 0.0102819f, 0.00920182f, 0.00891455f,
+    0.00871913f, 0.00761193f, 0.00666044f, 0.00532835f, 0.00444029f,
+    0.00401323f, 0.0039661f, 0.00298102f, 0.00229428f, 0.00219486f,
+    0.00263603f, 0.00248385f, 0.00333953f, 0.00391245f, 0.00350394f,
+    0.00306594f, 0.00245276f, 0.00204396f, 0.00153297f, 0.00126494f,
+    0.171658f, 0.169718f, 0.170091f, 0.163651f, 0.156673f,
+    0.149629f, 0.138781f, 0.129355f, 0.118793f, 0.098711f,
+    0.0825609f, 0.0620202f, 0.0496162f, 0.124321f, 0.122105f,
+    0.123059f, 0.118943f, 0.114472f, 0.110035f, 0.102706f,
+    0.0963836f, 0.0889395f, 0.0765136f, 0.0645956f, 0.0484468f,
+    0.0387574f, 0.0930429f, 0.0893661f, 0.088044f, 0.0856672f,
+    0.0835443f, 0.0812846f, 0.0783333f, 0.0750139f, 0.0709186f,
+    0.0638746f, 0.0541495f, 0.0406121f, 0.0324897f, 0.0596866f,
+    0.0575635f, 0.0549198f, 0.0557868f, 0.0546688f, 0.053494f,
+    0.051984f, 0.0500666f, 0.0477861f, 0.0439891f, 0.0375899f,
+    0.0281925f, 0.0230655f, 0.0425113f, 0.0419648f, 0.0421881f,
+    0.0406407f, 0.0389829f, 0.0373393f, 0.0355186f, 0.0340555f,
+    0.0324896f, 0.0299656f, 0.0257392f, 0.0198487f, 0.0162943f,
+    0.0412038f, 0.0407334f, 0.0408521f, 0.0393101f, 0.0376448f,
+    0.0359712f, 0.0333846f, 0.0311457f, 0.0286209f, 0.0249461f,
+    0.0213817f, 0.0164808f, 0.0135075f, 0.0410363f, 0.0405725f,
+    0.040662f, 0.0391224f, 0.0374541f, 0.0357703f, 0.0331772f,
+    0.0309239f, 0.0283989f, 0.0235982f, 0.0197373f, 0.0148271f,
+    0.0118617f, 0.212694f, 0.21029f, 0.210753f, 0.202773f,
+    0.194126f, 0.185399f, 0.171958f, 0.160279f, 0.147191f,
+    0.122309f, 0.102298f, 0.0768467f, 0.0614773f, 0.165358f,
+    0.162677f, 0.163721f, 0.158065f, 0.151926f, 0.145805f,
+    0.135883f, 0.127307f, 0.117338f, 0.0978658f, 0.0823313f,
+    0.0620304f, 0.0497497f, 0.12997f, 0.127593f, 0.128706f,
+    0.124448f, 0.119845f, 0.115307f, 0.10774f, 0.101244f,
+    0.0950731f, 0.0849574f, 0.0718851f, 0.0539138f, 0.0431311f,
+    0.0949578f, 0.0934392f, 0.0941534f, 0.0908996f, 0.0874083f,
+    0.0839733f, 0.079438f, 0.0759997f, 0.0719406f, 0.065072f,
+    0.0553256f, 0.0414942f, 0.0331954f, 0.0835474f, 0.082537f,
+    0.0828496f, 0.0797627f, 0.0764366f, 0.0731091f, 0.0679219f,
+    0.0634465f, 0.0583564f, 0.0510485f, 0.0434749f, 0.0326061f,
+    0.0263828f, 0.0822399f, 0.0813056f, 0.0815136f, 0.0784321f,
+    0.0750986f, 0.071741f, 0.0665613f, 0.062069f, 0.0570193f,
+    0.0473968f, 0.039646f, 0.029813f, 0.0238504f, 0.0820724f,
+    0.0811447f, 0.0813235f, 0.0782443f, 0.0749078f, 0.0715401f,
+    0.0663539f, 0.0618472f, 0.0567972f, 0.0471958f, 0.0394741f,
+    0.0296535f, 0.0237228f, 0.25373f, 0.250862f, 0.251414f,
+    0.241895f, 0.23158f, 0.221168f, 0.205135f, 0.191202f,
+    0.17559f, 0.145906f, 0.122034f, 0.0916731f, 0.0733385f,
+    0.206394f, 0.203249f, 0.204382f, 0.197187f, 0.18938f,
+    0.181575f, 0.16906f, 0.15823f, 0.145736f, 0.121463f,
+    0.101638f, 0.076622f, 0.0614899f, 0.171006f, 0.168165f,
+    0.169367f, 0.16357f, 0.157298f, 0.151077f, 0.140917f,
+    0.132167f, 0.121913f, 0.10604f, 0.0896208f, 0.0672156f,
+    0.0537724f, 0.135994f, 0.134011f, 0.134815f, 0.130021f,
+    0.124862f, 0.119743f, 0.111542f, 0.104495f, 0.0963109f,
+    0.0861548f, 0.0730613f, 0.0547959f, 0.0438368f, 0.124583f,
+    0.123109f, 0.123511f, 0.118885f, 0.11389f, 0.108879f,
+    0.101099f, 0.0943699f, 0.0867547f, 0.0721712f, 0.0612105f,
+    0.0459079f, 0.0367263f, 0.123276f, 0.121878f, 0.122175f,
+    0.117554f, 0.112552f, 0.107511f, 0.099738f, 0.0929923f,
+    0.0854176f, 0.0709943f, 0.0593828f, 0.0446395f, 0.0357116f,
+    0.123108f, 0.121717f, 0.121985f, 0.117366f, 0.112362f,
+    0.10731f, 0.0995306f, 0.0927706f, 0.0851956f, 0.0707933f,
+    0.0592108f, 0.0444799f, 0.0355839f, 0.335802f, 0.332006f,
+    0.332737f, 0.320139f, 0.306488f, 0.292708f, 0.271488f,
+    0.253049f, 0.232386f, 0.193102f, 0.161508f, 0.121326f,
+    0.0970607f, 0.288466f, 0.284394f, 0.285705f, 0.275431f,
+    0.264287f, 0.253114f, 0.235413f, 0.220077f, 0.202533f,
+    0.168659f, 0.141112f, 0.106271f, 0.0850167f, 0.253078f,
+    0.24931f, 0.25069f, 0.241814f, 0.232206f, 0.222616f,
+    0.20727f, 0.194014f, 0.17871f, 0.148967f, 0.125092f,
+    0.0942641f, 0.0756189f, 0.218066f, 0.215156f, 0.216138f,
+    0.208266f, 0.19977f, 0.191283f, 0.177895f, 0.166342f,
+    0.153108f, 0.128321f, 0.108533f, 0.0813994f, 0.0651195f,
+    0.206656f, 0.204254f, 0.204834f, 0.197129f, 0.188798f,
+    0.180419f, 0.167452f, 0.156216f, 0.143551f, 0.119367f,
+    0.0998526f, 0.0751175f, 0.060094f, 0.205348f, 0.203022f,
+    0.203498f, 0.195798f, 0.18746f, 0.179051f, 0.166091f,
+    0.154839f, 0.142214f, 0.11819f, 0.0988564f, 0.0742922f,
+    0.0594338f, 0.205181f, 0.202861f, 0.203308f, 0.19561f,
+    0.187269f, 0.17885f, 0.165884f, 0.154617f, 0.141992f,
+    0.117988f, 0.0986844f, 0.0741327f, 0.0593062f, 0.951344f,
+    0.94059f, 0.94266f, 0.906969f, 0.868293f, 0.829256f,
+    0.769139f, 0.716898f, 0.658362f, 0.547065f, 0.45756f,
+    0.343722f, 0.274977f, 0.904007f, 0.892977f, 0.895628f,
+    0.862261f, 0.826094f, 0.789661f, 0.733064f, 0.683926f,
+    0.628508f, 0.522622f, 0.437163f, 0.328667f, 0.262934f,
+    0.86862f, 0.857893f, 0.860613f, 0.828643f, 0.794012f,
+    0.759164f, 0.704921f, 0.657863f, 0.604685f, 0.502931f,
+    0.42071f, 0.316413f, 0.25313f, 0.833608f, 0.823739f,
+    0.826061f, 0.795095f, 0.761576f, 0.72783f, 0.675546f,
+    0.630191f, 0.579083f, 0.4815f, 0.40277f, 0.30286f,
+    0.242288f, 0.822197f, 0.812837f, 0.814757f, 0.783958f,
+    0.750603f, 0.716966f, 0.665103f, 0.620066f, 0.569526f,
+    0.473331f, 0.395905f, 0.297513f, 0.238011f, 0.82089f,
+    0.811605f, 0.813421f, 0.782628f, 0.749265f, 0.715598f,
+    0.663742f, 0.618689f, 0.568189f, 0.472153f, 0.394908f,
+    0.296688f, 0.237351f, 0.820722f, 0.811445f, 0.813231f,
+    0.78244f, 0.749075f, 0.715397f, 0.663535f, 0.618467f,
+    0.567967f, 0.471952f, 0.394736f, 0.296529f, 0.237223f,
+};
+
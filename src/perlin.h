@@ -83,7 +83,7 @@ static double noise(double x, double y, double z) {
 }
 
 WC_PREFIX
-static double octavePerlin(double x, double y, double z, int octaves, double persistance) {
+static inline double octavePerlin(double x, double y, double z, int octaves, double persistance) {
     double total = 0;
     double frequency = 1;
     double amplitude = 1;
@@ -99,3 +99,75 @@ static double octavePerlin(double x, double y, double z, int octaves, double per
     }
     return total/maxvalue;
 }
+
+// -- Single precision 2D noise -- //
+// noise(x, y, 0) and octavePerlin(x, y, 0, ...) in single precision, for
+// when z is not needed. The permutation table is the same. With z = 0 the
+// last lerp in noise picks its first argument, so only the four corners at
+// z = 0 are needed. grad is replaced by a table of the x and y
+// coefficients of each of its 16 gradients, so the only branches are the
+// table lookups.
+
+WC_PREFIX
+static const float grad2_x[16] = {1.f,-1.f, 1.f,-1.f, 1.f,-1.f, 1.f,-1.f,
+                                  0.f, 0.f, 0.f, 0.f, 1.f, 0.f,-1.f, 0.f};
+WC_PREFIX
+static const float grad2_y[16] = {1.f, 1.f,-1.f,-1.f, 0.f, 0.f, 0.f, 0.f,
+                                  1.f,-1.f, 1.f,-1.f, 1.f,-1.f, 1.f,-1.f};
+
+WC_PREFIX
+static float fade2f(float t) {
+  return t * t * t * (t * (t * 6.f - 15.f) + 10.f); 
+}
+
+WC_PREFIX
+static float lerp2f(float t, float a, float b) {
+  return a + t * (b - a);
+}
+
+WC_PREFIX
+static float grad2f(int hash, float x, float y) {
+    int h = hash & 15;
+    return grad2_x[h]*x + grad2_y[h]*y;
+}
+
+WC_PREFIX
+static float noise2f(float x, float y) {
+    float floor_x = floorf(x);
+    float floor_y = floorf(y);
+    int X = (int)floor_x & 255;
+    int Y = (int)floor_y & 255;
+
+    //relative coords in unit square
+    x -= floor_x;
+    y -= floor_y;
+
+    float u = fade2f(x),
+          v = fade2f(y);
+
+    int A = p[X  ]+Y, AA = p[A], AB = p[A+1],
+        B = p[X+1]+Y, BA = p[B], BB = p[B+1];
+
+    return lerp2f(v, lerp2f(u, grad2f(p[AA], x    , y    ),
+                               grad2f(p[BA], x-1.f, y    )),
+                     lerp2f(u, grad2f(p[AB], x    , y-1.f),
+                               grad2f(p[BB], x-1.f, y-1.f)));
+}
+
+WC_PREFIX
+static float octavePerlin2f(float x, float y, int octaves, float persistance) {
+    float total = 0.f;
+    float frequency = 1.f;
+    float amplitude = 1.f;
+    float maxvalue = 0.f;
+
+    int i;
+    for(i = 0; i < octaves; i++) {
+        total += noise2f(x*frequency, y*frequency) * amplitude;
+
+        maxvalue += amplitude;
+        amplitude *= persistance;
+        frequency *= 2.f;
+    }
+    return total/maxvalue;
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <ctype.h>
 
 //atof equivalent function wich is not dependent
 //on local. Heavily inspired by inplementation in K & R.
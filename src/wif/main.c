@@ -33,15 +33,15 @@ int main(UNUSED int argc, UNUSED char **argv)
     }
     {
         uint32_t x,y,w,h;
-        PaletteEntry *pattern = wif_get_pattern(data,&w,&h);
+        float rw,rh;
+        PackedPattern *pattern = wif_get_pattern(data,&w,&h,&rw,&rh);
 
         printf("\nPattern:\n");
         for(y = 0; y < h; y++){
             for(x = 0; x < w; x++){
-                PaletteEntry entry = pattern[x+y*w];
-                float col = entry.color[0];
+                float col = wif_pattern_color(pattern,x,y)[0];
                 printf("%c", col > 0.5f ? 'X' : ' ');
-                //printf("%c", entry.warp_above ? ' ' : 'X');
+                //printf("%c", wif_pattern_warp_above(pattern,x,y) ? ' ' : 'X');
             }
             printf("\n");
         }
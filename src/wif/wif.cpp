@@ -1,20 +1,106 @@
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include "wif.h"
-#include "ini.h" //TODO(Vidar): Write this ourselves
 
-static int string_to_float(const char *str, float *val)
+// -- Parser -- //
+// The file is read in chunks and parsed in one pass, so only the current
+// chunk and the line it ends in are held in memory. The syntax is
+// the subset of INI that inih used to accept for us: [SECTION] headers,
+// name=value (or name:value) pairs, comment lines starting with ';' or '#',
+// inline comments starting with a ';' after whitespace, and continuation
+// lines, which start with whitespace and repeat the previous name. Lines
+// can be of any length. The section name is looked up once per header, and
+// numbers are parsed directly from the buffer, without the C locale.
+
+typedef enum
+{
+    WIF_SECTION_OTHER,
+    WIF_SECTION_WARP,
+    WIF_SECTION_WEFT,
+    WIF_SECTION_WEAVING,
+    WIF_SECTION_TIEUP,
+    WIF_SECTION_THREADING,
+    WIF_SECTION_TREADLING,
+    WIF_SECTION_COLOR_PALETTE,
+    WIF_SECTION_COLOR_TABLE,
+    WIF_SECTION_WARP_COLORS,
+    WIF_SECTION_WEFT_COLORS,
+    WIF_NUM_SECTIONS
+}WifSection;
+
+static const char *wif_section_names[WIF_NUM_SECTIONS] = {
+    "", "WARP", "WEFT", "WEAVING", "TIEUP", "THREADING", "TREADLING",
+    "COLOR PALETTE", "COLOR TABLE", "WARP COLORS", "WEFT COLORS"
+};
+
+// A range of characters in the file buffer
+typedef struct
+{
+    const char *begin, *end;
+}WifToken;
+
+static int wif_is_space(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static int wif_token_equals(WifToken token, const char *str)
+{
+    size_t len = strlen(str);
+    return (size_t)(token.end - token.begin) == len
+        && memcmp(token.begin, str, len) == 0;
+}
+
+static WifSection wif_section_id(WifToken name)
+{
+    int i;
+    for(i = 1; i < WIF_NUM_SECTIONS; i++){
+        if(wif_token_equals(name, wif_section_names[i])){
+            return (WifSection)i;
+        }
+    }
+    return WIF_SECTION_OTHER;
+}
+
+// Parses an integer like atoi, stopping at the first character that is not
+// a digit. *next is set to that character.
+static uint32_t wif_parse_int(const char *p, const char *end,
+        const char **next)
+{
+    uint32_t accum = 0;
+    int negative = 0;
+    while(p < end && wif_is_space(*p)){
+        p++;
+    }
+    if(p < end && (*p == '-' || *p == '+')){
+        negative = *p == '-';
+        p++;
+    }
+    while(p < end && (uint32_t)(*p - '0') <= 9){
+        accum = 10*accum + (uint32_t)(*p - '0');
+        p++;
+    }
+    if(next){
+        *next = p;
+    }
+    return negative ? 0u - accum : accum;
+}
+
+// NOTE(Vidar): The value is divided by ten more than the number of decimals
+static int wif_parse_float(WifToken token, float *val)
 {
     uint32_t accum  = 0;
     uint32_t scale = 10;
     char dot_encountered = 0;
-    while(*str){
-        if(*str == '.'){
+    const char *p;
+    for(p = token.begin; p < token.end; p++){
+        if(*p == '.'){
             dot_encountered = 1;
         }else{
-            int32_t a = *str - '0';
-            if(a >= 0 && a <= 9){
-                accum = 10*accum + (uint32_t)a;
+            uint32_t a = (uint32_t)(*p - '0');
+            if(a <= 9){
+                accum = 10*accum + a;
                 if(dot_encountered){
                     scale *=10;
                 }
@@ -23,150 +109,406 @@ static int string_to_float(const char *str, float *val)
                 return 0;
             }
         }
-        str++;
     }
     *val = (float)accum / (float)scale;
     return 1;
 }
 
-//TODO(Vidar): Bounds check! IMPORTANT!
-static int32_t handler(void* user_data, const char* section, const char* name,
-                   const char* value)
+// Reads the per-thread entry "name=value" into the array, which is
+// allocated on first use
+static int wif_thread_entry(uint32_t **array, uint32_t num_threads,
+        uint32_t index, uint32_t value)
 {
-    WeaveData *data = (WeaveData*)user_data;
-    WarpOrWeftData *wdata = 0;
-    if(strcmp("WARP",section)==0){
-        wdata = &data->warp;
+    if(*array == 0){
+        *array = (uint32_t*)calloc(num_threads,sizeof(uint32_t));
+        if(*array == 0){
+            return 0;
+        }
     }
-    if(strcmp("WEFT",section)==0){
-        wdata = &data->weft;
+    if(index < num_threads){
+        (*array)[index] = value;
     }
-    if(wdata){
-        if(strcmp("Threads",name)==0){
-            wdata->num_threads = (uint32_t)atoi(value);
+    return 1;
+}
+
+static int wif_entry(WeaveData *data, WifSection section,
+        WifToken section_name, WifToken name, WifToken value)
+{
+    WarpOrWeftData *wdata = 0;
+    uint32_t index = wif_parse_int(name.begin, name.end, 0);
+    switch(section){
+    case WIF_SECTION_WARP:
+    case WIF_SECTION_WEFT:
+        wdata = section == WIF_SECTION_WARP ? &data->warp : &data->weft;
+        if(wif_token_equals(name, "Threads")){
+            wdata->num_threads = wif_parse_int(value.begin, value.end, 0);
+        }
+        if((wif_token_equals(name, "Spacing")
+                    && !wif_parse_float(value, &wdata->spacing))
+                || (wif_token_equals(name, "Thickness")
+                    && !wif_parse_float(value, &wdata->thickness))){
+            printf("could not read %.*s in [%.*s]!\n",
+                (int)(name.end - name.begin), name.begin,
+                (int)(section_name.end - section_name.begin),
+                section_name.begin);
+            return 0;
+        }
+        break;
+    case WIF_SECTION_WEAVING:
+        if(wif_token_equals(name, "Shafts")){
+            data->num_shafts = wif_parse_int(value.begin, value.end, 0);
+        }
+        if(wif_token_equals(name, "Treadles")){
+            data->num_treadles = wif_parse_int(value.begin, value.end, 0);
         }
-        if(strcmp("Spacing",name)==0){
-            if(!string_to_float(value,&wdata->spacing)){
-                printf("could not read %s in [%s]!\n",name,section);
+        break;
+    case WIF_SECTION_TIEUP:
+        {
+            const char *p = value.begin;
+            uint32_t x;
+            uint32_t num_tieup_entries = data->num_treadles*data->num_shafts;
+            if(num_tieup_entries <= 0){
+                printf("Tieup section appeared before specification of "
+                        "Shafts and Treadles!\n");
                 return 0;
             }
+            if(data->tieup == 0){
+                data->tieup = (uint8_t*)calloc(num_tieup_entries,
+                    sizeof(uint8_t));
+                if(data->tieup == 0){
+                    return 0;
+                }
+            }
+            x = data->num_treadles - index;
+            for(;;){
+                uint32_t y = data->num_shafts
+                    - wif_parse_int(p, value.end, &p);
+                if(x < data->num_treadles && y < data->num_shafts){
+                    data->tieup[x + y*data->num_treadles] = 1;
+                }
+                while(p < value.end && *p != ','){
+                    p++;
+                }
+                if(p == value.end){
+                    break;
+                }
+                p++;
+            }
+        }
+        break;
+    case WIF_SECTION_THREADING:
+        if(data->warp.num_threads <= 0){
+            printf("ERROR! Threading section appeared before specification of "
+                    "warp threads!\n");
+            return 0;
+        }
+        return wif_thread_entry(&data->threading, data->warp.num_threads,
+            index - 1,
+            data->num_shafts - wif_parse_int(value.begin, value.end, 0));
+    case WIF_SECTION_TREADLING:
+        if(data->weft.num_threads <= 0){
+            printf("ERROR! Treadling section appeared before specification of "
+                    "weft threads!\n");
+            return 0;
+        }
+        return wif_thread_entry(&data->treadling, data->weft.num_threads,
+            index - 1,
+            data->num_treadles - wif_parse_int(value.begin, value.end, 0));
+    case WIF_SECTION_COLOR_PALETTE:
+        if(wif_token_equals(name, "Entries")){
+            data->num_colors = wif_parse_int(value.begin, value.end, 0);
         }
-        if(strcmp("Thickness",name)==0){
-            if(!string_to_float(value,&wdata->thickness)){
-                printf("could not read %s in [%s]!\n",name,section);
+        break;
+    case WIF_SECTION_COLOR_TABLE:
+        {
+            const char *p = value.begin;
+            int c;
+            if(data->num_colors==0){
+                printf("ERROR! COLOR TABLE appeared before specification of "
+                        "COLOR PALETTE\n");
                 return 0;
             }
+            if(data->colors == 0){
+                data->colors = (float*)calloc(data->num_colors,
+                    sizeof(float)*3);
+                if(data->colors == 0){
+                    return 0;
+                }
+            }
+            index--;
+            //TODO(Vidar):Handle different formats
+            for(c = 0; c < 3; c++){
+                uint32_t component = wif_parse_int(p, value.end, &p);
+                if(index < data->num_colors){
+                    data->colors[index*3+c] = (float)(int32_t)component/255.0f;
+                }
+                while(p < value.end && *p != ','){
+                    p++;
+                }
+                if(p < value.end){
+                    p++;
+                }
+            }
         }
-    }
-    if(strcmp("WEAVING",section)==0){
-        if(strcmp("Shafts",name)==0){
-            data->num_shafts = (uint32_t)atoi(value);
-        }
-        if(strcmp("Treadles",name)==0){
-            data->num_treadles = (uint32_t)atoi(value);
+        break;
+    case WIF_SECTION_WARP_COLORS:
+    case WIF_SECTION_WEFT_COLORS:
+        wdata = section == WIF_SECTION_WARP_COLORS ? &data->warp : &data->weft;
+        if(wdata->num_threads <= 0){
+            printf("ERROR! %.*s section appeared before specification of "
+                    "%s threads!\n",
+                    (int)(section_name.end - section_name.begin),
+                    section_name.begin,
+                    section == WIF_SECTION_WARP_COLORS ? "warp" : "weft");
+            return 0;
         }
+        return wif_thread_entry(&wdata->colors, wdata->num_threads, index - 1,
+            wif_parse_int(value.begin, value.end, 0) - 1);
+    default:
+        break;
     }
-    if(strcmp("TIEUP",section)==0){
-        const char *p;
-        uint32_t x;
-        uint32_t num_tieup_entries = data->num_treadles * data->num_shafts;
-        if(num_tieup_entries <= 0){
-            printf("Tieup section appeared before specification of "
-                    "Shafts and Treadles!\n");
-            return 0;
+    return 1;
+}
+
+// Returns the first character in [p,end) which is c or starts an inline
+// comment, or end
+static const char *wif_find(const char *p, const char *end, char c)
+{
+    int was_space = 0;
+    while(p < end && *p != c && !(was_space && *p == ';')){
+        was_space = wif_is_space(*p);
+        p++;
+    }
+    return p;
+}
+
+// Names longer than this are truncated when they are kept between chunks,
+// as they were by inih
+#define WIF_MAX_NAME 64
+
+// The state of the parser between chunks
+typedef struct
+{
+    WeaveData *data;
+    WifSection section;
+    WifToken section_name, prev_name;
+    char section_name_storage[WIF_MAX_NAME], prev_name_storage[WIF_MAX_NAME];
+    int lineno;
+    int error; //The number of the first line with an error, like ini_parse
+}WifParser;
+
+// Copies the token to storage, so that it outlives the buffer it points to
+static void wif_keep_token(WifToken *token, char *storage)
+{
+    size_t len = (size_t)(token->end - token->begin);
+    if(token->begin != storage){
+        len = len < WIF_MAX_NAME ? len : WIF_MAX_NAME;
+        memmove(storage, token->begin, len);
+        token->begin = storage;
+        token->end = storage + len;
+    }
+}
+
+// Parses the lines in buffer, which has to end at the end of a line
+static void wif_parse_lines(WifParser *parser, const char *buffer,
+        size_t size)
+{
+    const char *p = buffer;
+    const char *buffer_end = buffer + size;
+    WeaveData *data = parser->data;
+    WifSection section = parser->section;
+    WifToken section_name = parser->section_name;
+    WifToken prev_name = parser->prev_name;
+    int lineno = parser->lineno;
+    int error = parser->error;
+    while(p < buffer_end){
+        const char *line = p, *start, *end, *separator = 0;
+        int was_space = 0, comment = 0;
+        // Most lines of a draft are "index=number", which are read without
+        // looking at any character twice
+        if((uint32_t)(*p - '0') <= 9){
+            WifToken name = {p, p}, value;
+            while(name.end < buffer_end && (uint32_t)(*name.end - '0') <= 9){
+                name.end++;
+            }
+            if(name.end < buffer_end && *name.end == '='){
+                value.begin = value.end = name.end + 1;
+                while(value.end < buffer_end
+                        && (uint32_t)(*value.end - '0') <= 9){
+                    value.end++;
+                }
+                if(value.end == buffer_end || *value.end == '\n'
+                        || (*value.end == '\r' && value.end + 1 < buffer_end
+                            && value.end[1] == '\n')){
+                    lineno++;
+                    p = value.end + (value.end == buffer_end ? 0
+                        : *value.end == '\r' ? 2 : 1);
+                    prev_name = name;
+                    if(!wif_entry(data, section, section_name, name, value)
+                            && !error){
+                        error = lineno;
+                    }
+                    continue;
+                }
+            }
         }
-        if(data->tieup == 0){
-            data->tieup = (uint8_t*)calloc(num_tieup_entries,sizeof(uint8_t));
+        // Otherwise, find the end of the line and the first '=' or ':'
+        // before any inline comment in the same scan
+        for(; p < buffer_end && *p != '\n'; p++){
+            if(!separator && !comment){
+                if(*p == '=' || *p == ':'){
+                    separator = p;
+                }else if(was_space && *p == ';'){
+                    comment = 1;
+                }
+            }
+            was_space = wif_is_space(*p);
         }
-        x = data->num_treadles - (uint32_t)atoi(name);
-        for(p = value; p != NULL;
-                p = (const char*)strchr(p, ','), p = (p == NULL)? NULL: p+1) {
-            uint32_t y = data->num_shafts - (uint32_t)atoi(p);
-            data->tieup[x + y*data->num_treadles] = 1;
+        end = p;
+        if(p < buffer_end){
+            p++;
         }
-    }
-    if(strcmp("THREADING",section)==0){
-        uint32_t w = data->warp.num_threads ;
-        if(w <= 0){
-            printf("ERROR! Threading section appeared before specification of "
-                    "warp threads!\n");
-            return 0;
+        lineno++;
+
+        start = line;
+        while(end > start && wif_is_space(end[-1])){
+            end--;
         }
-        if(data->threading == 0){
-            data->threading = (uint32_t*)calloc(w,sizeof(uint32_t));
+        while(start < end && wif_is_space(*start)){
+            start++;
         }
-        data->threading[((uint32_t)atoi(name)-1)] = data->num_shafts
-            - (uint32_t)atoi(value);
-    }
-    if(strcmp("TREADLING",section)==0){
-        uint32_t w = data->weft.num_threads ;
-        if(w <= 0){
-            printf("ERROR! Treadling section appeared before specification of "
-                    "weft threads!\n");
-            return 0;
+        if(start == end || *start == ';' || *start == '#'){
+            continue;
         }
-        if(data->treadling == 0){
-            data->treadling = (uint32_t*)calloc(w,sizeof(uint32_t));
+        if(start > line && prev_name.end > prev_name.begin){
+            WifToken value = {start, end};
+            if(!wif_entry(data, section, section_name, prev_name, value)
+                    && !error){
+                error = lineno;
+            }
+        }else if(*start == '['){
+            const char *close = wif_find(start + 1, end, ']');
+            if(close < end && *close == ']'){
+                section_name.begin = start + 1;
+                section_name.end = close;
+                section = wif_section_id(section_name);
+                prev_name.end = prev_name.begin;
+            }else if(!error){
+                error = lineno;
+            }
+        }else if(separator && separator < end){
+            WifToken name = {start, separator};
+            WifToken value = {separator + 1, end};
+            while(name.end > name.begin && wif_is_space(name.end[-1])){
+                name.end--;
+            }
+            while(value.begin < end && wif_is_space(*value.begin)){
+                value.begin++;
+            }
+            value.end = wif_find(value.begin, end, '\n');
+            while(value.end > value.begin && wif_is_space(value.end[-1])){
+                value.end--;
+            }
+            prev_name = name;
+            if(!wif_entry(data, section, section_name, name, value)
+                    && !error){
+                error = lineno;
+            }
+        }else if(!error){
+            error = lineno;
         }
-        data->treadling[((uint32_t)atoi(name)-1)] = data->num_treadles
-            - (uint32_t)atoi(value);
     }
-    if(strcmp("COLOR PALETTE",section)==0){
-        if(strcmp("Entries",name)==0){
-            data->num_colors = (uint32_t)atoi(value);
-        }
+    wif_keep_token(&section_name, parser->section_name_storage);
+    wif_keep_token(&prev_name, parser->prev_name_storage);
+    parser->section = section;
+    parser->section_name = section_name;
+    parser->prev_name = prev_name;
+    parser->lineno = lineno;
+    parser->error = error;
+}
+
+#define WIF_CHUNK_SIZE (64*1024)
+
+// Reads the file and parses it chunk by chunk. The buffer only grows if a
+// line is longer than a chunk. Returns 0 on success, the number of the first
+// line with an error, or -1 if the file could not be read.
+static int wif_parse_file(WeaveData *data, FILE *file)
+{
+    WifParser parser;
+    size_t capacity = WIF_CHUNK_SIZE;
+    size_t used = 0;
+    int first = 1;
+    char *buffer = (char*)malloc(capacity);
+    if(buffer == 0){
+        return -1;
     }
-    if(strcmp("COLOR TABLE",section)==0){
-        if(data->num_colors==0){
-            printf("ERROR! COLOR TABLE appeared before specification of "
-                    "COLOR PALETTE\n");
-            return 0;
+    memset(&parser, 0, sizeof(parser));
+    parser.data = data;
+    parser.section_name.begin = parser.section_name.end
+        = parser.section_name_storage;
+    parser.prev_name.begin = parser.prev_name.end = parser.prev_name_storage;
+    for(;;){
+        size_t read, lines_end;
+        if(used == capacity){
+            char *new_buffer = (char*)realloc(buffer, 2*capacity);
+            if(new_buffer == 0){
+                free(buffer);
+                return -1;
+            }
+            buffer = new_buffer;
+            capacity *= 2;
         }
-        if(data->colors == 0){
-            data->colors = (float*)calloc(data->num_colors,sizeof(float)*3);
-        }
-        uint32_t i = (uint32_t)atoi(name)-1;
-        //TODO(Vidar):Make sure all entries exist, handle different formats
-        const char *p = value;
-        data->colors[i*3+0] = (float)(atoi(p))/255.0f;
-        p = strchr(p, ',')+1;
-        data->colors[i*3+1] = (float)(atoi(p))/255.0f;
-        p = strchr(p, ',')+1;
-        data->colors[i*3+2] = (float)(atoi(p))/255.0f;
-    }
-    if(strcmp("WARP COLORS",section)==0){
-        uint32_t w = data->warp.num_threads ;
-        if(w <= 0){
-            printf("ERROR! WARP COLORS section appeared before specification of "
-                    "warp threads!\n");
-            return 0;
+        read = fread(buffer + used, 1, capacity - used, file);
+        used += read;
+        if(read == 0 && ferror(file)){
+            free(buffer);
+            return -1;
         }
-        if(data->warp.colors == 0){
-            data->warp.colors = (uint32_t*)calloc(w,sizeof(uint32_t));
+        if(first){
+            if(used < 3 && read > 0){
+                continue;
+            }
+            if(used >= 3 && (unsigned char)buffer[0] == 0xEF
+                    && (unsigned char)buffer[1] == 0xBB
+                    && (unsigned char)buffer[2] == 0xBF){
+                used -= 3;
+                memmove(buffer, buffer + 3, used);
+            }
+            first = 0;
         }
-        data->warp.colors[((uint32_t)atoi(name)-1)] = (uint32_t)atoi(value)-1;
-    }
-    if(strcmp("WEFT COLORS",section)==0){
-        //TODO(Vidar): Join with the case above...
-        uint32_t w = data->weft.num_threads ;
-        if(w <= 0){
-            printf("ERROR! WEFT COLORS section appeared before specification of "
-                    "weft threads!\n");
-            return 0;
+        // Parse up to the end of the last complete line, and keep the rest
+        // for the next chunk. At the end of the file, parse everything.
+        lines_end = used;
+        if(read > 0){
+            while(lines_end > 0 && buffer[lines_end - 1] != '\n'){
+                lines_end--;
+            }
+        }
+        if(lines_end > 0){
+            wif_parse_lines(&parser, buffer, lines_end);
+            used -= lines_end;
+            memmove(buffer, buffer + lines_end, used);
         }
-        if(data->weft.colors == 0){
-            data->weft.colors = (uint32_t*)calloc(w,sizeof(uint32_t));
+        if(read == 0){
+            break;
         }
-        data->weft.colors[((uint32_t)atoi(name)-1)] = (uint32_t)atoi(value)-1;
     }
-    return 1;
+    free(buffer);
+    return parser.error;
 }
 
 WeaveData *wif_read(const char *filename)
 {
     WeaveData *data;
+    FILE *file;
+    int error = -1;
     data = (WeaveData*)calloc(1,sizeof(WeaveData));
-    if (ini_parse(filename, handler, data) < 0) {
+    file = fopen(filename, "rb");
+    if(file){
+        error = wif_parse_file(data, file);
+        fclose(file);
+    }
+    if (error < 0) {
         printf("Could not read \"%s\"\n",filename);
     }
     return data;
@@ -181,9 +523,9 @@ WeaveData *wif_read_wchar(const wchar_t *filename)
     FILE* file;
     int error = -1;
 
-    file = _wfopen(filename, L"rt");
+    file = _wfopen(filename, L"rb");
     if(file){
-        error = ini_parse_file(file, handler, data);
+        error = wif_parse_file(data, file);
         fclose(file);
     }
     if (error < 0) {
@@ -207,12 +549,10 @@ void wif_free_weavedata(WeaveData *data)
 }
 
 
-PatternEntry *wif_get_pattern(WeaveData *data, uint32_t *w, uint32_t *h, 
+// Sets the size of the pattern in elements and in the real world
+static void wif_pattern_size(const WeaveData *data, uint32_t *w, uint32_t *h,
         float *rw, float *rh)
 {
-    uint32_t x,y;
-    PatternEntry *pattern = 0;
-
     //Pattern width/height in num of elements
     //TODO(Peter) should these not be reversed? :/
     *w = data->warp.num_threads;
@@ -222,28 +562,152 @@ PatternEntry *wif_get_pattern(WeaveData *data, uint32_t *w, uint32_t *h,
     //TODO(Peter): Assuming unit in wif is centimeters for thickness and spacing. Make it more general.
     *rw = REALWORLD_UV_WIF_TO_MM*(*w * (data->warp.thickness) + (*w - 1) * (data->warp.spacing)); 
     *rh = REALWORLD_UV_WIF_TO_MM*(*h * (data->weft.thickness) + (*h - 1) * (data->weft.spacing)); 
+}
+
+// Only the colors which are actually used by a thread end up in the
+// palette, so that the indices usually fit in 8 bits. Sets remap to the
+// palette index of each color in data, or WIF_MAX_PALETTE_SIZE if it is
+// not used, and returns the number of colors used. Returns
+// WIF_MAX_PALETTE_SIZE + 1 if more colors than that are used, and the
+// pattern can not be loaded.
+static uint32_t wif_remap_colors(const WeaveData *data, uint32_t w,
+        uint32_t h, uint32_t *remap)
+{
+    uint32_t x,i;
+    uint32_t num_used = 0;
+    for(i=0;i<data->num_colors;i++){
+        remap[i] = WIF_MAX_PALETTE_SIZE;
+    }
+    for(x=0;x<w+h;x++){
+        uint32_t c = x < w ? data->warp.colors[x]
+            : data->weft.colors[x-w];
+        if(c < data->num_colors && remap[c] == WIF_MAX_PALETTE_SIZE){
+            if(num_used == WIF_MAX_PALETTE_SIZE){
+                printf("Too many colors in pattern, "
+                        "only %d are supported!\n",WIF_MAX_PALETTE_SIZE);
+                return WIF_MAX_PALETTE_SIZE + 1;
+            }
+            remap[c] = num_used++;
+        }
+    }
+    return num_used;
+}
+
+static void wif_copy_palette(const WeaveData *data, const uint32_t *remap,
+        uint32_t num_used, PackedPattern *pattern)
+{
+    uint32_t i;
+    for(i=0;i<data->num_colors;i++){
+        if(remap[i] < num_used){
+            memcpy(pattern->palette + remap[i]*3, data->colors + i*3,
+                3*sizeof(float));
+        }
+    }
+}
+
+PackedPattern *wif_get_pattern(WeaveData *data, uint32_t *w, uint32_t *h, 
+        float *rw, float *rh)
+{
+    uint32_t x,y;
+    PackedPattern *pattern = 0;
+
+    wif_pattern_size(data, w, h, rw, rh);
 
     if(*w > 0 && *h >0){
-        pattern = (PatternEntry*)malloc((*w)*(*h)*sizeof(PatternEntry));
+        uint32_t *remap = (uint32_t*)malloc(data->num_colors*sizeof(uint32_t));
+        uint32_t num_used = wif_remap_colors(data, *w, *h, remap);
+        if(num_used <= WIF_MAX_PALETTE_SIZE){
+            pattern = wif_alloc_pattern(*w,*h,num_used > 0 ? num_used : 1);
+        }
+        if(pattern){
+            wif_copy_palette(data, remap, num_used, pattern);
+            for(y=0;y<*h;y++){
+                for(x=0;x<*w;x++){
+                    uint32_t v = data->threading[x];
+                    uint32_t u = data->treadling[y];
+                    uint8_t  warp_above = data->tieup[u+v*data->num_treadles];
+                    uint32_t col = warp_above ? data->warp.colors[x]
+                        : data->weft.colors[y];
+                    wif_pattern_set(pattern,x,y,warp_above,
+                        col < data->num_colors ? remap[col] : 0);
+                }
+            }
+        }
+        free(remap);
+    }
+    return pattern;
+}
+
+PackedPattern *wif_get_implicit_pattern(WeaveData *data, uint32_t *w,
+        uint32_t *h, float *rw, float *rh)
+{
+    uint32_t x,y;
+    uint32_t shafts = data->num_shafts, treadles = data->num_treadles;
+    PackedPattern *pattern;
+    uint32_t *remap, num_used;
+
+    wif_pattern_size(data, w, h, rw, rh);
+    if(*w == 0 || *h == 0 || !data->threading || !data->treadling
+            || !data->tieup || !data->warp.colors || !data->weft.colors){
+        return 0;
+    }
+    remap = (uint32_t*)malloc(data->num_colors*sizeof(uint32_t));
+    num_used = wif_remap_colors(data, *w, *h, remap);
+
+    // The last row and column are left empty, for threads whose shaft or
+    // treadle is out of range
+    pattern = 0;
+    if(num_used <= WIF_MAX_PALETTE_SIZE){
+        pattern = wif_alloc_implicit_pattern(*w, *h,
+            num_used > 0 ? num_used : 1, treadles + 1, shafts + 1);
+    }
+    if(!pattern){
+        free(remap);
+        return 0;
+    }
+
+    wif_copy_palette(data, remap, num_used, pattern);
+    for(x=0;x<*w;x++){
+        uint32_t c = data->warp.colors[x];
+        pattern->column_index[x] = data->threading[x] < shafts
+            ? data->threading[x] : shafts;
+        wif_set_color_index(pattern, pattern->warp_color_index, x,
+            c < data->num_colors ? remap[c] : 0);
+    }
+    for(y=0;y<*h;y++){
+        uint32_t c = data->weft.colors[y];
+        pattern->row_index[y] = data->treadling[y] < treadles
+            ? data->treadling[y] : treadles;
+        wif_set_color_index(pattern, pattern->weft_color_index, y,
+            c < data->num_colors ? remap[c] : 0);
+    }
+    // Row u has the elements of all warp threads on treadle u, and column v
+    // those of all weft threads on shaft v
+    for(y=0;y<treadles;y++){
+        uint64_t *row = pattern->warp_above + (size_t)y*pattern->words_per_row;
+        for(x=0;x<*w;x++){
+            uint32_t v = pattern->column_index[x];
+            if(v < shafts && data->tieup[y + v*treadles]){
+                row[x>>6] |= (uint64_t)1 << (x&63);
+            }
+        }
+    }
+    for(x=0;x<shafts;x++){
+        uint64_t *column = pattern->warp_above_columns
+            + (size_t)x*pattern->words_per_column;
         for(y=0;y<*h;y++){
-            for(x=0;x<*w;x++){
-                uint32_t v = data->threading[x];
-                uint32_t u = data->treadling[y];
-                uint8_t  warp_above = data->tieup[u+v*data->num_treadles];
-                float *col = data->colors + (warp_above ? data->warp.colors[x]
-                    : data->weft.colors[y])*3;
-                pattern[x+y*(*w)].warp_above = warp_above;
-                pattern[x+y*(*w)].color[0] = col[0];
-                pattern[x+y*(*w)].color[1] = col[1];
-                pattern[x+y*(*w)].color[2] = col[2];
+            uint32_t u = pattern->row_index[y];
+            if(u < treadles && data->tieup[u + x*treadles]){
+                column[y>>6] |= (uint64_t)1 << (y&63);
             }
         }
     }
+    free(remap);
     return pattern;
 }
 
 
-void wif_free_pattern(PatternEntry *pattern)
+void wif_free_pattern(PackedPattern *pattern)
 {
     free(pattern);
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include "common.h"
 #include "wchar.h"
+#include <stdlib.h>
+#include <string.h>
 
 typedef struct{
     uint32_t num_threads;
@@ -18,11 +20,240 @@ typedef struct
     float *colors;
 }WeaveData;
 
+// Compact representation of a weaving pattern. Whether the warp is above
+// is stored as a bitplane where every row starts on a new 64-bit word, and
+// once more transposed, so that every column starts on a new word too.
+// The color of each element is an index into a shared palette. The
+// indices are 8 bits when the palette has at most WIF_NARROW_PALETTE_SIZE
+// colors, and 16 bits otherwise (color_index_size is 1 or 2), so the
+// usual palettes of a handful of colors take a byte per element.
+// Everything is allocated as a single block by wif_alloc_pattern.
+// Only one repeat of the pattern is stored, repeat_width*repeat_height
+// elements, which is all of it unless the pattern has been compacted to
+// its smallest repeat. Element (x,y) is element
+// (x % repeat_width, y % repeat_height) of the repeat.
+// A pattern can also be implicit, stored as the draft it is woven from
+// (see wif_get_implicit_pattern). Then the bitplanes only hold one row per
+// treadle and one column per shaft: row y of the repeat is row
+// row_index[y] and column x is column column_index[x]. The color of an
+// element is the color of the warp or weft thread on top. This takes
+// O((width + height)*(shafts + treadles)/64) words instead of
+// O(width*height) bytes.
+#define WIF_NARROW_PALETTE_SIZE 256
+#define WIF_MAX_PALETTE_SIZE 65536
+
+// A regular weave (plain, twill or satin), where element (x,y) has the warp
+// above when (shift*x + y + offset) % repeat < floats. Warp floats are
+// floats elements long, and the weft ones are found arithmetically too
+// (see regular_weave_segments in woven_cloth.cpp).
+typedef struct
+{
+    uint32_t repeat; //0 if the pattern is not a regular weave
+    uint32_t shift, offset, floats;
+    uint32_t inverse_shift; //shift*inverse_shift % repeat == 1, if floats==1
+    uint16_t warp_color, weft_color; //Indices into the palette
+}RegularWeave;
+
 typedef struct
 {
-    uint8_t warp_above;
-    float color[3];
-}PatternEntry;
+    uint32_t width, height;
+    uint32_t repeat_width, repeat_height;
+    uint32_t words_per_row, words_per_column; //Of a row/column of the repeat
+    uint32_t num_colors;
+    uint32_t color_index_size; //Bytes per color index, 1 or 2
+    uint32_t num_rows, num_columns; //Rows/columns in the bitplanes
+    uint64_t *warp_above;         //num_rows*words_per_row words
+    uint64_t *warp_above_columns; //num_columns*words_per_column words
+    float    *palette;            //num_colors*3 floats
+    uint8_t  *color_index;        //repeat_width*repeat_height indices
+    // Only for implicit patterns, which have no color_index
+    uint32_t *row_index;          //repeat_height indices of rows
+    uint32_t *column_index;       //repeat_width indices of columns
+    uint8_t  *warp_color_index;   //repeat_width indices into palette
+    uint8_t  *weft_color_index;   //repeat_height indices into palette
+    RegularWeave regular; //Set when the pattern has been recognized as one
+}PackedPattern;
+
+static inline uint32_t wif_color_index_size(uint32_t num_colors)
+{
+    return num_colors > WIF_NARROW_PALETTE_SIZE ? 2 : 1;
+}
+
+// Index i of an array of color indices of pattern
+static inline uint32_t wif_color_index(const PackedPattern *pattern,
+        const uint8_t *indices, size_t i)
+{
+    return pattern->color_index_size == 1 ? indices[i]
+        : ((const uint16_t*)indices)[i];
+}
+
+static inline void wif_set_color_index(const PackedPattern *pattern,
+        uint8_t *indices, size_t i, uint32_t color_index)
+{
+    if(pattern->color_index_size == 1){
+        indices[i] = (uint8_t)color_index;
+    }else{
+        ((uint16_t*)indices)[i] = (uint16_t)color_index;
+    }
+}
+
+static inline size_t wif_pattern_memory(const PackedPattern *pattern)
+{
+    size_t size = sizeof(PackedPattern)
+        + (size_t)pattern->words_per_row*pattern->num_rows*sizeof(uint64_t)
+        + (size_t)pattern->words_per_column*pattern->num_columns
+            *sizeof(uint64_t)
+        + (size_t)pattern->num_colors*3*sizeof(float);
+    if(pattern->row_index){
+        return size
+            + ((size_t)pattern->repeat_width + pattern->repeat_height)
+                *(sizeof(uint32_t) + pattern->color_index_size);
+    }
+    return size + (size_t)pattern->repeat_width*pattern->repeat_height
+        *pattern->color_index_size;
+}
+
+static inline PackedPattern *wif_alloc_pattern(uint32_t w, uint32_t h,
+        uint32_t num_colors)
+{
+    PackedPattern layout;
+    memset(&layout, 0, sizeof(layout));
+    layout.width            = w;
+    layout.height           = h;
+    layout.repeat_width     = w;
+    layout.repeat_height    = h;
+    layout.words_per_row    = (w + 63)/64;
+    layout.words_per_column = (h + 63)/64;
+    layout.num_colors       = num_colors;
+    layout.color_index_size = wif_color_index_size(num_colors);
+    layout.num_rows         = h;
+    layout.num_columns      = w;
+    PackedPattern *pattern =
+        (PackedPattern*)calloc(1,wif_pattern_memory(&layout));
+    if(pattern){
+        *pattern = layout;
+        char *p = (char*)(pattern + 1);
+        pattern->warp_above = (uint64_t*)p;
+        p += (size_t)layout.words_per_row*h*sizeof(uint64_t);
+        pattern->warp_above_columns = (uint64_t*)p;
+        p += (size_t)layout.words_per_column*w*sizeof(uint64_t);
+        pattern->palette = (float*)p;
+        p += (size_t)num_colors*3*sizeof(float);
+        pattern->color_index = (uint8_t*)p;
+    }
+    return pattern;
+}
+
+// Allocates an implicit pattern with num_rows rows and num_columns columns
+// in its bitplanes
+static inline PackedPattern *wif_alloc_implicit_pattern(uint32_t w,
+        uint32_t h, uint32_t num_colors, uint32_t num_rows,
+        uint32_t num_columns)
+{
+    PackedPattern layout;
+    memset(&layout, 0, sizeof(layout));
+    layout.width            = w;
+    layout.height           = h;
+    layout.repeat_width     = w;
+    layout.repeat_height    = h;
+    layout.words_per_row    = (w + 63)/64;
+    layout.words_per_column = (h + 63)/64;
+    layout.num_colors       = num_colors;
+    layout.color_index_size = wif_color_index_size(num_colors);
+    layout.num_rows         = num_rows;
+    layout.num_columns      = num_columns;
+    PackedPattern *pattern = (PackedPattern*)calloc(1,sizeof(PackedPattern)
+        + (size_t)layout.words_per_row*num_rows*sizeof(uint64_t)
+        + (size_t)layout.words_per_column*num_columns*sizeof(uint64_t)
+        + ((size_t)w + h)*(sizeof(uint32_t) + layout.color_index_size)
+        + (size_t)num_colors*3*sizeof(float));
+    if(pattern){
+        *pattern = layout;
+        char *p = (char*)(pattern + 1);
+        pattern->warp_above = (uint64_t*)p;
+        p += (size_t)layout.words_per_row*num_rows*sizeof(uint64_t);
+        pattern->warp_above_columns = (uint64_t*)p;
+        p += (size_t)layout.words_per_column*num_columns*sizeof(uint64_t);
+        pattern->row_index = (uint32_t*)p;
+        p += (size_t)h*sizeof(uint32_t);
+        pattern->column_index = (uint32_t*)p;
+        p += (size_t)w*sizeof(uint32_t);
+        pattern->palette = (float*)p;
+        p += (size_t)num_colors*3*sizeof(float);
+        pattern->warp_color_index = (uint8_t*)p;
+        p += (size_t)w*layout.color_index_size;
+        pattern->weft_color_index = (uint8_t*)p;
+    }
+    return pattern;
+}
+
+// The coordinates of element (x,y) in the repeat
+static inline uint32_t wif_repeat_x(const PackedPattern *pattern, uint32_t x)
+{
+    return x < pattern->repeat_width ? x : x % pattern->repeat_width;
+}
+
+static inline uint32_t wif_repeat_y(const PackedPattern *pattern, uint32_t y)
+{
+    return y < pattern->repeat_height ? y : y % pattern->repeat_height;
+}
+
+// The words of row y and column x of the repeat in the warp_above
+// bitplanes
+static inline const uint64_t *wif_pattern_row(const PackedPattern *pattern,
+        uint32_t y)
+{
+    y = wif_repeat_y(pattern, y);
+    if(pattern->row_index){
+        y = pattern->row_index[y];
+    }
+    return pattern->warp_above + (size_t)y*pattern->words_per_row;
+}
+
+static inline const uint64_t *wif_pattern_column(const PackedPattern *pattern,
+        uint32_t x)
+{
+    x = wif_repeat_x(pattern, x);
+    if(pattern->column_index){
+        x = pattern->column_index[x];
+    }
+    return pattern->warp_above_columns + (size_t)x*pattern->words_per_column;
+}
+
+static inline uint8_t wif_pattern_warp_above(const PackedPattern *pattern,
+        uint32_t x, uint32_t y)
+{
+    x = wif_repeat_x(pattern, x);
+    return (uint8_t)((wif_pattern_row(pattern, y)[x>>6] >> (x&63)) & 1);
+}
+
+static inline const float *wif_pattern_color(const PackedPattern *pattern,
+        uint32_t x, uint32_t y)
+{
+    x = wif_repeat_x(pattern, x);
+    y = wif_repeat_y(pattern, y);
+    if(pattern->row_index){
+        return pattern->palette + 3*(wif_pattern_warp_above(pattern, x, y)
+            ? wif_color_index(pattern, pattern->warp_color_index, x)
+            : wif_color_index(pattern, pattern->weft_color_index, y));
+    }
+    return pattern->palette + 3*wif_color_index(pattern,
+        pattern->color_index, x + (size_t)y*pattern->repeat_width);
+}
+
+// Only for patterns from wif_alloc_pattern, with (x,y) in the repeat
+static inline void wif_pattern_set(PackedPattern *pattern, uint32_t x,
+        uint32_t y, uint8_t warp_above, uint32_t color_index)
+{
+    uint64_t *word = pattern->warp_above + y*pattern->words_per_row + (x>>6);
+    uint64_t bit = (uint64_t)1 << (x&63);
+    *word = warp_above ? (*word | bit) : (*word & ~bit);
+    word = pattern->warp_above_columns + x*pattern->words_per_column + (y>>6);
+    bit = (uint64_t)1 << (y&63);
+    *word = warp_above ? (*word | bit) : (*word & ~bit);
+    wif_set_color_index(pattern, pattern->color_index,
+        x + (size_t)y*pattern->repeat_width, color_index);
+}
 
 // Read a WIF file from disk
 WeaveData *wif_read(const char *filename);
@@ -30,7 +261,10 @@ WeaveData *wif_read_wchar(const wchar_t *filename);
 // Free the WeaveData data structure
 void wif_free_weavedata(WeaveData *data);
 // Allocate and return the pattern from a WIF file
-PatternEntry *wif_get_pattern(WeaveData *data, uint32_t *w, uint32_t *h, 
+PackedPattern *wif_get_pattern(WeaveData *data, uint32_t *w, uint32_t *h, 
         float *rw, float *rh);
-void wif_free_pattern(PatternEntry *pattern);
+// As wif_get_pattern, but an implicit pattern
+PackedPattern *wif_get_implicit_pattern(WeaveData *data, uint32_t *w,
+        uint32_t *h, float *rw, float *rh);
+void wif_free_pattern(PackedPattern *pattern);
 
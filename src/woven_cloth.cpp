@@ -2,18 +2,252 @@
 #ifndef WC_NO_FILES
 #define REALWORLD_UV_WIF_TO_MM 10.0
 #include "wif/wif.cpp"
-#include "wif/ini.cpp"
 #include "str2d.h"
 #endif
 
 #include "perlin.h"
 #include "halton.h"
+#include "normalization_table.h"
 
 // For M_PI etc.
 #ifndef _USE_MATH_DEFINES
 #define _USE_MATH_DEFINES
 #endif
 #include <math.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Define WC_NO_THREADS to do all work on the calling thread
+#if !defined(WC_NO_THREADS) || !defined(WC_NO_FILES)
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#ifndef WC_NO_THREADS
+#include <pthread.h>
+#endif
+#endif
+#endif
+
+// -- Threads -- //
+// Just enough to run a function on a few threads and wait for them
+typedef struct
+{
+    void (*func)(void *);
+    void *arg;
+#ifndef WC_NO_THREADS
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+#endif
+} wcThread;
+
+#ifndef WC_NO_THREADS
+#ifdef _WIN32
+static DWORD WINAPI wc_thread_entry(LPVOID thread)
+{
+    ((wcThread*)thread)->func(((wcThread*)thread)->arg);
+    return 0;
+}
+#else
+static void *wc_thread_entry(void *thread)
+{
+    ((wcThread*)thread)->func(((wcThread*)thread)->arg);
+    return 0;
+}
+#endif
+#endif
+
+// Runs func(arg) on a new thread. If the thread can't be started, func is
+// run before returning instead. thread must stay valid until wc_thread_join.
+static void wc_thread_start(wcThread *thread, void (*func)(void *), void *arg)
+{
+    thread->func = func;
+    thread->arg = arg;
+#ifndef WC_NO_THREADS
+#ifdef _WIN32
+    thread->handle = CreateThread(0, 0, wc_thread_entry, thread, 0, 0);
+    if(thread->handle){
+        return;
+    }
+#else
+    if(pthread_create(&thread->handle, 0, wc_thread_entry, thread) == 0){
+        return;
+    }
+#endif
+#endif
+    thread->func = 0;
+    func(arg);
+}
+
+static void wc_thread_join(wcThread *thread)
+{
+#ifdef WC_NO_THREADS
+    (void)thread;
+#else
+    if(thread->func){
+#ifdef _WIN32
+        WaitForSingleObject(thread->handle, INFINITE);
+        CloseHandle(thread->handle);
+#else
+        pthread_join(thread->handle, 0);
+#endif
+    }
+#endif
+}
+
+static uint32_t wc_num_cpus(void)
+{
+#ifndef WC_NO_THREADS
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? info.dwNumberOfProcessors : 1;
+#else
+    long num = sysconf(_SC_NPROCESSORS_ONLN);
+    return num > 0 ? (uint32_t)num : 1;
+#endif
+#else
+    return 1;
+#endif
+}
+
+// Calls func exactly once, even if several threads get here at once
+#ifdef WC_NO_THREADS
+typedef int wcOnce;
+#define WC_ONCE_INIT 0
+static void wc_call_once(wcOnce *once, void (*func)(void))
+{
+    if(!*once){
+        *once = 1;
+        func();
+    }
+}
+#elif defined(_WIN32)
+typedef INIT_ONCE wcOnce;
+#define WC_ONCE_INIT INIT_ONCE_STATIC_INIT
+static BOOL CALLBACK wc_once_entry(PINIT_ONCE once, PVOID func, PVOID *ctx)
+{
+    (void)once; (void)ctx;
+    ((void (*)(void))func)();
+    return TRUE;
+}
+static void wc_call_once(wcOnce *once, void (*func)(void))
+{
+    InitOnceExecuteOnce(once, wc_once_entry, (PVOID)func, 0);
+}
+#else
+typedef pthread_once_t wcOnce;
+#define WC_ONCE_INIT PTHREAD_ONCE_INIT
+static void wc_call_once(wcOnce *once, void (*func)(void))
+{
+    pthread_once(once, func);
+}
+#endif
+
+#ifndef WC_NO_FILES
+// A flag which is set once, and which threads can wait for. Only used for
+// asynchronous loading.
+typedef struct
+{
+#ifndef WC_NO_THREADS
+#ifdef _WIN32
+    SRWLOCK lock;
+    CONDITION_VARIABLE cond;
+#else
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+#endif
+#endif
+    volatile long value;
+} wcEvent;
+
+static void wc_event_init(wcEvent *event)
+{
+#ifndef WC_NO_THREADS
+#ifdef _WIN32
+    InitializeSRWLock(&event->lock);
+    InitializeConditionVariable(&event->cond);
+#else
+    pthread_mutex_init(&event->lock, 0);
+    pthread_cond_init(&event->cond, 0);
+#endif
+#endif
+    event->value = 0;
+}
+
+static void wc_event_destroy(wcEvent *event)
+{
+#if !defined(WC_NO_THREADS) && !defined(_WIN32)
+    pthread_mutex_destroy(&event->lock);
+    pthread_cond_destroy(&event->cond);
+#else
+    (void)event;
+#endif
+}
+
+// Doesn't lock, so that it's cheap to check often
+static int wc_event_is_set(wcEvent *event)
+{
+#ifdef WC_NO_THREADS
+    return event->value != 0;
+#elif defined(_WIN32)
+    return InterlockedCompareExchange(&event->value, 0, 0) != 0;
+#else
+    return __atomic_load_n(&event->value, __ATOMIC_ACQUIRE) != 0;
+#endif
+}
+
+static void wc_event_set(wcEvent *event)
+{
+#ifdef WC_NO_THREADS
+    event->value = 1;
+#elif defined(_WIN32)
+    AcquireSRWLockExclusive(&event->lock);
+    InterlockedExchange(&event->value, 1);
+    ReleaseSRWLockExclusive(&event->lock);
+    WakeAllConditionVariable(&event->cond);
+#else
+    pthread_mutex_lock(&event->lock);
+    __atomic_store_n(&event->value, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&event->lock);
+    pthread_cond_broadcast(&event->cond);
+#endif
+}
+
+static void wc_event_wait(wcEvent *event)
+{
+    if(wc_event_is_set(event)){
+        return;
+    }
+#ifndef WC_NO_THREADS
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&event->lock);
+    while(!event->value){
+        SleepConditionVariableSRW(&event->cond, &event->lock, INFINITE, 0);
+    }
+    ReleaseSRWLockExclusive(&event->lock);
+#else
+    pthread_mutex_lock(&event->lock);
+    while(!event->value){
+        pthread_cond_wait(&event->cond, &event->lock);
+    }
+    pthread_mutex_unlock(&event->lock);
+#endif
+#endif
+}
+#endif
 
 // -- 3D Vector data structure -- //
 typedef struct
@@ -109,6 +343,33 @@ static float sampleTEASingle(uint32_t v0, uint32_t v1, int rounds)
     return x.f - 1.0f;
 }
 
+// Hashes v0 and v1 with the 64 bit finalizer of MurmurHash3. Much cheaper
+// than 8 rounds of TEA, and neighbouring inputs are just as uncorrelated.
+// (pcg2d was tried first, but gives correlated neighbours after -log.)
+WC_PREFIX
+static uint32_t sampleMix(uint32_t v0, uint32_t v1)
+{
+    uint64_t h = ((uint64_t)v0 << 32) | v1;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return (uint32_t)(h >> 32);
+}
+
+// Same as sampleTEASingle, but with sampleMix
+WC_PREFIX
+static float sampleMixSingle(uint32_t v0, uint32_t v1)
+{
+    union {
+        uint32_t u;
+        float f;
+    } x;
+    x.u = (sampleMix(v0, v1) >> 9) | 0x3f800000UL;
+    return x.f - 1.0f;
+}
+
 WC_PREFIX
 void sample_cosine_hemisphere(float sample_x, float sample_y, float *p_x,
         float *p_y, float *p_z)
@@ -133,7 +394,9 @@ void sample_cosine_hemisphere(float sample_x, float sample_y, float *p_x,
 
     *p_x = r * cosf(phi);
     *p_y = r * sinf(phi);
-    *p_z = sqrtf(1.0f - (*p_x)*(*p_x) - (*p_y)*(*p_y));
+    // Rounding can put points on the edge of the disk just outside of it
+    float z2 = 1.0f - (*p_x)*(*p_x) - (*p_y)*(*p_y);
+    *p_z = sqrtf(z2 > 0.f ? z2 : 0.f);
 }
 
 WC_PREFIX
@@ -183,745 +446,3843 @@ void calculate_segment_uv_and_normal(wcPatternData *pattern_data,
 
 
 
+// Returns the i-th element along a column (for warp) or row (for weft)
 WC_PREFIX
-static void finalize_weave_parmeters(wcWeaveParameters *params)
+static uint8_t line_warp_above(const PackedPattern *pattern, uint32_t line,
+    uint32_t i, uint8_t warp)
 {
-    //Calculate normalization factor for the specular reflection
-
-    size_t nLocationSamples  = 100;
-    size_t nDirectionSamples = 1000;
-    params->specular_normalization = 1.f;
-
-    float highest_result = 0.f;
-    
-    // Temporarily disable intensity variation...
-    float tmp_intensity_fineness = params->intensity_fineness;
-    params->intensity_fineness = 0.f;
-
-    // Normalize by the largest reflection across all uv coords and
-    // incident directions
-    for (size_t i=0; i<nLocationSamples; i++) {
-        float result = 0.0f;
-        float halton_point[4];
-        halton_4(i+50,halton_point);
-        wcPatternData pattern_data;
-        // Pick a random location on a segment rectangle...
-        pattern_data.x = -1.f + 2.f*halton_point[0];
-        pattern_data.y = -1.f + 2.f*halton_point[1];
-        pattern_data.length = 1.f;
-        pattern_data.width = 1.f;
-        pattern_data.warp_above = 0;
-        calculate_segment_uv_and_normal(&pattern_data, params);
-        pattern_data.total_index_x = 0;
-        pattern_data.total_index_y = 0;
-
-        wcIntersectionData intersection_data;
-        sample_uniform_hemisphere(halton_point[2], halton_point[3],
-            &intersection_data.wi_x, &intersection_data.wi_y,
-            &intersection_data.wi_z);
+    return warp ? wif_pattern_warp_above(pattern, line, i)
+        : wif_pattern_warp_above(pattern, i, line);
+}
 
-        for (size_t j=0; j<nDirectionSamples; j++) {
-            float halton_direction[4];
-            halton_4(j+50+nLocationSamples,halton_direction);
-            // Since we use cosine sampling here, we can ignore the cos term
-            // in the integral
-            sample_cosine_hemisphere(halton_direction[0], halton_direction[1],
-                &intersection_data.wo_x, &intersection_data.wo_y,
-                &intersection_data.wo_z);
-            result += wcEvalSpecular(intersection_data,pattern_data,params);
+// Fills in the segment entries of all elements along one column (for warp)
+// or row (for weft) of the repeat of the pattern which have the
+// corresponding warp_above
+WC_PREFIX
+static void build_segments_along_line(const PackedPattern *pattern,
+    wcSegmentEntry *segment_entry, uint32_t line, uint8_t warp_above,
+    uint32_t yarn_index)
+{
+    uint32_t i, j;
+    uint32_t w = pattern->repeat_width;
+    uint32_t num = warp_above ? pattern->repeat_height : pattern->repeat_width;
+    // A line which is a single segment is one in the whole pattern
+    uint32_t full_num = warp_above ? pattern->height : pattern->width;
+    // Stride between consecutive entries along the line
+    uint32_t start  = warp_above ? line : line*w;
+    uint32_t stride = warp_above ? w : 1;
+    // Find an element where a segment begins
+    uint32_t first = num;
+    for(i=0;i<num;i++){
+        uint32_t prev = (i == 0 ? num : i) - 1;
+        if(line_warp_above(pattern, line, i, warp_above) !=
+                line_warp_above(pattern, line, prev, warp_above)){
+            first = i;
+            break;
         }
-        if(result > highest_result){
-            highest_result = result;
+    }
+    if(first == num){
+        // The whole line is a single segment which wraps around onto itself.
+        // Walking the pattern would visit all elements in both directions.
+        if(line_warp_above(pattern, line, 0, warp_above) == warp_above){
+            for(i=0;i<num;i++){
+                wcSegmentEntry *entry = segment_entry + start + i*stride;
+                entry->steps_left  = (uint16_t)full_num;
+                entry->steps_right = (uint16_t)full_num;
+                entry->length      = (uint16_t)(2*full_num + 1);
+                entry->yarn_index  = (uint16_t)yarn_index;
+            }
         }
+        return;
     }
-
-    if (highest_result <= 0.0001f){
-        params->specular_normalization = 0.f;
-    }else{
-        params->specular_normalization =
-            (float)nDirectionSamples /highest_result;
+    i = 0;
+    while(i < num){
+        uint32_t begin = (first + i) % num;
+        uint8_t state = line_warp_above(pattern, line, begin, warp_above);
+        uint32_t length = 1;
+        while(i + length < num && line_warp_above(pattern, line,
+                (begin + length) % num, warp_above) == state){
+            length++;
+        }
+        if(state == warp_above){
+            for(j=0;j<length;j++){
+                wcSegmentEntry *entry = segment_entry + start
+                    + ((begin + j) % num)*stride;
+                entry->steps_left  = (uint16_t)j;
+                entry->steps_right = (uint16_t)(length - 1 - j);
+                entry->length      = (uint16_t)length;
+                entry->yarn_index  = (uint16_t)yarn_index;
+            }
+        }
+        i += length;
     }
-    params->intensity_fineness = tmp_intensity_fineness;
 }
 
-
+// Precomputes the segment each element of the repeat of the pattern
+// belongs to, so that wcGetPatternData does not have to walk the pattern.
+// Implicit patterns have no table, since it would be larger than a dense
+// pattern, and regular weaves need none.
 WC_PREFIX
-static PatternEntry *build_pattern_from_data(uint8_t *warp_above,
-        float *warp_color, float *weft_color, uint32_t w, uint32_t h)
+static void build_segment_table(wcWeaveParameters *params)
 {
-    uint32_t x,y;
-    PatternEntry *pattern;
-    pattern = (PatternEntry*)malloc((w)*(h)*sizeof(PatternEntry));
+    uint32_t x, y;
+    uint32_t w, h;
+    params->segment_entry = 0;
+    if(params->segment_lookup == WC_SEGMENT_BITBOARD
+            || params->pattern == 0 || params->pattern->row_index
+            || params->pattern->regular.repeat
+            || params->pattern_width == 0 || params->pattern_height == 0
+            || params->pattern_width + params->pattern_height
+                >= WC_SEGMENT_TABLE_MAX_SIZE){
+        return;
+    }
+    w = params->pattern->repeat_width;
+    h = params->pattern->repeat_height;
+    params->segment_entry =
+        (wcSegmentEntry*)malloc(w*h*sizeof(wcSegmentEntry));
+    if(params->segment_entry == 0){
+        return;
+    }
+    //Warp segments go along the columns...
+    for(x=0;x<w;x++){
+        build_segments_along_line(params->pattern, params->segment_entry,
+            x, 1, x);
+    }
+    //...and weft segments along the rows
     for(y=0;y<h;y++){
-        for(x=0;x<w;x++){
-            pattern[x+y*w].warp_above = warp_above[x+y*w];
-            float *col = warp_above[x+y*w] ? warp_color : weft_color;
-            pattern[x+y*w].color[0] = col[0];
-            pattern[x+y*w].color[1] = col[1];
-            pattern[x+y*w].color[2] = col[2];
-        }
+        build_segments_along_line(params->pattern, params->segment_entry,
+            y, 0, w + y);
     }
-    return pattern;
 }
 
-#ifndef WC_NO_FILES
-
+// Whether the pattern repeats every p columns (horizontal) or rows
 WC_PREFIX
-static char * find_next_newline(char * buffer)
+static int pattern_repeats(const PackedPattern *pattern, uint32_t p,
+    int horizontal)
 {
-    char *r = buffer;
-    while(*r != 0 && *r != '\n'){
-        r++;
+    uint32_t w = pattern->width, h = pattern->height, y;
+    size_t size = pattern->color_index_size;
+    if(pattern->row_index){
+        if(horizontal){
+            return memcmp(pattern->column_index + p, pattern->column_index,
+                    (size_t)(w - p)*sizeof(uint32_t)) == 0
+                && memcmp(pattern->warp_color_index + p*size,
+                    pattern->warp_color_index, (w - p)*size) == 0;
+        }
+        return memcmp(pattern->row_index + p, pattern->row_index,
+                (size_t)(h - p)*sizeof(uint32_t)) == 0
+            && memcmp(pattern->weft_color_index + p*size,
+                pattern->weft_color_index, (h - p)*size) == 0;
+    }
+    if(horizontal){
+        size_t words = pattern->words_per_column;
+        if(memcmp(pattern->warp_above_columns + p*words,
+                pattern->warp_above_columns,
+                (w - p)*words*sizeof(uint64_t)) != 0){
+            return 0;
+        }
+        for(y=0;y<h;y++){
+            const uint8_t *row = pattern->color_index + (size_t)y*w*size;
+            if(memcmp(row + p*size, row, (w - p)*size) != 0){
+                return 0;
+            }
+        }
+        return 1;
+    }else{
+        size_t words = pattern->words_per_row;
+        return memcmp(pattern->warp_above + p*words, pattern->warp_above,
+                (h - p)*words*sizeof(uint64_t)) == 0
+            && memcmp(pattern->color_index + (size_t)p*w*size,
+                pattern->color_index, (size_t)(h - p)*w*size) == 0;
     }
-    return r;
 }
 
+// The smallest divisor of the width (horizontal) or height by which the
+// pattern repeats
 WC_PREFIX
-static char * read_color_from_weave_string(char *string, float * color)
+static uint32_t pattern_period(const PackedPattern *pattern, int horizontal)
 {
-    char *s = string;
-    for(int i=0;i<3;i++){
-        int a = atoi(s);
-        s = find_next_newline(s+1);
-        color[i] = (float)a/255.f;
+    uint32_t num = horizontal ? pattern->width : pattern->height;
+    uint32_t p;
+    for(p=1;p<num;p++){
+        if(num % p == 0 && pattern_repeats(pattern, p, horizontal)){
+            return p;
+        }
     }
-    return find_next_newline(find_next_newline(s)+1)+1;
+    return num;
 }
 
+// Copies the first num bits of each of the count bitplane lines of src to
+// dst
 WC_PREFIX
-static char * read_dimensions_from_weave_string(char *string,
-        float * thicknessw, float * thicknessh)
+static void copy_bitplane_prefix(uint64_t *dst, uint32_t dst_words,
+    const uint64_t *src, uint32_t src_words, uint32_t count, uint32_t num)
 {
-    char *s = string;
-    
-    *thicknessw = (float)str2d(s);
-    s = find_next_newline(s+1);
-    *thicknessh = (float)str2d(s);
-    s = find_next_newline(s+1);
-    
-    return find_next_newline(find_next_newline(s)+1)+1;
+    uint32_t i;
+    for(i=0;i<count;i++){
+        uint64_t *d = dst + (size_t)i*dst_words;
+        memcpy(d, src + (size_t)i*src_words, dst_words*sizeof(uint64_t));
+        if(num & 63){
+            d[dst_words - 1] &= ((uint64_t)1 << (num & 63)) - 1;
+        }
+    }
 }
 
-
+// Shrinks the stored pattern to its smallest repeat, which is all that
+// lookups need since they wrap around it. Many drafts are a small weave
+// repeated across the whole width, so this often makes the pattern small
+// enough to stay in cache. pattern_width and pattern_height are not
+// changed, so neither is the result of shading.
 WC_PREFIX
-static void read_pattern_from_weave_string(char * s, uint32_t *pattern_width,
-    uint32_t *pattern_height, float *pattern_realwidth,
-    float *pattern_realheight, PatternEntry **pattern)
+static void compact_pattern(wcWeaveParameters *params)
 {
-    //A Weave file has 2-three sets of color
-    //2-two sets of thickness and spacing in cm
-    //a pattern matrix
-
-    float warp_color[3], weft_color[3], 
-          warp_thickness, weft_thickness;
-    s = read_color_from_weave_string(s,warp_color);
-    s = read_color_from_weave_string(s,weft_color);
-    s = read_dimensions_from_weave_string(s, &warp_thickness, &weft_thickness);
-
-    char * t = find_next_newline(s);
-    *pattern_width = t - s;
-    int i = 0;
-    int num_chars = 0;
-    while(s[i] != 0) {
-        if(s[i] == '0' || s[i] == '1'){
-            num_chars++;
-        }
-        i++;
+    PackedPattern *pattern = params->pattern;
+    PackedPattern *compact;
+    uint32_t w, h, rw, rh, x, y;
+    if(!pattern || pattern->repeat_width != pattern->width
+            || pattern->repeat_height != pattern->height
+            || pattern->width == 0 || pattern->height == 0){
+        return;
     }
-    *pattern = (PatternEntry*)calloc(num_chars,sizeof(PatternEntry));
-    *pattern_height = num_chars/(*pattern_width);
-    
-    *pattern_realwidth = REALWORLD_UV_WIF_TO_MM
-        * (*pattern_width * (warp_thickness)); 
-    *pattern_realheight = REALWORLD_UV_WIF_TO_MM
-        * (*pattern_height * (weft_thickness)); 
-   
-    
-    i = 0;
-    int ii =0;
-    while(s[i] != 0) {
-        if(s[i] == '0' || s[i] == '1'){
-            if(s[i] == '1'){
-                (*pattern)[ii].warp_above = 1;
-                memcpy((*pattern)[ii].color,warp_color,3*sizeof(float));
-            }else{
-                memcpy((*pattern)[ii].color,weft_color,3*sizeof(float));
+    w = pattern->width;
+    h = pattern->height;
+    rw = pattern_period(pattern, 1);
+    rh = pattern_period(pattern, 0);
+    if(rw == w && rh == h){
+        return;
+    }
+    if(pattern->row_index){
+        compact = wif_alloc_implicit_pattern(rw, rh, pattern->num_colors,
+            pattern->num_rows, pattern->num_columns);
+        if(!compact){
+            return;
+        }
+        memcpy(compact->row_index, pattern->row_index, rh*sizeof(uint32_t));
+        memcpy(compact->column_index, pattern->column_index,
+            rw*sizeof(uint32_t));
+        memcpy(compact->weft_color_index, pattern->weft_color_index,
+            (size_t)rh*pattern->color_index_size);
+        memcpy(compact->warp_color_index, pattern->warp_color_index,
+            (size_t)rw*pattern->color_index_size);
+        copy_bitplane_prefix(compact->warp_above, compact->words_per_row,
+            pattern->warp_above, pattern->words_per_row,
+            pattern->num_rows, rw);
+        copy_bitplane_prefix(compact->warp_above_columns,
+            compact->words_per_column, pattern->warp_above_columns,
+            pattern->words_per_column, pattern->num_columns, rh);
+    }else{
+        compact = wif_alloc_pattern(rw, rh, pattern->num_colors);
+        if(!compact){
+            return;
+        }
+        for(y=0;y<rh;y++){
+            for(x=0;x<rw;x++){
+                wif_pattern_set(compact, x, y,
+                    wif_pattern_warp_above(pattern, x, y),
+                    wif_color_index(pattern, pattern->color_index,
+                        x + (size_t)y*w));
             }
-            ii++;
         }
-        i++;
     }
+    memcpy(compact->palette, pattern->palette,
+        pattern->num_colors*3*sizeof(float));
+    compact->width  = w;
+    compact->height = h;
+    free(pattern);
+    params->pattern = compact;
 }
 
+// The segment element (x,y) of a regular weave is part of, found from the
+// repeat, shift and offset only. Returns warp_above. The results are the
+// same as those of walking the pattern.
 WC_PREFIX
-void wcWeavePatternFromFile(wcWeaveParameters *params, const char *filename)
+static inline uint8_t regular_weave_segment(const RegularWeave *regular,
+    uint32_t x, uint32_t y, uint32_t *steps_left, uint32_t *steps_right)
 {
-    if(strlen(filename) > 4){
-        if(strcmp(filename+strlen(filename)-4,".wif") == 0){
-            wcWeavePatternFromWIF(params,filename);
-        } else {
-            wcWeavePatternFromWeaveFile(params,filename);
-        }
+    uint32_t n = regular->repeat;
+    uint32_t t = (regular->shift*(x % n) + y % n + regular->offset) % n;
+    if(t < regular->floats){
+        //Along a column t increases by one per element
+        *steps_left  = t;
+        *steps_right = regular->floats - 1 - t;
+        return 1;
+    }
+    //Along a row it increases by shift
+    if(regular->shift == 1){
+        *steps_left  = t - regular->floats;
+        *steps_right = n - 1 - t;
+    }else if(regular->shift == n - 1){
+        *steps_left  = n - 1 - t;
+        *steps_right = t - regular->floats;
+    }else if(regular->floats == n - 1){
+        *steps_left = *steps_right = 0;
     }else{
-        params->pattern_height = params->pattern_width = 0;
-        params->pattern_entry = 0;
+        //A single warp element per repeat, where t is 0
+        *steps_left  = t*regular->inverse_shift % n - 1;
+        *steps_right = (n - t)*regular->inverse_shift % n - 1;
     }
+    return 0;
 }
 
+// Recognizes a pattern whose repeat is a regular weave (see RegularWeave)
+// with a single warp and weft color, for which regular_weave_segment can
+// find the segments: plain weaves and twills, where shift is 1 or
+// repeat - 1, and satins, where either the warp or the weft only has
+// single elements between the floats.
 WC_PREFIX
-void wcWeavePatternFromFile_wchar(wcWeaveParameters *params,
-    const wchar_t *filename)
+static void detect_regular_weave(PackedPattern *pattern)
 {
-    if(wcslen(filename) > 4){
-        if(wcscmp(filename+wcslen(filename)-4,L".wif") == 0){
-            wcWeavePatternFromWIF_wchar(params,filename);
-        } else {
-            wcWeavePatternFromWeaveFile_wchar(params,filename);
+    RegularWeave regular;
+    uint32_t n, x, y, floats = 0, start[2] = {0, 0}, period, i;
+    int warp_color = -1, weft_color = -1;
+    memset(&pattern->regular, 0, sizeof(pattern->regular));
+    n = pattern->repeat_height;
+    if(n < 2 || n > 65535){
+        return;
+    }
+    // The warp floats of the first two columns give the offset and shift
+    for(x=0;x<2;x++){
+        uint32_t num_starts = 0, num = 0;
+        for(y=0;y<n;y++){
+            uint8_t a = wif_pattern_warp_above(pattern, x, y);
+            if(a && !wif_pattern_warp_above(pattern, x, (y + n - 1) % n)){
+                start[x] = y;
+                num_starts++;
+            }
+            num += a;
         }
-    }else{
-        params->pattern_height = params->pattern_width = 0;
-        params->pattern_entry = 0;
+        if(num_starts != 1 || (x > 0 && num != floats)){
+            return;
+        }
+        floats = num;
+    }
+    memset(&regular, 0, sizeof(regular));
+    regular.repeat = n;
+    regular.floats = floats;
+    regular.offset = (n - start[0]) % n;
+    regular.shift  = (start[0] + n - start[1]) % n;
+    if(regular.shift == 0){
+        return;
+    }
+    if(regular.shift != 1 && regular.shift != n - 1 && floats != n - 1){
+        if(floats != 1){
+            return;
+        }
+        i = 1;
+        while(i < n && regular.shift*i % n != 1){
+            i++;
+        }
+        if(i == n){
+            return;
+        }
+        regular.inverse_shift = i;
     }
+    // The shortest horizontal period of the weave, which the compacted
+    // pattern must have too
+    period = 1;
+    while(regular.shift*period % n != 0){
+        period++;
+    }
+    if(pattern->repeat_width != period){
+        return;
+    }
+    for(y=0;y<n;y++){
+        for(x=0;x<period;x++){
+            uint32_t left, right;
+            uint8_t a = regular_weave_segment(&regular, x, y, &left, &right);
+            int c = (int)(wif_pattern_color(pattern, x, y) - pattern->palette)
+                / 3;
+            int *color = a ? &warp_color : &weft_color;
+            if(a != wif_pattern_warp_above(pattern, x, y)
+                    || (*color >= 0 && *color != c)){
+                return;
+            }
+            *color = c;
+        }
+    }
+    regular.warp_color = (uint16_t)warp_color;
+    regular.weft_color = (uint16_t)weft_color;
+    pattern->regular = regular;
 }
 
+// Modified Bessel function of the first kind, used to normalize vonMises
 WC_PREFIX
-void wcWeavePatternFromWIF(wcWeaveParameters *params, const char *filename)
-{
-    WeaveData *data = wif_read(filename);
-    params->pattern_entry = wif_get_pattern(data,
-        &params->pattern_width, &params->pattern_height,
-        &params->pattern_realwidth, &params->pattern_realheight);
-    wif_free_weavedata(data);
-    finalize_weave_parmeters(params);
-}
-
-WC_PREFIX
-void wcWeavePatternFromWIF_wchar(wcWeaveParameters *params,
-        const wchar_t *filename)
-{
-    WeaveData *data = wif_read_wchar(filename);
-    params->pattern_entry = wif_get_pattern(data,
-        &params->pattern_width, &params->pattern_height,
-        &params->pattern_realwidth, &params->pattern_realheight);
-    wif_free_weavedata(data);
-    finalize_weave_parmeters(params);
+static float besselI0(float b) {
+    float I0, absB = fabsf(b);
+    if (fabsf(b) <= 3.75f) {
+        float t = absB / 3.75f;
+        t = t * t;
+        I0 = 1.0f + t*(3.5156229f + t*(3.0899424f + t*(1.2067492f
+            + t*(0.2659732f + t*(0.0360768f + t*0.0045813f)))));
+    } else {
+        float t = 3.75f / absB;
+        I0 = expf(absB) / sqrtf(absB) * (0.39894228f + t*(0.01328592f
+            + t*(0.00225319f + t*(-0.00157565f + t*(0.00916281f
+            + t*(-0.02057706f + t*(0.02635537f + t*(-0.01647633f
+            + t*0.00392377f))))))));
+    }
+    return I0;
 }
 
+// The parameters the baked yarn variation depends on
 WC_PREFIX
-static void weave_pattern_from_weave_file(wcWeaveParameters *params,
-    FILE *f)
+static void yarn_variation_key(const wcWeaveParameters *params, float *key)
 {
-    fseek (f , 0 , SEEK_END);
-    long lSize = ftell (f);
-    rewind (f);
-    char *buffer = (char*) calloc (lSize+1,sizeof(char));
-    if (buffer == NULL) {fputs ("Memory error",stderr); exit (2);}
-    fread (buffer,1,lSize,f);
-    read_pattern_from_weave_string(buffer, 
-            &params->pattern_width, &params->pattern_height,
-            &params->pattern_realwidth, &params->pattern_realheight,
-            &params->pattern_entry);
-    finalize_weave_parmeters(params);
+    key[0] = params->yarnvar_amplitude > 0.001f ? 1.f : 0.f;
+    key[1] = params->yarnvar_xscale;
+    key[2] = params->yarnvar_yscale;
+    key[3] = params->yarnvar_persistance;
+    key[4] = (float)params->yarnvar_octaves;
+    key[5] = (float)params->yarnvar_bake_resolution;
+    key[6] = (float)params->yarnvar_bake_repeats;
 }
 
+// Bakes the noise used by yarnVariation into params->yarnvar_table.
+// The noise is a function of the total index of the yarn and the position
+// along it, in elements. Both warp and weft yarns are looked up by their
+// total index, so the table holds max(width,height)*repeats yarns, each
+// with the same length in elements. The last sample of each yarn is at the
+// end of its last element, so that the lookup never interpolates across
+// the wrap. If the table would be too large it is not baked, and
+// yarnvar_table stays 0.
 WC_PREFIX
-void wcWeavePatternFromWeaveFile(wcWeaveParameters *params,
-    const char *filename)
+static void bake_yarn_variation(wcWeaveParameters *params)
 {
-    FILE *f = fopen(filename,"rt");
-    if(f){
-        weave_pattern_from_weave_file(params,f);
-        fclose(f);
-    }else{
-        params->pattern_width = params->pattern_height = 0;
+    params->yarnvar_table = 0;
+    params->compiled.yarnvar_table_yarns = 0;
+    params->compiled.yarnvar_table_samples = 0;
+    yarn_variation_key(params, params->compiled.yarnvar_table_key);
+    params->compiled.yarnvar_table_owner = params;
+    if(params->yarnvar_amplitude <= 0.001f
+            || params->yarnvar_bake_resolution == 0 || params->pattern == 0){
+        return;
+    }
+    uint32_t repeats = params->yarnvar_bake_repeats > 0 ?
+        params->yarnvar_bake_repeats : 1;
+    uint32_t size = params->pattern_width > params->pattern_height ?
+        params->pattern_width : params->pattern_height;
+    uint64_t yarns = (uint64_t)size*repeats;
+    uint64_t samples = yarns*params->yarnvar_bake_resolution + 1;
+    float *table = 0;
+    if(yarns*samples <= UINT32_MAX){
+        table = (float*)malloc(sizeof(float)*yarns*samples);
+    }
+    if(!table){
+#ifndef WC_NO_FILES
+        printf("Yarn variation table of %llu samples is too large, "
+            "the noise is evaluated instead!\n",
+            (unsigned long long)(yarns*samples));
+#endif
+        return;
+    }
+    float xscale = params->yarnvar_xscale;
+    float yscale = params->yarnvar_yscale;
+    int octaves = params->yarnvar_octaves;
+    float persistance = params->yarnvar_persistance;
+    float width = (float)params->pattern_width;
+    uint32_t yarn, i;
+    for(yarn=0;yarn<yarns;yarn++){
+        float x_noise = ((float)yarn/width) * xscale;
+        for(i=0;i<samples;i++){
+            float position = (float)i/(float)params->yarnvar_bake_resolution;
+            float y_noise = position/width * yscale;
+            table[yarn*samples + i] = octavePerlin2f(x_noise, y_noise,
+                octaves, persistance);
+        }
     }
+    params->yarnvar_table = table;
+    params->compiled.yarnvar_table_yarns = (uint32_t)yarns;
+    params->compiled.yarnvar_table_samples = (uint32_t)samples;
 }
 
+// Bakes the yarn variation again if the parameters it depends on have
+// changed. Copies of the parameters share the table of the ones they were
+// copied from, which free it, so a copy evaluates the noise instead.
 WC_PREFIX
-void wcWeavePatternFromWeaveFile_wchar(wcWeaveParameters *params,
-    const wchar_t *filename)
+static void update_yarn_variation(wcWeaveParameters *params)
 {
-#ifdef _WIN32
-    FILE *f = _wfopen(filename, L"rt");
-    if(f){
-        weave_pattern_from_weave_file(params,f);
-        fclose(f);
+    float key[7];
+    yarn_variation_key(params, key);
+    if(params->pattern == 0 || memcmp(key,
+            params->compiled.yarnvar_table_key, sizeof(key)) == 0){
+        return;
+    }
+    if(params->compiled.yarnvar_table_owner == params){
+        free(params->yarnvar_table);
+        bake_yarn_variation(params);
     }else{
-        params->pattern_width = params->pattern_height = 0;
-		params->pattern_entry = 0;
+        params->yarnvar_table = 0;
+        params->compiled.yarnvar_table_yarns = 0;
+        params->compiled.yarnvar_table_samples = 0;
     }
-#endif
 }
-#endif
 
 WC_PREFIX
-void wcWeavePatternFromData(wcWeaveParameters *params, uint8_t *pattern,
-    float *warp_color, float *weft_color, uint32_t pattern_width,
-    uint32_t pattern_height)
-{
-    params->pattern_width  = pattern_width;
-    params->pattern_height = pattern_height;
-    params->pattern_entry  = build_pattern_from_data(pattern,
-            warp_color, weft_color, pattern_width, pattern_height);
-    finalize_weave_parmeters(params);
-}
+static void select_kernels(wcWeaveParameters *params);
+WC_PREFIX
+static void tabulate_specular_albedo(wcWeaveParameters *params);
+WC_PREFIX
+static int specular_albedo_outdated(const wcWeaveParameters *params);
 
+// Sets params->compiled from the parameters
 WC_PREFIX
-void wcFreeWeavePattern(wcWeaveParameters *params)
+static void compile_weave_parameters(wcWeaveParameters *params)
 {
-    if(params->pattern_entry){
-        free(params->pattern_entry);
+    wcCompiledParameters *compiled = &params->compiled;
+    //Real world scaling.
+    //Set repeating uv coordinates.
+    //Either set using realworld scale or uvscale parameters.
+    if (params->realworld_uv) {
+        //the user parameters uscale, vscale change roles when realworld_uv
+        // is true
+        //they are then used to tweak the realworld scales
+        compiled->u_scale = params->uscale/params->pattern_realwidth; 
+        compiled->v_scale = params->vscale/params->pattern_realheight;
+    } else {
+        compiled->u_scale = params->uscale;
+        compiled->v_scale = params->vscale;
     }
+    compiled->von_mises_I0 = besselI0(params->beta);
+    compiled->von_mises_normalization =
+        1.f/(2 * M_PI * compiled->von_mises_I0);
+    compiled->radius_of_curvature = 1.f/(sin(params->umax));
+    compiled->tan_psi = tanf(params->psi);
+    compiled->abs_sin_psi = fabsf(sinf(params->psi));
+    select_kernels(params);
 }
 
-WC_PREFIX
-static float intensityVariation(wcPatternData pattern_data,
-    const wcWeaveParameters *params)
+// -- Specular normalization -- //
+// The specular term is normalized by the largest reflection across
+// WC_NORMALIZATION_LOCATIONS points on a segment and incident directions,
+// each integrated over WC_NORMALIZATION_DIRECTIONS outgoing directions.
+// The points and directions come from the Halton sequence and are the same
+// for every pattern, so they are only computed once. The directions beyond
+// the first WC_NORMALIZATION_DIRECTIONS are computed the first time the
+// adaptive estimator is used.
+#define WC_NORMALIZATION_LOCATIONS  100
+#define WC_NORMALIZATION_DIRECTIONS 1000
+// The directions are evaluated in chunks of this size with
+// wcEvalSpecularBatch, keeping the batch of pattern data on the stack
+#define WC_NORMALIZATION_CHUNK 256
+// With normalization_tolerance, each location starts with
+// WC_NORMALIZATION_MIN_DIRECTIONS directions, which are doubled until the
+// location is done or has WC_NORMALIZATION_MAX_DIRECTIONS
+#define WC_NORMALIZATION_MIN_DIRECTIONS 256
+#define WC_NORMALIZATION_MAX_DIRECTIONS 65536
+// A location is clearly not the largest when the intervals of this many
+// standard errors around it and the largest do not overlap
+#define WC_NORMALIZATION_PRUNE_SIGMAS 3.0
+
+typedef struct
 {
-    if(params->intensity_fineness < 0.001f){
-        return 1.f;
-    }
-    // have index to make a grid of finess*fineness squares 
-    // of which to have the same brightness variations.
+    // Position on the segment and incident direction of each location
+    float x[WC_NORMALIZATION_LOCATIONS], y[WC_NORMALIZATION_LOCATIONS];
+    float wi_x[WC_NORMALIZATION_LOCATIONS], wi_y[WC_NORMALIZATION_LOCATIONS],
+          wi_z[WC_NORMALIZATION_LOCATIONS];
+    // Cosine weighted outgoing directions. The fixed estimator uses the
+    // first WC_NORMALIZATION_DIRECTIONS of them.
+    float wo_x[WC_NORMALIZATION_MAX_DIRECTIONS],
+          wo_y[WC_NORMALIZATION_MAX_DIRECTIONS],
+          wo_z[WC_NORMALIZATION_MAX_DIRECTIONS];
+} wcNormalizationSamples;
 
-    uint32_t tindex_x = pattern_data.total_index_x;
-    uint32_t tindex_y = pattern_data.total_index_y;
+static wcNormalizationSamples wc_normalization_samples;
+static wcOnce wc_normalization_samples_once = WC_ONCE_INIT;
+static wcOnce wc_normalization_directions_once = WC_ONCE_INIT;
 
-    //Switch X and Y for warp, so that we have the yarn going along y
-    if(!pattern_data.warp_above){
-        float tmp = tindex_x;
-        tindex_x = tindex_y;
-        tindex_y = tmp;
+static void init_normalization_directions(int first, int end)
+{
+    wcNormalizationSamples *s = &wc_normalization_samples;
+    int i;
+    for (i=first; i<end; i++) {
+        float halton_direction[2];
+        halton_2(i+50+WC_NORMALIZATION_LOCATIONS,halton_direction);
+        sample_cosine_hemisphere(halton_direction[0], halton_direction[1],
+            &s->wo_x[i], &s->wo_y[i], &s->wo_z[i]);
     }
-
-    //segment start x,y
-    float centerx = tindex_x - (pattern_data.x*0.5f)*pattern_data.width;
-    float centery = tindex_y - (pattern_data.y*0.5f)*pattern_data.length;
-    
-    uint32_t r1 = (uint32_t) ((centerx + tindex_x) 
-            * params->intensity_fineness);
-    uint32_t r2 = (uint32_t) ((centery + tindex_y) 
-            * params->intensity_fineness);
-    
-    float xi = sampleTEASingle(r1, r2, 8);
-    float log_xi = -logf(xi);
-    return log_xi < 10.f ? log_xi : 10.f;
 }
 
-WC_PREFIX
-static float yarnVariation(wcPatternData pattern_data, 
-        const wcWeaveParameters *params)
+static void init_normalization_samples(void)
 {
-
-    float variation = 1.f;
-
-    uint32_t tindex_x = pattern_data.total_index_x;
-    uint32_t tindex_y = pattern_data.total_index_y;
-
-    //Switch X and Y for warp, so that we have the yarn going along y
-    if(!pattern_data.warp_above){
-        float tmp = tindex_x;
-        tindex_x = tindex_y;
-        tindex_y = tmp;
+    wcNormalizationSamples *s = &wc_normalization_samples;
+    int i;
+    for (i=0; i<WC_NORMALIZATION_LOCATIONS; i++) {
+        float halton_point[4];
+        halton_4(i+50,halton_point);
+        s->x[i] = -1.f + 2.f*halton_point[0];
+        s->y[i] = -1.f + 2.f*halton_point[1];
+        sample_uniform_hemisphere(halton_point[2], halton_point[3],
+            &s->wi_x[i], &s->wi_y[i], &s->wi_z[i]);
     }
+    init_normalization_directions(0, WC_NORMALIZATION_DIRECTIONS);
+}
 
-    //We want to vary the intesity along the yarn.
-    //For a parallel yarn we want a diffrent variation. 
-    //Use a large xscale to make the values different.
-
-    float amplitude = params->yarnvar_amplitude;
-    float xscale = params->yarnvar_xscale;
-    float yscale = params->yarnvar_yscale;
-    int octaves = params->yarnvar_octaves;
-    float persistance = params->yarnvar_persistance; //paramter
-
-    float x_noise = (tindex_x/(float)params->pattern_width) * xscale;
-    //NOTE(Vidar): Should it really be pattern_width here too? Ask Peter...
-    float y_noise = (tindex_y + (pattern_data.y/2.f + 0.5))
-        /(float)params->pattern_width * yscale;
+static void init_more_normalization_directions(void)
+{
+    init_normalization_directions(WC_NORMALIZATION_DIRECTIONS,
+        WC_NORMALIZATION_MAX_DIRECTIONS);
+}
 
-    variation = octavePerlin(x_noise, y_noise, 0,
-            octaves, persistance) * amplitude + 1.f;
+WC_PREFIX
+static inline void pattern_data_to_batch(const wcPatternDataBatch *batch,
+    uint32_t i, wcPatternData data);
 
-    return wcClamp(variation, 0.f, 1.f);
+// Running sums of the specular reflection at each location, over the
+// directions evaluated so far
+typedef struct
+{
+    uint32_t count[WC_NORMALIZATION_LOCATIONS];
+    float sum[WC_NORMALIZATION_LOCATIONS];
+    double sum_d[WC_NORMALIZATION_LOCATIONS];
+    double sum_sq[WC_NORMALIZATION_LOCATIONS];
+} wcNormalizationSums;
 
-    //NOTE(Peter): Right now there is perlin on both warp and weft.
-    //Would be useful to specify only warp or weft. Or even better, 
-    //if a yarn_type definition is made, 
-    // define noise parmeters for a certain yarn. along with other 
-    // yarn properties.
-}
+typedef struct
+{
+    const wcWeaveParameters *params;
+    uint32_t first, step; //Locations first, first+step, ...
+    const uint32_t *end; //Adds directions count..end-1 to each location
+    wcNormalizationSums *sums;
+} wcNormalizationJob;
 
-WC_PREFIX
-static void calculateLengthOfSegment(uint8_t warp_above, uint32_t pattern_x,
-                uint32_t pattern_y, uint32_t *steps_left,
-                uint32_t *steps_right,  uint32_t pattern_width,
-                uint32_t pattern_height, PatternEntry *pattern_entry)
+static void normalization_job(void *arg)
 {
+    const wcNormalizationJob *job = (const wcNormalizationJob*)arg;
+    const wcWeaveParameters *params = job->params;
+    const wcNormalizationSamples *s = &wc_normalization_samples;
+    wcNormalizationSums *sums = job->sums;
 
-    uint32_t current_x = pattern_x;
-    uint32_t current_y = pattern_y;
-    uint32_t *incremented_coord = warp_above ? &current_y : &current_x;
-    uint32_t max_size = warp_above ? pattern_height: pattern_width;
-    uint32_t initial_coord = warp_above ? pattern_y: pattern_x;
-    *steps_right = 0;
-    *steps_left  = 0;
-    do{
-        (*incremented_coord)++;
-        if(*incremented_coord == max_size){
-            *incremented_coord = 0;
+    float uv_x[WC_NORMALIZATION_CHUNK], uv_y[WC_NORMALIZATION_CHUNK],
+          wi_x[WC_NORMALIZATION_CHUNK], wi_y[WC_NORMALIZATION_CHUNK],
+          wi_z[WC_NORMALIZATION_CHUNK];
+    float color_r[WC_NORMALIZATION_CHUNK], color_g[WC_NORMALIZATION_CHUNK],
+          color_b[WC_NORMALIZATION_CHUNK], normal_x[WC_NORMALIZATION_CHUNK],
+          normal_y[WC_NORMALIZATION_CHUNK], normal_z[WC_NORMALIZATION_CHUNK],
+          u[WC_NORMALIZATION_CHUNK], v[WC_NORMALIZATION_CHUNK],
+          length[WC_NORMALIZATION_CHUNK], width[WC_NORMALIZATION_CHUNK],
+          x[WC_NORMALIZATION_CHUNK], y[WC_NORMALIZATION_CHUNK];
+    uint32_t total_index_x[WC_NORMALIZATION_CHUNK],
+             total_index_y[WC_NORMALIZATION_CHUNK];
+    uint8_t warp_above[WC_NORMALIZATION_CHUNK];
+    float specular[WC_NORMALIZATION_CHUNK];
+    wcPatternDataBatch data = {color_r, color_g, color_b, normal_x, normal_y,
+        normal_z, u, v, length, width, x, y, total_index_x, total_index_y,
+        warp_above};
+    wcIntersectionBatch intersection_data;
+    intersection_data.uv_x = uv_x; intersection_data.uv_y = uv_y;
+    intersection_data.wi_x = wi_x; intersection_data.wi_y = wi_y;
+    intersection_data.wi_z = wi_z;
+
+    uint32_t i, j, k;
+    for (i=job->first; i<WC_NORMALIZATION_LOCATIONS; i+=job->step) {
+        if (sums->count[i] >= job->end[i]) {
+            continue;
         }
-        if((pattern_entry[current_x +
-                current_y*pattern_width].warp_above) != warp_above){
-            break;
+        wcPatternData pattern_data = {0};
+        // Pick a random location on a segment rectangle...
+        pattern_data.x = s->x[i];
+        pattern_data.y = s->y[i];
+        pattern_data.length = 1.f;
+        pattern_data.width = 1.f;
+        pattern_data.warp_above = 0;
+        calculate_segment_uv_and_normal(&pattern_data, params);
+        pattern_data.total_index_x = 0;
+        pattern_data.total_index_y = 0;
+        for (k=0; k<WC_NORMALIZATION_CHUNK; k++) {
+            uv_x[k] = 0.f; uv_y[k] = 0.f;
+            wi_x[k] = s->wi_x[i]; wi_y[k] = s->wi_y[i]; wi_z[k] = s->wi_z[i];
+            pattern_data_to_batch(&data, k, pattern_data);
         }
-        (*steps_right)++;
-    } while(*incremented_coord != initial_coord);
 
-    *incremented_coord = initial_coord;
-    do{
-        if(*incremented_coord == 0){
-            *incremented_coord = max_size;
-        }
-        (*incremented_coord)--;
-        if((pattern_entry[current_x +
-                current_y*pattern_width].warp_above) != warp_above){
-            break;
+        // Sum in order of j, so that the result does not depend on the
+        // chunk size or on which thread does the work
+        float result = sums->sum[i];
+        double result_d = sums->sum_d[i], result_sq = sums->sum_sq[i];
+        for (j=sums->count[i]; j<job->end[i]; j+=WC_NORMALIZATION_CHUNK) {
+            uint32_t num = job->end[i] - j;
+            if (num > WC_NORMALIZATION_CHUNK) {
+                num = WC_NORMALIZATION_CHUNK;
+            }
+            intersection_data.wo_x = s->wo_x + j;
+            intersection_data.wo_y = s->wo_y + j;
+            intersection_data.wo_z = s->wo_z + j;
+            // Since we use cosine sampling here, we can ignore the cos term
+            // in the integral
+            wcEvalSpecularBatch(&intersection_data, &data, num, specular,
+                params);
+            for (k=0; k<num; k++) {
+                result += specular[k];
+                result_d += specular[k];
+                result_sq += (double)specular[k]*specular[k];
+            }
         }
-        (*steps_left)++;
-    } while(*incremented_coord != initial_coord);
+        sums->sum[i] = result;
+        sums->sum_d[i] = result_d;
+        sums->sum_sq[i] = result_sq;
+        sums->count[i] = job->end[i];
+    }
 }
 
-WC_PREFIX
-static float vonMises(float cos_x, float b) {
-    // assumes a = 0, b > 0 is a concentration parameter.
-    float I0, absB = fabsf(b);
-    if (fabsf(b) <= 3.75f) {
-        float t = absB / 3.75f;
-        t = t * t;
-        I0 = 1.0f + t*(3.5156229f + t*(3.0899424f + t*(1.2067492f
-            + t*(0.2659732f + t*(0.0360768f + t*0.0045813f)))));
-    } else {
-        float t = 3.75f / absB;
-        I0 = expf(absB) / sqrtf(absB) * (0.39894228f + t*(0.01328592f
-            + t*(0.00225319f + t*(-0.00157565f + t*(0.00916281f
-            + t*(-0.02057706f + t*(0.02635537f + t*(-0.01647633f
-            + t*0.00392377f))))))));
+// Adds directions to the locations until sums->count[i] == end[i]
+static void run_normalization_jobs(const wcWeaveParameters *params,
+        uint32_t num_threads, const uint32_t *end, wcNormalizationSums *sums)
+{
+    wcNormalizationJob jobs[WC_NORMALIZATION_LOCATIONS];
+    wcThread threads[WC_NORMALIZATION_LOCATIONS];
+    uint32_t i;
+    for (i=0; i<num_threads; i++) {
+        jobs[i].params = params;
+        jobs[i].first = i;
+        jobs[i].step = num_threads;
+        jobs[i].end = end;
+        jobs[i].sums = sums;
+    }
+    // The calling thread does the first job
+    for (i=1; i<num_threads; i++) {
+        wc_thread_start(&threads[i], normalization_job, &jobs[i]);
     }
+    normalization_job(&jobs[0]);
+    for (i=1; i<num_threads; i++) {
+        wc_thread_join(&threads[i]);
+    }
+}
 
-    return expf(b * cos_x) / (2 * M_PI * I0);
+// Mean and standard error of the mean of location i. The directions are
+// quasi random, so the standard error is an overestimate.
+static double normalization_mean(const wcNormalizationSums *sums, uint32_t i,
+        double *std_error)
+{
+    double n = (double)sums->count[i];
+    double mean = sums->sum_d[i]/n;
+    double variance = (sums->sum_sq[i] - sums->sum_d[i]*mean)/(n - 1.0);
+    *std_error = variance > 0.0 ? sqrt(variance/n) : 0.0;
+    return mean;
+}
+
+// Returns the location with the largest mean
+static uint32_t normalization_largest(const wcNormalizationSums *sums)
+{
+    uint32_t i, largest = 0;
+    for (i=1; i<WC_NORMALIZATION_LOCATIONS; i++) {
+        if (sums->sum_d[i]/sums->count[i]
+                > sums->sum_d[largest]/sums->count[largest]) {
+            largest = i;
+        }
+    }
+    return largest;
 }
 
+// Sets params->specular_normalization, normalization_error and
+// normalization_samples. Needs the compiled parameters.
 WC_PREFIX
-wcPatternData wcGetPatternData(wcIntersectionData intersection_data,
-        const wcWeaveParameters *params)
+static void compute_specular_normalization(wcWeaveParameters *params)
 {
-    if(params->pattern_entry == 0){
-        wcPatternData data = {0};
-        return data;
+    wc_call_once(&wc_normalization_samples_once, init_normalization_samples);
+    params->specular_normalization = 1.f;
+
+    // Temporarily disable intensity variation...
+    float tmp_intensity_fineness = params->intensity_fineness;
+    params->intensity_fineness = 0.f;
+    select_kernels(params);
+    // Detect the SIMD width before the threads use it
+    wcGetSimdWidth();
+
+    uint32_t num_threads = params->normalization_threads;
+    if (num_threads == 0) {
+        num_threads = wc_num_cpus();
     }
-    float uv_x = intersection_data.uv_x;
-    float uv_y = intersection_data.uv_y;
-    //Real world scaling.
-    //Set repeating uv coordinates.
-    //Either set using realworld scale or uvscale parameters.
-    float u_scale, v_scale;
-    if (params->realworld_uv) {
-        //the user parameters uscale, vscale change roles when realworld_uv
-        // is true
-        //they are then used to tweak the realworld scales
-        u_scale = params->uscale/params->pattern_realwidth; 
-        v_scale = params->vscale/params->pattern_realheight;
-    } else {
-        u_scale = params->uscale;
-        v_scale = params->vscale;
+    if (num_threads > WC_NORMALIZATION_LOCATIONS) {
+        num_threads = WC_NORMALIZATION_LOCATIONS;
     }
-    float u_repeat = fmod(uv_x*u_scale,1.f);
-    float v_repeat = fmod(uv_y*v_scale,1.f);
-    //pattern index
-    //TODO(Peter): these are new. perhaps they can be used later 
-    // to avoid duplicate calculations.
-    //TODO(Peter): come up with a better name for these...
-    uint32_t total_x = uv_x*u_scale*params->pattern_width;
-    uint32_t total_y = uv_y*v_scale*params->pattern_height;
+    wcNormalizationSums sums;
+    memset(&sums, 0, sizeof(sums));
+    uint32_t end[WC_NORMALIZATION_LOCATIONS];
+    uint32_t i, samples = 0;
+    double mean, std_error;
+    float highest_result = 0.f;
 
-    //TODO(Vidar): Check why this crashes sometimes
-    if (u_repeat < 0.f) {
-        u_repeat = u_repeat - floor(u_repeat);
+    if (params->normalization_tolerance <= 0.f) {
+        for (i=0; i<WC_NORMALIZATION_LOCATIONS; i++) {
+            end[i] = WC_NORMALIZATION_DIRECTIONS;
+        }
+        run_normalization_jobs(params, num_threads, end, &sums);
+        // Normalize by the largest reflection across all uv coords and
+        // incident directions
+        uint32_t largest = 0;
+        for (i=0; i<WC_NORMALIZATION_LOCATIONS; i++) {
+            if(sums.sum[i] > highest_result){
+                highest_result = sums.sum[i];
+                largest = i;
+            }
+        }
+        mean = normalization_mean(&sums, largest, &std_error);
+    } else {
+        // Every round doubles the directions of the locations which are
+        // neither accurate enough nor clearly below the largest one. The
+        // rounds only depend on the sums, so the result does not depend on
+        // the number of threads.
+        double tolerance = params->normalization_tolerance;
+        wc_call_once(&wc_normalization_directions_once,
+            init_more_normalization_directions);
+        for (i=0; i<WC_NORMALIZATION_LOCATIONS; i++) {
+            end[i] = WC_NORMALIZATION_MIN_DIRECTIONS;
+        }
+        int more = 1;
+        while (more) {
+            run_normalization_jobs(params, num_threads, end, &sums);
+            double largest_error;
+            double largest_mean = normalization_mean(&sums,
+                normalization_largest(&sums), &largest_error);
+            double lower_bound = largest_mean
+                - WC_NORMALIZATION_PRUNE_SIGMAS*largest_error;
+            more = 0;
+            for (i=0; i<WC_NORMALIZATION_LOCATIONS; i++) {
+                mean = normalization_mean(&sums, i, &std_error);
+                if (std_error > tolerance*mean
+                        && mean + WC_NORMALIZATION_PRUNE_SIGMAS*std_error
+                            >= lower_bound
+                        && sums.count[i] < WC_NORMALIZATION_MAX_DIRECTIONS) {
+                    end[i] = 2*sums.count[i];
+                    more = 1;
+                }
+            }
+        }
+        mean = normalization_mean(&sums, normalization_largest(&sums),
+            &std_error);
+        // Same scale as the fixed estimator
+        highest_result = (float)(mean*WC_NORMALIZATION_DIRECTIONS);
     }
-    if (v_repeat < 0.f) {
-        v_repeat = v_repeat - floor(v_repeat);
+    for (i=0; i<WC_NORMALIZATION_LOCATIONS; i++) {
+        samples += sums.count[i];
     }
 
-    uint32_t pattern_x = (uint32_t)(u_repeat*(float)(params->pattern_width));
-    uint32_t pattern_y = (uint32_t)(v_repeat*(float)(params->pattern_height));
-
-    PatternEntry current_point = params->pattern_entry[pattern_x +
-        pattern_y*params->pattern_width];        
-
-    //Calculate the size of the segment
-    uint32_t steps_left_warp = 0, steps_right_warp = 0;
-    uint32_t steps_left_weft = 0, steps_right_weft = 0;
-    if (current_point.warp_above) {
-        calculateLengthOfSegment(current_point.warp_above, pattern_x,
-            pattern_y, &steps_left_warp, &steps_right_warp,
-            params->pattern_width, params->pattern_height,
-            params->pattern_entry);
+    if (highest_result <= 0.0001f){
+        params->specular_normalization = 0.f;
+        params->normalization_error = 0.f;
     }else{
-        calculateLengthOfSegment(current_point.warp_above, pattern_x,
-            pattern_y, &steps_left_weft, &steps_right_weft,
-            params->pattern_width, params->pattern_height,
-            params->pattern_entry);
+        params->specular_normalization =
+            (float)WC_NORMALIZATION_DIRECTIONS /highest_result;
+        params->normalization_error = (float)(std_error/mean);
     }
+    params->normalization_samples = samples;
+    params->intensity_fineness = tmp_intensity_fineness;
+    select_kernels(params);
+}
 
-    //Yarn-segment-local coordinates.
-    float l = (steps_left_warp + steps_right_warp + 1.f);
-    float y = ((v_repeat*(float)(params->pattern_height) - (float)pattern_y)
-            + steps_left_warp)/l;
 
-    float w = (steps_left_weft + steps_right_weft + 1.f);
-    float x = ((u_repeat*(float)(params->pattern_width) - (float)pattern_x)
-            + steps_left_weft)/w;
+// -- Normalization cache -- //
+// specular_normalization only depends on umax, psi, alpha, beta, delta_x
+// and normalization_tolerance (the segment used above is synthetic), so it
+// can be stored
+// between runs. The cache is a file in the directory given by
+// normalization_cache_dir, or the WC_NORMALIZATION_CACHE environment
+// variable. It is memory mapped and holds a fixed size hash table with
+// one entry per parameter combination. Entries are compared on all key
+// words, so a hash collision only means that an entry is overwritten.
+// Several processes may use the same file at once; each entry has a
+// checksum, so that one which is being written by another process is
+// ignored. Only the process which creates the file writes its header, and
+// a file with an invalid header (e.g. one that is still being created) is
+// not used, so that no process clears entries that another has stored.
+// The file is in the byte order of the machine. Change the file name if
+// the layout of the file changes.
+
+#define WC_NORMALIZATION_CACHE_FILE "woven_cloth_normalization.cache"
+#define WC_NORMALIZATION_CACHE_ENTRIES 1024
+#define WC_NORMALIZATION_CACHE_PROBES 8
+// Change when the result of compute_specular_normalization changes, so
+// that old entries are not used
+#define WC_NORMALIZATION_VERSION 3
+#define WC_NORMALIZATION_KEY_SIZE 10
+
+typedef struct
+{
+    char magic[4]; //"WCNC"
+    uint32_t num_entries;
+    uint32_t entry_size;
+    uint32_t reserved;
+} wcNormalizationCacheHeader;
+
+typedef struct
+{
+    uint32_t key[WC_NORMALIZATION_KEY_SIZE];
+    float normalization;
+    float error;
+    uint32_t samples;
+    uint32_t checksum; //0 for an empty entry
+} wcNormalizationCacheEntry;
+
+#define WC_NORMALIZATION_CACHE_SIZE (sizeof(wcNormalizationCacheHeader) \
+    + WC_NORMALIZATION_CACHE_ENTRIES*sizeof(wcNormalizationCacheEntry))
+
+#ifndef WC_NO_FILES
+#ifdef _WIN32
+typedef struct
+{
+    HANDLE file, mapping;
+    void *data;
+} wcMappedFile;
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+typedef struct
+{
+    void *data;
+    size_t size;
+} wcMappedFile;
+#endif
+
+// Maps the file for reading and writing, creating it or growing it to size
+// bytes if needed. New bytes are zero. Sets created to 1 if this call
+// created the file, which only one of several processes that open it at
+// once does. Returns 0 on failure.
+static void *wc_map_file(wcMappedFile *mapped, const char *filename,
+        size_t size, int *created)
+{
+#ifdef _WIN32
+    mapped->file = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE, 0, OPEN_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL, 0);
+    if(mapped->file == INVALID_HANDLE_VALUE){
+        return 0;
+    }
+    *created = GetLastError() != ERROR_ALREADY_EXISTS;
+    // Grows the file if it's smaller than size
+    mapped->mapping = CreateFileMappingA(mapped->file, 0, PAGE_READWRITE, 0,
+        (DWORD)size, 0);
+    if(!mapped->mapping){
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    mapped->data = MapViewOfFile(mapped->mapping, FILE_MAP_ALL_ACCESS, 0, 0,
+        size);
+    if(!mapped->data){
+        CloseHandle(mapped->mapping);
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    return mapped->data;
+#else
+    struct stat st;
+    int fd = open(filename, O_RDWR | O_CREAT | O_EXCL, 0666);
+    *created = fd >= 0;
+    if(fd < 0 && errno == EEXIST){
+        fd = open(filename, O_RDWR);
+    }
+    if(fd < 0){
+        return 0;
+    }
+    if(fstat(fd, &st) != 0
+            || ((size_t)st.st_size < size && ftruncate(fd, size) != 0)){
+        close(fd);
+        return 0;
+    }
+    mapped->data = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(mapped->data == MAP_FAILED){
+        return 0;
+    }
+    mapped->size = size;
+    return mapped->data;
+#endif
+}
+
+// Maps an existing file for reading only, and sets size to its size. Only
+// one of filename and filename_wchar is used; the latter only on Windows.
+// Returns 0 on failure, or if the file is empty.
+static const void *wc_map_file_read(wcMappedFile *mapped,
+        const char *filename, const wchar_t *filename_wchar, size_t *size)
+{
+#ifdef _WIN32
+    if(filename){
+        mapped->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ,
+            0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+    }else{
+        mapped->file = CreateFileW(filename_wchar, GENERIC_READ,
+            FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+    }
+    LARGE_INTEGER file_size;
+    if(mapped->file == INVALID_HANDLE_VALUE){
+        return 0;
+    }
+    if(!GetFileSizeEx(mapped->file, &file_size) || file_size.QuadPart == 0
+            || (uint64_t)file_size.QuadPart > (size_t)-1){
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    mapped->mapping = CreateFileMappingA(mapped->file, 0, PAGE_READONLY, 0,
+        0, 0);
+    if(!mapped->mapping){
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    mapped->data = MapViewOfFile(mapped->mapping, FILE_MAP_READ, 0, 0, 0);
+    if(!mapped->data){
+        CloseHandle(mapped->mapping);
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    *size = (size_t)file_size.QuadPart;
+    return mapped->data;
+#else
+    struct stat st;
+    if(!filename){
+        (void)filename_wchar;
+        return 0;
+    }
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0){
+        return 0;
+    }
+    if(fstat(fd, &st) != 0 || st.st_size <= 0){
+        close(fd);
+        return 0;
+    }
+    mapped->data = mmap(0, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(mapped->data == MAP_FAILED){
+        return 0;
+    }
+    mapped->size = (size_t)st.st_size;
+    *size = mapped->size;
+    return mapped->data;
+#endif
+}
+
+static void wc_unmap_file(wcMappedFile *mapped)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(mapped->data);
+    CloseHandle(mapped->mapping);
+    CloseHandle(mapped->file);
+#else
+    munmap(mapped->data, mapped->size);
+#endif
+}
+
+static uint32_t wc_hash_words(const uint32_t *words, uint32_t num)
+{
+    uint64_t h = 0x9e3779b97f4a7c15ULL;
+    uint32_t i;
+    for(i=0;i<num;i++){
+        h ^= words[i];
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+    }
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return (uint32_t)h;
+}
+
+static uint32_t wc_float_bits(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+static void normalization_cache_key(const wcWeaveParameters *params,
+        uint32_t *key)
+{
+    key[0] = WC_NORMALIZATION_VERSION;
+    key[1] = WC_NORMALIZATION_LOCATIONS;
+    key[2] = WC_NORMALIZATION_DIRECTIONS;
+    // The SIMD kernels change the last bits of the result
+    key[3] = (uint32_t)wcGetSimdWidth();
+    key[4] = wc_float_bits(params->umax);
+    key[5] = wc_float_bits(params->psi);
+    key[6] = wc_float_bits(params->alpha);
+    key[7] = wc_float_bits(params->beta);
+    key[8] = wc_float_bits(params->delta_x);
+    key[9] = params->normalization_tolerance > 0.f ?
+        wc_float_bits(params->normalization_tolerance) : 0;
+}
+
+static uint32_t normalization_cache_checksum(
+        const wcNormalizationCacheEntry *entry)
+{
+    uint32_t words[WC_NORMALIZATION_KEY_SIZE + 3];
+    memcpy(words, entry->key, sizeof(entry->key));
+    words[WC_NORMALIZATION_KEY_SIZE] = wc_float_bits(entry->normalization);
+    words[WC_NORMALIZATION_KEY_SIZE + 1] = wc_float_bits(entry->error);
+    words[WC_NORMALIZATION_KEY_SIZE + 2] = entry->samples;
+    uint32_t checksum = wc_hash_words(words, WC_NORMALIZATION_KEY_SIZE + 3);
+    return checksum ? checksum : 1;
+}
+#endif
+
+// Looks up params->specular_normalization, normalization_error and
+// normalization_samples in the cache if write is 0, or stores them if
+// write is 1. Returns 1 if an entry was found or stored.
+static int normalization_cache(wcWeaveParameters *params, int write)
+{
+#ifdef WC_NO_FILES
+    (void)params; (void)write;
+    return 0;
+#else
+    const char *dir = params->normalization_cache_dir;
+    if(dir == 0){
+        dir = getenv("WC_NORMALIZATION_CACHE");
+    }
+    if(dir == 0 || dir[0] == 0){
+        return 0;
+    }
+    size_t dir_len = strlen(dir);
+    char *filename = (char*)malloc(dir_len
+        + sizeof(WC_NORMALIZATION_CACHE_FILE) + 1);
+    if(!filename){
+        return 0;
+    }
+    memcpy(filename, dir, dir_len);
+    filename[dir_len] = '/';
+    memcpy(filename + dir_len + 1, WC_NORMALIZATION_CACHE_FILE,
+        sizeof(WC_NORMALIZATION_CACHE_FILE));
+    wcMappedFile mapped;
+    int created;
+    uint8_t *data = (uint8_t*)wc_map_file(&mapped, filename,
+        WC_NORMALIZATION_CACHE_SIZE, &created);
+    free(filename);
+    if(!data){
+        return 0;
+    }
+
+    wcNormalizationCacheHeader *header = (wcNormalizationCacheHeader*)data;
+    wcNormalizationCacheEntry *entries =
+        (wcNormalizationCacheEntry*)(data + sizeof(*header));
+    if(created){
+        // The entries are already zero, i.e. empty
+        header->num_entries = WC_NORMALIZATION_CACHE_ENTRIES;
+        header->entry_size = sizeof(wcNormalizationCacheEntry);
+        memcpy(header->magic, "WCNC", 4);
+    }
+    if(memcmp(header->magic, "WCNC", 4) != 0
+            || header->num_entries != WC_NORMALIZATION_CACHE_ENTRIES
+            || header->entry_size != sizeof(wcNormalizationCacheEntry)){
+        // Being created by another process, or not a cache file
+        wc_unmap_file(&mapped);
+        return 0;
+    }
+
+    wcNormalizationCacheEntry entry;
+    normalization_cache_key(params, entry.key);
+    uint32_t home = wc_hash_words(entry.key, WC_NORMALIZATION_KEY_SIZE)
+        % WC_NORMALIZATION_CACHE_ENTRIES;
+    int found = 0;
+    uint32_t i;
+    for(i=0;i<WC_NORMALIZATION_CACHE_PROBES;i++){
+        wcNormalizationCacheEntry *e =
+            entries + (home + i) % WC_NORMALIZATION_CACHE_ENTRIES;
+        // Copy it first, another process might be writing it
+        wcNormalizationCacheEntry copy = *e;
+        int valid = copy.checksum != 0
+            && copy.checksum == normalization_cache_checksum(&copy);
+        int match = valid && memcmp(copy.key, entry.key,
+            sizeof(entry.key)) == 0;
+        if(!write && match){
+            params->specular_normalization = copy.normalization;
+            params->normalization_error = copy.error;
+            params->normalization_samples = copy.samples;
+            found = 1;
+            break;
+        }
+        if(write && (match || !valid || i == WC_NORMALIZATION_CACHE_PROBES-1)){
+            // Use the first free entry, or replace the last one probed
+            entry.normalization = params->specular_normalization;
+            entry.error = params->normalization_error;
+            entry.samples = params->normalization_samples;
+            entry.checksum = normalization_cache_checksum(&entry);
+            *e = entry;
+            found = 1;
+            break;
+        }
+    }
+    wc_unmap_file(&mapped);
+    return found;
+#endif
+}
+
+// -- Normalization table -- //
+// normalization_table.h holds the largest mean specular reflection, i.e.
+// 1/specular_normalization, precomputed by compute_specular_normalization
+// on a grid over (umax, alpha, beta, delta_x) for filament yarn and
+// (umax, psi, alpha, beta, delta_x) for staple yarn. It is interpolated
+// multilinearly. The grid and the measured interpolation error are in
+// the header, which is generated by tools/gen_normalization_table.
+
+#define WC_NORMALIZATION_TABLE_MAX_AXES 5
+
+typedef struct
+{
+    uint32_t num_axes;
+    const float *nodes[WC_NORMALIZATION_TABLE_MAX_AXES]; //Increasing
+    uint32_t size[WC_NORMALIZATION_TABLE_MAX_AXES];
+    const float *values; //Last axis varies fastest
+} wcNormalizationTable;
+
+// Interpolates table at x, which has one coordinate per axis. Returns -1
+// if x is outside of the table.
+WC_PREFIX
+static float normalization_table_lookup(const wcNormalizationTable *table,
+        const float *x)
+{
+    uint32_t index[WC_NORMALIZATION_TABLE_MAX_AXES];
+    float t[WC_NORMALIZATION_TABLE_MAX_AXES];
+    uint32_t a, corner;
+    for(a=0;a<table->num_axes;a++){
+        const float *nodes = table->nodes[a];
+        uint32_t n = table->size[a];
+        float c = x[a];
+        if(!(c >= nodes[0] && c <= nodes[n-1])){
+            return -1.f;
+        }
+        uint32_t i = 0;
+        while(i + 2 < n && c >= nodes[i+1]){
+            i++;
+        }
+        index[a] = i;
+        t[a] = (c - nodes[i])/(nodes[i+1] - nodes[i]);
+    }
+    float value = 0.f;
+    for(corner=0;corner<(1u<<table->num_axes);corner++){
+        float weight = 1.f;
+        uint32_t offset = 0;
+        for(a=0;a<table->num_axes;a++){
+            uint32_t upper = (corner >> a) & 1;
+            weight *= upper ? t[a] : 1.f - t[a];
+            offset = offset*table->size[a] + index[a] + upper;
+        }
+        if(weight > 0.f){
+            value += weight*table->values[offset];
+        }
+    }
+    return value;
+}
+
+WC_PREFIX
+static const wcNormalizationTable wc_normalization_table_filament = {
+    4,
+    {wc_normalization_table_umax, wc_normalization_table_alpha,
+     wc_normalization_table_beta, wc_normalization_table_delta_x},
+    {WC_NORMALIZATION_TABLE_UMAX_SIZE, WC_NORMALIZATION_TABLE_ALPHA_SIZE,
+     WC_NORMALIZATION_TABLE_BETA_SIZE, WC_NORMALIZATION_TABLE_DELTA_X_SIZE},
+    wc_normalization_table_filament_values
+};
+
+WC_PREFIX
+static const wcNormalizationTable wc_normalization_table_staple = {
+    5,
+    {wc_normalization_table_umax, wc_normalization_table_psi,
+     wc_normalization_table_alpha, wc_normalization_table_beta,
+     wc_normalization_table_delta_x},
+    {WC_NORMALIZATION_TABLE_UMAX_SIZE, WC_NORMALIZATION_TABLE_PSI_SIZE,
+     WC_NORMALIZATION_TABLE_ALPHA_SIZE, WC_NORMALIZATION_TABLE_BETA_SIZE,
+     WC_NORMALIZATION_TABLE_DELTA_X_SIZE},
+    wc_normalization_table_staple_values
+};
+
+// Converts the interpolated largest mean reflection to a normalization
+// factor, in the same way as compute_specular_normalization
+WC_PREFIX
+static float normalization_from_table_value(float value)
+{
+    if(value < 0.f){
+        return -1.f;
+    }
+    if(value*(float)WC_NORMALIZATION_DIRECTIONS <= 0.0001f){
+        return 0.f;
+    }
+    return 1.f/value;
+}
+
+WC_PREFIX
+float wcSpecularNormalizationFromTable(const wcWeaveParameters *params)
+{
+    if(params->psi <= 0.001f){
+        float x[4] = {params->umax, params->alpha, params->beta,
+            params->delta_x};
+        return normalization_from_table_value(normalization_table_lookup(
+            &wc_normalization_table_filament, x));
+    } else {
+        float x[5] = {params->umax, params->psi, params->alpha, params->beta,
+            params->delta_x};
+        return normalization_from_table_value(normalization_table_lookup(
+            &wc_normalization_table_staple, x));
+    }
+}
+
+// The parameters specular_normalization depends on, and whether it may
+// come from the table
+WC_PREFIX
+static void specular_normalization_key(const wcWeaveParameters *params,
+    float *key)
+{
+    key[0] = params->umax;
+    key[1] = params->psi;
+    key[2] = params->alpha;
+    key[3] = params->beta;
+    key[4] = params->delta_x;
+    key[5] = params->normalization_tolerance;
+    key[6] = (float)params->normalization_table;
+}
+
+// Sets params->specular_normalization from the table, stored (from a
+// compiled weave file, may be 0), the cache or by computing it. The cache
+// is only used while the pattern is loaded, i.e. if loading is 1, not by
+// wcUpdateWeaveParameters. There it is only set again if the parameters
+// it depends on have changed, so that parameters outside of the table are
+// not computed again for every update. Needs the compiled parameters.
+WC_PREFIX
+static void set_specular_normalization(wcWeaveParameters *params,
+    const wcNormalizationCacheEntry *stored, int loading)
+{
+    float key[7];
+    specular_normalization_key(params, key);
+    if(!loading && memcmp(key, params->compiled.specular_normalization_key,
+            sizeof(key)) == 0){
+        return;
+    }
+    memcpy(params->compiled.specular_normalization_key, key, sizeof(key));
+    if(params->normalization_table){
+        float normalization = wcSpecularNormalizationFromTable(params);
+        if(normalization >= 0.f){
+            params->specular_normalization = normalization;
+            params->normalization_error = 0.f;
+            params->normalization_samples = 0;
+            return;
+        }
+    }
+#ifndef WC_NO_FILES
+    if(stored && stored->checksum != 0
+            && stored->checksum == normalization_cache_checksum(stored)){
+        uint32_t key[WC_NORMALIZATION_KEY_SIZE];
+        normalization_cache_key(params, key);
+        if(memcmp(key, stored->key, sizeof(key)) == 0){
+            params->specular_normalization = stored->normalization;
+            params->normalization_error = stored->error;
+            params->normalization_samples = stored->samples;
+            return;
+        }
+    }
+#else
+    (void)stored;
+#endif
+    if(!loading){
+        compute_specular_normalization(params);
+    }else if(!normalization_cache(params, 0)){
+        compute_specular_normalization(params);
+        normalization_cache(params, 1);
+    }
+}
+
+WC_PREFIX
+static void finalize_weave_parmeters(wcWeaveParameters *params)
+{
+    params->pattern_mapping = 0;
+    compact_pattern(params);
+    if(params->pattern){
+        detect_regular_weave(params->pattern);
+    }
+    build_segment_table(params);
+    bake_yarn_variation(params);
+    // The normalization below needs the compiled parameters
+    compile_weave_parameters(params);
+
+    //Calculate normalization factor for the specular reflection
+    set_specular_normalization(params, 0, 1);
+    tabulate_specular_albedo(params);
+}
+
+WC_PREFIX
+void wcUpdateWeaveParameters(wcWeaveParameters *params)
+{
+    update_yarn_variation(params);
+    compile_weave_parameters(params);
+    set_specular_normalization(params, 0, 0);
+    if(specular_albedo_outdated(params)){
+        tabulate_specular_albedo(params);
+    }
+}
+
+
+WC_PREFIX
+static PackedPattern *build_pattern_from_data(uint8_t *warp_above,
+        float *warp_color, float *weft_color, uint32_t w, uint32_t h)
+{
+    uint32_t x,y;
+    PackedPattern *pattern;
+    //Palette entry 0 is the warp color, 1 is the weft color
+    pattern = wif_alloc_pattern(w,h,2);
+    if(pattern){
+        memcpy(pattern->palette,     warp_color, 3*sizeof(float));
+        memcpy(pattern->palette + 3, weft_color, 3*sizeof(float));
+        for(y=0;y<h;y++){
+            for(x=0;x<w;x++){
+                uint8_t a = warp_above[x+y*w] ? 1 : 0;
+                wif_pattern_set(pattern,x,y,a,a ? 0 : 1);
+            }
+        }
+    }
+    return pattern;
+}
+
+#ifndef WC_NO_FILES
+
+WC_PREFIX
+static char * find_next_newline(char * buffer)
+{
+    char *r = buffer;
+    while(*r != 0 && *r != '\n'){
+        r++;
+    }
+    return r;
+}
+
+WC_PREFIX
+static char * read_color_from_weave_string(char *string, float * color)
+{
+    char *s = string;
+    for(int i=0;i<3;i++){
+        int a = atoi(s);
+        s = find_next_newline(s+1);
+        color[i] = (float)a/255.f;
+    }
+    return find_next_newline(find_next_newline(s)+1)+1;
+}
+
+WC_PREFIX
+static char * read_dimensions_from_weave_string(char *string,
+        float * thicknessw, float * thicknessh)
+{
+    char *s = string;
+    
+    *thicknessw = (float)str2d(s);
+    s = find_next_newline(s+1);
+    *thicknessh = (float)str2d(s);
+    s = find_next_newline(s+1);
+    
+    return find_next_newline(find_next_newline(s)+1)+1;
+}
+
+
+WC_PREFIX
+static void read_pattern_from_weave_string(char * s, uint32_t *pattern_width,
+    uint32_t *pattern_height, float *pattern_realwidth,
+    float *pattern_realheight, PackedPattern **pattern)
+{
+    //A Weave file has 2-three sets of color
+    //2-two sets of thickness and spacing in cm
+    //a pattern matrix
+
+    float warp_color[3], weft_color[3], 
+          warp_thickness, weft_thickness;
+    s = read_color_from_weave_string(s,warp_color);
+    s = read_color_from_weave_string(s,weft_color);
+    s = read_dimensions_from_weave_string(s, &warp_thickness, &weft_thickness);
+
+    char * t = find_next_newline(s);
+    *pattern_width = t - s;
+    int i = 0;
+    int num_chars = 0;
+    while(s[i] != 0) {
+        if(s[i] == '0' || s[i] == '1'){
+            num_chars++;
+        }
+        i++;
+    }
+    *pattern_height = num_chars/(*pattern_width);
+    //Palette entry 0 is the warp color, 1 is the weft color
+    *pattern = wif_alloc_pattern(*pattern_width,*pattern_height,2);
+    
+    *pattern_realwidth = REALWORLD_UV_WIF_TO_MM
+        * (*pattern_width * (warp_thickness)); 
+    *pattern_realheight = REALWORLD_UV_WIF_TO_MM
+        * (*pattern_height * (weft_thickness)); 
+   
+    if(*pattern == 0){
+        return;
+    }
+    memcpy((*pattern)->palette,     warp_color, 3*sizeof(float));
+    memcpy((*pattern)->palette + 3, weft_color, 3*sizeof(float));
+    
+    i = 0;
+    uint32_t ii = 0;
+    while(s[i] != 0 && ii < *pattern_width * *pattern_height) {
+        if(s[i] == '0' || s[i] == '1'){
+            uint8_t warp_above = s[i] == '1';
+            wif_pattern_set(*pattern, ii % *pattern_width,
+                ii / *pattern_width, warp_above, warp_above ? 0 : 1);
+            ii++;
+        }
+        i++;
+    }
+}
+
+WC_PREFIX
+void wcWeavePatternFromFile(wcWeaveParameters *params, const char *filename)
+{
+    if(strlen(filename) > 7
+            && strcmp(filename+strlen(filename)-7,".cweave") == 0){
+        wcWeavePatternFromCompiledWeave(params,filename);
+    }else if(strlen(filename) > 4){
+        if(strcmp(filename+strlen(filename)-4,".wif") == 0){
+            wcWeavePatternFromWIF(params,filename);
+        } else {
+            wcWeavePatternFromWeaveFile(params,filename);
+        }
+    }else{
+        params->pattern_height = params->pattern_width = 0;
+        params->pattern = 0;
+        params->segment_entry = 0;
+        params->yarnvar_table = 0;
+    }
+}
+
+WC_PREFIX
+void wcWeavePatternFromFile_wchar(wcWeaveParameters *params,
+    const wchar_t *filename)
+{
+    if(wcslen(filename) > 7
+            && wcscmp(filename+wcslen(filename)-7,L".cweave") == 0){
+        wcWeavePatternFromCompiledWeave_wchar(params,filename);
+    }else if(wcslen(filename) > 4){
+        if(wcscmp(filename+wcslen(filename)-4,L".wif") == 0){
+            wcWeavePatternFromWIF_wchar(params,filename);
+        } else {
+            wcWeavePatternFromWeaveFile_wchar(params,filename);
+        }
+    }else{
+        params->pattern_height = params->pattern_width = 0;
+        params->pattern = 0;
+        params->segment_entry = 0;
+        params->yarnvar_table = 0;
+    }
+}
+
+// Sets the pattern from a WIF file, implicitly if a dense pattern would
+// be larger than implicit_pattern_threshold
+WC_PREFIX
+static void weave_pattern_from_weave_data(wcWeaveParameters *params,
+    WeaveData *data)
+{
+    PackedPattern layout;
+    memset(&layout, 0, sizeof(layout));
+    layout.width = data->warp.num_threads;
+    layout.height = data->weft.num_threads;
+    layout.repeat_width = layout.width;
+    layout.repeat_height = layout.height;
+    layout.words_per_row = (layout.width + 63)/64;
+    layout.words_per_column = (layout.height + 63)/64;
+    layout.num_rows = layout.height;
+    layout.num_columns = layout.width;
+    // At most, since only the colors in use end up in the palette
+    layout.color_index_size = wif_color_index_size(data->num_colors);
+    if(params->implicit_pattern_threshold > 0
+            && (uint64_t)wif_pattern_memory(&layout)
+                > ((uint64_t)params->implicit_pattern_threshold << 20)){
+        params->pattern = wif_get_implicit_pattern(data,
+            &params->pattern_width, &params->pattern_height,
+            &params->pattern_realwidth, &params->pattern_realheight);
+    }else{
+        params->pattern = wif_get_pattern(data,
+            &params->pattern_width, &params->pattern_height,
+            &params->pattern_realwidth, &params->pattern_realheight);
+    }
+    wif_free_weavedata(data);
+    finalize_weave_parmeters(params);
+}
+
+WC_PREFIX
+void wcWeavePatternFromWIF(wcWeaveParameters *params, const char *filename)
+{
+    weave_pattern_from_weave_data(params, wif_read(filename));
+}
+
+WC_PREFIX
+void wcWeavePatternFromWIF_wchar(wcWeaveParameters *params,
+        const wchar_t *filename)
+{
+    weave_pattern_from_weave_data(params, wif_read_wchar(filename));
+}
+
+WC_PREFIX
+static void weave_pattern_from_weave_file(wcWeaveParameters *params,
+    FILE *f)
+{
+    fseek (f , 0 , SEEK_END);
+    long lSize = ftell (f);
+    rewind (f);
+    char *buffer = (char*) calloc (lSize+1,sizeof(char));
+    if (buffer == NULL) {fputs ("Memory error",stderr); exit (2);}
+    fread (buffer,1,lSize,f);
+    read_pattern_from_weave_string(buffer, 
+            &params->pattern_width, &params->pattern_height,
+            &params->pattern_realwidth, &params->pattern_realheight,
+            &params->pattern);
+    finalize_weave_parmeters(params);
+}
+
+WC_PREFIX
+void wcWeavePatternFromWeaveFile(wcWeaveParameters *params,
+    const char *filename)
+{
+    FILE *f = fopen(filename,"rt");
+    if(f){
+        weave_pattern_from_weave_file(params,f);
+        fclose(f);
+    }else{
+        params->pattern_width = params->pattern_height = 0;
+        params->pattern = 0;
+        params->segment_entry = 0;
+        params->yarnvar_table = 0;
+    }
+}
+
+WC_PREFIX
+void wcWeavePatternFromWeaveFile_wchar(wcWeaveParameters *params,
+    const wchar_t *filename)
+{
+#ifdef _WIN32
+    FILE *f = _wfopen(filename, L"rt");
+    if(f){
+        weave_pattern_from_weave_file(params,f);
+        fclose(f);
+    }else{
+        params->pattern_width = params->pattern_height = 0;
+		params->pattern = 0;
+		params->segment_entry = 0;
+		params->yarnvar_table = 0;
+    }
+#endif
+}
+
+// -- Compiled weave files -- //
+// A pattern as it is laid out in memory, so that it can be memory mapped
+// instead of parsed. The file starts with a wcCompiledWeaveHeader. Only
+// the repeat of the pattern is stored (see compact_pattern). The
+// warp_above bitplane, its transpose, the palette, the color indices and
+// optionally the segment table follow in that order at data_offset. The
+// palette always has WIF_NARROW_PALETTE_SIZE entries with 8 bit color
+// indices and WIF_MAX_PALETTE_SIZE with 16 bit ones, so that no color
+// index can be out of range, and the segment table starts on a multiple
+// of 8 bytes. The loader checks the dimensions in the header, and that
+// the parts they imply fit in the file, before anything in it is used.
+// The segment entries are only used as step counts, so with those checks
+// a broken file can't make the shading read outside of it, and the data
+// itself doesn't have to be checked. The header also holds the specular
+// normalization for the parameters the file was written with, which is
+// used if they and the SIMD width are the same when it is loaded. The file
+// is in the byte order of the machine which wrote it, and is not loaded on
+// others.
+
+#define WC_COMPILED_WEAVE_VERSION 3
+#define WC_COMPILED_WEAVE_BYTE_ORDER 0x01020304
+#define WC_COMPILED_WEAVE_ALIGNMENT 64
+
+typedef struct
+{
+    char magic[4]; //"WCCW"
+    uint32_t version;
+    uint32_t byte_order; //WC_COMPILED_WEAVE_BYTE_ORDER
+    uint32_t data_offset; //Multiple of WC_COMPILED_WEAVE_ALIGNMENT
+    uint64_t data_size;
+    uint32_t width, height;
+    uint32_t repeat_width, repeat_height;
+    uint32_t words_per_row, words_per_column; //Of the repeat
+    uint32_t num_colors;
+    uint32_t color_index_size; //1 or 2, as in PackedPattern
+    uint32_t segment_table; //1 if the segment table is stored
+    float realwidth, realheight;
+    wcNormalizationCacheEntry normalization; //checksum is 0 if not stored
+} wcCompiledWeaveHeader;
+
+// A mapped pattern is allocated as one of these, so that freeing the
+// pattern frees the rest too
+typedef struct
+{
+    PackedPattern pattern;
+    wcMappedFile file;
+    const wcSegmentEntry *segment_entry; //In the mapping, or 0
+} wcMappedPattern;
+
+// Entries in the palette of a compiled weave
+static uint32_t compiled_weave_palette_size(
+    const wcCompiledWeaveHeader *header)
+{
+    return header->color_index_size == 1 ? WIF_NARROW_PALETTE_SIZE
+        : WIF_MAX_PALETTE_SIZE;
+}
+
+// Offsets of the parts of the data of a pattern with the dimensions in
+// header, from data_offset. Returns the size of the data.
+static uint64_t compiled_weave_layout(const wcCompiledWeaveHeader *header,
+    uint64_t *columns, uint64_t *palette, uint64_t *color_index,
+    uint64_t *segment_entry)
+{
+    uint64_t num = (uint64_t)header->repeat_width*header->repeat_height;
+    *columns = (uint64_t)header->words_per_row*header->repeat_height
+        *sizeof(uint64_t);
+    *palette = *columns + (uint64_t)header->words_per_column
+        *header->repeat_width*sizeof(uint64_t);
+    *color_index = *palette
+        + (uint64_t)compiled_weave_palette_size(header)*3*sizeof(float);
+    uint64_t end = *color_index + num*header->color_index_size;
+    *segment_entry = (end + 7)/8*8;
+    if(header->segment_table){
+        end = *segment_entry + num*sizeof(wcSegmentEntry);
+    }
+    return end;
+}
+
+static void weave_pattern_from_compiled_weave(wcWeaveParameters *params,
+    const char *filename, const wchar_t *filename_wchar)
+{
+    params->pattern_width = params->pattern_height = 0;
+    params->pattern = 0;
+    params->pattern_mapping = 0;
+    params->segment_entry = 0;
+    params->yarnvar_table = 0;
+    wcMappedPattern *mapped = (wcMappedPattern*)calloc(1,
+        sizeof(wcMappedPattern));
+    if(!mapped){
+        return;
+    }
+    size_t size;
+    const uint8_t *data = (const uint8_t*)wc_map_file_read(&mapped->file,
+        filename, filename_wchar, &size);
+    if(!data){
+        free(mapped);
+        return;
+    }
+    wcCompiledWeaveHeader header;
+    uint64_t columns, palette, color_index, segment_entry;
+    int valid = size >= sizeof(header);
+    if(valid){
+        memcpy(&header, data, sizeof(header));
+        valid = memcmp(header.magic, "WCCW", 4) == 0
+            && header.version == WC_COMPILED_WEAVE_VERSION
+            && header.byte_order == WC_COMPILED_WEAVE_BYTE_ORDER
+            && header.data_offset >= sizeof(header)
+            && header.data_offset % WC_COMPILED_WEAVE_ALIGNMENT == 0
+            && header.width > 0 && header.height > 0
+            && header.repeat_width > 0 && header.repeat_height > 0
+            && header.width % header.repeat_width == 0
+            && header.height % header.repeat_height == 0
+            && header.words_per_row == (header.repeat_width + 63)/64
+            && header.words_per_column == (header.repeat_height + 63)/64
+            && header.num_colors > 0
+            && header.num_colors <= WIF_MAX_PALETTE_SIZE
+            && header.color_index_size
+                == wif_color_index_size(header.num_colors)
+            // As in build_segment_table, so that the entries fit in 16 bits
+            && (header.segment_table == 0 || (header.segment_table == 1
+                && (uint64_t)header.width + header.height
+                    < WC_SEGMENT_TABLE_MAX_SIZE))
+            // Every element takes at least a byte, so this keeps the
+            // layout below from overflowing
+            && (uint64_t)header.repeat_width*header.repeat_height
+                <= (uint64_t)size
+            && header.data_size == compiled_weave_layout(&header, &columns,
+                &palette, &color_index, &segment_entry)
+            && header.data_size <= (uint64_t)size
+            && header.data_offset + header.data_size <= (uint64_t)size;
+    }
+    if(!valid){
+        wc_unmap_file(&mapped->file);
+        free(mapped);
+        return;
+    }
+    // The mapping is read only, but nothing writes to a loaded pattern
+    uint8_t *p = (uint8_t*)data + header.data_offset;
+    PackedPattern *pattern = &mapped->pattern;
+    pattern->width = header.width;
+    pattern->height = header.height;
+    pattern->repeat_width = header.repeat_width;
+    pattern->repeat_height = header.repeat_height;
+    pattern->words_per_row = header.words_per_row;
+    pattern->words_per_column = header.words_per_column;
+    pattern->num_colors = header.num_colors;
+    pattern->color_index_size = header.color_index_size;
+    pattern->num_rows = header.repeat_height;
+    pattern->num_columns = header.repeat_width;
+    pattern->warp_above = (uint64_t*)p;
+    pattern->warp_above_columns = (uint64_t*)(p + columns);
+    pattern->palette = (float*)(p + palette);
+    pattern->color_index = p + color_index;
+    if(header.segment_table){
+        mapped->segment_entry = (const wcSegmentEntry*)(p + segment_entry);
+    }
+
+    params->pattern = pattern;
+    params->pattern_width = header.width;
+    params->pattern_height = header.height;
+    params->pattern_realwidth = header.realwidth;
+    params->pattern_realheight = header.realheight;
+    // As finalize_weave_parmeters, but with the stored segment table and
+    // normalization
+    detect_regular_weave(pattern);
+    if(mapped->segment_entry && !pattern->regular.repeat
+            && params->segment_lookup == WC_SEGMENT_TABLE){
+        params->segment_entry = (wcSegmentEntry*)mapped->segment_entry;
+    }else{
+        build_segment_table(params);
+    }
+    bake_yarn_variation(params);
+    compile_weave_parameters(params);
+    set_specular_normalization(params, &header.normalization, 1);
+    tabulate_specular_albedo(params);
+    params->pattern_mapping = &mapped->file;
+}
+
+// Returns 1 if segment_entry is in the file pattern is mapped from
+static int segment_entry_is_mapped(const wcWeaveParameters *params)
+{
+    return params->pattern && params->pattern_mapping
+        && params->segment_entry
+            == ((const wcMappedPattern*)params->pattern)->segment_entry;
+}
+
+WC_PREFIX
+void wcWeavePatternFromCompiledWeave(wcWeaveParameters *params,
+    const char *filename)
+{
+    weave_pattern_from_compiled_weave(params, filename, 0);
+}
+
+WC_PREFIX
+void wcWeavePatternFromCompiledWeave_wchar(wcWeaveParameters *params,
+    const wchar_t *filename)
+{
+    weave_pattern_from_compiled_weave(params, 0, filename);
+}
+
+// Writes size zero bytes to f, returns 0 if that fails
+static int write_zeros(FILE *f, size_t size)
+{
+    static const uint8_t zeros[4096] = {0};
+    while(size > 0){
+        size_t n = size < sizeof(zeros) ? size : sizeof(zeros);
+        if(fwrite(zeros, 1, n, f) != n){
+            return 0;
+        }
+        size -= n;
+    }
+    return 1;
+}
+
+WC_PREFIX
+int wcWriteCompiledWeave(const wcWeaveParameters *params,
+    const char *filename)
+{
+    const PackedPattern *pattern = params->pattern;
+    if(!pattern || pattern->row_index){
+        return 0;
+    }
+    wcCompiledWeaveHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "WCCW", 4);
+    header.version = WC_COMPILED_WEAVE_VERSION;
+    header.byte_order = WC_COMPILED_WEAVE_BYTE_ORDER;
+    header.data_offset = (sizeof(header) + WC_COMPILED_WEAVE_ALIGNMENT - 1)
+        / WC_COMPILED_WEAVE_ALIGNMENT * WC_COMPILED_WEAVE_ALIGNMENT;
+    header.width = pattern->width;
+    header.height = pattern->height;
+    header.repeat_width = pattern->repeat_width;
+    header.repeat_height = pattern->repeat_height;
+    header.words_per_row = pattern->words_per_row;
+    header.words_per_column = pattern->words_per_column;
+    header.num_colors = pattern->num_colors;
+    header.color_index_size = pattern->color_index_size;
+    header.segment_table = params->segment_entry != 0;
+    uint64_t columns, palette, color_index, segment_entry;
+    header.data_size = compiled_weave_layout(&header, &columns, &palette,
+        &color_index, &segment_entry);
+    header.realwidth = params->pattern_realwidth;
+    header.realheight = params->pattern_realheight;
+    // One from the table would be wrong for a load without the table
+    if(params->normalization_samples != 0){
+        wcNormalizationCacheEntry *entry = &header.normalization;
+        normalization_cache_key(params, entry->key);
+        entry->normalization = params->specular_normalization;
+        entry->error = params->normalization_error;
+        entry->samples = params->normalization_samples;
+        entry->checksum = normalization_cache_checksum(entry);
+    }
+
+    FILE *f = fopen(filename, "wb");
+    if(!f){
+        return 0;
+    }
+    size_t num = (size_t)pattern->repeat_width*pattern->repeat_height;
+    size_t index_bytes = num*pattern->color_index_size;
+    size_t num_rows = (size_t)pattern->words_per_row*pattern->repeat_height;
+    size_t num_columns = (size_t)pattern->words_per_column
+        *pattern->repeat_width;
+    int ok = fwrite(&header, sizeof(header), 1, f) == 1
+        && write_zeros(f, header.data_offset - sizeof(header))
+        && fwrite(pattern->warp_above, sizeof(uint64_t), num_rows, f)
+            == num_rows
+        && fwrite(pattern->warp_above_columns, sizeof(uint64_t),
+            num_columns, f) == num_columns
+        && fwrite(pattern->palette, 3*sizeof(float), pattern->num_colors, f)
+            == pattern->num_colors
+        && write_zeros(f, (size_t)(compiled_weave_palette_size(&header)
+            - pattern->num_colors)*3*sizeof(float))
+        && fwrite(pattern->color_index, 1, index_bytes, f) == index_bytes;
+    if(ok && header.segment_table){
+        ok = write_zeros(f, (size_t)(segment_entry - color_index)
+                - index_bytes)
+            && fwrite(params->segment_entry, sizeof(wcSegmentEntry), num, f)
+                == num;
+    }
+    if(fclose(f) != 0){
+        ok = 0;
+    }
+    return ok;
+}
+
+// -- Asynchronous loading -- //
+struct wcWeavePatternLoad
+{
+    wcWeaveParameters *params;
+    char *filename; //One of these is set
+    wchar_t *filename_wchar;
+    int provisional;
+    wcEvent ready; //Set when params can be used
+    wcThread thread;
+    // The computed normalization, when a provisional one was used
+    int has_normalization;
+    float normalization, normalization_error;
+    uint32_t normalization_samples;
+    float normalization_key[7];
+};
+
+static void weave_pattern_load_job(void *arg)
+{
+    wcWeavePatternLoad *load = (wcWeavePatternLoad*)arg;
+    wcWeaveParameters *params = load->params;
+    uint8_t normalization_table = params->normalization_table;
+    if(load->provisional){
+        params->normalization_table = 1;
+    }
+    if(load->filename){
+        wcWeavePatternFromFile(params, load->filename);
+    }else{
+        wcWeavePatternFromFile_wchar(params, load->filename_wchar);
+    }
+    params->normalization_table = normalization_table;
+    // normalization_samples is 0 if it came from the table
+    load->has_normalization = load->provisional && !normalization_table
+        && params->pattern && params->normalization_samples == 0;
+    // params belongs to the caller once it is ready, so compute the
+    // normalization on a copy
+    wcWeaveParameters copy = *params;
+    wc_event_set(&load->ready);
+    if(load->has_normalization){
+        set_specular_normalization(&copy, 0, 1);
+        load->normalization = copy.specular_normalization;
+        load->normalization_error = copy.normalization_error;
+        load->normalization_samples = copy.normalization_samples;
+        memcpy(load->normalization_key,
+            copy.compiled.specular_normalization_key,
+            sizeof(load->normalization_key));
+    }
+}
+
+static wcWeavePatternLoad *weave_pattern_load_start(
+    wcWeaveParameters *params, char *filename, wchar_t *filename_wchar,
+    int provisional)
+{
+    wcWeavePatternLoad *load =
+        (wcWeavePatternLoad*)calloc(1, sizeof(wcWeavePatternLoad));
+    if(!load || (!filename && !filename_wchar)){
+        free(load);
+        free(filename);
+        free(filename_wchar);
+        return 0;
+    }
+    load->params = params;
+    load->filename = filename;
+    load->filename_wchar = filename_wchar;
+    load->provisional = provisional;
+    wc_event_init(&load->ready);
+    wc_thread_start(&load->thread, weave_pattern_load_job, load);
+    return load;
+}
+
+WC_PREFIX
+wcWeavePatternLoad *wcWeavePatternFromFileAsync(wcWeaveParameters *params,
+    const char *filename, int provisional)
+{
+    size_t size = (strlen(filename) + 1)*sizeof(char);
+    char *copy = (char*)malloc(size);
+    if(copy){
+        memcpy(copy, filename, size);
+    }
+    wcWeavePatternLoad *load = weave_pattern_load_start(params, copy, 0,
+        provisional);
+    if(!load){
+        wcWeavePatternFromFile(params, filename);
+    }
+    return load;
+}
+
+WC_PREFIX
+wcWeavePatternLoad *wcWeavePatternFromFileAsync_wchar(
+    wcWeaveParameters *params, const wchar_t *filename, int provisional)
+{
+    size_t size = (wcslen(filename) + 1)*sizeof(wchar_t);
+    wchar_t *copy = (wchar_t*)malloc(size);
+    if(copy){
+        memcpy(copy, filename, size);
+    }
+    wcWeavePatternLoad *load = weave_pattern_load_start(params, 0, copy,
+        provisional);
+    if(!load){
+        wcWeavePatternFromFile_wchar(params, filename);
+    }
+    return load;
+}
+
+WC_PREFIX
+int wcWeavePatternReady(wcWeavePatternLoad *load)
+{
+    return load == 0 || wc_event_is_set(&load->ready);
+}
+
+WC_PREFIX
+void wcWaitForWeavePattern(wcWeavePatternLoad *load)
+{
+    if(load){
+        wc_event_wait(&load->ready);
+    }
+}
+
+WC_PREFIX
+void wcFinishWeavePattern(wcWeavePatternLoad *load)
+{
+    if(!load){
+        return;
+    }
+    wc_thread_join(&load->thread);
+    if(load->has_normalization){
+        load->params->specular_normalization = load->normalization;
+        load->params->normalization_error = load->normalization_error;
+        load->params->normalization_samples = load->normalization_samples;
+        memcpy(load->params->compiled.specular_normalization_key,
+            load->normalization_key, sizeof(load->normalization_key));
+    }
+    wc_event_destroy(&load->ready);
+    free(load->filename);
+    free(load->filename_wchar);
+    free(load);
+}
+#endif
+
+WC_PREFIX
+void wcWeavePatternFromData(wcWeaveParameters *params, uint8_t *pattern,
+    float *warp_color, float *weft_color, uint32_t pattern_width,
+    uint32_t pattern_height)
+{
+    params->pattern_width  = pattern_width;
+    params->pattern_height = pattern_height;
+    params->pattern = build_pattern_from_data(pattern,
+            warp_color, weft_color, pattern_width, pattern_height);
+    finalize_weave_parmeters(params);
+}
+
+WC_PREFIX
+void wcWeavePatternRegular(wcWeaveParameters *params, uint32_t repeat,
+    uint32_t shift, uint32_t floats, float *warp_color, float *weft_color)
+{
+    uint32_t x, y;
+    params->pattern_width  = repeat;
+    params->pattern_height = repeat;
+    params->pattern = wif_alloc_pattern(repeat, repeat, 2);
+    if(params->pattern){
+        //Palette entry 0 is the warp color, 1 is the weft color
+        memcpy(params->pattern->palette,     warp_color, 3*sizeof(float));
+        memcpy(params->pattern->palette + 3, weft_color, 3*sizeof(float));
+        for(y=0;y<repeat;y++){
+            for(x=0;x<repeat;x++){
+                uint8_t a = (shift*x + y) % repeat < floats;
+                wif_pattern_set(params->pattern, x, y, a, a ? 0 : 1);
+            }
+        }
+    }
+    finalize_weave_parmeters(params);
+}
+
+WC_PREFIX
+void wcFreeWeavePattern(wcWeaveParameters *params)
+{
+    if(params->segment_entry){
+#ifndef WC_NO_FILES
+        // It may be in the mapped file, which is unmapped below
+        if(!segment_entry_is_mapped(params)){
+            free(params->segment_entry);
+        }
+#else
+        free(params->segment_entry);
+#endif
+        params->segment_entry = 0;
+    }
+    if(params->pattern){
+#ifndef WC_NO_FILES
+        if(params->pattern_mapping){
+            wc_unmap_file((wcMappedFile*)params->pattern_mapping);
+            params->pattern_mapping = 0;
+        }
+#endif
+        free(params->pattern);
+        params->pattern = 0;
+    }
+    if(params->yarnvar_table){
+        free(params->yarnvar_table);
+        params->yarnvar_table = 0;
+    }
+}
+
+// Only used when intensity_fineness >= 0.001, the variation is 1 otherwise
+// hash is WC_INTENSITY_TEA or WC_INTENSITY_MIX. It is passed separately so
+// that the specialized kernels can make it a constant.
+WC_PREFIX
+static inline float intensityVariation(wcPatternData pattern_data,
+    const wcWeaveParameters *params, uint8_t hash)
+{
+    // have index to make a grid of finess*fineness squares 
+    // of which to have the same brightness variations.
+
+    uint32_t tindex_x = pattern_data.total_index_x;
+    uint32_t tindex_y = pattern_data.total_index_y;
+
+    //Switch X and Y for warp, so that we have the yarn going along y
+    if(!pattern_data.warp_above){
+        float tmp = tindex_x;
+        tindex_x = tindex_y;
+        tindex_y = tmp;
+    }
+
+    //segment start x,y
+    float centerx = tindex_x - (pattern_data.x*0.5f)*pattern_data.width;
+    float centery = tindex_y - (pattern_data.y*0.5f)*pattern_data.length;
+    
+    uint32_t r1 = (uint32_t) ((centerx + tindex_x) 
+            * params->intensity_fineness);
+    uint32_t r2 = (uint32_t) ((centery + tindex_y) 
+            * params->intensity_fineness);
+    
+    float xi = hash == WC_INTENSITY_MIX ? sampleMixSingle(r1, r2)
+        : sampleTEASingle(r1, r2, 8);
+    float log_xi = -logf(xi);
+    return log_xi < 10.f ? log_xi : 10.f;
+}
+
+WC_PREFIX
+static float yarnVariation(wcPatternData pattern_data, 
+        const wcWeaveParameters *params)
+{
+
+    float variation = 1.f;
+
+    uint32_t tindex_x = pattern_data.total_index_x;
+    uint32_t tindex_y = pattern_data.total_index_y;
+
+    //Switch X and Y for warp, so that we have the yarn going along y
+    if(!pattern_data.warp_above){
+        float tmp = tindex_x;
+        tindex_x = tindex_y;
+        tindex_y = tmp;
+    }
+
+    //We want to vary the intesity along the yarn.
+    //For a parallel yarn we want a diffrent variation. 
+    //Use a large xscale to make the values different.
+
+    float amplitude = params->yarnvar_amplitude;
+    float xscale = params->yarnvar_xscale;
+    float yscale = params->yarnvar_yscale;
+    int octaves = params->yarnvar_octaves;
+    float persistance = params->yarnvar_persistance; //paramter
+
+    float x_noise = (tindex_x/(float)params->pattern_width) * xscale;
+    //NOTE(Vidar): Should it really be pattern_width here too? Ask Peter...
+    float y_noise = (tindex_y + (pattern_data.y/2.f + 0.5))
+        /(float)params->pattern_width * yscale;
+
+    variation = octavePerlin2f(x_noise, y_noise,
+            octaves, persistance) * amplitude + 1.f;
+
+    return wcClamp(variation, 0.f, 1.f);
+
+    //NOTE(Peter): Right now there is perlin on both warp and weft.
+    //Would be useful to specify only warp or weft. Or even better, 
+    //if a yarn_type definition is made, 
+    // define noise parmeters for a certain yarn. along with other 
+    // yarn properties.
+}
+
+// yarnVariation using the table from bake_yarn_variation. The noise is
+// interpolated linearly between the samples.
+WC_PREFIX
+static float yarnVariationBaked(wcPatternData pattern_data,
+        const wcWeaveParameters *params)
+{
+    uint32_t tindex_x = pattern_data.total_index_x;
+    uint32_t tindex_y = pattern_data.total_index_y;
+
+    //Switch X and Y for warp, so that we have the yarn going along y
+    if(!pattern_data.warp_above){
+        uint32_t tmp = tindex_x;
+        tindex_x = tindex_y;
+        tindex_y = tmp;
+    }
+
+    uint32_t yarns = params->compiled.yarnvar_table_yarns;
+    uint32_t samples = params->compiled.yarnvar_table_samples;
+    const float *curve = params->yarnvar_table + (tindex_x % yarns)*samples;
+    float position = ((float)(tindex_y % yarns)
+        + (pattern_data.y/2.f + 0.5f))
+        * (float)params->yarnvar_bake_resolution;
+    uint32_t i = (uint32_t)position;
+    float t = position - (float)i;
+    i = i < samples ? i : samples - 1;
+    uint32_t next = i + 1 < samples ? i + 1 : i;
+    float noise = curve[i] + t*(curve[next] - curve[i]);
+
+    float variation = noise * params->yarnvar_amplitude + 1.f;
+    return wcClamp(variation, 0.f, 1.f);
+}
+
+WC_PREFIX
+static uint32_t wcCountTrailingZeros(uint64_t x)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (uint32_t)index;
+#elif defined(__GNUC__)
+    return (uint32_t)__builtin_ctzll(x);
+#else
+    uint32_t n = 0;
+    while(!(x & 1)){
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+WC_PREFIX
+static uint32_t wcCountLeadingZeros(uint64_t x)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, x);
+    return 63 - (uint32_t)index;
+#elif defined(__GNUC__)
+    return (uint32_t)__builtin_clzll(x);
+#else
+    uint32_t n = 0;
+    while(!(x & ((uint64_t)1 << 63))){
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+// Returns word i of a row or column of the bitplane, with the bits set
+// where warp_above differs from the given state. Padding bits are cleared.
+WC_PREFIX
+static uint64_t bitboard_diff_word(const uint64_t *line, uint32_t i,
+    uint32_t num_words, uint32_t num, uint8_t warp_above)
+{
+    uint64_t diff = warp_above ? ~line[i] : line[i];
+    if(i == num_words - 1 && (num & 63)){
+        diff &= ((uint64_t)1 << (num & 63)) - 1;
+    }
+    return diff;
+}
+
+// Finds the extent of the segment around element pos of a row or column
+// of num elements, using the bitplane words of that line. Like walking the
+// pattern element by element, the search wraps around the edges, and if the
+// line is a single segment both steps_left and steps_right are num.
+WC_PREFIX
+static void calculateLengthOfSegment(const uint64_t *line, uint32_t num,
+    uint32_t pos, uint8_t warp_above, uint32_t *steps_left,
+    uint32_t *steps_right)
+{
+    uint32_t num_words = (num + 63)/64;
+    uint32_t i;
+    uint64_t diff;
+
+    //Search for the closest differing element to the right of pos...
+    *steps_right = num;
+    i = pos >> 6;
+    diff = bitboard_diff_word(line, i, num_words, num, warp_above)
+        & ~(((uint64_t)2 << (pos & 63)) - 1);
+    for(;;){
+        if(diff){
+            *steps_right = i*64 + wcCountTrailingZeros(diff) - pos - 1;
+            break;
+        }
+        if(++i == num_words){
+            break;
+        }
+        diff = bitboard_diff_word(line, i, num_words, num, warp_above);
+    }
+    if(*steps_right == num){
+        //...wrapping around to the beginning of the line
+        for(i=0;i<=(pos >> 6);i++){
+            diff = bitboard_diff_word(line, i, num_words, num, warp_above);
+            if(diff){
+                *steps_right = i*64 + wcCountTrailingZeros(diff) + num
+                    - pos - 1;
+                break;
+            }
+        }
+    }
+
+    //Search for the closest differing element to the left of pos...
+    *steps_left = num;
+    i = pos >> 6;
+    diff = bitboard_diff_word(line, i, num_words, num, warp_above)
+        & (((uint64_t)1 << (pos & 63)) - 1);
+    for(;;){
+        if(diff){
+            *steps_left = pos - (i*64 + 63 - wcCountLeadingZeros(diff)) - 1;
+            break;
+        }
+        if(i-- == 0){
+            break;
+        }
+        diff = bitboard_diff_word(line, i, num_words, num, warp_above);
+    }
+    if(*steps_left == num){
+        //...wrapping around to the end of the line
+        for(i=num_words;i-- > (pos >> 6);){
+            diff = bitboard_diff_word(line, i, num_words, num, warp_above);
+            if(diff){
+                *steps_left = pos + num
+                    - (i*64 + 63 - wcCountLeadingZeros(diff)) - 1;
+                break;
+            }
+        }
+    }
+}
+
+WC_PREFIX
+static float vonMises(float cos_x, float b, float normalization) {
+    // assumes a = 0, b > 0 is a concentration parameter.
+    // normalization is 1/(2*pi*besselI0(b))
+    return expf(b * cos_x) * normalization;
+}
+
+// wcGetPatternData for a valid pattern
+WC_PREFIX
+static inline wcPatternData get_pattern_data(float uv_x, float uv_y,
+        const wcWeaveParameters *params)
+{
+    float u_scale = params->compiled.u_scale;
+    float v_scale = params->compiled.v_scale;
+    float u_repeat = fmod(uv_x*u_scale,1.f);
+    float v_repeat = fmod(uv_y*v_scale,1.f);
+    //pattern index
+    //TODO(Peter): these are new. perhaps they can be used later 
+    // to avoid duplicate calculations.
+    //TODO(Peter): come up with a better name for these...
+    uint32_t total_x = uv_x*u_scale*params->pattern_width;
+    uint32_t total_y = uv_y*v_scale*params->pattern_height;
+
+    //TODO(Vidar): Check why this crashes sometimes
+    if (u_repeat < 0.f) {
+        u_repeat = u_repeat - floor(u_repeat);
+    }
+    if (v_repeat < 0.f) {
+        v_repeat = v_repeat - floor(v_repeat);
+    }
+
+    uint32_t pattern_x = (uint32_t)(u_repeat*(float)(params->pattern_width));
+    uint32_t pattern_y = (uint32_t)(v_repeat*(float)(params->pattern_height));
+
+    const PackedPattern *pattern = params->pattern;
+    uint8_t warp_above;
+    const float *color;
+
+    //Calculate the size of the segment
+    uint32_t steps_left_warp = 0, steps_right_warp = 0;
+    uint32_t steps_left_weft = 0, steps_right_weft = 0;
+    if(pattern->regular.repeat){
+        const RegularWeave *regular = &pattern->regular;
+        uint32_t steps_left, steps_right;
+        warp_above = regular_weave_segment(regular, pattern_x, pattern_y,
+            &steps_left, &steps_right);
+        if(warp_above){
+            steps_left_warp  = steps_left;
+            steps_right_warp = steps_right;
+            color = pattern->palette + 3*regular->warp_color;
+        }else{
+            steps_left_weft  = steps_left;
+            steps_right_weft = steps_right;
+            color = pattern->palette + 3*regular->weft_color;
+        }
+    }else{
+        uint32_t repeat_x = wif_repeat_x(pattern, pattern_x);
+        uint32_t repeat_y = wif_repeat_y(pattern, pattern_y);
+        warp_above = wif_pattern_warp_above(pattern, repeat_x, repeat_y);
+        color = wif_pattern_color(pattern, repeat_x, repeat_y);
+        if(params->segment_entry){
+            const wcSegmentEntry *segment = params->segment_entry + repeat_x
+                + repeat_y*pattern->repeat_width;
+            if (warp_above) {
+                steps_left_warp  = segment->steps_left;
+                steps_right_warp = segment->steps_right;
+            }else{
+                steps_left_weft  = segment->steps_left;
+                steps_right_weft = segment->steps_right;
+            }
+        } else if (warp_above) {
+            calculateLengthOfSegment(wif_pattern_column(pattern, repeat_x),
+                pattern->repeat_height,
+                repeat_y, warp_above, &steps_left_warp, &steps_right_warp);
+            //A line which is a single segment is one in the whole pattern
+            if(steps_right_warp == pattern->repeat_height){
+                steps_left_warp = steps_right_warp = pattern->height;
+            }
+        }else{
+            calculateLengthOfSegment(wif_pattern_row(pattern, repeat_y),
+                pattern->repeat_width,
+                repeat_x, warp_above, &steps_left_weft, &steps_right_weft);
+            if(steps_right_weft == pattern->repeat_width){
+                steps_left_weft = steps_right_weft = pattern->width;
+            }
+        }
+    }
+
+    //Yarn-segment-local coordinates.
+    float l = (steps_left_warp + steps_right_warp + 1.f);
+    float y = ((v_repeat*(float)(params->pattern_height) - (float)pattern_y)
+            + steps_left_warp)/l;
+
+    float w = (steps_left_weft + steps_right_weft + 1.f);
+    float x = ((u_repeat*(float)(params->pattern_width) - (float)pattern_x)
+            + steps_left_weft)/w;
 
     //Rescale x and y to [-1,1]
     x = x*2.f - 1.f;
     y = y*2.f - 1.f;
 
-    //Switch X and Y for warp, so that we always have the yarn
-    // cylinder going along the y axis
-    if(!current_point.warp_above){
-        float tmp1 = x;
-        float tmp2 = w;
-        x = -y;
-        y = tmp1;
-        w = l;
-        l = tmp2;
+    //Switch X and Y for warp, so that we always have the yarn
+    // cylinder going along the y axis
+    if(!warp_above){
+        float tmp1 = x;
+        float tmp2 = w;
+        x = -y;
+        y = tmp1;
+        w = l;
+        l = tmp2;
+    }
+  
+    //return the results
+    wcPatternData ret_data;
+    ret_data.color_r = color[0];
+    ret_data.color_g = color[1];
+    ret_data.color_b = color[2];
+    ret_data.length = l; 
+    ret_data.width  = w; 
+    ret_data.x = x; 
+    ret_data.y = y; 
+    ret_data.warp_above = warp_above; 
+    calculate_segment_uv_and_normal(&ret_data, params);
+    ret_data.total_index_x = total_x; //total x index of wrapped pattern matrix
+    ret_data.total_index_y = total_y; //total y index of wrapped pattern matrix
+    return ret_data;
+}
+
+WC_PREFIX
+wcPatternData wcGetPatternData(wcIntersectionData intersection_data,
+        const wcWeaveParameters *params)
+{
+    if(params->pattern == 0){
+        wcPatternData data = {0};
+        return data;
+    }
+    return get_pattern_data(intersection_data.uv_x, intersection_data.uv_y,
+        params);
+}
+
+// The filament specular term for wi and wo in the frame of the yarn (i.e.
+// rotated for weft). sin_cos_v is sinf(v) and cosf(v) if they have been
+// computed, otherwise 0, since they are only needed on the highlight.
+WC_PREFIX
+static inline float filament_specular(wcVector wi, wcVector wo, float v,
+    float y, const float *sin_cos_v, const wcWeaveParameters *params)
+{
+    wcVector H = wcVector_normalize(wcVector_add(wi,wo));
+
+    //TODO(Peter): explain from where these expressions come.
+    //compute v from x using (11). Already done. We have it from data.
+    //compute u(wi,v,wr) -- u as function of v. using (4)...
+    float specular_u = atan2f(-H.z, H.y) + M_PI_2; //plus or minus in last t.
+    //TODO(Peter): check that it indeed is just v that should be used 
+    //to calculate Gu (6) in Irawans paper.
+    //calculate yarn tangent.
+
+    float reflection = 0.f;
+    if (fabsf(specular_u) < params->umax) {
+        float sin_v = sin_cos_v ? sin_cos_v[0] : sinf(v);
+        float cos_v = sin_cos_v ? sin_cos_v[1] : cosf(v);
+        // Make normal for highlights, uses v and specular_u
+        wcVector highlight_normal = wcVector_normalize(wcvector(sin_v,
+                    sinf(specular_u)*cos_v,
+                    cosf(specular_u)*cos_v));
+
+        // Make tangent for highlights, uses v and specular_u
+        wcVector highlight_tangent = wcVector_normalize(wcvector(0.f, 
+                    cosf(specular_u), -sinf(specular_u)));
+
+        //get specular_y, using irawans transformation.
+        float specular_y = specular_u/params->umax;
+        // our transformation TODO(Peter): Verify!
+        //float specular_y = sinf(specular_u)/sinf(m_umax);
+
+        //Clamp specular_y TODO(Peter): change name of m_delta_x to m_delta_h
+        specular_y = specular_y < 1.f - params->delta_x ? specular_y :
+            1.f - params->delta_x;
+        specular_y = specular_y > -1.f + params->delta_x ? specular_y :
+            -1.f + params->delta_x;
+
+        //this takes the role of xi in the irawan paper.
+        if (fabsf(specular_y - y) < params->delta_x) {
+            // --- Set Gu, using (6)
+            float a = 1.f; //radius of yarn
+            float R = params->compiled.radius_of_curvature;
+            float Gu = a*(R + a*cos_v) /(
+                wcVector_magnitude(wcVector_add(wi,wo)) *
+                fabsf((wcVector_cross(highlight_tangent,H)).x));
+
+            // --- Set fc
+            float cos_x = -wcVector_dot(wi, wo);
+            float fc = params->alpha + vonMises(cos_x, params->beta,
+                params->compiled.von_mises_normalization);
+
+            // --- Set A
+            float widotn = wcVector_dot(wi, highlight_normal);
+            float wodotn = wcVector_dot(wo, highlight_normal);
+            widotn = (widotn < 0.f) ? 0.f : widotn;   
+            wodotn = (wodotn < 0.f) ? 0.f : wodotn;   
+            float A = 0.f;
+            if(widotn > 0.f && wodotn > 0.f){
+                A = 1.f / (4.0 * M_PI) * (widotn*wodotn)/(widotn + wodotn);
+                //TODO(Peter): Explain from where the 1/4*PI factor comes from
+            }
+            float l = 2.f;
+            //TODO(Peter): Implement As, -- smoothes the dissapeares of the
+            // higlight near the ends. Described in (9)
+            reflection = 2.f*l*params->umax*fc*Gu*A/params->delta_x;
+        }
+    }
+    return reflection;
+}
+
+// Rotates wi and wo into the frame of the yarn, where it goes along y
+WC_PREFIX
+static inline void rotate_to_yarn(uint8_t warp_above, wcVector *wi,
+    wcVector *wo)
+{
+    if(!warp_above){
+        float tmp2 = wi->x;
+        float tmp3 = wo->x;
+        wi->x = -wi->y; wi->y = tmp2;
+        wo->x = -wo->y; wo->y = tmp3;
+    }
+}
+
+WC_PREFIX
+float wcEvalFilamentSpecular(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params)
+{
+    wcVector wi = wcvector(intersection_data.wi_x, intersection_data.wi_y,
+        intersection_data.wi_z);
+    wcVector wo = wcvector(intersection_data.wo_x, intersection_data.wo_y,
+        intersection_data.wo_z);
+    rotate_to_yarn(data.warp_above, &wi, &wo);
+    return filament_specular(wi, wo, data.v, data.y, 0, params);
+}
+
+// The staple specular term for wi and wo in the frame of the yarn, where
+// sin_u and cos_u are those of the segment coordinate u
+WC_PREFIX
+static inline float staple_specular(wcVector wi, wcVector wo, float sin_u,
+    float cos_u, float x, const wcWeaveParameters *params)
+{
+    wcVector H = wcVector_normalize(wcVector_add(wi, wo));
+
+    float D;
+    {
+        float a = H.y*sin_u + H.z*cos_u;
+        D = (H.y*cos_u-H.z*sin_u)/(sqrtf(H.x*H.x + a*a))
+            /params->compiled.tan_psi;
+    }
+    float reflection = 0.f;
+            
+    //Plus eller minus i sista termen?
+    float specular_v = atan2f(-H.y*sin_u - H.z*cos_u, H.x) + acosf(D);
+    //TODO(Vidar): Clamp specular_v, do we need it?
+    // Make normal for highlights, uses u and specular_v
+    wcVector highlight_normal = wcVector_normalize(wcvector(sinf(specular_v),
+        sin_u*cosf(specular_v), cos_u*cosf(specular_v)));
+
+    if (fabsf(specular_v) < M_PI_2 && fabsf(D) < 1.f) {
+        //we have specular reflection
+        //get specular_x, using irawans transformation.
+        float specular_x = specular_v/M_PI_2;
+        // our transformation
+        //float specular_x = sinf(specular_v);
+
+        //Clamp specular_x
+        specular_x = specular_x < 1.f - params->delta_x ? specular_x :
+            1.f - params->delta_x;
+        specular_x = specular_x > -1.f + params->delta_x ? specular_x :
+            -1.f + params->delta_x;
+
+        if (fabsf(specular_x - x) < params->delta_x) {
+            // --- Set Gv
+            float a = 1.f; //radius of yarn
+            float R = params->compiled.radius_of_curvature;
+            float Gv = a*(R + a*cosf(specular_v))/(
+                wcVector_magnitude(wcVector_add(wi,wo)) *
+                wcVector_dot(highlight_normal,H) *
+                params->compiled.abs_sin_psi);
+            // --- Set fc
+            float cos_x = -wcVector_dot(wi, wo);
+            float fc = params->alpha + vonMises(cos_x, params->beta,
+                params->compiled.von_mises_normalization);
+            // --- Set A
+            float widotn = wcVector_dot(wi, highlight_normal);
+            float wodotn = wcVector_dot(wo, highlight_normal);
+            widotn = (widotn < 0.f) ? 0.f : widotn;   
+            wodotn = (wodotn < 0.f) ? 0.f : wodotn;   
+            //TODO(Vidar): This is where we get the NAN
+            float A = 0.f;
+            if(widotn > 0.f && wodotn > 0.f){
+                A = 1.f / (4.0 * M_PI) * (widotn*wodotn)/(widotn + wodotn);
+                //TODO(Peter): Explain from where the 1/4*PI factor comes from
+            }
+            float w = 2.f;
+            reflection = 2.f*w*params->umax*fc*Gv*A/params->delta_x;
+        }
+    }
+    return reflection;
+}
+
+WC_PREFIX
+float wcEvalStapleSpecular(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params)
+{
+    wcVector wi = wcvector(intersection_data.wi_x, intersection_data.wi_y,
+        intersection_data.wi_z);
+    wcVector wo = wcvector(intersection_data.wo_x, intersection_data.wo_y,
+        intersection_data.wo_z);
+    rotate_to_yarn(data.warp_above, &wi, &wo);
+    return staple_specular(wi, wo, sinf(data.u), cosf(data.u), data.x,
+        params);
+}
+
+// -- Specular sampling -- //
+// The highlight of a segment is where the half vector H is perpendicular
+// to the fibers. For filament yarn the fibers follow the yarn, so H lies
+// in the plane perpendicular to the tangent at some specular_u, at an
+// angle theta out of the plane. For staple yarn they are twisted by psi,
+// so H makes an angle gamma of at most psi with the plane of the tangent
+// at u, at some specular_v around the yarn. The highlight covers the point
+// when specular_u (specular_v) is in an interval around the position of
+// the point in the segment. H is sampled with specular_u (gamma)
+// distributed so that the density cancels Gu (Gv), and the other angle
+// uniform over the interval where wo is above the surface (for staple
+// yarn, where it may be). What remains of the specular term in the weight
+// f*cos/pdf is mostly fc, A and the cosine.
+
+// The interval of the highlight coordinate in [-1,1] (specular_y or
+// specular_x) where the clamped coordinate is within delta_x of p
+WC_PREFIX
+static void highlight_interval(float p, float delta_x, float *lo, float *hi)
+{
+    *lo = p - delta_x;
+    *hi = p + delta_x;
+    if(p > 1.f - 2.f*delta_x){
+        *hi = 1.f;
+    }
+    if(p < -1.f + 2.f*delta_x){
+        *lo = -1.f;
+    }
+    *lo = *lo > -1.f ? *lo : -1.f;
+    *hi = *hi <  1.f ? *hi :  1.f;
+}
+
+// The interval of specular_u where the filament highlight covers y
+WC_PREFIX
+static void filament_highlight_interval(float y,
+    const wcWeaveParameters *params, float *u_lo, float *u_hi)
+{
+    highlight_interval(y, params->delta_x, u_lo, u_hi);
+    *u_lo *= params->umax;
+    *u_hi *= params->umax;
+    //specular_u is never below -pi/2, see filament_specular
+    *u_lo = *u_lo > -M_PI_2 ? *u_lo : -M_PI_2;
+}
+
+// The parts of (a,b), which is at most pi long, where
+// cos(2*(t - center)) > K, widened by WC_SAMPLE_MARGIN on both sides so
+// that the density of the angle stays bounded when the set gets small.
+// There are at most two, returned in start and length. Returns their
+// total length.
+#define WC_SAMPLE_MARGIN 0.05f
+WC_PREFIX
+static float angle_intervals(float a, float b, float center, float K,
+    float *start, float *length)
+{
+    int n = 0, k;
+    start[0] = start[1] = a;
+    length[0] = length[1] = 0.f;
+    if(b <= a){
+        return 0.f;
+    }
+    float h = K >= 1.f ? 0.f : K <= -1.f ? M_PI_2 : 0.5f*acosf(K);
+    h += WC_SAMPLE_MARGIN;
+    if(h >= M_PI_2){
+        length[0] = b - a;
+        return b - a;
+    }
+    center -= M_PI*floorf((center - a)/M_PI);
+    for(k=-1;k<=1 && n<2;k++){
+        float lo = center + k*M_PI - h;
+        float hi = center + k*M_PI + h;
+        lo = lo > a ? lo : a;
+        hi = hi < b ? hi : b;
+        if(hi > lo){
+            start[n] = lo;
+            length[n] = hi - lo;
+            n++;
+        }
+    }
+    return length[0] + length[1];
+}
+
+// The angles theta in (-pi/2,pi/2) for which the filament highlight at
+// specular_u reflects wi above the surface. With theta0 the direction of
+// wi in the plane of H, wo.z = 2*wi.H*H.z - wi.z > 0 becomes
+// cos(2*theta - theta0) > K.
+WC_PREFIX
+static float filament_theta_intervals(wcVector wi, float specular_u,
+    float *start, float *length)
+{
+    float cos_u = cosf(specular_u);
+    float c = wi.y*sinf(specular_u) + wi.z*cos_u;
+    float rho = sqrtf(wi.x*wi.x + c*c);
+    if(rho*cos_u <= 0.f){
+        return angle_intervals(0.f, 0.f, 0.f, 1.f, start, length);
+    }
+    return angle_intervals(-M_PI_2, M_PI_2, 0.5f*atan2f(wi.x, c),
+        (wi.z/cos_u - c)/rho, start, length);
+}
+
+// The angles phi = acos(D) - specular_v around the yarn, for specular_v in
+// the interval of the highlight, where the staple highlight at gamma may
+// reflect wi above the surface. wo.z > 0 is a sum of terms in phi and 2*phi,
+// and the terms in phi are bounded by their amplitude, which leaves
+// cos(2*phi - phi0 - pi/2) > K.
+WC_PREFIX
+static float staple_phi_intervals(wcVector wi, float sin_gamma,
+    float cos_gamma, float D, float sin_u, float cos_u, float v_lo,
+    float v_hi, float *start, float *length)
+{
+    // wi in the frame of the yarn tangent at u
+    float w1 = wi.x;
+    float w2 = wi.y*cos_u - wi.z*sin_u;
+    float w3 = wi.y*sin_u + wi.z*cos_u;
+    // wi.H = P*cos(phi - phi0) + Q and H.z = R*sin(phi) + S
+    float P = cos_gamma*sqrtf(w1*w1 + w3*w3);
+    float Q = sin_gamma*w2;
+    float R = cos_gamma*cos_u;
+    float S = -sin_gamma*sin_u;
+    float a = acosf(D);
+    if(P*R <= 0.f){
+        return angle_intervals(0.f, 0.f, 0.f, 1.f, start, length);
+    }
+    float M = wi.z - R*cos_gamma*w3 - 2.f*(fabsf(P*S) + fabsf(Q*R)
+        + fabsf(Q*S));
+    return angle_intervals(a - v_hi, a - v_lo,
+        0.5f*(atan2f(w3, w1) + M_PI_2), M/(P*R), start, length);
+}
+
+// Picks the angle for sample in [0,1) uniformly from the intervals
+WC_PREFIX
+static float sample_angle_intervals(float sample, const float *start,
+    const float *length)
+{
+    float t = sample*(length[0] + length[1]);
+    return t < length[0] ? start[0] + t : start[1] + t - length[0];
+}
+
+// The density of wo in the frame of the yarn. H is found like in
+// filament_specular and staple_specular, so that the density is zero
+// exactly where the highlight is
+WC_PREFIX
+static float filament_specular_pdf(wcVector wi, wcVector wo, float y,
+    const wcWeaveParameters *params)
+{
+    if(wo.z <= 0.f){
+        return 0.f;
+    }
+    wcVector H = wcVector_normalize(wcVector_add(wi,wo));
+    float specular_u = atan2f(-H.z, H.y) + M_PI_2;
+    float u_lo, u_hi;
+    filament_highlight_interval(y, params, &u_lo, &u_hi);
+    float cos_theta = sqrtf(H.y*H.y + H.z*H.z);
+    float wi_dot_h = wcVector_dot(wi, H);
+    if(!(specular_u > u_lo && specular_u < u_hi) || cos_theta <= 0.f
+        || wi_dot_h <= 0.f){
+        return 0.f;
+    }
+    float start[2], length[2];
+    float theta_length = filament_theta_intervals(wi, specular_u, start,
+        length);
+    if(theta_length <= 0.f){
+        return 0.f;
+    }
+    // The density of H in (specular_u, theta) is over cos(theta) per solid
+    // angle, and the density of wo is the density of H over 4 wi.H
+    return 1.f/((u_hi - u_lo)*theta_length*cos_theta*4.f*wi_dot_h);
+}
+
+WC_PREFIX
+static float staple_specular_pdf(wcVector wi, wcVector wo, float sin_u,
+    float cos_u, float x, const wcWeaveParameters *params)
+{
+    if(wo.z <= 0.f){
+        return 0.f;
+    }
+    wcVector H = wcVector_normalize(wcVector_add(wi,wo));
+    // H in the frame of the yarn tangent at u
+    float h1 = H.x;
+    float h2 = H.y*cos_u - H.z*sin_u;
+    float h3 = H.y*sin_u + H.z*cos_u;
+    float cos_gamma = sqrtf(h1*h1 + h3*h3);
+    float D = h2/cos_gamma/params->compiled.tan_psi;
+    if(!(fabsf(D) < 1.f)){
+        return 0.f;
+    }
+    float specular_v = atan2f(-h3, h1) + acosf(D);
+    float v_lo, v_hi;
+    highlight_interval(x, params->delta_x, &v_lo, &v_hi);
+    v_lo *= M_PI_2;
+    v_hi *= M_PI_2;
+    float wi_dot_h = wcVector_dot(wi, H);
+    if(!(specular_v > v_lo && specular_v < v_hi) || wi_dot_h <= 0.f){
+        return 0.f;
+    }
+    float start[2], length[2];
+    float phi_length = staple_phi_intervals(wi, h2, cos_gamma, D, sin_u,
+        cos_u, v_lo, v_hi, start, length);
+    if(phi_length <= 0.f){
+        return 0.f;
+    }
+    // sin(gamma) = |sin(psi)|*sin(pi*(sample - 1/2)) has the density
+    // 1/(pi*|sin(psi)|*sqrt(1 - D^2)) in gamma. D recovered from wo is only
+    // accurate to about 1e-6, so 1 - D^2 is bounded where it is smaller.
+    float one_minus_d2 = 1.f - D*D;
+    if(one_minus_d2 < 1e-5f){
+        one_minus_d2 = 1e-5f;
+    }
+    return 1.f/(M_PI*params->compiled.abs_sin_psi*sqrtf(one_minus_d2)
+        *phi_length*cos_gamma*4.f*wi_dot_h);
+}
+
+WC_PREFIX
+static float specular_pdf(wcVector wi, wcVector wo, wcPatternData data,
+    const wcWeaveParameters *params)
+{
+    rotate_to_yarn(data.warp_above, &wi, &wo);
+    if(params->psi <= 0.001f){
+        return filament_specular_pdf(wi, wo, data.y, params);
+    }
+    return staple_specular_pdf(wi, wo, sinf(data.u), cosf(data.u), data.x,
+        params);
+}
+
+WC_PREFIX
+float wcPdfSpecular(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params)
+{
+    if(params->pattern == 0){
+        return 0.f;
+    }
+    wcVector wi = wcvector(intersection_data.wi_x, intersection_data.wi_y,
+        intersection_data.wi_z);
+    wcVector wo = wcvector(intersection_data.wo_x, intersection_data.wo_y,
+        intersection_data.wo_z);
+    return specular_pdf(wi, wo, data, params);
+}
+
+WC_PREFIX
+float wcSampleSpecular(wcIntersectionData *intersection_data,
+    wcPatternData data, float sample_x, float sample_y,
+    const wcWeaveParameters *params)
+{
+    if(params->pattern == 0){
+        return 0.f;
+    }
+    wcVector wi = wcvector(intersection_data->wi_x, intersection_data->wi_y,
+        intersection_data->wi_z);
+    wcVector yarn_wi = wi, H;
+    float start[2], length[2];
+    if(!data.warp_above){
+        yarn_wi.x = -wi.y;
+        yarn_wi.y = wi.x;
+    }
+    if(params->psi <= 0.001f){
+        float u_lo, u_hi;
+        filament_highlight_interval(data.y, params, &u_lo, &u_hi);
+        if(u_hi <= u_lo){
+            return 0.f;
+        }
+        float specular_u = u_lo + sample_x*(u_hi - u_lo);
+        if(filament_theta_intervals(yarn_wi, specular_u, start, length)
+                <= 0.f){
+            return 0.f;
+        }
+        float theta = sample_angle_intervals(sample_y, start, length);
+        H = wcvector(sinf(theta), cosf(theta)*sinf(specular_u),
+            cosf(theta)*cosf(specular_u));
+    }else{
+        float v_lo, v_hi;
+        highlight_interval(data.x, params->delta_x, &v_lo, &v_hi);
+        v_lo *= M_PI_2;
+        v_hi *= M_PI_2;
+        float sin_gamma = params->compiled.abs_sin_psi
+            *sinf((sample_x - 0.5f)*M_PI);
+        float cos_gamma = sqrtf(1.f - sin_gamma*sin_gamma);
+        float D = sin_gamma/cos_gamma/params->compiled.tan_psi;
+        float sin_u = sinf(data.u), cos_u = cosf(data.u);
+        if(staple_phi_intervals(yarn_wi, sin_gamma, cos_gamma, D, sin_u,
+                cos_u, v_lo, v_hi, start, length) <= 0.f){
+            return 0.f;
+        }
+        float phi = sample_angle_intervals(sample_y, start, length);
+        float h1 = cos_gamma*cosf(phi);
+        float h3 = cos_gamma*sinf(phi);
+        H = wcvector(h1, sin_gamma*cos_u + h3*sin_u,
+            -sin_gamma*sin_u + h3*cos_u);
+    }
+    float wi_dot_h = wcVector_dot(yarn_wi, H);
+    if(wi_dot_h <= 0.f){
+        return 0.f;
+    }
+    wcVector wo = wcVector_normalize(wcvector(2.f*wi_dot_h*H.x - yarn_wi.x,
+        2.f*wi_dot_h*H.y - yarn_wi.y, 2.f*wi_dot_h*H.z - yarn_wi.z));
+    // Back from the frame of the yarn
+    if(!data.warp_above){
+        float tmp = wo.x;
+        wo.x = wo.y;
+        wo.y = -tmp;
+    }
+    intersection_data->wo_x = wo.x;
+    intersection_data->wo_y = wo.y;
+    intersection_data->wo_z = wo.z;
+    // The density is evaluated from wo, so that it is zero where wo is
+    // not mapped back to the sampled highlight (e.g. below the surface)
+    return specular_pdf(wi, wo, data, params);
+}
+
+// -- Specular albedo -- //
+// The albedo of the specular term is tabulated over wi_z. Each entry is a
+// quasi Monte Carlo estimate over WC_ALBEDO_SAMPLES positions on a
+// segment, azimuths of wi and directions wo. The directions come from
+// wcSampleSpecular or are cosine weighted, half each, and are weighted by
+// the density of that mixture, since the highlight is too peaked for
+// cosine weighted directions alone. The table leaves out
+// specular_normalization, which may change after a provisional load, and
+// intensity variation.
+#define WC_ALBEDO_SAMPLES 1024
+
+// The parameters the specular albedo depends on
+WC_PREFIX
+static void specular_albedo_key(const wcWeaveParameters *params, float *key)
+{
+    key[0] = params->umax;
+    key[1] = params->psi;
+    key[2] = params->alpha;
+    key[3] = params->beta;
+    key[4] = params->delta_x;
+}
+
+// Whether specular_albedo has to be tabulated again, i.e. albedo_table is
+// not set (which is cheap), has just been set, or the parameters the table
+// depends on have changed
+WC_PREFIX
+static int specular_albedo_outdated(const wcWeaveParameters *params)
+{
+    float key[5];
+    specular_albedo_key(params, key);
+    return !params->albedo_table || params->compiled.specular_albedo[0] < 0.f
+        || memcmp(key, params->compiled.specular_albedo_key, sizeof(key));
+}
+
+WC_PREFIX
+static void tabulate_specular_albedo(wcWeaveParameters *params)
+{
+    float *table = params->compiled.specular_albedo;
+    uint32_t n, k;
+    if(!params->albedo_table || params->pattern == 0){
+        for(k=0;k<WC_ALBEDO_TABLE_SIZE;k++){
+            table[k] = -1.f;
+        }
+        return;
+    }
+    uint8_t filament = params->psi <= 0.001f;
+    for(k=0;k<WC_ALBEDO_TABLE_SIZE;k++){
+        float wi_z = (float)k/(float)(WC_ALBEDO_TABLE_SIZE - 1);
+        float sin_theta = sqrtf(1.f - wi_z*wi_z);
+        double sum = 0.0;
+        for(n=0;n<WC_ALBEDO_SAMPLES;n++){
+            float halton[4];
+            halton_4(n + 1, halton);
+            wcPatternData pattern_data = {0};
+            pattern_data.x = -1.f + 2.f*halton[0];
+            pattern_data.y = -1.f + 2.f*halton[1];
+            pattern_data.length = 1.f;
+            pattern_data.width = 1.f;
+            calculate_segment_uv_and_normal(&pattern_data, params);
+            // The azimuth is a rank 1 lattice, the golden ratio sequence
+            float phi = 2.f*M_PI*(float)fmod(0.6180339887*n, 1.0);
+            wcIntersectionData intersection_data;
+            intersection_data.uv_x = intersection_data.uv_y = 0.f;
+            intersection_data.wi_x = sin_theta*cosf(phi);
+            intersection_data.wi_y = sin_theta*sinf(phi);
+            intersection_data.wi_z = wi_z;
+            if(halton[2] < 0.5f){
+                if(wcSampleSpecular(&intersection_data, pattern_data,
+                        2.f*halton[2], halton[3], params) <= 0.f){
+                    continue;
+                }
+            }else{
+                sample_cosine_hemisphere(2.f*halton[2] - 1.f, halton[3],
+                    &intersection_data.wo_x, &intersection_data.wo_y,
+                    &intersection_data.wo_z);
+            }
+            float reflection = filament
+                ? wcEvalFilamentSpecular(intersection_data, pattern_data,
+                    params)
+                : wcEvalStapleSpecular(intersection_data, pattern_data,
+                    params);
+            if(reflection <= 0.f){
+                continue;
+            }
+            // The albedo is the integral of reflection*wo_z/pi
+            float cosine_pdf = intersection_data.wo_z/M_PI;
+            sum += reflection*cosine_pdf/(0.5f*cosine_pdf
+                + 0.5f*wcPdfSpecular(intersection_data, pattern_data,
+                    params));
+        }
+        table[k] = (float)(sum/WC_ALBEDO_SAMPLES);
     }
-  
-    //return the results
-    wcPatternData ret_data;
-    ret_data.color_r = current_point.color[0];
-    ret_data.color_g = current_point.color[1];
-    ret_data.color_b = current_point.color[2];
-    ret_data.length = l; 
-    ret_data.width  = w; 
-    ret_data.x = x; 
-    ret_data.y = y; 
-    ret_data.warp_above = current_point.warp_above; 
-    calculate_segment_uv_and_normal(&ret_data, params);
-    ret_data.total_index_x = total_x; //total x index of wrapped pattern matrix
-    ret_data.total_index_y = total_y; //total y index of wrapped pattern matrix
-    return ret_data;
+    specular_albedo_key(params, params->compiled.specular_albedo_key);
 }
 
 WC_PREFIX
-float wcEvalFilamentSpecular(wcIntersectionData intersection_data,
-    wcPatternData data, const wcWeaveParameters *params)
+float wcSpecularAlbedo(float wi_z, const wcWeaveParameters *params)
 {
+    const float *table = params->compiled.specular_albedo;
+    if(table[0] < 0.f){
+        return -1.f;
+    }
+    float t = wcClamp(wi_z, 0.f, 1.f)*(WC_ALBEDO_TABLE_SIZE - 1);
+    int k = (int)t;
+    k = k < WC_ALBEDO_TABLE_SIZE - 2 ? k : WC_ALBEDO_TABLE_SIZE - 2;
+    t -= (float)k;
+    return ((1.f - t)*table[k] + t*table[k + 1])
+        *params->specular_normalization;
+}
 
-    wcVector wi = wcvector(intersection_data.wi_x, intersection_data.wi_y,
-        intersection_data.wi_z);
-    wcVector wo = wcvector(intersection_data.wo_x, intersection_data.wo_y,
-        intersection_data.wo_z);
+WC_PREFIX
+wcColor wcDiffuseAlbedo(const wcShadingPoint *point, float wi_z)
+{
+    float value = (wi_z > 0.f ? wi_z : 0.f)*point->yarn_variation;
+    wcColor color = {point->data.color_r*value, point->data.color_g*value,
+        point->data.color_b*value};
+    return color;
+}
 
-    if(!data.warp_above){
-        float tmp2 = wi.x;
-        float tmp3 = wo.x;
-        wi.x = -wi.y; wi.y = tmp2;
-        wo.x = -wo.y; wo.y = tmp3;
+WC_PREFIX
+float wcSpecularProbability(const wcShadingPoint *point, float wi_z,
+    const wcWeaveParameters *params)
+{
+    float albedo = wcSpecularAlbedo(wi_z, params);
+    if(albedo < 0.f){
+        albedo = 1.f;
     }
-    wcVector H = wcVector_normalize(wcVector_add(wi,wo));
+    wcColor diffuse = wcDiffuseAlbedo(point, wi_z);
+    float specular_weight = params->specular_strength*albedo
+        *point->intensity_variation;
+    float diffuse_weight = (1.f - params->specular_strength)
+        *(diffuse.r + diffuse.g + diffuse.b)/3.f;
+    if(!(specular_weight + diffuse_weight > 0.f)){
+        return params->specular_strength;
+    }
+    return specular_weight/(specular_weight + diffuse_weight);
+}
 
-    float v = data.v;
-    float y = data.y;
+// -- Specialized kernels -- //
+// The kernels below are defined once per configuration of the model. The
+// configuration flags are constants, so the compiler removes the branches
+// on them along with everything the configuration doesn't use (e.g. the
+// Perlin noise without yarn variation). compile_weave_parameters picks the
+// right kernels and stores them in params->compiled.
 
-    //TODO(Peter): explain from where these expressions come.
-    //compute v from x using (11). Already done. We have it from data.
-    //compute u(wi,v,wr) -- u as function of v. using (4)...
-    float specular_u = atan2f(-H.z, H.y) + M_PI_2; //plus or minus in last t.
-    //TODO(Peter): check that it indeed is just v that should be used 
-    //to calculate Gu (6) in Irawans paper.
-    //calculate yarn tangent.
+// Depending on the given psi parameter the yarn is considered
+// staple or filament. They are treated differently in order
+// to work better numerically. 
+// INTENSITY is 0 for no intensity variation, otherwise 1 + the hash
+#define WC_SPECULAR_KERNEL(name, FILAMENT, INTENSITY) \
+WC_PREFIX \
+static float eval_specular_##name(wcIntersectionData intersection_data, \
+        wcPatternData data, const wcWeaveParameters *params) \
+{ \
+    float reflection; \
+    if (FILAMENT) { \
+        reflection = wcEvalFilamentSpecular(intersection_data, data, params); \
+    } else { \
+        reflection = wcEvalStapleSpecular(intersection_data, data, params); \
+    } \
+    reflection = reflection * params->specular_normalization; \
+    if (INTENSITY) { \
+        reflection = reflection * intensityVariation(data, params, \
+            INTENSITY - 1); \
+    } \
+    return reflection; \
+}
 
-    float reflection = 0.f;
-    if (fabsf(specular_u) < params->umax) {
-        // Make normal for highlights, uses v and specular_u
-        wcVector highlight_normal = wcVector_normalize(wcvector(sinf(v),
-                    sinf(specular_u)*cosf(v),
-                    cosf(specular_u)*cosf(v)));
+// YARNVAR is 0 for no yarn variation, 1 for noise, 2 for baked noise
+#define WC_DIFFUSE_KERNEL(name, YARNVAR) \
+WC_PREFIX \
+static wcColor eval_diffuse_##name(wcIntersectionData intersection_data, \
+        wcPatternData data, const wcWeaveParameters *params) \
+{ \
+    float value = intersection_data.wi_z; \
+    if (YARNVAR == 1) { \
+        value *= yarnVariation(data, params); \
+    } else if (YARNVAR == 2) { \
+        value *= yarnVariationBaked(data, params); \
+    } \
+    wcColor color = { \
+        data.color_r * value, \
+        data.color_g * value, \
+        data.color_b * value \
+    }; \
+    return color; \
+}
 
-        // Make tangent for highlights, uses v and specular_u
-        wcVector highlight_tangent = wcVector_normalize(wcvector(0.f, 
-                    cosf(specular_u), -sinf(specular_u)));
+#define WC_SHADE_KERNEL(specular, diffuse) \
+WC_PREFIX \
+static wcColor shade_##specular##_##diffuse( \
+        wcIntersectionData intersection_data, \
+        const wcWeaveParameters *params) \
+{ \
+    wcPatternData data = get_pattern_data(intersection_data.uv_x, \
+        intersection_data.uv_y, params); \
+    wcColor ret = eval_diffuse_##diffuse(intersection_data,data,params); \
+    float spec  = eval_specular_##specular(intersection_data,data,params); \
+    ret.r = \
+        ret.r*(1.f-params->specular_strength) + params->specular_strength*spec; \
+    ret.g = \
+        ret.g*(1.f-params->specular_strength) + params->specular_strength*spec; \
+    ret.b = \
+        ret.b*(1.f-params->specular_strength) + params->specular_strength*spec; \
+    return ret; \
+}
 
-        //get specular_y, using irawans transformation.
-        float specular_y = specular_u/params->umax;
-        // our transformation TODO(Peter): Verify!
-        //float specular_y = sinf(specular_u)/sinf(m_umax);
+WC_SPECULAR_KERNEL(filament,           1, 0)
+WC_SPECULAR_KERNEL(filament_intensity, 1, 1 + WC_INTENSITY_TEA)
+WC_SPECULAR_KERNEL(filament_mix,       1, 1 + WC_INTENSITY_MIX)
+WC_SPECULAR_KERNEL(staple,             0, 0)
+WC_SPECULAR_KERNEL(staple_intensity,   0, 1 + WC_INTENSITY_TEA)
+WC_SPECULAR_KERNEL(staple_mix,         0, 1 + WC_INTENSITY_MIX)
+WC_DIFFUSE_KERNEL(plain,   0)
+WC_DIFFUSE_KERNEL(yarnvar, 1)
+WC_DIFFUSE_KERNEL(baked,   2)
+WC_SHADE_KERNEL(filament,           plain)
+WC_SHADE_KERNEL(filament,           yarnvar)
+WC_SHADE_KERNEL(filament,           baked)
+WC_SHADE_KERNEL(filament_intensity, plain)
+WC_SHADE_KERNEL(filament_intensity, yarnvar)
+WC_SHADE_KERNEL(filament_intensity, baked)
+WC_SHADE_KERNEL(filament_mix,       plain)
+WC_SHADE_KERNEL(filament_mix,       yarnvar)
+WC_SHADE_KERNEL(filament_mix,       baked)
+WC_SHADE_KERNEL(staple,             plain)
+WC_SHADE_KERNEL(staple,             yarnvar)
+WC_SHADE_KERNEL(staple,             baked)
+WC_SHADE_KERNEL(staple_intensity,   plain)
+WC_SHADE_KERNEL(staple_intensity,   yarnvar)
+WC_SHADE_KERNEL(staple_intensity,   baked)
+WC_SHADE_KERNEL(staple_mix,         plain)
+WC_SHADE_KERNEL(staple_mix,         yarnvar)
+WC_SHADE_KERNEL(staple_mix,         baked)
 
-        //Clamp specular_y TODO(Peter): change name of m_delta_x to m_delta_h
-        specular_y = specular_y < 1.f - params->delta_x ? specular_y :
-            1.f - params->delta_x;
-        specular_y = specular_y > -1.f + params->delta_x ? specular_y :
-            -1.f + params->delta_x;
+WC_PREFIX
+static void select_kernels(wcWeaveParameters *params)
+{
+    // Indexed by [filament][intensity][yarnvar]
+    static const wcShadeFunction shade[2][3][3] = {
+        {{shade_staple_plain, shade_staple_yarnvar, shade_staple_baked},
+         {shade_staple_intensity_plain, shade_staple_intensity_yarnvar,
+          shade_staple_intensity_baked},
+         {shade_staple_mix_plain, shade_staple_mix_yarnvar,
+          shade_staple_mix_baked}},
+        {{shade_filament_plain, shade_filament_yarnvar,
+          shade_filament_baked},
+         {shade_filament_intensity_plain, shade_filament_intensity_yarnvar,
+          shade_filament_intensity_baked},
+         {shade_filament_mix_plain, shade_filament_mix_yarnvar,
+          shade_filament_mix_baked}}
+    };
+    static const wcEvalDiffuseFunction eval_diffuse[3] = {
+        eval_diffuse_plain, eval_diffuse_yarnvar, eval_diffuse_baked
+    };
+    static const wcEvalSpecularFunction eval_specular[2][3] = {
+        {eval_specular_staple, eval_specular_staple_intensity,
+         eval_specular_staple_mix},
+        {eval_specular_filament, eval_specular_filament_intensity,
+         eval_specular_filament_mix}
+    };
+    int filament  = params->psi <= 0.001f;
+    int intensity = 0;
+    if(params->intensity_fineness >= 0.001f){
+        intensity = params->intensity_hash == WC_INTENSITY_MIX ? 2 : 1;
+    }
+    int yarnvar   = params->yarnvar_amplitude > 0.001f;
+    if(yarnvar && params->yarnvar_table){
+        yarnvar = 2;
+    }
+    params->compiled.shade = shade[filament][intensity][yarnvar];
+    params->compiled.eval_specular = eval_specular[filament][intensity];
+    params->compiled.eval_diffuse = eval_diffuse[yarnvar];
+}
 
-        //this takes the role of xi in the irawan paper.
-        if (fabsf(specular_y - y) < params->delta_x) {
-            // --- Set Gu, using (6)
-            float a = 1.f; //radius of yarn
-            float R = 1.f/(sin(params->umax)); //radius of curvature
-            float Gu = a*(R + a*cosf(v)) /(
-                wcVector_magnitude(wcVector_add(wi,wo)) *
-                fabsf((wcVector_cross(highlight_tangent,H)).x));
+WC_PREFIX
+wcColor wcEvalDiffuse(wcIntersectionData intersection_data,
+        wcPatternData data, const wcWeaveParameters *params)
+{
+    if(params->pattern == 0){
+        wcColor color = {0.f, 0.f, 0.f};
+        return color;
+    }
+    return params->compiled.eval_diffuse(intersection_data, data, params);
+}
 
-            // --- Set fc
-            float cos_x = -wcVector_dot(wi, wo);
-            float fc = params->alpha + vonMises(cos_x, params->beta);
+WC_PREFIX
+float wcEvalSpecular(wcIntersectionData intersection_data,
+        wcPatternData data, const wcWeaveParameters *params)
+{
+    if(params->pattern == 0){
+        return 0.f;
+    }
+    return params->compiled.eval_specular(intersection_data, data, params);
+}
 
-            // --- Set A
-            float widotn = wcVector_dot(wi, highlight_normal);
-            float wodotn = wcVector_dot(wo, highlight_normal);
-            widotn = (widotn < 0.f) ? 0.f : widotn;   
-            wodotn = (wodotn < 0.f) ? 0.f : wodotn;   
-            float A = 0.f;
-            if(widotn > 0.f && wodotn > 0.f){
-                A = 1.f / (4.0 * M_PI) * (widotn*wodotn)/(widotn + wodotn);
-                //TODO(Peter): Explain from where the 1/4*PI factor comes from
-            }
-            float l = 2.f;
-            //TODO(Peter): Implement As, -- smoothes the dissapeares of the
-            // higlight near the ends. Described in (9)
-            reflection = 2.f*l*params->umax*fc*Gu*A/params->delta_x;
-        }
+wcColor wcShade(wcIntersectionData intersection_data,
+        const wcWeaveParameters *params)
+{
+    if(params->pattern == 0){
+        wcColor color = {0.f, 0.f, 0.f};
+        return color;
     }
-    return reflection;
+    return params->compiled.shade(intersection_data, params);
 }
 
+// -- Shading points -- //
+
 WC_PREFIX
-float wcEvalStapleSpecular(wcIntersectionData intersection_data,
-    wcPatternData data, const wcWeaveParameters *params)
+void wcPrepareShadingPoint(float uv_x, float uv_y,
+    const wcWeaveParameters *params, wcShadingPoint *point)
 {
-    wcVector wi = wcvector(intersection_data.wi_x, intersection_data.wi_y,
-        intersection_data.wi_z);
-    wcVector wo = wcvector(intersection_data.wo_x, intersection_data.wo_y,
-        intersection_data.wo_z);
+    memset(point, 0, sizeof(*point));
+    point->frame_s[0] = point->frame_t[1] = point->frame_n[2] = 1.f;
+    if(params->pattern == 0){
+        return;
+    }
+    wcPatternData data = get_pattern_data(uv_x, uv_y, params);
+    point->data = data;
+    point->yarn_variation = 1.f;
+    if(params->yarnvar_amplitude > 0.001f){
+        point->yarn_variation = params->yarnvar_table
+            ? yarnVariationBaked(data, params) : yarnVariation(data, params);
+    }
+    point->specular_scale = params->specular_normalization;
+    point->intensity_variation = 1.f;
+    if(params->intensity_fineness >= 0.001f){
+        point->intensity_variation = intensityVariation(data, params,
+            params->intensity_hash == WC_INTENSITY_MIX ? WC_INTENSITY_MIX
+                : WC_INTENSITY_TEA);
+    }
+    point->sin_u = sinf(data.u);
+    point->cos_u = cosf(data.u);
+    point->sin_v = sinf(data.v);
+    point->cos_v = cosf(data.v);
 
-    if(!data.warp_above){
-        float tmp2 = wi.x;
-        float tmp3 = wo.x;
-        wi.x = -wi.y; wi.y = tmp2;
-        wo.x = -wo.y; wo.y = tmp3;
+    // The tangents are displaced along the normal by the slope of the
+    // yarn, and the normal is their cross product
+    wcVector n = wcVector_normalize(wcvector(data.normal_x, data.normal_y,
+        1.f));
+    wcVector dpdu = wcvector(1.f, 0.f, -data.normal_x);
+    float d = wcVector_dot(n, dpdu);
+    wcVector s = wcVector_normalize(wcvector(dpdu.x - d*n.x,
+        dpdu.y - d*n.y, dpdu.z - d*n.z));
+    wcVector t = wcVector_cross(n, s);
+    point->frame_s[0] = s.x; point->frame_s[1] = s.y; point->frame_s[2] = s.z;
+    point->frame_t[0] = t.x; point->frame_t[1] = t.y; point->frame_t[2] = t.z;
+    point->frame_n[0] = n.x; point->frame_n[1] = n.y; point->frame_n[2] = n.z;
+}
+
+WC_PREFIX
+void wcEvalShadingPoint(const wcShadingPoint *point,
+    const wcIntersectionBatch *directions, uint32_t num,
+    const wcColorBatch *diffuse, float *specular,
+    const wcWeaveParameters *params)
+{
+    const wcPatternData *data = &point->data;
+    uint32_t i;
+    if(diffuse){
+        for(i=0;i<num;i++){
+            float value = directions->wi_z[i] * point->yarn_variation;
+            diffuse->r[i] = data->color_r * value;
+            diffuse->g[i] = data->color_g * value;
+            diffuse->b[i] = data->color_b * value;
+        }
     }
-    wcVector H = wcVector_normalize(wcVector_add(wi, wo));
+    if(!specular){
+        return;
+    }
+    if(params->pattern == 0){
+        for(i=0;i<num;i++){
+            specular[i] = 0.f;
+        }
+        return;
+    }
+    const float sin_cos_v[2] = {point->sin_v, point->cos_v};
+    uint8_t filament = params->psi <= 0.001f;
+    for(i=0;i<num;i++){
+        wcVector wi = wcvector(directions->wi_x[i], directions->wi_y[i],
+            directions->wi_z[i]);
+        wcVector wo = wcvector(directions->wo_x[i], directions->wo_y[i],
+            directions->wo_z[i]);
+        float reflection;
+        rotate_to_yarn(data->warp_above, &wi, &wo);
+        if(filament){
+            reflection = filament_specular(wi, wo, data->v, data->y,
+                sin_cos_v, params);
+        }else{
+            reflection = staple_specular(wi, wo, point->sin_u, point->cos_u,
+                data->x, params);
+        }
+        specular[i] = reflection * point->specular_scale
+            * point->intensity_variation;
+    }
+}
 
-    float u = data.u;
-    float x = data.x;
-    float D;
-    {
-        float a = H.y*sinf(u) + H.z*cosf(u);
-        D = (H.y*cosf(u)-H.z*sinf(u))/(sqrtf(H.x*H.x + a*a))/tanf(params->psi);
+// -- SIMD specular kernels -- //
+// wcEvalSpecularBatch evaluates the specular term 8 (AVX2) or 16 (AVX-512)
+// points at a time when the CPU supports it. The kernels are in
+// woven_cloth_simd.h, which is included once per instruction set below.
+
+#if !defined(WC_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64)) \
+    && (defined(__GNUC__) || defined(_MSC_VER))
+#define WC_SIMD
+#endif
+
+#ifdef WC_SIMD
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#define WC_SIMD_TARGET_AVX2
+#define WC_SIMD_TARGET_AVX512
+#else
+#define WC_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define WC_SIMD_TARGET_AVX512 __attribute__((target("avx2,fma,avx512f")))
+#endif
+
+// AVX2, 8 lanes. Masks are vectors with all bits set in the true lanes
+#define WC_SIMD_WIDTH 8
+#define WC_SIMD_NAME(name) name##_avx2
+#define WC_SIMD_TARGET WC_SIMD_TARGET_AVX2
+#define VF __m256
+#define VI __m256i
+#define VM __m256
+#define V_SET1(a)     _mm256_set1_ps(a)
+#define V_LOAD(p)     _mm256_loadu_ps(p)
+#define V_STORE(p,a)  _mm256_storeu_ps(p,a)
+#define V_ADD(a,b)    _mm256_add_ps(a,b)
+#define V_SUB(a,b)    _mm256_sub_ps(a,b)
+#define V_MUL(a,b)    _mm256_mul_ps(a,b)
+#define V_DIV(a,b)    _mm256_div_ps(a,b)
+#define V_SQRT(a)     _mm256_sqrt_ps(a)
+#define V_MIN(a,b)    _mm256_min_ps(a,b)
+#define V_MAX(a,b)    _mm256_max_ps(a,b)
+#define V_AND(a,b)    _mm256_and_ps(a,b)
+#define V_OR(a,b)     _mm256_or_ps(a,b)
+#define V_XOR(a,b)    _mm256_xor_ps(a,b)
+#define V_ABS(a)      _mm256_andnot_ps(_mm256_set1_ps(-0.f),a)
+#define V_FLOOR(a)    _mm256_floor_ps(a)
+#define V_CMPLT(a,b)  _mm256_cmp_ps(a,b,_CMP_LT_OQ)
+#define V_CMPGT(a,b)  _mm256_cmp_ps(a,b,_CMP_GT_OQ)
+#define V_CMPEQ(a,b)  _mm256_cmp_ps(a,b,_CMP_EQ_OQ)
+#define V_SELECT(m,a,b) _mm256_blendv_ps(b,a,m)
+#define V_CVTT_I(a)   _mm256_cvttps_epi32(a)
+#define V_CVT_F(a)    _mm256_cvtepi32_ps(a)
+#define V_LOAD_ZERO_MASK_U8(p) _mm256_castsi256_ps(_mm256_cmpeq_epi32( \
+    _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(p))), \
+    _mm256_setzero_si256()))
+#define VI_SET1(a)    _mm256_set1_epi32(a)
+#define VI_ADD(a,b)   _mm256_add_epi32(a,b)
+#define VI_SUB(a,b)   _mm256_sub_epi32(a,b)
+#define VI_AND(a,b)   _mm256_and_si256(a,b)
+#define VI_SLLI(a,n)  _mm256_slli_epi32(a,n)
+#define VI_CAST_F(a)  _mm256_castsi256_ps(a)
+#define VI_CMPEQ(a,b) _mm256_castsi256_ps(_mm256_cmpeq_epi32(a,b))
+#define VM_AND(a,b)   _mm256_and_ps(a,b)
+#define VM_ANDNOT(a,b) _mm256_andnot_ps(a,b)
+#define VM_ANY(m)     (_mm256_movemask_ps(m) != 0)
+#include "woven_cloth_simd.h"
+#undef WC_SIMD_WIDTH
+#undef WC_SIMD_NAME
+#undef WC_SIMD_TARGET
+#undef VF
+#undef VI
+#undef VM
+#undef V_SET1
+#undef V_LOAD
+#undef V_STORE
+#undef V_ADD
+#undef V_SUB
+#undef V_MUL
+#undef V_DIV
+#undef V_SQRT
+#undef V_MIN
+#undef V_MAX
+#undef V_AND
+#undef V_OR
+#undef V_XOR
+#undef V_ABS
+#undef V_FLOOR
+#undef V_CMPLT
+#undef V_CMPGT
+#undef V_CMPEQ
+#undef V_SELECT
+#undef V_CVTT_I
+#undef V_CVT_F
+#undef V_LOAD_ZERO_MASK_U8
+#undef VI_SET1
+#undef VI_ADD
+#undef VI_SUB
+#undef VI_AND
+#undef VI_SLLI
+#undef VI_CAST_F
+#undef VI_CMPEQ
+#undef VM_AND
+#undef VM_ANDNOT
+#undef VM_ANY
+
+// AVX-512, 16 lanes. Masks are bitmasks
+#define WC_SIMD_WIDTH 16
+#define WC_SIMD_NAME(name) name##_avx512
+#define WC_SIMD_TARGET WC_SIMD_TARGET_AVX512
+#define VF __m512
+#define VI __m512i
+#define VM __mmask16
+#define V_BITOP(op,a,b) _mm512_castsi512_ps(op(_mm512_castps_si512(a), \
+    _mm512_castps_si512(b)))
+#define V_SET1(a)     _mm512_set1_ps(a)
+#define V_LOAD(p)     _mm512_loadu_ps(p)
+#define V_STORE(p,a)  _mm512_storeu_ps(p,a)
+#define V_ADD(a,b)    _mm512_add_ps(a,b)
+#define V_SUB(a,b)    _mm512_sub_ps(a,b)
+#define V_MUL(a,b)    _mm512_mul_ps(a,b)
+#define V_DIV(a,b)    _mm512_div_ps(a,b)
+#define V_SQRT(a)     _mm512_sqrt_ps(a)
+#define V_MIN(a,b)    _mm512_min_ps(a,b)
+#define V_MAX(a,b)    _mm512_max_ps(a,b)
+#define V_AND(a,b)    V_BITOP(_mm512_and_si512,a,b)
+#define V_OR(a,b)     V_BITOP(_mm512_or_si512,a,b)
+#define V_XOR(a,b)    V_BITOP(_mm512_xor_si512,a,b)
+#define V_ABS(a)      _mm512_abs_ps(a)
+#define V_FLOOR(a)    _mm512_roundscale_ps(a, \
+    _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)
+#define V_CMPLT(a,b)  _mm512_cmp_ps_mask(a,b,_CMP_LT_OQ)
+#define V_CMPGT(a,b)  _mm512_cmp_ps_mask(a,b,_CMP_GT_OQ)
+#define V_CMPEQ(a,b)  _mm512_cmp_ps_mask(a,b,_CMP_EQ_OQ)
+#define V_SELECT(m,a,b) _mm512_mask_blend_ps(m,b,a)
+#define V_CVTT_I(a)   _mm512_cvttps_epi32(a)
+#define V_CVT_F(a)    _mm512_cvtepi32_ps(a)
+#define V_LOAD_ZERO_MASK_U8(p) _mm512_testn_epi32_mask( \
+    _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(p))), \
+    _mm512_set1_epi32(0xff))
+#define VI_SET1(a)    _mm512_set1_epi32(a)
+#define VI_ADD(a,b)   _mm512_add_epi32(a,b)
+#define VI_SUB(a,b)   _mm512_sub_epi32(a,b)
+#define VI_AND(a,b)   _mm512_and_si512(a,b)
+#define VI_SLLI(a,n)  _mm512_slli_epi32(a,n)
+#define VI_CAST_F(a)  _mm512_castsi512_ps(a)
+#define VI_CMPEQ(a,b) _mm512_cmpeq_epi32_mask(a,b)
+#define VM_AND(a,b)   ((__mmask16)((a) & (b)))
+#define VM_ANDNOT(a,b) ((__mmask16)(~(a) & (b)))
+#define VM_ANY(m)     ((m) != 0)
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC 12 warns about the undefined vectors used inside the AVX-512 intrinsics
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include "woven_cloth_simd.h"
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#undef WC_SIMD_WIDTH
+#undef WC_SIMD_NAME
+#undef WC_SIMD_TARGET
+#undef VF
+#undef VI
+#undef VM
+#undef V_BITOP
+#undef V_SET1
+#undef V_LOAD
+#undef V_STORE
+#undef V_ADD
+#undef V_SUB
+#undef V_MUL
+#undef V_DIV
+#undef V_SQRT
+#undef V_MIN
+#undef V_MAX
+#undef V_AND
+#undef V_OR
+#undef V_XOR
+#undef V_ABS
+#undef V_FLOOR
+#undef V_CMPLT
+#undef V_CMPGT
+#undef V_CMPEQ
+#undef V_SELECT
+#undef V_CVTT_I
+#undef V_CVT_F
+#undef V_LOAD_ZERO_MASK_U8
+#undef VI_SET1
+#undef VI_ADD
+#undef VI_SUB
+#undef VI_AND
+#undef VI_SLLI
+#undef VI_CAST_F
+#undef VI_CMPEQ
+#undef VM_AND
+#undef VM_ANDNOT
+#undef VM_ANY
+
+static int wc_detect_simd_width(void)
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if(info[0] < 7){
+        return 1;
     }
-    float reflection = 0.f;
-            
-    //Plus eller minus i sista termen?
-    float specular_v = atan2f(-H.y*sinf(u) - H.z*cosf(u), H.x) + acosf(D);
-    //TODO(Vidar): Clamp specular_v, do we need it?
-    // Make normal for highlights, uses u and specular_v
-    wcVector highlight_normal = wcVector_normalize(wcvector(sinf(specular_v),
-        sinf(u)*cosf(specular_v), cosf(u)*cosf(specular_v)));
+    __cpuid(info, 1);
+    int fma = (info[2] >> 12) & 1;
+    int osxsave = (info[2] >> 27) & 1;
+    if(!fma || !osxsave){
+        return 1;
+    }
+    // Check that the OS saves the ymm (and zmm) registers
+    unsigned long long xcr0 = _xgetbv(0);
+    if((xcr0 & 0x6) != 0x6){
+        return 1;
+    }
+    __cpuidex(info, 7, 0);
+    if((info[1] & (1 << 16)) && (xcr0 & 0xe6) == 0xe6){
+        return 16;
+    }
+    if(info[1] & (1 << 5)){
+        return 8;
+    }
+    return 1;
+#else
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")){
+        return 16;
+    }
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")){
+        return 8;
+    }
+    return 1;
+#endif
+}
+#endif
 
-    if (fabsf(specular_v) < M_PI_2 && fabsf(D) < 1.f) {
-        //we have specular reflection
-        //get specular_x, using irawans transformation.
-        float specular_x = specular_v/M_PI_2;
-        // our transformation
-        //float specular_x = sinf(specular_v);
+// -1 until the first call to wcGetSimdWidth
+static int wc_simd_width = -1;
+static int wc_max_simd_width = -1;
 
-        //Clamp specular_x
-        specular_x = specular_x < 1.f - params->delta_x ? specular_x :
-            1.f - params->delta_x;
-        specular_x = specular_x > -1.f + params->delta_x ? specular_x :
-            -1.f + params->delta_x;
+WC_PREFIX
+int wcGetSimdWidth(void)
+{
+    if(wc_simd_width < 0){
+#ifdef WC_SIMD
+        wc_max_simd_width = wc_detect_simd_width();
+#else
+        wc_max_simd_width = 1;
+#endif
+        wc_simd_width = wc_max_simd_width;
+    }
+    return wc_simd_width;
+}
 
-        if (fabsf(specular_x - x) < params->delta_x) {
-            // --- Set Gv
-            float a = 1.f; //radius of yarn
-            float R = 1.f/(sin(params->umax)); //radius of curvature
-            float Gv = a*(R + a*cosf(specular_v))/(
-                wcVector_magnitude(wcVector_add(wi,wo)) *
-                wcVector_dot(highlight_normal,H) * fabsf(sinf(params->psi)));
-            // --- Set fc
-            float cos_x = -wcVector_dot(wi, wo);
-            float fc = params->alpha + vonMises(cos_x, params->beta);
-            // --- Set A
-            float widotn = wcVector_dot(wi, highlight_normal);
-            float wodotn = wcVector_dot(wo, highlight_normal);
-            widotn = (widotn < 0.f) ? 0.f : widotn;   
-            wodotn = (wodotn < 0.f) ? 0.f : wodotn;   
-            //TODO(Vidar): This is where we get the NAN
-            float A = 0.f;
-            if(widotn > 0.f && wodotn > 0.f){
-                A = 1.f / (4.0 * M_PI) * (widotn*wodotn)/(widotn + wodotn);
-                //TODO(Peter): Explain from where the 1/4*PI factor comes from
-            }
-            float w = 2.f;
-            reflection = 2.f*w*params->umax*fc*Gv*A/params->delta_x;
-        }
+WC_PREFIX
+void wcSetSimdWidth(int width)
+{
+    wcGetSimdWidth();
+    if(width >= 16 && wc_max_simd_width >= 16){
+        wc_simd_width = 16;
+    } else if(width >= 8 && wc_max_simd_width >= 8){
+        wc_simd_width = 8;
+    } else {
+        wc_simd_width = 1;
     }
-    return reflection;
 }
 
+// Evaluates the specular term for as many points as the SIMD kernels can
+// handle and returns how many that was. The rest are left to the caller.
 WC_PREFIX
-wcColor wcEvalDiffuse(wcIntersectionData intersection_data,
-        wcPatternData data, const wcWeaveParameters *params)
+static uint32_t eval_specular_simd(const wcIntersectionBatch *intersection_data,
+    const wcPatternDataBatch *data, uint32_t num, float *specular,
+    uint8_t filament, const wcWeaveParameters *params)
+{
+#ifdef WC_SIMD
+    int width = wcGetSimdWidth();
+    if(width == 1 || num < (uint32_t)width){
+        return 0;
+    }
+    if(width == 16){
+        return eval_specular_avx512(intersection_data, data, num, specular,
+            params, filament);
+    }
+    return eval_specular_avx2(intersection_data, data, num, specular, params,
+        filament);
+#else
+    return 0;
+#endif
+}
+
+// -- Batched evaluation -- //
+
+WC_PREFIX
+static inline wcIntersectionData intersection_from_batch(
+        const wcIntersectionBatch *batch, uint32_t i)
 {
-    float value = intersection_data.wi_z;
+    wcIntersectionData ret;
+    ret.uv_x = batch->uv_x[i]; ret.uv_y = batch->uv_y[i];
+    ret.wi_x = batch->wi_x[i]; ret.wi_y = batch->wi_y[i];
+    ret.wi_z = batch->wi_z[i];
+    ret.wo_x = batch->wo_x[i]; ret.wo_y = batch->wo_y[i];
+    ret.wo_z = batch->wo_z[i];
+    return ret;
+}
+
+WC_PREFIX
+static inline wcPatternData pattern_data_from_batch(const wcPatternDataBatch *batch,
+        uint32_t i)
+{
+    wcPatternData ret;
+    ret.color_r  = batch->color_r[i];
+    ret.color_g  = batch->color_g[i];
+    ret.color_b  = batch->color_b[i];
+    ret.normal_x = batch->normal_x[i];
+    ret.normal_y = batch->normal_y[i];
+    ret.normal_z = batch->normal_z[i];
+    ret.u        = batch->u[i];
+    ret.v        = batch->v[i];
+    ret.length   = batch->length[i];
+    ret.width    = batch->width[i];
+    ret.x        = batch->x[i];
+    ret.y        = batch->y[i];
+    ret.total_index_x = batch->total_index_x[i];
+    ret.total_index_y = batch->total_index_y[i];
+    ret.warp_above    = batch->warp_above[i];
+    return ret;
+}
+
+WC_PREFIX
+static inline void pattern_data_to_batch(const wcPatternDataBatch *batch, uint32_t i,
+        wcPatternData data)
+{
+    batch->color_r[i]  = data.color_r;
+    batch->color_g[i]  = data.color_g;
+    batch->color_b[i]  = data.color_b;
+    batch->normal_x[i] = data.normal_x;
+    batch->normal_y[i] = data.normal_y;
+    batch->normal_z[i] = data.normal_z;
+    batch->u[i]        = data.u;
+    batch->v[i]        = data.v;
+    batch->length[i]   = data.length;
+    batch->width[i]    = data.width;
+    batch->x[i]        = data.x;
+    batch->y[i]        = data.y;
+    batch->total_index_x[i] = data.total_index_x;
+    batch->total_index_y[i] = data.total_index_y;
+    batch->warp_above[i]    = data.warp_above;
+}
 
-    if (params->yarnvar_amplitude > 0.001f) {
-        value *= yarnVariation(data, params);
+WC_PREFIX
+void wcGetPatternDataBatch(const wcIntersectionBatch *intersection_data,
+    uint32_t num, const wcPatternDataBatch *data,
+    const wcWeaveParameters *params)
+{
+    uint32_t i;
+    if(params->pattern == 0){
+        wcPatternData zero = {0};
+        for(i=0;i<num;i++){
+            pattern_data_to_batch(data, i, zero);
+        }
+        return;
+    }
+    for(i=0;i<num;i++){
+        pattern_data_to_batch(data, i, get_pattern_data(
+            intersection_data->uv_x[i], intersection_data->uv_y[i], params));
     }
+}
 
-    wcColor color = {
-        data.color_r * value,
-        data.color_g * value,
-        data.color_b * value
-    };
-    return color;
+WC_PREFIX
+void wcEvalDiffuseBatch(const wcIntersectionBatch *intersection_data,
+    const wcPatternDataBatch *data, uint32_t num, const wcColorBatch *color,
+    const wcWeaveParameters *params)
+{
+    uint32_t i;
+    if (params->yarnvar_amplitude > 0.001f && params->yarnvar_table) {
+        for(i=0;i<num;i++){
+            float value = intersection_data->wi_z[i] * yarnVariationBaked(
+                pattern_data_from_batch(data, i), params);
+            color->r[i] = data->color_r[i] * value;
+            color->g[i] = data->color_g[i] * value;
+            color->b[i] = data->color_b[i] * value;
+        }
+    } else if (params->yarnvar_amplitude > 0.001f) {
+        for(i=0;i<num;i++){
+            float value = intersection_data->wi_z[i]
+                * yarnVariation(pattern_data_from_batch(data, i), params);
+            color->r[i] = data->color_r[i] * value;
+            color->g[i] = data->color_g[i] * value;
+            color->b[i] = data->color_b[i] * value;
+        }
+    } else {
+        for(i=0;i<num;i++){
+            float value = intersection_data->wi_z[i];
+            color->r[i] = data->color_r[i] * value;
+            color->g[i] = data->color_g[i] * value;
+            color->b[i] = data->color_b[i] * value;
+        }
+    }
 }
 
 WC_PREFIX
-float wcEvalSpecular(wcIntersectionData intersection_data,
-        wcPatternData data, const wcWeaveParameters *params)
+void wcEvalSpecularBatch(const wcIntersectionBatch *intersection_data,
+    const wcPatternDataBatch *data, uint32_t num, float *specular,
+    const wcWeaveParameters *params)
 {
-    // Depending on the given psi parameter the yarn is considered
-    // staple or filament. They are treated differently in order
-    // to work better numerically. 
-    float reflection = 0.f;
-    if(params->pattern_entry == 0){
-        return 0.f;
+    uint32_t i;
+    if(params->pattern == 0){
+        for(i=0;i<num;i++){
+            specular[i] = 0.f;
+        }
+        return;
+    }
+    // The choice between filament and staple yarn is the same for all points
+    uint8_t filament = params->psi <= 0.001f;
+    uint32_t first = eval_specular_simd(intersection_data, data, num,
+        specular, filament, params);
+    if (filament) {
+        for(i=first;i<num;i++){
+            specular[i] = wcEvalFilamentSpecular(
+                intersection_from_batch(intersection_data, i),
+                pattern_data_from_batch(data, i), params);
+        }
+    } else {
+        for(i=first;i<num;i++){
+            specular[i] = wcEvalStapleSpecular(
+                intersection_from_batch(intersection_data, i),
+                pattern_data_from_batch(data, i), params);
+        }
     }
-    if (params->psi <= 0.001f) {
-        //Filament yarn
-        reflection = wcEvalFilamentSpecular(intersection_data, data, params); 
+    if(params->intensity_fineness < 0.001f){
+        // intensityVariation is 1
+        for(i=0;i<num;i++){
+            specular[i] = specular[i] * params->specular_normalization;
+        }
+    } else if(params->intensity_hash == WC_INTENSITY_MIX){
+        for(i=0;i<num;i++){
+            specular[i] = specular[i] * params->specular_normalization
+                * intensityVariation(pattern_data_from_batch(data, i),
+                    params, WC_INTENSITY_MIX);
+        }
     } else {
-        //Staple yarn
-        reflection = wcEvalStapleSpecular(intersection_data, data, params); 
+        for(i=0;i<num;i++){
+            specular[i] = specular[i] * params->specular_normalization
+                * intensityVariation(pattern_data_from_batch(data, i),
+                    params, WC_INTENSITY_TEA);
+        }
     }
-    return reflection * params->specular_normalization
-        * intensityVariation(data, params);
 }
 
-wcColor wcShade(wcIntersectionData intersection_data,
-        const wcWeaveParameters *params)
+// wcShadeBatch works through the points in chunks of this size, keeping the
+// intermediate pattern data on the stack
+#define WC_SHADE_BATCH_CHUNK 64
+
+WC_PREFIX
+void wcShadeBatch(const wcIntersectionBatch *intersection_data, uint32_t num,
+    const wcColorBatch *color, const wcWeaveParameters *params)
 {
-    wcPatternData data = wcGetPatternData(intersection_data,params);
-    wcColor ret = wcEvalDiffuse(intersection_data,data,params);
-    float spec  = wcEvalSpecular(intersection_data,data,params);
-    ret.r =
-        ret.r*(1.f-params->specular_strength) + params->specular_strength*spec;
-    ret.g =
-        ret.g*(1.f-params->specular_strength) + params->specular_strength*spec;
-    ret.b =
-        ret.b*(1.f-params->specular_strength) + params->specular_strength*spec;
-    return ret;
+    float color_r[WC_SHADE_BATCH_CHUNK], color_g[WC_SHADE_BATCH_CHUNK],
+          color_b[WC_SHADE_BATCH_CHUNK], normal_x[WC_SHADE_BATCH_CHUNK],
+          normal_y[WC_SHADE_BATCH_CHUNK], normal_z[WC_SHADE_BATCH_CHUNK],
+          u[WC_SHADE_BATCH_CHUNK], v[WC_SHADE_BATCH_CHUNK],
+          length[WC_SHADE_BATCH_CHUNK], width[WC_SHADE_BATCH_CHUNK],
+          x[WC_SHADE_BATCH_CHUNK], y[WC_SHADE_BATCH_CHUNK],
+          spec[WC_SHADE_BATCH_CHUNK];
+    uint32_t total_index_x[WC_SHADE_BATCH_CHUNK],
+             total_index_y[WC_SHADE_BATCH_CHUNK];
+    uint8_t warp_above[WC_SHADE_BATCH_CHUNK];
+    wcPatternDataBatch data = {color_r, color_g, color_b, normal_x, normal_y,
+        normal_z, u, v, length, width, x, y, total_index_x, total_index_y,
+        warp_above};
+    float s = params->specular_strength;
+    uint32_t start, i;
+    for(start=0;start<num;start+=WC_SHADE_BATCH_CHUNK){
+        uint32_t n = num - start < WC_SHADE_BATCH_CHUNK ? num - start
+            : WC_SHADE_BATCH_CHUNK;
+        wcIntersectionBatch chunk = {
+            intersection_data->uv_x + start, intersection_data->uv_y + start,
+            intersection_data->wi_x + start, intersection_data->wi_y + start,
+            intersection_data->wi_z + start, intersection_data->wo_x + start,
+            intersection_data->wo_y + start, intersection_data->wo_z + start};
+        wcColorBatch out = {color->r + start, color->g + start,
+            color->b + start};
+        wcGetPatternDataBatch(&chunk, n, &data, params);
+        wcEvalDiffuseBatch(&chunk, &data, n, &out, params);
+        wcEvalSpecularBatch(&chunk, &data, n, spec, params);
+        for(i=0;i<n;i++){
+            out.r[i] = out.r[i]*(1.f-s) + s*spec[i];
+            out.g[i] = out.g[i]*(1.f-s) + s*spec[i];
+            out.b[i] = out.b[i]*(1.f-s) + s*spec[i];
+        }
+    }
 }
@@ -32,7 +32,76 @@ typedef struct
     float r,g,b;
 }wcColor;
 
+// Describes the yarn segment (float) that a pattern element is part of.
+// Warp elements describe a segment along y, weft elements one along x.
+// The table is only built when pattern_width + pattern_height is less than
+// WC_SEGMENT_TABLE_MAX_SIZE, so that all entries fit in 16 bits.
+#define WC_SEGMENT_TABLE_MAX_SIZE 32768
 typedef struct
+{
+    uint16_t steps_left, steps_right; //Number of elements before/after
+    uint16_t length; //steps_left + steps_right + 1
+    uint16_t yarn_index; //Warp yarns are 0..width-1, weft yarns follow
+}wcSegmentEntry;
+
+// Ways for wcGetPatternData to find the segment an element is part of
+#define WC_SEGMENT_TABLE    0 //Precompute a wcSegmentEntry per element
+#define WC_SEGMENT_BITBOARD 1 //Scan the warp_above bitplanes, no extra memory
+
+struct wcIntersectionData;
+struct wcPatternData;
+struct wcWeaveParameters;
+
+// Signatures of wcShade, wcEvalDiffuse and wcEvalSpecular
+typedef wcColor (*wcShadeFunction)(struct wcIntersectionData,
+    const struct wcWeaveParameters *);
+typedef wcColor (*wcEvalDiffuseFunction)(struct wcIntersectionData,
+    struct wcPatternData, const struct wcWeaveParameters *);
+typedef float (*wcEvalSpecularFunction)(struct wcIntersectionData,
+    struct wcPatternData, const struct wcWeaveParameters *);
+
+// Number of entries of the specular albedo table, at wi_z = 0 to 1
+#define WC_ALBEDO_TABLE_SIZE 16
+
+// Values which only depend on the parameters, so that they don't have to
+// be recomputed for every shading point.
+typedef struct
+{
+    float u_scale, v_scale; //uscale/vscale, divided by the real world size
+    float von_mises_I0; //Bessel I0(beta)
+    float von_mises_normalization; //1/(2*pi*I0(beta))
+    float radius_of_curvature; //1/sin(umax)
+    float tan_psi, abs_sin_psi;
+    // Size of yarnvar_table, which has yarnvar_table_samples samples for
+    // each of the yarnvar_table_yarns yarns
+    uint32_t yarnvar_table_yarns, yarnvar_table_samples;
+    // Whether the yarn variation is used, yarnvar_xscale, yarnvar_yscale,
+    // yarnvar_persistance, yarnvar_octaves, yarnvar_bake_resolution and
+    // yarnvar_bake_repeats yarnvar_table is for, and the parameters which
+    // own it
+    float yarnvar_table_key[7];
+    const void *yarnvar_table_owner;
+    // Directional albedo of the specular term, without
+    // specular_normalization, at wi_z = i/(WC_ALBEDO_TABLE_SIZE - 1).
+    // Negative if albedo_table is not set.
+    float specular_albedo[WC_ALBEDO_TABLE_SIZE];
+    // The umax, psi, alpha, beta and delta_x specular_albedo is for
+    float specular_albedo_key[5];
+    // The umax, psi, alpha, beta, delta_x, normalization_tolerance and
+    // normalization_table specular_normalization is for
+    float specular_normalization_key[7];
+    // Versions of the shading functions specialized for filament/staple
+    // yarn and whether yarn and intensity variation are used
+    wcShadeFunction shade;
+    wcEvalDiffuseFunction eval_diffuse;
+    wcEvalSpecularFunction eval_specular;
+} wcCompiledParameters;
+
+// Hash functions for the intensity variation
+#define WC_INTENSITY_TEA 0 //8 rounds of TEA
+#define WC_INTENSITY_MIX 1 //64 bit integer mixing, cheaper
+
+typedef struct wcWeaveParameters
 {
 // These are the parameters to the model
     float uscale;
@@ -50,15 +119,74 @@ typedef struct
     float yarnvar_persistance;
     uint32_t yarnvar_octaves;
     uint8_t realworld_uv;
+    uint8_t segment_lookup; //WC_SEGMENT_TABLE or WC_SEGMENT_BITBOARD
+    uint8_t intensity_hash; //WC_INTENSITY_TEA or WC_INTENSITY_MIX
+    // If yarnvar_bake_resolution is not 0, the yarn variation noise is baked
+    // into a table with this many samples per element along each yarn,
+    // instead of being evaluated for every shading point. The table covers
+    // yarnvar_bake_repeats repeats of the pattern, after which the
+    // variation repeats. If the table would have more than 2^32 samples, or
+    // can not be allocated, yarnvar_table is left 0 and the noise is
+    // evaluated.
+    uint32_t yarnvar_bake_resolution;
+    uint32_t yarnvar_bake_repeats;
+    // Number of threads used to compute specular_normalization when a
+    // pattern is loaded. 0 uses one per CPU. The result does not depend on
+    // the number of threads.
+    uint32_t normalization_threads;
+    // Directory of a file where specular_normalization is stored between
+    // runs, since it only depends on umax, psi, alpha, beta and delta_x.
+    // If 0, the WC_NORMALIZATION_CACHE environment variable is used. If
+    // that is not set either, or the string is empty, there is no cache.
+    // Only used while the pattern is loaded.
+    const char *normalization_cache_dir;
+    // If 1, specular_normalization is interpolated from a precomputed
+    // table when the parameters are inside of it, instead of being
+    // computed (see wcSpecularNormalizationFromTable).
+    // Outside of the table it is computed, by wcUpdateWeaveParameters too,
+    // which takes milliseconds (normalization_samples is 0 if it came
+    // from the table).
+    uint8_t normalization_table;
+    // If not 0, specular_normalization is estimated adaptively: directions
+    // are added to each location until the relative standard error of the
+    // largest reflection is below this (e.g. 0.01), or a location is
+    // clearly not the largest, so that the time depends on how peaked the
+    // highlight is. Each location has at most 65536 directions, which may
+    // not be enough for very sharp highlights; normalization_error tells.
+    // 0 uses the fixed 100x1000 samples.
+    float normalization_tolerance;
+    // If not 0, WIF patterns for which a dense pattern (with a bit and a
+    // color index per element) would take more than this many megabytes
+    // are stored implicitly, as their draft. Then the memory grows with
+    // the number of threads times the number of shafts and treadles, not
+    // with width*height. Elements are looked up through the threading and
+    // treadling, and there is no segment table.
+    uint32_t implicit_pattern_threshold;
+    // If 1, the directional albedo of the specular term is tabulated when
+    // the pattern is loaded, and by wcUpdateWeaveParameters when umax,
+    // psi, alpha, beta or delta_x have changed, for wcSpecularAlbedo. That
+    // takes about 130000 evaluations of the specular term (about 10 ms),
+    // so set it to 0 on copies whose parameters change per shading point.
+    uint8_t albedo_table;
 
 // These are set by calling one of the wcWeavePatternFrom* functions
 // after all parameters above have been defined
     uint32_t pattern_height;
     uint32_t pattern_width;
-    PatternEntry * pattern_entry;
+    PackedPattern * pattern;
+    // Set when pattern points into a memory mapped compiled weave file
+    void * pattern_mapping;
+    wcSegmentEntry * segment_entry;
+    float * yarnvar_table;
     float specular_normalization;
+    // Estimated relative standard error of specular_normalization and the
+    // number of specular evaluations used to compute it. Both are 0 when it
+    // came from the normalization table.
+    float normalization_error;
+    uint32_t normalization_samples;
     float pattern_realheight;
     float pattern_realwidth;
+    wcCompiledParameters compiled;
 } wcWeaveParameters;
 
 // Intersection data to be set by the renderer
@@ -67,7 +195,7 @@ typedef struct
 // dP/du and dP/dv are the derivatives of the current shading point with
 // respect to the u and v texture coordinates, respectively. I.e. vectors
 // which point in the direction of increasing u or v along the surface.
-typedef struct
+typedef struct wcIntersectionData
 {
     float uv_x, uv_y;       // Texture coordinates
     float wi_x, wi_y, wi_z; // Incident direction 
@@ -83,6 +211,37 @@ WC_PREFIX
 void wcWeavePatternFromFile_wchar(wcWeaveParameters *params,
     const wchar_t *filename);
 
+// Asynchronous loading. Starts loading the file on a background thread
+// and returns a handle at once, so that a renderer can load many patterns
+// while it prepares the rest of the scene. params must not be used or
+// changed until the load is ready. If provisional is 1, the load is ready
+// as soon as the pattern is, with specular_normalization from the
+// normalization table (if the parameters are inside of it). The computed
+// one is stored in params by wcFinishWeavePattern.
+// The functions below accept 0, which is returned if the load could not be
+// started; the pattern has then been loaded before returning.
+typedef struct wcWeavePatternLoad wcWeavePatternLoad;
+WC_PREFIX
+wcWeavePatternLoad *wcWeavePatternFromFileAsync(wcWeaveParameters *params,
+    const char *filename, int provisional);
+WC_PREFIX
+wcWeavePatternLoad *wcWeavePatternFromFileAsync_wchar(
+    wcWeaveParameters *params, const wchar_t *filename, int provisional);
+// Returns 1 if params can be used. Does not block, and may be called from
+// any number of threads at once.
+WC_PREFIX
+int wcWeavePatternReady(wcWeavePatternLoad *load);
+// Blocks until params can be used. May be called from any number of
+// threads at once.
+WC_PREFIX
+void wcWaitForWeavePattern(wcWeavePatternLoad *load);
+// Waits for the load to finish completely, stores the computed
+// normalization if it was provisional, and frees the handle. Call it once
+// for every load, when no other thread uses params, and before
+// wcFreeWeavePattern.
+WC_PREFIX
+void wcFinishWeavePattern(wcWeavePatternLoad *load);
+
 WC_PREFIX
 void wcFreeWeavePattern(wcWeaveParameters *params);
 
@@ -96,7 +255,7 @@ wcColor wcShade(wcIntersectionData intersection_data,
 
 // ========= Advanced usage =========
 
-typedef struct
+typedef struct wcPatternData
 {
     float color_r, color_g, color_b;
     float normal_x, normal_y, normal_z; //(not yarn local coordinates)
@@ -117,10 +276,193 @@ WC_PREFIX
 float wcEvalSpecular(wcIntersectionData intersection_data,
     wcPatternData data, const wcWeaveParameters *params);
 
+// ========= Importance sampling =========
+// Samples wo for the wi of intersection_data, with a density that follows
+// the filament or staple highlight of the segment in data, and returns the
+// density (per solid angle). sample_x and sample_y are uniform in [0,1).
+// Returns 0 if no direction was sampled, e.g. if it would be below the
+// surface or the highlight does not cover the point; wo is then not
+// valid. wcEvalSpecular(...)*wo_z/pdf is then the specular term of an
+// estimate, up to fc and A. The density only depends on the direction, so
+// wcPdfSpecular gives the same value for the sampled wo, and the density
+// of directions sampled in other ways, e.g. for multiple importance
+// sampling with a cosine weighted diffuse sample.
+WC_PREFIX
+float wcSampleSpecular(wcIntersectionData *intersection_data,
+    wcPatternData data, float sample_x, float sample_y,
+    const wcWeaveParameters *params);
+WC_PREFIX
+float wcPdfSpecular(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params);
+
+// ========= Batched evaluation =========
+// These functions evaluate num shading points at once. Inputs and outputs
+// are structures of arrays, where every array holds num elements. The
+// results are identical to calling the corresponding function above once
+// per shading point, except for the specular term when SIMD is used (see
+// wcGetSimdWidth).
+
+typedef struct
+{
+    const float *uv_x, *uv_y;
+    const float *wi_x, *wi_y, *wi_z;
+    const float *wo_x, *wo_y, *wo_z;
+} wcIntersectionBatch;
+
+typedef struct
+{
+    float *r, *g, *b;
+} wcColorBatch;
+
+typedef struct
+{
+    float *color_r, *color_g, *color_b;
+    float *normal_x, *normal_y, *normal_z;
+    float *u, *v;
+    float *length, *width;
+    float *x, *y;
+    uint32_t *total_index_x, *total_index_y;
+    uint8_t *warp_above;
+} wcPatternDataBatch;
+
+// Only uv_x and uv_y of intersection_data are used
+WC_PREFIX
+void wcGetPatternDataBatch(const wcIntersectionBatch *intersection_data,
+    uint32_t num, const wcPatternDataBatch *data,
+    const wcWeaveParameters *params);
+// Only wi_z of intersection_data is used
+WC_PREFIX
+void wcEvalDiffuseBatch(const wcIntersectionBatch *intersection_data,
+    const wcPatternDataBatch *data, uint32_t num, const wcColorBatch *color,
+    const wcWeaveParameters *params);
+WC_PREFIX
+void wcEvalSpecularBatch(const wcIntersectionBatch *intersection_data,
+    const wcPatternDataBatch *data, uint32_t num, float *specular,
+    const wcWeaveParameters *params);
+WC_PREFIX
+void wcShadeBatch(const wcIntersectionBatch *intersection_data, uint32_t num,
+    const wcColorBatch *color, const wcWeaveParameters *params);
+
+// ========= Shading points =========
+// When many directions are evaluated at the same point of the surface,
+// e.g. one per light, wcPrepareShadingPoint does the work that only
+// depends on the point once: the pattern lookup, the yarn and intensity
+// variation and the trigonometry of the segment coordinates.
+// wcEvalShadingPoint then evaluates any number of (wi, wo) pairs against
+// it. The results are identical to those of wcEvalDiffuse and
+// wcEvalSpecular with the pattern data of the point.
+
+typedef struct
+{
+    wcPatternData data;
+    float yarn_variation; //Diffuse factor, 1 without yarn variation
+    float specular_scale; //specular_normalization
+    float intensity_variation; //Specular factor, 1 without it
+    float sin_u, cos_u, sin_v, cos_v; //Of data.u and data.v
+    // Frame of the surface perturbed by the normal of the yarn, in shading
+    // space, assuming that dP/du and dP/dv are orthogonal and of unit
+    // length. frame_n is the shading normal.
+    float frame_s[3], frame_t[3], frame_n[3];
+} wcShadingPoint;
+
+WC_PREFIX
+void wcPrepareShadingPoint(float uv_x, float uv_y,
+    const wcWeaveParameters *params, wcShadingPoint *point);
+// Only wi and wo of directions are used. diffuse or specular may be 0 if
+// that term is not needed. The terms are those of wcEvalDiffuse and
+// wcEvalSpecular; wcShade weights them by specular_strength.
+WC_PREFIX
+void wcEvalShadingPoint(const wcShadingPoint *point,
+    const wcIntersectionBatch *directions, uint32_t num,
+    const wcColorBatch *diffuse, float *specular,
+    const wcWeaveParameters *params);
+
+// ========= Lobe selection =========
+// The directional albedo of a term is its mean over cosine weighted wo,
+// i.e. its integral times wo_z over the hemisphere divided by pi, for the
+// incident direction wi. A sampler can choose between the diffuse and
+// specular terms in proportion to their albedos, e.g. with
+// wcSampleSpecular and a cosine weighted sample.
+
+// The albedo of the specular term, interpolated from a table over wi_z.
+// It is averaged over positions on a segment and azimuths of wi, and
+// includes specular_normalization but not intensity variation. The
+// specular term is symmetric in wi and wo, so this is also its albedo for
+// a given wo. Returns -1 if albedo_table was not set when the pattern was
+// loaded.
+WC_PREFIX
+float wcSpecularAlbedo(float wi_z, const wcWeaveParameters *params);
+// The diffuse term does not depend on wo, so its albedo is its value at
+// the point, color*yarn variation*wi_z
+WC_PREFIX
+wcColor wcDiffuseAlbedo(const wcShadingPoint *point, float wi_z);
+// The probability of choosing the specular term at the point, with the
+// albedos weighted as in wcShade: specular_strength*specular albedo*
+// intensity variation against (1 - specular_strength)*the mean of the
+// diffuse albedo over r, g and b. Without albedo_table the specular albedo
+// is taken to be 1, its largest value over the normalization locations.
+WC_PREFIX
+float wcSpecularProbability(const wcShadingPoint *point, float wi_z,
+    const wcWeaveParameters *params);
+
+// The specular term of the batched functions is evaluated with AVX2 (8
+// points at a time) or AVX-512 (16 points) if the CPU supports it. These
+// kernels use polynomial approximations of the trigonometric functions.
+// Their absolute error is less than 1e-4 times the largest specular value,
+// and for all but about 0.1% of the points the relative error is less than
+// 1e-4 too (see tools/test_simd_specular). The width is chosen at the first
+// call; wcSetSimdWidth can lower it, e.g. wcSetSimdWidth(1) gives the
+// scalar results. specular_normalization is computed with
+// wcEvalSpecularBatch too, so it depends on the width when the pattern is
+// loaded, although only in the last few bits.
+WC_PREFIX
+int wcGetSimdWidth(void);
+WC_PREFIX
+void wcSetSimdWidth(int width);
+
+// Call after changing any of the parameters above when a pattern is
+// already loaded. Recomputes everything derived from them.
+// specular_normalization is not looked up in or stored to the
+// normalization cache here, and is only set again when the parameters it
+// depends on have changed. With normalization_table set and the
+// parameters inside of the table this is cheap enough to do for every
+// frame of an animation, or for every shading point (on a copy of the
+// parameters, with albedo_table set to 0) when they are driven by
+// textures. Outside of the table the normalization is computed, as when
+// the pattern is loaded. The yarn variation is baked again when its
+// parameters have changed, except on a copy of the parameters, which
+// evaluates the noise instead since the table belongs to the original.
+WC_PREFIX
+void wcUpdateWeaveParameters(wcWeaveParameters *params);
+
+// Returns specular_normalization for the umax, psi, alpha, beta and delta_x
+// of params, interpolated from a precomputed table, or -1 if they are
+// outside of it. The table covers umax 0.05-pi/2, psi up to 0.001
+// (filament yarn) and 0.01-pi/2, alpha 0-1, beta 0-10 and delta_x 0.02-1.
+// The computed normalization jumps where another of its sample points
+// starts to catch the highlight, mostly as delta_x changes, and the table
+// smooths over that. Compared to computing it, the median error is about
+// 2%, 90% of the parameters are within 10%, but the error can reach 70%
+// next to a jump. src/normalization_table.h lists the measured error.
+WC_PREFIX
+float wcSpecularNormalizationFromTable(const wcWeaveParameters *params);
+
 WC_PREFIX
 void wcWeavePatternFromData(wcWeaveParameters *params, uint8_t *warp_above,
     float *warp_color, float *weft_color, uint32_t pattern_width,
     uint32_t pattern_height);
+// Generates a regular weave of repeat x repeat elements, where element
+// (x,y) has the warp above when (shift*x + y) % repeat < floats. E.g. a
+// plain weave is repeat 2, shift 1, floats 1, a 2/2 twill is repeat 4,
+// shift 1, floats 2 and a 5 end satin is repeat 5, shift 2, floats 1 (or
+// floats 4 for the warp faced one). Regular weaves are recognized in any
+// pattern, also from the functions above and below, and are then shaded
+// without looking up the pattern. That is the case for plain weaves,
+// twills (shift 1 or repeat - 1) and satins (floats 1 or repeat - 1, with
+// shift and repeat coprime).
+WC_PREFIX
+void wcWeavePatternRegular(wcWeaveParameters *params, uint32_t repeat,
+    uint32_t shift, uint32_t floats, float *warp_color, float *weft_color);
 /* wcWeavePatternFromFile calles one of the functions below depending on
  * file extension*/
 WC_PREFIX
@@ -133,3 +475,23 @@ void wcWeavePatternFromWeaveFile(wcWeaveParameters *params, const char *filename
 WC_PREFIX
 void wcWeavePatternFromWeaveFile_wchar(wcWeaveParameters *params,
     const wchar_t *filename);
+
+// Compiled weave files (.cweave) hold a pattern as it is laid out in
+// memory, and the specular normalization for the parameters they were
+// written with. They are memory mapped, and the pattern points into the
+// mapping instead of being copied, so loading one costs little more than
+// opening it. The normalization is only used if the parameters are the
+// same when the file is loaded, and the file only loads on machines with
+// the same byte order. Convert files with tools/compile_weave.
+WC_PREFIX
+void wcWeavePatternFromCompiledWeave(wcWeaveParameters *params,
+    const char *filename);
+WC_PREFIX
+void wcWeavePatternFromCompiledWeave_wchar(wcWeaveParameters *params,
+    const wchar_t *filename);
+// Writes the loaded pattern of params to a compiled weave file, with its
+// specular_normalization unless that came from the normalization table.
+// Returns 1 on success. Implicit patterns can not be written.
+WC_PREFIX
+int wcWriteCompiledWeave(const wcWeaveParameters *params,
+    const char *filename);
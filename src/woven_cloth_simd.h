@@ -0,0 +1,339 @@
+/* SIMD versions of wcEvalFilamentSpecular and wcEvalStapleSpecular
+ *
+ * This file is included by woven_cloth.cpp once per instruction set, with
+ * the following macros defined:
+ *   WC_SIMD_WIDTH     Number of lanes
+ *   WC_SIMD_NAME(n)   Appends the instruction set to the name n
+ *   WC_SIMD_TARGET    Attribute which enables the instruction set
+ *   VF, VI, VM        Float vector, integer vector and lane mask types
+ *   V_*, VI_*, VM_*   Operations on these, see woven_cloth.cpp
+ *
+ * The kernels evaluate WC_SIMD_WIDTH points of a batch at once. All
+ * branches of the scalar code are replaced by lane masks. The
+ * transcendental functions use the same polynomial approximations as the
+ * Cephes library, which are accurate to a couple of ulp in the range of
+ * angles used here.
+ */
+
+// -- Math functions -- //
+
+// Returns sin(x) and sets *c to cos(x)
+WC_SIMD_TARGET
+static inline VF WC_SIMD_NAME(v_sincos)(VF x, VF *c)
+{
+    VF sign_sin = V_AND(x, V_SET1(-0.f));
+    x = V_ABS(x);
+
+    // Reduce to [-pi/4, pi/4], j is the octant rounded up to even
+    VI j = V_CVTT_I(V_MUL(x, V_SET1(1.27323954473516f)));
+    j = VI_AND(VI_ADD(j, VI_SET1(1)), VI_SET1(~1));
+    VF y = V_CVT_F(j);
+    x = V_SUB(x, V_MUL(y, V_SET1(0.78515625f)));
+    x = V_SUB(x, V_MUL(y, V_SET1(2.4187564849853515625e-4f)));
+    x = V_SUB(x, V_MUL(y, V_SET1(3.77489497744594108e-8f)));
+
+    VF swap_sin = VI_CAST_F(VI_SLLI(VI_AND(j, VI_SET1(4)), 29));
+    VF sign_cos = VI_CAST_F(VI_SLLI(
+        VI_AND(VI_SUB(VI_SET1(4), VI_AND(VI_SUB(j, VI_SET1(2)),
+            VI_SET1(4))), VI_SET1(4)), 29));
+    VM poly_mask = VI_CMPEQ(VI_AND(j, VI_SET1(2)), VI_SET1(0));
+    sign_sin = V_XOR(sign_sin, swap_sin);
+
+    VF z = V_MUL(x, x);
+    VF yc = V_SET1(2.443315711809948e-5f);
+    yc = V_ADD(V_MUL(yc, z), V_SET1(-1.388731625493765e-3f));
+    yc = V_ADD(V_MUL(yc, z), V_SET1(4.166664568298827e-2f));
+    yc = V_MUL(V_MUL(yc, z), z);
+    yc = V_ADD(V_SUB(yc, V_MUL(z, V_SET1(0.5f))), V_SET1(1.f));
+
+    VF ys = V_SET1(-1.9515295891e-4f);
+    ys = V_ADD(V_MUL(ys, z), V_SET1(8.3321608736e-3f));
+    ys = V_ADD(V_MUL(ys, z), V_SET1(-1.6666654611e-1f));
+    ys = V_ADD(V_MUL(V_MUL(ys, z), x), x);
+
+    *c = V_XOR(V_SELECT(poly_mask, yc, ys), sign_cos);
+    return V_XOR(V_SELECT(poly_mask, ys, yc), sign_sin);
+}
+
+WC_SIMD_TARGET
+static inline VF WC_SIMD_NAME(v_atan)(VF x)
+{
+    VF sign = V_AND(x, V_SET1(-0.f));
+    x = V_ABS(x);
+    VM big    = V_CMPGT(x, V_SET1(2.414213562373095f));
+    VM medium = VM_ANDNOT(big, V_CMPGT(x, V_SET1(0.4142135623730950f)));
+    VF y0 = V_SELECT(big, V_SET1((float)M_PI_2),
+        V_SELECT(medium, V_SET1((float)M_PI_4), V_SET1(0.f)));
+    x = V_SELECT(big, V_DIV(V_SET1(-1.f), x),
+        V_SELECT(medium, V_DIV(V_SUB(x, V_SET1(1.f)), V_ADD(x, V_SET1(1.f))),
+            x));
+    VF z = V_MUL(x, x);
+    VF y = V_SET1(8.05374449538e-2f);
+    y = V_ADD(V_MUL(y, z), V_SET1(-1.38776856032e-1f));
+    y = V_ADD(V_MUL(y, z), V_SET1(1.99777106478e-1f));
+    y = V_ADD(V_MUL(y, z), V_SET1(-3.33329491539e-1f));
+    y = V_ADD(V_MUL(V_MUL(y, z), x), x);
+    return V_XOR(V_ADD(y, y0), sign);
+}
+
+WC_SIMD_TARGET
+static inline VF WC_SIMD_NAME(v_atan2)(VF y, VF x)
+{
+    VF ret = WC_SIMD_NAME(v_atan)(V_DIV(y, x));
+    // In the left half plane, add pi with the sign of y
+    VF offset = V_OR(V_SET1((float)M_PI), V_AND(y, V_SET1(-0.f)));
+    ret = V_SELECT(V_CMPLT(x, V_SET1(0.f)), V_ADD(ret, offset), ret);
+    // atan2(0,0) = 0
+    VM zero = VM_AND(V_CMPEQ(x, V_SET1(0.f)), V_CMPEQ(y, V_SET1(0.f)));
+    return V_SELECT(zero, V_SET1(0.f), ret);
+}
+
+// Only valid for |x| <= 1, which is all the staple kernel needs
+WC_SIMD_TARGET
+static inline VF WC_SIMD_NAME(v_acos)(VF x)
+{
+    VF a = V_ABS(x);
+    VM big = V_CMPGT(a, V_SET1(0.5f));
+    VF z = V_SELECT(big, V_MUL(V_SET1(0.5f), V_SUB(V_SET1(1.f), a)),
+        V_MUL(a, a));
+    VF s = V_SELECT(big, V_SQRT(z), a);
+    VF p = V_SET1(4.2163199048e-2f);
+    p = V_ADD(V_MUL(p, z), V_SET1(2.4181311049e-2f));
+    p = V_ADD(V_MUL(p, z), V_SET1(4.5470025998e-2f));
+    p = V_ADD(V_MUL(p, z), V_SET1(7.4953002686e-2f));
+    p = V_ADD(V_MUL(p, z), V_SET1(1.6666752422e-1f));
+    p = V_ADD(V_MUL(V_MUL(p, z), s), s);
+    // |x| > 0.5: acos(|x|) = 2 asin(sqrt((1-|x|)/2))
+    // |x| <= 0.5: acos(x) = pi/2 - asin(x)
+    VF big_ret = V_MUL(V_SET1(2.f), p);
+    big_ret = V_SELECT(V_CMPLT(x, V_SET1(0.f)),
+        V_SUB(V_SET1((float)M_PI), big_ret), big_ret);
+    VF small_ret = V_SUB(V_SET1((float)M_PI_2),
+        V_XOR(p, V_AND(x, V_SET1(-0.f))));
+    return V_SELECT(big, big_ret, small_ret);
+}
+
+WC_SIMD_TARGET
+static inline VF WC_SIMD_NAME(v_exp)(VF x)
+{
+    x = V_MIN(V_MAX(x, V_SET1(-87.3f)), V_SET1(88.3f));
+    VF fx = V_FLOOR(V_ADD(V_MUL(x, V_SET1(1.44269504088896341f)),
+        V_SET1(0.5f)));
+    x = V_SUB(x, V_MUL(fx, V_SET1(0.693359375f)));
+    x = V_SUB(x, V_MUL(fx, V_SET1(-2.12194440e-4f)));
+    VF z = V_MUL(x, x);
+    VF y = V_SET1(1.9875691500e-4f);
+    y = V_ADD(V_MUL(y, x), V_SET1(1.3981999507e-3f));
+    y = V_ADD(V_MUL(y, x), V_SET1(8.3334519073e-3f));
+    y = V_ADD(V_MUL(y, x), V_SET1(4.1665795894e-2f));
+    y = V_ADD(V_MUL(y, x), V_SET1(1.6666665459e-1f));
+    y = V_ADD(V_MUL(y, x), V_SET1(5.0000001201e-1f));
+    y = V_ADD(V_ADD(V_MUL(y, z), x), V_SET1(1.f));
+    // Multiply by 2^fx by adding fx to the exponent
+    VI e = VI_SLLI(VI_ADD(V_CVTT_I(fx), VI_SET1(127)), 23);
+    return V_MUL(y, VI_CAST_F(e));
+}
+
+// -- 3D Vector data structure, one vector per lane -- //
+typedef struct
+{
+    VF x,y,z;
+} WC_SIMD_NAME(wcVector);
+
+WC_SIMD_TARGET
+static inline WC_SIMD_NAME(wcVector) WC_SIMD_NAME(wcvector)(VF x, VF y, VF z)
+{
+    WC_SIMD_NAME(wcVector) ret;
+    ret.x = x; ret.y = y; ret.z = z;
+    return ret;
+}
+
+WC_SIMD_TARGET
+static inline VF WC_SIMD_NAME(wcVector_dot)(WC_SIMD_NAME(wcVector) a,
+    WC_SIMD_NAME(wcVector) b)
+{
+    return V_ADD(V_ADD(V_MUL(a.x, b.x), V_MUL(a.y, b.y)), V_MUL(a.z, b.z));
+}
+
+WC_SIMD_TARGET
+static inline VF WC_SIMD_NAME(wcVector_magnitude)(WC_SIMD_NAME(wcVector) v)
+{
+    return V_SQRT(WC_SIMD_NAME(wcVector_dot)(v, v));
+}
+
+WC_SIMD_TARGET
+static inline WC_SIMD_NAME(wcVector) WC_SIMD_NAME(wcVector_normalize)(
+    WC_SIMD_NAME(wcVector) v)
+{
+    VF inv_mag = V_DIV(V_SET1(1.f), WC_SIMD_NAME(wcVector_magnitude)(v));
+    return WC_SIMD_NAME(wcvector)(V_MUL(v.x, inv_mag), V_MUL(v.y, inv_mag),
+        V_MUL(v.z, inv_mag));
+}
+
+WC_SIMD_TARGET
+static inline WC_SIMD_NAME(wcVector) WC_SIMD_NAME(wcVector_add)(
+    WC_SIMD_NAME(wcVector) a, WC_SIMD_NAME(wcVector) b)
+{
+    return WC_SIMD_NAME(wcvector)(V_ADD(a.x, b.x), V_ADD(a.y, b.y),
+        V_ADD(a.z, b.z));
+}
+
+// Loads wi and wo of a batch, rotated so that the yarn goes along y
+WC_SIMD_TARGET
+static inline void WC_SIMD_NAME(load_directions)(
+    const wcIntersectionBatch *in, const wcPatternDataBatch *data,
+    uint32_t i, WC_SIMD_NAME(wcVector) *wi, WC_SIMD_NAME(wcVector) *wo)
+{
+    VM weft = V_LOAD_ZERO_MASK_U8(data->warp_above + i);
+    VF wi_x = V_LOAD(in->wi_x + i), wi_y = V_LOAD(in->wi_y + i);
+    VF wo_x = V_LOAD(in->wo_x + i), wo_y = V_LOAD(in->wo_y + i);
+    wi->x = V_SELECT(weft, V_XOR(wi_y, V_SET1(-0.f)), wi_x);
+    wi->y = V_SELECT(weft, wi_x, wi_y);
+    wi->z = V_LOAD(in->wi_z + i);
+    wo->x = V_SELECT(weft, V_XOR(wo_y, V_SET1(-0.f)), wo_x);
+    wo->y = V_SELECT(weft, wo_x, wo_y);
+    wo->z = V_LOAD(in->wo_z + i);
+}
+
+// fc*A, the fiber scattering times the attenuation, shared by both kernels
+WC_SIMD_TARGET
+static inline VF WC_SIMD_NAME(fiber_scattering)(WC_SIMD_NAME(wcVector) wi,
+    WC_SIMD_NAME(wcVector) wo, WC_SIMD_NAME(wcVector) highlight_normal,
+    const wcWeaveParameters *params)
+{
+    // --- Set fc
+    VF cos_x = V_XOR(WC_SIMD_NAME(wcVector_dot)(wi, wo), V_SET1(-0.f));
+    VF fc = V_ADD(V_SET1(params->alpha), V_MUL(WC_SIMD_NAME(v_exp)(
+        V_MUL(V_SET1(params->beta), cos_x)), V_SET1(params->compiled.von_mises_normalization)));
+    // --- Set A
+    VF widotn = WC_SIMD_NAME(wcVector_dot)(wi, highlight_normal);
+    VF wodotn = WC_SIMD_NAME(wcVector_dot)(wo, highlight_normal);
+    VM visible = VM_AND(V_CMPGT(widotn, V_SET1(0.f)),
+        V_CMPGT(wodotn, V_SET1(0.f)));
+    VF A = V_MUL(V_SET1((float)(1.0 / (4.0 * M_PI))),
+        V_DIV(V_MUL(widotn, wodotn), V_ADD(widotn, wodotn)));
+    return V_SELECT(visible, V_MUL(fc, A), V_SET1(0.f));
+}
+
+// Evaluates points i..i+WC_SIMD_WIDTH-1 of the batch
+WC_SIMD_TARGET
+static void WC_SIMD_NAME(eval_filament_specular)(
+    const wcIntersectionBatch *in, const wcPatternDataBatch *data,
+    uint32_t i, float *specular, const wcWeaveParameters *params)
+{
+    WC_SIMD_NAME(wcVector) wi, wo;
+    WC_SIMD_NAME(load_directions)(in, data, i, &wi, &wo);
+    WC_SIMD_NAME(wcVector) wi_plus_wo = WC_SIMD_NAME(wcVector_add)(wi, wo);
+    WC_SIMD_NAME(wcVector) H = WC_SIMD_NAME(wcVector_normalize)(wi_plus_wo);
+
+    VF v = V_LOAD(data->v + i);
+    VF y = V_LOAD(data->y + i);
+    VF umax = V_SET1(params->umax);
+    VF delta_x = V_SET1(params->delta_x);
+
+    VF specular_u = V_ADD(WC_SIMD_NAME(v_atan2)(V_XOR(H.z, V_SET1(-0.f)),
+        H.y), V_SET1((float)M_PI_2));
+    VM mask = V_CMPLT(V_ABS(specular_u), umax);
+
+    VF sin_u, cos_u, sin_v, cos_v;
+    sin_u = WC_SIMD_NAME(v_sincos)(specular_u, &cos_u);
+    sin_v = WC_SIMD_NAME(v_sincos)(v, &cos_v);
+    WC_SIMD_NAME(wcVector) highlight_normal = WC_SIMD_NAME(wcVector_normalize)(
+        WC_SIMD_NAME(wcvector)(sin_v, V_MUL(sin_u, cos_v),
+            V_MUL(cos_u, cos_v)));
+    // The highlight tangent (0, cos_u, -sin_u) is already normalized
+
+    VF specular_y = V_DIV(specular_u, umax);
+    specular_y = V_MIN(specular_y, V_SUB(V_SET1(1.f), delta_x));
+    specular_y = V_MAX(specular_y, V_SUB(delta_x, V_SET1(1.f)));
+    mask = VM_AND(mask, V_CMPLT(V_ABS(V_SUB(specular_y, y)), delta_x));
+
+    VF result = V_SET1(0.f);
+    if(VM_ANY(mask)){
+        // --- Set Gu, using (6)
+        // x component of cross(highlight_tangent, H)
+        VF cross_x = V_ADD(V_MUL(cos_u, H.z), V_MUL(sin_u, H.y));
+        VF Gu = V_DIV(V_ADD(V_SET1(params->compiled.radius_of_curvature), cos_v), V_MUL(
+            WC_SIMD_NAME(wcVector_magnitude)(wi_plus_wo), V_ABS(cross_x)));
+        VF fcA = WC_SIMD_NAME(fiber_scattering)(wi, wo, highlight_normal, params);
+        // reflection = 2*l*umax*fc*Gu*A/delta_x, with l = 2
+        result = V_SELECT(mask, V_MUL(V_MUL(fcA, Gu),
+            V_SET1(4.f*params->umax/params->delta_x)), result);
+    }
+    V_STORE(specular + i, result);
+}
+
+// Evaluates points i..i+WC_SIMD_WIDTH-1 of the batch
+WC_SIMD_TARGET
+static void WC_SIMD_NAME(eval_staple_specular)(
+    const wcIntersectionBatch *in, const wcPatternDataBatch *data,
+    uint32_t i, float *specular, const wcWeaveParameters *params)
+{
+    WC_SIMD_NAME(wcVector) wi, wo;
+    WC_SIMD_NAME(load_directions)(in, data, i, &wi, &wo);
+    WC_SIMD_NAME(wcVector) wi_plus_wo = WC_SIMD_NAME(wcVector_add)(wi, wo);
+    WC_SIMD_NAME(wcVector) H = WC_SIMD_NAME(wcVector_normalize)(wi_plus_wo);
+
+    VF u = V_LOAD(data->u + i);
+    VF x = V_LOAD(data->x + i);
+    VF delta_x = V_SET1(params->delta_x);
+
+    VF sin_u, cos_u;
+    sin_u = WC_SIMD_NAME(v_sincos)(u, &cos_u);
+    VF a = V_ADD(V_MUL(H.y, sin_u), V_MUL(H.z, cos_u));
+    VF D = V_DIV(V_SUB(V_MUL(H.y, cos_u), V_MUL(H.z, sin_u)),
+        V_MUL(V_SQRT(V_ADD(V_MUL(H.x, H.x), V_MUL(a, a))),
+            V_SET1(params->compiled.tan_psi)));
+    VM mask = V_CMPLT(V_ABS(D), V_SET1(1.f));
+    // Keep acos in its domain for the lanes which are masked out
+    D = V_SELECT(mask, D, V_SET1(0.f));
+
+    VF specular_v = V_ADD(WC_SIMD_NAME(v_atan2)(V_XOR(a, V_SET1(-0.f)), H.x),
+        WC_SIMD_NAME(v_acos)(D));
+    mask = VM_AND(mask, V_CMPLT(V_ABS(specular_v), V_SET1((float)M_PI_2)));
+
+    VF specular_x = V_DIV(specular_v, V_SET1((float)M_PI_2));
+    specular_x = V_MIN(specular_x, V_SUB(V_SET1(1.f), delta_x));
+    specular_x = V_MAX(specular_x, V_SUB(delta_x, V_SET1(1.f)));
+    mask = VM_AND(mask, V_CMPLT(V_ABS(V_SUB(specular_x, x)), delta_x));
+
+    VF result = V_SET1(0.f);
+    if(VM_ANY(mask)){
+        VF sin_v, cos_v;
+        sin_v = WC_SIMD_NAME(v_sincos)(specular_v, &cos_v);
+        WC_SIMD_NAME(wcVector) highlight_normal =
+            WC_SIMD_NAME(wcVector_normalize)(WC_SIMD_NAME(wcvector)(sin_v,
+                V_MUL(sin_u, cos_v), V_MUL(cos_u, cos_v)));
+        // --- Set Gv
+        VF Gv = V_DIV(V_ADD(V_SET1(params->compiled.radius_of_curvature), cos_v), V_MUL(V_MUL(
+            WC_SIMD_NAME(wcVector_magnitude)(wi_plus_wo),
+            WC_SIMD_NAME(wcVector_dot)(highlight_normal, H)),
+            V_SET1(params->compiled.abs_sin_psi)));
+        VF fcA = WC_SIMD_NAME(fiber_scattering)(wi, wo, highlight_normal, params);
+        // reflection = 2*w*umax*fc*Gv*A/delta_x, with w = 2
+        result = V_SELECT(mask, V_MUL(V_MUL(fcA, Gv),
+            V_SET1(4.f*params->umax/params->delta_x)), result);
+    }
+    V_STORE(specular + i, result);
+}
+
+// Evaluates the first num - num%WC_SIMD_WIDTH points of the batch and
+// returns how many were evaluated
+WC_SIMD_TARGET
+static uint32_t WC_SIMD_NAME(eval_specular)(const wcIntersectionBatch *in,
+    const wcPatternDataBatch *data, uint32_t num, float *specular,
+    const wcWeaveParameters *params, uint8_t filament)
+{
+    uint32_t i;
+    uint32_t num_simd = num - num%WC_SIMD_WIDTH;
+    if(filament){
+        for(i=0;i<num_simd;i+=WC_SIMD_WIDTH){
+            WC_SIMD_NAME(eval_filament_specular)(in, data, i, specular, params);
+        }
+    } else {
+        for(i=0;i<num_simd;i+=WC_SIMD_WIDTH){
+            WC_SIMD_NAME(eval_staple_specular)(in, data, i, specular, params);
+        }
+    }
+    return num_simd;
+}
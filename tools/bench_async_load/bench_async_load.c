@@ -0,0 +1,158 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Loads a number of materials from WIF files, first one at a time with
+// wcWeavePatternFromFile, then all at once with wcWeavePatternFromFileAsync,
+// with and without a provisional normalization. Prints how long the caller
+// is blocked before it can go on with other work, and how long it takes
+// until all materials can be used. Checks that the asynchronous loads give
+// the same patterns and normalizations, and that a provisional
+// normalization is the one from the table until wcFinishWeavePattern.
+// The normalization cache is not used.
+// Usage: bench_async_load [materials_per_file] [file.wif ...]
+
+static const char *default_files[] = {
+    "../../src/wif/data/2229.wif",
+    "../../src/wif/data/41753.wif",
+    "../../example_scenes/monkeytowel/18067.wif",
+    "../../example_scenes/monkeytowel/34779.wif",
+    "../../example_scenes/monkeytowel/55116.wif",
+};
+
+// Every material has different parameters, so that the normalization is
+// computed for each of them
+static void set_params(wcWeaveParameters *params, int i)
+{
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = 0.3f + 0.01f*(float)i;
+    params->psi = (i & 1) ? 0.5f : 0.f;
+    params->alpha = 0.05f;
+    params->beta = 2.f;
+    params->delta_x = 0.5f;
+    params->specular_strength = 0.5f;
+    params->intensity_fineness = 2.f;
+    params->normalization_cache_dir = "";
+}
+
+static int same_pattern(const wcWeaveParameters *a,
+    const wcWeaveParameters *b)
+{
+    if(!a->pattern || !b->pattern){
+        return a->pattern == b->pattern;
+    }
+    // Skip the header, which points into the block
+    size_t size = wif_pattern_memory(a->pattern);
+    return a->pattern_width == b->pattern_width
+        && a->pattern_height == b->pattern_height
+        && size == wif_pattern_memory(b->pattern)
+        && memcmp(a->pattern + 1, b->pattern + 1,
+            size - sizeof(PackedPattern)) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    int per_file = argc > 1 ? atoi(argv[1]) : 4;
+    const char **files = default_files;
+    int num_files = sizeof(default_files)/sizeof(default_files[0]);
+    if(argc > 2){
+        files = (const char**)(argv + 2);
+        num_files = argc - 2;
+    }
+    if(per_file < 1){
+        per_file = 1;
+    }
+    int num = per_file*num_files;
+    wcWeaveParameters *sync = (wcWeaveParameters*)
+        calloc(num, sizeof(wcWeaveParameters));
+    wcWeaveParameters *async = (wcWeaveParameters*)
+        calloc(num, sizeof(wcWeaveParameters));
+    wcWeavePatternLoad **loads = (wcWeavePatternLoad**)
+        calloc(num, sizeof(wcWeavePatternLoad*));
+    int failed = 0;
+    int i;
+
+    printf("%d materials\n", num);
+    printf("%-24s %12s %12s\n", "", "blocked (ms)", "ready (ms)");
+    double start = seconds();
+    for(i=0;i<num;i++){
+        set_params(sync + i, i);
+        wcWeavePatternFromFile(sync + i, files[i % num_files]);
+        if(!sync[i].pattern){
+            printf("could not load %s\n", files[i % num_files]);
+            failed = 1;
+        }
+    }
+    double time = seconds() - start;
+    printf("%-24s %12.3f %12.3f\n", "wcWeavePatternFromFile", 1000.0*time,
+        1000.0*time);
+
+    for(int provisional=0;provisional<2;provisional++){
+        start = seconds();
+        for(i=0;i<num;i++){
+            set_params(async + i, i);
+            loads[i] = wcWeavePatternFromFileAsync(async + i,
+                files[i % num_files], provisional);
+        }
+        double blocked = seconds() - start;
+        for(i=0;i<num;i++){
+            wcWaitForWeavePattern(loads[i]);
+        }
+        time = seconds() - start;
+        printf("%-24s %12.3f %12.3f\n", provisional ?
+            "async, provisional" : "async", 1000.0*blocked, 1000.0*time);
+
+        for(i=0;i<num;i++){
+            if(!wcWeavePatternReady(loads[i])){
+                printf("material %d is not ready after waiting\n", i);
+                failed = 1;
+            }
+            if(!same_pattern(sync + i, async + i)){
+                printf("material %d has a different pattern\n", i);
+                failed = 1;
+            }
+            if(!sync[i].pattern){
+                wcFinishWeavePattern(loads[i]);
+                continue;
+            }
+            float expected = sync[i].specular_normalization;
+            if(provisional){
+                float table = wcSpecularNormalizationFromTable(async + i);
+                if(table >= 0.f){
+                    expected = table;
+                }
+            }
+            if(async[i].specular_normalization != expected){
+                printf("material %d has normalization %g before "
+                    "wcFinishWeavePattern, expected %g\n", i,
+                    async[i].specular_normalization, expected);
+                failed = 1;
+            }
+            wcFinishWeavePattern(loads[i]);
+            if(async[i].specular_normalization
+                    != sync[i].specular_normalization
+                    || async[i].normalization_samples
+                    != sync[i].normalization_samples){
+                printf("material %d has normalization %g, expected %g\n",
+                    i, async[i].specular_normalization,
+                    sync[i].specular_normalization);
+                failed = 1;
+            }
+            wcFreeWeavePattern(async + i);
+        }
+    }
+
+    for(i=0;i<num;i++){
+        wcFreeWeavePattern(sync + i);
+    }
+    free(sync);
+    free(async);
+    free(loads);
+    if(failed){
+        printf("FAILED\n");
+    }
+    return failed;
+}
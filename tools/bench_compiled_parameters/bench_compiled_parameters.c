@@ -0,0 +1,122 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Shows how much time per evaluation is saved by reading the values in
+// wcWeaveParameters::compiled instead of recomputing them. For each
+// configuration, the time of wcGetPatternData + wcEvalSpecular is compared
+// with the time it takes to recompute what is now stored in compiled,
+// i.e. what every evaluation used to spend on it. This is an upper bound,
+// since R and I0 used to be computed only for points in a highlight.
+// Usage: bench_compiled_parameters [num_samples]
+
+typedef struct
+{
+    const char *name;
+    float psi;
+    uint8_t realworld_uv;
+} Config;
+
+static const Config configs[] = {
+    {"filament",              0.f,  0},
+    {"staple",                0.5f, 0},
+    {"staple, realworld uv",  0.5f, 1},
+};
+
+// Same as besselI0 in woven_cloth.cpp
+static float bessel_I0(float b)
+{
+    float I0, absB = fabsf(b);
+    if (fabsf(b) <= 3.75f) {
+        float t = absB / 3.75f;
+        t = t * t;
+        I0 = 1.0f + t*(3.5156229f + t*(3.0899424f + t*(1.2067492f
+            + t*(0.2659732f + t*(0.0360768f + t*0.0045813f)))));
+    } else {
+        float t = 3.75f / absB;
+        I0 = expf(absB) / sqrtf(absB) * (0.39894228f + t*(0.01328592f
+            + t*(0.00225319f + t*(-0.00157565f + t*(0.00916281f
+            + t*(-0.02057706f + t*(0.02635537f + t*(-0.01647633f
+            + t*0.00392377f))))))));
+    }
+    return I0;
+}
+
+int main(int argc, char **argv)
+{
+    int num_samples = argc > 1 ? atoi(argv[1]) : 1000000;
+    wcIntersectionData *samples = (wcIntersectionData*)malloc(
+        num_samples*sizeof(wcIntersectionData));
+    srand(1);
+    for(int i=0;i<num_samples;i++){
+        wcIntersectionData *s = samples + i;
+        s->uv_x = (float)rand()/(float)RAND_MAX;
+        s->uv_y = (float)rand()/(float)RAND_MAX;
+        random_direction(&s->wi_x, &s->wi_y, &s->wi_z);
+        random_direction(&s->wo_x, &s->wo_y, &s->wo_z);
+    }
+    uint8_t warp_above[] = {1,0,0,1, 0,1,1,0, 1,1,0,0, 0,0,1,1};
+    float warp_color[] = {0.8f, 0.2f, 0.2f};
+    float weft_color[] = {0.2f, 0.2f, 0.8f};
+
+    printf("%d samples\n", num_samples);
+    printf("%-24s %12s %16s %8s\n", "", "eval (ns)", "recompute (ns)",
+        "saved");
+    for(size_t c=0;c<sizeof(configs)/sizeof(*configs);c++){
+        wcWeaveParameters params;
+        memset(&params, 0, sizeof(params));
+        params.uscale = params.vscale = 4.f;
+        params.umax = 0.7f;
+        params.psi = configs[c].psi;
+        params.alpha = 0.05f;
+        params.beta = 2.f;
+        params.delta_x = 0.5f;
+        params.specular_strength = 0.5f;
+        params.realworld_uv = configs[c].realworld_uv;
+        params.pattern_realwidth = params.pattern_realheight = 10.f;
+        wcWeavePatternFromData(&params, warp_above, warp_color, weft_color,
+            4, 4);
+        // Read through a volatile pointer so that the compiler can't hoist
+        // the recomputation out of the loop
+        volatile wcWeaveParameters *vparams = &params;
+
+        float sum = 0.f;
+        clock_t start = clock();
+        for(int i=0;i<num_samples;i++){
+            wcPatternData data = wcGetPatternData(samples[i], &params);
+            sum += wcEvalSpecular(samples[i], data, &params);
+        }
+        double t_eval = (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+
+        start = clock();
+        for(int i=0;i<num_samples;i++){
+            float u_scale = vparams->uscale, v_scale = vparams->vscale;
+            if(vparams->realworld_uv){
+                u_scale /= vparams->pattern_realwidth;
+                v_scale /= vparams->pattern_realheight;
+            }
+            float R = 1.f/sinf(vparams->umax);
+            float I0 = bessel_I0(vparams->beta);
+            sum += u_scale + v_scale + R + I0;
+            if(vparams->psi > 0.001f){
+                sum += tanf(vparams->psi) + fabsf(sinf(vparams->psi));
+            }
+        }
+        double t_recompute = (double)(clock() - start)
+            /(double)CLOCKS_PER_SEC;
+
+        printf("%-24s %12.2f %16.2f %7.1f%%\n", configs[c].name,
+            1e9*t_eval/num_samples, 1e9*t_recompute/num_samples,
+            100.0*t_recompute/(t_eval + t_recompute));
+        wcFreeWeavePattern(&params);
+        if(sum == 0.f){
+            printf("(sum is zero)\n");
+        }
+    }
+    free(samples);
+    return 0;
+}
@@ -0,0 +1,311 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Times loading WIF files, a large generated pattern and a generated WIF
+// file with more than 256 colors (which has 16 bit color indices) from
+// their source and as compiled weave files, compared to just opening and
+// closing the
+// compiled file. The normalization cache is not used. Checks that the
+// compiled files load to the same patterns and normalization, that files
+// with a broken header are rejected, and that a file with garbage data
+// can be shaded (build with -fsanitize=address to check the reads).
+// Usage: bench_compiled_weave [directory for the files] [repetitions]
+
+static const char *wif_files[] = {
+    "../../src/wif/data/2229.wif",
+    "../../src/wif/data/41753.wif",
+    "../../example_scenes/monkeytowel/18067.wif",
+    "../../example_scenes/monkeytowel/34779.wif",
+    "../../example_scenes/monkeytowel/55116.wif",
+};
+#define NUM_WIF_FILES (sizeof(wif_files)/sizeof(wif_files[0]))
+#define LARGE_SIZE 2048
+#define WIDE_THREADS 512
+#define WIDE_COLORS 300
+
+// A random draft on 8 shafts, where the threads cycle through the colors
+static uint32_t straight_draw(const ToolDraft *d, uint32_t i)
+{
+    return i % d->shafts;
+}
+
+static uint32_t cycled_color(const ToolDraft *d, uint32_t i)
+{
+    return i % d->colors;
+}
+
+static int random_tieup(const ToolDraft *d, uint32_t treadle,
+    uint32_t shaft)
+{
+    return draft_value(treadle*d->shafts + shaft, 2, 2);
+}
+
+static void random_palette(const ToolDraft *d, uint32_t i, uint32_t rgb[3])
+{
+    (void)d;
+    rgb[0] = draft_value(i, 3, 256);
+    rgb[1] = draft_value(i, 4, 256);
+    rgb[2] = draft_value(i, 5, 256);
+}
+
+static void set_params(wcWeaveParameters *params)
+{
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = 0.7f;
+    params->psi = 0.5f;
+    params->alpha = 0.05f;
+    params->beta = 2.f;
+    params->delta_x = 0.5f;
+    params->specular_strength = 0.5f;
+    params->normalization_cache_dir = "";
+}
+
+static int same_pattern(const wcWeaveParameters *a,
+    const wcWeaveParameters *b)
+{
+    if(!a->pattern || !b->pattern
+            || a->pattern_width != b->pattern_width
+            || a->pattern_height != b->pattern_height
+            || a->pattern_realwidth != b->pattern_realwidth
+            || a->pattern_realheight != b->pattern_realheight
+            || a->specular_normalization != b->specular_normalization){
+        return 0;
+    }
+    uint32_t x, y;
+    for(y=0;y<a->pattern_height;y++){
+        for(x=0;x<a->pattern_width;x++){
+            if(wif_pattern_warp_above(a->pattern, x, y)
+                    != wif_pattern_warp_above(b->pattern, x, y)
+                    || memcmp(wif_pattern_color(a->pattern, x, y),
+                        wif_pattern_color(b->pattern, x, y),
+                        3*sizeof(float))){
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static double time_open(const char *filename, int repetitions)
+{
+    double start = seconds();
+    for(int r=0;r<repetitions;r++){
+        FILE *f = fopen(filename, "rb");
+        if(f){
+            fclose(f);
+        }
+    }
+    return (seconds() - start)/repetitions;
+}
+
+static double time_compiled(wcWeaveParameters *params,
+    const char *filename, int repetitions)
+{
+    double start = seconds();
+    for(int r=0;r<repetitions;r++){
+        if(r > 0){
+            wcFreeWeavePattern(params);
+        }
+        set_params(params);
+        wcWeavePatternFromCompiledWeave(params, filename);
+    }
+    return (seconds() - start)/repetitions;
+}
+
+// Writes a copy of the first size bytes of the file, with the bytes from
+// first to last-1 set to value
+static void write_broken(const char *from, const char *to, long size,
+    long first, long last, uint8_t value)
+{
+    FILE *f = fopen(from, "rb");
+    uint8_t *data = (uint8_t*)malloc(size);
+    size_t read = fread(data, 1, size, f);
+    fclose(f);
+    for(long i=first;i<last && i<size;i++){
+        data[i] = value;
+    }
+    f = fopen(to, "wb");
+    fwrite(data, 1, read, f);
+    fclose(f);
+    free(data);
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 1 ? argv[1] : ".";
+    int repetitions = argc > 2 ? atoi(argv[2]) : 20;
+    char filename[1024], broken[1024];
+    int failed = 0;
+    wcWeaveParameters source, compiled;
+
+    // The normalization does not depend on the pattern
+    set_params(&source);
+    source.umax = 0.6f;
+    wcWeavePatternFromFile(&source, wif_files[0]);
+    float other_normalization = source.specular_normalization;
+    wcFreeWeavePattern(&source);
+
+    printf("%-12s %10s %12s %12s %12s %12s\n", "", "size",
+        "source (ms)", "no norm (ms)", "cweave (ms)", "open (ms)");
+    for(uint32_t i=0;i<NUM_WIF_FILES+2;i++){
+        const char *name;
+        double start, source_time, parse_time;
+        sprintf(filename, "%s/bench%u.cweave", dir, i);
+        if(i < NUM_WIF_FILES){
+            name = strrchr(wif_files[i], '/') + 1;
+            // Without the normalization, which the compiled file stores
+            set_params(&source);
+            source.normalization_table = 1;
+            start = seconds();
+            wcWeavePatternFromFile(&source, wif_files[i]);
+            parse_time = seconds() - start;
+            wcFreeWeavePattern(&source);
+            set_params(&source);
+            start = seconds();
+            wcWeavePatternFromFile(&source, wif_files[i]);
+            source_time = seconds() - start;
+        }else if(i == NUM_WIF_FILES + 1){
+            ToolDraft draft = {WIDE_THREADS, WIDE_THREADS, 8, 8,
+                WIDE_COLORS, straight_draw, straight_draw, cycled_color,
+                cycled_color, random_tieup, random_palette};
+            char wif[1024];
+            name = "300 colors";
+            sprintf(wif, "%s/bench_colors.wif", dir);
+            write_draft(wif, &draft);
+            set_params(&source);
+            source.normalization_table = 1;
+            start = seconds();
+            wcWeavePatternFromFile(&source, wif);
+            parse_time = seconds() - start;
+            wcFreeWeavePattern(&source);
+            set_params(&source);
+            start = seconds();
+            wcWeavePatternFromFile(&source, wif);
+            source_time = seconds() - start;
+            remove(wif);
+            if(source.pattern && source.pattern->color_index_size != 2){
+                printf("%s does not have 16 bit color indices\n", wif);
+                failed = 1;
+            }
+        }else{
+            // A large pattern with random warp_above and a few colors
+            name = "generated";
+            uint8_t *warp_above = (uint8_t*)malloc(LARGE_SIZE*LARGE_SIZE);
+            float *warp_color = (float*)malloc(3*LARGE_SIZE*sizeof(float));
+            float *weft_color = (float*)malloc(3*LARGE_SIZE*sizeof(float));
+            uint32_t state = 1;
+            for(uint32_t j=0;j<LARGE_SIZE*LARGE_SIZE;j++){
+                state = state*1664525u + 1013904223u;
+                warp_above[j] = (state >> 31) & 1;
+            }
+            for(uint32_t j=0;j<3*LARGE_SIZE;j++){
+                warp_color[j] = 0.25f*(float)(j % 4);
+                weft_color[j] = 0.2f*(float)(j % 5);
+            }
+            set_params(&source);
+            source.normalization_table = 1;
+            start = seconds();
+            wcWeavePatternFromData(&source, warp_above, warp_color,
+                weft_color, LARGE_SIZE, LARGE_SIZE);
+            parse_time = seconds() - start;
+            wcFreeWeavePattern(&source);
+            set_params(&source);
+            start = seconds();
+            wcWeavePatternFromData(&source, warp_above, warp_color,
+                weft_color, LARGE_SIZE, LARGE_SIZE);
+            source_time = seconds() - start;
+            free(warp_above);
+            free(warp_color);
+            free(weft_color);
+        }
+        if(!source.pattern || !wcWriteCompiledWeave(&source, filename)){
+            printf("could not write %s\n", filename);
+            failed = 1;
+            wcFreeWeavePattern(&source);
+            continue;
+        }
+        double compiled_time = time_compiled(&compiled, filename,
+            repetitions);
+        double open_time = time_open(filename, repetitions);
+        FILE *f = fopen(filename, "rb");
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fclose(f);
+        printf("%-12s %10ld %12.3f %12.3f %12.3f %12.3f\n", name, size,
+            1000.0*source_time, 1000.0*parse_time, 1000.0*compiled_time,
+            1000.0*open_time);
+        if(!same_pattern(&source, &compiled)){
+            printf("%s does not load to the same pattern\n", filename);
+            failed = 1;
+        }
+        if(compiled.normalization_samples != source.normalization_samples){
+            printf("%s did not use the stored normalization\n", filename);
+            failed = 1;
+        }
+        wcFreeWeavePattern(&compiled);
+
+        // Other parameters compute the normalization
+        set_params(&compiled);
+        compiled.umax = 0.6f;
+        wcWeavePatternFromFile(&compiled, filename);
+        if(!compiled.pattern || compiled.specular_normalization
+                != other_normalization){
+            printf("%s has the wrong normalization for other parameters\n",
+                filename);
+            failed = 1;
+        }
+        wcFreeWeavePattern(&compiled);
+
+        // Truncated, wrong magic, wrong width, only a part of the header,
+        // width 0, and a width which is a multiple of the repeat but too
+        // large for the stored segment table (65536 more)
+        sprintf(broken, "%s/broken.cweave", dir);
+        long broken_size[6] = {size - 1, size, size, 16, size, size};
+        long broken_first[6] = {size, 0, 24, size, 24, 26};
+        long broken_last[6] = {size, 1, 25, size, 28, 27};
+        uint8_t broken_value[6] = {255, 255, 255, 255, 0, 1};
+        for(int b=0;b<6;b++){
+            write_broken(filename, broken, broken_size[b], broken_first[b],
+                broken_last[b], broken_value[b]);
+            set_params(&compiled);
+            wcWeavePatternFromCompiledWeave(&compiled, broken);
+            if(compiled.pattern){
+                printf("broken file %d was loaded\n", b);
+                failed = 1;
+                wcFreeWeavePattern(&compiled);
+            }
+        }
+        // Garbage after the header
+        write_broken(filename, broken, size, 128, size, 255);
+        set_params(&compiled);
+        wcWeavePatternFromCompiledWeave(&compiled, broken);
+        if(!compiled.pattern){
+            printf("file with garbage data was not loaded\n");
+            failed = 1;
+        }
+        wcIntersectionData intersection;
+        intersection.wi_x = 0.f; intersection.wi_y = 0.f;
+        intersection.wi_z = 1.f;
+        intersection.wo_x = 0.f; intersection.wo_y = 0.6f;
+        intersection.wo_z = 0.8f;
+        for(int u=0;u<100;u++){
+            for(int v=0;v<100;v++){
+                intersection.uv_x = 0.01f*(float)u;
+                intersection.uv_y = 0.01f*(float)v;
+                wcShade(intersection, &compiled);
+            }
+        }
+        wcFreeWeavePattern(&compiled);
+        remove(broken);
+        remove(filename);
+        wcFreeWeavePattern(&source);
+    }
+    if(failed){
+        printf("FAILED\n");
+    }
+    return failed;
+}
@@ -0,0 +1,150 @@
+// finalize_weave_parmeters is static, so include the implementation directly
+#include "../../src/woven_cloth.cpp"
+#include "../common/tool_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Times the computation of specular_normalization in
+// finalize_weave_parmeters for different numbers of threads, with and
+// without SIMD, and compares it to the original serial implementation
+// below. Checks that the result is the same for every number of threads,
+// and that without SIMD it is identical to the original.
+// Usage: bench_normalization [max_threads] [repetitions]
+
+// The normalization as it was before it was threaded
+static float original_normalization(wcWeaveParameters *params)
+{
+    size_t nLocationSamples  = 100;
+    size_t nDirectionSamples = 1000;
+    float highest_result = 0.f;
+    params->specular_normalization = 1.f;
+    for (size_t i=0; i<nLocationSamples; i++) {
+        float result = 0.0f;
+        float halton_point[4];
+        halton_4(i+50,halton_point);
+        wcPatternData pattern_data;
+        pattern_data.x = -1.f + 2.f*halton_point[0];
+        pattern_data.y = -1.f + 2.f*halton_point[1];
+        pattern_data.length = 1.f;
+        pattern_data.width = 1.f;
+        pattern_data.warp_above = 0;
+        calculate_segment_uv_and_normal(&pattern_data, params);
+        pattern_data.total_index_x = 0;
+        pattern_data.total_index_y = 0;
+
+        wcIntersectionData intersection_data;
+        sample_uniform_hemisphere(halton_point[2], halton_point[3],
+            &intersection_data.wi_x, &intersection_data.wi_y,
+            &intersection_data.wi_z);
+
+        for (size_t j=0; j<nDirectionSamples; j++) {
+            float halton_direction[4];
+            halton_4(j+50+nLocationSamples,halton_direction);
+            sample_cosine_hemisphere(halton_direction[0], halton_direction[1],
+                &intersection_data.wo_x, &intersection_data.wo_y,
+                &intersection_data.wo_z);
+            result += wcEvalSpecular(intersection_data,pattern_data,params);
+        }
+        if(result > highest_result){
+            highest_result = result;
+        }
+    }
+    if (highest_result <= 0.0001f){
+        return 0.f;
+    }
+    return (float)nDirectionSamples /highest_result;
+}
+
+static uint32_t float_bits(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t max_threads = argc > 1 ? atoi(argv[1]) : wc_num_cpus();
+    if(max_threads < 1){
+        max_threads = 1;
+    }
+    int repetitions = argc > 2 ? atoi(argv[2]) : 20;
+    int simd_widths[2] = {1, wcGetSimdWidth()};
+    float psis[2] = {0.f, 0.5f};
+    int failed = 0;
+
+    uint8_t warp_above[4] = {1, 0, 0, 1};
+    float warp_color[3] = {0.8f, 0.2f, 0.2f};
+    float weft_color[3] = {0.2f, 0.2f, 0.8f};
+
+    printf("%-10s %8s %8s %12s %12s\n", "", "SIMD", "threads", "time (ms)",
+        "normalization");
+    for(int p=0;p<2;p++){
+        wcWeaveParameters params;
+        memset(&params, 0, sizeof(params));
+        params.uscale = params.vscale = 1.f;
+        params.umax = 0.7f;
+        params.psi = psis[p];
+        params.alpha = 0.05f;
+        params.beta = 2.f;
+        params.delta_x = 0.5f;
+        params.specular_strength = 0.5f;
+        params.segment_lookup = WC_SEGMENT_BITBOARD;
+        params.normalization_threads = 1;
+        wcWeavePatternFromData(&params, warp_above, warp_color, weft_color,
+            2, 2);
+        const char *name = p ? "staple" : "filament";
+
+        double start = seconds();
+        float reference = 0.f;
+        for(int r=0;r<repetitions;r++){
+            reference = original_normalization(&params);
+        }
+        double time = (seconds() - start)/repetitions;
+        printf("%-10s %8s %8d %12.3f %12.8g\n", name, "original", 1,
+            1000.0*time, reference);
+
+        for(int s=0;s<2;s++){
+            wcSetSimdWidth(simd_widths[s]);
+            float first = 0.f;
+            // 1, 2, 4, ... and max_threads
+            uint32_t t = 1;
+            while(1){
+                params.normalization_threads = t;
+                start = seconds();
+                for(int r=0;r<repetitions;r++){
+                    finalize_weave_parmeters(&params);
+                }
+                time = (seconds() - start)/repetitions;
+                float normalization = params.specular_normalization;
+                const char *result = "";
+                if(t == 1){
+                    first = normalization;
+                } else if(float_bits(normalization) != float_bits(first)){
+                    result = " differs from 1 thread";
+                    failed = 1;
+                }
+                if(simd_widths[s] == 1 && float_bits(normalization)
+                        != float_bits(reference)){
+                    result = " differs from original";
+                    failed = 1;
+                }
+                printf("%-10s %8d %8u %12.3f %12.8g%s\n", name,
+                    simd_widths[s], t, 1000.0*time, normalization, result);
+                if(t >= max_threads){
+                    break;
+                }
+                t = 2*t < max_threads ? 2*t : max_threads;
+            }
+            if(simd_widths[1] == 1){
+                break;
+            }
+        }
+        wcFreeWeavePattern(&params);
+    }
+    if(failed){
+        printf("FAILED\n");
+    }
+    return failed;
+}
@@ -0,0 +1,140 @@
+#include "../../src/woven_cloth.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Measures the time spent in wcGetPatternData for each of the example
+// WIF files, using the precomputed segment table (WC_SEGMENT_TABLE) and
+// scanning the bitplanes (WC_SEGMENT_BITBOARD). The results of the two
+// are checked to be bit-identical at several points in every element.
+// Both incoherent (random uv) and coherent (scanline order) lookups are
+// measured. The memory used by the packed pattern is compared to the
+// 16 bytes per element that a plain {warp_above, color[3]} array needs.
+// Usage: bench_pattern_data [num_samples] [file.wif ...]
+
+static const char *default_files[] = {
+    "../../src/wif/data/2229.wif",
+    "../../src/wif/data/41753.wif",
+    "../../example_scenes/monkeytowel/18067.wif",
+    "../../example_scenes/monkeytowel/34779.wif",
+    "../../example_scenes/monkeytowel/55116.wif",
+};
+
+static double time_pattern_data(const wcWeaveParameters *params,
+    const wcIntersectionData *samples, int num_samples, float *checksum)
+{
+    clock_t start = clock();
+    float sum = 0.f;
+    for(int i=0;i<num_samples;i++){
+        wcPatternData data = wcGetPatternData(samples[i], params);
+        sum += data.length + data.width + data.x + data.y;
+    }
+    *checksum = sum;
+    return (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+}
+
+static int bitboard_matches_table(wcWeaveParameters *params)
+{
+    wcSegmentEntry *segment_entry = params->segment_entry;
+    int ret = 1;
+    for(uint32_t y=0;y<params->pattern_height;y++){
+        for(uint32_t x=0;x<params->pattern_width;x++){
+            for(int i=0;i<3;i++){
+                wcIntersectionData sample = {0};
+                sample.uv_x = ((float)x + 0.1f + 0.4f*(float)i)
+                    /(float)params->pattern_width;
+                sample.uv_y = ((float)y + 0.2f + 0.3f*(float)i)
+                    /(float)params->pattern_height;
+                params->segment_entry = segment_entry;
+                wcPatternData a = wcGetPatternData(sample, params);
+                params->segment_entry = 0;
+                wcPatternData b = wcGetPatternData(sample, params);
+                if(a.length != b.length || a.width != b.width
+                        || a.x != b.x || a.y != b.y){
+                    ret = 0;
+                }
+            }
+        }
+    }
+    params->segment_entry = segment_entry;
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    int num_samples = argc > 1 ? atoi(argv[1]) : 4000000;
+    int num_files = argc > 2 ? argc - 2 : 
+        (int)(sizeof(default_files)/sizeof(*default_files));
+    const char **files = argc > 2 ? (const char **)argv + 2 : default_files;
+
+    wcIntersectionData *samples[2];
+    samples[0] = (wcIntersectionData*)calloc(num_samples,
+        sizeof(wcIntersectionData));
+    samples[1] = (wcIntersectionData*)calloc(num_samples,
+        sizeof(wcIntersectionData));
+    int scanline = 2048;
+    srand(1);
+    for(int i=0;i<num_samples;i++){
+        samples[0][i].uv_x = (float)rand()/(float)RAND_MAX;
+        samples[0][i].uv_y = (float)rand()/(float)RAND_MAX;
+        samples[0][i].wi_z = 1.f;
+        samples[1][i].uv_x = (float)(i%scanline)/(float)scanline;
+        samples[1][i].uv_y = (float)(i/scanline)/(float)scanline;
+        samples[1][i].wi_z = 1.f;
+    }
+
+    printf("%-45s %9s %10s %10s %10s %10s %10s %10s %10s\n", "", "",
+        "random", "", "coherent", "", "memory", "", "");
+    printf("%-45s %9s %10s %10s %10s %10s %10s %10s %10s\n", "file", "size",
+        "bits (ns)", "table (ns)", "bits (ns)", "table (ns)", "unpacked",
+        "packed", "segments");
+    for(int f=0;f<num_files;f++){
+        wcWeaveParameters params;
+        memset(&params, 0, sizeof(params));
+        params.uscale = params.vscale = 1.f;
+        params.umax = 0.7f;
+        params.psi = 0.f;
+        params.alpha = 0.05f;
+        params.beta = 2.f;
+        params.delta_x = 0.5f;
+        wcWeavePatternFromFile(&params, files[f]);
+        if(params.pattern_width == 0 || params.pattern_height == 0){
+            printf("%-45s could not be loaded\n", files[f]);
+            continue;
+        }
+
+        char size[32];
+        sprintf(size, "%ux%u", params.pattern_width, params.pattern_height);
+        printf("%-45s %9s", files[f], size);
+        for(int s=0;s<2;s++){
+            float checksum_table, checksum_bits;
+            double t_table = time_pattern_data(&params, samples[s],
+                num_samples, &checksum_table);
+            // Without the table wcGetPatternData scans the bitplanes
+            wcSegmentEntry *segment_entry = params.segment_entry;
+            params.segment_entry = 0;
+            double t_bits = time_pattern_data(&params, samples[s],
+                num_samples, &checksum_bits);
+            params.segment_entry = segment_entry;
+            printf(" %10.2f %10.2f", 1e9*t_bits/num_samples,
+                1e9*t_table/num_samples);
+            if(checksum_bits != checksum_table){
+                printf(" (MISMATCH!)");
+            }
+        }
+        if(!bitboard_matches_table(&params)){
+            printf(" (MISMATCH!)");
+        }
+        size_t num_elements = (size_t)params.pattern_width
+            *params.pattern_height;
+        printf(" %10lu %10lu %10lu\n", (unsigned long)(16*num_elements),
+            (unsigned long)wif_pattern_memory(params.pattern),
+            (unsigned long)(params.segment_entry ?
+                num_elements*sizeof(wcSegmentEntry) : 0));
+        wcFreeWeavePattern(&params);
+    }
+    free(samples[0]);
+    free(samples[1]);
+    return 0;
+}
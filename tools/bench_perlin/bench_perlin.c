@@ -0,0 +1,67 @@
+#include "../../src/woven_cloth.h"
+#include "../../src/perlin.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Compares octavePerlin(x, y, 0, ...) with octavePerlin2f for 1 to 8
+// octaves, on random points in the range yarnVariation uses. Prints the
+// time per call, the largest difference and the mean and standard
+// deviation of both.
+// Usage: bench_perlin [num_samples]
+
+int main(int argc, char **argv)
+{
+    int num_samples = argc > 1 ? atoi(argv[1]) : 1000000;
+    float persistance = 0.5f;
+    float *x = (float*)malloc(num_samples*sizeof(float));
+    float *y = (float*)malloc(num_samples*sizeof(float));
+    double *result_3d = (double*)malloc(num_samples*sizeof(double));
+    float *result_2f = (float*)malloc(num_samples*sizeof(float));
+    srand(1);
+    for(int i=0;i<num_samples;i++){
+        x[i] = 100.f*(float)rand()/(float)RAND_MAX;
+        y[i] = 100.f*(float)rand()/(float)RAND_MAX;
+    }
+
+    printf("%d samples\n", num_samples);
+    printf("%8s %12s %12s %12s %20s %20s\n", "octaves", "3D (ns)",
+        "2D (ns)", "max diff", "3D mean/std", "2D mean/std");
+    for(int octaves=1;octaves<=8;octaves++){
+        clock_t start = clock();
+        for(int i=0;i<num_samples;i++){
+            result_3d[i] = octavePerlin(x[i], y[i], 0, octaves, persistance);
+        }
+        double t_3d = (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+
+        start = clock();
+        for(int i=0;i<num_samples;i++){
+            result_2f[i] = octavePerlin2f(x[i], y[i], octaves, persistance);
+        }
+        double t_2f = (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+
+        double max_diff = 0.0;
+        double sum_3d = 0.0, sum2_3d = 0.0, sum_2f = 0.0, sum2_2f = 0.0;
+        for(int i=0;i<num_samples;i++){
+            double diff = fabs(result_3d[i] - (double)result_2f[i]);
+            if(diff > max_diff){
+                max_diff = diff;
+            }
+            sum_3d += result_3d[i];
+            sum2_3d += result_3d[i]*result_3d[i];
+            sum_2f += result_2f[i];
+            sum2_2f += (double)result_2f[i]*(double)result_2f[i];
+        }
+        double mean_3d = sum_3d/num_samples, mean_2f = sum_2f/num_samples;
+        printf("%8d %12.2f %12.2f %12.3g %9.5f/%-10.5f %9.5f/%-10.5f\n",
+            octaves, 1e9*t_3d/num_samples, 1e9*t_2f/num_samples, max_diff,
+            mean_3d, sqrt(sum2_3d/num_samples - mean_3d*mean_3d),
+            mean_2f, sqrt(sum2_2f/num_samples - mean_2f*mean_2f));
+    }
+    free(x);
+    free(y);
+    free(result_3d);
+    free(result_2f);
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Compares wcShade called once per shading point with wcShadeBatch, for
+// filament (psi = 0) and staple (psi = 0.5) yarn, with and without noise.
+// The batch is run both without SIMD, where the results are checked to be
+// identical to the scalar ones, and with the widest SIMD kernels available.
+// Usage: bench_shading [num_samples] [file.wif]
+
+typedef struct
+{
+    const char *name;
+    float psi;
+    float noise;
+} Config;
+
+static const Config configs[] = {
+    {"filament",         0.f,  0.f},
+    {"staple",           0.5f, 0.f},
+    {"filament + noise", 0.f,  1.f},
+    {"staple + noise",   0.5f, 1.f},
+};
+
+int main(int argc, char **argv)
+{
+    int num_samples = argc > 1 ? atoi(argv[1]) : 1000000;
+    const char *filename = argc > 2 ? argv[2]
+        : "../../example_scenes/monkeytowel/55116.wif";
+
+    float *in = (float*)malloc(8*num_samples*sizeof(float));
+    float *out = (float*)malloc(3*num_samples*sizeof(float));
+    wcIntersectionBatch batch = {in, in + num_samples, in + 2*num_samples,
+        in + 3*num_samples, in + 4*num_samples, in + 5*num_samples,
+        in + 6*num_samples, in + 7*num_samples};
+    wcColorBatch color = {out, out + num_samples, out + 2*num_samples};
+    wcIntersectionData *samples = (wcIntersectionData*)malloc(
+        num_samples*sizeof(wcIntersectionData));
+    srand(1);
+    for(int i=0;i<num_samples;i++){
+        wcIntersectionData *s = samples + i;
+        s->uv_x = (float)rand()/(float)RAND_MAX;
+        s->uv_y = (float)rand()/(float)RAND_MAX;
+        random_direction(&s->wi_x, &s->wi_y, &s->wi_z);
+        random_direction(&s->wo_x, &s->wo_y, &s->wo_z);
+        in[i]                 = s->uv_x;
+        in[i +   num_samples] = s->uv_y;
+        in[i + 2*num_samples] = s->wi_x;
+        in[i + 3*num_samples] = s->wi_y;
+        in[i + 4*num_samples] = s->wi_z;
+        in[i + 5*num_samples] = s->wo_x;
+        in[i + 6*num_samples] = s->wo_y;
+        in[i + 7*num_samples] = s->wo_z;
+    }
+
+    int simd_width = wcGetSimdWidth();
+    printf("%s, %d samples, SIMD width %d\n", filename, num_samples,
+        simd_width);
+    printf("%-20s %12s %12s %12s %10s\n", "", "scalar (ns)", "batch (ns)",
+        "SIMD (ns)", "results");
+    for(size_t c=0;c<sizeof(configs)/sizeof(*configs);c++){
+        wcWeaveParameters params;
+        memset(&params, 0, sizeof(params));
+        params.uscale = params.vscale = 4.f;
+        params.umax = 0.7f;
+        params.psi = configs[c].psi;
+        params.alpha = 0.05f;
+        params.beta = 2.f;
+        params.delta_x = 0.5f;
+        params.specular_strength = 0.5f;
+        params.intensity_fineness = 2.f*configs[c].noise;
+        params.yarnvar_amplitude = 0.5f*configs[c].noise;
+        params.yarnvar_xscale = 1.f;
+        params.yarnvar_yscale = 3.f;
+        params.yarnvar_persistance = 0.5f;
+        params.yarnvar_octaves = 4;
+        wcWeavePatternFromFile(&params, filename);
+
+        clock_t start = clock();
+        int identical = 1;
+        float sum = 0.f;
+        for(int i=0;i<num_samples;i++){
+            wcColor col = wcShade(samples[i], &params);
+            sum += col.r + col.g + col.b;
+        }
+        double t_scalar = (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+
+        start = clock();
+        wcSetSimdWidth(simd_width);
+        wcShadeBatch(&batch, num_samples, &color, &params);
+        double t_simd = (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+
+        start = clock();
+        wcSetSimdWidth(1);
+        wcShadeBatch(&batch, num_samples, &color, &params);
+        double t_batch = (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+        wcSetSimdWidth(simd_width);
+
+        for(int i=0;i<num_samples;i++){
+            wcColor col = wcShade(samples[i], &params);
+            if(col.r != color.r[i] || col.g != color.g[i]
+                    || col.b != color.b[i]){
+                identical = 0;
+            }
+        }
+        printf("%-20s %12.2f %12.2f %12.2f %10s\n", configs[c].name,
+            1e9*t_scalar/num_samples, 1e9*t_batch/num_samples,
+            1e9*t_simd/num_samples, identical ? "identical" : "DIFFERENT");
+        wcFreeWeavePattern(&params);
+        (void)sum;
+    }
+    free(samples);
+    free(in);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Evaluates the diffuse and specular terms of a number of directions (e.g.
+// lights) per shading point, once with wcGetPatternData, wcEvalDiffuse
+// and wcEvalSpecular for every direction, as the integrations did, and once
+// with wcPrepareShadingPoint and wcEvalShadingPoint. Checks that the
+// results are identical and prints the time per direction.
+// Usage: bench_shading_point [num_points] [file.wif]
+
+typedef struct
+{
+    const char *name;
+    float psi;
+    float noise;
+} Config;
+
+static const Config configs[] = {
+    {"filament",         0.f,  0.f},
+    {"staple",           0.5f, 0.f},
+    {"filament + noise", 0.f,  1.f},
+    {"staple + noise",   0.5f, 1.f},
+};
+
+static const int directions_per_point[] = {1, 4, 16, 64};
+#define MAX_DIRECTIONS 64
+
+int main(int argc, char **argv)
+{
+    int num_points = argc > 1 ? atoi(argv[1]) : 20000;
+    const char *filename = argc > 2 ? argv[2]
+        : "../../example_scenes/monkeytowel/55116.wif";
+    int num = num_points*MAX_DIRECTIONS;
+    float *in = (float*)malloc(8*num*sizeof(float));
+    float *out = (float*)malloc(8*num*sizeof(float));
+    int failures = 0;
+    srand(1);
+    for(int i=0;i<num_points;i++){
+        float uv_x = (float)rand()/(float)RAND_MAX;
+        float uv_y = (float)rand()/(float)RAND_MAX;
+        for(int j=0;j<MAX_DIRECTIONS;j++){
+            int k = i*MAX_DIRECTIONS + j;
+            in[k]         = uv_x;
+            in[k +   num] = uv_y;
+            random_direction(in + k + 2*num, in + k + 3*num,
+                in + k + 4*num);
+            random_direction(in + k + 5*num, in + k + 6*num,
+                in + k + 7*num);
+        }
+    }
+
+    printf("%s, %d points\n", filename, num_points);
+    printf("%-20s %10s %14s %14s %10s\n", "", "directions",
+        "per call (ns)", "prepared (ns)", "results");
+    for(size_t c=0;c<sizeof(configs)/sizeof(*configs);c++){
+        wcWeaveParameters params;
+        memset(&params, 0, sizeof(params));
+        params.uscale = params.vscale = 4.f;
+        params.umax = 0.7f;
+        params.psi = configs[c].psi;
+        params.alpha = 0.05f;
+        params.beta = 2.f;
+        params.delta_x = 0.5f;
+        params.specular_strength = 0.5f;
+        params.intensity_fineness = 2.f*configs[c].noise;
+        params.yarnvar_amplitude = 0.5f*configs[c].noise;
+        params.yarnvar_xscale = 1.f;
+        params.yarnvar_yscale = 3.f;
+        params.yarnvar_persistance = 0.5f;
+        params.yarnvar_octaves = 4;
+        params.normalization_table = 1;
+        wcWeavePatternFromFile(&params, filename);
+
+        for(size_t d=0;d<sizeof(directions_per_point)/sizeof(int);d++){
+            int n = directions_per_point[d];
+            int identical = 1;
+            clock_t start = clock();
+            for(int i=0;i<num_points;i++){
+                for(int j=0;j<n;j++){
+                    int k = i*MAX_DIRECTIONS + j;
+                    wcIntersectionData s = {in[k], in[k + num],
+                        in[k + 2*num], in[k + 3*num], in[k + 4*num],
+                        in[k + 5*num], in[k + 6*num], in[k + 7*num]};
+                    wcPatternData data = wcGetPatternData(s, &params);
+                    wcColor diffuse = wcEvalDiffuse(s, data, &params);
+                    out[k]         = diffuse.r;
+                    out[k +   num] = diffuse.g;
+                    out[k + 2*num] = diffuse.b;
+                    out[k + 3*num] = wcEvalSpecular(s, data, &params);
+                }
+            }
+            double t_call = (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+
+            start = clock();
+            for(int i=0;i<num_points;i++){
+                int k = i*MAX_DIRECTIONS;
+                wcShadingPoint point;
+                wcIntersectionBatch directions = {0, 0, in + k + 2*num,
+                    in + k + 3*num, in + k + 4*num, in + k + 5*num,
+                    in + k + 6*num, in + k + 7*num};
+                wcColorBatch diffuse = {out + k + 4*num, out + k + 5*num,
+                    out + k + 6*num};
+                wcPrepareShadingPoint(in[k], in[k + num], &params, &point);
+                wcEvalShadingPoint(&point, &directions, n, &diffuse,
+                    out + k + 7*num, &params);
+            }
+            double t_prepared =
+                (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+
+            for(int i=0;i<num_points;i++){
+                for(int j=0;j<n;j++){
+                    int k = i*MAX_DIRECTIONS + j;
+                    if(memcmp(out + k, out + k + 4*num, sizeof(float))
+                            || memcmp(out + k + num, out + k + 5*num,
+                                sizeof(float))
+                            || memcmp(out + k + 2*num, out + k + 6*num,
+                                sizeof(float))
+                            || memcmp(out + k + 3*num, out + k + 7*num,
+                                sizeof(float))){
+                        identical = 0;
+                    }
+                }
+            }
+            failures += !identical;
+            printf("%-20s %10d %14.2f %14.2f %10s\n",
+                d == 0 ? configs[c].name : "", n,
+                1e9*t_call/((double)num_points*n),
+                1e9*t_prepared/((double)num_points*n),
+                identical ? "identical" : "DIFFERENT");
+        }
+        wcFreeWeavePattern(&params);
+    }
+    free(in);
+    free(out);
+    return failures != 0;
+}
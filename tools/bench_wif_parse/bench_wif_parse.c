@@ -0,0 +1,234 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+// Times wif_read on the example WIF files and on generated jacquard-like
+// drafts with 1k, 10k and 100k threads and tieup lines longer than inih
+// allowed, compared to just reading the file into memory. Prints the peak
+// RSS of the process after reading each draft, next to the size of the
+// WeaveData, which is all wif_read has to keep. The drafts are read in
+// increasing size, so the peak belongs to the latest one. Checks that the
+// generated drafts are read back as they were written.
+// Usage: bench_wif_parse [directory for the generated files] [repetitions]
+
+static const char *wif_files[] = {
+    "../../src/wif/data/2229.wif",
+    "../../src/wif/data/41753.wif",
+    "../../example_scenes/monkeytowel/18067.wif",
+    "../../example_scenes/monkeytowel/34779.wif",
+    "../../example_scenes/monkeytowel/55116.wif",
+};
+#define NUM_WIF_FILES (sizeof(wif_files)/sizeof(wif_files[0]))
+static const uint32_t generated_threads[] = {1000, 10000, 100000};
+#define NUM_GENERATED (sizeof(generated_threads)/sizeof(generated_threads[0]))
+// Each tieup line lifts half of the shafts, about 600 characters
+#define SHAFTS 256
+#define TREADLES 256
+#define COLORS 8
+
+static double peak_rss_mb(void)
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return 1e-6*(double)counters.PeakWorkingSetSize;
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return 1e-3*(double)usage.ru_maxrss;
+#endif
+}
+
+static double weave_data_mb(const WeaveData *data)
+{
+    return 1e-6*(double)(sizeof(WeaveData)
+        + data->num_shafts*data->num_treadles*sizeof(uint8_t)
+        + (2*data->warp.num_threads + 2*data->weft.num_threads)
+            *sizeof(uint32_t)
+        + 3*data->num_colors*sizeof(float));
+}
+
+// A twill-like draft where the threading, treadling and colors are
+// pseudo random functions of the thread index
+static uint32_t random_threading(const ToolDraft *d, uint32_t i)
+{
+    return draft_value(i, 4, d->shafts);
+}
+
+static uint32_t random_treadling(const ToolDraft *d, uint32_t i)
+{
+    return draft_value(i, 5, d->treadles);
+}
+
+static uint32_t random_warp_color(const ToolDraft *d, uint32_t i)
+{
+    return draft_value(i, 6, d->colors);
+}
+
+static uint32_t random_weft_color(const ToolDraft *d, uint32_t i)
+{
+    return draft_value(i, 7, d->colors);
+}
+
+// Treadle t lifts shafts t..t+SHAFTS/2-1, so every tieup line lists half
+// of the shafts
+static int twill_tieup(const ToolDraft *d, uint32_t treadle, uint32_t shaft)
+{
+    return (shaft + d->shafts - treadle)%d->shafts < d->shafts/2;
+}
+
+static void random_palette(const ToolDraft *d, uint32_t i, uint32_t rgb[3])
+{
+    (void)d;
+    rgb[0] = draft_value(i, 1, 256);
+    rgb[1] = draft_value(i, 2, 256);
+    rgb[2] = draft_value(i, 3, 256);
+}
+
+static int write_random_draft(const char *filename, uint32_t threads)
+{
+    ToolDraft d = {threads, threads, SHAFTS, TREADLES, COLORS,
+        random_threading, random_treadling, random_warp_color,
+        random_weft_color, twill_tieup, random_palette};
+    return write_draft(filename, &d);
+}
+
+static int check_draft(const WeaveData *data, uint32_t threads)
+{
+    uint32_t i, j;
+    if(data->warp.num_threads != threads || data->weft.num_threads != threads
+            || data->num_shafts != SHAFTS || data->num_treadles != TREADLES
+            || data->num_colors != COLORS || !data->tieup
+            || !data->threading || !data->treadling || !data->colors
+            || !data->warp.colors || !data->weft.colors){
+        return 0;
+    }
+    for(i=0;i<COLORS;i++){
+        if(data->colors[3*i] != (float)draft_value(i, 1, 256)/255.f
+                || data->colors[3*i + 2] != (float)draft_value(i, 3, 256)/255.f){
+            return 0;
+        }
+    }
+    for(i=0;i<TREADLES;i++){
+        for(j=0;j<SHAFTS;j++){
+            // Entry i lifts shafts i+1..i+SHAFTS/2, counted from the end
+            uint32_t shaft = SHAFTS - 1 - j;
+            uint8_t lifted = (shaft + SHAFTS - i)%SHAFTS < SHAFTS/2;
+            if(data->tieup[(TREADLES - 1 - i) + j*TREADLES] != lifted){
+                return 0;
+            }
+        }
+    }
+    for(i=0;i<threads;i++){
+        if(data->threading[i] != SHAFTS - 1 - draft_value(i, 4, SHAFTS)
+                || data->treadling[i]
+                    != TREADLES - 1 - draft_value(i, 5, TREADLES)
+                || data->warp.colors[i] != draft_value(i, 6, COLORS)
+                || data->weft.colors[i] != draft_value(i, 7, COLORS)){
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Best time of reading the file into memory, and of wif_read
+static void time_file(const char *filename, int repetitions,
+    double *read_time, double *parse_time, long *size)
+{
+    int r;
+    *read_time = *parse_time = 1e30;
+    *size = 0;
+    for(r=0;r<repetitions;r++){
+        double t = seconds();
+        FILE *f = fopen(filename, "rb");
+        char *buffer;
+        if(!f){
+            return;
+        }
+        fseek(f, 0, SEEK_END);
+        *size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        buffer = (char*)malloc((size_t)*size);
+        if(fread(buffer, 1, (size_t)*size, f) != (size_t)*size){
+            *size = 0;
+        }
+        fclose(f);
+        free(buffer);
+        t = seconds() - t;
+        if(t < *read_time){
+            *read_time = t;
+        }
+
+        t = seconds();
+        wif_free_weavedata(wif_read(filename));
+        t = seconds() - t;
+        if(t < *parse_time){
+            *parse_time = t;
+        }
+    }
+}
+
+static void print_times(const char *name, double read_time,
+    double parse_time, long size)
+{
+    printf("%-44s %9ld B  read %8.3f ms  wif_read %8.3f ms  %7.1f MB/s\n",
+        name, size, 1e3*read_time, 1e3*parse_time,
+        1e-6*(double)size/parse_time);
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 1 ? argv[1] : ".";
+    int repetitions = argc > 2 ? atoi(argv[2]) : 10;
+    int failures = 0;
+    uint32_t i;
+    double read_time, parse_time;
+    long size;
+
+    for(i=0;i<NUM_WIF_FILES;i++){
+        time_file(wif_files[i], repetitions, &read_time, &parse_time, &size);
+        if(size == 0){
+            printf("Could not read %s\n", wif_files[i]);
+            continue;
+        }
+        print_times(wif_files[i], read_time, parse_time, size);
+    }
+    printf("peak RSS before the generated drafts %.1f MB\n", peak_rss_mb());
+    for(i=0;i<NUM_GENERATED;i++){
+        char filename[1024];
+        char name[64];
+        WeaveData *data;
+        double rss, data_size;
+        sprintf(filename, "%s/bench_wif_parse_%u.wif", dir,
+            generated_threads[i]);
+        if(!write_random_draft(filename, generated_threads[i])){
+            printf("Could not write %s\n", filename);
+            return 1;
+        }
+        data = wif_read(filename);
+        rss = peak_rss_mb();
+        if(!check_draft(data, generated_threads[i])){
+            printf("FAILED: %u thread draft was not read back correctly\n",
+                generated_threads[i]);
+            failures++;
+        }
+        data_size = weave_data_mb(data);
+        wif_free_weavedata(data);
+        time_file(filename, repetitions, &read_time, &parse_time, &size);
+        sprintf(name, "generated, %u threads", generated_threads[i]);
+        print_times(name, read_time, parse_time, size);
+        printf("%-44s peak RSS %.1f MB, WeaveData %.2f MB\n", "", rss,
+            data_size);
+        remove(filename);
+    }
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures != 0;
+}
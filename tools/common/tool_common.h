@@ -0,0 +1,124 @@
+#ifndef TOOL_COMMON_H
+#define TOOL_COMMON_H
+
+// Helpers shared by the benchmarks and tests in tools/. Everything is
+// static inline, so a tool can include this without a separate object
+// file or warnings for what it does not use.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// Monotonic wall clock time in seconds
+static inline double seconds(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER count, frequency;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return (double)count.QuadPart/(double)frequency.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+#endif
+}
+
+// In [0,1), from rand()
+static inline float uniform(void)
+{
+    return (float)rand()/((float)RAND_MAX + 1.f);
+}
+
+// Uniformly distributed over the angles of the hemisphere around z, from
+// rand()
+static inline void random_direction(float *x, float *y, float *z)
+{
+    float phi = 6.2831853f*(float)rand()/(float)RAND_MAX;
+    float cos_theta = (float)rand()/(float)RAND_MAX;
+    float sin_theta = sqrtf(1.f - cos_theta*cos_theta);
+    *x = sin_theta*cosf(phi);
+    *y = sin_theta*sinf(phi);
+    *z = cos_theta;
+}
+
+// Pseudo random value in [0,n) for index i, used to generate drafts
+static inline uint32_t draft_value(uint32_t i, uint32_t seed, uint32_t n)
+{
+    uint32_t h = (i + 1)*2654435761u ^ seed*40503u;
+    return (h ^ (h >> 15))%n;
+}
+
+// A generated draft. The callbacks give the zero based shaft of warp
+// thread i, the treadle of weft thread i, the colors of the threads,
+// whether a treadle lifts a shaft and the components of palette entry i
+// in [0,255].
+typedef struct ToolDraft ToolDraft;
+struct ToolDraft
+{
+    uint32_t warp_threads, weft_threads, shafts, treadles, colors;
+    uint32_t (*threading)(const ToolDraft *d, uint32_t i);
+    uint32_t (*treadling)(const ToolDraft *d, uint32_t i);
+    uint32_t (*warp_color)(const ToolDraft *d, uint32_t i);
+    uint32_t (*weft_color)(const ToolDraft *d, uint32_t i);
+    int (*tieup)(const ToolDraft *d, uint32_t treadle, uint32_t shaft);
+    void (*palette)(const ToolDraft *d, uint32_t i, uint32_t rgb[3]);
+};
+
+// Writes d as a WIF file, returns 0 if the file could not be opened
+static inline int write_draft(const char *filename, const ToolDraft *d)
+{
+    FILE *f = fopen(filename, "wb");
+    uint32_t i, j;
+    if(!f){
+        return 0;
+    }
+    fprintf(f, "[WIF]\nVersion=1.1\n[WEAVING]\nShafts=%u\nTreadles=%u\n"
+        "[COLOR PALETTE]\nEntries=%u\nRange=0,255\n[COLOR TABLE]\n",
+        d->shafts, d->treadles, d->colors);
+    for(i=0;i<d->colors;i++){
+        uint32_t rgb[3];
+        d->palette(d, i, rgb);
+        fprintf(f, "%u=%u,%u,%u\n", i + 1, rgb[0], rgb[1], rgb[2]);
+    }
+    fprintf(f, "[WARP]\nThreads=%u\nSpacing=0.0185\nThickness=0.0213\n"
+        "[WEFT]\nThreads=%u\nSpacing=0.0185\nThickness=0.0213\n[TIEUP]\n",
+        d->warp_threads, d->weft_threads);
+    for(i=0;i<d->treadles;i++){
+        int first = 1;
+        fprintf(f, "%u=", i + 1);
+        for(j=0;j<d->shafts;j++){
+            if(d->tieup(d, i, j)){
+                fprintf(f, first ? "%u" : ",%u", j + 1);
+                first = 0;
+            }
+        }
+        fprintf(f, "\n");
+    }
+    fprintf(f, "[THREADING]\n");
+    for(i=0;i<d->warp_threads;i++){
+        fprintf(f, "%u=%u\n", i + 1, d->threading(d, i) + 1);
+    }
+    fprintf(f, "[TREADLING]\n");
+    for(i=0;i<d->weft_threads;i++){
+        fprintf(f, "%u=%u\n", i + 1, d->treadling(d, i) + 1);
+    }
+    fprintf(f, "[WARP COLORS]\n");
+    for(i=0;i<d->warp_threads;i++){
+        fprintf(f, "%u=%u\n", i + 1, d->warp_color(d, i) + 1);
+    }
+    fprintf(f, "[WEFT COLORS]\n");
+    for(i=0;i<d->weft_threads;i++){
+        fprintf(f, "%u=%u\n", i + 1, d->weft_color(d, i) + 1);
+    }
+    fclose(f);
+    return 1;
+}
+
+#endif
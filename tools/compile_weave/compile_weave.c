@@ -0,0 +1,132 @@
+#include "../../src/woven_cloth.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Converts a .wif or .weave file to a compiled weave file, which loads
+// without parsing. The specular normalization is stored for the given
+// parameters (the defaults are those of the Mitsuba plugin), and is used
+// when the file is loaded with the same ones, on a machine with the same
+// SIMD width. Loads the written file again to check it.
+// Usage: compile_weave [options] input output.cweave
+//   -umax, -psi, -alpha, -beta, -deltaX, -tolerance <value>
+//   -no_normalization  Don't store the normalization
+
+static void usage(void)
+{
+    printf("Usage: compile_weave [options] input output.cweave\n"
+        "  -umax, -psi, -alpha, -beta, -deltaX <value>\n"
+        "      Parameters to store the specular normalization for\n"
+        "  -tolerance <value>\n"
+        "      normalization_tolerance, 0 (the default) for a fixed number"
+        " of samples\n"
+        "  -no_normalization\n"
+        "      Don't store the normalization\n");
+}
+
+int main(int argc, char **argv)
+{
+    wcWeaveParameters params;
+    memset(&params, 0, sizeof(params));
+    params.uscale = params.vscale = 1.f;
+    params.umax = 0.7f;
+    params.psi = 1.5707964f;
+    params.alpha = 0.05f;
+    params.beta = 2.f;
+    params.delta_x = 0.5f;
+    params.specular_strength = 0.5f;
+    const char *input = 0, *output = 0;
+    int store_normalization = 1;
+    int i;
+    for(i=1;i<argc;i++){
+        float *value = 0;
+        if(strcmp(argv[i], "-umax") == 0){
+            value = &params.umax;
+        }else if(strcmp(argv[i], "-psi") == 0){
+            value = &params.psi;
+        }else if(strcmp(argv[i], "-alpha") == 0){
+            value = &params.alpha;
+        }else if(strcmp(argv[i], "-beta") == 0){
+            value = &params.beta;
+        }else if(strcmp(argv[i], "-deltaX") == 0){
+            value = &params.delta_x;
+        }else if(strcmp(argv[i], "-tolerance") == 0){
+            value = &params.normalization_tolerance;
+        }else if(strcmp(argv[i], "-no_normalization") == 0){
+            // Skips computing it, if the parameters are in the table
+            params.normalization_table = 1;
+            store_normalization = 0;
+        }else if(argv[i][0] == '-'){
+            usage();
+            return 1;
+        }else if(!input){
+            input = argv[i];
+        }else if(!output){
+            output = argv[i];
+        }else{
+            usage();
+            return 1;
+        }
+        if(value){
+            if(i + 1 >= argc){
+                usage();
+                return 1;
+            }
+            *value = (float)atof(argv[++i]);
+        }
+    }
+    if(!input || !output){
+        usage();
+        return 1;
+    }
+
+    wcWeavePatternFromFile(&params, input);
+    if(!params.pattern){
+        printf("Could not load %s\n", input);
+        return 1;
+    }
+    if(!store_normalization){
+        params.normalization_samples = 0;
+    }
+    if(!wcWriteCompiledWeave(&params, output)){
+        printf("Could not write %s\n", output);
+        wcFreeWeavePattern(&params);
+        return 1;
+    }
+    printf("%s: %ux%u elements, %u colors, %g x %g\n", output,
+        params.pattern_width, params.pattern_height,
+        params.pattern->num_colors, params.pattern_realwidth,
+        params.pattern_realheight);
+    if(params.normalization_samples){
+        printf("specular_normalization %g (relative error %.2g, %u samples)"
+            "\n", params.specular_normalization, params.normalization_error,
+            params.normalization_samples);
+    }
+
+    // Check that it loads to the same pattern
+    wcWeaveParameters check = params;
+    wcWeavePatternFromCompiledWeave(&check, output);
+    int failed = !check.pattern
+        || check.pattern_width != params.pattern_width
+        || check.pattern_height != params.pattern_height
+        || check.specular_normalization != params.specular_normalization;
+    uint32_t x, y;
+    for(y=0;!failed && y<params.pattern_height;y++){
+        for(x=0;x<params.pattern_width;x++){
+            if(wif_pattern_warp_above(params.pattern, x, y)
+                    != wif_pattern_warp_above(check.pattern, x, y)
+                    || memcmp(wif_pattern_color(params.pattern, x, y),
+                        wif_pattern_color(check.pattern, x, y),
+                        3*sizeof(float))){
+                failed = 1;
+                break;
+            }
+        }
+    }
+    if(failed){
+        printf("%s does not load to the same pattern\n", output);
+    }
+    wcFreeWeavePattern(&check);
+    wcFreeWeavePattern(&params);
+    return failed;
+}
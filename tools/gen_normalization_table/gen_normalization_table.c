@@ -0,0 +1,206 @@
+// The table lookup is static, so include the implementation directly
+#include "../../src/woven_cloth.cpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// Generates src/normalization_table.h. Computes the specular normalization
+// without SIMD, so that the table does not depend on the machine, on the
+// grid below. Then measures the interpolation error at random points
+// inside the table, and writes it to the header too.
+// Usage: gen_normalization_table [output.h] [num_test_points]
+// Takes about 10 minutes on one core; the normalization uses all of them.
+
+// Close to 0 the normalization changes quickly with psi, so the staple
+// table starts at 0.01. Above about alpha = 0.2 and beta = 5 it is close
+// to linear and constant, respectively.
+static const float umax[] = {0.05f, 0.15f, 0.3f, 0.5f, 0.7f, 0.95f, 1.25f,
+    1.5707964f};
+static const float psi[] = {0.01f, 0.02f, 0.05f, 0.1f, 0.2f, 0.35f, 0.55f,
+    0.8f, 1.15f, 1.5707964f};
+static const float alpha[] = {0.f, 0.05f, 0.1f, 0.15f, 0.25f, 1.f};
+static const float beta[] = {0.f, 0.5f, 1.f, 2.f, 3.5f, 5.f, 10.f};
+static const float delta_x[] = {0.02f, 0.05f, 0.1f, 0.15f, 0.2f, 0.25f, 0.3f,
+    0.35f, 0.4f, 0.5f, 0.6f, 0.8f, 1.f};
+
+#define SIZE(a) (sizeof(a)/sizeof(*a))
+
+static wcWeaveParameters params;
+
+// 1/specular_normalization, which is what the table holds
+static float compute(float u, float p, float a, float b, float d)
+{
+    params.umax = u;
+    params.psi = p;
+    params.alpha = a;
+    params.beta = b;
+    params.delta_x = d;
+    wcUpdateWeaveParameters(&params);
+    return params.specular_normalization > 0.f ?
+        1.f/params.specular_normalization : 0.f;
+}
+
+static float random_float(uint32_t *state, float min, float max)
+{
+    *state = *state*1664525u + 1013904223u;
+    return min + (max - min)*(float)(*state >> 8)*(1.f/16777216.f);
+}
+
+static int compare_floats(const void *a, const void *b)
+{
+    float fa = *(const float*)a, fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+static void write_array(FILE *f, const char *name, const char *size,
+        const float *values, size_t num, int digits, int per_line)
+{
+    fprintf(f, "WC_PREFIX\nstatic const float %s[\n    %s] = {", name, size);
+    for(size_t i=0;i<num;i++){
+        char number[32];
+        snprintf(number, sizeof(number), "%.*g", digits, values[i]);
+        // 1f is not a float literal, 1.f is
+        fprintf(f, "%s%s%sf,", i % per_line ? " " : "\n    ", number,
+            strpbrk(number, ".e") ? "" : ".");
+    }
+    fprintf(f, "\n};\n\n");
+}
+
+// Tests the table at num random points, and writes the relative error
+// percentiles to line
+static void test(const wcNormalizationTable *table, int staple, int num,
+        char *line, size_t line_size)
+{
+    float *error = (float*)malloc(num*sizeof(float));
+    uint32_t state = 1 + staple;
+    for(int i=0;i<num;i++){
+        float x[5];
+        x[0] = random_float(&state, umax[0], umax[SIZE(umax)-1]);
+        x[1] = staple ? random_float(&state, psi[0], psi[SIZE(psi)-1]) : 0.f;
+        x[2] = random_float(&state, alpha[0], alpha[SIZE(alpha)-1]);
+        x[3] = random_float(&state, beta[0], beta[SIZE(beta)-1]);
+        x[4] = random_float(&state, delta_x[0], delta_x[SIZE(delta_x)-1]);
+        float reference = compute(x[0], x[1], x[2], x[3], x[4]);
+        float y[5] = {x[0], x[2], x[3], x[4]};
+        float value = normalization_table_lookup(table, staple ? x : y);
+        error[i] = fabsf(value - reference)/reference;
+    }
+    qsort(error, num, sizeof(float), compare_floats);
+    snprintf(line, line_size, "median %.2f%%, 90%%: %.2f%%, 99%%: %.1f%%, "
+        "max %.1f%%", 100.f*error[num/2], 100.f*error[num*9/10],
+        100.f*error[num*99/100], 100.f*error[num-1]);
+    free(error);
+}
+
+int main(int argc, char **argv)
+{
+    const char *filename = argc > 1 ? argv[1]
+        : "../../src/normalization_table.h";
+    int num_test_points = argc > 2 ? atoi(argv[2]) : 2000;
+    if(num_test_points < 1){
+        num_test_points = 1;
+    }
+
+    uint8_t warp_above[4] = {1, 0, 0, 1};
+    float color[3] = {1.f, 1.f, 1.f};
+    memset(&params, 0, sizeof(params));
+    params.uscale = params.vscale = 1.f;
+    params.segment_lookup = WC_SEGMENT_BITBOARD;
+    params.normalization_cache_dir = "";
+    wcWeavePatternFromData(&params, warp_above, color, color, 2, 2);
+    wcSetSimdWidth(1);
+
+    size_t num_filament = SIZE(umax)*SIZE(alpha)*SIZE(beta)*SIZE(delta_x);
+    size_t num_staple = num_filament*SIZE(psi);
+    float *filament = (float*)malloc(num_filament*sizeof(float));
+    float *staple = (float*)malloc(num_staple*sizeof(float));
+    size_t n = 0, m = 0;
+    for(size_t u=0;u<SIZE(umax);u++){
+        for(size_t a=0;a<SIZE(alpha);a++){
+            for(size_t b=0;b<SIZE(beta);b++){
+                for(size_t d=0;d<SIZE(delta_x);d++){
+                    filament[n++] = compute(umax[u], 0.f, alpha[a], beta[b],
+                        delta_x[d]);
+                }
+            }
+        }
+        for(size_t p=0;p<SIZE(psi);p++){
+            for(size_t a=0;a<SIZE(alpha);a++){
+                for(size_t b=0;b<SIZE(beta);b++){
+                    for(size_t d=0;d<SIZE(delta_x);d++){
+                        staple[m++] = compute(umax[u], psi[p], alpha[a],
+                            beta[b], delta_x[d]);
+                    }
+                }
+            }
+        }
+        printf("umax %zu/%zu\n", u + 1, SIZE(umax));
+    }
+
+    wcNormalizationTable filament_table = {4,
+        {umax, alpha, beta, delta_x},
+        {SIZE(umax), SIZE(alpha), SIZE(beta), SIZE(delta_x)}, filament};
+    wcNormalizationTable staple_table = {5,
+        {umax, psi, alpha, beta, delta_x},
+        {SIZE(umax), SIZE(psi), SIZE(alpha), SIZE(beta), SIZE(delta_x)},
+        staple};
+    char filament_error[256], staple_error[256];
+    test(&filament_table, 0, num_test_points, filament_error,
+        sizeof(filament_error));
+    test(&staple_table, 1, num_test_points, staple_error,
+        sizeof(staple_error));
+    printf("filament: %s\nstaple:   %s\n", filament_error, staple_error);
+
+    FILE *f = fopen(filename, "wt");
+    if(!f){
+        printf("Could not open %s\n", filename);
+        return 1;
+    }
+    fprintf(f, "#pragma once\n"
+        "// Generated by tools/gen_normalization_table, don't edit.\n"
+        "// 1/specular_normalization as computed when a pattern is loaded"
+        " (without\n"
+        "// SIMD), on a grid over the yarn parameters. Relative error of"
+        " the\n"
+        "// interpolated normalization at %d random points in the table:\n"
+        "//   filament: %s\n"
+        "//   staple:   %s\n\n", num_test_points, filament_error,
+        staple_error);
+    const char *names[5] = {"UMAX", "PSI", "ALPHA", "BETA", "DELTA_X"};
+    const float *axes[5] = {umax, psi, alpha, beta, delta_x};
+    size_t sizes[5] = {SIZE(umax), SIZE(psi), SIZE(alpha), SIZE(beta),
+        SIZE(delta_x)};
+    for(int i=0;i<5;i++){
+        fprintf(f, "#define WC_NORMALIZATION_TABLE_%s_SIZE %zu\n", names[i],
+            sizes[i]);
+    }
+    fprintf(f, "\n");
+    for(int i=0;i<5;i++){
+        char name[64], size[64];
+        snprintf(name, sizeof(name), "wc_normalization_table_%s", names[i]);
+        for(char *c=name;*c;c++){
+            *c = (char)tolower(*c);
+        }
+        snprintf(size, sizeof(size), "WC_NORMALIZATION_TABLE_%s_SIZE",
+            names[i]);
+        write_array(f, name, size, axes[i], sizes[i], 9, 5);
+    }
+    fprintf(f, "// [umax][alpha][beta][delta_x]\n");
+    write_array(f, "wc_normalization_table_filament_values",
+        "WC_NORMALIZATION_TABLE_UMAX_SIZE*WC_NORMALIZATION_TABLE_ALPHA_SIZE\n"
+        "    *WC_NORMALIZATION_TABLE_BETA_SIZE"
+        "*WC_NORMALIZATION_TABLE_DELTA_X_SIZE", filament, num_filament, 6, 5);
+    fprintf(f, "// [umax][psi][alpha][beta][delta_x]\n");
+    write_array(f, "wc_normalization_table_staple_values",
+        "WC_NORMALIZATION_TABLE_UMAX_SIZE*WC_NORMALIZATION_TABLE_PSI_SIZE\n"
+        "    *WC_NORMALIZATION_TABLE_ALPHA_SIZE"
+        "*WC_NORMALIZATION_TABLE_BETA_SIZE\n"
+        "    *WC_NORMALIZATION_TABLE_DELTA_X_SIZE", staple, num_staple, 6, 5);
+    fclose(f);
+    printf("Wrote %s\n", filename);
+    free(filament);
+    free(staple);
+    wcFreeWeavePattern(&params);
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Compares the adaptive specular normalization estimator to the fixed one
+// for a range of materials, from diffuse-like staple yarn to sharp filament
+// highlights. For each tolerance it prints the normalization, the reported
+// error and the number of specular evaluations and load time, and checks
+// the result against a reference computed with a tolerance of 1e-4 (as
+// many directions as the estimator allows). Fails if the error of the
+// reference is larger than the reported error by more than 4 times for
+// more than 5% of the materials, or if the result depends on the number of
+// threads.
+// Usage: test_adaptive_normalization [threads]
+
+typedef struct
+{
+    const char *name;
+    float umax, psi, alpha, beta, delta_x;
+} Material;
+
+static const Material materials[] = {
+    {"filament sharp",   0.7f,  0.f,  0.01f, 8.f,  0.1f},
+    {"filament",         0.7f,  0.f,  0.05f, 2.f,  0.5f},
+    {"filament flat",    0.2f,  0.f,  0.05f, 4.f,  0.3f},
+    {"filament wide",    1.2f,  0.f,  0.2f,  1.f,  0.8f},
+    {"filament diffuse", 0.5f,  0.f,  0.5f,  0.f,  1.f},
+    {"staple sharp",     0.7f,  0.2f, 0.01f, 8.f,  0.1f},
+    {"staple",           0.7f,  0.5f, 0.05f, 2.f,  0.5f},
+    {"staple twisted",   0.5f,  1.2f, 0.1f,  1.f,  0.3f},
+    {"staple flat",      0.2f,  0.3f, 0.05f, 4.f,  0.3f},
+    {"staple diffuse",   0.5f,  0.8f, 0.5f,  0.f,  1.f},
+};
+#define NUM_MATERIALS (sizeof(materials)/sizeof(materials[0]))
+
+static void load(wcWeaveParameters *params, const Material *m,
+    float tolerance, uint32_t threads)
+{
+    uint8_t warp_above[4] = {1, 0, 0, 1};
+    float warp_color[3] = {0.8f, 0.2f, 0.2f};
+    float weft_color[3] = {0.2f, 0.2f, 0.8f};
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = m->umax;
+    params->psi = m->psi;
+    params->alpha = m->alpha;
+    params->beta = m->beta;
+    params->delta_x = m->delta_x;
+    params->specular_strength = 0.5f;
+    params->normalization_cache_dir = "";
+    params->normalization_threads = threads;
+    params->normalization_tolerance = tolerance;
+    wcWeavePatternFromData(params, warp_above, warp_color, weft_color, 2, 2);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t threads = argc > 1 ? (uint32_t)atoi(argv[1]) : 0;
+    float tolerances[] = {0.f, 0.05f, 0.02f, 0.01f, 0.005f};
+    int num_tolerances = sizeof(tolerances)/sizeof(tolerances[0]);
+    int failed = 0, num_checked = 0, num_outside = 0;
+
+    printf("%-17s %9s %12s %9s %9s %9s %9s\n", "", "tolerance",
+        "normalization", "error", "actual", "samples", "time (ms)");
+    for(uint32_t i=0;i<NUM_MATERIALS;i++){
+        const Material *m = materials + i;
+        wcWeaveParameters params;
+        load(&params, m, 1e-4f, threads);
+        float reference = params.specular_normalization;
+        printf("%-17s %9s %12.6g %9.2e %9s %9u\n", m->name, "reference",
+            reference, params.normalization_error, "",
+            params.normalization_samples);
+        wcFreeWeavePattern(&params);
+
+        for(int t=0;t<num_tolerances;t++){
+            double start = seconds();
+            load(&params, m, tolerances[t], threads);
+            double time = seconds() - start;
+            float normalization = params.specular_normalization;
+            float error = params.normalization_error;
+            double actual = reference > 0.f ?
+                fabs(normalization - reference)/reference : 0.0;
+            const char *result = "";
+            num_checked++;
+            if(actual > 4.0*error + 1e-6){
+                num_outside++;
+                result = " outside";
+            }
+            printf("%-17s %9g %12.6g %9.2e %9.2e %9u %9.3f%s\n", "",
+                tolerances[t], normalization, error, actual,
+                params.normalization_samples, 1000.0*time, result);
+            wcFreeWeavePattern(&params);
+
+            // The rounds do not depend on the number of threads
+            wcWeaveParameters other;
+            load(&other, m, tolerances[t], threads == 1 ? 3 : 1);
+            if(memcmp(&other.specular_normalization, &normalization,
+                    sizeof(float)) != 0
+                    || other.normalization_samples
+                        != params.normalization_samples){
+                printf("%-17s %9g differs with other number of threads\n",
+                    "", tolerances[t]);
+                failed = 1;
+            }
+            wcFreeWeavePattern(&other);
+        }
+    }
+    printf("%d of %d results are further from the reference than 4 times "
+        "the reported error\n", num_outside, num_checked);
+    if(num_outside*20 > num_checked){
+        failed = 1;
+    }
+    if(failed){
+        printf("FAILED\n");
+    }
+    return failed;
+}
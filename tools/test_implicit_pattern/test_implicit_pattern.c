@@ -0,0 +1,220 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Loads generated drafts as dense and implicit patterns (with
+// implicit_pattern_threshold) and checks that wcGetPatternData and wcShade
+// give identical results for both, with and without the segment table.
+// Prints the memory of the patterns and the time per shading point. The
+// largest draft is only loaded implicitly, since its dense pattern would
+// take about 12 GB. A draft whose threads use more than 256 colors has
+// 16 bit color indices, and has to give the same results as well.
+// Usage: test_implicit_pattern [directory for the generated files]
+//     [num_samples]
+
+typedef struct
+{
+    uint32_t warp_threads, weft_threads, shafts, treadles;
+    int dense; //Whether to load it as a dense pattern too
+    uint32_t colors;
+} Draft;
+
+static const Draft drafts[] = {
+    {1500,   1000,   8,   6,   1, 12},
+    {4096,   4096,   16,  16,  1, 12},
+    {3000,   2000,   300, 200, 1, 12},
+    {100000, 100000, 32,  32,  0, 12},
+    {3000,   2000,   8,   6,   1, 300},
+};
+#define NUM_DRAFTS (sizeof(drafts)/sizeof(drafts[0]))
+
+// Threading and treadling are runs of straight and pointed draws, so that
+// there are floats of different lengths, and the tieup is random
+static uint32_t draw(uint32_t i, uint32_t seed, uint32_t n)
+{
+    uint32_t block = i/n;
+    uint32_t j = i%n;
+    return draft_value(block, seed, 2) ? j : n - 1 - j;
+}
+
+static uint32_t threading(const ToolDraft *d, uint32_t i)
+{
+    return draw(i, 5, d->shafts);
+}
+
+static uint32_t treadling(const ToolDraft *d, uint32_t i)
+{
+    return draw(i, 7, d->treadles);
+}
+
+static uint32_t warp_color(const ToolDraft *d, uint32_t i)
+{
+    return draft_value(i/7, 9, d->colors);
+}
+
+static uint32_t weft_color(const ToolDraft *d, uint32_t i)
+{
+    return draft_value(i/5, 10, d->colors);
+}
+
+static int tieup(const ToolDraft *d, uint32_t treadle, uint32_t shaft)
+{
+    return draft_value(treadle*d->shafts + shaft, 4, 5) < 2;
+}
+
+static void palette(const ToolDraft *d, uint32_t i, uint32_t rgb[3])
+{
+    (void)d;
+    rgb[0] = draft_value(i, 1, 256);
+    rgb[1] = draft_value(i, 2, 256);
+    rgb[2] = draft_value(i, 3, 256);
+}
+
+static int write_generated_draft(const char *filename, const Draft *draft)
+{
+    ToolDraft d = {draft->warp_threads, draft->weft_threads, draft->shafts,
+        draft->treadles, draft->colors, threading, treadling, warp_color,
+        weft_color, tieup, palette};
+    return write_draft(filename, &d);
+}
+
+static void load(wcWeaveParameters *params, const char *filename,
+    uint32_t threshold, uint8_t segment_lookup)
+{
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = 0.7f;
+    params->psi = 0.5f;
+    params->alpha = 0.05f;
+    params->beta = 2.f;
+    params->delta_x = 0.5f;
+    params->specular_strength = 0.5f;
+    params->intensity_fineness = 2.f;
+    params->normalization_table = 1;
+    params->normalization_cache_dir = "";
+    params->segment_lookup = segment_lookup;
+    params->implicit_pattern_threshold = threshold;
+    wcWeavePatternFromFile(params, filename);
+}
+
+// Time per wcShade in ns, and the results
+static double shade(const wcWeaveParameters *params,
+    const wcIntersectionData *samples, int num_samples, wcColor *result,
+    wcPatternData *pattern_data)
+{
+    int i;
+    double t = seconds();
+    for(i=0;i<num_samples;i++){
+        result[i] = wcShade(samples[i], params);
+    }
+    t = seconds() - t;
+    for(i=0;i<num_samples;i++){
+        pattern_data[i] = wcGetPatternData(samples[i], params);
+    }
+    return 1e9*t/num_samples;
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 1 ? argv[1] : ".";
+    int num_samples = argc > 2 ? atoi(argv[2]) : 200000;
+    wcIntersectionData *samples = (wcIntersectionData*)malloc(
+        num_samples*sizeof(wcIntersectionData));
+    wcColor *results[3];
+    wcPatternData *pattern_data[3];
+    int failures = 0;
+    uint32_t d;
+    int i, k;
+    for(k=0;k<3;k++){
+        results[k] = (wcColor*)malloc(num_samples*sizeof(wcColor));
+        pattern_data[k] = (wcPatternData*)malloc(
+            num_samples*sizeof(wcPatternData));
+    }
+    srand(1);
+    for(i=0;i<num_samples;i++){
+        samples[i].uv_x = 3.f*(float)rand()/(float)RAND_MAX;
+        samples[i].uv_y = 3.f*(float)rand()/(float)RAND_MAX;
+        random_direction(&samples[i].wi_x, &samples[i].wi_y,
+            &samples[i].wi_z);
+        random_direction(&samples[i].wo_x, &samples[i].wo_y,
+            &samples[i].wo_z);
+    }
+
+    printf("%-20s %10s %12s %12s %12s %12s\n", "", "load (ms)",
+        "memory (MB)", "table (ns)", "bitboard (ns)", "results");
+    for(d=0;d<NUM_DRAFTS;d++){
+        char filename[1024];
+        char name[64];
+        wcWeaveParameters params;
+        double t;
+        sprintf(filename, "%s/test_implicit_pattern_%u.wif", dir, d);
+        sprintf(name, "%ux%u, %u/%u, %u", drafts[d].warp_threads,
+            drafts[d].weft_threads, drafts[d].shafts, drafts[d].treadles,
+            drafts[d].colors);
+        if(!write_generated_draft(filename, &drafts[d])){
+            printf("Could not write %s\n", filename);
+            return 1;
+        }
+        if(drafts[d].dense){
+            double time_table, time_bitboard;
+            t = seconds();
+            load(&params, filename, 0, WC_SEGMENT_TABLE);
+            t = seconds() - t;
+            if(!params.pattern || params.pattern->row_index
+                    || params.pattern->color_index_size
+                        != (drafts[d].colors > 256 ? 2u : 1u)){
+                printf("FAILED: %s was not loaded as a dense pattern\n",
+                    name);
+                failures++;
+                wcFreeWeavePattern(&params);
+                continue;
+            }
+            time_table = shade(&params, samples, num_samples, results[0],
+                pattern_data[0]);
+            wcFreeWeavePattern(&params);
+            load(&params, filename, 0, WC_SEGMENT_BITBOARD);
+            time_bitboard = shade(&params, samples, num_samples, results[1],
+                pattern_data[1]);
+            printf("%-20s %10.2f %12.3f %12.1f %12.1f\n", name, 1e3*t,
+                1e-6*(double)wif_pattern_memory(params.pattern), time_table,
+                time_bitboard);
+            wcFreeWeavePattern(&params);
+        }else{
+            printf("%-20s %10s %12s %12s %12s\n", name, "-", "-", "-", "-");
+        }
+
+        t = seconds();
+        load(&params, filename, 1, WC_SEGMENT_TABLE);
+        t = seconds() - t;
+        if(!params.pattern || !params.pattern->row_index
+                || params.segment_entry){
+            printf("FAILED: %s was not loaded as an implicit pattern\n",
+                name);
+            failures++;
+        }else{
+            int same = 1;
+            double time_implicit = shade(&params, samples, num_samples,
+                results[2], pattern_data[2]);
+            if(drafts[d].dense){
+                same = memcmp(results[0], results[2],
+                        num_samples*sizeof(wcColor)) == 0
+                    && memcmp(results[1], results[2],
+                        num_samples*sizeof(wcColor)) == 0
+                    && memcmp(pattern_data[0], pattern_data[2],
+                        num_samples*sizeof(wcPatternData)) == 0;
+                failures += !same;
+            }
+            printf("%-20s %10.2f %12.3f %12s %12.1f %12s\n", "  implicit",
+                1e3*t, 1e-6*(double)wif_pattern_memory(params.pattern), "",
+                time_implicit, drafts[d].dense ? (same ? "identical"
+                    : "DIFFERENT") : "");
+        }
+        wcFreeWeavePattern(&params);
+        remove(filename);
+    }
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures != 0;
+}
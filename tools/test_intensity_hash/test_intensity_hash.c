@@ -0,0 +1,178 @@
+// The hashes are static, so include the implementation directly
+#include "../../src/woven_cloth.cpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Checks that the intensity variation with WC_INTENSITY_MIX has the same
+// distribution as with WC_INTENSITY_TEA. Both hashes are evaluated on a
+// grid of the integer coordinates that intensityVariation passes to them,
+// and the following is tested at the 1% significance level:
+//  - The uniform numbers, with a chi-square test over 100 bins
+//  - The intensities, -log(xi) clamped to 10, against the exponential
+//    distribution with a Kolmogorov-Smirnov test
+//  - TEA against mix, with a two-sample Kolmogorov-Smirnov test
+//  - The correlation between horizontal and vertical neighbours
+// Then the time per call of intensityVariation is measured for both.
+// Usage: test_intensity_hash [grid_size]
+
+#define NUM_BINS 100
+// Critical values for a significance level of 0.01
+#define CHI2_CRITICAL 134.642 // 99 degrees of freedom
+#define KS_CRITICAL   1.628
+
+static int compare_floats(const void *a, const void *b)
+{
+    float fa = *(const float*)a, fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+static float intensity(float xi)
+{
+    float log_xi = -logf(xi);
+    return log_xi < 10.f ? log_xi : 10.f;
+}
+
+static float sample(int hash, uint32_t x, uint32_t y)
+{
+    return hash == WC_INTENSITY_MIX ? sampleMixSingle(x, y)
+        : sampleTEASingle(x, y, 8);
+}
+
+static int check(const char *name, double value, double critical)
+{
+    int ok = fabs(value) < critical;
+    printf("  %-34s %12.5g  (< %.5g) %s\n", name, value, critical,
+        ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t grid_size = argc > 1 ? atoi(argv[1]) : 1024;
+    uint32_t n = grid_size*grid_size;
+    float *values[2];
+    const char *names[2] = {"TEA", "mix"};
+    int hashes[2] = {WC_INTENSITY_TEA, WC_INTENSITY_MIX};
+    int failed = 0;
+
+    for(int h=0;h<2;h++){
+        uint32_t bins[NUM_BINS] = {0};
+        double sum = 0.0, sum2 = 0.0, sum_x = 0.0, sum_y = 0.0;
+        values[h] = (float*)malloc(n*sizeof(float));
+        for(uint32_t y=0;y<grid_size;y++){
+            for(uint32_t x=0;x<grid_size;x++){
+                float xi = sample(hashes[h], x, y);
+                float v = intensity(xi);
+                int bin = (int)(xi*NUM_BINS);
+                bins[bin < NUM_BINS ? bin : NUM_BINS - 1]++;
+                values[h][x + y*grid_size] = v;
+                sum += v;
+                sum2 += v*v;
+            }
+        }
+        double mean = sum/n;
+        double var = sum2/n - mean*mean;
+
+        // Correlation with the neighbour in x and in y
+        float *v = values[h];
+        uint32_t num_pairs = grid_size*(grid_size - 1);
+        for(uint32_t y=0;y<grid_size;y++){
+            for(uint32_t x=0;x+1<grid_size;x++){
+                sum_x += (v[x + y*grid_size] - mean)
+                    *(v[x + 1 + y*grid_size] - mean);
+                sum_y += (v[y + x*grid_size] - mean)
+                    *(v[y + (x + 1)*grid_size] - mean);
+            }
+        }
+        double corr_x = sum_x/num_pairs/var;
+        double corr_y = sum_y/num_pairs/var;
+
+        double chi2 = 0.0;
+        double expected = (double)n/NUM_BINS;
+        for(int i=0;i<NUM_BINS;i++){
+            chi2 += (bins[i] - expected)*(bins[i] - expected)/expected;
+        }
+
+        // Kolmogorov-Smirnov against 1 - exp(-x), truncated at 10
+        qsort(v, n, sizeof(float), compare_floats);
+        double ks = 0.0;
+        for(uint32_t i=0;i<n;i++){
+            double cdf = v[i] < 10.f ? 1.0 - exp(-(double)v[i]) : 1.0;
+            double d = fmax(fabs((double)(i + 1)/n - cdf),
+                fabs((double)i/n - cdf));
+            // Equal values form a single step of the empirical cdf
+            if(i + 1 < n && v[i + 1] == v[i]){
+                continue;
+            }
+            ks = fmax(ks, d);
+        }
+
+        printf("%s: mean %.5f, variance %.5f (exponential: 1, 1)\n",
+            names[h], mean, var);
+        failed |= !check("chi-square of xi", chi2, CHI2_CRITICAL);
+        failed |= !check("Kolmogorov-Smirnov vs exponential", ks*sqrt(n),
+            KS_CRITICAL);
+        failed |= !check("correlation with x neighbour", corr_x*sqrt(num_pairs),
+            3.0);
+        failed |= !check("correlation with y neighbour", corr_y*sqrt(num_pairs),
+            3.0);
+    }
+
+    // Two-sample Kolmogorov-Smirnov, both are sorted
+    {
+        uint32_t i = 0, j = 0;
+        double ks = 0.0;
+        while(i < n && j < n){
+            float x = values[0][i] < values[1][j] ? values[0][i]
+                : values[1][j];
+            while(i < n && values[0][i] <= x) i++;
+            while(j < n && values[1][j] <= x) j++;
+            ks = fmax(ks, fabs((double)i/n - (double)j/n));
+        }
+        printf("TEA vs mix:\n");
+        failed |= !check("two-sample Kolmogorov-Smirnov",
+            ks*sqrt(n/2.0), KS_CRITICAL);
+    }
+
+    // Time intensityVariation on random points of a pattern
+    {
+        uint8_t warp_above[] = {1,0,0,1, 0,1,1,0, 1,1,0,0, 0,0,1,1};
+        float color[] = {1.f, 1.f, 1.f};
+        wcWeaveParameters params;
+        memset(&params, 0, sizeof(params));
+        params.uscale = params.vscale = 100.f;
+        params.umax = 0.7f;
+        params.alpha = 0.05f;
+        params.beta = 2.f;
+        params.delta_x = 0.5f;
+        params.intensity_fineness = 2.f;
+        wcWeavePatternFromData(&params, warp_above, color, color, 4, 4);
+        wcPatternData *data = (wcPatternData*)malloc(n*sizeof(wcPatternData));
+        srand(1);
+        for(uint32_t i=0;i<n;i++){
+            wcIntersectionData in = {0};
+            in.uv_x = (float)rand()/(float)RAND_MAX;
+            in.uv_y = (float)rand()/(float)RAND_MAX;
+            data[i] = wcGetPatternData(in, &params);
+        }
+        printf("intensityVariation:\n");
+        for(int h=0;h<2;h++){
+            float sum = 0.f;
+            clock_t start = clock();
+            for(uint32_t i=0;i<n;i++){
+                sum += intensityVariation(data[i], &params, hashes[h]);
+            }
+            double t = (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+            printf("  %s: %.2f ns per call (mean %.4f)\n", names[h],
+                1e9*t/n, sum/n);
+        }
+        free(data);
+        wcFreeWeavePattern(&params);
+    }
+
+    free(values[0]);
+    free(values[1]);
+    return failed;
+}
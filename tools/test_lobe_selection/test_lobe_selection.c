@@ -0,0 +1,223 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Tests the specular albedo table (albedo_table) and lobe selection with
+// wcSpecularProbability. For a few yarns it prints the time to build the
+// table, and for a range of elevations of wi the tabulated albedo next to
+// a reference, the mean over random points of the pattern and azimuths of
+// wi with cosine weighted wo. It then estimates the reflectance of wcShade
+// (its mean over cosine weighted wo) with one sample at a time, at random
+// points and azimuths: with cosine weighted samples only, and with a
+// mixture of specular and cosine weighted samples where the specular lobe
+// is chosen with probability specular_strength or wcSpecularProbability.
+// The variance per sample of each is printed, and their means should
+// agree.
+// Usage: test_lobe_selection [num_samples]
+
+void sample_cosine_hemisphere(float sample_x, float sample_y, float *p_x,
+        float *p_y, float *p_z);
+
+typedef struct
+{
+    const char *name;
+    float psi, delta_x;
+} Yarn;
+
+static const Yarn yarns[] = {
+    {"filament",             0.f,   0.3f},
+    {"filament, wide",       0.f,   0.8f},
+    {"staple",               0.5f,  0.3f},
+    {"staple, wide",         0.5f,  0.8f},
+};
+#define NUM_YARNS (sizeof(yarns)/sizeof(yarns[0]))
+
+static const float elevations[] = {10.f, 30.f, 50.f, 70.f, 90.f};
+#define NUM_ELEVATIONS (sizeof(elevations)/sizeof(elevations[0]))
+
+// The lobe selection strategies
+#define NUM_STRATEGIES 3
+static const char *strategies[NUM_STRATEGIES] = {"cosine", "strength",
+    "albedo"};
+
+static void init_parameters(wcWeaveParameters *params, const Yarn *yarn)
+{
+    float warp_color[3] = {0.8f, 0.2f, 0.1f};
+    float weft_color[3] = {0.9f, 0.9f, 0.8f};
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = 0.7f;
+    params->psi = yarn->psi;
+    params->alpha = 0.05f;
+    params->beta = 2.f;
+    params->delta_x = yarn->delta_x;
+    params->specular_strength = 0.5f;
+    params->normalization_table = 1;
+    params->normalization_cache_dir = "";
+    params->albedo_table = 1;
+    wcWeavePatternRegular(params, 4, 1, 2, warp_color, weft_color);
+}
+
+// A random point of the pattern, with wi at the given elevation and a
+// random azimuth
+static void random_point(float elevation, wcIntersectionData *intersection,
+    const wcWeaveParameters *params, wcShadingPoint *point)
+{
+    float theta = (90.f - elevation)*(float)M_PI/180.f;
+    float phi = 2.f*(float)M_PI*uniform();
+    memset(intersection, 0, sizeof(*intersection));
+    intersection->uv_x = uniform();
+    intersection->uv_y = uniform();
+    intersection->wi_x = sinf(theta)*cosf(phi);
+    intersection->wi_y = sinf(theta)*sinf(phi);
+    intersection->wi_z = cosf(theta);
+    wcPrepareShadingPoint(intersection->uv_x, intersection->uv_y, params,
+        point);
+}
+
+// The mean of the specular term over random points and cosine weighted wo
+static double reference_albedo(float elevation,
+    const wcWeaveParameters *params, int num_samples)
+{
+    double sum = 0.0;
+    int i;
+    for(i=0;i<num_samples;i++){
+        wcIntersectionData intersection;
+        wcShadingPoint point;
+        random_point(elevation, &intersection, params, &point);
+        sample_cosine_hemisphere(uniform(), uniform(), &intersection.wo_x,
+            &intersection.wo_y, &intersection.wo_z);
+        sum += wcEvalSpecular(intersection, point.data, params);
+    }
+    return sum/num_samples;
+}
+
+// The shaded value weighted by wo_z/pi, i.e. the integrand of the
+// reflectance
+static double reflectance_integrand(const wcIntersectionData *intersection,
+    const wcWeaveParameters *params)
+{
+    wcColor color = wcShade(*intersection, params);
+    return (color.r + color.g + color.b)/3.0*intersection->wo_z/M_PI;
+}
+
+// One sample estimate of the reflectance with the given strategy
+static double estimate_reflectance(float elevation, int strategy,
+    const wcWeaveParameters *params)
+{
+    wcIntersectionData intersection;
+    wcShadingPoint point;
+    random_point(elevation, &intersection, params, &point);
+    float p = 0.f;
+    if(strategy == 1){
+        p = params->specular_strength;
+    }else if(strategy == 2){
+        p = wcSpecularProbability(&point, intersection.wi_z, params);
+    }
+    float sample_x = uniform(), sample_y = uniform();
+    if(sample_x < p){
+        if(wcSampleSpecular(&intersection, point.data, sample_x/p, sample_y,
+                params) <= 0.f){
+            return 0.0;
+        }
+    }else{
+        sample_x = p > 0.f ? (sample_x - p)/(1.f - p) : sample_x;
+        sample_cosine_hemisphere(sample_x, sample_y, &intersection.wo_x,
+            &intersection.wo_y, &intersection.wo_z);
+    }
+    // The density of the mixture, for whichever lobe wo came from
+    double pdf = (1.0 - p)*intersection.wo_z/M_PI;
+    if(p > 0.f){
+        pdf += p*wcPdfSpecular(intersection, point.data, params);
+    }
+    if(pdf <= 0.0){
+        return 0.0;
+    }
+    return reflectance_integrand(&intersection, params)/pdf;
+}
+
+int main(int argc, char **argv)
+{
+    int num_samples = argc > 1 ? atoi(argv[1]) : 200000;
+    int failures = 0;
+    uint32_t y, e, k;
+    srand(1);
+    for(y=0;y<NUM_YARNS;y++){
+        wcWeaveParameters params;
+        double start, with_table, without_table;
+        init_parameters(&params, &yarns[y]);
+
+        // With normalization_table, the table is most of the update
+        start = seconds();
+        wcUpdateWeaveParameters(&params);
+        with_table = seconds() - start;
+        params.albedo_table = 0;
+        start = seconds();
+        wcUpdateWeaveParameters(&params);
+        without_table = seconds() - start;
+        params.albedo_table = 1;
+        wcUpdateWeaveParameters(&params);
+        printf("%s: albedo table built in %.2f ms\n", yarns[y].name,
+            1000.0*(with_table - without_table));
+
+        printf("%5s %9s %9s %7s", "elev", "table", "reference", "error");
+        for(k=0;k<NUM_STRATEGIES;k++){
+            printf(" %10s", strategies[k]);
+        }
+        printf(" %10s %6s %7s\n", "mean", "ratio", "p(spec)");
+        for(e=0;e<NUM_ELEVATIONS;e++){
+            float wi_z = sinf(elevations[e]*(float)M_PI/180.f);
+            double table = wcSpecularAlbedo(wi_z, &params);
+            double reference = reference_albedo(elevations[e], &params,
+                num_samples);
+            double mean[NUM_STRATEGIES], variance[NUM_STRATEGIES];
+            double probability = 0.0;
+            int i, ok;
+            for(k=0;k<NUM_STRATEGIES;k++){
+                double sum = 0.0, sum_sq = 0.0;
+                for(i=0;i<num_samples;i++){
+                    double f = estimate_reflectance(elevations[e], k,
+                        &params);
+                    sum += f;
+                    sum_sq += f*f;
+                }
+                mean[k] = sum/num_samples;
+                variance[k] = sum_sq/num_samples - mean[k]*mean[k];
+            }
+            for(i=0;i<num_samples/100;i++){
+                wcIntersectionData intersection;
+                wcShadingPoint point;
+                random_point(elevations[e], &intersection, &params, &point);
+                probability += wcSpecularProbability(&point,
+                    intersection.wi_z, &params);
+            }
+            printf("%5.0f %9.4f %9.4f %6.1f%%", elevations[e], table,
+                reference, reference > 0.0
+                    ? 100.0*(table - reference)/reference : 0.0);
+            for(k=0;k<NUM_STRATEGIES;k++){
+                printf(" %10.4g", variance[k]);
+            }
+            // All strategies estimate the same reflectance
+            ok = 1;
+            for(k=1;k<NUM_STRATEGIES;k++){
+                double error = sqrt((variance[0] + variance[k])/num_samples);
+                ok = ok && fabs(mean[k] - mean[0]) <= 5.0*error + 1e-6;
+            }
+            printf(" %10.4g %6.2f %7.2f %s\n", mean[0],
+                variance[2] > 0.0 ? variance[0]/variance[2] : 0.0,
+                probability/(num_samples/100), ok ? "" : "FAILED");
+            failures += !ok;
+        }
+        printf("\n");
+        wcFreeWeavePattern(&params);
+    }
+    if(failures){
+        printf("%d tests FAILED\n", failures);
+        return 1;
+    }
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include "../../src/woven_cloth.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Tests the specular normalization cache. Loads patterns with a number of
+// parameter combinations without the cache, then twice with it, and checks
+// that the normalization is the same every time. Then does the same after
+// overwriting the entries with garbage, and after overwriting the header,
+// when the file is not used (so the loads are as slow as without a cache)
+// until it is removed and created again.
+// Usage: test_normalization_cache [cache_dir]
+
+#define CACHE_FILE "woven_cloth_normalization.cache"
+#define NUM_PARAMS 64
+
+static void set_params(wcWeaveParameters *params, int i)
+{
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = 0.3f + 0.01f*(float)i;
+    params->psi = (i & 1) ? 0.5f : 0.f;
+    params->alpha = 0.05f;
+    params->beta = 2.f + 0.1f*(float)(i % 7);
+    params->delta_x = 0.5f;
+    params->specular_strength = 0.5f;
+}
+
+static float load(wcWeaveParameters *params, const char *dir)
+{
+    uint8_t warp_above[4] = {1, 0, 0, 1};
+    float warp_color[3] = {0.8f, 0.2f, 0.2f};
+    float weft_color[3] = {0.2f, 0.2f, 0.8f};
+    // An empty string turns off the cache, even if WC_NORMALIZATION_CACHE
+    // is set
+    params->normalization_cache_dir = dir;
+    wcWeavePatternFromData(params, warp_above, warp_color, weft_color, 2, 2);
+    float normalization = params->specular_normalization;
+    wcFreeWeavePattern(params);
+    return normalization;
+}
+
+// Loads all parameter combinations, and returns the number of mismatches
+static int check(const char *name, const char *dir, const float *reference)
+{
+    int errors = 0;
+    clock_t start = clock();
+    for(int i=0;i<NUM_PARAMS;i++){
+        wcWeaveParameters params;
+        set_params(&params, i);
+        float normalization = load(&params, dir);
+        if(memcmp(&reference[i], &normalization, sizeof(float)) != 0){
+            errors++;
+        }
+    }
+    double time = (double)(clock() - start)/CLOCKS_PER_SEC;
+    printf("%-28s %10.3f ms per load  %s\n", name, 1000.0*time/NUM_PARAMS,
+        errors ? "FAILED" : "ok");
+    return errors;
+}
+
+static void overwrite(const char *filename, long offset, long size)
+{
+    FILE *f = fopen(filename, offset ? "r+b" : "wb");
+    if(f){
+        fseek(f, offset, SEEK_SET);
+        for(long i=0;i<size;i++){
+            fputc((int)(i*37 + 11) & 0xff, f);
+        }
+        fclose(f);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 1 ? argv[1] : ".";
+    char filename[4096];
+    snprintf(filename, sizeof(filename), "%s/%s", dir, CACHE_FILE);
+    remove(filename);
+
+    float reference[NUM_PARAMS];
+    clock_t start = clock();
+    for(int i=0;i<NUM_PARAMS;i++){
+        wcWeaveParameters params;
+        set_params(&params, i);
+        reference[i] = load(&params, "");
+    }
+    double time = (double)(clock() - start)/CLOCKS_PER_SEC;
+    printf("%-28s %10.3f ms per load\n", "no cache",
+        1000.0*time/NUM_PARAMS);
+
+    int errors = 0;
+    errors += check("empty cache", dir, reference);
+    errors += check("filled cache", dir, reference);
+    // Leave the 16 byte header, overwrite the 1024 44 byte entries
+    overwrite(filename, 16, 1024*44);
+    errors += check("garbage entries", dir, reference);
+    errors += check("refilled cache", dir, reference);
+    overwrite(filename, 0, 100);
+    errors += check("garbage file, not used", dir, reference);
+    remove(filename);
+    errors += check("removed file", dir, reference);
+    errors += check("refilled cache", dir, reference);
+    remove(filename);
+    return errors != 0;
+}
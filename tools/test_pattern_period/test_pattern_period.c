@@ -0,0 +1,188 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Loads WIF files, which are compacted to their smallest repeat, and checks
+// that wcGetPatternData and wcShade give identical results to the whole
+// pattern, as read by wif_get_pattern. Both the segment table and the
+// bitboard lookup are checked. Prints the repeat, the memory of the
+// pattern before and after and the time per shading point with each.
+// Besides the given files, a draft with a small repeat woven across many
+// threads is generated.
+// Usage: test_pattern_period [directory for the generated file]
+//     [num_samples] [file.wif ...]
+
+// A 2/2 twill on 8 shafts with a striped warp and weft, repeating every
+// 24 warp and 40 weft threads
+static uint32_t straight_draw(const ToolDraft *d, uint32_t i)
+{
+    return i%d->shafts;
+}
+
+static uint32_t striped_warp(const ToolDraft *d, uint32_t i)
+{
+    (void)d;
+    return (i%24)/12;
+}
+
+static uint32_t striped_weft(const ToolDraft *d, uint32_t i)
+{
+    (void)d;
+    return (i%40) < 30 ? 2 : 0;
+}
+
+static int twill_tieup(const ToolDraft *d, uint32_t treadle, uint32_t shaft)
+{
+    return shaft == treadle || shaft == (treadle + 1)%d->shafts;
+}
+
+static void twill_palette(const ToolDraft *d, uint32_t i, uint32_t rgb[3])
+{
+    static const uint32_t colors[3][3] = {
+        {200, 30, 30}, {30, 30, 200}, {230, 230, 210}};
+    (void)d;
+    rgb[0] = colors[i][0];
+    rgb[1] = colors[i][1];
+    rgb[2] = colors[i][2];
+}
+
+static int write_twill(const char *filename, uint32_t threads)
+{
+    ToolDraft d = {threads, threads, 8, 8, 3, straight_draw, straight_draw,
+        striped_warp, striped_weft, twill_tieup, twill_palette};
+    return write_draft(filename, &d);
+}
+
+static void load(wcWeaveParameters *params, const char *filename,
+    uint8_t segment_lookup)
+{
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = 0.7f;
+    params->psi = 0.5f;
+    params->alpha = 0.05f;
+    params->beta = 2.f;
+    params->delta_x = 0.5f;
+    params->specular_strength = 0.5f;
+    params->intensity_fineness = 2.f;
+    params->normalization_table = 1;
+    params->normalization_cache_dir = "";
+    params->segment_lookup = segment_lookup;
+    wcWeavePatternFromFile(params, filename);
+}
+
+// Time per wcShade in ns, and the results
+static double shade(const wcWeaveParameters *params,
+    const wcIntersectionData *samples, int num_samples, wcColor *result,
+    wcPatternData *pattern_data)
+{
+    int i;
+    double t = seconds();
+    for(i=0;i<num_samples;i++){
+        result[i] = wcShade(samples[i], params);
+    }
+    t = seconds() - t;
+    for(i=0;i<num_samples;i++){
+        pattern_data[i] = wcGetPatternData(samples[i], params);
+    }
+    return 1e9*t/num_samples;
+}
+
+// Returns 1 if the file was compacted to the same results
+static int test_file(const char *filename, const wcIntersectionData *samples,
+    int num_samples, wcColor **results, wcPatternData **pattern_data)
+{
+    wcWeaveParameters params, whole;
+    PackedPattern *whole_pattern;
+    WeaveData *data;
+    double time_whole, time_table, time_bitboard;
+    size_t memory_whole;
+    int k, same = 1;
+
+    // The whole pattern with the bitboard lookup, which does not depend on
+    // the pattern being compacted
+    load(&params, filename, WC_SEGMENT_BITBOARD);
+    if(!params.pattern){
+        printf("FAILED: could not read %s\n", filename);
+        return 0;
+    }
+    data = wif_read(filename);
+    whole = params;
+    whole.pattern = wif_get_pattern(data, &whole.pattern_width,
+        &whole.pattern_height, &whole.pattern_realwidth,
+        &whole.pattern_realheight);
+    wif_free_weavedata(data);
+    memory_whole = wif_pattern_memory(whole.pattern);
+    time_whole = shade(&whole, samples, num_samples, results[0],
+        pattern_data[0]);
+    whole_pattern = whole.pattern;
+    time_bitboard = shade(&params, samples, num_samples, results[1],
+        pattern_data[1]);
+    wcFreeWeavePattern(&params);
+    wif_free_pattern(whole_pattern);
+
+    load(&params, filename, WC_SEGMENT_TABLE);
+    time_table = shade(&params, samples, num_samples, results[2],
+        pattern_data[2]);
+    for(k=1;k<3;k++){
+        same = same && memcmp(results[0], results[k],
+                num_samples*sizeof(wcColor)) == 0
+            && memcmp(pattern_data[0], pattern_data[k],
+                num_samples*sizeof(wcPatternData)) == 0;
+    }
+    printf("%-28.28s %5ux%-5u %5ux%-5u %9.3f %9.3f %8.1f %8.1f %8.1f %s\n",
+        filename, params.pattern_width, params.pattern_height,
+        params.pattern->repeat_width, params.pattern->repeat_height,
+        1e-6*(double)memory_whole,
+        1e-6*(double)wif_pattern_memory(params.pattern), time_whole,
+        time_table, time_bitboard, same ? "identical" : "DIFFERENT");
+    wcFreeWeavePattern(&params);
+    return same;
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 1 ? argv[1] : ".";
+    int num_samples = argc > 2 ? atoi(argv[2]) : 200000;
+    wcIntersectionData *samples = (wcIntersectionData*)malloc(
+        num_samples*sizeof(wcIntersectionData));
+    wcColor *results[3];
+    wcPatternData *pattern_data[3];
+    char filename[1024];
+    int failures = 0;
+    int i, k;
+    for(k=0;k<3;k++){
+        results[k] = (wcColor*)malloc(num_samples*sizeof(wcColor));
+        pattern_data[k] = (wcPatternData*)malloc(
+            num_samples*sizeof(wcPatternData));
+    }
+    srand(1);
+    for(i=0;i<num_samples;i++){
+        samples[i].uv_x = 3.f*(float)rand()/(float)RAND_MAX;
+        samples[i].uv_y = 3.f*(float)rand()/(float)RAND_MAX;
+        random_direction(&samples[i].wi_x, &samples[i].wi_y,
+            &samples[i].wi_z);
+        random_direction(&samples[i].wo_x, &samples[i].wo_y,
+            &samples[i].wo_z);
+    }
+
+    printf("%-28s %11s %11s %9s %9s %8s %8s %8s\n", "", "size", "repeat",
+        "whole MB", "repeat MB", "whole ns", "table ns", "bits ns");
+    sprintf(filename, "%s/test_pattern_period.wif", dir);
+    if(!write_twill(filename, 6000)){
+        printf("Could not write %s\n", filename);
+        return 1;
+    }
+    failures += !test_file(filename, samples, num_samples, results,
+        pattern_data);
+    remove(filename);
+    for(i=3;i<argc;i++){
+        failures += !test_file(argv[i], samples, num_samples, results,
+            pattern_data);
+    }
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures != 0;
+}
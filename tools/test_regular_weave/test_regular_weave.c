@@ -0,0 +1,193 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Generates plain weaves, twills and satins, with wcWeavePatternRegular
+// and as tiled, shifted patterns with wcWeavePatternFromData, and checks
+// that they are recognized as regular weaves and that wcGetPatternData and
+// wcShade give identical results to walking the pattern. Also reports
+// which of the given WIF files are recognized. Prints the time per
+// wcGetPatternData and per wcShade for both.
+// Usage: test_regular_weave [num_samples] [file.wif ...]
+
+typedef struct
+{
+    const char *name;
+    uint32_t repeat, shift, floats;
+    int regular; //Whether it should be recognized
+} Weave;
+
+static const Weave weaves[] = {
+    {"plain",              2,  1, 1, 1},
+    {"2/1 twill",          3,  1, 2, 1},
+    {"2/2 twill",          4,  1, 2, 1},
+    {"3/5 twill, left",    8,  7, 3, 1},
+    {"5 end satin",        5,  2, 1, 1},
+    {"5 end satin, warp",  5,  3, 4, 1},
+    {"8 end satin",        8,  3, 1, 1},
+    {"12 end satin, warp", 12, 5, 11, 1},
+    {"2/2 broken",         8,  3, 2, 0},
+};
+#define NUM_WEAVES (sizeof(weaves)/sizeof(weaves[0]))
+
+static void init_parameters(wcWeaveParameters *params)
+{
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = 0.7f;
+    params->psi = 0.5f;
+    params->alpha = 0.05f;
+    params->beta = 2.f;
+    params->delta_x = 0.5f;
+    params->specular_strength = 0.5f;
+    params->intensity_fineness = 2.f;
+    params->normalization_table = 1;
+    params->normalization_cache_dir = "";
+    params->segment_lookup = WC_SEGMENT_BITBOARD;
+}
+
+// Times per wcGetPatternData and wcShade in ns, and the results
+static void shade(const wcWeaveParameters *params,
+    const wcIntersectionData *samples, int num_samples, wcColor *result,
+    wcPatternData *pattern_data, double *time_data, double *time_shade)
+{
+    int i;
+    double t = seconds();
+    for(i=0;i<num_samples;i++){
+        pattern_data[i] = wcGetPatternData(samples[i], params);
+    }
+    *time_data = 1e9*(seconds() - t)/num_samples;
+    t = seconds();
+    for(i=0;i<num_samples;i++){
+        result[i] = wcShade(samples[i], params);
+    }
+    *time_shade = 1e9*(seconds() - t)/num_samples;
+}
+
+// wcPatternData has padding, so it is compared member by member
+static int same_pattern_data(const wcPatternData *a, const wcPatternData *b,
+    int num)
+{
+    int i;
+    for(i=0;i<num;i++){
+        if(memcmp(&a[i].color_r, &b[i].color_r, 12*sizeof(float))
+                || a[i].total_index_x != b[i].total_index_x
+                || a[i].total_index_y != b[i].total_index_y
+                || a[i].warp_above != b[i].warp_above){
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Compares the loaded pattern with the regular weave evaluation turned off,
+// so that wcGetPatternData walks the pattern. Returns 1 if the results are
+// the same, and if the pattern was recognized when expected to be.
+static int test_pattern(const char *name, wcWeaveParameters *params,
+    int expect_regular, const wcIntersectionData *samples, int num_samples,
+    wcColor **results, wcPatternData **pattern_data)
+{
+    RegularWeave regular = params->pattern->regular;
+    double data_regular, shade_regular, data_walk, shade_walk;
+    int recognized = regular.repeat != 0;
+    int same;
+    shade(params, samples, num_samples, results[0], pattern_data[0],
+        &data_regular, &shade_regular);
+    params->pattern->regular.repeat = 0;
+    shade(params, samples, num_samples, results[1], pattern_data[1],
+        &data_walk, &shade_walk);
+    params->pattern->regular = regular;
+    same = memcmp(results[0], results[1], num_samples*sizeof(wcColor)) == 0
+        && same_pattern_data(pattern_data[0], pattern_data[1], num_samples);
+    printf("%-28.28s %5ux%-5u %-9s %8.1f %8.1f %8.1f %8.1f %s\n", name,
+        params->pattern_width, params->pattern_height,
+        recognized ? "regular" : "-", data_regular, data_walk,
+        shade_regular, shade_walk, same ? "identical" : "DIFFERENT");
+    if(expect_regular >= 0 && recognized != expect_regular){
+        printf("FAILED: %s was %s\n", name, recognized ? "recognized"
+            : "not recognized");
+        return 0;
+    }
+    return same;
+}
+
+int main(int argc, char **argv)
+{
+    int num_samples = argc > 1 ? atoi(argv[1]) : 200000;
+    wcIntersectionData *samples = (wcIntersectionData*)malloc(
+        num_samples*sizeof(wcIntersectionData));
+    wcColor *results[2];
+    wcPatternData *pattern_data[2];
+    float warp_color[3] = {0.8f, 0.2f, 0.1f};
+    float weft_color[3] = {0.9f, 0.9f, 0.8f};
+    int failures = 0;
+    uint32_t w;
+    int i, k;
+    for(k=0;k<2;k++){
+        results[k] = (wcColor*)malloc(num_samples*sizeof(wcColor));
+        pattern_data[k] = (wcPatternData*)malloc(
+            num_samples*sizeof(wcPatternData));
+    }
+    srand(1);
+    for(i=0;i<num_samples;i++){
+        samples[i].uv_x = 3.f*(float)rand()/(float)RAND_MAX;
+        samples[i].uv_y = 3.f*(float)rand()/(float)RAND_MAX;
+        random_direction(&samples[i].wi_x, &samples[i].wi_y,
+            &samples[i].wi_z);
+        random_direction(&samples[i].wo_x, &samples[i].wo_y,
+            &samples[i].wo_z);
+    }
+
+    printf("%-28s %11s %-9s %8s %8s %8s %8s\n", "", "size", "",
+        "data ns", "walk ns", "shade ns", "walk ns");
+    for(w=0;w<NUM_WEAVES;w++){
+        const Weave *weave = &weaves[w];
+        wcWeaveParameters params;
+        uint32_t n = weave->repeat, x, y;
+        // Tiled 3x2 times and shifted, with the warp above where the
+        // generated one has it
+        uint32_t width = 3*n, height = 2*n;
+        uint8_t *warp_above = (uint8_t*)malloc(width*height);
+        char name[64];
+        for(y=0;y<height;y++){
+            for(x=0;x<width;x++){
+                warp_above[x + y*width] =
+                    (weave->shift*(x + 1) + y + 2) % n < weave->floats;
+            }
+        }
+
+        init_parameters(&params);
+        wcWeavePatternRegular(&params, n, weave->shift, weave->floats,
+            warp_color, weft_color);
+        failures += !test_pattern(weave->name, &params, weave->regular,
+            samples, num_samples, results, pattern_data);
+        wcFreeWeavePattern(&params);
+
+        init_parameters(&params);
+        wcWeavePatternFromData(&params, warp_above, warp_color, weft_color,
+            width, height);
+        sprintf(name, "  tiled, shifted");
+        failures += !test_pattern(name, &params, weave->regular,
+            samples, num_samples, results, pattern_data);
+        wcFreeWeavePattern(&params);
+        free(warp_above);
+    }
+    for(i=2;i<argc;i++){
+        wcWeaveParameters params;
+        init_parameters(&params);
+        wcWeavePatternFromFile(&params, argv[i]);
+        if(!params.pattern){
+            printf("FAILED: could not read %s\n", argv[i]);
+            failures++;
+            continue;
+        }
+        failures += !test_pattern(argv[i], &params, -1, samples,
+            num_samples, results, pattern_data);
+        wcFreeWeavePattern(&params);
+    }
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures != 0;
+}
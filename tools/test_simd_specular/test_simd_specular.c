@@ -0,0 +1,150 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Compares the AVX2 and AVX-512 specular kernels used by wcEvalSpecularBatch
+// with the scalar code, on a random pattern with random directions.
+// The absolute error has to be below MAX_ERROR times the largest scalar
+// value. Where the specular term is small compared to its parts (e.g. a
+// direction almost perpendicular to the highlight normal) the relative
+// error can be larger, but it may exceed MAX_ERROR for at most
+// MAX_OUTLIER_FRACTION of the points with a highlight. Points where only
+// one of them gives a highlight ("edge" below) lie on the edge of the
+// highlight, and may also be at most MAX_OUTLIER_FRACTION of them.
+// Usage: test_simd_specular [num_samples]
+
+#define MAX_ERROR            1e-4
+#define MAX_OUTLIER_FRACTION 1e-3
+
+typedef struct
+{
+    const char *name;
+    float umax, psi, beta, delta_x;
+} Config;
+
+static const Config configs[] = {
+    {"filament",          0.7f, 0.f,  2.f,  0.5f},
+    {"filament narrow",   0.3f, 0.f,  8.f,  0.1f},
+    {"filament wide",     1.4f, 0.f,  0.5f, 0.9f},
+    {"staple",            0.7f, 0.5f, 2.f,  0.5f},
+    {"staple low twist",  0.5f, 0.1f, 4.f,  0.3f},
+    {"staple high twist", 1.2f, 1.2f, 1.f,  0.8f},
+};
+
+int main(int argc, char **argv)
+{
+    int num_samples = argc > 1 ? atoi(argv[1]) : 1000000;
+    int widths[] = {8, 16};
+    int max_width = wcGetSimdWidth();
+    int failed = 0;
+
+    // Random 64x64 pattern
+    uint32_t w = 64, h = 64;
+    uint8_t *warp_above = (uint8_t*)malloc(w*h);
+    float warp_color[] = {0.8f, 0.2f, 0.2f};
+    float weft_color[] = {0.2f, 0.2f, 0.8f};
+    srand(1);
+    for(uint32_t i=0;i<w*h;i++){
+        warp_above[i] = rand() % 2;
+    }
+
+    float *in = (float*)malloc(8*num_samples*sizeof(float));
+    wcIntersectionBatch batch = {in, in + num_samples, in + 2*num_samples,
+        in + 3*num_samples, in + 4*num_samples, in + 5*num_samples,
+        in + 6*num_samples, in + 7*num_samples};
+    for(int i=0;i<num_samples;i++){
+        in[i]               = uniform();
+        in[i + num_samples] = uniform();
+        random_direction(in + i + 2*num_samples, in + i + 3*num_samples,
+            in + i + 4*num_samples);
+        random_direction(in + i + 5*num_samples, in + i + 6*num_samples,
+            in + i + 7*num_samples);
+    }
+
+    float *pattern_data = (float*)malloc(12*num_samples*sizeof(float));
+    uint32_t *total_index = (uint32_t*)malloc(2*num_samples*sizeof(uint32_t));
+    uint8_t *data_warp_above = (uint8_t*)malloc(num_samples);
+    wcPatternDataBatch data;
+    float **fields[] = {&data.color_r, &data.color_g, &data.color_b,
+        &data.normal_x, &data.normal_y, &data.normal_z, &data.u, &data.v,
+        &data.length, &data.width, &data.x, &data.y};
+    for(int i=0;i<12;i++){
+        *fields[i] = pattern_data + i*num_samples;
+    }
+    data.total_index_x = total_index;
+    data.total_index_y = total_index + num_samples;
+    data.warp_above = data_warp_above;
+
+    float *reference = (float*)malloc(num_samples*sizeof(float));
+    float *specular = (float*)malloc(num_samples*sizeof(float));
+
+    printf("Widest SIMD kernel available: %d\n", max_width);
+    printf("%-20s %6s %10s %10s %10s %12s\n", "", "width", "highlight",
+        "outliers", "edge", "max error");
+    for(size_t c=0;c<sizeof(configs)/sizeof(*configs);c++){
+        wcWeaveParameters params;
+        memset(&params, 0, sizeof(params));
+        params.uscale = params.vscale = 1.f;
+        params.umax = configs[c].umax;
+        params.psi = configs[c].psi;
+        params.alpha = 0.05f;
+        params.beta = configs[c].beta;
+        params.delta_x = configs[c].delta_x;
+        params.specular_strength = 0.5f;
+        wcWeavePatternFromData(&params, warp_above, warp_color, weft_color,
+            w, h);
+        wcGetPatternDataBatch(&batch, num_samples, &data, &params);
+
+        wcSetSimdWidth(1);
+        wcEvalSpecularBatch(&batch, &data, num_samples, reference, &params);
+        for(size_t k=0;k<sizeof(widths)/sizeof(*widths);k++){
+            if(widths[k] > max_width){
+                continue;
+            }
+            wcSetSimdWidth(widths[k]);
+            wcEvalSpecularBatch(&batch, &data, num_samples, specular, &params);
+            int num_highlight = 0, num_edge = 0, num_outliers = 0;
+            double max_error = 0.0, max_value = 0.0;
+            for(int i=0;i<num_samples;i++){
+                double error = fabs((double)specular[i]
+                    - (double)reference[i]);
+                if(reference[i] != 0.f && specular[i] != 0.f){
+                    if(!(error <= max_error)){
+                        max_error = error;
+                    }
+                    if(!(error <= MAX_ERROR*fabs((double)reference[i]))){
+                        num_outliers++;
+                    }
+                    num_highlight++;
+                } else if(reference[i] != 0.f || specular[i] != 0.f){
+                    num_edge++;
+                }
+                if(fabs((double)reference[i]) > max_value){
+                    max_value = fabs((double)reference[i]);
+                }
+            }
+            max_error /= max_value;
+            int ok = num_highlight > 0 && max_error < MAX_ERROR
+                && num_outliers <= MAX_OUTLIER_FRACTION*num_highlight
+                && num_edge <= MAX_OUTLIER_FRACTION*num_highlight;
+            printf("%-20s %6d %10d %10d %10d %12.3g %s\n", configs[c].name,
+                widths[k], num_highlight, num_outliers, num_edge, max_error,
+                ok ? "ok" : "FAILED");
+            failed |= !ok;
+        }
+        wcFreeWeavePattern(&params);
+    }
+    wcSetSimdWidth(max_width);
+
+    free(warp_above);
+    free(in);
+    free(pattern_data);
+    free(total_index);
+    free(data_warp_above);
+    free(reference);
+    free(specular);
+    return failed;
+}
@@ -0,0 +1,363 @@
+#include "../../src/woven_cloth.h"
+#include "../common/tool_common.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Tests wcSampleSpecular and wcPdfSpecular. For a few yarns, points and
+// incident directions, the sampled directions are binned over the
+// hemisphere and compared to the integral of wcPdfSpecular over each bin
+// with a chi-square test. The specular term times the cosine is then
+// integrated over the hemisphere both with cosine weighted and specular
+// samples, and the variance per sample of the two is printed.
+// Usage: test_specular_sampling [num_samples]
+
+void sample_cosine_hemisphere(float sample_x, float sample_y, float *p_x,
+        float *p_y, float *p_z);
+
+// Bins are uniform in cos(theta) and phi, i.e. of equal solid angle
+#define BINS_THETA 8
+#define BINS_PHI 16
+// Cells per side of the grid over the sample space
+#define SAMPLE_GRID 1024
+// Cells in cos(theta) of the grid over the hemisphere (twice as many in phi)
+#define DIRECTION_GRID 512
+
+typedef struct
+{
+    const char *name;
+    float psi, delta_x;
+} Yarn;
+
+static const Yarn yarns[] = {
+    {"filament",             0.f,   0.3f},
+    {"filament, wide",       0.f,   0.8f},
+    {"staple",               0.5f,  0.3f},
+    {"staple, wide",         0.5f,  0.8f},
+    {"staple, low twist",    0.15f, 0.5f},
+};
+#define NUM_YARNS (sizeof(yarns)/sizeof(yarns[0]))
+
+static const float elevations[] = {10.f, 45.f, 80.f};
+#define NUM_ELEVATIONS (sizeof(elevations)/sizeof(elevations[0]))
+#define NUM_POINTS 3
+
+static void init_parameters(wcWeaveParameters *params, const Yarn *yarn)
+{
+    float warp_color[3] = {0.8f, 0.2f, 0.1f};
+    float weft_color[3] = {0.9f, 0.9f, 0.8f};
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = 0.7f;
+    params->psi = yarn->psi;
+    params->alpha = 0.05f;
+    params->beta = 2.f;
+    params->delta_x = yarn->delta_x;
+    params->specular_strength = 0.5f;
+    params->normalization_table = 1;
+    params->normalization_cache_dir = "";
+    wcWeavePatternRegular(params, 4, 1, 2, warp_color, weft_color);
+}
+
+static int bin_of(float x, float y, float z)
+{
+    int t = (int)(z*BINS_THETA);
+    float phi = atan2f(y, x);
+    int p;
+    if(phi < 0.f){
+        phi += 2.f*(float)M_PI;
+    }
+    p = (int)(phi/(2.f*(float)M_PI)*BINS_PHI);
+    t = t < BINS_THETA ? t : BINS_THETA - 1;
+    p = p < BINS_PHI ? p : BINS_PHI - 1;
+    return t*BINS_PHI + p;
+}
+
+// Upper tail probability of the chi-square distribution, from the
+// Wilson-Hilferty approximation
+static double chi_square_p(double chi2, int dof)
+{
+    double k = (double)dof;
+    double z = (pow(chi2/k, 1.0/3.0) - (1.0 - 2.0/(9.0*k)))
+        / sqrt(2.0/(9.0*k));
+    return 0.5*erfc(z/sqrt(2.0));
+}
+
+// The direction sampled for (sample_x, sample_y) in wo, and its density
+static float sample_at(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params, double sample_x,
+    double sample_y, double *wo)
+{
+    float pdf = wcSampleSpecular(&intersection_data, data, (float)sample_x,
+        (float)sample_y, params);
+    wo[0] = intersection_data.wo_x;
+    wo[1] = intersection_data.wo_y;
+    wo[2] = intersection_data.wo_z;
+    return pdf;
+}
+
+// The derivative of the sampled direction along the sample axis d, from
+// the differences to the neighbours half a cell away on either side. If
+// they differ a lot, the sampling jumps between the ends of the range of
+// an angle there and only the smaller one is used. Returns 0 if neither
+// neighbour was sampled.
+static int sample_derivative(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params, double sample_x,
+    double sample_y, const double *wo, int d, double *derivative)
+{
+    const double h = 0.5/SAMPLE_GRID;
+    double neighbour[2][3], length[2] = {-1.0, -1.0};
+    int i, k;
+    for(k=0;k<2;k++){
+        double step = k ? h : -h;
+        double x = sample_x + (d == 0 ? step : 0.0);
+        double y = sample_y + (d == 1 ? step : 0.0);
+        // The samples are in [0,1)
+        x = x < 1.0 - 1e-6 ? x : 1.0 - 1e-6;
+        y = y < 1.0 - 1e-6 ? y : 1.0 - 1e-6;
+        if(sample_at(intersection_data, data, params, x, y,
+                neighbour[k]) > 0.f){
+            length[k] = 0.0;
+            for(i=0;i<3;i++){
+                neighbour[k][i] = (neighbour[k][i] - wo[i])/step;
+                length[k] += neighbour[k][i]*neighbour[k][i];
+            }
+        }
+    }
+    if(length[0] < 0.0 && length[1] < 0.0){
+        return 0;
+    }
+    if(length[0] >= 0.0 && length[1] >= 0.0
+        && length[0] < 4.0*length[1] && length[1] < 4.0*length[0]){
+        for(i=0;i<3;i++){
+            derivative[i] = 0.5*(neighbour[0][i] + neighbour[1][i]);
+        }
+        return 1;
+    }
+    k = length[0] < 0.0 || (length[1] >= 0.0 && length[1] < length[0]);
+    for(i=0;i<3;i++){
+        derivative[i] = neighbour[k][i];
+    }
+    return 1;
+}
+
+static double dot(const double *a, const double *b)
+{
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+// The expected fraction of samples in every bin, i.e. the integral of the
+// pdf over it. The pdf of staple yarn has integrable peaks along the edges
+// of the highlight, where the midpoint rule over the bins converges very
+// slowly, so the integral is taken over the sample space instead: every
+// cell of a grid there maps to a patch of directions of area J, from the
+// derivatives of the sampled direction, and adds pdf*J to the bin of its
+// direction. Where the pdf is right, pdf*J is the area of the cell. That
+// the pdf is zero where nothing is sampled is checked by integrate_pdf.
+static void expected_fractions(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params, double *expected)
+{
+    int i, j;
+    for(i=0;i<BINS_THETA*BINS_PHI;i++){
+        expected[i] = 0.0;
+    }
+    for(i=0;i<SAMPLE_GRID;i++){
+        for(j=0;j<SAMPLE_GRID;j++){
+            double sample_x = (i + 0.5)/SAMPLE_GRID;
+            double sample_y = (j + 0.5)/SAMPLE_GRID;
+            double wo[3], dx[3], dy[3], n[3], area;
+            float pdf = sample_at(intersection_data, data, params, sample_x,
+                sample_y, wo);
+            if(pdf <= 0.f
+                || !sample_derivative(intersection_data, data, params,
+                    sample_x, sample_y, wo, 0, dx)
+                || !sample_derivative(intersection_data, data, params,
+                    sample_x, sample_y, wo, 1, dy)){
+                continue;
+            }
+            n[0] = dx[1]*dy[2] - dx[2]*dy[1];
+            n[1] = dx[2]*dy[0] - dx[0]*dy[2];
+            n[2] = dx[0]*dy[1] - dx[1]*dy[0];
+            area = sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+            // Next to the peaks the derivatives are nearly parallel and
+            // their cross product is mostly rounding error, so pdf*J is
+            // taken to be right there. These are under 1% of the cells.
+            if(area < 0.002*sqrt(dot(dx, dx)*dot(dy, dy))){
+                area = 1.0/pdf;
+            }
+            expected[bin_of((float)wo[0], (float)wo[1], (float)wo[2])] +=
+                pdf*area/((double)SAMPLE_GRID*SAMPLE_GRID);
+        }
+    }
+}
+
+// The integral of the pdf over the hemisphere, with the midpoint rule
+static double integrate_pdf(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params)
+{
+    double sum = 0.0;
+    int i, j;
+    for(i=0;i<DIRECTION_GRID;i++){
+        for(j=0;j<2*DIRECTION_GRID;j++){
+            double z = (i + 0.5)/DIRECTION_GRID;
+            double phi = M_PI*(j + 0.5)/DIRECTION_GRID;
+            double r = sqrt(1.0 - z*z);
+            intersection_data.wo_x = (float)(r*cos(phi));
+            intersection_data.wo_y = (float)(r*sin(phi));
+            intersection_data.wo_z = (float)z;
+            sum += wcPdfSpecular(intersection_data, data, params);
+        }
+    }
+    return sum*M_PI/((double)DIRECTION_GRID*DIRECTION_GRID);
+}
+
+// Returns the p-value, or -1 if the returned density differs from
+// wcPdfSpecular for some sample
+static double chi_square_test(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params, int num_samples,
+    double *sampled_fraction)
+{
+    static double expected[BINS_THETA*BINS_PHI];
+    static int observed[BINS_THETA*BINS_PHI];
+    double total = 0.0, chi2 = 0.0, pooled_expected = 0.0;
+    int pooled_observed = 0, failed = 0, cells = 0;
+    int i;
+    expected_fractions(intersection_data, data, params, expected);
+    for(i=0;i<BINS_THETA*BINS_PHI;i++){
+        total += expected[i];
+        observed[i] = 0;
+    }
+    for(i=0;i<num_samples;i++){
+        float pdf = wcSampleSpecular(&intersection_data, data, uniform(),
+            uniform(), params);
+        if(pdf <= 0.f){
+            failed++;
+            continue;
+        }
+        if(pdf != wcPdfSpecular(intersection_data, data, params)){
+            return -1.0;
+        }
+        observed[bin_of(intersection_data.wo_x, intersection_data.wo_y,
+            intersection_data.wo_z)]++;
+    }
+    *sampled_fraction = (double)(num_samples - failed)/num_samples;
+    // Bins with too few expected samples are pooled, along with the failed
+    // samples
+    pooled_expected = (1.0 - total)*num_samples;
+    pooled_observed = failed;
+    for(i=0;i<BINS_THETA*BINS_PHI;i++){
+        double e = expected[i]*num_samples;
+        if(e < 5.0){
+            pooled_expected += e;
+            pooled_observed += observed[i];
+        }else{
+            chi2 += (observed[i] - e)*(observed[i] - e)/e;
+            cells++;
+        }
+    }
+    if(pooled_expected >= 5.0){
+        chi2 += (pooled_observed - pooled_expected)
+            *(pooled_observed - pooled_expected)/pooled_expected;
+        cells++;
+    }
+    if(cells < 2){
+        return 1.0;
+    }
+    return chi_square_p(chi2, cells - 1);
+}
+
+// Mean and variance of the estimate of the specular term times the cosine
+// over the hemisphere, with cosine weighted (specular = 0) or specular
+// samples
+static void estimate(wcIntersectionData intersection_data,
+    wcPatternData data, const wcWeaveParameters *params, int num_samples,
+    int specular, double *mean, double *variance)
+{
+    double sum = 0.0, sum_sq = 0.0;
+    int i;
+    for(i=0;i<num_samples;i++){
+        double f = 0.0;
+        if(specular){
+            float pdf = wcSampleSpecular(&intersection_data, data,
+                uniform(), uniform(), params);
+            if(pdf > 0.f){
+                f = wcEvalSpecular(intersection_data, data, params)
+                    *intersection_data.wo_z/pdf;
+            }
+        }else{
+            sample_cosine_hemisphere(uniform(), uniform(),
+                &intersection_data.wo_x, &intersection_data.wo_y,
+                &intersection_data.wo_z);
+            f = wcEvalSpecular(intersection_data, data, params)*M_PI;
+        }
+        sum += f;
+        sum_sq += f*f;
+    }
+    *mean = sum/num_samples;
+    *variance = sum_sq/num_samples - (*mean)*(*mean);
+}
+
+int main(int argc, char **argv)
+{
+    int num_samples = argc > 1 ? atoi(argv[1]) : 200000;
+    int num_tests = NUM_YARNS*NUM_ELEVATIONS*NUM_POINTS;
+    int failures = 0;
+    uint32_t y, e, p;
+    srand(1);
+    printf("%-18s %5s %6s %6s %8s %8s %8s %10s %10s %10s %6s\n", "", "elev",
+        "x", "y", "p-value", "sampled", "pdf", "integral", "var cos",
+        "var spec", "ratio");
+    for(y=0;y<NUM_YARNS;y++){
+        wcWeaveParameters params;
+        init_parameters(&params, &yarns[y]);
+        for(p=0;p<NUM_POINTS;p++){
+            wcIntersectionData intersection_data;
+            wcPatternData data;
+            memset(&intersection_data, 0, sizeof(intersection_data));
+            intersection_data.uv_x = uniform();
+            intersection_data.uv_y = uniform();
+            data = wcGetPatternData(intersection_data, &params);
+            for(e=0;e<NUM_ELEVATIONS;e++){
+                float theta = (90.f - elevations[e])*(float)M_PI/180.f;
+                float phi = 2.f*(float)M_PI*uniform();
+                double p_value, sampled = 0.0, pdf_integral;
+                double mean_cos, var_cos, mean_spec, var_spec;
+                double error;
+                int ok;
+                intersection_data.wi_x = sinf(theta)*cosf(phi);
+                intersection_data.wi_y = sinf(theta)*sinf(phi);
+                intersection_data.wi_z = cosf(theta);
+                p_value = chi_square_test(intersection_data, data, &params,
+                    num_samples, &sampled);
+                pdf_integral = integrate_pdf(intersection_data, data,
+                    &params);
+                estimate(intersection_data, data, &params, num_samples, 0,
+                    &mean_cos, &var_cos);
+                estimate(intersection_data, data, &params, num_samples, 1,
+                    &mean_spec, &var_spec);
+                // The pdf should integrate to the fraction of samples that
+                // were taken, and the two estimates of the integral should
+                // agree
+                error = sqrt((var_cos + var_spec)/num_samples);
+                ok = p_value > 0.01/num_tests
+                    && fabs(pdf_integral - sampled) < 0.01 + 0.02*sampled
+                    && fabs(mean_cos - mean_spec) <= 5.0*error + 1e-6;
+                printf("%-18s %5.0f %6.2f %6.2f %8.4f %7.1f%% %7.1f%% "
+                    "%10.4g %10.4g %10.4g %6.1f %s\n", yarns[y].name,
+                    elevations[e], data.x, data.y, p_value, 100.0*sampled,
+                    100.0*pdf_integral, mean_spec, var_cos, var_spec,
+                    var_spec > 0.0 ? var_cos/var_spec : 0.0,
+                    ok ? "" : "FAILED");
+                failures += !ok;
+            }
+        }
+        wcFreeWeavePattern(&params);
+    }
+    if(failures){
+        printf("%d of %d tests FAILED\n", failures, num_tests);
+        return 1;
+    }
+    printf("All %d tests passed\n", num_tests);
+    return 0;
+}
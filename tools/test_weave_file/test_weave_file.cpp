@@ -18,7 +18,7 @@ int main(int argc, char **argv)
         printf("[ ");
         for(uint32_t x = 0; x < params.pattern_width; x++){
             printf("%d",
-                params.pattern_entry[x+y*params.pattern_width].warp_above);
+                wif_pattern_warp_above(params.pattern, x, y));
         }
         printf(" ]\n");
     }
@@ -0,0 +1,171 @@
+#include "../../src/woven_cloth.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Reports the error of the baked yarn variation (yarnvar_bake_resolution)
+// against the noise evaluated for every shading point, for a range of
+// resolutions and octave counts. The pattern is white, so wcEvalDiffuse
+// with wi_z = 1 returns the variation itself. The samples cover the
+// repeats of the pattern that the table covers. Then checks that
+// wcUpdateWeaveParameters bakes the table again when the noise parameters
+// change, that a copy of the parameters evaluates the noise instead, and
+// that a table which would be too large is not baked.
+// Usage: test_yarnvar_bake [num_samples] [file.wif]
+
+static const uint32_t resolutions[] = {1, 2, 4, 8, 16};
+static const uint32_t octaves[] = {1, 4, 8};
+
+static void set_parameters(wcWeaveParameters *params, uint32_t octaves,
+    uint32_t resolution)
+{
+    memset(params, 0, sizeof(*params));
+    params->uscale = params->vscale = 1.f;
+    params->umax = 0.7f;
+    params->alpha = 0.05f;
+    params->beta = 2.f;
+    params->delta_x = 0.5f;
+    params->specular_strength = 0.f;
+    params->yarnvar_amplitude = 0.5f;
+    params->yarnvar_xscale = 4.f;
+    params->yarnvar_yscale = 4.f;
+    params->yarnvar_persistance = 0.5f;
+    params->yarnvar_octaves = octaves;
+    params->yarnvar_bake_resolution = resolution;
+    params->yarnvar_bake_repeats = 1;
+}
+
+// Returns the number of failed checks
+static int check_updates(uint8_t *warp_above, uint32_t w, uint32_t h)
+{
+    float white[] = {1.f, 1.f, 1.f};
+    wcWeaveParameters params, reference, copy;
+    int failures = 0;
+    set_parameters(&params, 4, 4);
+    wcWeavePatternFromData(&params, warp_above, white, white, w, h);
+    set_parameters(&reference, 8, 4);
+    reference.yarnvar_xscale = 2.f;
+    wcWeavePatternFromData(&reference, warp_above, white, white, w, h);
+
+    params.yarnvar_octaves = 8;
+    params.yarnvar_xscale = 2.f;
+    wcUpdateWeaveParameters(&params);
+    size_t size = (size_t)reference.compiled.yarnvar_table_yarns
+        *reference.compiled.yarnvar_table_samples*sizeof(float);
+    int same = params.yarnvar_table && reference.yarnvar_table
+        && params.compiled.yarnvar_table_yarns
+            == reference.compiled.yarnvar_table_yarns
+        && params.compiled.yarnvar_table_samples
+            == reference.compiled.yarnvar_table_samples
+        && memcmp(params.yarnvar_table, reference.yarnvar_table, size) == 0;
+    printf("%-40s %s\n", "baked again after an update",
+        same ? "ok" : "FAILED");
+    failures += !same;
+
+    copy = params;
+    copy.yarnvar_yscale = 3.f;
+    wcUpdateWeaveParameters(&copy);
+    same = copy.yarnvar_table == 0 && params.yarnvar_table
+        && memcmp(params.yarnvar_table, reference.yarnvar_table, size) == 0;
+    printf("%-40s %s\n", "copy evaluates the noise", same ? "ok" : "FAILED");
+    failures += !same;
+
+    // More than 2^32 samples
+    params.yarnvar_bake_repeats = 100000;
+    wcUpdateWeaveParameters(&params);
+    printf("%-40s %s\n", "too large table is not baked",
+        params.yarnvar_table == 0 ? "ok" : "FAILED");
+    failures += params.yarnvar_table != 0;
+
+    wcFreeWeavePattern(&params);
+    wcFreeWeavePattern(&reference);
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    int num_samples = argc > 1 ? atoi(argv[1]) : 1000000;
+    const char *filename = argc > 2 ? argv[2]
+        : "../../example_scenes/monkeytowel/55116.wif";
+
+    // Load the pattern once to get its size, and replace it by a white one
+    wcWeaveParameters params;
+    set_parameters(&params, 1, 0);
+    wcWeavePatternFromFile(&params, filename);
+    if(params.pattern == 0){
+        printf("Could not load %s\n", filename);
+        return 1;
+    }
+    uint32_t w = params.pattern_width, h = params.pattern_height;
+    uint8_t *warp_above = (uint8_t*)malloc(w*h);
+    for(uint32_t y=0;y<h;y++){
+        for(uint32_t x=0;x<w;x++){
+            warp_above[x + y*w] = wif_pattern_warp_above(params.pattern, x, y);
+        }
+    }
+    wcFreeWeavePattern(&params);
+    float white[] = {1.f, 1.f, 1.f};
+
+    wcIntersectionData *samples = (wcIntersectionData*)malloc(
+        num_samples*sizeof(wcIntersectionData));
+    wcPatternData *data = (wcPatternData*)malloc(
+        num_samples*sizeof(wcPatternData));
+    float *live = (float*)malloc(num_samples*sizeof(float));
+    srand(1);
+    for(int i=0;i<num_samples;i++){
+        memset(samples + i, 0, sizeof(*samples));
+        samples[i].uv_x = (float)rand()/(float)RAND_MAX;
+        samples[i].uv_y = (float)rand()/(float)RAND_MAX;
+        samples[i].wi_z = 1.f;
+    }
+
+    printf("%s (%dx%d), %d samples\n", filename, w, h, num_samples);
+    printf("%8s %11s %12s %12s %12s %12s %12s\n", "octaves", "resolution",
+        "table (kB)", "max error", "rms error", "live (ns)", "baked (ns)");
+    for(size_t o=0;o<sizeof(octaves)/sizeof(*octaves);o++){
+        set_parameters(&params, octaves[o], 0);
+        wcWeavePatternFromData(&params, warp_above, white, white, w, h);
+        for(int i=0;i<num_samples;i++){
+            data[i] = wcGetPatternData(samples[i], &params);
+        }
+        clock_t start = clock();
+        for(int i=0;i<num_samples;i++){
+            live[i] = wcEvalDiffuse(samples[i], data[i], &params).r;
+        }
+        double t_live = (double)(clock() - start)/(double)CLOCKS_PER_SEC;
+        wcFreeWeavePattern(&params);
+
+        for(size_t r=0;r<sizeof(resolutions)/sizeof(*resolutions);r++){
+            set_parameters(&params, octaves[o], resolutions[r]);
+            wcWeavePatternFromData(&params, warp_above, white, white, w, h);
+            double max_error = 0.0, sum_error2 = 0.0;
+            start = clock();
+            for(int i=0;i<num_samples;i++){
+                float baked = wcEvalDiffuse(samples[i], data[i], &params).r;
+                double error = fabs((double)baked - (double)live[i]);
+                if(error > max_error){
+                    max_error = error;
+                }
+                sum_error2 += error*error;
+            }
+            double t_baked = (double)(clock() - start)
+                /(double)CLOCKS_PER_SEC;
+            double table_size = (double)params.compiled.yarnvar_table_yarns
+                *(double)params.compiled.yarnvar_table_samples
+                *sizeof(float)/1024.0;
+            printf("%8d %11d %12.1f %12.3g %12.3g %12.2f %12.2f\n",
+                octaves[o], resolutions[r], table_size, max_error,
+                sqrt(sum_error2/num_samples), 1e9*t_live/num_samples,
+                1e9*t_baked/num_samples);
+            wcFreeWeavePattern(&params);
+        }
+    }
+    int failures = check_updates(warp_above, w, h);
+    free(warp_above);
+    free(samples);
+    free(data);
+    free(live);
+    return failures != 0;
+}
@@ -23,32 +23,61 @@ eval_diffuse
 EvalDiffuseFunc
 #endif
 (const VUtils::VRayContext &rc,
-    wcWeaveParameters *weave_parameters, VUtils::Color *diffuse_color)
+    wcWeaveParameters *weave_parameters, WCShadingContext *context,
+    VUtils::Color *diffuse_color)
 {
-    if(weave_parameters->pattern_entry == 0){ //Invalid pattern
-        *diffuse_color = VUtils::Color(1.f,1.f,0.f);
-        return;
-    }
-    wcIntersectionData intersection_data;
-   
     const VR::VRayInterface &vri_const=static_cast<const VR::VRayInterface&>(rc);
 	VR::VRayInterface &vri=const_cast<VR::VRayInterface&>(vri_const);
 	ShadeContext &sc=static_cast<ShadeContext&>(vri);
 
     Point3 uv = sc.UVW(1);
 
-    intersection_data.uv_x = uv.x;
-    intersection_data.uv_y = uv.y;
-    intersection_data.wi_z = 1.f;
+    //NOTE(Vidar): Look up the pattern once for this intersection, eval_specular
+    // is called for every light or sample direction
+    wcPrepareShadingPoint(uv.x, uv.y, weave_parameters, &context->point);
+    if(weave_parameters->pattern == 0){ //Invalid pattern
+        *diffuse_color = VUtils::Color(1.f,1.f,0.f);
+        return;
+    }
+
+    //Convert the view direction to the correct coordinate system
+    Point3 viewDir;
+    viewDir.x = -rc.rayparams.viewDir.x;
+    viewDir.y = -rc.rayparams.viewDir.y;
+    viewDir.z = -rc.rayparams.viewDir.z;
+    viewDir = sc.VectorFrom(viewDir,REF_WORLD);
+    viewDir = viewDir.Normalize();
+
+    // UVW derivatives
+    Point3 dpdUVW[3];
+    sc.DPdUVW(dpdUVW,1);
+
+    Point3 n_vec = sc.Normal().Normalize();
+    Point3 u_vec = dpdUVW[0].Normalize();
+    Point3 v_vec = dpdUVW[1].Normalize();
+    u_vec = v_vec ^ n_vec;
+    v_vec = n_vec ^ u_vec;
 
-    wcPatternData pattern_data = wcGetPatternData(intersection_data,
+    context->u_vec[0] = u_vec.x; context->u_vec[1] = u_vec.y;
+    context->u_vec[2] = u_vec.z;
+    context->v_vec[0] = v_vec.x; context->v_vec[1] = v_vec.y;
+    context->v_vec[2] = v_vec.z;
+    context->n_vec[0] = n_vec.x; context->n_vec[1] = n_vec.y;
+    context->n_vec[2] = n_vec.z;
+    context->wo[0] = DotProd(viewDir, u_vec);
+    context->wo[1] = DotProd(viewDir, v_vec);
+    context->wo[2] = DotProd(viewDir, n_vec);
+
+    float wi_z = 1.f;
+    float r, g, b;
+    wcIntersectionBatch directions = {0, 0, 0, 0, &wi_z, 0, 0, 0};
+    wcColorBatch d = {&r, &g, &b};
+    wcEvalShadingPoint(&context->point, &directions, 1, &d, 0,
         weave_parameters);
-    wcColor d = 
-        wcEvalDiffuse( intersection_data, pattern_data, weave_parameters);
     float factor = (1.f - weave_parameters->specular_strength);
-    diffuse_color->r = factor*d.r;
-    diffuse_color->g = factor*d.g;
-    diffuse_color->b = factor*d.b;
+    diffuse_color->r = factor*r;
+    diffuse_color->g = factor*g;
+    diffuse_color->b = factor*b;
 }
 
 void
@@ -58,59 +87,37 @@ eval_specular
 EvalSpecularFunc
 #endif
 ( const VUtils::VRayContext &rc, const VUtils::Vector &direction,
-    wcWeaveParameters *weave_parameters, VUtils::Matrix nm,
+    wcWeaveParameters *weave_parameters, const WCShadingContext *context,
     VUtils::Color *reflection_color)
 {
-    if(weave_parameters->pattern_entry == 0){ //Invalid pattern
+    if(weave_parameters->pattern == 0){ //Invalid pattern
         *reflection_color = VUtils::Color(0.f,0.f,1.f);
+        return;
     }
-    wcIntersectionData intersection_data;
    
     const VR::VRayInterface &vri_const=static_cast<const VR::VRayInterface&>(rc);
 	VR::VRayInterface &vri=const_cast<VR::VRayInterface&>(vri_const);
 	ShadeContext &sc=static_cast<ShadeContext&>(vri);
 
-    Point3 uv = sc.UVW(1);
-
-    //Convert the view and light directions to the correct coordinate system
-    Point3 viewDir, lightDir;
-    viewDir.x = -rc.rayparams.viewDir.x;
-    viewDir.y = -rc.rayparams.viewDir.y;
-    viewDir.z = -rc.rayparams.viewDir.z;
-    viewDir = sc.VectorFrom(viewDir,REF_WORLD);
-    viewDir = viewDir.Normalize();
-
+    //Convert the light direction to the shading frame of the intersection
+    Point3 lightDir;
     lightDir.x = direction.x;
     lightDir.y = direction.y;
     lightDir.z = direction.z;
     lightDir = sc.VectorFrom(lightDir,REF_WORLD);
     lightDir = lightDir.Normalize();
 
-    // UVW derivatives
-    Point3 dpdUVW[3];
-    sc.DPdUVW(dpdUVW,1);
-
-    Point3 n_vec = sc.Normal().Normalize();
-    Point3 u_vec = dpdUVW[0].Normalize();
-    Point3 v_vec = dpdUVW[1].Normalize();
-    u_vec = v_vec ^ n_vec;
-    v_vec = n_vec ^ u_vec;
-
-    intersection_data.wi_x = DotProd(lightDir, u_vec);
-    intersection_data.wi_y = DotProd(lightDir, v_vec);
-    intersection_data.wi_z = DotProd(lightDir, n_vec);
-
-    intersection_data.wo_x = DotProd(viewDir, u_vec);
-    intersection_data.wo_y = DotProd(viewDir, v_vec);
-    intersection_data.wo_z = DotProd(viewDir, n_vec);
-
-    intersection_data.uv_x = uv.x;
-    intersection_data.uv_y = uv.y;
+    const float *u = context->u_vec, *v = context->v_vec, *n = context->n_vec;
+    float wi_x = lightDir.x*u[0] + lightDir.y*u[1] + lightDir.z*u[2];
+    float wi_y = lightDir.x*v[0] + lightDir.y*v[1] + lightDir.z*v[2];
+    float wi_z = lightDir.x*n[0] + lightDir.y*n[1] + lightDir.z*n[2];
 
-    wcPatternData pattern_data = wcGetPatternData(intersection_data,
+    float specular;
+    wcIntersectionBatch directions = {0, 0, &wi_x, &wi_y, &wi_z,
+        &context->wo[0], &context->wo[1], &context->wo[2]};
+    wcEvalShadingPoint(&context->point, &directions, 1, 0, &specular,
         weave_parameters);
-    float s = weave_parameters->specular_strength *
-        wcEvalSpecular(intersection_data, pattern_data, weave_parameters);
+    float s = weave_parameters->specular_strength * specular;
     reflection_color->r = s;
     reflection_color->g = s;
     reflection_color->b = s;
@@ -20,7 +20,7 @@ using namespace VUtils;
 void
 MyBaseBSDF::init(const VRayContext &rc, wcWeaveParameters *weave_parameters) {
     m_weave_parameters = weave_parameters;
-    EvalDiffuseFunc(rc,weave_parameters,&diffuse_color);
+    EvalDiffuseFunc(rc,weave_parameters,&m_shading_context,&diffuse_color);
 
     orig_backside = rc.rayresult.realBack;
 
@@ -87,7 +87,8 @@ VUtils::Color MyBaseBSDF::eval(const VRayContext &rc, const Vector &direction,
         VUtils::Color reflect_color;
         //TODO(Vidar):Better importance sampling... Cosine weighted for now
         float probReflection=cs;
-        EvalSpecularFunc(rc,direction,m_weave_parameters,nm,&reflect_color);
+        EvalSpecularFunc(rc,direction,m_weave_parameters,&m_shading_context,
+            &reflect_color);
         //NOTE(Vidar): Multiple importance sampling factor
         float weight = getReflectionWeight(probLight,probReflection);
         ret += cs*reflect_color*weight;
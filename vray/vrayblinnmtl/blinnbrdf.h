@@ -2,6 +2,7 @@
 #define __BLINN_BRDF_SAMPLER__
 
 #include "woven_cloth.h"
+#include "dynamic.h"
 
 namespace VUtils {
 
@@ -15,6 +16,7 @@ protected:
 	Matrix nm, inm; // A matrix with the normal as the z-axis; can be used for anisotropy
 
     wcWeaveParameters *m_weave_parameters;
+    WCShadingContext m_shading_context;
 
 public:
 
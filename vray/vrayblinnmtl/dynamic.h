@@ -9,11 +9,22 @@
 #include "dbgprint.h"
 #include "woven_cloth.h"
 
+//NOTE(Vidar): Everything that is the same for all directions from one
+// intersection. Set up by EvalDiffuseFunc and used by EvalSpecularFunc, so
+// that the pattern is only looked up once per intersection.
+typedef struct
+{
+    wcShadingPoint point;
+    float u_vec[3], v_vec[3], n_vec[3]; //Shading frame
+    float wo[3]; //View direction in the shading frame
+} WCShadingContext;
+
 typedef void (*EVALDIFFUSEFUNC)(const VUtils::VRayContext &rc,
-    wcWeaveParameters *weave_parameters, VUtils::Color *diffuse_color);
+    wcWeaveParameters *weave_parameters, WCShadingContext *context,
+    VUtils::Color *diffuse_color);
 
 typedef void (*EVALSPECULARFUNC)( const VUtils::VRayContext &rc, const VUtils::Vector &direction,
-    wcWeaveParameters *weave_parameters, VUtils::Matrix nm,
+    wcWeaveParameters *weave_parameters, const WCShadingContext *context,
     VUtils::Color *reflection_color);
 
 /*typedef void (*EVALFUNC)(const VUtils::VRayContext &rc, const Vector &direction,
@@ -78,13 +89,14 @@ static void unload_dlls()
 void
 EvalDiffuseFunc
 (const VUtils::VRayContext &rc,
-    wcWeaveParameters *weave_parameters, VUtils::Color *diffuse_color);
+    wcWeaveParameters *weave_parameters, WCShadingContext *context,
+    VUtils::Color *diffuse_color);
 #endif
 
 #ifndef DYNAMIC
 void
 EvalSpecularFunc
 ( const VUtils::VRayContext &rc, const VUtils::Vector &direction,
-    wcWeaveParameters *weave_parameters, VUtils::Matrix nm,
+    wcWeaveParameters *weave_parameters, const WCShadingContext *context,
     VUtils::Color *reflection_color);
 #endif
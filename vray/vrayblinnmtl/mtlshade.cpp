@@ -74,6 +74,8 @@ Interval SkeletonMaterial::DisplacementValidity(TimeValue t)
 VR::BSDFSampler* SkeletonMaterial::newBSDF(const VR::VRayContext &rc, VR::VRenderMtlFlags flags) {
 	MyBlinnBSDF *bsdf=bsdfPool.newBRDF(rc);
 	if (!bsdf) return NULL;
+    // Only blocks until the pattern has been loaded
+    wcWaitForWeavePattern(m_pattern_load);
     bsdf->init(rc, &m_weave_parameters);
 	return bsdf;
 }
@@ -288,6 +288,7 @@ void SkeletonMaterial::Reset() {
 
 SkeletonMaterial::SkeletonMaterial(BOOL loading) {
 	pblock=NULL;
+	m_pattern_load=NULL;
 	ivalid.SetEmpty();
 	SkelMtlCD.MakeAutoParamBlocks(this);	// make and intialize paramblock2
 }
@@ -425,9 +426,21 @@ void SkeletonMaterial::renderBegin(TimeValue t, VR::VRayRenderer *vray) {
     float yarnvar_octaves;
 	pblock->GetValue(mtl_yarnvar_octaves,t, yarnvar_octaves,ivalid);
 	m_weave_parameters.yarnvar_octaves = (int)yarnvar_octaves;
+    m_weave_parameters.segment_lookup = WC_SEGMENT_TABLE;
+    m_weave_parameters.intensity_hash = WC_INTENSITY_TEA;
+    m_weave_parameters.yarnvar_bake_resolution = 0;
+    m_weave_parameters.yarnvar_bake_repeats = 1;
+    m_weave_parameters.normalization_threads = 0;
+    m_weave_parameters.normalization_cache_dir = 0; //WC_NORMALIZATION_CACHE
+    m_weave_parameters.normalization_table = 0;
+    m_weave_parameters.normalization_tolerance = 0.f;
+    m_weave_parameters.implicit_pattern_threshold = 0;
+    m_weave_parameters.albedo_table = 0; //The reflections use specular_strength
 
     MSTR filename = pblock->GetStr(mtl_wiffile,t);
-    wcWeavePatternFromFile_wchar(&m_weave_parameters,filename);
+    // Waited for in newBSDF
+    m_pattern_load = wcWeavePatternFromFileAsync_wchar(&m_weave_parameters,
+        filename, 0);
 
 	const VR::VRaySequenceData &sdata=vray->getSequenceData();
 	bsdfPool.init(sdata.maxRenderThreads);
@@ -435,6 +448,8 @@ void SkeletonMaterial::renderBegin(TimeValue t, VR::VRayRenderer *vray) {
 
 void SkeletonMaterial::renderEnd(VR::VRayRenderer *vray) {
     //TODO(Vidar): Free pattern
+    wcFinishWeavePattern(m_pattern_load);
+    m_pattern_load = NULL;
     wcFreeWeavePattern(&m_weave_parameters);
 	bsdfPool.freeMem();
 	renderChannels.freeMem();
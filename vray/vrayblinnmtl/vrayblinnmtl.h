@@ -79,6 +79,8 @@ public:
 	// various variables
 	Interval ivalid;
     wcWeaveParameters m_weave_parameters;
+    // Loads the pattern while V-Ray prepares the rest of the scene
+    wcWeavePatternLoad *m_pattern_load;
 
 	// Cached parameters
 	float glossiness;